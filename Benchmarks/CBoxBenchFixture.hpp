@@ -0,0 +1,82 @@
+/*!
+ * \file CBoxBenchFixture.hpp
+ * \brief Synthetic box mesh of controlled size for the kernel micro-benchmarks.
+ * \note Modeled on the fixtures of the unit tests, the mesh dimensions control
+ *       the matrix bandwidth of the structured point numbering.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "../Common/include/geometry/CPhysicalGeometry.hpp"
+
+/*!
+ * \brief Config and fully preprocessed geometry for an nx x ny x nz hexahedral box.
+ */
+struct CBoxBenchFixture {
+  std::unique_ptr<CConfig> config;
+  std::unique_ptr<CGeometry> geometry;
+
+  CBoxBenchFixture(unsigned long nx, unsigned long ny, unsigned long nz) {
+    const std::string configOptions =
+        "SOLVER= NAVIER_STOKES\n"
+        "MESH_FORMAT= BOX\n"
+        "INIT_OPTION= TD_CONDITIONS\n"
+        "MARKER_HEATFLUX= (y_minus, 0.0, y_plus, 0.0)\n"
+        "MARKER_FAR= (x_minus, x_plus, z_plus, z_minus)\n"
+        "LINEAR_SOLVER_PREC= ILU\n"
+        "MESH_BOX_SIZE= " + std::to_string(nx) + "," + std::to_string(ny) + "," + std::to_string(nz) + "\n"
+        "MESH_BOX_LENGTH= 1,1,1\n"
+        "MESH_BOX_OFFSET= 0,0,0\n";
+
+    /*--- Suppress the usual preprocessing output. ---*/
+    auto origBuf = std::cout.rdbuf();
+    std::cout.rdbuf(nullptr);
+
+    std::stringstream ss(configOptions);
+    config = std::unique_ptr<CConfig>(new CConfig(ss, SU2_COMPONENT::SU2_CFD, false));
+
+    {
+      auto aux_geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(config.get(), 0, 1));
+      geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(aux_geometry.get(), config.get()));
+    }
+    geometry->SetSendReceive(config.get());
+    geometry->SetBoundaries(config.get());
+    geometry->SetPoint_Connectivity();
+    geometry->SetElement_Connectivity();
+    geometry->SetBoundVolume();
+    geometry->SetEdges();
+    geometry->SetVertex(config.get());
+    geometry->SetControlVolume(config.get(), ALLOCATE);
+    geometry->SetBoundControlVolume(config.get(), ALLOCATE);
+    geometry->FindNormal_Neighbor(config.get());
+    geometry->SetGlobal_to_Local_Point();
+    geometry->PreprocessP2PComms(geometry.get(), config.get());
+
+    std::cout.rdbuf(origBuf);
+  }
+};
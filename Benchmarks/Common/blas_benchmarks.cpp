@@ -0,0 +1,94 @@
+/*!
+ * \file blas_benchmarks.cpp
+ * \brief Micro-benchmarks for the dense linear algebra (gemm at DG-type
+ *        shapes) and for C2DContainer access patterns.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../benchmark.hpp"
+
+#include "../../Common/include/basic_types/datatype_structure.hpp"
+#include "../../Common/include/linear_algebra/blas_structure.hpp"
+#include "../../Common/include/containers/C2DContainer.hpp"
+
+#include <vector>
+
+BENCHMARK_CASE("CBlasStructure::gemm (DG shapes)") {
+
+  CBlasStructure blas;
+
+  /*--- (M,N,K) = (nIntegration/nDOFs, nVar, nDOFs) of typical p1-p3 elements. ---*/
+  const int shapes[][3] = {{10, 5, 10}, {20, 5, 20}, {35, 5, 35}, {64, 5, 27}, {125, 5, 64}};
+
+  for (const auto& shape : shapes) {
+    const int M = shape[0], N = shape[1], K = shape[2];
+
+    std::vector<su2double> A(M * K, 1.0), B(K * N, 1.0), C(M * N);
+
+    const std::string label =
+        "gemm " + std::to_string(M) + "x" + std::to_string(N) + "x" + std::to_string(K);
+
+    Benchmark::Run(label, [&]() { blas.gemm(M, N, K, A.data(), B.data(), C.data(), nullptr); });
+  }
+}
+
+BENCHMARK_CASE("C2DContainer access patterns") {
+
+  const unsigned long nPoint = 200000, nVar = 8;
+  const double bytes = nPoint * nVar * sizeof(su2double);
+
+  su2activematrix mat(nPoint, nVar);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) mat(iPoint, iVar) = 1.0;
+
+  su2double sink = 0.0;
+
+  /*--- Row-major traversal, the layout of the container. ---*/
+  Benchmark::Run("rows outer, vars inner (sequential)", [&]() {
+    su2double sum = 0.0;
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) sum += mat(iPoint, iVar);
+    sink += sum;
+  }, bytes);
+
+  /*--- Transposed traversal, strided by nVar. ---*/
+  Benchmark::Run("vars outer, rows inner (strided)", [&]() {
+    su2double sum = 0.0;
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) sum += mat(iPoint, iVar);
+    sink += sum;
+  }, bytes);
+
+  /*--- Row pointer access, the pattern of the point loops in the solvers. ---*/
+  Benchmark::Run("row pointer access", [&]() {
+    su2double sum = 0.0;
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      const su2double* row = mat[iPoint];
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) sum += row[iVar];
+    }
+    sink += sum;
+  }, bytes);
+
+  /*--- Keep the result alive so the loops are not optimized out. ---*/
+  if (sink < 0.0) std::printf("impossible\n");
+}
@@ -0,0 +1,85 @@
+/*!
+ * \file linear_algebra_benchmarks.cpp
+ * \brief Micro-benchmarks for the sparse linear algebra (block SpMV and
+ *        ILU0 factorization/application) on a synthetic box mesh.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../benchmark.hpp"
+#include "../CBoxBenchFixture.hpp"
+
+#include "../../Common/include/linear_algebra/CSysMatrix.hpp"
+#include "../../Common/include/linear_algebra/CSysVector.hpp"
+
+#include <vector>
+
+BENCHMARK_CASE("CSysMatrix SpMV and ILU0, block sizes 4-7 (33^3 box)") {
+
+  CBoxBenchFixture box(33, 33, 33);
+  auto* geometry = box.geometry.get();
+  const auto* config = box.config.get();
+
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const auto nnz = geometry->GetSparsePattern(ConnectivityType::FiniteVolume, 0).getNumNonZeros();
+
+  /*--- The block size of the flow Jacobians is a runtime quantity (nVar),
+   5-7 cover 3D flow systems, 4 covers 2D. ---*/
+
+  for (unsigned short nVar = 4; nVar <= 7; ++nVar) {
+
+    CSysMatrix<su2mixedfloat> matrix;
+    matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+
+    CSysVector<su2mixedfloat> x(nPoint, nPointDomain, nVar, 1.0);
+    CSysVector<su2mixedfloat> y(nPoint, nPointDomain, nVar, 0.0);
+
+    /*--- Synthetic, diagonally dominant values so that the ILU factorization
+     is well defined. Off-diagonal blocks are dense. ---*/
+
+    matrix.SetValZero();
+    std::vector<su2mixedfloat> block(nVar * nVar, -1.0 / nVar);
+
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      for (auto jPoint : geometry->nodes->GetPoints(iPoint))
+        matrix.SetBlock(iPoint, jPoint, block.data());
+      matrix.SetVal2Diag(iPoint, su2mixedfloat(geometry->nodes->GetnPoint(iPoint) + 1.0));
+    }
+
+    const std::string suffix = " nVar=" + std::to_string(nVar);
+    const double matBytes = static_cast<double>(nnz) * nVar * nVar * sizeof(su2mixedfloat);
+    const double vecBytes = 2.0 * nPoint * nVar * sizeof(su2mixedfloat);
+
+    Benchmark::Run("SpMV" + suffix, [&]() {
+      matrix.MatrixVectorProduct(x, y, geometry, config);
+    }, matBytes + vecBytes);
+
+    Benchmark::Run("ILU0 build" + suffix, [&]() {
+      matrix.BuildILUPreconditioner();
+    }, 2.0 * matBytes);
+
+    Benchmark::Run("ILU0 apply" + suffix, [&]() {
+      matrix.ComputeILUPreconditioner(x, y, geometry, config);
+    }, matBytes + vecBytes);
+  }
+}
@@ -0,0 +1,81 @@
+/*!
+ * \file gradient_benchmarks.cpp
+ * \brief Micro-benchmarks for the Green-Gauss gradient and the slope
+ *        limiter kernels on a synthetic box mesh.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../benchmark.hpp"
+#include "../CBoxBenchFixture.hpp"
+
+#include "../../Common/include/containers/container_decorators.hpp"
+#include "../../SU2_CFD/include/solvers/CSolver.hpp"
+#include "../../SU2_CFD/include/gradients/computeGradientsGreenGauss.hpp"
+#include "../../SU2_CFD/include/gradients/computeGradientsLeastSquares.hpp"
+#include "../../SU2_CFD/include/limiters/computeLimiters.hpp"
+
+BENCHMARK_CASE("Green-Gauss gradients and limiters (33^3 box)") {
+
+  CBoxBenchFixture box(33, 33, 33);
+  auto& geometry = *box.geometry;
+  const auto& config = *box.config;
+
+  const auto nPoint = geometry.GetnPoint();
+  const auto nDim = geometry.GetnDim();
+  const unsigned long nVar = 5;
+
+  /*--- A smooth synthetic field, no solver is needed (and passing none
+   skips the MPI communications, which are timed separately). ---*/
+
+  su2activematrix field(nPoint, nVar);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    const auto coord = geometry.nodes->GetCoord(iPoint);
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      field(iPoint, iVar) = (iVar + 1.0) * (coord[0] + 2.0 * coord[1] + 3.0 * coord[2]);
+  }
+
+  C3DDoubleMatrix gradient(nPoint, nVar, nDim);
+  C3DDoubleMatrix rmatrix(nPoint, nDim, nDim);
+
+  Benchmark::Run("computeGradientsGreenGauss", [&]() {
+    computeGradientsGreenGauss(nullptr, SOLUTION, PERIODIC_NONE, geometry, config,
+                               field, 0, nVar, gradient);
+  });
+
+  Benchmark::Run("computeGradientsLeastSquares (weighted)", [&]() {
+    computeGradientsLeastSquares(nullptr, SOLUTION, PERIODIC_NONE, geometry, config,
+                                 true, field, 0, nVar, gradient, rmatrix);
+  });
+
+  su2activematrix fieldMin(nPoint, nVar), fieldMax(nPoint, nVar), limiter(nPoint, nVar);
+
+  Benchmark::Run("computeLimiters (Venkatakrishnan)", [&]() {
+    computeLimiters(VENKATAKRISHNAN, nullptr, SOLUTION_LIMITER, PERIODIC_NONE, PERIODIC_NONE,
+                    geometry, config, 0, nVar, field, gradient, fieldMin, fieldMax, limiter);
+  });
+
+  Benchmark::Run("computeLimiters (Barth-Jespersen)", [&]() {
+    computeLimiters(BARTH_JESPERSEN, nullptr, SOLUTION_LIMITER, PERIODIC_NONE, PERIODIC_NONE,
+                    geometry, config, 0, nVar, field, gradient, fieldMin, fieldMax, limiter);
+  });
+}
@@ -0,0 +1,116 @@
+/*!
+ * \file benchmark.hpp
+ * \brief Small harness for the kernel micro-benchmarks (case registry,
+ *        adaptive repetition timing, and result printing).
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace Benchmark {
+
+/*!
+ * \brief One registered benchmark case (a function that prints one or more result rows).
+ */
+struct CCase {
+  std::string name;
+  void (*func)();
+};
+
+/*!
+ * \brief Global registry of cases, populated by the BENCHMARK_CASE macro.
+ */
+inline std::vector<CCase>& GetCases() {
+  static std::vector<CCase> cases;
+  return cases;
+}
+
+struct CRegistrar {
+  CRegistrar(const char* name, void (*func)()) { GetCases().push_back({name, func}); }
+};
+
+/*!
+ * \brief Print the header of the result table.
+ */
+inline void PrintHeader() {
+  std::printf("%-48s %12s %14s %10s\n", "benchmark", "repetitions", "time/rep [us]", "[GB/s]");
+}
+
+/*!
+ * \brief Time "body", doubling the number of repetitions until the run is long
+ * enough for the timing to be reliable, and print one result row.
+ * \param[in] label - Name of the result row.
+ * \param[in] body - Callable with the work to be timed.
+ * \param[in] bytesPerRep - Optional amount of data moved per repetition, to
+ * report an effective bandwidth (0 to skip the column).
+ */
+template <class Body>
+void Run(const std::string& label, Body body, double bytesPerRep = 0.0) {
+  using Clock = std::chrono::steady_clock;
+  constexpr double targetTime = 0.25;
+
+  /*--- Warmup, also serves to map the memory before timing. ---*/
+  body();
+
+  unsigned long reps = 1;
+  double elapsed = 0.0;
+
+  while (true) {
+    const auto t0 = Clock::now();
+    for (auto i = 0ul; i < reps; ++i) body();
+    elapsed = std::chrono::duration<double>(Clock::now() - t0).count();
+
+    if (elapsed > targetTime) break;
+
+    /*--- Extrapolate towards the target time instead of plain doubling
+     to limit the total run time of very slow cases. ---*/
+    const auto target = static_cast<unsigned long>(reps * targetTime / std::max(elapsed, 1e-9));
+    reps = std::max(2 * reps, std::min(target, 16 * reps));
+  }
+
+  const double timePerRep = elapsed / reps;
+
+  if (bytesPerRep > 0.0)
+    std::printf("%-48s %12lu %14.3f %10.2f\n", label.c_str(), reps, 1e6 * timePerRep, 1e-9 * bytesPerRep / timePerRep);
+  else
+    std::printf("%-48s %12lu %14.3f %10s\n", label.c_str(), reps, 1e6 * timePerRep, "-");
+}
+
+}  // namespace Benchmark
+
+#define BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_IMPL(a, b)
+
+/*--- Define and register a benchmark case, usage:
+ BENCHMARK_CASE("name") { ... Benchmark::Run("row", body); ... } ---*/
+#define BENCHMARK_CASE(NAME)                                                                \
+  static void BENCHMARK_CONCAT(benchCase_, __LINE__)();                                     \
+  static Benchmark::CRegistrar BENCHMARK_CONCAT(benchReg_, __LINE__)(                       \
+      NAME, &BENCHMARK_CONCAT(benchCase_, __LINE__));                                       \
+  static void BENCHMARK_CONCAT(benchCase_, __LINE__)()
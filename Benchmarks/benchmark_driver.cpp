@@ -0,0 +1,62 @@
+/*!
+ * \file benchmark_driver.cpp
+ * \brief The main entry point for the kernel micro-benchmarks.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark.hpp"
+
+#include "../Common/include/parallelization/mpi_structure.hpp"
+#include "../Common/include/parallelization/omp_structure.hpp"
+
+#include <cstring>
+
+int main(int argc, char* argv[]) {
+
+  /*--- Startup MPI (the kernels use the communication infrastructure even
+   when running on one rank), an optional argument filters the cases. ---*/
+
+  omp_initialize();
+
+#if defined(HAVE_OMP) && defined(HAVE_MPI)
+  int provided;
+  SU2_MPI::Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+#else
+  SU2_MPI::Init(&argc, &argv);
+#endif
+
+  const char* filter = (argc > 1) ? argv[1] : nullptr;
+
+  for (const auto& benchCase : Benchmark::GetCases()) {
+    if (filter && benchCase.name.find(filter) == std::string::npos) continue;
+
+    std::printf("\n--- %s ---\n", benchCase.name.c_str());
+    Benchmark::PrintHeader();
+    benchCase.func();
+  }
+
+  SU2_MPI::Finalize();
+  omp_finalize();
+
+  return EXIT_SUCCESS;
+}
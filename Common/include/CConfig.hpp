@@ -41,6 +41,7 @@
 #include <stdlib.h>
 #include <cmath>
 #include <map>
+#include <unordered_map>
 #include <assert.h>
 
 #include "option_structure.hpp"
@@ -80,6 +81,10 @@ private:
   su2double EA_ScaleFactor;       /*!< \brief Equivalent Area scaling factor */
   su2double AdjointLimit;         /*!< \brief Adjoint variable limit */
   string* ConvField;              /*!< \brief Field used for convergence check.*/
+  su2double* ConvFieldEps;        /*!< \brief Per-field tolerance overriding the global epsilon, paired with ConvField. */
+  unsigned short nConvFieldEps;   /*!< \brief Number of per-field convergence tolerances. */
+  su2double Cauchy_Variance_Eps;  /*!< \brief Relative standard deviation below which an oscillating coefficient counts as converged. */
+  su2double Residual_Slope_Eps;   /*!< \brief Mean residual slope (orders per iteration) below which a residual counts as stalled/converged. */
   string ConvCriteria;            // This option is deprecated. After a grace period until 7.2.0 the usage warning should become an error.
 
   string* WndConvField;              /*!< \brief Function where to apply the windowed convergence criteria for the time average of the unsteady (single zone) flow problem. */
@@ -134,6 +139,7 @@ private:
   Hold_GridFixed,           /*!< \brief Flag hold fixed some part of the mesh during the deformation. */
   Axisymmetric,             /*!< \brief Flag for axisymmetric calculations */
   Integrated_HeatFlux;      /*!< \brief Flag for heat flux BC whether it deals with integrated values.*/
+  su2double AdjFidelityRadius;  /*!< \brief Wall distance within which the adjoint recording keeps full second-order numerics. */
   su2double Buffet_k;       /*!< \brief Sharpness coefficient for buffet sensor.*/
   su2double Buffet_lambda;  /*!< \brief Offset parameter for buffet sensor.*/
   su2double Damp_Engine_Inflow;   /*!< \brief Damping factor for the engine inlet. */
@@ -154,15 +160,20 @@ private:
   TIME_MARCHING TimeMarching;        /*!< \brief Steady or unsteady (time stepping or dual time stepping) computation. */
   unsigned short Dynamic_Analysis;   /*!< \brief Static or dynamic structural analysis. */
   unsigned short nStartUpIter;       /*!< \brief Start up iterations using the fine grid. */
+  su2double FullMG_ResOrderDrop;     /*!< \brief Residual orders of magnitude on a full multigrid start-up level before prolongating. */
+  unsigned long FullMG_MaxLevelIter; /*!< \brief Maximum iterations on a full multigrid start-up level before prolongating. */
   su2double FixAzimuthalLine;        /*!< \brief Fix an azimuthal line due to misalignments of the nearfield. */
   su2double **DV_Value;              /*!< \brief Previous value of the design variable. */
   su2double Venkat_LimiterCoeff;     /*!< \brief Limiter coefficient */
   unsigned long LimiterIter;         /*!< \brief Freeze the value of the limiter after a number of iterations */
+  su2double LimiterRecomputeThreshold; /*!< \brief Relative solution change that triggers limiter recomputation (incremental mode). */
+  unsigned long LimiterRefreshPeriod;  /*!< \brief Iterations between full limiter recomputations in incremental mode. */
   su2double AdjSharp_LimiterCoeff;   /*!< \brief Coefficient to identify the limit of a sharp edge. */
   unsigned short SystemMeasurements; /*!< \brief System of measurements. */
   ENUM_REGIME Kind_Regime;           /*!< \brief Kind of flow regime: in/compressible. */
   unsigned short *Kind_ObjFunc;      /*!< \brief Kind of objective function. */
   su2double *Weight_ObjFunc;         /*!< \brief Weight applied to objective function. */
+  bool Objective_Replay;             /*!< \brief Evaluate the objectives from the restart solution and exit without solving. */
   unsigned short Kind_SensSmooth;    /*!< \brief Kind of sensitivity smoothing technique. */
   unsigned short Continuous_Eqns;    /*!< \brief Which equations to treat continuously (Hybrid adjoint)*/
   unsigned short Discrete_Eqns;      /*!< \brief Which equations to treat discretely (Hybrid adjoint). */
@@ -227,6 +238,10 @@ private:
   bool Inlet_From_File;         /*!< \brief True if the inlet profile is to be loaded from a file. */
   string Inlet_Filename;        /*!< \brief Filename specifying an inlet profile. */
   su2double Inlet_Matching_Tol; /*!< \brief Tolerance used when matching a point to a point from the inlet file. */
+  su2double SEM_Intensity;      /*!< \brief Turbulence intensity of the synthetic eddy inflow (0 disables it). */
+  su2double SEM_LengthScale;    /*!< \brief Eddy length scale of the synthetic eddy inflow (mesh units). */
+  unsigned long SEM_nEddy;      /*!< \brief Number of synthetic eddies per inlet marker. */
+  unsigned long SEM_Seed;       /*!< \brief Random seed of the synthetic eddy inflow. */
   string ActDisk_FileName;      /*!< \brief Filename specifying an actuator disk. */
 
   string *Marker_Euler,           /*!< \brief Euler wall markers. */
@@ -420,12 +435,18 @@ private:
   su2double *WeightsIntegrationADER_DG;     /*!< \brief The weights of the ADER-DG time integration points on the interval [-1,1]. */
   unsigned short nRKStep;                   /*!< \brief Number of steps of the explicit Runge-Kutta method. */
   su2double *RK_Alpha_Step;                 /*!< \brief Runge-Kutta beta coefficients. */
+  unsigned short Residual_Smoothing_Sweeps; /*!< \brief Jacobi sweeps of residual smoothing for the explicit schemes. */
+  su2double Residual_Smoothing_Coeff;       /*!< \brief Coefficient of the residual smoothing for the explicit schemes. */
 
   unsigned short nQuasiNewtonSamples;  /*!< \brief Number of samples used in quasi-Newton solution methods. */
   bool UseVectorization;       /*!< \brief Whether to use vectorized numerics schemes. */
   bool NewtonKrylov;           /*!< \brief Use a coupled Newton method to solve the flow equations. */
-  array<unsigned short,3> NK_IntParam{{20, 3, 2}}; /*!< \brief Integer parameters for NK method. */
+  array<unsigned short,4> NK_IntParam{{20, 3, 2, 1}}; /*!< \brief Integer parameters for NK method. */
+  unsigned short Jacobian_Freeze_Period; /*!< \brief Implicit iterations between Jacobian assemblies. */
   array<su2double,4> NK_DblParam{{-2.0, 0.1, -3.0, 1e-4}}; /*!< \brief Floating-point parameters for NK method. */
+  bool Region_Freezing;                   /*!< \brief Skip edge computations inside converged regions of steady runs. */
+  su2double Region_Freezing_Tol;          /*!< \brief Residual magnitude below which a point counts as converged. */
+  unsigned long Region_Freezing_Interval; /*!< \brief Iterations between full thaws of the frozen regions. */
 
   unsigned short nMGLevels;    /*!< \brief Number of multigrid levels (coarse levels). */
   unsigned short nCFL;         /*!< \brief Number of CFL, one for each multigrid level. */
@@ -438,6 +459,7 @@ private:
   Unst_CFL;                    /*!< \brief Unsteady CFL number. */
 
   bool ReorientElements;       /*!< \brief Flag for enabling element reorientation. */
+  POINT_REORDERING Kind_Point_Reordering; /*!< \brief Renumbering of the points of the partitioned grid. */
   bool AddIndNeighbor;         /*!< \brief Include indirect neighbor in the agglomeration process. */
   unsigned short nDV,                  /*!< \brief Number of design variables. */
   nObj, nObjW;                         /*! \brief Number of objective functions. */
@@ -550,6 +572,8 @@ private:
   bool EulerPersson;       /*!< \brief Boolean to determine whether this is an Euler simulation with Persson shock capturing. */
   bool FSI_Problem = false,/*!< \brief Boolean to determine whether the simulation is FSI or not. */
   Multizone_Problem;       /*!< \brief Boolean to determine whether we are solving a multizone problem. */
+  bool Multizone_Freeze_Converged; /*!< \brief Skip the inner solve of zones that converged and whose donor zones are frozen. */
+  bool Multizone_Adapt_InnerIter;  /*!< \brief Adapt the inner-iteration budget of each zone to the contraction of its coupling residuals. */
   unsigned short nID_DV;   /*!< \brief ID for the region of FEM when computed using direct differentiation. */
 
   bool AD_Mode;             /*!< \brief Algorithmic Differentiation support. */
@@ -580,9 +604,16 @@ private:
   su2double Linear_Solver_Smoother_Relaxation;   /*!< \brief Relaxation factor for iterative linear smoothers. */
   unsigned long Linear_Solver_Iter;              /*!< \brief Max iterations of the linear solver for the implicit formulation. */
   unsigned long Deform_Linear_Solver_Iter;       /*!< \brief Max iterations of the linear solver for the implicit formulation. */
+  unsigned short Linear_Solver_Refine_Iter;        /*!< \brief Iterative refinement sweeps around a mixed precision linear solve. */
+  unsigned short Deform_Linear_Solver_Refine_Iter; /*!< \brief Iterative refinement sweeps for the mesh deformation linear solve. */
+  bool Deform_MatrixFree;                        /*!< \brief Apply the mesh deformation stiffness operator element-wise instead of assembling it. */
   unsigned long Linear_Solver_Restart_Frequency; /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
   unsigned long Linear_Solver_Prec_Threads;      /*!< \brief Number of threads per rank for ILU and LU_SGS preconditioners. */
   unsigned short Linear_Solver_ILU_n;            /*!< \brief ILU fill=in level. */
+  bool Linear_Solver_Prec_Single;                /*!< \brief Store and apply the ILU-type preconditioners in single precision. */
+  bool Linear_Solver_Warm_Start;                 /*!< \brief Use the solution of the previous linear solve as initial guess. */
+  su2double Linear_Solver_Warm_Start_Scale;      /*!< \brief Scaling applied to the retained solution when warm starting. */
+  bool Enable_Cuda;                              /*!< \brief Offload the linear solver hot path (SpMV and Jacobi) to CUDA devices. */
   su2double SemiSpan;                   /*!< \brief Wing Semi span. */
   su2double Roe_Kappa;                  /*!< \brief Relaxation of the Roe scheme. */
   su2double Relaxation_Factor_Adjoint;  /*!< \brief Relaxation coefficient for variable updates of adjoint solvers. */
@@ -628,6 +659,8 @@ private:
   su2double AoA,              /*!< \brief Angle of attack (just external flow). */
   iH, AoS, AoA_Offset,
   AoS_Offset, AoA_Sens;       /*!< \brief Angle of sideSlip (just external flow). */
+  su2double* AoA_Sweep;       /*!< \brief Angles of attack visited by continuation after the base angle converges. */
+  unsigned short nAoA_Sweep;  /*!< \brief Number of sweep angles of attack. */
   bool Fixed_CL_Mode;         /*!< \brief Activate fixed CL mode (external flow only). */
   bool Fixed_CM_Mode;         /*!< \brief Activate fixed CL mode (external flow only). */
   bool Eval_dOF_dCX;          /*!< \brief Activate fixed CL mode (external flow only). */
@@ -660,7 +693,10 @@ private:
   su2double Cauchy_Eps;               /*!< \brief Epsilon used for the convergence. */
   bool Restart,                 /*!< \brief Restart solution (for direct, adjoint, and linearized problems).*/
   Read_Binary_Restart,          /*!< \brief Read binary SU2 native restart files.*/
+  Wrt_Restart_Single,           /*!< \brief Write the data of binary SU2 native restart files in single precision.*/
+  Wrt_Restart_Delta,            /*!< \brief Delta-encode binary SU2 native restart files between keyframes.*/
   Restart_Flow;                 /*!< \brief Restart flow solution for adjoint and linearized problems. */
+  unsigned short Restart_Keyframe_Interval; /*!< \brief Restart writes between full (keyframe) restarts with WRT_RESTART_DELTA. */
   unsigned short nMarker_Monitoring,  /*!< \brief Number of markers to monitor. */
   nMarker_Designing,                  /*!< \brief Number of markers for the objective function. */
   nMarker_GeoEval,                    /*!< \brief Number of markers for the objective function. */
@@ -729,6 +765,7 @@ private:
   unsigned short nCFL_AdaptParam;     /*!< \brief Number of CFL parameters provided in config. */
   unsigned short nTransTS_Param;     /*!< \brief Number of transition model (TS) parameters provided in config. */
   bool CFL_Adapt;        /*!< \brief Use adaptive CFL number. */
+  bool CFL_Adapt_Local;  /*!< \brief Evolve the CFL of each point from its own convergence state. */
   bool HB_Precondition;  /*!< \brief Flag to turn on harmonic balance source term preconditioning */
   su2double RefArea,     /*!< \brief Reference area for coefficient computation. */
   RefElemLength,         /*!< \brief Reference element length for computing the slope limiting epsilon. */
@@ -767,6 +804,8 @@ private:
 
   bool
   Wrt_Performance,           /*!< \brief Write the performance summary at the end of a calculation.  */
+  Wrt_MemoryFootprint,       /*!< \brief Write the memory footprint report at the end of preprocessing.  */
+  Wrt_Async,                 /*!< \brief Write the binary volume files asynchronously in a background thread.  */
   Wrt_AD_Statistics,         /*!< \brief Write the tape statistics (discrete adjoint).  */
   Wrt_MeshQuality,           /*!< \brief Write the mesh quality statistics to the visualization files.  */
   Wrt_MultiGrid,             /*!< \brief Write the coarse grids to the visualization files.  */
@@ -798,6 +837,8 @@ private:
   Pressure_Critical,     /*!< \brief Critical Pressure for real fluid model.  */
   Density_Critical,      /*!< \brief Critical Density for real fluid model.  */
   Acentric_Factor,       /*!< \brief Acentric Factor for real fluid model.  */
+  Tabulated_Rho_Limits[2],    /*!< \brief Density range covered by the tabulated fluid model. */
+  Tabulated_Energy_Limits[2], /*!< \brief Static energy range covered by the tabulated fluid model. */
   Mu_Constant,           /*!< \brief Constant viscosity for ConstantViscosity model.  */
   Mu_ConstantND,         /*!< \brief Non-dimensional constant viscosity for ConstantViscosity model.  */
   Thermal_Conductivity_Constant,   /*!< \brief Constant thermal conductivity for ConstantConductivity model.  */
@@ -832,7 +873,8 @@ private:
   su2double wallModel_Kappa,        /*!< \brief von Karman constant kappa for turbulence wall modeling */
   wallModel_B,                      /*!< \brief constant B for turbulence wall modeling */
   wallModel_RelFac,                 /*!< \brief relaxation factor for the Newton method used in the wall model */
-  wallModel_MinYplus;               /*!< \brief minimum Y+ value, below which the wall model is not used anymore */
+  wallModel_MinYplus,               /*!< \brief minimum Y+ value, below which the wall model is not used anymore */
+  wallModel_Tol;                    /*!< \brief convergence tolerance for the iterative LES wall models */
   su2double Prandtl_Lam,      /*!< \brief Laminar Prandtl number for the gas.  */
   Prandtl_Turb,               /*!< \brief Turbulent Prandtl number for the gas.  */
   Length_Ref,                 /*!< \brief Reference length for non-dimensionalization. */
@@ -972,6 +1014,7 @@ private:
   bool RadialBasisFunction_PolynomialOption; /*!< \brief Option of whether to include polynomial terms in Radial Basis Function Interpolation or not. */
   su2double RadialBasisFunction_Parameter;   /*!< \brief Radial basis function parameter (radius). */
   su2double RadialBasisFunction_PruneTol;    /*!< \brief Tolerance to prune the RBF interpolation matrix. */
+  unsigned long RadialBasisFunction_MaxClusterSize; /*!< \brief Maximum donor cluster size for partition-of-unity RBF interpolation (0 = dense). */
   bool Prestretch;                           /*!< \brief Read a reference geometry for optimization purposes. */
   string Prestretch_FEMFileName;             /*!< \brief File name for reference geometry. */
   string FEA_FileName;              /*!< \brief File name for element-based properties. */
@@ -985,6 +1028,8 @@ private:
   su2double ParMETIS_tolerance;     /*!< \brief Load balancing tolerance for ParMETIS. */
   long ParMETIS_pointWgt;           /*!< \brief Load balancing weight given to points. */
   long ParMETIS_edgeWgt;            /*!< \brief Load balancing weight given to edges. */
+  long ParMETIS_wallWgt;            /*!< \brief Extra load balancing weight given to solid wall points. */
+  bool PartitionCache;              /*!< \brief Cache the mesh partitioning on disk and reuse it. */
   unsigned short DirectDiff;        /*!< \brief Direct Differentation mode. */
   bool DiscreteAdjoint;                /*!< \brief AD-based discrete adjoint mode. */
   su2double Const_DES;                 /*!< \brief Detached Eddy Simulation Constant. */
@@ -1008,6 +1053,9 @@ private:
   array<su2double, N_POLY_COEFFS> mu_polycoeffs{{0.0}};  /*!< \brief Array for viscosity polynomial coefficients. */
   array<su2double, N_POLY_COEFFS> kt_polycoeffs{{0.0}};  /*!< \brief Array for thermal conductivity polynomial coefficients. */
   bool Body_Force;                      /*!< \brief Flag to know if a body force is included in the formulation. */
+  bool Sponge_Layer;                    /*!< \brief Flag to know if a sponge layer source term is included in the formulation. */
+  su2double sponge_layer_box[6];        /*!< \brief Bounding box of the sponge layer support (Xmin, Ymin, Zmin, Xmax, Ymax, Zmax). */
+  su2double Sponge_Layer_Coeff;         /*!< \brief Damping coefficient of the sponge layer source term. */
 
   ENUM_STREAMWISE_PERIODIC Kind_Streamwise_Periodic; /*!< \brief Kind of Streamwise periodic flow (pressure drop or massflow) */
   bool Streamwise_Periodic_Temperature;              /*!< \brief Use real periodicity for Energy equation or otherwise outlet source term. */
@@ -1082,10 +1130,14 @@ private:
   unsigned short byteAlignmentMatMul;        /*!< \brief Number of bytes in the vectorization direction for the matrix multiplication. Multipe of 64. */
   unsigned short sizeMatMulPadding;          /*!< \brief The matrix size in the vectorization direction padded to a multiple of 8. Computed from byteAlignmentMatMul. */
   bool Compute_Entropy;                      /*!< \brief Whether or not to compute the entropy in the fluid model. */
+  bool Tabulated_FluidModel;                 /*!< \brief Whether to evaluate the fluid model through a table sampled at startup. */
+  unsigned short nTabulated_Points;          /*!< \brief Number of table nodes per direction of the tabulated fluid model. */
   bool Use_Lumped_MassMatrix_DGFEM;          /*!< \brief Whether or not to use the lumped mass matrix for DGFEM. */
   bool Jacobian_Spatial_Discretization_Only; /*!< \brief Flag to know if only the exact Jacobian of the spatial discretization must be computed. */
   bool Compute_Average;                      /*!< \brief Whether or not to compute averages for unsteady simulations in FV or DG solver. */
   unsigned short Comm_Level;                 /*!< \brief Level of MPI communications to be performed. */
+  bool Comm_SinglePrecision;                 /*!< \brief Whether to exchange precision-tolerant halo quantities in single precision. */
+  unsigned long Residual_Sampling_Interval;  /*!< \brief Iterations between exact residual norms, sampled norms in between. */
   unsigned short Kind_Verification_Solution; /*!< \brief Verification solution for accuracy assessment. */
 
   bool Time_Domain;              /*!< \brief Determines if the multizone problem is solved in time-domain */
@@ -1102,6 +1154,11 @@ private:
   unsigned long VolumeWrtFreq;        /*!< \brief Writing frequency for solution files. */
   unsigned short* VolumeOutputFiles;  /*!< \brief File formats to output */
   unsigned short nVolumeOutputFiles;  /*!< \brief Number of File formats to output */
+  unsigned short nEnsembleCases;      /*!< \brief Number of config files of an ensemble run. */
+  string* EnsembleCases;              /*!< \brief Config files of the cases of an ensemble run. */
+  unsigned short nProbeCoord;         /*!< \brief Number of coordinate components defining point probes. */
+  su2double* ProbeCoord;              /*!< \brief Flattened coordinates of the point probes. */
+  unsigned long ProbeWrtFreq;         /*!< \brief Number of sampled steps buffered between probe flushes. */
 
   bool Multizone_Mesh;            /*!< \brief Determines if the mesh contains multiple zones. */
   bool SinglezoneDriver;          /*!< \brief Determines if the single-zone driver is used. (TEMPORARY) */
@@ -1124,10 +1181,14 @@ private:
   unsigned long pastix_fact_freq;  /*!< \brief (Re-)Factorization frequency for PaStiX */
   unsigned short pastix_verb_lvl;  /*!< \brief Verbosity level for PaStiX */
   unsigned short pastix_fill_lvl;  /*!< \brief Fill level for PaStiX ILU */
+  unsigned long pastix_max_dof;    /*!< \brief Global DOF above which a PaStiX direct solve falls back to FGMRES */
 
   string caseName;                 /*!< \brief Name of the current case */
 
   unsigned long edgeColorGroupSize; /*!< \brief Size of the edge groups colored for OpenMP parallelization of edge loops. */
+  bool edgeColorAutoTune;           /*!< \brief Select the edge-coloring group size automatically at preprocessing. */
+  bool Gradient_ReducerStrategy;    /*!< \brief Whether to use the edge-based reducer strategy for Green-Gauss gradients. */
+  bool Cost_Guided_Schedule;        /*!< \brief Adjust thread work ranges of hot point loops based on measured times. */
 
   INLET_SPANWISE_INTERP Kind_InletInterpolationFunction; /*!brief type of spanwise interpolation function to use for the inlet face. */
   INLET_INTERP_TYPE Kind_Inlet_InterpolationType;    /*!brief type of spanwise interpolation data to use for the inlet face. */
@@ -1172,9 +1233,10 @@ private:
   map<string, bool> all_options;
 
   /*--- brief param is a map from the option name (config file string) to its decoder (the specific child
-   class of COptionBase that turns the string into a value) ---*/
+   class of COptionBase that turns the string into a value). A hash map is used since the only ordered
+   traversal of the options (the suggestion for a misspelled name) does not depend on the order. ---*/
 
-  map<string, COptionBase*> option_map;
+  unordered_map<string, COptionBase*> option_map;
 
 
   // All of the addXxxOptions take in the name of the option, and a refernce to the field of that option
@@ -1538,6 +1600,12 @@ public:
    */
   bool GetCFL_Adapt(void) const { return CFL_Adapt; }
 
+  /*!
+   * \brief Get the value of the local CFL adaption flag.
+   * \return <code>TRUE</code> if the CFL of each point evolves from its own convergence state; otherwise <code>FALSE</code>.
+   */
+  bool GetCFL_Adapt_Local(void) const { return CFL_Adapt_Local; }
+
   /*!
    * \brief Get the values of the CFL adapation.
    * \return Value of CFL adapation
@@ -1717,6 +1785,12 @@ public:
    */
   su2double GetwallModel_B() const { return wallModel_B; }
 
+  /*!
+   * \brief Get the convergence tolerance for the iterative LES wall models.
+   * \return Wall model convergence tolerance.
+   */
+  su2double GetwallModel_Tol() const { return wallModel_Tol; }
+
   /*!
    * \brief Get the value of the thermal diffusivity for solids.
    * \return Thermal conductivity (solid).
@@ -1960,6 +2034,18 @@ public:
    */
   unsigned short GetnStartUpIter(void) const { return nStartUpIter; }
 
+  /*!
+   * \brief Get the residual drop (orders of magnitude) that advances the full multigrid start-up to a finer level.
+   * \return Required residual orders of magnitude.
+   */
+  su2double GetFullMG_ResOrderDrop(void) const { return FullMG_ResOrderDrop; }
+
+  /*!
+   * \brief Get the maximum number of iterations spent on a full multigrid start-up level.
+   * \return Maximum iterations per start-up level.
+   */
+  unsigned long GetFullMG_MaxLevelIter(void) const { return FullMG_MaxLevelIter; }
+
   /*!
    * \brief Get the reference area for non dimensional coefficient computation. If the value from the
    *        is 0 then, the code will compute the reference area using the projection of the shape into
@@ -2264,6 +2350,19 @@ public:
    */
   unsigned long GetLimiterIter(void) const { return LimiterIter; }
 
+  /*!
+   * \brief Relative solution change above which the limiter of a stencil is recomputed,
+   *        0 disables the incremental mode (i.e. always recompute everywhere).
+   * \return Value of the threshold.
+   */
+  su2double GetLimiterRecomputeThreshold(void) const { return LimiterRecomputeThreshold; }
+
+  /*!
+   * \brief Number of iterations between full limiter recomputations in incremental mode.
+   * \return Number of iterations.
+   */
+  unsigned long GetLimiterRefreshPeriod(void) const { return LimiterRefreshPeriod; }
+
   /*!
    * \brief Get the value of sharp edge limiter.
    * \return Value of the sharp edge limiter coefficient.
@@ -2576,6 +2675,18 @@ public:
    */
   su2double GetAoA(void) const { return AoA; }
 
+  /*!
+   * \brief Get the number of angles of attack of the continuation sweep.
+   */
+  unsigned short GetnAoA_Sweep(void) const { return nAoA_Sweep; }
+
+  /*!
+   * \brief Get an angle of attack of the continuation sweep.
+   * \param[in] val_index - Index of the sweep angle.
+   * \return Value of the angle of attack (degrees).
+   */
+  su2double GetAoA_Sweep(unsigned short val_index) const { return AoA_Sweep[val_index]; }
+
   /*!
    * \brief Get the off set angle of attack of the body. The solution and the geometry
    *        file are able to modifity the angle of attack in the config file
@@ -2697,6 +2808,12 @@ public:
    */
   bool GetReorientElements(void) const { return ReorientElements; }
 
+  /*!
+   * \brief Get the type of point renumbering applied to the partitioned grid.
+   * \return Type of point reordering.
+   */
+  POINT_REORDERING GetKind_Point_Reordering(void) const { return Kind_Point_Reordering; }
+
   /*!
    * \brief Get the Courant Friedrich Levi number for unsteady simulations.
    * \return CFL number for unsteady simulations.
@@ -2789,6 +2906,18 @@ public:
    */
   unsigned short GetnRKStep(void) const { return nRKStep; }
 
+  /*!
+   * \brief Get the number of Jacobi sweeps of residual smoothing for the explicit schemes.
+   * \return Number of smoothing sweeps (0 means no smoothing).
+   */
+  unsigned short GetResidual_Smoothing_Sweeps(void) const { return Residual_Smoothing_Sweeps; }
+
+  /*!
+   * \brief Get the coefficient of the residual smoothing for the explicit schemes.
+   * \return Residual smoothing coefficient.
+   */
+  su2double GetResidual_Smoothing_Coeff(void) const { return Residual_Smoothing_Coeff; }
+
   /*!
    * \brief Get the number of time levels for time accurate local time stepping.
    * \return Number of time levels.
@@ -3072,6 +3201,18 @@ public:
    */
   bool GetWrt_Performance(void) const { return Wrt_Performance; }
 
+  /*!
+   * \brief Get information about writing the memory footprint report at the end of preprocessing.
+   * \return <code>TRUE</code> means that the memory footprint report will be written.
+   */
+  bool GetWrt_MemoryFootprint(void) const { return Wrt_MemoryFootprint; }
+
+  /*!
+   * \brief Get information about writing the binary volume files asynchronously.
+   * \return <code>TRUE</code> means that a background thread performs the writes.
+   */
+  bool GetWrt_Async(void) const { return Wrt_Async; }
+
   /*!
    * \brief Get information about the computational graph (e.g. memory usage) when using AD in reverse mode.
    * \return <code>TRUE</code> means that the tape statistics will be written after each recording.
@@ -3379,6 +3520,20 @@ public:
    */
   unsigned short GetMarker_All_Monitoring(unsigned short val_marker) const { return Marker_All_Monitoring[val_marker]; }
 
+  /*!
+   * \brief Map the markers of this rank to their position in the list of monitored markers.
+   * \return Vector of size nMarker_All, entries hold the monitoring index of the
+   * marker, or nMarker_Monitoring for markers that are not monitored.
+   */
+  vector<unsigned short> GetMarker_All_to_Monitoring(void) const;
+
+  /*!
+   * \brief Map the markers of this rank to their position in the list of analyzed markers.
+   * \return Vector of size nMarker_All, entries hold the analyze index of the
+   * marker, or nMarker_Analyze for markers that are not analyzed.
+   */
+  vector<unsigned short> GetMarker_All_to_Analyze(void) const;
+
   /*!
    * \brief Get the monitoring information for a marker <i>val_marker</i>.
    * \param[in] val_marker - 0 or 1 depending if the the marker is going to be monitored.
@@ -3741,6 +3896,26 @@ public:
    */
   su2double GetAcentric_Factor(void) const { return Acentric_Factor; }
 
+  /*!
+   * \brief Flag for evaluating the fluid model through a table sampled at startup.
+   */
+  bool GetTabulated_FluidModel(void) const { return Tabulated_FluidModel; }
+
+  /*!
+   * \brief Get the number of table nodes per direction of the tabulated fluid model.
+   */
+  unsigned short GetnTabulated_Points(void) const { return nTabulated_Points; }
+
+  /*!
+   * \brief Get the density range (min, max) covered by the tabulated fluid model.
+   */
+  const su2double* GetTabulated_Rho_Limits(void) const { return Tabulated_Rho_Limits; }
+
+  /*!
+   * \brief Get the static energy range (min, max) covered by the tabulated fluid model.
+   */
+  const su2double* GetTabulated_Energy_Limits(void) const { return Tabulated_Energy_Limits; }
+
   /*!
    * \brief Get the value of the viscosity model.
    * \return Viscosity model.
@@ -4005,6 +4180,24 @@ public:
    */
   unsigned long GetDeform_Linear_Solver_Iter(void) const { return Deform_Linear_Solver_Iter; }
 
+  /*!
+   * \brief Get the number of iterative refinement sweeps wrapped around a mixed precision linear solve.
+   * \return Number of refinement sweeps (0 disables refinement).
+   */
+  unsigned short GetLinear_Solver_Refine_Iter(void) const { return Linear_Solver_Refine_Iter; }
+
+  /*!
+   * \brief Get the number of iterative refinement sweeps for the mesh deformation linear solve.
+   * \return Number of refinement sweeps (0 disables refinement).
+   */
+  unsigned short GetDeform_Linear_Solver_Refine_Iter(void) const { return Deform_Linear_Solver_Refine_Iter; }
+
+  /*!
+   * \brief Get whether the mesh deformation stiffness operator is applied element-wise (matrix-free).
+   * \return <code>TRUE</code> if the stiffness matrix is not assembled; otherwise <code>FALSE</code>.
+   */
+  bool GetDeform_MatrixFree(void) const { return Deform_MatrixFree; }
+
   /*!
    * \brief Get the ILU fill-in level for the linear solver.
    * \return Fill in level of the ILU preconditioner for the linear solver.
@@ -4052,7 +4245,27 @@ public:
   /*!
    * \brief Get Newton-Krylov integer parameters.
    */
-  array<unsigned short,3> GetNewtonKrylovIntParam(void) const { return NK_IntParam; }
+  array<unsigned short,4> GetNewtonKrylovIntParam(void) const { return NK_IntParam; }
+
+  /*!
+   * \brief Get the number of implicit iterations the Jacobian of a solver is kept before re-assembly.
+   */
+  unsigned short GetJacobianFreezePeriod(void) const { return Jacobian_Freeze_Period; }
+
+  /*!
+   * \brief Get whether edge computations are skipped inside converged regions of steady runs.
+   */
+  bool GetRegion_Freezing(void) const { return Region_Freezing; }
+
+  /*!
+   * \brief Get the residual magnitude below which a point counts as converged for region freezing.
+   */
+  su2double GetRegion_Freezing_Tol(void) const { return Region_Freezing_Tol; }
+
+  /*!
+   * \brief Get the number of iterations between full thaws of the frozen regions.
+   */
+  unsigned long GetRegion_Freezing_Interval(void) const { return Region_Freezing_Interval; }
 
   /*!
    * \brief Get Newton-Krylov floating-point parameters.
@@ -4700,6 +4913,13 @@ public:
    */
   bool GetFrozen_Limiter_Disc(void) const { return Frozen_Limiter_Disc; }
 
+  /*!
+   * \brief Wall distance within which the discrete adjoint recording keeps full
+   *        second-order numerics, farther edges drop to first order.
+   * \return The radius, 0 keeps full fidelity everywhere.
+   */
+  su2double GetAdjFidelity_Radius(void) const { return AdjFidelityRadius; }
+
   /*!
    * \brief Provides information about if the sharp edges are going to be removed from the sensitivity.
    * \return <code>FALSE</code> means that the sharp edges will be removed from the sensitivity.
@@ -4736,6 +4956,30 @@ public:
    */
   su2double GetInlet_Profile_Matching_Tolerance(void) const { return Inlet_Matching_Tol; }
 
+  /*!
+   * \brief Get the turbulence intensity of the synthetic eddy inflow (0 disables it).
+   * \return Intensity of the synthetic fluctuations relative to the inlet velocity.
+   */
+  su2double GetInlet_SEM_Intensity(void) const { return SEM_Intensity; }
+
+  /*!
+   * \brief Get the eddy length scale of the synthetic eddy inflow.
+   * \return Length scale of the synthetic eddies (mesh units).
+   */
+  su2double GetInlet_SEM_LengthScale(void) const { return SEM_LengthScale; }
+
+  /*!
+   * \brief Get the number of synthetic eddies per inlet marker.
+   * \return Number of eddies of the synthetic eddy inflow.
+   */
+  unsigned long GetInlet_SEM_nEddy(void) const { return SEM_nEddy; }
+
+  /*!
+   * \brief Get the random seed of the synthetic eddy inflow.
+   * \return Seed used to generate the eddy population, fixed for reproducibility.
+   */
+  unsigned long GetInlet_SEM_Seed(void) const { return SEM_Seed; }
+
   /*!
    * \brief Get the type of incompressible inlet from the list.
    * \return Kind of the incompressible inlet.
@@ -5065,6 +5309,12 @@ public:
    */
   unsigned short GetKind_ObjFunc(unsigned short val_obj = 0) const { return Kind_ObjFunc[val_obj]; }
 
+  /*!
+   * \brief Check if the objectives are replayed from the restart solution, without solving.
+   * \return True if the run only re-evaluates the objective function(s).
+   */
+  bool GetObjective_Replay(void) const { return Objective_Replay; }
+
   /*!
    * \author H. Kline
    * \brief Get the weight of objective function. There are several options: Drag coefficient,
@@ -5130,12 +5380,36 @@ public:
    */
   bool GetRestart(void) const { return Restart; }
 
+  /*!
+   * \brief Set the restart information, e.g. to reload a solution after mesh adaptation.
+   * \param[in] val_restart - If <code>TRUE</code> the code will use the solution as restart.
+   */
+  void SetRestart(bool val_restart) { Restart = val_restart; }
+
   /*!
    * \brief Flag for whether binary SU2 native restart files are read.
    * \return Flag for whether binary SU2 native restart files are read, if <code>TRUE</code> then the code will load binary restart files.
    */
   bool GetRead_Binary_Restart(void) const { return Read_Binary_Restart; }
 
+  /*!
+   * \brief Flag for whether the data of binary SU2 native restart files is written in single precision.
+   * \return Flag for single precision restart data, halves the file size and write volume.
+   */
+  bool GetWrt_Restart_Single(void) const { return Wrt_Restart_Single; }
+
+  /*!
+   * \brief Flag for whether binary SU2 native restart files are delta-encoded between keyframes.
+   * \return Flag for delta-encoded restart files.
+   */
+  bool GetWrt_Restart_Delta(void) const { return Wrt_Restart_Delta; }
+
+  /*!
+   * \brief Number of restart writes after which WRT_RESTART_DELTA writes a new full restart.
+   * \return The keyframe interval.
+   */
+  unsigned short GetRestart_Keyframe_Interval(void) const { return Restart_Keyframe_Interval; }
+
   /*!
    * \brief Provides the number of varaibles.
    * \return Number of variables.
@@ -5206,6 +5480,12 @@ public:
    */
   string GetMesh_FileName(void) const { return Mesh_FileName; }
 
+  /*!
+   * \brief Set the name of the input grid, e.g. to hand over an adapted mesh.
+   * \param[in] val_filename - File name of the input grid.
+   */
+  void SetMesh_FileName(const string& val_filename) { Mesh_FileName = val_filename; }
+
   /*!
    * \brief Get name of the output grid, this parameter is important for grid
    *        adaptation and deformation.
@@ -5219,6 +5499,12 @@ public:
    */
   string GetSolution_FileName(void) const { return Solution_FileName; }
 
+  /*!
+   * \brief Set the name of the file with the solution of the flow problem.
+   * \param[in] val_filename - Name of the file with the solution.
+   */
+  void SetSolution_FileName(const string& val_filename) { Solution_FileName = val_filename; }
+
   /*!
    * \brief Get the name of the file with the solution of the adjoint flow problem
    *          with drag objective function.
@@ -5805,6 +6091,24 @@ public:
    */
   const su2double* GetBody_Force_Vector(void) const { return body_force; }
 
+  /*!
+   * \brief Get information about the sponge layer source term.
+   * \return <code>TRUE</code> if a sponge layer is used; otherwise <code>FALSE</code>.
+   */
+  bool GetSponge_Layer(void) const { return Sponge_Layer; }
+
+  /*!
+   * \brief Get a pointer to the bounding box of the sponge layer support (Xmin, Ymin, Zmin, Xmax, Ymax, Zmax).
+   * \return A pointer to the sponge layer bounding box.
+   */
+  const su2double* GetSponge_Layer_Box(void) const { return sponge_layer_box; }
+
+  /*!
+   * \brief Get the damping coefficient of the sponge layer source term.
+   * \return Sponge layer damping coefficient.
+   */
+  su2double GetSponge_Layer_Coeff(void) const { return Sponge_Layer_Coeff; }
+
   /*!
    * \brief Get information about the streamwise periodicity (None, Pressure_Drop, Massflow).
    * \return Driving force identification.
@@ -8686,6 +8990,18 @@ public:
    */
   bool GetMultizone_Problem(void) const { return Multizone_Problem; }
 
+  /*!
+   * \brief Get whether converged zones may be skipped by the outer multizone iteration.
+   * \return <code>TRUE</code> if converged zones with frozen donor zones are not re-solved.
+   */
+  bool GetMultizone_Freeze_Converged(void) const { return Multizone_Freeze_Converged; }
+
+  /*!
+   * \brief Get whether the inner-iteration budget of each zone is adapted between outer iterations.
+   * \return <code>TRUE</code> if the budget follows the contraction of the coupling residuals.
+   */
+  bool GetMultizone_Adapt_InnerIter(void) const { return Multizone_Adapt_InnerIter; }
+
   /*!
    * \brief Get the ID for the FEA region that we want to compute the gradient for using direct differentiation
    * \return ID
@@ -8805,6 +9121,11 @@ public:
    */
   su2double GetRadialBasisFunctionPruneTol(void) const { return RadialBasisFunction_PruneTol; }
 
+  /*!
+   * \brief Get the maximum donor cluster size for partition-of-unity RBF interpolation (0 for the dense approach).
+   */
+  unsigned long GetRadialBasisFunctionMaxClusterSize(void) const { return RadialBasisFunction_MaxClusterSize; }
+
   /*!
    * \brief Get the number of donor points to use in Nearest Neighbor interpolation.
    */
@@ -9019,6 +9340,12 @@ public:
    */
   unsigned long GetnInner_Iter(void) const { return nInnerIter; }
 
+  /*!
+   * \brief Set the number of inner iterations, e.g. to adapt the budget between outer iterations.
+   * \param[in] val_iter - Number of inner iterations on each multizone block
+   */
+  void SetnInner_Iter(unsigned long val_iter) { nInnerIter = val_iter; }
+
   /*!
    * \brief Get the number of outer iterations
    * \return Number of outer iterations for the multizone problem
@@ -9067,6 +9394,18 @@ public:
    */
   unsigned short GetComm_Level(void) const { return Comm_Level; }
 
+  /*!
+   * \brief Check if precision-tolerant halo quantities are exchanged in single precision.
+   * \return YES if eligible point-to-point exchanges use single precision buffers.
+   */
+  bool GetComm_SinglePrecision(void) const { return Comm_SinglePrecision; }
+
+  /*!
+   * \brief Get the number of iterations between exact residual norms.
+   * \return Interval at which exact norms are computed, 1 disables sampling.
+   */
+  unsigned long GetResidual_Sampling_Interval(void) const { return Residual_Sampling_Interval; }
+
   /*!
    * \brief Check if the mesh read supports multiple zones.
    * \return YES if multiple zones can be contained in the mesh file.
@@ -9207,6 +9546,32 @@ public:
   */
   string GetConv_Field(unsigned short iField) const { return ConvField[iField]; }
 
+  /*!
+  * \brief Get the per-field convergence tolerance, paired with the convergence fields
+  * \param[in] iField - Index of the field
+  * return Tolerance applied to this convergence field instead of the global epsilon
+  */
+  su2double GetConv_Field_Eps(unsigned short iField) const { return ConvFieldEps[iField]; }
+
+  /*!
+  * \brief Get the number of per-field convergence tolerances (zero if only the global epsilon is used).
+  * return Number of per-field convergence tolerances.
+  */
+  unsigned short GetnConv_Field_Eps() const { return nConvFieldEps; }
+
+  /*!
+   * \brief Get the relative standard deviation below which an oscillating coefficient counts as converged.
+   * \return Value of the variance based convergence criteria (zero disables it).
+   */
+  su2double GetCauchy_Variance_Eps(void) const { return Cauchy_Variance_Eps; }
+
+  /*!
+   * \brief Get the mean residual slope (orders per iteration over the Cauchy window) below which
+   *        a residual counts as stalled and therefore converged.
+   * \return Value of the slope based convergence criteria (zero disables it).
+   */
+  su2double GetResidual_Slope_Eps(void) const { return Residual_Slope_Eps; }
+
   /*!
    * \brief Get functional that is going to be used to evaluate the convergence of the windowed time average of the unsteady problem.
    * \param[in] iField - Index of the field
@@ -9301,6 +9666,31 @@ public:
    */
   const unsigned short* GetVolumeOutputFiles() const { return VolumeOutputFiles; }
 
+  /*!
+   * \brief Get the number of cases of an ensemble run.
+   */
+  unsigned short GetnEnsembleCases() const { return nEnsembleCases; }
+
+  /*!
+   * \brief Get the config file of one case of an ensemble run.
+   */
+  string GetEnsembleCase(unsigned short val_index) const { return EnsembleCases[val_index]; }
+
+  /*!
+   * \brief Get the number of coordinate components defining the point probes.
+   */
+  unsigned short GetnProbeCoord() const { return nProbeCoord; }
+
+  /*!
+   * \brief Get a coordinate component of a point probe.
+   */
+  su2double GetProbeCoord(unsigned short val_index) const { return ProbeCoord[val_index]; }
+
+  /*!
+   * \brief Get the number of sampled steps buffered between probe flushes.
+   */
+  unsigned long GetProbe_Wrt_Freq() const { return ProbeWrtFreq; }
+
   /*!
    * \brief GetnVolumeOutputFiles
    */
@@ -9324,6 +9714,13 @@ public:
    */
   unsigned short GetPastixFillLvl(void) const { return pastix_fill_lvl; }
 
+  /*!
+   * \brief Get the number of global degrees of freedom above which a PaStiX direct
+   *        solve falls back to FGMRES (0 disables the fallback).
+   * \return Maximum system size for the direct solver.
+   */
+  unsigned long GetPastixMaxDOF(void) const { return pastix_max_dof; }
+
   /*!
    * \brief Check if an option is present in the config file
    * \param[in] - Name of the option
@@ -9343,11 +9740,51 @@ public:
    */
   unsigned long GetLinear_Solver_Prec_Threads(void) const { return Linear_Solver_Prec_Threads; }
 
+  /*!
+   * \brief Decide whether the sparse matrix-vector products and the Jacobi
+   *        preconditioner run on CUDA devices (requires -Denable-cuda=true).
+   * \return <code>TRUE</code> means that the linear solver hot path is offloaded.
+   */
+  bool GetCUDA(void) const { return Enable_Cuda; }
+
+  /*!
+   * \brief Decide whether to store and apply the ILU-type preconditioners in single precision.
+   * \return <code>TRUE</code> means that the preconditioner factor is kept in FP32.
+   */
+  bool GetLinear_Solver_Prec_Single(void) const { return Linear_Solver_Prec_Single; }
+
+  /*!
+   * \brief Decide whether the linear solvers start from the (scaled) solution of the previous solve.
+   * \return <code>TRUE</code> means that the previous solution is used as initial guess.
+   */
+  bool GetLinear_Solver_Warm_Start(void) const { return Linear_Solver_Warm_Start; }
+
+  /*!
+   * \brief Get the scaling applied to the retained solution when warm starting the linear solvers.
+   * \return Scale factor for the warm-start initial guess.
+   */
+  su2double GetLinear_Solver_Warm_Start_Scale(void) const { return Linear_Solver_Warm_Start_Scale; }
+
   /*!
    * \brief Get the size of the edge groups colored for OpenMP parallelization of edge loops.
    */
   unsigned long GetEdgeColoringGroupSize(void) const { return edgeColorGroupSize; }
 
+  /*!
+   * \brief Check if the edge-coloring group size should be selected automatically at preprocessing.
+   */
+  bool GetEdgeColoringAutoTune(void) const { return edgeColorAutoTune; }
+
+  /*!
+   * \brief Check if the edge-based reducer strategy should be used for Green-Gauss gradients.
+   */
+  bool GetGradient_ReducerStrategy(void) const { return Gradient_ReducerStrategy; }
+
+  /*!
+   * \brief Check if the thread work ranges of hot point loops should be adjusted based on measured times.
+   */
+  bool GetCost_Guided_Schedule(void) const { return Cost_Guided_Schedule; }
+
   /*!
    * \brief Get the ParMETIS load balancing tolerance.
    */
@@ -9363,6 +9800,16 @@ public:
    */
   long GetParMETIS_EdgeWeight() const { return ParMETIS_edgeWgt; }
 
+  /*!
+   * \brief Get the extra ParMETIS load balancing weight for solid wall points.
+   */
+  long GetParMETIS_WallWeight() const { return ParMETIS_wallWgt; }
+
+  /*!
+   * \brief Get whether the mesh partitioning should be cached on disk and reused.
+   */
+  bool GetPartition_Cache() const { return PartitionCache; }
+
   /*!
    * \brief Find the marker index (if any) that is part of a given interface pair.
    * \param[in] iInterface - Number of the interface pair being tested, starting at 0.
@@ -121,15 +121,21 @@ public:
    * \param[out] markerID Local marker ID of the nearest element in the ADT.
    * \param[out] elemID   Local element ID of the nearest element in the ADT.
    * \param[out] rankID   Rank on which the nearest element in the ADT is stored.
+   * \param[in]  distUpperBound Optional upper bound for the distance (negative to disable).
+   *                            Must be a true upper bound (e.g. the distance to some element
+   *                            of the ADT), otherwise the result is undefined. A tight bound
+   *                            allows large parts of the tree traversal to be pruned.
    */
   inline void DetermineNearestElement(const su2double *coor,
                                       su2double       &dist,
                                       unsigned short  &markerID,
                                       unsigned long   &elemID,
-                                      int             &rankID) {
+                                      int             &rankID,
+                                      su2double       distUpperBound = -1.0) {
     const auto iThread = omp_get_thread_num();
     DetermineNearestElement_impl(BBoxTargets[iThread], FrontLeaves[iThread],
-              FrontLeavesNew[iThread], coor, dist, markerID, elemID, rankID);
+              FrontLeavesNew[iThread], coor, dist, markerID, elemID, rankID,
+              distUpperBound);
   }
 
 private:
@@ -157,7 +163,8 @@ private:
                                     su2double       &dist,
                                     unsigned short  &markerID,
                                     unsigned long   &elemID,
-                                    int             &rankID) const;
+                                    int             &rankID,
+                                    su2double       distUpperBound) const;
 
   /*!
    * \brief Function, which checks whether or not the given coordinate is
@@ -41,6 +41,8 @@ private:
                                                    of the points in the ADT. */
   vector<int>           ranksOfPoints; /*!< \brief Vector, which contains the ranks
                                                    of the points in the ADT. */
+  vector<unsigned long> PrevResultIndex; /*!< \brief Index of the result of the previous query of
+                                                     each thread, used to warm-start the next one. */
 public:
   /*!
    * \brief Constructor of the class.
@@ -65,6 +67,9 @@ public:
    * \param[out] dist    Distance to the nearest node in the ADT.
    * \param[out] pointID Local point ID of the nearest node in the ADT.
    * \param[out] rankID  Rank on which the nearest node in the ADT is stored.
+   * \note Each thread uses the result of its previous query as the initial candidate,
+   *       which makes batches of queries with spatial locality (e.g. loops over
+   *       renumbered grid points) much cheaper, as most of the traversal is pruned.
    */
   inline void DetermineNearestNode(const su2double *coor,
                                    su2double       &dist,
@@ -72,7 +77,7 @@ public:
                                    int             &rankID) {
     const auto iThread = omp_get_thread_num();
     DetermineNearestNode_impl(FrontLeaves[iThread], FrontLeavesNew[iThread],
-                              coor, dist, pointID, rankID);
+                              PrevResultIndex[iThread], coor, dist, pointID, rankID);
   }
 
   /*!
@@ -83,10 +88,11 @@ public:
 private:
   /*!
    * \brief Implementation of DetermineNearestNode.
-   * \note Working variables (first two) passed explicitly for thread safety.
+   * \note Working variables (first three) passed explicitly for thread safety.
    */
   void DetermineNearestNode_impl(vector<unsigned long>& frontLeaves,
                                  vector<unsigned long>& frontLeavesNew,
+                                 unsigned long   &prevResultIndex,
                                  const su2double *coor,
                                  su2double       &dist,
                                  unsigned long   &pointID,
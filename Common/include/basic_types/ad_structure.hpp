@@ -61,6 +61,11 @@ namespace AD{
    */
   inline void PrintStatistics() {}
 
+  /*!
+   * \brief Returns the memory currently used by the tape (in MB).
+   */
+  inline su2double TapeMemoryUsed() { return 0.0; }
+
   /*!
    * \brief Registers the variable as an input and saves internal data (indices). I.e. as a leaf of the computational graph.
    * \param[in] data - The variable to be registered as input.
@@ -335,6 +340,8 @@ namespace AD{
 
   FORCEINLINE void PrintStatistics() {AD::getGlobalTape().printStatistics();}
 
+  FORCEINLINE su2double TapeMemoryUsed() {return AD::getGlobalTape().getTapeValues().getUsedMemorySize();}
+
   FORCEINLINE void ClearAdjoints() {AD::getGlobalTape().clearAdjoints(); }
 
   FORCEINLINE void ComputeAdjoint() {
@@ -83,9 +83,57 @@ namespace SU2_TYPE {
    */
   void SetDerivative(su2double &data, const passivedouble &val);
 
+  /*!
+   * \brief Number of derivative directions carried by su2double, larger than 1
+   * only for vector forward mode (see CODI_FORWARD_SIZE in code_config.hpp).
+   */
+#if defined(CODI_FORWARD_TYPE) && (CODI_FORWARD_SIZE > 1)
+  constexpr int DerivativeDirections = CODI_FORWARD_SIZE;
+#else
+  constexpr int DerivativeDirections = 1;
+#endif
+
+  /*!
+   * \brief Set the derivative value of one direction of the datatype, only vector
+   * forward mode has more than one direction, other builds honor direction 0.
+   * \param[in] data - The non-primitive datatype.
+   * \param[in] iDir - The derivative direction.
+   * \param[in] val - The value of the derivative.
+   */
+  void SetDerivative(su2double &data, int iDir, const passivedouble &val);
+
+  /*!
+   * \brief Get the derivative value of one direction of the datatype.
+   * \param[in] data - The non-primitive datatype.
+   * \param[in] iDir - The derivative direction.
+   * \return The derivative value.
+   */
+  passivedouble GetDerivative(const su2double &data, int iDir);
+
   /*--- Implementation of the above for the different types. ---*/
 
-#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+#if defined(CODI_FORWARD_TYPE) && (CODI_FORWARD_SIZE > 1) // vector forward mode AD
+
+  FORCEINLINE void SetValue(su2double& data, const passivedouble &val) {data.setValue(val);}
+
+  FORCEINLINE passivedouble GetValue(const su2double& data) {return data.getValue();}
+
+  /*--- The single-direction interface maps to direction 0 so that the scalar
+   * seeding and extraction sites keep working in vector mode. ---*/
+
+  FORCEINLINE void SetSecondary(su2double& data, const passivedouble &val) {data.gradient()[0] = val;}
+
+  FORCEINLINE void SetDerivative(su2double& data, const passivedouble &val) {data.gradient()[0] = val;}
+
+  FORCEINLINE passivedouble GetSecondary(const su2double& data) {return data.getGradient()[0];}
+
+  FORCEINLINE passivedouble GetDerivative(const su2double& data) {return data.getGradient()[0];}
+
+  FORCEINLINE void SetDerivative(su2double& data, int iDir, const passivedouble &val) {data.gradient()[iDir] = val;}
+
+  FORCEINLINE passivedouble GetDerivative(const su2double& data, int iDir) {return data.getGradient()[iDir];}
+
+#elif defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
 
   FORCEINLINE void SetValue(su2double& data, const passivedouble &val) {data.setValue(val);}
 
@@ -99,6 +147,10 @@ namespace SU2_TYPE {
 
   FORCEINLINE passivedouble GetDerivative(const su2double& data) {return data.getGradient();}
 
+  FORCEINLINE void SetDerivative(su2double& data, int iDir, const passivedouble &val) {if (iDir == 0) data.setGradient(val);}
+
+  FORCEINLINE passivedouble GetDerivative(const su2double& data, int iDir) {return (iDir == 0)? data.getGradient() : 0.0;}
+
 #else // passive type, no AD
 
   FORCEINLINE void SetValue(su2double& data, const passivedouble &val) {data = val;}
@@ -112,6 +164,10 @@ namespace SU2_TYPE {
   FORCEINLINE passivedouble GetSecondary(const su2double&) {return 0.0;}
 
   FORCEINLINE void SetDerivative(su2double &, const passivedouble &) {}
+
+  FORCEINLINE void SetDerivative(su2double &, int, const passivedouble &) {}
+
+  FORCEINLINE passivedouble GetDerivative(const su2double&, int) {return 0.0;}
 #endif
 
   /*!
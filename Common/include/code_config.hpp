@@ -104,7 +104,20 @@ using su2double = codi::RealReverse;
 #endif
 #elif defined(CODI_FORWARD_TYPE) // forward mode AD
 #include "codi.hpp"
+
+/*--- Number of derivative directions carried by the forward type, a value
+ * larger than 1 (set at configure time via -Ddirectdiff-size) selects the
+ * vector forward type so that one run differentiates w.r.t. several
+ * design variables at once. ---*/
+#ifndef CODI_FORWARD_SIZE
+#define CODI_FORWARD_SIZE 1
+#endif
+
+#if CODI_FORWARD_SIZE > 1
+using su2double = codi::RealForwardVec<CODI_FORWARD_SIZE>;
+#else
 using su2double = codi::RealForward;
+#endif
 
 #else // primal / direct / no AD
 using su2double = double;
@@ -78,7 +78,9 @@ protected:
    */
 #define DUMMY_ALLOCATOR \
   void m_allocate(size_t sz, Index_t rows, Index_t cols) noexcept {}\
-  void m_destroy() noexcept {}
+  void m_destroy() noexcept {}\
+  void m_setPolicy(MemoryAllocation::AllocPolicy) noexcept {}\
+  MemoryAllocation::AllocPolicy m_getPolicy() const noexcept {return MemoryAllocation::AllocPolicy::HOST;}
 
   /*!
    * Dynamic size specializations use this one, EXTRA is used to set some
@@ -93,9 +95,13 @@ protected:
   static_assert(MemoryAllocation::is_power_of_two(AlignSize),           \
                 "AlignSize is not a power of two.");                    \
                                                                         \
+  MemoryAllocation::AllocPolicy m_policy =                              \
+    MemoryAllocation::AllocPolicy::HOST;                                \
+                                                                        \
   void m_allocate(size_t sz, Index_t rows, Index_t cols) noexcept {     \
     EXTRA;                                                              \
-    m_data = MemoryAllocation::aligned_alloc<Scalar_t>(AlignSize,sz);   \
+    m_data = MemoryAllocation::policy_alloc<Scalar_t>(                  \
+               m_policy,AlignSize,sz);                                  \
     if (!std::is_trivial<Scalar_t>::value)                              \
       for (size_t i = 0; i < size(); ++i) new (m_data+i) Scalar_t();    \
   }                                                                     \
@@ -103,7 +109,15 @@ protected:
   void m_destroy() noexcept {                                           \
     if (!std::is_trivial<Scalar_t>::value)                              \
       for (size_t i = 0; i < size(); ++i) m_data[i].~Scalar_t();        \
-    MemoryAllocation::aligned_free<Scalar_t>(m_data);                   \
+    MemoryAllocation::policy_free<Scalar_t>(m_policy,m_data);           \
+  }                                                                     \
+                                                                        \
+  void m_setPolicy(MemoryAllocation::AllocPolicy policy) noexcept {     \
+    m_policy = policy;                                                  \
+  }                                                                     \
+                                                                        \
+  MemoryAllocation::AllocPolicy m_getPolicy() const noexcept {          \
+    return m_policy;                                                    \
   }
 
   DUMMY_ALLOCATOR
@@ -122,13 +136,15 @@ public:
                                                                         \
   AccessorImpl(AccessorImpl&& other) noexcept                           \
   {                                                                     \
-    MOVE; m_data=other.m_data; other.m_data=nullptr;                    \
+    MOVE; m_policy=other.m_policy;                                      \
+    m_data=other.m_data; other.m_data=nullptr;                          \
   }                                                                     \
                                                                         \
   AccessorImpl& operator= (AccessorImpl&& other) noexcept               \
   {                                                                     \
     m_destroy();                                                        \
-    MOVE; m_data=other.m_data; other.m_data=nullptr;                    \
+    MOVE; m_policy=other.m_policy;                                      \
+    m_data=other.m_data; other.m_data=nullptr;                          \
     return *this;                                                       \
   }                                                                     \
                                                                         \
@@ -394,6 +410,8 @@ private:
   using Base::m_data;
   using Base::m_allocate;
   using Base::m_destroy;
+  using Base::m_setPolicy;
+  using Base::m_getPolicy;
 public:
   using Base::size;
   using Base::rows;
@@ -561,6 +579,47 @@ public:
     return *this;
   }
 
+  /*!
+   * \brief Set the memory space of the container (see MemoryAllocation::AllocPolicy),
+   * so that its data can migrate to a device without changing the call sites that
+   * read or write it. Existing storage is re-allocated in the new space, contents
+   * are not preserved. No effect on containers with fully static size.
+   */
+  C2DContainer& setAllocPolicy(MemoryAllocation::AllocPolicy policy) noexcept
+  {
+    if (StaticSize != DynamicSize || policy == m_getPolicy()) return *this;
+    const Index_t r = rows(), c = cols();
+    m_destroy();
+    m_setPolicy(policy);
+    m_allocate(size_t(r)*c*sizeof(Scalar_t), r, c);
+    return *this;
+  }
+
+  /*!
+   * \brief Get the memory space of the container.
+   */
+  MemoryAllocation::AllocPolicy getAllocPolicy() const noexcept { return m_getPolicy(); }
+
+  /*!
+   * \brief Hint that the data is about to be accessed on the device, only
+   * meaningful for containers with managed allocation, no-op otherwise.
+   */
+  void prefetchToDevice() const noexcept
+  {
+    if (m_getPolicy() == MemoryAllocation::AllocPolicy::MANAGED)
+      MemoryAllocation::prefetch_to_device(m_data, size()*sizeof(Scalar_t));
+  }
+
+  /*!
+   * \brief Hint that the data is about to be accessed on the host, only
+   * meaningful for containers with managed allocation, no-op otherwise.
+   */
+  void prefetchToHost() const noexcept
+  {
+    if (m_getPolicy() == MemoryAllocation::AllocPolicy::MANAGED)
+      MemoryAllocation::prefetch_to_host(m_data, size()*sizeof(Scalar_t));
+  }
+
   /*!
    * \brief Set value of all entries to "value".
    */
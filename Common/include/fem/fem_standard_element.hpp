@@ -721,6 +721,14 @@ private:
                            unsigned short beta,
                            su2double      x);
 
+  /*!
+  * \brief Function, which determines the integration points for this standard element.
+           The rules are cached globally, keyed by the element type and the order that
+           must be integrated exactly, such that repeated standard elements do not
+           regenerate them.
+  */
+  void IntegrationPoints(void);
+
   /*!
   * \brief Function, which determines the integration points for a line
            such that polynomials of orderExact are integrated exactly.
@@ -866,6 +874,32 @@ public:
                       const vector<su2double> *rLocSolDOFs = nullptr,
                       const vector<su2double> *sLocSolDOFs = nullptr,
                       const vector<su2double> *tLocSolDOFs = nullptr);
+  /*!
+  * \brief Static function, which makes available a shared immutable standard element
+           from the global cache, creating it on first use. Elements with custom
+           locations of the solution DOFs cannot be cached and must be created with
+           the regular constructor. The cache is filled during the (serial)
+           preprocessing, hence no thread safety measures are taken.
+  * \param[in] val_VTK_Type   - Type of the element using the VTK convention.
+  * \param[in] val_nPoly      - Polynomial degree of the element.
+  * \param[in] val_constJac   - Whether or not the Jacobians are constant.
+  * \param[in] config         - Object, which contains the input parameters.
+  * \param[in] val_orderExact - Default argument. If specified, it contains the
+                                order of the polynomials that must be integrated
+                                exactly by the integration rule.
+  * \return Reference to the shared standard element corresponding to the arguments.
+  */
+  static const CFEMStandardElement& GetStandardElement(unsigned short val_VTK_Type,
+                                                       unsigned short val_nPoly,
+                                                       bool           val_constJac,
+                                                       CConfig        *config,
+                                                       unsigned short val_orderExact = 0);
+
+  /*!
+  * \brief Static function, which releases the memory of the global standard element cache.
+  */
+  static void ClearStandardElementCache(void);
+
   /*!
   * \brief Copy constructor.
   * \param[in] other - Object, whose data must be copied.
@@ -923,19 +957,19 @@ public:
   * \brief Function, which makes available the r-derivatives of the basis functions in the integration points.
   * \return  The pointer to data, which stores the r-derivatives of the basis functions.
   */
-  inline su2double* GetDrBasisFunctionsIntegration(void){return drLagBasisIntegration.data();}
+  inline const su2double* GetDrBasisFunctionsIntegration(void) const {return drLagBasisIntegration.data();}
 
   /*!
   * \brief Function, which makes available the s-derivatives of the basis functions in the integration points.
   * \return  The pointer to data, which stores the s-derivatives of the basis functions.
   */
-  inline su2double* GetDsBasisFunctionsIntegration(void){return dsLagBasisIntegration.data();}
+  inline const su2double* GetDsBasisFunctionsIntegration(void) const {return dsLagBasisIntegration.data();}
 
   /*!
   * \brief Function, which makes available the t-derivatives of the basis functions in the integration points.
   * \return  The pointer to data, which stores the t-derivatives of the basis functions.
   */
-  inline su2double* GetDtBasisFunctionsIntegration(void){return dtLagBasisIntegration.data();}
+  inline const su2double* GetDtBasisFunctionsIntegration(void) const {return dtLagBasisIntegration.data();}
 
   /*!
   * \brief Function, which makes available the matrix storage of the inverse of Vandermonde matrix of solution DOFs.
@@ -978,37 +1012,37 @@ public:
   * \brief Function, which makes available the connectivity of face 0.
   * \return  The pointer to data, which stores the connectivity of face 0.
   */
-  inline unsigned short *GetConnFace0(void) {return connFace0.data();}
+  inline const unsigned short *GetConnFace0(void) const {return connFace0.data();}
 
   /*!
   * \brief Function, which makes available the connectivity of face 1.
   * \return  The pointer to data, which stores the connectivity of face 1.
   */
-  inline unsigned short *GetConnFace1(void) {return connFace1.data();}
+  inline const unsigned short *GetConnFace1(void) const {return connFace1.data();}
 
   /*!
   * \brief Function, which makes available the connectivity of face 2.
   * \return  The pointer to data, which stores the connectivity of face 2.
   */
-  inline unsigned short *GetConnFace2(void) {return connFace2.data();}
+  inline const unsigned short *GetConnFace2(void) const {return connFace2.data();}
 
   /*!
   * \brief Function, which makes available the connectivity of face 3.
   * \return  The pointer to data, which stores the connectivity of face 3.
   */
-  inline unsigned short *GetConnFace3(void) {return connFace3.data();}
+  inline const unsigned short *GetConnFace3(void) const {return connFace3.data();}
 
   /*!
   * \brief Function, which makes available the connectivity of face 4.
   * \return  The pointer to data, which stores the connectivity of face 4.
   */
-  inline unsigned short *GetConnFace4(void) {return connFace4.data();}
+  inline const unsigned short *GetConnFace4(void) const {return connFace4.data();}
 
   /*!
   * \brief Function, which makes available the connectivity of face 5.
   * \return  The pointer to data, which stores the connectivity of face 5.
   */
-  inline unsigned short *GetConnFace5(void) {return connFace5.data();}
+  inline const unsigned short *GetConnFace5(void) const {return connFace5.data();}
 
   /*!
   * \brief Function, which makes available the number of DOFs for this standard element.
@@ -1094,14 +1128,14 @@ public:
   */
   bool SameStandardElement(unsigned short val_VTK_Type,
                            unsigned short val_nPoly,
-                           bool           val_constJac);
+                           bool           val_constJac) const;
 
   /*!
   * \brief Function, which estimates the amount of work for an element of this
            type. This information is used to determine a well balanced partition.
   * \param[in] config - Object, which contains the input parameters.
   */
-  su2double WorkEstimateMetis(CConfig *config);
+  su2double WorkEstimateMetis(CConfig *config) const;
 
 private:
   /*!
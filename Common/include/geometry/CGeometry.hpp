@@ -52,7 +52,6 @@ extern "C" {
 #include <unordered_map>
 
 #include "primal_grid/CPrimalGrid.hpp"
-#include "dual_grid/CDualGrid.hpp"
 #include "dual_grid/CPoint.hpp"
 #include "dual_grid/CEdge.hpp"
 #include "dual_grid/CVertex.hpp"
@@ -135,6 +134,19 @@ protected:
 
   vector<su2double> XCoordList;	          /*!< \brief Vector containing points appearing on a single plane */
 
+  /*--- Cached candidate boundary elements of the plane cuts, so that repeated
+   section extractions only visit the elements that intersect each plane
+   instead of scanning the whole boundary (see ComputeAirfoil_Section). ---*/
+
+  struct CSectionCandidates {
+    su2double Plane_P0[3] = {0.0,0.0,0.0};     /*!< \brief Point of the cutting plane. */
+    su2double Plane_Normal[3] = {0.0,0.0,0.0}; /*!< \brief Normal of the cutting plane. */
+    su2double BBox[6] = {0.0,0.0,0.0,0.0,0.0,0.0}; /*!< \brief Coordinate limits of the extraction. */
+    bool original_surface = true; /*!< \brief Whether the cut was done on the undeformed surface. */
+    vector<pair<unsigned short, unsigned long> > elems; /*!< \brief (marker, element) pairs crossing the plane. */
+  };
+  vector<CSectionCandidates> sectionCandidates; /*!< \brief One entry per cutting plane seen so far. */
+
 #if defined(HAVE_MPI) && defined(HAVE_PARMETIS)
   vector<vector<unsigned long> > adj_nodes; /*!< \brief Vector of vectors holding each node's adjacency during preparation for ParMETIS. */
   vector<idx_t> adjacency; /*!< \brief Local adjacency array to be input into ParMETIS for partitioning (idx_t is a ParMETIS type defined in their headers). */
@@ -176,16 +188,27 @@ protected:
 
   CEdgeToNonZeroMapUL edgeToCSRMap;      /*!< \brief Map edges to CSR entries referenced by them (i,j) and (j,i). */
 
+  /*--- Explicit CSR form of the multigrid transfer operator (built for coarse MG levels). ---*/
+
+  CCompressedSparsePatternUL
+  mgTransferPattern;                     /*!< \brief Coarse-to-fine parent-child relation of the agglomeration. */
+  su2activevector mgRestrictionWeight;   /*!< \brief Volume ratio of each entry, i.e. the restriction weights. */
+
   /*--- Edge and element colorings. ---*/
 
   CCompressedSparsePatternUL
   edgeColoring,                          /*!< \brief Edge coloring structure for thread-based parallelization. */
   elemColoring;                          /*!< \brief Element coloring structure for thread-based parallelization. */
   unsigned long edgeColorGroupSize{1};   /*!< \brief Size of the edge groups within each color. */
+  bool edgeColorAutoTune{false};         /*!< \brief Select the edge color group size automatically before coloring. */
+  bool edgeColorPackSIMD{false};         /*!< \brief Make SIMD-width packets of consecutive edges conflict-free when renumbering. */
   unsigned long elemColorGroupSize{1};   /*!< \brief Size of the element groups within each color. */
 
   ColMajorMatrix<uint8_t> CoarseGridColor_;  /*!< \brief Coarse grid levels, colorized. */
 
+  vector<unsigned long> SFCOrder;        /*!< \brief Hilbert-sorted iteration order of the owned points, used to improve
+                                                     the locality of point loops without renumbering the mesh. */
+
 public:
   /*--- Main geometric elements of the grid. ---*/
 
@@ -194,6 +217,8 @@ public:
   CPoint* nodes{nullptr};                /*!< \brief Node vector (dual grid information). */
   CEdge* edges{nullptr};                 /*!< \brief Edge vector (dual grid information). */
   CVertex*** vertex{nullptr};            /*!< \brief Boundary Vertex vector (dual grid information). */
+  vector<vector<CVertex> > vertexPool;   /*!< \brief Contiguous per-marker storage of the vertices, the pointers
+                                                     in "vertex" index into it so that boundary loops stream. */
   CTurboVertex**** turbovertex{nullptr}; /*!< \brief Boundary Vertex vector ordered for turbomachinery calculation(dual grid information). */
   unsigned long *nVertex{nullptr};       /*!< \brief Number of vertex for each marker. */
   unsigned long *nElem_Bound{nullptr};   /*!< \brief Number of elements of the boundary. */
@@ -226,8 +251,20 @@ public:
   su2double *bufD_P2PSend{nullptr};       /*!< \brief Data structure for su2double point-to-point send. */
   unsigned short *bufS_P2PRecv{nullptr};  /*!< \brief Data structure for unsigned long point-to-point receive. */
   unsigned short *bufS_P2PSend{nullptr};  /*!< \brief Data structure for unsigned long point-to-point send. */
+  float *bufF_P2PRecv{nullptr};           /*!< \brief Data structure for single precision point-to-point receive. */
+  float *bufF_P2PSend{nullptr};           /*!< \brief Data structure for single precision point-to-point send. */
   SU2_MPI::Request *req_P2PSend{nullptr}; /*!< \brief Data structure for point-to-point send requests. */
   SU2_MPI::Request *req_P2PRecv{nullptr}; /*!< \brief Data structure for point-to-point recv requests. */
+  map<int, unique_ptr<SU2_MPI::Request[]> > persistReq_P2PSend; /*!< \brief Persistent send requests (one per message) for each packet size used in point-to-point comms. */
+  map<int, unique_ptr<SU2_MPI::Request[]> > persistReq_P2PRecv; /*!< \brief Persistent recv requests (one per message) for each packet size used in point-to-point comms. */
+#ifdef HAVE_SHARED_MEMORY_COMMS
+  SU2_MPI::Comm nodeComm{MPI_COMM_NULL};     /*!< \brief Node-local communicator used for the shared-memory fast path of point-to-point comms. */
+  SU2_MPI::Win winD_P2PRecv{MPI_WIN_NULL};   /*!< \brief Shared-memory window exposing the su2double recv buffer to the ranks on the same node. */
+  bool shmCommsActive{false};                /*!< \brief Whether the direct intra-node copies are enabled (requires the unified window memory model). */
+  int *NodeRank_P2PSend{nullptr};            /*!< \brief Node-local rank of each send neighbor, negative if the neighbor lives on another node. */
+  unsigned long *shmOffset_P2PSend{nullptr}; /*!< \brief Start (in points) of our message inside the recv buffer of each on-node send neighbor. */
+  su2double **shmBuf_P2PSend{nullptr};       /*!< \brief Base address of the recv buffer of each on-node send neighbor, queried from the window. */
+#endif
 
   /*--- Data structures for periodic communications. ---*/
 
@@ -290,6 +327,27 @@ public:
    */
   void AllocateP2PComms(unsigned short val_countPerPoint);
 
+  /*!
+   * \brief Routine to create the persistent send/recv channels for one packet size, bound to the
+   * current su2double communication buffers. Called by AllocateP2PComms (from the master thread)
+   * the first time a packet size is communicated, no-op if the channels already exist.
+   * \param[in] val_countPerPoint - Count of the data type per vertex for these channels.
+   */
+  void BuildPersistentP2PRequests(unsigned short val_countPerPoint);
+
+  /*!
+   * \brief Routine to free all persistent point-to-point channels, e.g. before the communication
+   * buffers they are bound to are reallocated.
+   */
+  void FreePersistentP2PRequests();
+
+  /*!
+   * \brief Routine to make the messages written by on-node neighbors through the shared-memory
+   * window visible, called after waiting on a recv request and before unpacking the buffer.
+   * No-op when the shared-memory fast path is not active.
+   */
+  void FlushSharedRecvWindow() const;
+
   /*!
    * \brief Routine to launch non-blocking recvs only for all point-to-point communication with neighboring partitions.
    * \note This routine is called by any class that has loaded data into the generic communication buffers.
@@ -632,6 +690,24 @@ public:
    */
   inline virtual void SetRCM_Ordering(CConfig *config) {}
 
+  /*!
+   * \brief Orders the points along a Hilbert space-filling curve.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void SetHilbert_Ordering(CConfig *config) {}
+
+  /*!
+   * \brief Builds a Hilbert-sorted iteration order for the owned points, an execution-order
+   *        alternative to SetHilbert_Ordering that does not renumber the mesh.
+   */
+  inline virtual void SetSFCIterationOrder() {}
+
+  /*!
+   * \brief Get the space-filling-curve iteration order of the owned points.
+   * \return Permutation of [0, nPointDomain), empty if no order was built.
+   */
+  inline const vector<unsigned long>& GetSFCOrder() const { return SFCOrder; }
+
   /*!
    * \brief Connects elements  .
    */
@@ -713,6 +789,16 @@ public:
    */
   inline virtual void SetControlVolume(CConfig *config, unsigned short action) {}
 
+  /*!
+   * \brief Update the control volume metrics restricted to the region a deformation moved.
+   * \note Falls back to a full update, CPhysicalGeometry implements the restricted one.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] pointMoved - Flag per point indicating whether its coordinates changed.
+   */
+  inline virtual void UpdateControlVolume(CConfig *config, const vector<uint8_t>& pointMoved) {
+    SetControlVolume(config, UPDATE);
+  }
+
   /*!
    * \brief A virtual member.
    * \param[in] config - Definition of the particular problem.
@@ -1613,6 +1699,28 @@ public:
    */
   const CCompressedSparsePatternUL& GetEdgeColoring(su2double* efficiency = nullptr);
 
+  /*!
+   * \brief Get the CSR pattern of the multigrid transfer operator (parent-child relation).
+   * \note Only coarse multigrid levels build this pattern, see CMultiGridGeometry::SetControlVolume.
+   * \return Reference to the pattern, rows are coarse points, columns their fine children.
+   */
+  inline const CCompressedSparsePatternUL& GetMGTransferPattern() const { return mgTransferPattern; }
+
+  /*!
+   * \brief Get the volume-ratio weights of the multigrid restriction operator.
+   * \return Weight of each non-zero of the transfer pattern, kept up to date with the control volumes.
+   */
+  inline const su2double* GetMGRestrictionWeights() const { return mgRestrictionWeight.data(); }
+
+  /*!
+   * \brief Pick the edge color group size by evaluating the parallel efficiency of candidate sizes.
+   * \note Larger groups improve the locality of the colored loops, smaller groups the load balance,
+   * the largest candidate whose efficiency stays close to the best observed one wins.
+   * \param[in] pattern - Edge-to-node sparse pattern to be colored.
+   * \return Selected group size.
+   */
+  unsigned long TuneEdgeColorGroupSize(const CCompressedSparsePatternUL& pattern) const;
+
   /*!
    * \brief Force the natural (sequential) edge coloring.
    */
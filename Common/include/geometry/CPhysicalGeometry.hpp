@@ -39,13 +39,21 @@
  */
 class CPhysicalGeometry final : public CGeometry {
 
-  unordered_map<unsigned long, unsigned long>
-  Global_to_Local_Point;                           /*!< \brief Global-local indexation for the points. */
+  vector<pair<unsigned long, unsigned long> >
+  Global_to_Local_Point;                           /*!< \brief Global-local indexation for the points, sorted by global index. */
+  bool Global_to_Local_Contiguous{false};          /*!< \brief Whether the global indices of the table form a contiguous range (direct indexing). */
   long *Local_to_Global_Point{nullptr};            /*!< \brief Local-global indexation for the points. */
   unsigned long *adj_counter{nullptr};             /*!< \brief Adjacency counter. */
   unsigned long **adjacent_elem{nullptr};          /*!< \brief Adjacency element list. */
   su2activematrix Sensitivity;                     /*!< \brief Matrix holding the sensitivities at each point. */
 
+  /*!
+   * \brief Sort the global-to-local point table by global index and detect whether the
+   *        global indices form a contiguous range, in which case lookups become direct
+   *        accesses instead of binary searches.
+   */
+  void SortGlobalToLocalPoint(void);
+
   vector<vector<unsigned long> > Neighbors;
   unordered_map<unsigned long, unsigned long> Color_List;
   vector<string> Marker_Tags;
@@ -294,8 +302,15 @@ public:
    * \return Local index that correspond with the global index, -1 if not found on the current rank (process).
    */
   inline long GetGlobal_to_Local_Point(unsigned long val_ipoint) const override {
-    auto it = Global_to_Local_Point.find(val_ipoint);
-    if (it != Global_to_Local_Point.cend())
+    if (Global_to_Local_Point.empty()) return -1;
+    if (Global_to_Local_Contiguous) {
+      const auto offset = Global_to_Local_Point.front().first;
+      if (val_ipoint < offset || val_ipoint-offset >= Global_to_Local_Point.size()) return -1;
+      return Global_to_Local_Point[val_ipoint-offset].second;
+    }
+    auto it = lower_bound(Global_to_Local_Point.begin(), Global_to_Local_Point.end(),
+                          make_pair(val_ipoint, 0ul));
+    if (it != Global_to_Local_Point.end() && it->first == val_ipoint)
       return it->second;
     return -1;
   }
@@ -386,6 +401,31 @@ public:
    */
   void SetRCM_Ordering(CConfig *config) override;
 
+  /*!
+   * \brief Set a renumbering following a Hilbert space-filling curve through the points.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetHilbert_Ordering(CConfig *config) override;
+
+  /*!
+   * \brief Build a Hilbert-sorted iteration order of the owned points without renumbering the mesh.
+   */
+  void SetSFCIterationOrder() override;
+
+  /*!
+   * \brief Renumber the points of the geometry, reporting the bandwidth reduction.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] Result - New to old point index map (owned points first, then halos).
+   */
+  void ApplyPointOrdering(CConfig *config, const vector<unsigned long>& Result);
+
+  /*!
+   * \brief Compute the maximum half-bandwidth of the point adjacency graph.
+   * \param[in] position - Old to new point index map, empty for the current ordering.
+   * \return Maximum half-bandwidth over the owned points.
+   */
+  unsigned long GetPointBandwidth(const vector<unsigned long>& position) const;
+
   /*!
    * \brief Set elements which surround an element.
    */
@@ -439,6 +479,40 @@ public:
    */
   void SetControlVolume(CConfig *config, unsigned short action) override;
 
+  /*!
+   * \brief Update the control volume metrics only for the region a deformation moved,
+   *        the contributions of elements without a moved node are preserved exactly.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] pointMoved - Flag per point indicating whether its coordinates changed.
+   */
+  void UpdateControlVolume(CConfig *config, const vector<uint8_t>& pointMoved) override;
+
+  /*!
+   * \brief Implementation of SetControlVolume with compile-time dimension,
+   *        so that the metric loops have constant trip counts.
+   * \note When a moved-point mask is given only the metrics influenced by a
+   *       moved point are rebuilt, see UpdateControlVolume.
+   */
+  template<unsigned short NDIM>
+  void SetControlVolumeImpl(CConfig *config, unsigned short action,
+                            const vector<uint8_t>* pointMoved = nullptr);
+
+  /*!
+   * \brief Load the dual grid metrics (point volumes and edge normals) from the
+   *        preprocessing cache written by a previous run or tool invocation on
+   *        the same mesh and rank count, see also SetColorGrid_Parallel.
+   * \param[in] config - Definition of the particular problem.
+   * \return True if the cache was valid and the metrics were loaded.
+   */
+  bool LoadDualGridCache(CConfig *config);
+
+  /*!
+   * \brief Store the dual grid metrics in the preprocessing cache so that the
+   *        other tools of a design cycle can skip their computation.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void StoreDualGridCache(const CConfig *config) const;
+
   /*!
    * \brief Visualize the structure of the control volume(s).
    * \param[in] config - Definition of the particular problem.
@@ -465,6 +539,12 @@ public:
    */
   void SetBoundControlVolume(const CConfig *config, unsigned short action) override;
 
+  /*!
+   * \brief Implementation of SetBoundControlVolume with compile-time dimension.
+   */
+  template<unsigned short NDIM>
+  void SetBoundControlVolumeImpl(const CConfig *config, unsigned short action);
+
   /*!
    * \brief Set the maximum cell-center to cell-center distance for CVs.
    * \param[in] config - Definition of the particular problem.
@@ -506,6 +586,29 @@ public:
    */
   void SetColorGrid_Parallel(const CConfig *config) override;
 
+  /*!
+   * \brief Compute the parallel load imbalance from a measured per-rank work value.
+   * \param[in] myWork - Work performed by this rank since the last call (e.g. wall seconds).
+   * \return Imbalance ratio, maximum over the ranks divided by the average, minus one.
+   */
+  passivedouble ComputeLoadImbalance(passivedouble myWork) const;
+
+  /*!
+   * \brief Compute a new point-to-rank assignment for the current (possibly deformed or
+   *        unevenly loaded) mesh using the ParMETIS adaptive repartitioning entry point,
+   *        using the present ownership as the starting partition so that point migration
+   *        is minimized. The measured per-rank work sets the vertex weights, i.e. the
+   *        repartitioning targets the observed imbalance rather than the static cost model.
+   *        Note that this only computes the migration map (new rank of every owned point),
+   *        redistributing the geometry and solver state is up to the caller.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] myWork - Work performed by this rank (e.g. wall seconds per time step).
+   * \param[out] newColor - New rank of every owned point of this rank.
+   * \return true if a new assignment was computed (requires MPI and ParMETIS).
+   */
+  bool ComputeRepartitionColoring(const CConfig *config, passivedouble myWork,
+                                  vector<unsigned long> &newColor);
+
   /*!
    * \brief Set the domains for FEM grid partitioning using ParMETIS.
    * \param[in] config - Definition of the particular problem.
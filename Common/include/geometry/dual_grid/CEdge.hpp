@@ -43,6 +43,7 @@ private:
   using NodeArray = C2DContainer<Index, Index, StorageType::ColumnMajor, 64, DynamicSize, 2>;
   NodeArray Nodes;           /*!< \brief Vector to store the node indices of the edge. */
   su2activematrix Normal;    /*!< \brief Normal (area) of the edge. */
+  su2activematrix Vector_ij; /*!< \brief Vector from node i to the edge midpoint, used for MUSCL reconstruction. */
 
   friend class CPhysicalGeometry;
 
@@ -205,4 +206,23 @@ public:
       Normal(iEdge,iDim) -= normal[iDim];
   }
 
+  /*!
+   * \brief Get the vector from node i to the midpoint of an edge (precomputed
+   *        for the MUSCL reconstruction, refreshed on mesh motion).
+   * \param[in] iEdge - Edge index.
+   * \return Vector from node i to the edge midpoint, i.e. 0.5*(coord_j - coord_i).
+   */
+  inline const su2double* GetVector_ij(unsigned long iEdge) const { return Vector_ij[iEdge]; }
+
+  /*!
+   * \brief Set the vector from node i to the midpoint of an edge.
+   * \param[in] iEdge - Edge index.
+   * \param[in] coord_i - Coordinates of the left node of the edge.
+   * \param[in] coord_j - Coordinates of the right node of the edge.
+   */
+  inline void SetVector_ij(unsigned long iEdge, const su2double* coord_i, const su2double* coord_j) {
+    for (auto iDim = 0ul; iDim < Vector_ij.cols(); ++iDim)
+      Vector_ij(iEdge,iDim) = 0.5*(coord_j[iDim] - coord_i[iDim]);
+  }
+
 };
@@ -189,6 +189,13 @@ public:
    */
   void SetElems(const vector<vector<long> >& elemsMatrix);
 
+  /*!
+   * \brief Set the elements that are connected to each point, from an
+   * adjacency already in compressed (CSR) format (no copy).
+   * \param[in] elemsPattern - Point-element adjacency.
+   */
+  void SetElems(CCompressedSparsePatternL&& elemsPattern);
+
   /*!
    * \brief Reset the elements of a control volume.
    */
@@ -220,6 +227,13 @@ public:
    */
   void SetPoints(const vector<vector<unsigned long> >& pointsMatrix);
 
+  /*!
+   * \brief Set the points that compose the control volume, from an
+   * adjacency already in compressed (CSR) format (no copy).
+   * \param[in] pointsPattern - Point-point adjacency.
+   */
+  void SetPoints(CCompressedSparsePatternUL&& pointsPattern);
+
   /*!
    * \brief Get the entire point adjacency information in compressed format (CSR).
    */
@@ -59,7 +59,7 @@ public:
   /*!
    * \brief Destructor of the class.
    */
-  ~CTurboVertex(void) override;
+  ~CTurboVertex(void);
 
   /*!
    * \brief set Normal in the turbomachinery frame of reference.
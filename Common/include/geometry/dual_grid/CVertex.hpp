@@ -28,15 +28,19 @@
 
 #pragma once
 
-#include "CDualGrid.hpp"
+#include "../../CConfig.hpp"
 
 /*!
  * \class CVertex
  * \brief Class for vertex definition (equivalent to edges, but for the boundaries).
+ * \note The normal and coordinate data are stored per object, vertices only
+ * exist on boundaries so there is no motivation to pack them like CPoint/CEdge,
+ * but the accessors are non virtual (there is no dual-grid base class).
  * \author F. Palacios
  */
-class CVertex : public CDualGrid {
+class CVertex {
 protected:
+  static unsigned short nDim;           /*!< \brief Number of dimensions of the problem. */
   unsigned long Nodes[1];               /*!< \brief Vector to store the global nodes of an element. */
   su2double Normal[3] = {0.0};          /*!< \brief Normal coordinates of the element and its center of gravity. */
   su2double Aux_Var;                    /*!< \brief Auxiliar variable defined only on the surface. */
@@ -60,7 +64,7 @@ public:
    * \brief Get the number of nodes of a vertex.
    * \return Number of nodes that set a vertex (1).
    */
-  inline unsigned short GetnNodes() const override { return 1; }
+  inline unsigned short GetnNodes() const { return 1; }
 
   /*!
    * \brief Get the node of the vertex.
@@ -76,7 +80,7 @@ public:
    * \return Compute the normal (dimensional) to the face that makes the vertex.
    */
   void SetNodes_Coord(const su2double *val_coord_Edge_CG, const su2double *val_coord_FaceElem_CG,
-                      const su2double *val_coord_Elem_CG) override;
+                      const su2double *val_coord_Elem_CG);
 
   /*!
    * \overload
@@ -84,13 +88,13 @@ public:
    * \param[in] val_coord_Elem_CG - Coordinates of the centre of gravity of the element.
    * \return Compute the normal (dimensional) to the face that makes the vertex.
    */
-  void SetNodes_Coord(const su2double *val_coord_Edge_CG, const su2double *val_coord_Elem_CG) override;
+  void SetNodes_Coord(const su2double *val_coord_Edge_CG, const su2double *val_coord_Elem_CG);
 
   /*!
    * \brief Copy the the normal vector of a face.
    * \param[in] val_normal - Vector where the subroutine is goint to copy the normal (dimensional).
    */
-  inline void GetNormal(su2double *val_normal) const override {
+  inline void GetNormal(su2double *val_normal) const {
     for (unsigned short iDim = 0; iDim < nDim; iDim++)
       val_normal[iDim] = Normal[iDim];
   }
@@ -99,7 +103,7 @@ public:
    * \brief Get the normal to a face of the control volume asociated with a vertex.
    * \return Dimensional normal vector, the modulus is the area of the face.
    */
-  inline su2double *GetNormal(void) override { return Normal; }
+  inline su2double *GetNormal(void) { return Normal; }
 
   /*!
    * \brief Get the ith component of the normal.
@@ -109,7 +113,7 @@ public:
   /*!
    * \brief Initialize normal vector.
    */
-  inline void SetZeroValues(void) override {
+  inline void SetZeroValues(void) {
     for (unsigned short iDim = 0; iDim < nDim; iDim ++)
       Normal[iDim] = 0.0;
   }
@@ -137,7 +141,7 @@ public:
    * \param[in] val_face_normal - Vector to initialize the normal vector.
    * \return Value of the normal vector.
    */
-  inline void SetNormal(const su2double *val_face_normal) override {
+  inline void SetNormal(const su2double *val_face_normal) {
     for (unsigned short iDim = 0; iDim < nDim; iDim++)
       Normal[iDim]=val_face_normal[iDim];
   }
@@ -146,7 +150,7 @@ public:
    * \brief Add a vector to the normal vector.
    * \param[in] val_face_normal - Vector to add to the normal vector.
    */
-  inline void AddNormal(const su2double *val_face_normal) override {
+  inline void AddNormal(const su2double *val_face_normal) {
     for(unsigned short iDim = 0; iDim < nDim; iDim++)
       Normal[iDim] += val_face_normal[iDim];
   }
@@ -179,7 +183,7 @@ public:
    * \brief Set the value of the cartesian coordinate for the vertex.
    * \param[in] val_coord - Value of the cartesian coordinate.
    */
-  inline void SetCoord(const su2double *val_coord) override {
+  inline void SetCoord(const su2double *val_coord) {
     for (unsigned short iDim = 0; iDim < nDim; iDim++)
       CartCoord[iDim] = val_coord[iDim];
   }
@@ -188,7 +192,7 @@ public:
    * \brief Get the value of the cartesian coordinate for the vertex.
    * \return Value of the cartesian coordinate of the vertex.
    */
-  inline su2double *GetCoord(void) override { return CartCoord; }
+  inline su2double *GetCoord(void) { return CartCoord; }
 
   /*!
    * \brief Get the value of the cartesian coordinate for the vertex.
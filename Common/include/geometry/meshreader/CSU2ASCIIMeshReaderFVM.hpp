@@ -48,6 +48,7 @@ private:
 
   const string meshFilename; /*!< \brief Name of the SU2 ASCII mesh file being read. */
   ifstream mesh_file;  /*!< \brief File object for the SU2 ASCII mesh file. */
+  vector<char> mesh_file_buffer; /*!< \brief Large stream buffer to reduce I/O overhead while streaming the file. */
 
   bool actuator_disk; /*!< \brief Boolean for whether we have an actuator disk to split. */
 
@@ -98,6 +99,11 @@ private:
    */
   void ReadSurfaceElementConnectivity(const bool single_pass = false);
 
+  /*!
+   * \brief Opens the mesh file with a large stream buffer to reduce I/O overhead.
+   */
+  void OpenMeshFile();
+
   /*!
    * \brief Helper function to find the current zone in an SU2 ASCII mesh object.
    */
@@ -63,6 +63,8 @@ public:
 
   vector<su2double> CartesianCoord[3];  /*!< \brief Vector with all the cartesian coordinates in the FFD FFDBox. */
   vector<su2double> ParametricCoord[3]; /*!< \brief Vector with all the parametrics coordinates in the FFD FFDBox. */
+  vector<su2double> BlendingCache;      /*!< \brief Cached blending function values for each surface point. */
+  vector<su2double> BlendingCacheParam[3]; /*!< \brief Parametric coordinates at which the cache was evaluated. */
   vector<unsigned short> MarkerIndex; /*!< \brief Vector with all markers in the FFD FFDBox. */
   vector<unsigned long> VertexIndex;  /*!< \brief Vector with all vertex index in the FFD FFDBox. */
   vector<unsigned long> PointIndex;   /*!< \brief Vector with all points index in the FFD FFDBox. */
@@ -575,6 +577,17 @@ public:
    */
   su2double *EvalCartesianCoord(su2double *ParamCoord) const;
 
+  /*!
+   * \overload
+   * \brief Evaluate the cartesian coordinates of a surface point from its stored parametric
+   *        coordinates, caching the blending function values of the point. The parametric
+   *        coordinates do not change unless the FFD box is redefined, hence after the first
+   *        evaluation each design cycle reduces to a tensor contraction over the control points.
+   * \param[in] val_iSurfacePoints - Surface point of the FFD box.
+   * \return Pointer to the cartesian coordinates of the point.
+   */
+  su2double *EvalCartesianCoord(unsigned long val_iSurfacePoints);
+
   /*!
    * \brief Get the order in the l direction of the FFD FFDBox.
    * \return Order in the l direction of the FFD FFDBox.
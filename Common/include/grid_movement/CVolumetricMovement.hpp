@@ -38,6 +38,13 @@
  * \author F. Palacios, A. Bueno, T. Economon, S. Padron.
  */
 class CVolumetricMovement : public CGridMovement {
+public:
+#ifndef CODI_FORWARD_TYPE
+  using StiffScalar = su2mixedfloat; /*!< \brief Scalar type of the elasticity operator and linear solver. */
+#else
+  using StiffScalar = su2double;
+#endif
+
 protected:
 
   unsigned short nDim;    /*!< \brief Number of dimensions. */
@@ -48,16 +55,38 @@ protected:
 
   unsigned long nIterMesh;  /*!< \brief Number of iterations in the mesh update. +*/
 
-#ifndef CODI_FORWARD_TYPE
-  CSysMatrix<su2mixedfloat> StiffMatrix; /*!< \brief Stiffness matrix of the elasticity problem. */
-  CSysSolve<su2mixedfloat>  System;      /*!< \brief Linear solver/smoother. */
-#else
-  CSysMatrix<su2double> StiffMatrix;
-  CSysSolve<su2double>  System;
-#endif
+  CSysMatrix<StiffScalar> StiffMatrix; /*!< \brief Stiffness matrix of the elasticity problem. */
+  CSysSolve<StiffScalar>  System;      /*!< \brief Linear solver/smoother. */
   CSysVector<su2double> LinSysSol;
   CSysVector<su2double> LinSysRes;
 
+  bool MatrixFree = false;        /*!< \brief Apply the stiffness operator element-wise instead of assembling it. */
+  vector<uint8_t> FixedDOF;       /*!< \brief Degrees of freedom with prescribed displacement (identity rows). */
+  vector<StiffScalar> InvDiagonal;/*!< \brief Inverse diagonal blocks of the stiffness operator (Jacobi preconditioner). */
+
+  vector<uint8_t> PointMoved;     /*!< \brief Points whose coordinates changed in the last grid update. */
+  bool PointMovedValid = false;   /*!< \brief Whether PointMoved reflects the last deformation, rigid motions do not track it. */
+
+  /*!
+   * \brief Turn a row of the stiffness operator into identity to enforce a prescribed displacement,
+   * in matrix-free mode the degree of freedom is marked instead of modifying the matrix.
+   * \param[in] total_index - Index of the degree of freedom (point times nDim plus dimension).
+   */
+  inline void SetFixed_DOF(unsigned long total_index) {
+    if (MatrixFree) FixedDOF[total_index] = 1;
+    else StiffMatrix.DeleteValsRowi(total_index);
+  }
+
+  /*!
+   * \brief Solve the deformation system without an assembled matrix, the stiffness action is
+   * evaluated element-wise and the solver is preconditioned with the inverse diagonal blocks.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[out] Residual - Final residual of the linear solver.
+   * \return Number of iterations of the linear solver.
+   */
+  unsigned long SolveMatrixFree(CGeometry *geometry, CConfig *config, su2double &Residual);
+
 public:
 
   /*!
@@ -104,6 +133,17 @@ public:
    */
   su2double SetFEAMethodContributions_Elem(CGeometry *geometry, CConfig *config);
 
+  /*!
+   * \brief Apply the elasticity stiffness operator without assembling it (v = K u), the element
+   * stiffnesses are re-evaluated on the fly and the prescribed (fixed) rows act as identity.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] u - Vector the operator is applied to.
+   * \param[out] v - Result of the product.
+   */
+  void StiffnessAction(CGeometry *geometry, CConfig *config, const CSysVector<StiffScalar> &u,
+                       CSysVector<StiffScalar> &v);
+
   /*!
    * \brief Build the stiffness matrix for a 3-D hexahedron element. The result will be placed in StiffMatrix_Elem.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -51,7 +51,6 @@ protected:
   const unsigned targetZone; /*!< \brief Index of target zone. */
 
   unsigned long
-  MaxLocalVertex_Donor,              /*!< \brief Maximum vertices per processor. */
   Buffer_Send_nVertex_Donor[1],      /*!< \brief Buffer to send number of vertices on the local processor. */
   *Buffer_Receive_nVertex_Donor;     /*!< \brief Buffer to store the number of vertices per processor on the Donor domain. */
 
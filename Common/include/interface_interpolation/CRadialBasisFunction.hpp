@@ -99,6 +99,31 @@ public:
   static int CheckPolynomialTerms(su2double max_diff_tol, vector<int>& keep_row, su2passivematrix &P);
 
 private:
+  /*!
+   * \brief Compute the interpolation coefficients by blending small RBF interpolants over
+   * overlapping clusters of donor points (Shepard partition-of-unity weights), instead of
+   * solving one dense system over all donors, which is intractable for large interfaces.
+   * \param[in] type - Type of radial basis function.
+   * \param[in] usePolynomial - Whether to use polynomial terms.
+   * \param[in] radius - Normalizes point-to-point distance when computing RBF values.
+   * \param[in] pruneTol - Relative tolerance to prune small interpolation coefficients.
+   * \param[in] maxClusterSize - Maximum number of core donor points per cluster.
+   * \param[in] donorCoord - Coordinates of all donor points of the interface.
+   * \param[in] donorPoint - Global point indices of the donor points.
+   * \param[in] donorProc - Ranks that own the donor points.
+   * \param[in] targetCoord - Coordinates of the local target points.
+   * \param[out] targetDonorInfo - Donor interpolation information for the local target points.
+   * \param[in,out] totalDonorPoints - Running count of donor points over all target points.
+   */
+  void ComputePartitionOfUnityCoefficients(RADIAL_BASIS type, bool usePolynomial, su2double radius,
+                                           passivedouble pruneTol, unsigned long maxClusterSize,
+                                           const su2activematrix& donorCoord,
+                                           const vector<long>& donorPoint,
+                                           const vector<int>& donorProc,
+                                           const vector<const su2double*>& targetCoord,
+                                           vector<CDonorInfo>& targetDonorInfo,
+                                           unsigned long& totalDonorPoints);
+
   /*!
    * \brief Helper function, prunes (by setting to zero) small interpolation coefficients,
    * i.e. <= tolerance*max(abs(coeffs)). The vector is re-scaled such that sum(coeffs)==1.
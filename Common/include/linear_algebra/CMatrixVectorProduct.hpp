@@ -96,6 +96,12 @@ public:
    * \param[out] v - CSysVector that is the result of the product
    */
   inline void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const override {
+#ifdef HAVE_CUDA
+    if (config->GetCUDA()) {
+      matrix.GPUMatrixVectorProduct(u, v, geometry, config);
+      return;
+    }
+#endif
     matrix.MatrixVectorProduct(u, v, geometry, config);
   }
 };
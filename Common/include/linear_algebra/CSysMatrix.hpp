@@ -32,8 +32,13 @@
 #include "CSysVector.hpp"
 #include "CPastixWrapper.hpp"
 
+#ifdef HAVE_CUDA
+#include "CSysMatrixCUDA.hpp"
+#endif
+
 #include <cstdlib>
 #include <vector>
+#include <map>
 #include <cassert>
 
 /*--- In forward mode the matrix is not of a built-in type. ---*/
@@ -143,6 +148,27 @@ private:
 
   ScalarType *invM;                 /*!< \brief Inverse of (Jacobi) preconditioner, or diagonal of ILU. */
 
+  /*--- Scalar used for the optional low precision copy of the ILU factor, only doubles
+   *    are demoted, other types (float, AD) keep their native precision. ---*/
+  using PrecScalar = typename std::conditional<std::is_same<ScalarType,passivedouble>::value,
+                                               float, ScalarType>::type;
+
+  PrecScalar *ILU_matrix_sp;        /*!< \brief Single precision copy of the ILU factor (optional). */
+  PrecScalar *invM_sp;              /*!< \brief Single precision copy of the inverse diagonal of ILU (optional). */
+
+  /*--- Level scheduling of the ILU(0) factorization and triangular solves, rows within
+   *    one level have no mutual dependencies and can be processed in parallel. ---*/
+  vector<unsigned long> iluLevelPerm;  /*!< \brief Rows grouped by level for the factorization/forward solve. */
+  vector<unsigned long> iluLevelPtr;   /*!< \brief Start of each level in iluLevelPerm (CSR-like). */
+  vector<unsigned long> iluLevelPermT; /*!< \brief Rows grouped by level for the backward solve. */
+  vector<unsigned long> iluLevelPtrT;  /*!< \brief Start of each level in iluLevelPermT (CSR-like). */
+
+  /*--- Row ordering used to overlap the halo exchange with computation in the
+   *    matrix-vector product, rows whose result is sent to other ranks come first. ---*/
+  vector<unsigned long> mvpOrder;   /*!< \brief Rows ordered as [send rows, interior rows], empty if no comms. */
+  unsigned long mvpSendRows;        /*!< \brief Number of rows that feed the halo exchange. */
+  unsigned short mvpStencil;        /*!< \brief Dominant stencil size (entries per row) of structured mesh regions, 0 if none. */
+
   unsigned long nLinelet;                      /*!< \brief Number of Linelets in the system. */
   vector<bool> LineletBool;                    /*!< \brief Identify if a point belong to a Linelet. */
   vector<vector<unsigned long> > LineletPoint; /*!< \brief Linelet structure. */
@@ -152,6 +178,43 @@ private:
   mutable vector<vector<ScalarType> > LineletInvDiag;      /*!< \brief Inverse of the diagonal blocks of the tri-diag system (working memory). */
   mutable vector<vector<ScalarType> > LineletVector;       /*!< \brief Solution and RHS of the tri-diag system (working memory). */
 
+  /*--- Two-level aggregation AMG preconditioner. The coarse (Galerkin) operator only
+   *    couples owned points, i.e. the coarse correction is block-Jacobi across MPI
+   *    domains while the fine level smoother sees the halos as usual. ---*/
+  unsigned long nAggregate;            /*!< \brief Number of coarse aggregates (rows of the coarse matrix). */
+  vector<unsigned long> amgAggregate;  /*!< \brief Aggregate (coarse point) of each owned fine point. */
+  vector<unsigned long> amgPointPtr;   /*!< \brief Start of each aggregate in amgPoint (CSR-like). */
+  vector<unsigned long> amgPoint;      /*!< \brief Fine points grouped by aggregate. */
+  vector<unsigned long> amgRowPtr;     /*!< \brief Pointers to the first entry in each coarse row. */
+  vector<unsigned long> amgDiaPtr;     /*!< \brief Pointers to the diagonal entry in each coarse row. */
+  vector<unsigned long> amgColInd;     /*!< \brief Column indices of the coarse matrix. */
+  vector<ScalarType> amgMatrix;        /*!< \brief Block entries of the coarse matrix. */
+  vector<ScalarType> amgInvDiag;       /*!< \brief Inverses of the coarse diagonal blocks. */
+
+  /*--- Temporary (hence mutable) working memory used in the AMG V-cycle. ---*/
+  mutable vector<ScalarType> amgRhs;   /*!< \brief Restricted fine-level residual (working memory). */
+  mutable vector<ScalarType> amgSol;   /*!< \brief Coarse-level correction (working memory). */
+  mutable vector<ScalarType> amgAux;   /*!< \brief Next coarse Jacobi iterate (working memory). */
+  mutable vector<ScalarType> amgCorr;  /*!< \brief Fine-level smoother correction (working memory). */
+
+  /*--- Registry of rows affected by strongly enforced boundary conditions. The sparse
+   *    locations touched by the row/column elimination are recorded the first time a
+   *    row is enforced, subsequent enforcements replay them as a compact sweep without
+   *    searching the sparse pattern (which does not change during the computation). ---*/
+  struct CSparseBCEntry {
+    unsigned long blockIJ;  /*!< \brief Position (block index) of block (i,j) in the matrix. */
+    unsigned long blockJI;  /*!< \brief Position of block (j,i), equal to blockIJ if (j,i) is not in the pattern. */
+    unsigned long nodeJ;    /*!< \brief Column index j, set to i if block (j,i) is not in the pattern. */
+  };
+  std::map<unsigned long, vector<CSparseBCEntry> > bcRowRegistry; /*!< \brief Off-diagonal eliminations per enforced row. */
+
+  /*!
+   * \brief Returns the registered eliminations for a row, building them on the first call.
+   * \param[in] node_i - Row (node) for which a solution is enforced.
+   * \return Sparse locations of the off-diagonal blocks of row and column node_i.
+   */
+  const vector<CSparseBCEntry>& GetBCRowEntries(unsigned long node_i);
+
 #ifdef USE_MKL
   using gemm_t = typename mkl_jit_wrapper<ScalarType>::gemm_t;
   void * MatrixMatrixProductJitter;              /*!< \brief Jitter handle for MKL JIT based GEMM. */
@@ -168,6 +231,12 @@ private:
   mutable CPastixWrapper<ScalarType> pastix_wrapper;
 #endif
 
+#ifdef HAVE_CUDA
+  /*--- Device mirror of the matrix, mutable since the products that
+   *    trigger the lazy uploads do not modify the host data. ---*/
+  mutable CSysMatrixGPUData gpuData; /*!< \brief Device copies of the BCRS arrays and work vectors. */
+#endif
+
   /*!
    * \brief Auxilary object to wrap the edge map pointer used in fast block updates, i.e. without linear searches.
    */
@@ -208,6 +277,12 @@ private:
    */
   void MatrixVectorProduct(const ScalarType *matrix, const ScalarType *vector, ScalarType *product) const;
 
+  /*!
+   * \brief Overload for a matrix block stored in a different (lower) precision than the vectors.
+   */
+  template<class OtherType>
+  void MatrixVectorProduct(const OtherType *matrix, const ScalarType *vector, ScalarType *product) const;
+
   /*!
    * \brief Calculates the matrix-vector product: product += matrix*vector
    * \param[in] matrix
@@ -224,6 +299,12 @@ private:
    */
   void MatrixVectorProductSub(const ScalarType *matrix, const ScalarType *vector, ScalarType *product) const;
 
+  /*!
+   * \brief Overload for a matrix block stored in a different (lower) precision than the vectors.
+   */
+  template<class OtherType>
+  void MatrixVectorProductSub(const OtherType *matrix, const ScalarType *vector, ScalarType *product) const;
+
   /*!
    * \brief Calculates the matrix-matrix product
    */
@@ -342,6 +423,82 @@ private:
    */
   void RowProduct(const CSysVector<ScalarType> & vec, unsigned long row_i, ScalarType *prod) const;
 
+  /*!
+   * \brief Implementation of the sparse matrix-vector product for a block size
+   *        known at compilation, which allows the inner products to fully unroll
+   *        and vectorize (the runtime-size version is scalar and branchy).
+   * \note Does not handle the MPI communication of the result.
+   * \param[in] vec - CSysVector to be multiplied by the sparse matrix A.
+   * \param[out] prod - Result of the product.
+   * \param[in] rowBegin - First position of "mvpOrder" to process.
+   * \param[in] rowEnd - One past the last position of "mvpOrder" to process.
+   * \note L is the dominant stencil size (entries per row) if one was detected,
+   *       rows matching it run a fixed-trip-count loop that unrolls completely,
+   *       L = 0 compiles the generic variable-length loop only.
+   */
+  template<unsigned long N, unsigned long L>
+  void MatrixVectorProductImpl(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                               unsigned long rowBegin, unsigned long rowEnd) const;
+
+  /*!
+   * \brief Instantiates MatrixVectorProductImpl for the detected dominant
+   *        stencil size, see "mvpStencil".
+   */
+  template<unsigned long N>
+  void MatrixVectorProductStencil(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                  unsigned long rowBegin, unsigned long rowEnd) const;
+
+  /*!
+   * \brief Computes a range (in "mvpOrder" positions) of rows of the sparse matrix-vector
+   *        product, dispatching the block-size-specialized kernels where possible.
+   */
+  void MatrixVectorProductRange(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                unsigned long rowBegin, unsigned long rowEnd) const;
+
+  /*!
+   * \brief Implementation of the LU-SGS sweeps for the small block sizes of the
+   *        scalar systems (turbulence, species), iterates the CSR arrays directly
+   *        with closed-form diagonal solves instead of the per-block helpers and
+   *        Gauss eliminations of the generic version.
+   */
+  template<unsigned long N>
+  void ComputeLU_SGSPreconditionerSmall(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                        CGeometry *geometry, const CConfig *config) const;
+
+  /*!
+   * \brief Computes the level sets of the ILU sparsity pattern used to run the
+   *        factorization and the triangular solves in parallel over independent rows.
+   * \note The levels only depend on the sparsity, they are computed once.
+   */
+  void ComputeILULevelScheduling();
+
+  /*!
+   * \brief Update the single precision copy of the ILU factor and inverse
+   *        diagonal after a (re-)factorization.
+   */
+  void UpdateSinglePrecisionILU();
+
+  /*!
+   * \brief Generic implementation of the ILU triangular solves, the factor may
+   *        be stored in lower precision than the vectors.
+   * \param[in] ilu - The ILU factor (strict lower part is L, upper part is U).
+   * \param[in] inv - Inverses of the diagonal blocks of the factor.
+   */
+  template<class MatType>
+  void ComputeILUPreconditionerImpl(const MatType* ilu, const MatType* inv,
+                                    const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                    CGeometry *geometry, const CConfig *config) const;
+
+  /*!
+   * \brief Generic implementation of the level-scheduled ILU triangular solves.
+   * \param[in] ilu - The ILU factor (strict lower part is L, upper part is U).
+   * \param[in] inv - Inverses of the diagonal blocks of the factor.
+   */
+  template<class MatType>
+  void ComputeLevelILUPreconditionerImpl(const MatType* ilu, const MatType* inv,
+                                         const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                         CGeometry *geometry, const CConfig *config) const;
+
 public:
 
   /*!
@@ -403,6 +560,30 @@ public:
     return const_cast<ScalarType*>( const_this.GetBlock(block_i, block_j) );
   }
 
+  /*!
+   * \brief Get the position of block "ij" in the sparse pattern, it can be cached to avoid
+   *        repeated searches when the same scatter pattern is used many times (FEM assembly).
+   * \param[in] block_i - Row index.
+   * \param[in] block_j - Column index.
+   * \return Offset for use with GetBlockAt/AddBlockAt, "nnz" if the block is not in the pattern.
+   */
+  FORCEINLINE unsigned long GetBlockOffset(unsigned long block_i, unsigned long block_j) const {
+    const auto end = (block_j<block_i)? dia_ptr[block_i] : row_ptr[block_i+1];
+    for (auto index = (block_j<block_i)? row_ptr[block_i] : dia_ptr[block_i]; index < end; ++index)
+      if (col_ind[index] == block_j)
+        return index;
+    return nnz;
+  }
+
+  /*!
+   * \brief Get a pointer to the start of the block at a cached position (see GetBlockOffset).
+   * \param[in] offset - Position of the block in the sparse pattern.
+   * \return Pointer to location in memory where the block starts.
+   */
+  FORCEINLINE ScalarType *GetBlockAt(unsigned long offset) {
+    return (offset < nnz)? &matrix[offset*nVar*nEqn] : nullptr;
+  }
+
   /*!
    * \brief Gets the value of a particular entry in block "ij".
    * \param[in] block_i - Row index.
@@ -452,6 +633,21 @@ public:
     SetBlock<OtherType,false>(block_i, block_j, val_block, alpha);
   }
 
+  /*!
+   * \brief Add a scaled block (in flat format) at a cached position in the pattern (see GetBlockOffset).
+   * \param[in] offset - Position of the block obtained via GetBlockOffset.
+   * \param[in] val_block - Block to add to the matrix.
+   * \param[in] alpha - Scale factor.
+   */
+  template<class OtherType, su2enable_if<!is_pointer<OtherType>::value> = 0>
+  inline void AddBlockAt(unsigned long offset, const OtherType *val_block, OtherType alpha = 1.0) {
+    auto mat_ij = GetBlockAt(offset);
+    if (!mat_ij) return;
+    SU2_OMP_SIMD
+    for (auto iVar = 0ul; iVar < nVar*nEqn; ++iVar)
+      mat_ij[iVar] += PassiveAssign(alpha * val_block[iVar]);
+  }
+
   /*!
    * \brief Set the value of a scaled block in the sparse matrix.
    * \note If the template param Overwrite is false we add to the block (bij += alpha*b).
@@ -517,17 +713,31 @@ public:
     ScalarType *bij = &matrix[edge_ptr(iEdge,0)*nVar*nEqn];
     ScalarType *bji = &matrix[edge_ptr(iEdge,1)*nVar*nEqn];
 
+    /*--- Stage the scaled and converted blocks contiguously, such that the
+     * four updates of the matrix below become vectorizable streaming
+     * accesses instead of interleaved scattered stores. ---*/
+    ScalarType blk_i[MAXNVAR*MAXNVAR], blk_j[MAXNVAR*MAXNVAR];
+
     unsigned long iVar, jVar, offset = 0;
 
     for (iVar = 0; iVar < nVar; iVar++) {
       for (jVar = 0; jVar < nEqn; jVar++) {
-        bii[offset] += PassiveAssign(block_i[iVar][jVar] * scale);
-        bij[offset] += PassiveAssign(block_j[iVar][jVar] * scale);
-        bji[offset] -= PassiveAssign(block_i[iVar][jVar] * scale);
-        bjj[offset] -= PassiveAssign(block_j[iVar][jVar] * scale);
+        blk_i[offset] = PassiveAssign(block_i[iVar][jVar] * scale);
+        blk_j[offset] = PassiveAssign(block_j[iVar][jVar] * scale);
         ++offset;
       }
     }
+
+    SU2_OMP_SIMD
+    for (offset = 0; offset < nVar*nEqn; ++offset) {
+      bii[offset] += blk_i[offset];
+      bij[offset] += blk_j[offset];
+    }
+    SU2_OMP_SIMD
+    for (offset = 0; offset < nVar*nEqn; ++offset) {
+      bji[offset] -= blk_i[offset];
+      bjj[offset] -= blk_j[offset];
+    }
   }
 
   /*!
@@ -603,15 +813,24 @@ public:
     ScalarType *bij = &matrix[edge_ptr(iEdge,0)*nVar*nEqn];
     ScalarType *bji = &matrix[edge_ptr(iEdge,1)*nVar*nEqn];
 
+    /*--- Stage the scaled and converted blocks contiguously, see UpdateBlocks. ---*/
+    ScalarType blk_i[MAXNVAR*MAXNVAR], blk_j[MAXNVAR*MAXNVAR];
+
     unsigned long iVar, jVar, offset = 0;
 
     for (iVar = 0; iVar < nVar; iVar++) {
       for (jVar = 0; jVar < nEqn; jVar++) {
-        bij[offset] = (Overwrite? ScalarType(0) : bij[offset]) + PassiveAssign(block_j[iVar][jVar] * scale);
-        bji[offset] = (Overwrite? ScalarType(0) : bji[offset]) - PassiveAssign(block_i[iVar][jVar] * scale);
+        blk_i[offset] = PassiveAssign(block_i[iVar][jVar] * scale);
+        blk_j[offset] = PassiveAssign(block_j[iVar][jVar] * scale);
         ++offset;
       }
     }
+
+    SU2_OMP_SIMD
+    for (offset = 0; offset < nVar*nEqn; ++offset) {
+      bij[offset] = (Overwrite? ScalarType(0) : bij[offset]) + blk_j[offset];
+      bji[offset] = (Overwrite? ScalarType(0) : bji[offset]) - blk_i[offset];
+    }
   }
 
   /*!
@@ -803,6 +1022,30 @@ public:
   void MatrixVectorProduct(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                            CGeometry *geometry, const CConfig *config) const;
 
+#ifdef HAVE_CUDA
+  /*!
+   * \brief Version of MatrixVectorProduct offloaded to the device, the matrix
+   *        is uploaded lazily (only when its coefficients changed).
+   * \param[in] vec - CSysVector to be multiplied by the sparse matrix A.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[out] prod - Result of the product.
+   */
+  void GPUMatrixVectorProduct(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                              CGeometry *geometry, const CConfig *config) const;
+
+  /*!
+   * \brief Version of ComputeJacobiPreconditioner offloaded to the device,
+   *        the inverted diagonal blocks are still computed on the host.
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product A*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void GPUComputeJacobiPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                      CGeometry *geometry, const CConfig *config) const;
+#endif
+
   /*!
    * \brief Build the Jacobi preconditioner.
    */
@@ -833,6 +1076,41 @@ public:
   void ComputeILUPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                 CGeometry *geometry, const CConfig *config) const;
 
+  /*!
+   * \brief Build the level-scheduled ILU preconditioner.
+   * \note Unlike BuildILUPreconditioner there is no additive decomposition over
+   *       threads, the factorization is exact over the rank (as in MPI-only runs).
+   */
+  void BuildLevelILUPreconditioner();
+
+  /*!
+   * \brief Multiply CSysVector by the level-scheduled ILU preconditioner.
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product A*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeLevelILUPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                     CGeometry *geometry, const CConfig *config) const;
+
+  /*!
+   * \brief Build the aggregation AMG preconditioner, i.e. aggregate the fine points,
+   *        assemble the Galerkin coarse matrix, and invert the diagonal blocks used
+   *        by the smoothers (the sparse structure is only built on the first call).
+   */
+  void BuildAMGPreconditioner();
+
+  /*!
+   * \brief Multiply CSysVector by the AMG preconditioner, i.e. apply one two-level
+   *        V-cycle with damped block-Jacobi smoothing.
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product A*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAMGPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                CGeometry *geometry, const CConfig *config) const;
+
   /*!
    * \brief Multiply CSysVector by the preconditioner
    * \param[in] vec - CSysVector to be multiplied by the preconditioner.
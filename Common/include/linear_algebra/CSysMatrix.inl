@@ -52,8 +52,8 @@ FORCEINLINE void CSysMatrix<ScalarType>::SetBlock_ILUMatrix(unsigned long block_
 
 namespace {
 
-template<class T, bool alpha, bool beta, bool transp>
-FORCEINLINE void gemv_impl(unsigned long n, unsigned long m, const T *a, const T *b, T *c) {
+template<class T, bool alpha, bool beta, bool transp, class U>
+FORCEINLINE void gemv_impl(unsigned long n, unsigned long m, const T *a, const U *b, U *c) {
   /*---
    This is a templated version of GEMV with the constants as boolean
    template parameters so that they can be optimized away at compilation.
@@ -142,6 +142,24 @@ FORCEINLINE void CSysMatrix<ScalarType>::MatrixMatrixProduct(const ScalarType *m
 #undef MATVECPROD_SIGNATURE
 #undef __MATVECPROD_SIGNATURE__
 
+/*--- Overloads for a matrix block stored in a different (lower) precision than the
+ vectors, the products are still accumulated in ScalarType. The same-type overloads
+ above take precedence when both precisions coincide. ---*/
+
+template<class ScalarType>
+template<class OtherType>
+FORCEINLINE void CSysMatrix<ScalarType>::MatrixVectorProduct(const OtherType *matrix, const ScalarType *vector,
+                                                             ScalarType *product) const {
+  gemv_impl<OtherType,true,false,false>(nVar, nEqn, matrix, vector, product);
+}
+
+template<class ScalarType>
+template<class OtherType>
+FORCEINLINE void CSysMatrix<ScalarType>::MatrixVectorProductSub(const OtherType *matrix, const ScalarType *vector,
+                                                                ScalarType *product) const {
+  gemv_impl<OtherType,false,true,false>(nVar, nEqn, matrix, vector, product);
+}
+
 template<class ScalarType>
 FORCEINLINE void CSysMatrix<ScalarType>::Gauss_Elimination(unsigned long block_i, ScalarType* rhs) const {
 
@@ -0,0 +1,91 @@
+/*!
+ * \file CSysMatrixCUDA.hpp
+ * \brief Declarations of the CUDA offload helpers used by CSysMatrix.
+ *        The device kernels are implemented in <i>CSysMatrixCUDA.cu</i>.
+ * \note This header is self-contained (no SU2 includes) so that the
+ *       CUDA translation unit does not need the full SU2 include chain.
+ * \author P. Gomes
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/*!
+ * \brief Device-side mirror of the BCRS arrays of a CSysMatrix and of the
+ * work vectors of the Krylov solvers, allocated lazily on first use.
+ * The dirty flags mark host data that changed since the last upload, the
+ * sparsity pattern is uploaded only once as it does not change.
+ */
+struct CSysMatrixGPUData {
+  void* matrix = nullptr;  /*!< \brief Block values of the sparse matrix. */
+  void* invM = nullptr;    /*!< \brief Inverses of the diagonal blocks (Jacobi). */
+  void* rowPtr = nullptr;  /*!< \brief First block of each row. */
+  void* colInd = nullptr;  /*!< \brief Column index of each block. */
+  void* vec = nullptr;     /*!< \brief Input vector of products. */
+  void* prod = nullptr;    /*!< \brief Output vector of products. */
+  bool matrixDirty = true; /*!< \brief The matrix coefficients changed since the last upload. */
+  bool invMDirty = true;   /*!< \brief The Jacobi inverses changed since the last upload. */
+};
+
+namespace CSysMatrixGPU {
+
+/*!
+ * \brief Sparse matrix-vector product (y = A x) of the owned rows on the device,
+ * the halo rows of the result are completed by the caller via MPI.
+ * \param[in,out] gpu - Device data of the matrix, uploads happen as needed.
+ * \param[in] nPointDomain - Number of owned block rows.
+ * \param[in] nVar - Block row size.
+ * \param[in] nEqn - Block column size.
+ * \param[in] nnz - Number of blocks in the sparsity pattern.
+ * \param[in] rowPtr - First block of each row (host).
+ * \param[in] colInd - Column index of each block (host).
+ * \param[in] matrix - Block values (host).
+ * \param[in] vec - Input vector (host, including halo values).
+ * \param[in] vecSize - Total size of the input vector.
+ * \param[out] prod - Result of the product (host, owned entries only).
+ */
+template <class ScalarType>
+void Product(CSysMatrixGPUData& gpu, unsigned long nPointDomain, unsigned long nVar, unsigned long nEqn,
+             unsigned long nnz, const unsigned long* rowPtr, const unsigned long* colInd, const ScalarType* matrix,
+             const ScalarType* vec, unsigned long vecSize, ScalarType* prod);
+
+/*!
+ * \brief Block-Jacobi application (y = D^{-1} x) on the device using the
+ * diagonal block inverses computed on the host.
+ * \param[in,out] gpu - Device data of the matrix, uploads happen as needed.
+ * \param[in] nPointDomain - Number of owned block rows.
+ * \param[in] nVar - Block size.
+ * \param[in] invM - Inverted diagonal blocks (host).
+ * \param[in] vec - Input vector (host).
+ * \param[out] prod - Result of the preconditioning (host, owned entries only).
+ */
+template <class ScalarType>
+void JacobiProduct(CSysMatrixGPUData& gpu, unsigned long nPointDomain, unsigned long nVar, const ScalarType* invM,
+                   const ScalarType* vec, ScalarType* prod);
+
+/*!
+ * \brief Release all device memory associated with a matrix.
+ */
+void Free(CSysMatrixGPUData& gpu);
+
+}  // namespace CSysMatrixGPU
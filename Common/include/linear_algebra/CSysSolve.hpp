@@ -94,6 +94,18 @@ private:
   mutable std::vector<VectorType> W;  /*!< \brief Large matrix used by FGMRES, w^i+1 = A * z^i. */
   mutable std::vector<VectorType> Z;  /*!< \brief Large matrix used by FGMRES, preconditioned W. */
 
+  /*--- The Krylov bases (W/Z) are non-owning views into this contiguous arena,
+   *    allocated once per run instead of one allocation per basis vector. ---*/
+  mutable ScalarType* krylovArena = nullptr; /*!< \brief Workspace arena backing the W/Z vectors. */
+  mutable unsigned long krylovArenaSize = 0; /*!< \brief Current arena size (in number of scalars). */
+
+  mutable bool warmStartReady = false; /*!< \brief Indicate if a previous solution is available for warm starting. */
+  mutable VectorType xPrev;            /*!< \brief Solution of the previous call to Solve, used as warm-start guess. */
+
+  mutable bool refine_ready = false; /*!< \brief Indicate if memory used by iterative refinement is allocated. */
+  mutable VectorType refineRes;      /*!< \brief Residual of the accumulated solution in iterative refinement. */
+  mutable VectorType refineSol;      /*!< \brief Correction computed by each refinement sweep. */
+
   VectorType  LinSysSol_tmp;        /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
   VectorType  LinSysRes_tmp;        /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
   VectorType* LinSysSol_ptr;        /*!< \brief Pointer to appropriate LinSysSol (set to original or temporary in call to Solve). */
@@ -172,6 +184,22 @@ private:
    */
   void ModGramSchmidt(int i, su2matrix<ScalarType>& Hsbg, std::vector<VectorType> & w) const;
 
+  /*!
+   * \brief Classical Gram-Schmidt orthogonalization with reorthogonalization (CGS2)
+   *
+   * \param[in] i - index indicating which vector in w is being orthogonalized
+   * \param[in,out] Hsbg - the upper Hessenberg begin updated
+   * \param[in,out] w - the (i+1)th vector of w is orthogonalized against the
+   *                    previous vectors in w
+   *
+   * Communication-avoiding alternative to ModGramSchmidt, the dot products of
+   * each pass are batched into a single global reduction such that the number
+   * of blocking communications per FGMRES iteration does not grow with the
+   * size of the Krylov basis. The unconditional second pass gives CGS2 the
+   * stability needed for a well-conditioned basis.
+   */
+  void ClassicalGramSchmidt(int i, su2matrix<ScalarType>& Hsbg, std::vector<VectorType> & w) const;
+
   /*!
    * \brief writes header information for a CSysSolve residual history
    * \param[in] solver - string describing the solver
@@ -294,6 +322,11 @@ public:
    */
   CSysSolve(const bool mesh_deform_mode = false);
 
+  /*!
+   * \brief Destructor of the class, frees the workspace arena.
+   */
+  ~CSysSolve();
+
   /*! \brief Conjugate Gradient method
    * \param[in] b - the right hand size vector
    * \param[in,out] x - on entry the intial guess, on exit the solution
@@ -320,10 +353,12 @@ public:
    * \param[out] residual - final normalized residual
    * \param[in] monitoring - turn on priting residuals from solver to screen.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] ca_orth - use the communication-avoiding (CGS2) orthogonalization.
    */
   unsigned long FGMRES_LinSolver(const VectorType & b, VectorType & x, const ProductType & mat_vec,
                                  const PrecondType & precond, ScalarType tol, unsigned long m,
-                                 ScalarType & residual, bool monitoring, const CConfig *config) const;
+                                 ScalarType & residual, bool monitoring, const CConfig *config,
+                                 bool ca_orth = false) const;
 
   /*!
    * \brief Flexible Generalized Minimal Residual method with restarts (frequency comes from config).
@@ -33,6 +33,8 @@
 #include "../parallelization/vectorization.hpp"
 #include "vector_expressions.hpp"
 
+#include <vector>
+
 /*!
  * \brief OpenMP worksharing construct used in CSysVector for loops.
  * \note The loop will only run in parallel if methods are called from a
@@ -66,6 +68,7 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
 
   unsigned long omp_chunk_size = OMP_MAX_SIZE; /*!< \brief Static chunk size used in loops. */
   ScalarType* vec_val = nullptr;               /*!< \brief Storage, 64 byte aligned (do not use normal new/delete). */
+  bool owns_mem = true;            /*!< \brief False if the storage is a non-owning view of an external workspace. */
   unsigned long nElm = 0;          /*!< \brief Total number of elements (or number elements on this processor). */
   unsigned long nElmDomain = 0;    /*!< \brief Total number of elements without Ghost cells. */
   unsigned long nVar = 1;          /*!< \brief Number of elements in a block. */
@@ -83,6 +86,21 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
   void Initialize(unsigned long numBlk, unsigned long numBlkDomain, unsigned long numVar, const ScalarType* val,
                   bool valIsArray, bool errorIfParallel = true);
 
+ public:
+  /*!
+   * \brief Make the vector a non-owning view of external storage (e.g. a workspace arena).
+   * \note The storage must be 64 byte aligned and must outlive the vector,
+   *       the caller is responsible for its lifetime.
+   * \param[in] numBlk - Number of blocks locally.
+   * \param[in] numBlkDomain - Number of blocks locally (without ghost cells).
+   * \param[in] numVar - Number of variables in each block.
+   * \param[in] storage - External storage (at least numBlk*numVar elements).
+   */
+  void ViewExternalStorage(unsigned long numBlk, unsigned long numBlkDomain, unsigned long numVar,
+                           ScalarType* storage);
+
+ private:
+
   /*!
    * \brief Helper to unpack (transpose) a SIMD input block.
    */
@@ -331,6 +349,54 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
     return dotRes;
   }
 
+  /*!
+   * \brief Dot product of "this" with multiple vectors, fusing the global reductions.
+   * \note One communication round instead of n, used by communication-avoiding
+   *       orthogonalization in Krylov solvers.
+   * \param[in] vecs - The vectors to dot "this" with.
+   * \param[in] n - Number of vectors (n <= vecs.size()).
+   * \param[out] dots - Results of the n dot products (same on all threads/ranks).
+   */
+  void dots(const std::vector<CSysVector>& vecs, unsigned long n, ScalarType* dots) const {
+    static std::vector<ScalarType> dotsRes;
+    /*--- All threads get the same "view" of the vectors and shared variable. ---*/
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER
+    dotsRes.assign(n, 0.0);
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+
+    for (auto k = 0ul; k < n; ++k) {
+      /*--- Local dot product for each thread. ---*/
+      ScalarType sum = 0.0;
+
+      CSYSVEC_PARFOR
+      for (auto i = 0ul; i < nElmDomain; ++i) {
+        sum += vec_val[i] * vecs[k].vec_val[i];
+      }
+      END_CSYSVEC_PARFOR
+
+      /*--- Update shared variable with "our" partial sum. ---*/
+      atomicAdd(sum, dotsRes[k]);
+    }
+    SU2_OMP_BARRIER
+
+#ifdef HAVE_MPI
+    /*--- Reduce across all mpi ranks, only master thread communicates. ---*/
+    SU2_OMP_MASTER {
+      std::vector<ScalarType> localRes(dotsRes);
+      const auto mpi_type = (sizeof(ScalarType) < sizeof(double)) ? MPI_FLOAT : MPI_DOUBLE;
+      SelectMPIWrapper<ScalarType>::W::Allreduce(localRes.data(), dotsRes.data(), n,
+                                                 mpi_type, MPI_SUM, SU2_MPI::GetComm());
+    }
+    END_SU2_OMP_MASTER
+    /*--- Make view of result consistent across threads. ---*/
+    SU2_OMP_BARRIER
+#endif
+
+    for (auto k = 0ul; k < n; ++k) dots[k] = dotsRes[k];
+  }
+
   /*!
    * \brief Squared L2 norm of the vector (via dot with self).
    * \return Squared L2 norm.
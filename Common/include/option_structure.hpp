@@ -118,6 +118,7 @@ const unsigned short COMM_TYPE_DOUBLE         = 4;  /*!< \brief Communication ty
 const unsigned short COMM_TYPE_CHAR           = 5;  /*!< \brief Communication type for char. */
 const unsigned short COMM_TYPE_SHORT          = 6;  /*!< \brief Communication type for short. */
 const unsigned short COMM_TYPE_INT            = 7;  /*!< \brief Communication type for int. */
+const unsigned short COMM_TYPE_FLOAT          = 8;  /*!< \brief Communication type for float (single precision). */
 
 /*!
  * \brief Types of geometric entities based on VTK nomenclature
@@ -1026,7 +1027,8 @@ enum ENUM_TIME_INT {
   EULER_EXPLICIT = 2,         /*!< \brief Explicit Euler time integration definition. */
   EULER_IMPLICIT = 3,         /*!< \brief Implicit Euler time integration definition. */
   CLASSICAL_RK4_EXPLICIT = 4, /*!< \brief Classical RK4 time integration definition. */
-  ADER_DG = 5                 /*!< \brief ADER-DG time integration definition. */
+  ADER_DG = 5,                /*!< \brief ADER-DG time integration definition. */
+  SSPRK3_EXPLICIT = 6         /*!< \brief Strong-stability-preserving third-order RK, low (2N) storage. */
 };
 static const MapType<std::string, ENUM_TIME_INT> Time_Int_Map = {
   MakePair("RUNGE-KUTTA_EXPLICIT", RUNGE_KUTTA_EXPLICIT)
@@ -1034,6 +1036,7 @@ static const MapType<std::string, ENUM_TIME_INT> Time_Int_Map = {
   MakePair("EULER_IMPLICIT", EULER_IMPLICIT)
   MakePair("CLASSICAL_RK4_EXPLICIT", CLASSICAL_RK4_EXPLICIT)
   MakePair("ADER_DG", ADER_DG)
+  MakePair("SSPRK3_EXPLICIT", SSPRK3_EXPLICIT)
 };
 
 /*!
@@ -1892,6 +1895,7 @@ enum ENUM_LINEAR_SOLVER {
   FGMRES,               /*!< \brief Flexible Generalized Minimal Residual method. */
   BCGSTAB,              /*!< \brief BCGSTAB - Biconjugate Gradient Stabilized Method (main solver). */
   RESTARTED_FGMRES,     /*!< \brief Flexible Generalized Minimal Residual method with restart. */
+  CA_FGMRES,            /*!< \brief FGMRES with communication-avoiding (batched dot product) orthogonalization. */
   SMOOTHER,             /*!< \brief Iterative smoother. */
   PASTIX_LDLT,          /*!< \brief PaStiX LDLT (complete) factorization. */
   PASTIX_LU,            /*!< \brief PaStiX LU (complete) factorization. */
@@ -1901,6 +1905,7 @@ static const MapType<std::string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = {
   MakePair("BCGSTAB", BCGSTAB)
   MakePair("FGMRES", FGMRES)
   MakePair("RESTARTED_FGMRES", RESTARTED_FGMRES)
+  MakePair("CA_FGMRES", CA_FGMRES)
   MakePair("SMOOTHER", SMOOTHER)
   MakePair("PASTIX_LDLT", PASTIX_LDLT)
   MakePair("PASTIX_LU", PASTIX_LU)
@@ -1960,6 +1965,8 @@ enum ENUM_LINEAR_SOLVER_PREC {
   LU_SGS,         /*!< \brief LU SGS preconditioner. */
   LINELET,        /*!< \brief Line implicit preconditioner. */
   ILU,            /*!< \brief ILU(k) preconditioner. */
+  LEVEL_ILU,      /*!< \brief ILU(0) preconditioner with level-scheduled parallel triangular solves. */
+  AMG,            /*!< \brief Aggregation-based algebraic multigrid preconditioner. */
   PASTIX_ILU=10,  /*!< \brief PaStiX ILU(k) preconditioner. */
   PASTIX_LU_P,    /*!< \brief PaStiX LU as preconditioner. */
   PASTIX_LDLT_P,  /*!< \brief PaStiX LDLT as preconditioner. */
@@ -1969,6 +1976,8 @@ static const MapType<std::string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Ma
   MakePair("LU_SGS", LU_SGS)
   MakePair("LINELET", LINELET)
   MakePair("ILU", ILU)
+  MakePair("LEVEL_ILU", LEVEL_ILU)
+  MakePair("AMG", AMG)
   MakePair("PASTIX_ILU", PASTIX_ILU)
   MakePair("PASTIX_LU", PASTIX_LU_P)
   MakePair("PASTIX_LDLT", PASTIX_LDLT_P)
@@ -2028,6 +2037,20 @@ static const MapType<std::string, TIME_MARCHING> TimeMarching_Map = {
   MakePair("ROTATIONAL_FRAME", TIME_MARCHING::ROTATIONAL_FRAME)
 };
 
+/*!
+ * \brief Types of point renumbering applied to the partitioned grid
+ */
+enum class POINT_REORDERING {
+  NONE,    /*!< \brief Keep the ordering of the partitioned grid. */
+  RCM,     /*!< \brief Reverse Cuthill-McKee ordering (bandwidth reduction). */
+  HILBERT, /*!< \brief Hilbert space-filling curve ordering (cache locality). */
+};
+static const MapType<std::string, POINT_REORDERING> Point_Reordering_Map = {
+  MakePair("NONE", POINT_REORDERING::NONE)
+  MakePair("RCM", POINT_REORDERING::RCM)
+  MakePair("HILBERT", POINT_REORDERING::HILBERT)
+};
+
 /*!
  * \brief Types of element stiffnesses imposed for FEA mesh deformation
  */
@@ -2158,6 +2181,7 @@ enum MPI_QUANTITIES {
   PRIMITIVE_GRADIENT   ,  /*!< \brief Primitive gradient communication. */
   PRIMITIVE_GRAD_REC   ,  /*!< \brief Primitive reconstruction gradient communication. */
   PRIMITIVE_LIMITER    ,  /*!< \brief Primitive limiter communication. */
+  PRIMITIVE_GRAD_REC_LIM, /*!< \brief Fused primitive reconstruction gradient and limiter communication. */
   UNDIVIDED_LAPLACIAN  ,  /*!< \brief Undivided Laplacian communication. */
   MAX_EIGENVALUE       ,  /*!< \brief Maximum eigenvalue communication. */
   SENSOR               ,  /*!< \brief Dissipation sensor communication. */
@@ -2174,6 +2198,7 @@ enum MPI_QUANTITIES {
   MESH_DISPLACEMENTS   ,  /*!< \brief Mesh displacements at the interface. */
   SOLUTION_TIME_N      ,  /*!< \brief Solution at time n. */
   SOLUTION_TIME_N1     ,  /*!< \brief Solution at time n-1. */
+  LOCAL_CFL            ,  /*!< \brief Local CFL number communication (for local CFL adaption). */
 };
 
 /*!
@@ -82,6 +82,17 @@ extern MediTypes* mediTypes;
 #else
 class CBaseMPIWrapper;
 typedef CBaseMPIWrapper SU2_MPI;
+
+/*--- Persistent communication requests are only available when the MPI routines
+ * are not wrapped for algorithmic differentiation (MediPack does not expose
+ * MPI_Send_init / MPI_Recv_init). ---*/
+#define HAVE_PERSISTENT_COMMS
+
+/*--- Intra-node halo messages can bypass the network stack via MPI-3
+ * shared-memory windows, again only when su2double is a plain double. ---*/
+#if MPI_VERSION >= 3
+#define HAVE_SHARED_MEMORY_COMMS
+#endif
 #endif  // defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE
 
 /*!
@@ -170,6 +181,20 @@ class CBaseMPIWrapper {
     MPI_Irecv(buf, count, datatype, dest, tag, comm, request);
   }
 
+  static inline void Send_init(const void* buf, int count, Datatype datatype, int dest, int tag, Comm comm,
+                               Request* request) {
+    MPI_Send_init(buf, count, datatype, dest, tag, comm, request);
+  }
+
+  static inline void Recv_init(void* buf, int count, Datatype datatype, int source, int tag, Comm comm,
+                               Request* request) {
+    MPI_Recv_init(buf, count, datatype, source, tag, comm, request);
+  }
+
+  static inline void Start(Request* request) { MPI_Start(request); }
+
+  static inline void Startall(int nrequests, Request* request) { MPI_Startall(nrequests, request); }
+
   static inline void Wait(Request* request, Status* status) { MPI_Wait(request, status); }
 
   static inline int Request_free(Request *request) { return MPI_Request_free(request); }
@@ -535,6 +560,16 @@ class CBaseMPIWrapper {
 
   static inline void Irecv(void* buf, int count, Datatype datatype, int source, int tag, Comm comm, Request* request) {}
 
+  static inline void Send_init(const void* buf, int count, Datatype datatype, int dest, int tag, Comm comm,
+                               Request* request) {}
+
+  static inline void Recv_init(void* buf, int count, Datatype datatype, int source, int tag, Comm comm,
+                               Request* request) {}
+
+  static inline void Start(Request* request) {}
+
+  static inline void Startall(int nrequests, Request* request) {}
+
   static inline void Wait(Request* request, Status* status) {}
 
   static inline int Request_free(Request *request) { return 0; }
@@ -39,6 +39,7 @@
 #pragma once
 
 #include <cstddef>
+#include <vector>
 
 #include "../code_config.hpp"
 
@@ -221,6 +222,122 @@ inline size_t computeStaticChunkSize(size_t totalWork,
   return roundUpDiv(workPerThread, chunksPerThread);
 }
 
+/*!
+ * \brief Measured-cost partitioner for hot thread-parallel loops, i.e. a persistent
+ *        guided schedule.
+ * \note Static chunking assigns equal index ranges regardless of per-index cost
+ *       variation (e.g. the number of neighbors of a point in gradient loops).
+ *       This helper gives each thread one contiguous range and moves the range
+ *       boundaries between calls such that the measured (exponentially smoothed)
+ *       execution times equalize. All threads of the parallel region must
+ *       participate, and the instance must be shared by the threads and persist
+ *       between calls (e.g. function-local static):
+ *
+ *         static COmpCostPartitioner partitioner;
+ *         size_t begin, end;
+ *         partitioner.beginRange(totalWork, begin, end);
+ *         for (auto i = begin; i < end; ++i) { ... }
+ *         partitioner.endRange();
+ *
+ *       The ranges always cover [0, totalWork) exactly, the measurements only
+ *       decide where the boundaries fall. If the work size or the number of
+ *       threads changes the partitioner re-initializes with equal ranges.
+ *       endRange ends with a barrier, like the implicit one of a for pragma.
+ */
+class COmpCostPartitioner {
+ private:
+  struct alignas(64) ThreadData {
+    passivedouble tStart = 0.0;  /*!< \brief Wall time at beginRange. */
+    passivedouble time = 0.0;    /*!< \brief Smoothed execution time of the range. */
+    size_t begin = 0;            /*!< \brief Start of the range of the thread. */
+    size_t end = 0;              /*!< \brief Past-the-end of the range. */
+  };
+  std::vector<ThreadData> data;
+  std::vector<size_t> bounds;    /*!< \brief Scratch for the new range boundaries. */
+  size_t totalWork = 0;
+
+ public:
+  /*!
+   * \brief Get the index range of the calling thread, (re-)initializing if needed.
+   */
+  void beginRange(size_t workSize, size_t& begin, size_t& end) {
+    const auto nThreads = size_t(omp_get_num_threads());
+
+    SU2_OMP_MASTER {
+      if (data.size() != nThreads || totalWork != workSize) {
+        data.assign(nThreads, ThreadData());
+        bounds.assign(nThreads+1, 0);
+        totalWork = workSize;
+        const auto chunk = roundUpDiv(workSize, nThreads);
+        for (size_t i = 0; i < nThreads; ++i) {
+          data[i].begin = (i*chunk < workSize)? i*chunk : workSize;
+          data[i].end = ((i+1)*chunk < workSize)? (i+1)*chunk : workSize;
+        }
+      }
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+
+    const auto iThread = size_t(omp_get_thread_num());
+    begin = data[iThread].begin;
+    end = data[iThread].end;
+    data[iThread].tStart = omp_get_wtime();
+  }
+
+  /*!
+   * \brief Record the execution time of the calling thread and equalize the boundaries.
+   */
+  void endRange() {
+    const auto iThread = size_t(omp_get_thread_num());
+    const auto nThreads = size_t(omp_get_num_threads());
+
+    /*--- Exponential smoothing absorbs run-to-run noise (and interleaved use of
+     *    the same instance by loops of different absolute cost). ---*/
+    const passivedouble t = omp_get_wtime() - data[iThread].tStart;
+    data[iThread].time = (data[iThread].time > 0.0)? 0.75*data[iThread].time + 0.25*t : t;
+
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER {
+      passivedouble totalCost = 0.0;
+      for (const auto& d : data) totalCost += d.time;
+
+      if (totalCost > 0.0 && nThreads > 1) {
+        /*--- Integrate the piecewise-constant cost density given by the current
+         *    ranges, placing the new boundaries at equal fractions of the total. ---*/
+        const passivedouble target = totalCost / nThreads;
+        size_t seg = 0, pos = 0;
+        bounds[0] = 0;
+        bounds[nThreads] = totalWork;
+
+        for (size_t k = 1; k < nThreads; ++k) {
+          passivedouble need = target;
+          while (true) {
+            while (seg < nThreads && pos >= data[seg].end) ++seg;
+            if (seg == nThreads) break;
+            const size_t segLen = data[seg].end - data[seg].begin;
+            const passivedouble costPerIdx = (segLen > 0)? data[seg].time/segLen : 0.0;
+            const passivedouble segCost = (data[seg].end - pos) * costPerIdx;
+            if (segCost > need && costPerIdx > 0.0) {
+              pos += size_t(need / costPerIdx);
+              break;
+            }
+            need -= segCost;
+            pos = data[seg].end;
+          }
+          bounds[k] = (pos < totalWork)? pos : totalWork;
+          if (bounds[k] < bounds[k-1]) bounds[k] = bounds[k-1];
+        }
+        for (size_t i = 0; i < nThreads; ++i) {
+          data[i].begin = bounds[i];
+          data[i].end = bounds[i+1];
+        }
+      }
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+};
+
 /*!
  * \brief Copy data from one array-like object to another in parallel.
  * \param[in] size - Number of elements.
@@ -268,3 +385,40 @@ inline void atomicAdd(T rhs, T& lhs)
   SU2_OMP_ATOMIC
   lhs += rhs;
 }
+
+/*!
+ * \brief Reduce thread-local partial results without a critical section.
+ * \note Each thread deposits its partial in a padded per-thread slot, then all
+ *       threads fold the slots, i.e. every thread returns the team-wide result.
+ *       This avoids serializing the threads through a critical section, and is
+ *       compatible with OpenMP 2.0, which has no min/max reduction clauses.
+ *       Must be called by all threads of the parallel region (it contains
+ *       barriers), it also works when called outside of a parallel region.
+ * \param[in] localVal - Partial result of the current thread.
+ * \param[in] op - Associative binary operation, e.g. min, max, plus.
+ * \return The partial results of all threads folded with the operation.
+ */
+template<class T, class BinaryOp>
+inline T ompThreadReduction(const T& localVal, BinaryOp op)
+{
+  const auto nThreads = size_t(omp_get_num_threads());
+  if (nThreads == 1) return localVal;
+
+  /*--- The padding keeps slots of different threads on different cache lines.
+   *    The buffer is shared by consecutive reductions of the same type, the
+   *    barriers prevent any overlap between them. ---*/
+  struct Slot { T val; char pad[64]; };
+  static std::vector<Slot> slots;
+
+  SU2_OMP_MASTER
+  if (slots.size() < nThreads) slots.resize(nThreads);
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  slots[omp_get_thread_num()].val = localVal;
+  SU2_OMP_BARRIER
+
+  T result = slots[0].val;
+  for (size_t i = 1; i < nThreads; ++i) result = op(result, slots[i].val);
+  return result;
+}
@@ -35,17 +35,20 @@
 #ifdef __SSE2__
 #include "x86intrin.h"
 #endif
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
 
 namespace simd {
 
 using namespace VecExpr;
 
-/*--- Detect preferred SIMD size (bytes). This only covers x86 architectures. ---*/
+/*--- Detect preferred SIMD size (bytes). This covers x86 and ARM architectures. ---*/
 #if defined(__AVX512F__)
 constexpr size_t PREFERRED_SIZE = 64;
 #elif defined(__AVX__)
 constexpr size_t PREFERRED_SIZE = 32;
-#elif defined(__SSE2__)
+#elif defined(__SSE2__) || defined(__ARM_NEON)
 constexpr size_t PREFERRED_SIZE = 16;
 #else
 constexpr size_t PREFERRED_SIZE = 8;
@@ -164,6 +167,9 @@ namespace SizeTag {
 constexpr auto abs_mask_d = 0x7FFFFFFFFFFFFFFFL;
 /*--- negation flips the sign bit ("x" ^ 0b1000...). ---*/
 constexpr auto sign_mask_d = 0x8000000000000000L;
+/*--- Single precision counterparts. ---*/
+constexpr auto abs_mask_f = 0x7FFFFFFF;
+constexpr auto sign_mask_f = 0x80000000;
 
 #ifdef __SSE2__
 /*!
@@ -299,8 +305,147 @@ FORCEINLINE __m512d sign_p(__m512d x) { return _mm512_or_pd(ones_8d, _mm512_and_
 
 #include "special_vectorization.hpp"
 
+/*!
+ * Create specialization for array of 16 floats (used by single precision kernels).
+ */
+#define ARRAY_T Array<float,16>
+#define SCALAR_T float
+#define REGISTER_T __m512
+#define SIZE_TAG SizeTag::SIXTEEN()
+
+static const __m512 abs_mask_16f = _mm512_castsi512_ps(_mm512_set1_epi32(abs_mask_f));
+static const __m512 sign_mask_16f = _mm512_castsi512_ps(_mm512_set1_epi32(int(sign_mask_f)));
+static const __m512 ones_16f = _mm512_set1_ps(1);
+
+FORCEINLINE __m512 set1_p(SizeTag::SIXTEEN, float p) { return _mm512_set1_ps(p); }
+FORCEINLINE __m512 load_p(SizeTag::SIXTEEN, const float* p) { return _mm512_load_ps(p); }
+FORCEINLINE __m512 loadu_p(SizeTag::SIXTEEN, const float* p) { return _mm512_loadu_ps(p); }
+FORCEINLINE void store_p(float* p, __m512 x) { _mm512_store_ps(p,x); }
+FORCEINLINE void storeu_p(float* p, __m512 x) { _mm512_storeu_ps(p,x); }
+FORCEINLINE void stream_p(float* p, __m512 x) { _mm512_stream_ps(p,x); }
+
+FORCEINLINE __m512 add_p(__m512 a, __m512 b) { return _mm512_add_ps(a,b); }
+FORCEINLINE __m512 sub_p(__m512 a, __m512 b) { return _mm512_sub_ps(a,b); }
+FORCEINLINE __m512 mul_p(__m512 a, __m512 b) { return _mm512_mul_ps(a,b); }
+FORCEINLINE __m512 div_p(__m512 a, __m512 b) { return _mm512_div_ps(a,b); }
+FORCEINLINE __m512 max_p(__m512 a, __m512 b) { return _mm512_max_ps(a,b); }
+FORCEINLINE __m512 min_p(__m512 a, __m512 b) { return _mm512_min_ps(a,b); }
+
+template<int opCode>
+FORCEINLINE __m512 cmp_p(__m512 a, __m512 b) {
+  return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(a,b,opCode), _mm512_setzero_ps(), ones_16f);
+}
+FORCEINLINE __m512 eq_p(__m512 a, __m512 b) { return cmp_p<0>(a,b); }
+FORCEINLINE __m512 lt_p(__m512 a, __m512 b) { return cmp_p<1>(a,b); }
+FORCEINLINE __m512 le_p(__m512 a, __m512 b) { return cmp_p<2>(a,b); }
+FORCEINLINE __m512 ne_p(__m512 a, __m512 b) { return cmp_p<4>(a,b); }
+FORCEINLINE __m512 ge_p(__m512 a, __m512 b) { return cmp_p<13>(a,b); }
+FORCEINLINE __m512 gt_p(__m512 a, __m512 b) { return cmp_p<14>(a,b); }
+
+FORCEINLINE __m512 sqrt_p(__m512 x) { return _mm512_sqrt_ps(x); }
+FORCEINLINE __m512 abs_p(__m512 x) { return _mm512_and_ps(x, abs_mask_16f); }
+FORCEINLINE __m512 neg_p(__m512 x) { return _mm512_xor_ps(x, sign_mask_16f); }
+FORCEINLINE __m512 sign_p(__m512 x) { return _mm512_or_ps(ones_16f, _mm512_and_ps(x, sign_mask_16f)); }
+
+#include "special_vectorization.hpp"
+
 #endif // __AVX512F__
 
+#if defined(__ARM_NEON) && defined(__aarch64__)
+/*!
+ * Create specialization for array of 2 doubles (AArch64 NEON, double precision
+ * intrinsics are not available on 32-bit ARM).
+ */
+#define ARRAY_T Array<double,2>
+#define SCALAR_T double
+#define REGISTER_T float64x2_t
+#define SIZE_TAG SizeTag::TWO()
+
+static const uint64x2_t sign_mask_2d_bits = vdupq_n_u64(sign_mask_d);
+static const float64x2_t ones_2d = vdupq_n_f64(1);
+
+FORCEINLINE float64x2_t set1_p(SizeTag::TWO, double p) { return vdupq_n_f64(p); }
+FORCEINLINE float64x2_t load_p(SizeTag::TWO, const double* p) { return vld1q_f64(p); }
+FORCEINLINE float64x2_t loadu_p(SizeTag::TWO, const double* p) { return vld1q_f64(p); }
+FORCEINLINE void store_p(double* p, float64x2_t x) { vst1q_f64(p,x); }
+FORCEINLINE void storeu_p(double* p, float64x2_t x) { vst1q_f64(p,x); }
+FORCEINLINE void stream_p(double* p, float64x2_t x) { vst1q_f64(p,x); }
+
+FORCEINLINE float64x2_t add_p(float64x2_t a, float64x2_t b) { return vaddq_f64(a,b); }
+FORCEINLINE float64x2_t sub_p(float64x2_t a, float64x2_t b) { return vsubq_f64(a,b); }
+FORCEINLINE float64x2_t mul_p(float64x2_t a, float64x2_t b) { return vmulq_f64(a,b); }
+FORCEINLINE float64x2_t div_p(float64x2_t a, float64x2_t b) { return vdivq_f64(a,b); }
+FORCEINLINE float64x2_t max_p(float64x2_t a, float64x2_t b) { return vmaxq_f64(a,b); }
+FORCEINLINE float64x2_t min_p(float64x2_t a, float64x2_t b) { return vminq_f64(a,b); }
+
+/*--- NEON comparisons return bit masks, "and" with 1.0 for the arithmetic result. ---*/
+FORCEINLINE float64x2_t mask_to_p(uint64x2_t mask) {
+  return vreinterpretq_f64_u64(vandq_u64(mask, vreinterpretq_u64_f64(ones_2d)));
+}
+FORCEINLINE float64x2_t eq_p(float64x2_t a, float64x2_t b) { return mask_to_p(vceqq_f64(a,b)); }
+FORCEINLINE float64x2_t lt_p(float64x2_t a, float64x2_t b) { return mask_to_p(vcltq_f64(a,b)); }
+FORCEINLINE float64x2_t le_p(float64x2_t a, float64x2_t b) { return mask_to_p(vcleq_f64(a,b)); }
+FORCEINLINE float64x2_t ge_p(float64x2_t a, float64x2_t b) { return mask_to_p(vcgeq_f64(a,b)); }
+FORCEINLINE float64x2_t gt_p(float64x2_t a, float64x2_t b) { return mask_to_p(vcgtq_f64(a,b)); }
+FORCEINLINE float64x2_t ne_p(float64x2_t a, float64x2_t b) { return vsubq_f64(ones_2d, eq_p(a,b)); }
+
+FORCEINLINE float64x2_t sqrt_p(float64x2_t x) { return vsqrtq_f64(x); }
+FORCEINLINE float64x2_t abs_p(float64x2_t x) { return vabsq_f64(x); }
+FORCEINLINE float64x2_t neg_p(float64x2_t x) { return vnegq_f64(x); }
+FORCEINLINE float64x2_t sign_p(float64x2_t x) {
+  return vreinterpretq_f64_u64(vorrq_u64(vreinterpretq_u64_f64(ones_2d),
+                                         vandq_u64(vreinterpretq_u64_f64(x), sign_mask_2d_bits)));
+}
+
+#include "special_vectorization.hpp"
+
+/*!
+ * Create specialization for array of 4 floats (AArch64 NEON).
+ */
+#define ARRAY_T Array<float,4>
+#define SCALAR_T float
+#define REGISTER_T float32x4_t
+#define SIZE_TAG SizeTag::FOUR()
+
+static const uint32x4_t sign_mask_4f_bits = vdupq_n_u32(sign_mask_f);
+static const float32x4_t ones_4f = vdupq_n_f32(1);
+
+FORCEINLINE float32x4_t set1_p(SizeTag::FOUR, float p) { return vdupq_n_f32(p); }
+FORCEINLINE float32x4_t load_p(SizeTag::FOUR, const float* p) { return vld1q_f32(p); }
+FORCEINLINE float32x4_t loadu_p(SizeTag::FOUR, const float* p) { return vld1q_f32(p); }
+FORCEINLINE void store_p(float* p, float32x4_t x) { vst1q_f32(p,x); }
+FORCEINLINE void storeu_p(float* p, float32x4_t x) { vst1q_f32(p,x); }
+FORCEINLINE void stream_p(float* p, float32x4_t x) { vst1q_f32(p,x); }
+
+FORCEINLINE float32x4_t add_p(float32x4_t a, float32x4_t b) { return vaddq_f32(a,b); }
+FORCEINLINE float32x4_t sub_p(float32x4_t a, float32x4_t b) { return vsubq_f32(a,b); }
+FORCEINLINE float32x4_t mul_p(float32x4_t a, float32x4_t b) { return vmulq_f32(a,b); }
+FORCEINLINE float32x4_t div_p(float32x4_t a, float32x4_t b) { return vdivq_f32(a,b); }
+FORCEINLINE float32x4_t max_p(float32x4_t a, float32x4_t b) { return vmaxq_f32(a,b); }
+FORCEINLINE float32x4_t min_p(float32x4_t a, float32x4_t b) { return vminq_f32(a,b); }
+
+FORCEINLINE float32x4_t mask_to_p(uint32x4_t mask) {
+  return vreinterpretq_f32_u32(vandq_u32(mask, vreinterpretq_u32_f32(ones_4f)));
+}
+FORCEINLINE float32x4_t eq_p(float32x4_t a, float32x4_t b) { return mask_to_p(vceqq_f32(a,b)); }
+FORCEINLINE float32x4_t lt_p(float32x4_t a, float32x4_t b) { return mask_to_p(vcltq_f32(a,b)); }
+FORCEINLINE float32x4_t le_p(float32x4_t a, float32x4_t b) { return mask_to_p(vcleq_f32(a,b)); }
+FORCEINLINE float32x4_t ge_p(float32x4_t a, float32x4_t b) { return mask_to_p(vcgeq_f32(a,b)); }
+FORCEINLINE float32x4_t gt_p(float32x4_t a, float32x4_t b) { return mask_to_p(vcgtq_f32(a,b)); }
+FORCEINLINE float32x4_t ne_p(float32x4_t a, float32x4_t b) { return vsubq_f32(ones_4f, eq_p(a,b)); }
+
+FORCEINLINE float32x4_t sqrt_p(float32x4_t x) { return vsqrtq_f32(x); }
+FORCEINLINE float32x4_t abs_p(float32x4_t x) { return vabsq_f32(x); }
+FORCEINLINE float32x4_t neg_p(float32x4_t x) { return vnegq_f32(x); }
+FORCEINLINE float32x4_t sign_p(float32x4_t x) {
+  return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(ones_4f),
+                                         vandq_u32(vreinterpretq_u32_f32(x), sign_mask_4f_bits)));
+}
+
+#include "special_vectorization.hpp"
+
+#endif // __ARM_NEON && __aarch64__
+
 #undef ARRAY_BOILERPLATE
 
 } // namespace
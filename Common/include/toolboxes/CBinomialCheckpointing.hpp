@@ -0,0 +1,216 @@
+/*!
+ * \file CBinomialCheckpointing.hpp
+ * \brief Binomial (revolve-style) checkpointing schedules for unsteady adjoints.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+/*!
+ * \class CBinomialCheckpointing
+ * \brief Generates the sequence of actions needed to reverse N time steps
+ * while storing at most S primal states (checkpoints) at any time.
+ *
+ * The schedule follows the binomial splitting rule of Griewank and Walther's
+ * "revolve" algorithm, making the number of stored states logarithmic in the
+ * number of time steps at the cost of recomputing primal steps. The driver of
+ * an unsteady adjoint consumes the schedule action by action:
+ *
+ *   CBinomialCheckpointing schedule(nSteps, nCheckpoints);
+ *   CBinomialCheckpointing::Action action;
+ *   while (schedule.Next(action)) {
+ *     switch (action.type) {
+ *       case ActionType::STORE:    // copy the current state into slot action.slot
+ *       case ActionType::RESTORE:  // load the state of step action.step from slot action.slot
+ *       case ActionType::ADVANCE:  // run primal steps [action.step, action.target) without recording
+ *       case ActionType::REVERSE:  // record step action.step and evaluate its adjoint
+ *     }
+ *   }
+ *
+ * REVERSE actions are produced exactly once per step, in descending order, and
+ * the current primal state is always consistent with the step being acted on.
+ */
+class CBinomialCheckpointing {
+ public:
+  /*!
+   * \brief Types of action the consumer of the schedule has to perform.
+   */
+  enum class ActionType {
+    STORE,    /*!< \brief Store the current primal state in a checkpoint slot. */
+    RESTORE,  /*!< \brief Restore the primal state of a step from a checkpoint slot. */
+    ADVANCE,  /*!< \brief Advance the primal from one step to another (no recording). */
+    REVERSE   /*!< \brief Record one primal step and evaluate its adjoint. */
+  };
+
+  /*!
+   * \brief One entry of the schedule.
+   */
+  struct Action {
+    ActionType type;       /*!< \brief What the consumer has to do. */
+    unsigned long step;    /*!< \brief Step the action applies to. */
+    unsigned long target;  /*!< \brief End step of an ADVANCE (exclusive). */
+    int slot;              /*!< \brief Checkpoint slot of a STORE/RESTORE. */
+
+    Action(ActionType type_ = ActionType::REVERSE, unsigned long step_ = 0,
+           unsigned long target_ = 0, int slot_ = 0)
+      : type(type_), step(step_), target(target_), slot(slot_) {}
+  };
+
+  /*!
+   * \brief Construct the schedule for a given horizon and memory budget.
+   * \param[in] nSteps - Number of time steps to reverse.
+   * \param[in] nCheckpoints - Maximum number of states stored at any time (>= 1).
+   */
+  CBinomialCheckpointing(unsigned long nSteps, int nCheckpoints) {
+    assert(nCheckpoints >= 1 && "at least one checkpoint slot is required");
+    for (int i = nCheckpoints - 1; i >= 0; --i) freeSlots.push_back(i);
+
+    if (nSteps == 0) return;
+
+    /*--- The driver starts at step 0, store it and reverse the whole range. ---*/
+    const int slot = AcquireSlot();
+    Emit({ActionType::STORE, 0, 0, slot});
+    Reverse(0, nSteps, slot);
+    ReleaseSlot(slot);
+  }
+
+  /*!
+   * \brief Get the next action of the schedule.
+   * \param[out] action - The action to perform.
+   * \return True while the schedule is not exhausted.
+   */
+  bool Next(Action& action) {
+    if (position == schedule.size()) return false;
+    action = schedule[position++];
+    return true;
+  }
+
+  /*!
+   * \brief Restart the schedule from the beginning.
+   */
+  void Reset() { position = 0; }
+
+  /*!
+   * \brief Total number of primal step evaluations (advances and recordings)
+   * the schedule performs, to report the recomputation overhead.
+   */
+  unsigned long GetnPrimalSteps() const {
+    unsigned long n = 0;
+    for (const auto& action : schedule) {
+      if (action.type == ActionType::ADVANCE) n += action.target - action.step;
+      if (action.type == ActionType::REVERSE) n += 1;
+    }
+    return n;
+  }
+
+ private:
+  std::vector<Action> schedule;
+  std::vector<int> freeSlots;
+  unsigned long current = 0;  /*!< \brief Primal step the state corresponds to while generating. */
+  size_t position = 0;
+
+  int AcquireSlot() {
+    assert(!freeSlots.empty());
+    const int slot = freeSlots.back();
+    freeSlots.pop_back();
+    return slot;
+  }
+
+  void ReleaseSlot(int slot) { freeSlots.push_back(slot); }
+
+  void Emit(Action action) {
+    if (action.type == ActionType::RESTORE || action.type == ActionType::STORE) current = action.step;
+    if (action.type == ActionType::ADVANCE) current = action.target;
+    /*--- Recording a step leaves the primal at the next step. ---*/
+    if (action.type == ActionType::REVERSE) current = action.step + 1;
+    schedule.push_back(action);
+  }
+
+  void RestoreIfNeeded(unsigned long lo, int slot) {
+    if (current != lo) Emit({ActionType::RESTORE, lo, 0, slot});
+  }
+
+  /*!
+   * \brief Distance from the start of an interval of length "length" to its next
+   * checkpoint, given "snaps" usable slots (the free ones plus the one holding the
+   * start of the interval): binomial(snaps + t - 1, snaps) with t the smallest
+   * number of sweeps for which binomial(snaps + t, snaps) covers the interval.
+   */
+  static unsigned long NextCheckpointDistance(unsigned long length, unsigned long snaps) {
+    unsigned long t = 1, cover = snaps + 1, dist = 1;
+    while (cover < length) {
+      ++t;
+      dist = cover;
+      /*--- binomial(snaps+t, snaps) from binomial(snaps+t-1, snaps). ---*/
+      cover = cover * (snaps + t) / t;
+    }
+    if (dist > length - 1) dist = length - 1;
+    if (dist < 1) dist = 1;
+    return dist;
+  }
+
+  /*!
+   * \brief Emit the actions that reverse steps [lo, hi), the state of step lo
+   * being stored in checkpoint slot "slotOfLo".
+   */
+  void Reverse(unsigned long lo, unsigned long hi, int slotOfLo) {
+    if (hi == lo) return;
+
+    if (hi - lo == 1) {
+      RestoreIfNeeded(lo, slotOfLo);
+      Emit({ActionType::REVERSE, lo, 0, 0});
+      return;
+    }
+
+    if (freeSlots.empty()) {
+      /*--- No slot left for an intermediate checkpoint, re-advance from lo
+       for every remaining step (quadratic fallback, only reached when the
+       number of slots is very small compared to the horizon). ---*/
+      for (auto step = hi; step > lo; --step) {
+        RestoreIfNeeded(lo, slotOfLo);
+        if (step - 1 > lo) Emit({ActionType::ADVANCE, lo, step - 1, 0});
+        Emit({ActionType::REVERSE, step - 1, 0, 0});
+      }
+      return;
+    }
+
+    /*--- Place the next checkpoint according to the binomial rule (the slot of
+     lo is usable too, it serves as the base of the left sub-range), then
+     reverse the two sub-ranges, right first. ---*/
+    const auto mid = lo + NextCheckpointDistance(hi - lo, freeSlots.size() + 1);
+
+    RestoreIfNeeded(lo, slotOfLo);
+    Emit({ActionType::ADVANCE, lo, mid, 0});
+    const int slot = AcquireSlot();
+    Emit({ActionType::STORE, mid, 0, slot});
+
+    Reverse(mid, hi, slot);
+    ReleaseSlot(slot);
+
+    Reverse(lo, mid, slotOfLo);
+  }
+};
@@ -40,6 +40,10 @@
 
 #include <cassert>
 
+#ifdef HAVE_CUDA
+#include <cuda_runtime.h>
+#endif
+
 namespace MemoryAllocation
 {
 
@@ -99,5 +103,96 @@ inline void aligned_free(T* ptr) noexcept
 #endif
 }
 
+/*!
+ * \enum AllocPolicy
+ * \brief Memory space of an allocation, to support incremental device porting.
+ * Non-host policies fall back to plain aligned host allocation when CUDA
+ * support is not compiled in.
+ */
+enum class AllocPolicy { HOST, PINNED, MANAGED };
+
+/*!
+ * \brief Allocate memory in the space requested by the policy.
+ * \note The CUDA allocators guarantee at least 256-byte alignment, which
+ * covers every alignment the containers request.
+ * \param[in] policy, memory space of the allocation.
+ * \param[in] alignment, in bytes, of the memory being allocated.
+ * \param[in] size, also in bytes.
+ * \tparam ZeroInit, initialize memory to 0.
+ * \return Pointer to memory, always use policy_free to deallocate.
+ */
+template<class T, bool ZeroInit = false>
+inline T* policy_alloc(AllocPolicy policy, size_t alignment, size_t size) noexcept
+{
+#ifdef HAVE_CUDA
+  if (policy != AllocPolicy::HOST)
+  {
+    void* ptr = nullptr;
+    if (policy == AllocPolicy::PINNED)
+      cudaMallocHost(&ptr, size);
+    else
+      cudaMallocManaged(&ptr, size);
+    if (ZeroInit && ptr) memset(ptr, 0, size);
+    return static_cast<T*>(ptr);
+  }
+#endif
+  (void)policy;
+  return aligned_alloc<T,ZeroInit>(alignment, size);
+}
+
+/*!
+ * \brief Free memory allocated with policy_alloc, with the same policy.
+ * \param[in] policy, memory space of the allocation.
+ * \param[in] ptr, pointer to memory we want to release.
+ */
+template<class T>
+inline void policy_free(AllocPolicy policy, T* ptr) noexcept
+{
+#ifdef HAVE_CUDA
+  if (policy != AllocPolicy::HOST)
+  {
+    if (policy == AllocPolicy::PINNED)
+      cudaFreeHost(ptr);
+    else
+      cudaFree(ptr);
+    return;
+  }
+#endif
+  (void)policy;
+  aligned_free<T>(ptr);
+}
+
+/*!
+ * \brief Hint that managed memory is about to be accessed on the device,
+ * no-op without CUDA support.
+ * \param[in] ptr, start of the range to migrate.
+ * \param[in] size, of the range in bytes.
+ */
+inline void prefetch_to_device(const void* ptr, size_t size) noexcept
+{
+#ifdef HAVE_CUDA
+  int device = 0;
+  cudaGetDevice(&device);
+  cudaMemPrefetchAsync(ptr, size, device, nullptr);
+#else
+  (void)ptr; (void)size;
+#endif
+}
+
+/*!
+ * \brief Hint that managed memory is about to be accessed on the host,
+ * no-op without CUDA support.
+ * \param[in] ptr, start of the range to migrate.
+ * \param[in] size, of the range in bytes.
+ */
+inline void prefetch_to_host(const void* ptr, size_t size) noexcept
+{
+#ifdef HAVE_CUDA
+  cudaMemPrefetchAsync(ptr, size, cudaCpuDeviceId, nullptr);
+#else
+  (void)ptr; (void)size;
+#endif
+}
+
 } // namespace
 
@@ -0,0 +1,147 @@
+/*!
+ * \file memory_footprint.hpp
+ * \brief Registry of the major allocations of the code, reported per
+ *        category at the end of preprocessing for job-sizing purposes.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+
+#include "../parallelization/mpi_structure.hpp"
+#include "../option_structure.hpp"
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+namespace MemoryFootprint {
+
+/*!
+ * \brief Categories of the registry, a fixed enumeration keeps the MPI
+ *        reductions of the report valid when ranks do not register identically
+ *        (e.g. ranks without points skip some allocations entirely).
+ */
+enum Category : unsigned short {
+  SPARSE_MATRICES = 0, /*!< \brief Jacobians, ILU factors, and block-diagonal preconditioners. */
+  LINEAR_VECTORS,      /*!< \brief Residual, solution, and Krylov-subspace vectors. */
+  SOLUTION_VARIABLES,  /*!< \brief Fields stored by the CVariable classes. */
+  GRID_GEOMETRY,       /*!< \brief Estimate of the dual-grid data (points, edges, elements). */
+  N_CATEGORIES
+};
+
+inline const char* CategoryName(unsigned short category) {
+  switch (category) {
+    case SPARSE_MATRICES: return "Sparse matrices";
+    case LINEAR_VECTORS: return "Linear-system vectors";
+    case SOLUTION_VARIABLES: return "Solution variables";
+    case GRID_GEOMETRY: return "Grid geometry (estimate)";
+  }
+  return "";
+}
+
+/*!
+ * \brief Per-rank byte counts of the registered allocations.
+ */
+inline long* GetRegistry() {
+  static long bytes[N_CATEGORIES] = {0};
+  return bytes;
+}
+
+/*!
+ * \brief Accumulate the size of an allocation (negative to account for a
+ *        deallocation), cheap enough to be left in release builds (the hooks
+ *        run during setup, not per iteration).
+ */
+inline void Register(Category category, long bytes) {
+  GetRegistry()[category] += bytes;
+}
+
+/*!
+ * \brief Print a per-category summary of the registered allocations, plus the
+ *        peak resident set size of the process where the OS reports it.
+ *        The bytes-per-point column allows extrapolating the footprint of a
+ *        large case from a small run of the same configuration.
+ */
+inline void Report(unsigned long globalPoints) {
+  const su2double MB = 1024.0 * 1024.0;
+
+  long localBytes[N_CATEGORIES + 1] = {0};
+  for (auto i = 0u; i < N_CATEGORIES; ++i) {
+    localBytes[i] = GetRegistry()[i];
+    localBytes[N_CATEGORIES] += GetRegistry()[i];
+  }
+
+#if !defined(_WIN32)
+  /*--- ru_maxrss is reported in kilobytes on Linux. ---*/
+  rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  const long localRSS = usage.ru_maxrss * 1024l;
+#else
+  const long localRSS = 0;
+#endif
+
+  long sumBytes[N_CATEGORIES + 1], maxBytes[N_CATEGORIES + 1];
+  long sumRSS, maxRSS;
+  SU2_MPI::Allreduce(localBytes, sumBytes, N_CATEGORIES + 1, MPI_LONG, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(localBytes, maxBytes, N_CATEGORIES + 1, MPI_LONG, MPI_MAX, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(&localRSS, &sumRSS, 1, MPI_LONG, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(&localRSS, &maxRSS, 1, MPI_LONG, MPI_MAX, SU2_MPI::GetComm());
+
+  if (SU2_MPI::GetRank() != MASTER_NODE) return;
+
+  std::cout << "\n------------------------- Memory Footprint Summary ----------------------" << std::endl;
+  std::cout << std::setw(28) << std::left << "Category" << std::right
+            << std::setw(16) << "Max/rank (MB)"
+            << std::setw(14) << "Total (MB)"
+            << std::setw(14) << "Bytes/point" << std::endl;
+
+  for (auto i = 0u; i <= N_CATEGORIES; ++i) {
+    std::cout << std::setw(28) << std::left << (i < N_CATEGORIES ? CategoryName(i) : "Registered total")
+              << std::right << std::fixed << std::setprecision(1)
+              << std::setw(16) << maxBytes[i] / MB
+              << std::setw(14) << sumBytes[i] / MB
+              << std::setw(14) << std::setprecision(0)
+              << su2double(sumBytes[i]) / std::max(globalPoints, 1ul) << std::endl;
+  }
+  if (maxRSS > 0) {
+    std::cout << std::setw(28) << std::left << "Peak resident set size"
+              << std::right << std::fixed << std::setprecision(1)
+              << std::setw(16) << maxRSS / MB
+              << std::setw(14) << sumRSS / MB
+              << std::setw(14) << std::setprecision(0)
+              << su2double(sumRSS) / std::max(globalPoints, 1ul) << std::endl;
+  }
+  std::cout << "Registered categories cover the major containers only, the resident set\n"
+               "size is the authoritative per-rank total (it includes code and buffers)."
+            << std::endl;
+  std::cout << "--------------------------------------------------------------------------\n" << std::endl;
+
+  std::cout.unsetf(std::ios::fixed);
+  std::cout.precision(6);
+}
+
+}  // namespace MemoryFootprint
@@ -0,0 +1,230 @@
+/*!
+ * \file profiling_toolbox.hpp
+ * \brief Lightweight scoped timers for the main kernels of the code.
+ * \note  Compiled in only when the PROFILE preprocessor symbol is defined,
+ *        like the gemm profiling of CConfig, otherwise the macros at the
+ *        bottom of this file expand to nothing.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../parallelization/mpi_structure.hpp"
+#include "../parallelization/omp_structure.hpp"
+
+#ifdef PROFILE
+
+#include "../option_structure.hpp"
+
+#include <atomic>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace KernelProfiling {
+
+/*!
+ * \brief Accumulated statistics of one named kernel on this rank.
+ */
+struct CKernelStats {
+  unsigned long nCalls = 0;
+  double totTime = 0.0;
+  double minTime = std::numeric_limits<double>::max();
+  double maxTime = 0.0;
+};
+
+/*!
+ * \brief Per-rank registry of kernel statistics, keyed (and thus reported) by name.
+ */
+inline std::map<std::string, CKernelStats>& GetRegistry() {
+  static std::map<std::string, CKernelStats> registry;
+  return registry;
+}
+
+/*!
+ * \brief Add one timing sample to a kernel, only the master thread records samples
+ * (the wall time it observes spans the work of the entire team).
+ */
+inline void AddSample(const char* name, double elapsed) {
+  auto& stats = GetRegistry()[name];
+  stats.nCalls += 1;
+  stats.totTime += elapsed;
+  stats.minTime = std::min(stats.minTime, elapsed);
+  stats.maxTime = std::max(stats.maxTime, elapsed);
+}
+
+/*!
+ * \brief RAII timer, times the enclosing scope and adds the sample on destruction.
+ * \note Safe to use inside OpenMP parallel regions, only thread 0 is active.
+ */
+class CScopedTimer {
+  const char* name;
+  double startTime = 0.0;
+  bool active;
+public:
+  CScopedTimer(const char* kernelName) : name(kernelName), active(omp_get_thread_num() == 0) {
+    if (active) startTime = SU2_MPI::Wtime();
+  }
+  ~CScopedTimer() {
+    if (active) AddSample(name, SU2_MPI::Wtime() - startTime);
+  }
+};
+
+/*!
+ * \brief Heap allocation audit. The global operator new overrides in
+ * profiling_toolbox.cpp bump these counters while "counting" is set, which a
+ * CScopedAudit does for its lifetime. Used to verify that performance-critical
+ * sections (e.g. the AD recording of an adjoint iteration) are allocation-free,
+ * hidden allocations there (temporaries, container growth) cost far more than
+ * the bytes involved.
+ */
+namespace AllocationAudit {
+
+extern std::atomic<unsigned long> nAllocations;
+extern std::atomic<unsigned long> nBytes;
+extern std::atomic<bool> counting;
+
+/*!
+ * \brief RAII audit of one named section, reports the number of heap
+ * allocations observed in the scope on destruction (master rank).
+ * \note Allocations of all threads are counted, but only thread 0 may
+ * open and close the scope. Scopes do not nest.
+ */
+class CScopedAudit {
+  const char* name;
+  unsigned long startAllocs = 0, startBytes = 0;
+  bool active;
+public:
+  CScopedAudit(const char* sectionName) : name(sectionName), active(omp_get_thread_num() == 0) {
+    if (active) {
+      startAllocs = nAllocations.load(std::memory_order_relaxed);
+      startBytes = nBytes.load(std::memory_order_relaxed);
+      counting.store(true, std::memory_order_relaxed);
+    }
+  }
+  ~CScopedAudit() {
+    if (!active) return;
+    counting.store(false, std::memory_order_relaxed);
+    const auto allocs = nAllocations.load(std::memory_order_relaxed) - startAllocs;
+    const auto bytes = nBytes.load(std::memory_order_relaxed) - startBytes;
+    if (SU2_MPI::GetRank() == MASTER_NODE)
+      std::cout << "Allocation audit [" << name << "]: " << allocs
+                << " heap allocations (" << bytes << " bytes)." << std::endl;
+  }
+};
+
+}
+
+/*!
+ * \brief Reduce the statistics over MPI and write them to a JSON file (master rank).
+ * \note The kernel list of the master rank defines what is reported, kernels only
+ * executed on other ranks are ignored. Call outside of parallel regions.
+ */
+inline void Report(const std::string& fileName) {
+
+  const int size = SU2_MPI::GetSize();
+  const bool master = (SU2_MPI::GetRank() == MASTER_NODE);
+
+  /*--- Broadcast the kernel names of the master so all ranks reduce in the same order. ---*/
+
+  std::string nameBuf;
+  if (master)
+    for (const auto& kernel : GetRegistry()) nameBuf += kernel.first + '\n';
+
+  unsigned long bufSize = nameBuf.size();
+  SU2_MPI::Bcast(&bufSize, 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+  nameBuf.resize(bufSize);
+  SU2_MPI::Bcast(&nameBuf[0], bufSize, MPI_CHAR, MASTER_NODE, SU2_MPI::GetComm());
+
+  std::vector<std::string> names;
+  for (size_t pos = 0; pos < nameBuf.size();) {
+    const auto next = nameBuf.find('\n', pos);
+    names.push_back(nameBuf.substr(pos, next-pos));
+    pos = next+1;
+  }
+
+  std::ofstream file;
+  if (master) {
+    file.open(fileName);
+    file << "{\n  \"ranks\": " << size << ",\n  \"kernels\": [";
+  }
+
+  bool firstKernel = true;
+  for (const auto& name : names) {
+
+    /*--- Ranks that never executed the kernel contribute neutral values. ---*/
+
+    CKernelStats local;
+    const auto it = GetRegistry().find(name);
+    if (it != GetRegistry().end()) local = it->second;
+
+    double totMin = 0.0, totSum = 0.0, totMax = 0.0, callMin = 0.0, callMax = 0.0;
+    unsigned long nCalls = 0;
+    SU2_MPI::Reduce(&local.totTime, &totMin, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, SU2_MPI::GetComm());
+    SU2_MPI::Reduce(&local.totTime, &totSum, 1, MPI_DOUBLE, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
+    SU2_MPI::Reduce(&local.totTime, &totMax, 1, MPI_DOUBLE, MPI_MAX, MASTER_NODE, SU2_MPI::GetComm());
+    SU2_MPI::Reduce(&local.minTime, &callMin, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, SU2_MPI::GetComm());
+    SU2_MPI::Reduce(&local.maxTime, &callMax, 1, MPI_DOUBLE, MPI_MAX, MASTER_NODE, SU2_MPI::GetComm());
+    SU2_MPI::Reduce(&local.nCalls, &nCalls, 1, MPI_UNSIGNED_LONG, MPI_MAX, MASTER_NODE, SU2_MPI::GetComm());
+
+    if (master) {
+      file << (firstKernel? "\n" : ",\n");
+      file << "    {\"name\": \"" << name << "\", \"calls\": " << nCalls
+           << ", \"total_time\": {\"min\": " << totMin << ", \"mean\": " << totSum/size
+           << ", \"max\": " << totMax << "}"
+           << ", \"per_call_time\": {\"min\": " << callMin << ", \"max\": " << callMax << "}}";
+      firstKernel = false;
+    }
+  }
+
+  if (master) {
+    file << "\n  ]\n}\n";
+    std::cout << "Kernel profiling statistics written to " << fileName << "." << std::endl;
+  }
+}
+
+}
+
+#define SU2_PROFILE_CONCAT_IMPL(a,b) a##b
+#define SU2_PROFILE_CONCAT(a,b) SU2_PROFILE_CONCAT_IMPL(a,b)
+
+/*--- Time the enclosing scope under the given kernel name (a string literal). ---*/
+#define SU2_PROFILE_SCOPE(name) KernelProfiling::CScopedTimer SU2_PROFILE_CONCAT(profScope_,__LINE__)(name)
+
+/*--- Reduce and dump the statistics, call once near the end of the run. ---*/
+#define SU2_PROFILE_REPORT(file) KernelProfiling::Report(file)
+
+/*--- Count and report the heap allocations of the enclosing scope. ---*/
+#define SU2_ALLOC_AUDIT_SCOPE(name) \
+  KernelProfiling::AllocationAudit::CScopedAudit SU2_PROFILE_CONCAT(allocAudit_,__LINE__)(name)
+
+#else
+
+#define SU2_PROFILE_SCOPE(name)
+#define SU2_PROFILE_REPORT(file)
+#define SU2_ALLOC_AUDIT_SCOPE(name)
+
+#endif
@@ -90,12 +90,50 @@ public:
                                           su2double       &qWall,
                                           su2double       &ViscosityWall,
                                           su2double       &kOverCvWall);
+
+  /*!
+   * \brief Virtual function, which computes the wall shear stress and heat flux
+            for a batch of exchange points, typically all integration points of
+            a boundary face. The default implementation simply loops over the
+            points and calls the scalar version; derived classes may override it
+            to share the convergence loop between the points.
+   * \param[in]  nPoints                - Number of exchange points in the batch.
+   * \param[in]  tExchange              - Temperatures at the exchange locations.
+   * \param[in]  velExchange            - Velocities at the exchange locations.
+   * \param[in]  muExchange             - Laminar viscosities at the exchange locations.
+   * \param[in]  pExchange              - Pressures at the exchange locations.
+   * \param[in]  Wall_HeatFlux          - Value of the wall heat flux, if prescribed.
+   * \param[in]  HeatFlux_Prescribed    - Whether or not the wall heat flux is prescribed.
+   * \param[in]  Wall_Temperature       - Value of the wall temperature, if prescribed.
+   * \param[in]  Temperature_Prescribed - Whether or not the wall temperature is prescribed.
+   * \param[in]  FluidModel             - Fluid model used in the solver.
+   * \param[out] tauWall                - Wall shear stresses, to be computed.
+   * \param[out] qWall                  - Wall heat fluxes, to be computed (if not prescribed).
+   * \param[out] ViscosityWall          - Laminar viscosities at the wall, to be computed.
+   * \param[out] kOverCvWall            - Thermal conductivities divided by Cv at the wall,
+                                          to be computed.
+   */
+  virtual void WallShearStressAndHeatFlux(const unsigned long nPoints,
+                                          const su2double *tExchange,
+                                          const su2double *velExchange,
+                                          const su2double *muExchange,
+                                          const su2double *pExchange,
+                                          const su2double Wall_HeatFlux,
+                                          const bool      HeatFlux_Prescribed,
+                                          const su2double Wall_Temperature,
+                                          const bool      Temperature_Prescribed,
+                                          CFluidModel     *FluidModel,
+                                          su2double       *tauWall,
+                                          su2double       *qWall,
+                                          su2double       *ViscosityWall,
+                                          su2double       *kOverCvWall);
 protected:
 
   su2double h_wm;    /*!< \brief The thickness of the wall model. This is also basically the exchange location */
   su2double Pr_lam;  /*!< \brief Laminar Prandtl number. */
   su2double Pr_turb; /*!< \brief Turbulent Prandtl number. */
   su2double karman;  /*!< \brief von Karman constant. */
+  su2double tol;     /*!< \brief Convergence tolerance of the iterative procedure of the wall model. */
 
 private:
   /*!
@@ -149,6 +187,43 @@ public:
                                   su2double       &ViscosityWall,
                                   su2double       &kOverCvWall) override;
 
+  /*!
+   * \brief Function, which computes the wall shear stress and heat flux for a
+            batch of exchange points. The points share one convergence loop,
+            such that the iteration control and the workspace of the tridiagonal
+            solves are amortized over the batch. Points that have converged are
+            removed from the active set, only the remaining ones are iterated.
+   * \param[in]  nPoints                - Number of exchange points in the batch.
+   * \param[in]  tExchange              - Temperatures at the exchange locations.
+   * \param[in]  velExchange            - Velocities at the exchange locations.
+   * \param[in]  muExchange             - Laminar viscosities at the exchange locations.
+   * \param[in]  pExchange              - Pressures at the exchange locations.
+   * \param[in]  Wall_HeatFlux          - Value of the wall heat flux, if prescribed.
+   * \param[in]  HeatFlux_Prescribed    - Whether or not the wall heat flux is prescribed.
+   * \param[in]  Wall_Temperature       - Value of the wall temperature, if prescribed.
+   * \param[in]  Temperature_Prescribed - Whether or not the wall temperature is prescribed.
+   * \param[in]  FluidModel             - Fluid model used in the solver.
+   * \param[out] tauWall                - Wall shear stresses, to be computed.
+   * \param[out] qWall                  - Wall heat fluxes, to be computed (if not prescribed).
+   * \param[out] ViscosityWall          - Laminar viscosities at the wall, to be computed.
+   * \param[out] kOverCvWall            - Thermal conductivities divided by Cv at the wall,
+                                          to be computed.
+   */
+  void WallShearStressAndHeatFlux(const unsigned long nPoints,
+                                  const su2double *tExchange,
+                                  const su2double *velExchange,
+                                  const su2double *muExchange,
+                                  const su2double *pExchange,
+                                  const su2double Wall_HeatFlux,
+                                  const bool      HeatFlux_Prescribed,
+                                  const su2double Wall_Temperature,
+                                  const bool      Temperature_Prescribed,
+                                  CFluidModel     *FluidModel,
+                                  su2double       *tauWall,
+                                  su2double       *qWall,
+                                  su2double       *ViscosityWall,
+                                  su2double       *kOverCvWall) override;
+
 private:
 
   su2double expansionRatio;   /*!< \brief  Stretching factor used for the wall model grid. */
@@ -212,6 +287,18 @@ private:
 
   su2double C;  /*!< \brief Constant to match the Reichardt BL profile. */
 
+  vector<su2double> logRePlusTable; /*!< \brief Precomputed values of log(y+ u+(y+)) of the Reichardt profile,
+                                                used as a lookup table to obtain the friction velocity. */
+  vector<su2double> logYPlusTable;  /*!< \brief Values of log(y+) corresponding to logRePlusTable. */
+
+  /*!
+   * \brief Function, which computes u+ of the Reichardt boundary layer
+            analytical law for the given value of y+.
+   * \param[in] y_plus - Non-dimensional wall distance.
+   * \return    The value of u+ according to the Reichardt profile.
+   */
+  su2double ReichardtUPlus(const su2double y_plus) const;
+
   /*!
    * \brief Default constructor of the class, disabled.
    */
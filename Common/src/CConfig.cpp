@@ -1078,6 +1078,13 @@ void CConfig::SetConfig_Options() {
   addBoolOption("MULTIZONE", Multizone_Problem, NO);
   /*!\brief PHYSICAL_PROBLEM \n DESCRIPTION: Physical governing equations \n Options: see \link Solver_Map \endlink \n DEFAULT: NO_SOLVER \ingroup Config*/
   addEnumOption("MULTIZONE_SOLVER", Kind_MZSolver, Multizone_Map, ENUM_MULTIZONE::MZ_BLOCK_GAUSS_SEIDEL);
+  /*!\brief MULTIZONE_FREEZE_CONVERGED \n DESCRIPTION: Skip the inner solve of zones that reached their convergence
+   *  criteria while the zones they receive data from are also frozen (load balancing for many-zone cases). \ingroup Config*/
+  addBoolOption("MULTIZONE_FREEZE_CONVERGED", Multizone_Freeze_Converged, NO);
+  /*!\brief MULTIZONE_ADAPT_INNER_ITER \n DESCRIPTION: Adapt the inner-iteration budget of each zone between outer
+   *  iterations based on the contraction of its coupling (BGS) residuals, avoiding over-solving of zones whose
+   *  interface data changes by less than the coupling tolerance. \ingroup Config*/
+  addBoolOption("MULTIZONE_ADAPT_INNER_ITER", Multizone_Adapt_InnerIter, NO);
 #ifdef CODI_REVERSE_TYPE
   const bool discAdjDefault = true;
 #else
@@ -1119,6 +1126,13 @@ void CConfig::SetConfig_Options() {
   body_force[0] = 0.0; body_force[1] = 0.0; body_force[2] = 0.0;
   /* DESCRIPTION: Vector of body force values (BodyForce_X, BodyForce_Y, BodyForce_Z) */
   addDoubleArrayOption("BODY_FORCE_VECTOR", 3, body_force);
+  /* DESCRIPTION: Apply a sponge layer damping source term inside a bounding box (NO, YES) */
+  addBoolOption("SPONGE_LAYER", Sponge_Layer, false);
+  for (unsigned short iDim = 0; iDim < 6; iDim++) sponge_layer_box[iDim] = 0.0;
+  /* DESCRIPTION: Bounding box of the sponge layer support (Xmin, Ymin, Zmin, Xmax, Ymax, Zmax) */
+  addDoubleArrayOption("SPONGE_LAYER_BOX", 6, sponge_layer_box);
+  /* DESCRIPTION: Damping coefficient of the sponge layer source term */
+  addDoubleOption("SPONGE_LAYER_COEFF", Sponge_Layer_Coeff, 1.0);
 
   /* DESCRIPTION: Apply a body force as a source term for periodic boundary conditions \n Options: NONE, PRESSURE_DROP, MASSFLOW \n DEFAULT: NONE \ingroup Config */
   addEnumOption("KIND_STREAMWISE_PERIODIC", Kind_Streamwise_Periodic, Streamwise_Periodic_Map, ENUM_STREAMWISE_PERIODIC::NONE);
@@ -1135,6 +1149,18 @@ void CConfig::SetConfig_Options() {
   addBoolOption("RESTART_SOL", Restart, false);
   /*!\brief BINARY_RESTART \n DESCRIPTION: Read binary SU2 native restart files. \n Options: YES, NO \ingroup Config */
   addBoolOption("READ_BINARY_RESTART", Read_Binary_Restart, true);
+  /*!\brief WRT_RESTART_SINGLE \n DESCRIPTION: Write the data of binary SU2 native restart files in single
+   precision, halving their size and write volume (restarting is then not bit-exact). Files of either
+   precision are read transparently. \n Options: NO, YES \ingroup Config */
+  addBoolOption("WRT_RESTART_SINGLE", Wrt_Restart_Single, false);
+  /*!\brief WRT_RESTART_DELTA \n DESCRIPTION: Delta-encode binary SU2 native restart files: in between
+   periodic full restarts (keyframes) only the sparse differences w.r.t. the last keyframe are written,
+   cutting the checkpoint volume of slowly evolving unsteady runs. Restarting from a delta file reads
+   the keyframe it references plus the single delta. \n Options: NO, YES \ingroup Config */
+  addBoolOption("WRT_RESTART_DELTA", Wrt_Restart_Delta, false);
+  /*!\brief RESTART_KEYFRAME_INTERVAL \n DESCRIPTION: Number of restart writes after which
+   WRT_RESTART_DELTA writes a new full restart (keyframe). \n DEFAULT: 10 \ingroup Config */
+  addUnsignedShortOption("RESTART_KEYFRAME_INTERVAL", Restart_Keyframe_Interval, 10);
   /*!\brief SYSTEM_MEASUREMENTS \n DESCRIPTION: System of measurements \n OPTIONS: see \link Measurements_Map \endlink \n DEFAULT: SI \ingroup Config*/
   addEnumOption("SYSTEM_MEASUREMENTS", SystemMeasurements, Measurements_Map, SI);
 
@@ -1191,6 +1217,17 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Critical Density, default value for MDM */
    addDoubleOption("ACENTRIC_FACTOR", Acentric_Factor, 0.035);
 
+  /*--- Options related to the tabulated evaluation of the fluid model ---*/
+
+  /* DESCRIPTION: Evaluate the fluid model through a structured (rho, e) table sampled at startup */
+  addBoolOption("TABULATED_FLUID_MODEL", Tabulated_FluidModel, false);
+  /* DESCRIPTION: Number of table nodes per direction of the tabulated fluid model */
+  addUnsignedShortOption("TABULATED_FLUID_MODEL_POINTS", nTabulated_Points, 256);
+  /* DESCRIPTION: Density range (min, max) covered by the tabulated fluid model */
+  addDoubleArrayOption("TABULATED_FLUID_MODEL_RHO_LIMITS", 2, Tabulated_Rho_Limits);
+  /* DESCRIPTION: Static energy range (min, max) covered by the tabulated fluid model */
+  addDoubleArrayOption("TABULATED_FLUID_MODEL_ENERGY_LIMITS", 2, Tabulated_Energy_Limits);
+
    /*--- Options related to Viscosity Model ---*/
   /*!\brief VISCOSITY_MODEL \n DESCRIPTION: model of the viscosity \n OPTIONS: See \link ViscosityModel_Map \endlink \n DEFAULT: SUTHERLAND \ingroup Config*/
   addEnumOption("VISCOSITY_MODEL", Kind_ViscosityModel, ViscosityModel_Map, VISCOSITYMODEL::SUTHERLAND);
@@ -1251,6 +1288,8 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("WALLMODEL_MINYPLUS", wallModel_MinYplus, 5.0);
   /*!\brief WALLMODEL_B \n DESCRIPTION: constant B used for the wall model \n DEFAULT 5.5 \ingroup Config*/
   addDoubleOption("WALLMODEL_B", wallModel_B, 5.5);
+  /*!\brief WALLMODEL_TOL \n DESCRIPTION: convergence tolerance for the iterative LES wall models \n DEFAULT 1e-3 \ingroup Config*/
+  addDoubleOption("WALLMODEL_TOL", wallModel_Tol, 1e-3);
 
   /*!\brief BULK_MODULUS \n DESCRIPTION: Value of the Bulk Modulus  \n DEFAULT 1.42E5 \ingroup Config*/
   addDoubleOption("BULK_MODULUS", Bulk_Modulus, 1.42E5);
@@ -1323,6 +1362,8 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("SIDESLIP_ANGLE", AoS, 0.0);
   /*!\brief AOA  \n DESCRIPTION: Angle of attack (degrees, only for compressible flows) \ingroup Config*/
   addDoubleOption("AOA", AoA, 0.0);
+  /*!\brief AOA_SWEEP \n DESCRIPTION: List of angles of attack (degrees) visited by in-place continuation after the base angle converges, the solution is retained between angles (steady compressible flows only) \ingroup Config*/
+  addDoubleListOption("AOA_SWEEP", nAoA_Sweep, AoA_Sweep);
   /* DESCRIPTION: Activate fixed CL mode (specify a CL instead of AoA). */
   addBoolOption("FIXED_CL_MODE", Fixed_CL_Mode, false);
   /* DESCRIPTION: Activate fixed CM mode (specify a CM instead of iH). */
@@ -1455,6 +1496,18 @@ void CConfig::SetConfig_Options() {
    * this tolerance will be used to match the coordinates in the input file to
    * the points on the grid. \n DEFAULT: 1E-6 \ingroup Config*/
   addDoubleOption("INLET_MATCHING_TOLERANCE", Inlet_Matching_Tol, 1e-6);
+  /*!\brief INLET_SEM_INTENSITY \n DESCRIPTION: Turbulence intensity of the synthetic eddy inflow generator,
+   relative to the local inlet velocity. A positive value superposes synthetic fluctuations, generated
+   in memory each time step, on all inlet markers (no profile file I/O). \n DEFAULT: 0.0 (disabled) \ingroup Config*/
+  addDoubleOption("INLET_SEM_INTENSITY", SEM_Intensity, 0.0);
+  /*!\brief INLET_SEM_LENGTH_SCALE \n DESCRIPTION: Eddy length scale of the synthetic eddy inflow,
+   in mesh units. \n DEFAULT: 0.0 \ingroup Config*/
+  addDoubleOption("INLET_SEM_LENGTH_SCALE", SEM_LengthScale, 0.0);
+  /*!\brief INLET_SEM_NEDDY \n DESCRIPTION: Number of synthetic eddies per inlet marker. \n DEFAULT: 200 \ingroup Config*/
+  addUnsignedLongOption("INLET_SEM_NEDDY", SEM_nEddy, 200);
+  /*!\brief INLET_SEM_SEED \n DESCRIPTION: Random seed of the synthetic eddy inflow, fixed so that
+   reruns produce the same eddy streams. \n DEFAULT: 1234 \ingroup Config*/
+  addUnsignedLongOption("INLET_SEM_SEED", SEM_Seed, 1234);
   /*!\brief MARKER_INLET  \n DESCRIPTION: Inlet boundary marker(s) with the following formats,
    Total Conditions: (inlet marker, total temp, total pressure, flow_direction_x,
    flow_direction_y, flow_direction_z, ... ) where flow_direction is
@@ -1622,11 +1675,26 @@ void CConfig::SetConfig_Options() {
 
   /* DESCRIPTION: Use a Newton-Krylov method. */
   addBoolOption("NEWTON_KRYLOV", NewtonKrylov, false);
-  /* DESCRIPTION: Integer parameters {startup iters, precond iters, initial tolerance relaxation}. */
+  /* DESCRIPTION: Integer parameters {startup iters, precond iters, initial tolerance relaxation, precond refresh period}. */
   addUShortArrayOption("NEWTON_KRYLOV_IPARAM", NK_IntParam.size(), NK_IntParam.data());
   /* DESCRIPTION: Double parameters {startup residual drop, precond tolerance, full tolerance residual drop, findiff step}. */
   addDoubleArrayOption("NEWTON_KRYLOV_DPARAM", NK_DblParam.size(), NK_DblParam.data());
 
+  /* DESCRIPTION: Number of implicit iterations the Jacobian of a solver is kept before it is
+     re-assembled (1 = assemble on every iteration). Freezing the Jacobian only changes the
+     convergence path, not the converged solution, since the right hand side is always exact. */
+  addUnsignedShortOption("JACOBIAN_FREEZE_PERIOD", Jacobian_Freeze_Period, 1);
+
+  /* DESCRIPTION: Skip edge computations inside converged regions of steady implicit runs. A point
+     is frozen (null update) when the residual magnitude of itself and all of its neighbors is
+     below REGION_FREEZING_TOLERANCE, the active margin around each frozen cluster thaws it again
+     if residuals rise. */
+  addBoolOption("REGION_FREEZING", Region_Freezing, false);
+  /* DESCRIPTION: Residual magnitude below which a point counts as converged for region freezing. */
+  addDoubleOption("REGION_FREEZING_TOLERANCE", Region_Freezing_Tol, 1e-14);
+  /* DESCRIPTION: Iterations between full thaws (complete residual evaluations) of the frozen regions. */
+  addUnsignedLongOption("REGION_FREEZING_INTERVAL", Region_Freezing_Interval, 50);
+
   /* DESCRIPTION: Number of samples for quasi-Newton methods. */
   addUnsignedShortOption("QUASI_NEWTON_NUM_SAMPLES", nQuasiNewtonSamples, 0);
   /* DESCRIPTION: Whether to use vectorized numerical schemes, less robust against transients. */
@@ -1643,6 +1711,8 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("MAX_DELTA_TIME", Max_DeltaTime, 1000000);
   /* DESCRIPTION: Activate The adaptive CFL number. */
   addBoolOption("CFL_ADAPT", CFL_Adapt, false);
+  /* DESCRIPTION: Evolve the CFL of each point from its own convergence state, bounded by neighbor ratios. */
+  addBoolOption("CFL_ADAPT_LOCAL", CFL_Adapt_Local, false);
   /* !\brief CFL_ADAPT_PARAM
    * DESCRIPTION: Parameters of the adaptive CFL number (factor down, factor up, CFL limit (min and max), acceptable linear residual )
    * Factor down generally <1.0, factor up generally > 1.0 to cause the CFL to increase when the under-relaxation parameter is 1.0
@@ -1661,6 +1731,10 @@ void CConfig::SetConfig_Options() {
   // these options share nRKStep as their size, which is not a good idea in general
   /* DESCRIPTION: Runge-Kutta alpha coefficients */
   addDoubleListOption("RK_ALPHA_COEFF", nRKStep, RK_Alpha_Step);
+  /* DESCRIPTION: Number of Jacobi sweeps of residual smoothing for the explicit time integration schemes (0 disables it) */
+  addUnsignedShortOption("RESIDUAL_SMOOTHING_SWEEPS", Residual_Smoothing_Sweeps, 0);
+  /* DESCRIPTION: Smoothing coefficient of the residual smoothing for the explicit time integration schemes */
+  addDoubleOption("RESIDUAL_SMOOTHING_COEFF", Residual_Smoothing_Coeff, 0.5);
   /* DESCRIPTION: Number of time levels for time accurate local time stepping. */
   addUnsignedShortOption("LEVELS_TIME_ACCURATE_LTS", nLevels_TimeAccurateLTS, 1);
   /* DESCRIPTION: Number of time DOFs used in the predictor step of ADER-DG. */
@@ -1711,6 +1785,8 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("LINEAR_SOLVER_ERROR", Linear_Solver_Error, 1E-6);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("LINEAR_SOLVER_ITER", Linear_Solver_Iter, 10);
+  /* DESCRIPTION: Iterative refinement sweeps around the linear solve, only effective for mixed precision builds. */
+  addUnsignedShortOption("LINEAR_SOLVER_REFINE_ITER", Linear_Solver_Refine_Iter, 0);
   /* DESCRIPTION: Fill in level for the ILU preconditioner */
   addUnsignedShortOption("LINEAR_SOLVER_ILU_FILL_IN", Linear_Solver_ILU_n, 0);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
@@ -1719,6 +1795,14 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("LINEAR_SOLVER_SMOOTHER_RELAXATION", Linear_Solver_Smoother_Relaxation, 1.0);
   /* DESCRIPTION: Custom number of threads used for additive domain decomposition for ILU and LU_SGS (0 is "auto"). */
   addUnsignedLongOption("LINEAR_SOLVER_PREC_THREADS", Linear_Solver_Prec_Threads, 0);
+  /* DESCRIPTION: Store and apply the ILU-type preconditioners in single precision (the Krylov vectors stay in double). */
+  addBoolOption("LINEAR_SOLVER_PREC_SINGLE_PRECISION", Linear_Solver_Prec_Single, NO);
+  /* DESCRIPTION: Use the solution of the previous linear solve as initial guess (consecutive systems of steady problems are strongly correlated). */
+  addBoolOption("LINEAR_SOLVER_WARM_START", Linear_Solver_Warm_Start, NO);
+  /* DESCRIPTION: Scaling applied to the retained solution when warm starting the linear solvers. */
+  addDoubleOption("LINEAR_SOLVER_WARM_START_SCALE", Linear_Solver_Warm_Start_Scale, 1.0);
+  /* DESCRIPTION: Offload the sparse matrix-vector products and the Jacobi preconditioner to CUDA devices (requires -Denable-cuda=true). */
+  addBoolOption("ENABLE_CUDA", Enable_Cuda, NO);
   /* DESCRIPTION: Relaxation factor for updates of adjoint variables. */
   addDoubleOption("RELAXATION_FACTOR_ADJOINT", Relaxation_Factor_Adjoint, 1.0);
   /* DESCRIPTION: Relaxation of the CHT coupling */
@@ -1764,6 +1848,12 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("CONV_CAUCHY_EPS", Cauchy_Eps, 1E-10);
   /*!\brief CONV_FIELD\n DESCRIPTION: Output field to monitor \n Default: depends on solver \ingroup Config*/
   addStringListOption("CONV_FIELD", nConvField, ConvField);
+  /*!\brief CONV_FIELD_EPS\n DESCRIPTION: Per-field tolerance paired with CONV_FIELD, overriding CONV_CAUCHY_EPS (coefficients) or CONV_RESIDUAL_MINVAL (residuals) \n DEFAULT: empty (use the global values) \ingroup Config*/
+  addDoubleListOption("CONV_FIELD_EPS", nConvFieldEps, ConvFieldEps);
+  /*!\brief CONV_CAUCHY_VARIANCE_EPS\n DESCRIPTION: Relative standard deviation over the Cauchy window below which an oscillating coefficient counts as converged \n DEFAULT: 0.0 (disabled) \ingroup Config*/
+  addDoubleOption("CONV_CAUCHY_VARIANCE_EPS", Cauchy_Variance_Eps, 0.0);
+  /*!\brief CONV_RESIDUAL_SLOPE_EPS\n DESCRIPTION: Mean residual slope (orders per iteration over the Cauchy window) below which a residual counts as stalled and converged \n DEFAULT: 0.0 (disabled) \ingroup Config*/
+  addDoubleOption("CONV_RESIDUAL_SLOPE_EPS", Residual_Slope_Eps, 0.0);
 
   /*!\brief CONV_WINDOW_STARTITER\n DESCRIPTION: Iteration number after START_ITER_WND  to begin convergence monitoring\n DEFAULT: 15 \ingroup Config*/
   addUnsignedLongOption("CONV_WINDOW_STARTITER", Wnd_StartConv_Iter, 15);
@@ -1785,6 +1875,10 @@ void CConfig::SetConfig_Options() {
   addUnsignedShortOption("MGLEVEL", nMGLevels, 0);
   /*!\brief MGCYCLE\n DESCRIPTION: Multi-grid cycle. OPTIONS: See \link MG_Cycle_Map \endlink. Defualt V_CYCLE \ingroup Config*/
   addEnumOption("MGCYCLE", MGCycle, MG_Cycle_Map, V_CYCLE);
+  /*!\brief FULLMG_RES_ORDER_DROP\n DESCRIPTION: Residual orders of magnitude on a full multigrid start-up level before prolongating to the next finer level. DEFAULT: 1.5 \ingroup Config*/
+  addDoubleOption("FULLMG_RES_ORDER_DROP", FullMG_ResOrderDrop, 1.5);
+  /*!\brief FULLMG_MAX_LEVEL_ITER\n DESCRIPTION: Maximum number of iterations spent on a full multigrid start-up level. DEFAULT: 50 \ingroup Config*/
+  addUnsignedLongOption("FULLMG_MAX_LEVEL_ITER", FullMG_MaxLevelIter, 50);
   /*!\brief MG_PRE_SMOOTH\n DESCRIPTION: Multi-grid pre-smoothing level \ingroup Config*/
   addUShortListOption("MG_PRE_SMOOTH", nMG_PreSmooth, MG_PreSmooth);
   /*!\brief MG_POST_SMOOTH\n DESCRIPTION: Multi-grid post-smoothing level \ingroup Config*/
@@ -1814,6 +1908,13 @@ void CConfig::SetConfig_Options() {
   /*!\brief LIMITER_ITER
    *  \n DESCRIPTION: Freeze the value of the limiter after a number of iterations. DEFAULT value 999999. \ingroup Config*/
   addUnsignedLongOption("LIMITER_ITER", LimiterIter, 999999);
+  /*!\brief LIMITER_RECOMPUTE_THRESHOLD
+   *  \n DESCRIPTION: Relative change of the solution above which the limiters of the affected stencil are
+   *  recomputed (incremental mode, only without periodic boundaries). DEFAULT value 0.0 (recompute everywhere). \ingroup Config*/
+  addDoubleOption("LIMITER_RECOMPUTE_THRESHOLD", LimiterRecomputeThreshold, 0.0);
+  /*!\brief LIMITER_REFRESH_PERIOD
+   *  \n DESCRIPTION: Number of iterations between full limiter recomputations in incremental mode. DEFAULT value 100. \ingroup Config*/
+  addUnsignedLongOption("LIMITER_REFRESH_PERIOD", LimiterRefreshPeriod, 100);
 
   /*!\brief CONV_NUM_METHOD_FLOW
    *  \n DESCRIPTION: Convective numerical method \n OPTIONS: See \link Upwind_Map \endlink , \link Centered_Map \endlink. \ingroup Config*/
@@ -1894,6 +1995,10 @@ void CConfig::SetConfig_Options() {
   /*!\brief OBJECTIVE_FUNCTION
    *  \n DESCRIPTION: Adjoint problem boundary condition \n OPTIONS: see \link Objective_Map \endlink \n DEFAULT: DRAG_COEFFICIENT \ingroup Config*/
   addEnumListOption("OBJECTIVE_FUNCTION", nObj, Kind_ObjFunc, Objective_Map);
+  /*!\brief OBJECTIVE_REPLAY \n DESCRIPTION: Evaluate the objective function(s) from the restart solution
+   and exit without solving. Combined with mesh perturbations (SU2_DEF) this gives frozen-flow finite
+   differences of the objectives for gradient sanity checks without full flow solves. \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("OBJECTIVE_REPLAY", Objective_Replay, false);
 
   /* DESCRIPTION: parameter for the definition of a complex objective function */
   addDoubleOption("DCD_DCL_VALUE", dCD_dCL, 0.0);
@@ -1946,6 +2051,9 @@ void CConfig::SetConfig_Options() {
   addBoolOption("FROZEN_LIMITER_DISC", Frozen_Limiter_Disc, false);
   /* DESCRIPTION: Use an inconsistent (primal/dual) discrete adjoint formulation */
   addBoolOption("INCONSISTENT_DISC", Inconsistent_Disc, false);
+  /* DESCRIPTION: Wall distance within which the discrete adjoint recording keeps full
+     second-order numerics, farther edges drop to first order to shrink the tape (0 = everywhere). */
+  addDoubleOption("ADJ_FIDELITY_RADIUS", AdjFidelityRadius, 0.0);
    /* DESCRIPTION:  */
   addDoubleOption("FIX_AZIMUTHAL_LINE", FixAzimuthalLine, 90.0);
   /*!\brief SENS_REMOVE_SHARP
@@ -1955,6 +2063,9 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Automatically reorient elements that seem flipped */
   addBoolOption("REORIENT_ELEMENTS",ReorientElements, true);
 
+  /*!\brief POINT_REORDERING \n DESCRIPTION: Renumbering of the points of the partitioned grid to improve the locality (bandwidth) of the solver data structures \n OPTIONS: see \link Point_Reordering_Map \endlink \n DEFAULT: RCM \ingroup Config*/
+  addEnumOption("POINT_REORDERING", Kind_Point_Reordering, Point_Reordering_Map, POINT_REORDERING::RCM);
+
   /*!\par CONFIG_CATEGORY: Input/output files and formats \ingroup Config */
   /*--- Options related to input/output files and formats ---*/
 
@@ -2024,6 +2135,10 @@ void CConfig::SetConfig_Options() {
   addStringOption("VOLUME_SENS_FILENAME", VolSens_FileName, string("volume_sens"));
   /* DESCRIPTION: Output the performance summary to the console at the end of SU2_CFD  \ingroup Config*/
   addBoolOption("WRT_PERFORMANCE", Wrt_Performance, false);
+  /* DESCRIPTION: Output the per-category memory footprint summary to the console at the end of preprocessing  \ingroup Config*/
+  addBoolOption("WRT_MEMORY_FOOTPRINT", Wrt_MemoryFootprint, false);
+  /* DESCRIPTION: Write the binary volume files in a background thread, overlapping I/O with the next time steps (requires MPI_THREAD_MULTIPLE in parallel)  \ingroup Config*/
+  addBoolOption("WRT_ASYNC", Wrt_Async, false);
   /* DESCRIPTION: Output the tape statistics (discrete adjoint)  \ingroup Config*/
   addBoolOption("WRT_AD_STATISTICS", Wrt_AD_Statistics, false);
   /*!\brief MARKER_ANALYZE_AVERAGE
@@ -2034,6 +2149,15 @@ void CConfig::SetConfig_Options() {
   /*!\brief COMM_LEVEL
    *  \n DESCRIPTION: Level of MPI communications during runtime  \ingroup Config*/
   addEnumOption("COMM_LEVEL", Comm_Level, Comm_Map, COMM_FULL);
+  /*!\brief COMM_SINGLE_PRECISION
+   *  \n DESCRIPTION: Exchange precision-tolerant halo quantities (limiters, sensors, eigenvalues,
+   *  CFL, reconstruction gradients) in single precision to halve their message volume  \ingroup Config*/
+  addBoolOption("COMM_SINGLE_PRECISION", Comm_SinglePrecision, false);
+  /*!\brief RESIDUAL_SAMPLING_INTERVAL
+   *  \n DESCRIPTION: Compute the exact global residual norms only every N inner iterations. In
+   *  between, the norms are estimated from a deterministic point subset without MPI reductions,
+   *  which only affects the convergence history, not the solution. Default 1 (always exact) \ingroup Config*/
+  addUnsignedLongOption("RESIDUAL_SAMPLING_INTERVAL", Residual_Sampling_Interval, 1);
 
   /*!\par CONFIG_CATEGORY: Dynamic mesh definition \ingroup Config*/
   /*--- Options related to dynamic meshes ---*/
@@ -2225,6 +2349,11 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("DEFORM_LINEAR_SOLVER_ERROR", Deform_Linear_Solver_Error, 1E-14);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("DEFORM_LINEAR_SOLVER_ITER", Deform_Linear_Solver_Iter, 1000);
+  /* DESCRIPTION: Iterative refinement sweeps around the mesh deformation linear solve, only effective for mixed precision builds. */
+  addUnsignedShortOption("DEFORM_LINEAR_SOLVER_REFINE_ITER", Deform_Linear_Solver_Refine_Iter, 0);
+  /* DESCRIPTION: Apply the mesh deformation stiffness operator element-wise instead of assembling it,
+     the stiffness matrix is never stored and the solver uses a block-Jacobi preconditioner. */
+  addBoolOption("DEFORM_MATRIX_FREE", Deform_MatrixFree, false);
 
   /*!\par CONFIG_CATEGORY: Rotorcraft problem \ingroup Config*/
   /*--- option related to rotorcraft problems ---*/
@@ -2456,6 +2585,12 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Tolerance to prune small coefficients from the RBF interpolation matrix. */
   addDoubleOption("RADIAL_BASIS_FUNCTION_PRUNE_TOLERANCE", RadialBasisFunction_PruneTol, 1e-6);
 
+  /* DESCRIPTION: Maximum donor cluster size for partition-of-unity RBF interpolation.
+  If 0 (default) one dense system over all donor points of an interface is solved, which
+  becomes intractable beyond ~50k points. Otherwise the donors are split into overlapping
+  clusters of at most this size and the local interpolants are blended smoothly. */
+  addUnsignedLongOption("RADIAL_BASIS_FUNCTION_MAX_CLUSTER_SIZE", RadialBasisFunction_MaxClusterSize, 0);
+
    /*!\par INLETINTERPOLATION \n
    * DESCRIPTION: Type of spanwise interpolation to use for the inlet face. \n OPTIONS: see \link Inlet_SpanwiseInterpolation_Map \endlink
    * Sets Kind_InletInterpolation \ingroup Config
@@ -2689,6 +2824,14 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: ParMETIS load balancing weight for edges (equiv. to neighbors) */
   addLongOption("PARMETIS_EDGE_WEIGHT", ParMETIS_edgeWgt, 1);
 
+  /* DESCRIPTION: Extra ParMETIS load balancing weight for solid wall points (doubled on wall-function markers) */
+  addLongOption("PARMETIS_WALL_WEIGHT", ParMETIS_wallWgt, 0);
+
+  /* DESCRIPTION: Cache the mesh partitioning and the dual grid metrics in binary sidecar
+     files (per rank count) and reuse them on subsequent runs and tool invocations with the
+     same mesh, skipping the call to ParMETIS and the metric computation. */
+  addBoolOption("PARTITION_CACHE", PartitionCache, false);
+
   /*--- options that are used in the Hybrid RANS/LES Simulations  ---*/
   /*!\par CONFIG_CATEGORY:Hybrid_RANSLES Options\ingroup Config*/
 
@@ -2770,6 +2913,14 @@ void CConfig::SetConfig_Options() {
   addUnsignedLongOption("OUTPUT_WRT_FREQ", VolumeWrtFreq, 250);
   /* DESCRIPTION: Volume solution files */
   addEnumListOption("OUTPUT_FILES", nVolumeOutputFiles, VolumeOutputFiles, Output_Map);
+  /* DESCRIPTION: Config files of the cases of an ensemble run, the MPI ranks are
+   partitioned between them and the cases run concurrently. Each case config must
+   use distinct output file names. */
+  addStringListOption("ENSEMBLE_CASES", nEnsembleCases, EnsembleCases);
+  /* DESCRIPTION: Coordinates of time-resolved point probes (x1, y1, z1, x2, ...) */
+  addDoubleListOption("PROBE_LOCATIONS", nProbeCoord, ProbeCoord);
+  /* DESCRIPTION: Number of sampled steps buffered between binary probe flushes */
+  addUnsignedLongOption("PROBE_WRT_FREQ", ProbeWrtFreq, 100);
 
   /* DESCRIPTION: Using Uncertainty Quantification with SST Turbulence Model */
   addBoolOption("USING_UQ", using_uq, false);
@@ -2789,6 +2940,9 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Number of calls to 'Build' that trigger re-factorization (0 means only once). */
   addUnsignedLongOption("PASTIX_FACTORIZATION_FREQUENCY", pastix_fact_freq, 1);
 
+  /* DESCRIPTION: Global degrees of freedom above which a PaStiX direct solve falls back to FGMRES (0 disables the fallback). */
+  addUnsignedLongOption("PASTIX_MAX_DOF", pastix_max_dof, 0);
+
   /* DESCRIPTION: 0 - Quiet, 1 - During factorization and cleanup, 2 - Even more detail. */
   addUnsignedShortOption("PASTIX_VERBOSITY_LEVEL", pastix_verb_lvl, 0);
 
@@ -2797,6 +2951,15 @@ void CConfig::SetConfig_Options() {
 
   /* DESCRIPTION: Size of the edge groups colored for thread parallel edge loops (0 forces the reducer strategy). */
   addUnsignedLongOption("EDGE_COLORING_GROUP_SIZE", edgeColorGroupSize, 512);
+
+  /* DESCRIPTION: Pick the edge-coloring group size automatically at preprocessing by evaluating candidate sizes (overrides EDGE_COLORING_GROUP_SIZE). */
+  addBoolOption("EDGE_COLORING_AUTOTUNE", edgeColorAutoTune, false);
+
+  /* DESCRIPTION: Use the edge-based reducer strategy for thread parallel Green-Gauss gradients (avoids visiting each edge from both end points). */
+  addBoolOption("GRADIENT_REDUCER_STRATEGY", Gradient_ReducerStrategy, false);
+
+  /* DESCRIPTION: Adjust the thread work ranges of the least-squares gradient loops between iterations based on measured execution times (hybrid parallel only). */
+  addBoolOption("COST_GUIDED_SCHEDULE", Cost_Guided_Schedule, false);
   
   /*--- options that are used for libROM ---*/
   /*!\par CONFIG_CATEGORY:libROM options \ingroup Config*/
@@ -2822,19 +2985,36 @@ void CConfig::SetConfig_Options() {
 
 void CConfig::SetConfig_Parsing(char case_filename[MAX_STRING_SIZE]) {
 
-  ifstream case_file;
+  /*--- The file is read once by the master rank and broadcast, per-zone configs
+   *    re-read the same file and with many ranks and zones the redundant file
+   *    accesses dominate the startup time. ---*/
 
-  /*--- Read the configuration file ---*/
+  string file_contents;
 
-  case_file.open(case_filename, ios::in);
+  if (rank == MASTER_NODE) {
+
+    ifstream case_file(case_filename, ios::in);
+
+    if (case_file.fail()) {
+      SU2_MPI::Error("The configuration file (.cfg) is missing!!", CURRENT_FUNCTION);
+    }
 
-  if (case_file.fail()) {
-    SU2_MPI::Error("The configuration file (.cfg) is missing!!", CURRENT_FUNCTION);
+    stringstream ss;
+    ss << case_file.rdbuf();
+    file_contents = ss.str();
   }
 
-  SetConfig_Parsing(case_file);
+  /*--- Broadcast the contents to the other ranks. ---*/
 
-  case_file.close();
+  unsigned long length = file_contents.size();
+  SU2_MPI::Bcast(&length, 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+
+  if (rank != MASTER_NODE) file_contents.resize(length);
+  if (length > 0)
+    SU2_MPI::Bcast(&file_contents[0], length, MPI_CHAR, MASTER_NODE, SU2_MPI::GetComm());
+
+  istringstream case_buffer(file_contents);
+  SetConfig_Parsing(case_buffer);
 
 }
 
@@ -3547,6 +3727,21 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     if (TimeMarching != TIME_MARCHING::HARMONIC_BALANCE) { TimeMarching = TIME_MARCHING::STEADY; }
   }
 
+  /*--- Region freezing assumes a steady implicit computation, the null update at
+   frozen points is enforced through the Jacobian which must be re-assembled on
+   every iteration. ---*/
+
+  if (Region_Freezing) {
+    if (Time_Domain)
+      SU2_MPI::Error("REGION_FREEZING is only available for steady computations.", CURRENT_FUNCTION);
+    if (Kind_TimeIntScheme_Flow != EULER_IMPLICIT)
+      SU2_MPI::Error("REGION_FREEZING requires TIME_DISCRE_FLOW= EULER_IMPLICIT.", CURRENT_FUNCTION);
+    if (Jacobian_Freeze_Period > 1)
+      SU2_MPI::Error("REGION_FREEZING cannot be combined with JACOBIAN_FREEZE_PERIOD > 1.", CURRENT_FUNCTION);
+    if (Region_Freezing_Interval < 2)
+      SU2_MPI::Error("REGION_FREEZING_INTERVAL must be at least 2.", CURRENT_FUNCTION);
+  }
+
   /*--- Ensure that Discard_InFiles is false, owerwise the gradient could be wrong ---*/
 
   if ((ContinuousAdjoint || DiscreteAdjoint) && Fixed_CL_Mode && !Eval_dOF_dCX)
@@ -4633,6 +4828,17 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     }
   }
 
+  if (Tabulated_FluidModel) {
+    if ((Tabulated_Rho_Limits[1] <= Tabulated_Rho_Limits[0]) ||
+        (Tabulated_Energy_Limits[1] <= Tabulated_Energy_Limits[0])) {
+      SU2_MPI::Error("TABULATED_FLUID_MODEL requires increasing (min, max) pairs for\n "
+                     "TABULATED_FLUID_MODEL_RHO_LIMITS and TABULATED_FLUID_MODEL_ENERGY_LIMITS.", CURRENT_FUNCTION);
+    }
+    if (nTabulated_Points < 2) {
+      SU2_MPI::Error("TABULATED_FLUID_MODEL_POINTS must be at least 2.", CURRENT_FUNCTION);
+    }
+  }
+
   /*--- Check the coefficients for the polynomial models. ---*/
 
   if (Kind_Solver != INC_EULER && Kind_Solver != INC_NAVIER_STOKES && Kind_Solver != INC_RANS) {
@@ -4906,6 +5112,17 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
       SU2_MPI::Error("COMM_LEVEL = NONE not yet implemented.", CURRENT_FUNCTION);
   }
 
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  /*--- Demoting the halo values to single precision would drop the derivative
+   information carried by the AD datatype. ---*/
+
+  if (Comm_SinglePrecision) {
+    if (rank == MASTER_NODE)
+      cout << "WARNING: COMM_SINGLE_PRECISION is not available for AD builds and will be ignored." << endl;
+    Comm_SinglePrecision = false;
+  }
+#endif
+
   /*--- Check the conductivity model. Deactivate the turbulent component
    if we are not running RANS. ---*/
 
@@ -4940,6 +5157,14 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
   if (isPastix(Kind_DiscAdj_Linear_Solver)) Kind_DiscAdj_Linear_Prec = LU_SGS;
   if (isPastix(Kind_Deform_Linear_Solver)) Kind_Deform_Linear_Solver_Prec = LU_SGS;
 
+  /* Check if SU2 was built with CUDA support, as that is required for ENABLE_CUDA. */
+#ifndef HAVE_CUDA
+  if (Enable_Cuda) {
+    SU2_MPI::Error(string("Option ENABLE_CUDA requested but SU2 was built without CUDA support (-Denable-cuda=true).\n"),
+                   CURRENT_FUNCTION);
+  }
+#endif
+
 
   if (DiscreteAdjoint) {
 #if !defined CODI_REVERSE_TYPE
@@ -6517,12 +6742,17 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
             case BCGSTAB:
             case FGMRES:
             case RESTARTED_FGMRES:
+            case CA_FGMRES:
               if (Kind_Linear_Solver == BCGSTAB)
                 cout << "BCGSTAB is used for solving the linear system." << endl;
+              else if (Kind_Linear_Solver == CA_FGMRES)
+                cout << "FGMRES (communication-avoiding orthogonalization) is used for solving the linear system." << endl;
               else
                 cout << "FGMRES is used for solving the linear system." << endl;
               switch (Kind_Linear_Solver_Prec) {
                 case ILU: cout << "Using a ILU("<< Linear_Solver_ILU_n <<") preconditioning."<< endl; break;
+                case LEVEL_ILU: cout << "Using a level-scheduled ILU(" << Linear_Solver_ILU_n <<") preconditioning."<< endl; break;
+                case AMG:     cout << "Using an aggregation AMG preconditioning."<< endl; break;
                 case LINELET: cout << "Using a linelet preconditioning."<< endl; break;
                 case LU_SGS:  cout << "Using a LU-SGS preconditioning."<< endl; break;
                 case JACOBI:  cout << "Using a Jacobi preconditioning."<< endl; break;
@@ -6531,6 +6761,8 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
             case SMOOTHER:
               switch (Kind_Linear_Solver_Prec) {
                 case ILU:     cout << "A ILU(" << Linear_Solver_ILU_n << ")"; break;
+                case LEVEL_ILU: cout << "A level-scheduled ILU(" << Linear_Solver_ILU_n << ")"; break;
+                case AMG:     cout << "An aggregation AMG"; break;
                 case LINELET: cout << "A Linelet"; break;
                 case LU_SGS:  cout << "A LU-SGS"; break;
                 case JACOBI:  cout << "A Jacobi"; break;
@@ -6547,6 +6779,12 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
           cout << "Time coefficients: {0.5, 0.5, 1, 1}" << endl;
           cout << "Function coefficients: {1/6, 1/3, 1/3, 1/6}" << endl;
           break;
+        case SSPRK3_EXPLICIT:
+          cout << "Low-storage SSP-RK3 explicit method for the flow equations." << endl;
+          cout << "Number of steps: " << 3 << endl;
+          cout << "Old solution coefficients: {0, 3/4, 1/3}" << endl;
+          cout << "Stage coefficients: {1, 1/4, 2/3}" << endl;
+          break;
       }
     }
 
@@ -7340,6 +7578,28 @@ unsigned short CConfig::GetMarker_CfgFile_Monitoring(string val_marker) const {
   return Marker_CfgFile_Monitoring[iMarker_CfgFile];
 }
 
+vector<unsigned short> CConfig::GetMarker_All_to_Monitoring(void) const {
+  vector<unsigned short> markerMap(nMarker_All, nMarker_Monitoring);
+  for (unsigned short iMarker = 0; iMarker < nMarker_All; iMarker++)
+    for (unsigned short iMarker_Monitoring = 0; iMarker_Monitoring < nMarker_Monitoring; iMarker_Monitoring++)
+      if (Marker_All_TagBound[iMarker] == Marker_Monitoring[iMarker_Monitoring]) {
+        markerMap[iMarker] = iMarker_Monitoring;
+        break;
+      }
+  return markerMap;
+}
+
+vector<unsigned short> CConfig::GetMarker_All_to_Analyze(void) const {
+  vector<unsigned short> markerMap(nMarker_All, nMarker_Analyze);
+  for (unsigned short iMarker = 0; iMarker < nMarker_All; iMarker++)
+    for (unsigned short iMarker_Analyze = 0; iMarker_Analyze < nMarker_Analyze; iMarker_Analyze++)
+      if (Marker_All_TagBound[iMarker] == Marker_Analyze[iMarker_Analyze]) {
+        markerMap[iMarker] = iMarker_Analyze;
+        break;
+      }
+  return markerMap;
+}
+
 unsigned short CConfig::GetMarker_CfgFile_GeoEval(string val_marker) const {
   unsigned short iMarker_CfgFile;
   for (iMarker_CfgFile = 0; iMarker_CfgFile < nMarker_CfgFile; iMarker_CfgFile++)
@@ -7499,7 +7759,7 @@ CConfig::~CConfig(void) {
 
   /*--- Delete all of the option objects in the global option map ---*/
 
-  for(map<string, COptionBase*>::iterator itr = option_map.begin(); itr != option_map.end(); itr++) {
+  for(auto itr = option_map.begin(); itr != option_map.end(); itr++) {
     delete itr->second;
   }
 
@@ -357,7 +357,8 @@ void CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxT
                                                  su2double       &dist,
                                                  unsigned short  &markerID,
                                                  unsigned long   &elemID,
-                                                 int             &rankID) const {
+                                                 int             &rankID,
+                                                 su2double       distUpperBound) const {
 
   const bool wasActive = AD::BeginPassive();
 
@@ -378,6 +379,11 @@ void CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxT
   if(nDim==3) {
   ds = max(fabs(coor[2]-coorBBMin[2]), fabs(coor[2]-coorBBMax[2])); dist += ds*ds;}
 
+  /* If the caller provided a valid upper bound for the distance, use it to
+     tighten the initial guaranteed distance, such that the tree traversal
+     below can prune more aggressively. */
+  if(distUpperBound >= 0.0) dist = min(dist, distUpperBound*distUpperBound);
+
   /*----------------------------------------------------------------------------*/
   /*--- Step 2: Traverse the tree and store the bounding boxes for which the ---*/
   /*---         possible minimum distance is less than the currently stored  ---*/
@@ -40,6 +40,7 @@ CADTPointsOnlyClass::CADTPointsOnlyClass(unsigned short nDim,
   FrontLeaves.resize(omp_get_max_threads());
   FrontLeavesNew.resize(omp_get_max_threads());
 #endif
+  PrevResultIndex.resize(omp_get_max_threads(), 0);
 
   /*--- Make a distinction between parallel and sequential mode. ---*/
 
@@ -116,6 +117,7 @@ CADTPointsOnlyClass::CADTPointsOnlyClass(unsigned short nDim,
 
 void CADTPointsOnlyClass::DetermineNearestNode_impl(vector<unsigned long>& frontLeaves,
                                                     vector<unsigned long>& frontLeavesNew,
+                                                    unsigned long   &prevResultIndex,
                                                     const su2double *coor,
                                                     su2double       &dist,
                                                     unsigned long   &pointID,
@@ -141,6 +143,24 @@ void CADTPointsOnlyClass::DetermineNearestNode_impl(vector<unsigned long>& front
     dist += ds*ds;
   }
 
+  /*--- Also consider the result of the previous query of this thread as
+        initial candidate. For batches of queries with spatial locality this
+        bound is much tighter, which prunes most of the tree traversal. ---*/
+  kk = prevResultIndex;
+  coorTarget = coorPoints.data() + nDimADT*kk;
+  su2double distPrev = 0.0;
+  for(unsigned short l=0; l<nDimADT; ++l) {
+    const su2double ds = coor[l] - coorTarget[l];
+    distPrev += ds*ds;
+  }
+
+  if(distPrev < dist) {
+    dist     = distPrev;
+    pointID  = localPointIDs[kk];
+    rankID   = ranksOfPoints[kk];
+    minIndex = kk;
+  }
+
   /*--------------------------------------------------------------------------*/
   /*--- Step 2: Traverse the tree and search for the nearest node.         ---*/
   /*---         During the tree traversal the currently stored distance    ---*/
@@ -239,6 +259,9 @@ void CADTPointsOnlyClass::DetermineNearestNode_impl(vector<unsigned long>& front
 
   AD::EndPassive(wasActive);
 
+  /* Remember the result to warm-start the next query of this thread. */
+  prevResultIndex = minIndex;
+
   /* Recompute the distance to get the correct dependency if we use AD */
   coorTarget = coorPoints.data() + nDimADT*minIndex;
   dist = 0.0;
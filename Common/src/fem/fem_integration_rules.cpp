@@ -27,11 +27,72 @@
 
 #include "../../include/fem/fem_standard_element.hpp"
 #include "../../include/fem/fem_gauss_jacobi_quadrature.hpp"
+#include "../../include/fem/geometry_structure_fem_part.hpp"
 
 /*----------------------------------------------------------------------------------*/
 /*         Private member functions of CFEMStandardElementBase.                     */
 /*----------------------------------------------------------------------------------*/
 
+namespace {
+
+/*--- An integration rule as stored in the cache below. ---*/
+struct CIntegrationRule {
+  unsigned short nIntegration = 0;       /*!< \brief Number of integration points. */
+  vector<su2double> rIntegration;        /*!< \brief r-location of the integration points. */
+  vector<su2double> sIntegration;        /*!< \brief s-location of the integration points, if needed. */
+  vector<su2double> tIntegration;        /*!< \brief t-location of the integration points, if needed. */
+  vector<su2double> wIntegration;        /*!< \brief Weights of the integration points. */
+};
+
+/*--- Global cache of the integration rules, keyed by the element type and the
+      order that must be integrated exactly. Every standard element and face
+      regenerates its rule during construction, and many of them share the same
+      rule, hence the rules are computed once and reused afterwards. The cache
+      is filled during the (serial) preprocessing, no thread safety is needed. ---*/
+map<CUnsignedShort2T, CIntegrationRule> integrationRuleCache;
+
+}
+
+void CFEMStandardElementBase::IntegrationPoints(void) {
+
+  /*--- Check if the rule for this element type and order was computed before. ---*/
+  CUnsignedShort2T key(VTK_Type, orderExact);
+
+  auto it = integrationRuleCache.find(key);
+  if(it == integrationRuleCache.end()) {
+
+    /*--- Rule not present yet. Determine the integration points,
+          which depends on the element type. ---*/
+    switch( VTK_Type ) {
+      case LINE:          IntegrationPointsLine();          break;
+      case TRIANGLE:      IntegrationPointsTriangle();      break;
+      case QUADRILATERAL: IntegrationPointsQuadrilateral(); break;
+      case TETRAHEDRON:   IntegrationPointsTetrahedron();   break;
+      case PYRAMID:       IntegrationPointsPyramid();       break;
+      case PRISM:         IntegrationPointsPrism();         break;
+      case HEXAHEDRON:    IntegrationPointsHexahedron();    break;
+    }
+
+    /*--- Store the rule in the cache for the next element of this type and order. ---*/
+    CIntegrationRule &rule = integrationRuleCache[key];
+    rule.nIntegration = nIntegration;
+    rule.rIntegration = rIntegration;
+    rule.sIntegration = sIntegration;
+    rule.tIntegration = tIntegration;
+    rule.wIntegration = wIntegration;
+  }
+  else {
+
+    /*--- Rule available, simply copy the data from the cache. ---*/
+    const CIntegrationRule &rule = it->second;
+    nIntegration = rule.nIntegration;
+    rIntegration = rule.rIntegration;
+    sIntegration = rule.sIntegration;
+    tIntegration = rule.tIntegration;
+    wIntegration = rule.wIntegration;
+  }
+}
+
 void CFEMStandardElementBase::IntegrationPointsLine(void) {
 
   /*--- Allocate the memory for the integration points
@@ -216,16 +216,10 @@ CFEMStandardElementBase::CFEMStandardElementBase(unsigned short val_VTK_Type,
       orderExact = (unsigned short) ceil(val_nPoly*config->GetQuadrature_Factor_Curved());
   }
 
-  /*--- Determine the integration points. This depends on the element type. ---*/
-  switch( VTK_Type ) {
-    case LINE:          IntegrationPointsLine();          break;
-    case TRIANGLE:      IntegrationPointsTriangle();      break;
-    case QUADRILATERAL: IntegrationPointsQuadrilateral(); break;
-    case TETRAHEDRON:   IntegrationPointsTetrahedron();   break;
-    case PYRAMID:       IntegrationPointsPyramid();       break;
-    case PRISM:         IntegrationPointsPrism();         break;
-    case HEXAHEDRON:    IntegrationPointsHexahedron();    break;
-  }
+  /*--- Determine the integration points. This depends on the element type.
+        The rules are cached, such that repeated standard elements and faces
+        do not regenerate them. ---*/
+  IntegrationPoints();
 }
 
 void CFEMStandardElementBase::CheckSumDerivativesLagrangianBasisFunctions(
@@ -2225,7 +2219,7 @@ void CFEMStandardElement::BasisFunctionsAndDerivativesInPoint(
 
 bool CFEMStandardElement::SameStandardElement(unsigned short val_VTK_Type,
                                               unsigned short val_nPoly,
-                                              bool           val_constJac) {
+                                              bool           val_constJac) const {
   if(val_VTK_Type != VTK_Type)      return false;
   if(val_nPoly    != nPoly)         return false;
   if(val_constJac != constJacobian) return false;
@@ -2233,6 +2227,65 @@ bool CFEMStandardElement::SameStandardElement(unsigned short val_VTK_Type,
   return true;
 }
 
+namespace {
+
+/*--- Key of the global standard element cache: the element type, the polynomial
+      degree, the order that must be integrated exactly and whether or not the
+      Jacobian is constant. ---*/
+struct CStandardElementKey {
+
+  unsigned short VTK_Type, nPoly, orderExact, constJac;
+
+  CStandardElementKey(unsigned short a, unsigned short b,
+                      unsigned short c, unsigned short d)
+    : VTK_Type(a), nPoly(b), orderExact(c), constJac(d) {}
+
+  inline bool operator<(const CStandardElementKey &other) const {
+    if(VTK_Type   != other.VTK_Type)   return (VTK_Type   < other.VTK_Type);
+    if(nPoly      != other.nPoly)      return (nPoly      < other.nPoly);
+    if(orderExact != other.orderExact) return (orderExact < other.orderExact);
+    return (constJac < other.constJac);
+  }
+};
+
+/*--- The global cache of the standard elements. Note that the references handed
+      out by GetStandardElement remain valid when the map grows. ---*/
+map<CStandardElementKey, CFEMStandardElement> standardElementCache;
+
+}
+
+const CFEMStandardElement& CFEMStandardElement::GetStandardElement(unsigned short val_VTK_Type,
+                                                                   unsigned short val_nPoly,
+                                                                   bool           val_constJac,
+                                                                   CConfig        *config,
+                                                                   unsigned short val_orderExact) {
+
+  /*--- Resolve the order that must be integrated exactly in the same way as the
+        constructor of CFEMStandardElementBase, such that equivalent requests
+        share one cache entry. ---*/
+  unsigned short orderExact = val_orderExact;
+  if(orderExact == 0) {
+    if( val_constJac )
+      orderExact = (unsigned short) ceil(val_nPoly*config->GetQuadrature_Factor_Straight());
+    else
+      orderExact = (unsigned short) ceil(val_nPoly*config->GetQuadrature_Factor_Curved());
+  }
+
+  /*--- Create the standard element on first use and return the shared instance. ---*/
+  CStandardElementKey key(val_VTK_Type, val_nPoly, orderExact, val_constJac);
+
+  auto it = standardElementCache.find(key);
+  if(it == standardElementCache.end())
+    it = standardElementCache.insert(make_pair(key, CFEMStandardElement(val_VTK_Type, val_nPoly,
+                                                                        val_constJac, config,
+                                                                        orderExact))).first;
+  return it->second;
+}
+
+void CFEMStandardElement::ClearStandardElementCache(void) {
+  standardElementCache.clear();
+}
+
 /*----------------------------------------------------------------------------------*/
 /*           Private member functions of CFEMStandardElement.                       */
 /*----------------------------------------------------------------------------------*/
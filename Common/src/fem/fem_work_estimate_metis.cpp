@@ -28,7 +28,7 @@
 
 #include "../../include/fem/fem_standard_element.hpp"
 
-su2double CFEMStandardElement::WorkEstimateMetis(CConfig *config) {
+su2double CFEMStandardElement::WorkEstimateMetis(CConfig *config) const {
 
   /* TEMPORARY IMPLEMENTATION. */
   return nIntegration + 0.1*nDOFs;
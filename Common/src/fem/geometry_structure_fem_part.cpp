@@ -3049,7 +3049,7 @@ void CPhysicalGeometry::DetermineFEMConstantJacobiansAndLenScale(CConfig *config
   /*--- Define the vectors to store the standard elements for the volume elements
         and surface faces. These standard elements will be created based on the
         polynomial degree of the grid.      ---*/
-  vector<CFEMStandardElement> standardVolumeElements, standardFaceElements;
+  vector<const CFEMStandardElement*> standardVolumeElements, standardFaceElements;
 
   /*--- Loop over the local volume elements. ---*/
   for(unsigned long i=0; i<nElem; ++i) {
@@ -3068,19 +3068,19 @@ void CPhysicalGeometry::DetermineFEMConstantJacobiansAndLenScale(CConfig *config
 
     unsigned long ii;
     for(ii=0; ii<standardVolumeElements.size(); ++ii) {
-      if( standardVolumeElements[ii].SameStandardElement(VTK_Type, nPolyGrid, true) )
+      if( standardVolumeElements[ii]->SameStandardElement(VTK_Type, nPolyGrid, true) )
         break;
     }
 
     if(ii == standardVolumeElements.size())
-      standardVolumeElements.push_back(CFEMStandardElement(VTK_Type, nPolyGrid,
-                                                           true, config));
+      standardVolumeElements.push_back(&CFEMStandardElement::GetStandardElement(VTK_Type, nPolyGrid,
+                                                                                true, config));
 
     /*--- Allocate the memory for some help vectors to carry out the matrix
           product to determine the derivatives of the coordinates w.r.t.
           the parametric coordinates. ---*/
-    unsigned short nDOFs        = standardVolumeElements[ii].GetNDOFs();
-    unsigned short nIntegration = standardVolumeElements[ii].GetNIntegration();
+    unsigned short nDOFs        = standardVolumeElements[ii]->GetNDOFs();
+    unsigned short nIntegration = standardVolumeElements[ii]->GetNIntegration();
 
     unsigned long sizeResult = nDim*nDim*nIntegration;
     unsigned long sizeRHS    = nDim*nDOFs;
@@ -3102,7 +3102,7 @@ void CPhysicalGeometry::DetermineFEMConstantJacobiansAndLenScale(CConfig *config
           derivatives. The first nDOFs*nIntegration entries of this matrix
           correspond to the interpolation data to the integration points
           and are not needed. Hence this part is skipped. ---*/
-    const su2double *matBasisInt    = standardVolumeElements[ii].GetMatBasisFunctionsIntegration();
+    const su2double *matBasisInt    = standardVolumeElements[ii]->GetMatBasisFunctionsIntegration();
     const su2double *matDerBasisInt = &matBasisInt[nDOFs*nIntegration];
 
     /* Carry out the matrix matrix product. The last argument is NULL, such
@@ -3199,32 +3199,32 @@ void CPhysicalGeometry::DetermineFEMConstantJacobiansAndLenScale(CConfig *config
       }
 
       for(jj=0; jj<standardFaceElements.size(); ++jj) {
-        if( standardFaceElements[jj].SameStandardElement(VTK_Type, nPolyGrid, true) )
+        if( standardFaceElements[jj]->SameStandardElement(VTK_Type, nPolyGrid, true) )
           break;
       }
 
       if(jj == standardFaceElements.size())
-        standardFaceElements.push_back(CFEMStandardElement(VTK_Type, nPolyGrid,
-                                                           true, config));
+        standardFaceElements.push_back(&CFEMStandardElement::GetStandardElement(VTK_Type, nPolyGrid,
+                                                                                true, config));
 
       /*--- Set the pointer to store the face connectivity of this face. ---*/
-      unsigned short *connFace = nullptr;
+      const unsigned short *connFace = nullptr;
       switch( j) {
-        case 0: connFace = standardVolumeElements[ii].GetConnFace0(); break;
-        case 1: connFace = standardVolumeElements[ii].GetConnFace1(); break;
-        case 2: connFace = standardVolumeElements[ii].GetConnFace2(); break;
-        case 3: connFace = standardVolumeElements[ii].GetConnFace3(); break;
-        case 4: connFace = standardVolumeElements[ii].GetConnFace4(); break;
-        case 5: connFace = standardVolumeElements[ii].GetConnFace5(); break;
+        case 0: connFace = standardVolumeElements[ii]->GetConnFace0(); break;
+        case 1: connFace = standardVolumeElements[ii]->GetConnFace1(); break;
+        case 2: connFace = standardVolumeElements[ii]->GetConnFace2(); break;
+        case 3: connFace = standardVolumeElements[ii]->GetConnFace3(); break;
+        case 4: connFace = standardVolumeElements[ii]->GetConnFace4(); break;
+        case 5: connFace = standardVolumeElements[ii]->GetConnFace5(); break;
       }
 
       /*--- Store the relevant derivative vectors of the standard element of
             the face as well as the number of DOFs and integration points. ---*/
-      nDOFs        = standardFaceElements[jj].GetNDOFs();
-      nIntegration = standardFaceElements[jj].GetNIntegration();
+      nDOFs        = standardFaceElements[jj]->GetNDOFs();
+      nIntegration = standardFaceElements[jj]->GetNIntegration();
 
-      const su2double *dr = standardFaceElements[jj].GetDrBasisFunctionsIntegration();
-      const su2double *ds = standardFaceElements[jj].GetDsBasisFunctionsIntegration();
+      const su2double *dr = standardFaceElements[jj]->GetDrBasisFunctionsIntegration();
+      const su2double *ds = standardFaceElements[jj]->GetDsBasisFunctionsIntegration();
 
       /*--- Allocate the memory for the vector to store the normals in the
             integration points of the face. */
@@ -3378,7 +3378,7 @@ void CPhysicalGeometry::DetermineDonorElementsWallFunctions(CConfig *config) {
   }
 
   /* Define the vector to store the standard element for the volume elements. */
-  vector<CFEMStandardElement> standardVolumeElements;
+  vector<const CFEMStandardElement*> standardVolumeElements;
 
   /* Define the vectors, which store the mapping from the subelement to the
      parent element, subelement ID within the parent element, the element
@@ -3401,32 +3401,32 @@ void CPhysicalGeometry::DetermineDonorElementsWallFunctions(CConfig *config) {
 
     unsigned long ii;
     for(ii=0; ii<standardVolumeElements.size(); ++ii) {
-      if( standardVolumeElements[ii].SameStandardElement(VTK_Parent, nPolyGrid, true) )
+      if( standardVolumeElements[ii]->SameStandardElement(VTK_Parent, nPolyGrid, true) )
         break;
     }
 
     if(ii == standardVolumeElements.size())
-      standardVolumeElements.push_back(CFEMStandardElement(VTK_Parent, nPolyGrid,
-                                                           true, config));
+      standardVolumeElements.push_back(&CFEMStandardElement::GetStandardElement(VTK_Parent, nPolyGrid,
+                                                                                true, config));
 
     /* Determine the necessary data for splitting the element in its linear
        sub-elements. */
-    unsigned short VTK_Type[]  = {standardVolumeElements[ii].GetVTK_Type1(),
-                                  standardVolumeElements[ii].GetVTK_Type2()};
+    unsigned short VTK_Type[]  = {standardVolumeElements[ii]->GetVTK_Type1(),
+                                  standardVolumeElements[ii]->GetVTK_Type2()};
     unsigned short nSubElems[] = {0, 0};
     unsigned short nDOFsPerSubElem[] = {0, 0};
     const unsigned short *connSubElems[] = {nullptr, nullptr};
 
     if(VTK_Type[0] != NONE) {
-      nSubElems[0]       = standardVolumeElements[ii].GetNSubElemsType1();
-      nDOFsPerSubElem[0] = standardVolumeElements[ii].GetNDOFsPerSubElem(VTK_Type[0]);
-      connSubElems[0]    = standardVolumeElements[ii].GetSubConnType1();
+      nSubElems[0]       = standardVolumeElements[ii]->GetNSubElemsType1();
+      nDOFsPerSubElem[0] = standardVolumeElements[ii]->GetNDOFsPerSubElem(VTK_Type[0]);
+      connSubElems[0]    = standardVolumeElements[ii]->GetSubConnType1();
     }
 
     if(VTK_Type[1] != NONE) {
-      nSubElems[1]       = standardVolumeElements[ii].GetNSubElemsType2();
-      nDOFsPerSubElem[1] = standardVolumeElements[ii].GetNDOFsPerSubElem(VTK_Type[1]);
-      connSubElems[1]    = standardVolumeElements[ii].GetSubConnType2();
+      nSubElems[1]       = standardVolumeElements[ii]->GetNSubElemsType2();
+      nDOFsPerSubElem[1] = standardVolumeElements[ii]->GetNDOFsPerSubElem(VTK_Type[1]);
+      connSubElems[1]    = standardVolumeElements[ii]->GetSubConnType2();
     }
 
     /* Store the connectivity of the sub-elements. Note that local node
@@ -4665,7 +4665,7 @@ void CPhysicalGeometry::ComputeFEMGraphWeights(
 
   /*--- Define the standard elements for the volume elements, the boundary faces
         and the matching internal faces. ---*/
-  vector<CFEMStandardElement>      standardElements;
+  vector<const CFEMStandardElement*> standardElements;
   vector<CFEMStandardBoundaryFace> standardBoundaryFaces;
   vector<CFEMStandardInternalFace> standardMatchingFaces;
 
@@ -4693,17 +4693,17 @@ void CPhysicalGeometry::ComputeFEMGraphWeights(
 
     unsigned long ii;
     for(ii=0; ii<standardElements.size(); ++ii) {
-      if( standardElements[ii].SameStandardElement(VTK_Type, nPolySol,
-                                                   JacIsConstant) ) break;
+      if( standardElements[ii]->SameStandardElement(VTK_Type, nPolySol,
+                                                    JacIsConstant) ) break;
     }
 
     if(ii == standardElements.size())
-      standardElements.push_back(CFEMStandardElement(VTK_Type, nPolySol,
-                                                     JacIsConstant, config));
+      standardElements.push_back(&CFEMStandardElement::GetStandardElement(VTK_Type, nPolySol,
+                                                                          JacIsConstant, config));
 
     /* Initialize the computational work for this element, which is stored
        in the 1st vertex weight. */
-    vwgt[ind0] = standardElements[ii].WorkEstimateMetis(config);
+    vwgt[ind0] = standardElements[ii]->WorkEstimateMetis(config);
 
     /*------------------------------------------------------------------------*/
     /*--- Determine the computational weight of the surface integral in    ---*/
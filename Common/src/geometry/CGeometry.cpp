@@ -28,6 +28,7 @@
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/geometry/elements/CElement.hpp"
 #include "../../include/parallelization/omp_structure.hpp"
+#include "../../include/parallelization/vectorization.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/toolboxes/ndflattener.hpp"
 
@@ -39,7 +40,7 @@ CGeometry::CGeometry(void) :
 
 CGeometry::~CGeometry(void) {
 
-  unsigned long iElem, iElem_Bound, iVertex;
+  unsigned long iElem, iElem_Bound;
   unsigned short iMarker;
 
   if (elem != nullptr) {
@@ -63,10 +64,8 @@ CGeometry::~CGeometry(void) {
   delete edges;
 
   if (vertex != nullptr) {
+    /*--- The vertices themselves live in vertexPool. ---*/
     for (iMarker = 0; iMarker < nMarker; iMarker++) {
-      for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-        delete vertex[iMarker][iVertex];
-      }
       delete [] vertex[iMarker];
     }
     delete [] vertex;
@@ -98,12 +97,32 @@ CGeometry::~CGeometry(void) {
 
   /*--- Delete structures for MPI point-to-point communication. ---*/
 
+  FreePersistentP2PRequests();
+
+#ifdef HAVE_SHARED_MEMORY_COMMS
+  /*--- The su2double recv buffer lives inside the shared-memory window and
+   is released with it. Note that freeing the window is collective over the
+   node, like its creation. ---*/
+  if (winD_P2PRecv != MPI_WIN_NULL) {
+    MPI_Win_unlock_all(winD_P2PRecv);
+    MPI_Win_free(&winD_P2PRecv);
+    bufD_P2PRecv = nullptr;
+  }
+  if (nodeComm != MPI_COMM_NULL) MPI_Comm_free(&nodeComm);
+  delete [] NodeRank_P2PSend;
+  delete [] shmOffset_P2PSend;
+  delete [] shmBuf_P2PSend;
+#endif
+
   delete [] bufD_P2PRecv;
   delete [] bufD_P2PSend;
 
   delete [] bufS_P2PRecv;
   delete [] bufS_P2PSend;
 
+  delete [] bufF_P2PRecv;
+  delete [] bufF_P2PSend;
+
   delete [] req_P2PSend;
   delete [] req_P2PRecv;
 
@@ -340,6 +359,66 @@ void CGeometry::PreprocessP2PComms(CGeometry *geometry,
     }
   }
 
+#ifdef HAVE_SHARED_MEMORY_COMMS
+
+  /*--- Identify the neighbors that share the node with this rank. Their
+   su2double messages bypass the network stack: the sender copies the packed
+   data straight into the recv buffer of the destination through a shared-
+   memory window, and only an empty notification message goes through MPI.
+   Off-node messages are unaffected. ---*/
+
+  if (nodeComm == MPI_COMM_NULL)
+    MPI_Comm_split_type(SU2_MPI::GetComm(), MPI_COMM_TYPE_SHARED, rank,
+                        MPI_INFO_NULL, &nodeComm);
+
+  MPI_Group worldGroup, nodeGroup;
+  MPI_Comm_group(SU2_MPI::GetComm(), &worldGroup);
+  MPI_Comm_group(nodeComm, &nodeGroup);
+
+  /*--- Translate the neighbor ranks into node-local ranks, neighbors on
+   other nodes are flagged with MPI_UNDEFINED (negative). ---*/
+
+  NodeRank_P2PSend = new int[nP2PSend];
+  MPI_Group_translate_ranks(worldGroup, nP2PSend, Neighbors_P2PSend,
+                            nodeGroup, NodeRank_P2PSend);
+
+  int *nodeRankRecv = new int[nP2PRecv];
+  MPI_Group_translate_ranks(worldGroup, nP2PRecv, Neighbors_P2PRecv,
+                            nodeGroup, nodeRankRecv);
+
+  MPI_Group_free(&worldGroup);
+  MPI_Group_free(&nodeGroup);
+
+  /*--- Tell each on-node neighbor where its message starts inside our recv
+   buffer. The offset is stored in points, which is invariant under the
+   packet size, so this exchange is needed only once. ---*/
+
+  shmOffset_P2PSend = new unsigned long[nP2PSend] ();
+  shmBuf_P2PSend    = new su2double*[nP2PSend] ();
+
+  vector<SU2_MPI::Request> shmReq;
+  vector<unsigned long> recvStart(nP2PRecv);
+
+  for (iRecv = 0; iRecv < nP2PRecv; iRecv++) {
+    if (nodeRankRecv[iRecv] < 0) continue;
+    recvStart[iRecv] = nPoint_P2PRecv[iRecv];
+    shmReq.push_back(SU2_MPI::Request());
+    SU2_MPI::Isend(&recvStart[iRecv], 1, MPI_UNSIGNED_LONG, Neighbors_P2PRecv[iRecv],
+                   rank, SU2_MPI::GetComm(), &shmReq.back());
+  }
+
+  for (iSend = 0; iSend < nP2PSend; iSend++) {
+    if (NodeRank_P2PSend[iSend] < 0) continue;
+    SU2_MPI::Recv(&shmOffset_P2PSend[iSend], 1, MPI_UNSIGNED_LONG, Neighbors_P2PSend[iSend],
+                  Neighbors_P2PSend[iSend], SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
+  }
+
+  SU2_MPI::Waitall(int(shmReq.size()), shmReq.data(), MPI_STATUSES_IGNORE);
+
+  delete [] nodeRankRecv;
+
+#endif
+
   /*--- In the future, some additional data structures could be created
    here to separate the interior and boundary nodes in order to help
    further overlap computation and communication. ---*/
@@ -355,35 +434,173 @@ void CGeometry::AllocateP2PComms(unsigned short countPerPoint) {
    reallocate a large enough array. Note that after the first set
    communications, this routine will not need to be called again. ---*/
 
-  if (countPerPoint <= maxCountPerPoint) return;
+  if ((countPerPoint <= maxCountPerPoint)
+#ifdef HAVE_PERSISTENT_COMMS
+      && (persistReq_P2PRecv.count(countPerPoint) == 1)
+#endif
+     ) return;
 
   SU2_OMP_BARRIER
   SU2_OMP_MASTER {
 
+  if (countPerPoint > maxCountPerPoint) {
+
   /*--- Store the larger packet size to the class data. ---*/
 
   maxCountPerPoint = countPerPoint;
 
+  /*--- The persistent channels are bound to the current buffers,
+   free them before the reallocation invalidates the addresses. ---*/
+
+  FreePersistentP2PRequests();
+
   /*-- Deallocate and reallocate our su2double cummunication memory. ---*/
 
   delete [] bufD_P2PSend;
   bufD_P2PSend = new su2double[maxCountPerPoint*nPoint_P2PSend[nP2PSend]] ();
 
+#ifdef HAVE_SHARED_MEMORY_COMMS
+
+  /*--- The su2double recv buffer is placed in a shared-memory window so
+   that on-node neighbors can write their messages directly. Resizing the
+   window is collective over the node, which is safe because all ranks
+   issue the same sequence of comms and grow their buffers in lock step. ---*/
+
+  if (winD_P2PRecv != MPI_WIN_NULL) {
+    MPI_Win_unlock_all(winD_P2PRecv);
+    MPI_Win_free(&winD_P2PRecv);
+    bufD_P2PRecv = nullptr;
+  }
+
+  const MPI_Aint numBytes = sizeof(su2double)*maxCountPerPoint*nPoint_P2PRecv[nP2PRecv];
+  MPI_Win_allocate_shared(numBytes, sizeof(su2double), MPI_INFO_NULL,
+                          nodeComm, &bufD_P2PRecv, &winD_P2PRecv);
+  memset(bufD_P2PRecv, 0, numBytes);
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, winD_P2PRecv);
+
+  /*--- The direct copies rely on the unified memory model, in which the
+   empty notification message provides the necessary ordering. Fall back
+   to plain MPI messages if the implementation does not support it. ---*/
+
+  int *winModel = nullptr; int winFlag = 0;
+  MPI_Win_get_attr(winD_P2PRecv, MPI_WIN_MODEL, &winModel, &winFlag);
+  shmCommsActive = (winFlag != 0) && (*winModel == MPI_WIN_UNIFIED);
+
+  /*--- Query the base address of the recv buffer of each on-node neighbor. ---*/
+
+  for (int iSend = 0; iSend < nP2PSend; iSend++) {
+    shmBuf_P2PSend[iSend] = nullptr;
+    if (shmCommsActive && (NodeRank_P2PSend[iSend] >= 0)) {
+      MPI_Aint winSize; int dispUnit;
+      MPI_Win_shared_query(winD_P2PRecv, NodeRank_P2PSend[iSend], &winSize,
+                           &dispUnit, &shmBuf_P2PSend[iSend]);
+    }
+  }
+
+  /*--- Make sure every rank on the node is done initializing its buffer
+   before any neighbor starts writing into it. ---*/
+
+  MPI_Barrier(nodeComm);
+
+#else
+
   delete [] bufD_P2PRecv;
   bufD_P2PRecv = new su2double[maxCountPerPoint*nPoint_P2PRecv[nP2PRecv]] ();
 
+#endif
+
   delete [] bufS_P2PSend;
   bufS_P2PSend = new unsigned short[maxCountPerPoint*nPoint_P2PSend[nP2PSend]] ();
 
   delete [] bufS_P2PRecv;
   bufS_P2PRecv = new unsigned short[maxCountPerPoint*nPoint_P2PRecv[nP2PRecv]] ();
 
+  delete [] bufF_P2PSend;
+  bufF_P2PSend = new float[maxCountPerPoint*nPoint_P2PSend[nP2PSend]] ();
+
+  delete [] bufF_P2PRecv;
+  bufF_P2PRecv = new float[maxCountPerPoint*nPoint_P2PRecv[nP2PRecv]] ();
+
+  }
+
+  BuildPersistentP2PRequests(countPerPoint);
+
   }
   END_SU2_OMP_MASTER
   SU2_OMP_BARRIER
 
 }
 
+void CGeometry::BuildPersistentP2PRequests(unsigned short countPerPoint) {
+
+#ifdef HAVE_PERSISTENT_COMMS
+
+  /*--- Set up the forward su2double communication with each neighbor as a
+   persistent channel so that the repeated exchanges of an iteration only
+   pay the request setup cost (matching, buffer registration, etc.) once.
+   Each packet size addresses the shared buffers at different offsets and
+   therefore needs its own set of channels. The reversed (adjoint) and
+   unsigned short comms are rare and keep the non-persistent path. ---*/
+
+  if (persistReq_P2PRecv.count(countPerPoint) == 1) return;
+
+  auto& sendReq = persistReq_P2PSend[countPerPoint];
+  sendReq.reset(new SU2_MPI::Request[nP2PSend]);
+
+  for (int iSend = 0; iSend < nP2PSend; iSend++) {
+    auto offset = countPerPoint*nPoint_P2PSend[iSend];
+    auto count  = countPerPoint*(nPoint_P2PSend[iSend+1] - nPoint_P2PSend[iSend]);
+#ifdef HAVE_SHARED_MEMORY_COMMS
+    /*--- On-node messages travel through the shared-memory window, the MPI
+     message is reduced to an empty notification (a recv posted with the
+     full count matches a shorter message). ---*/
+    if (shmBuf_P2PSend[iSend] != nullptr) count = 0;
+#endif
+    SU2_MPI::Send_init(&(bufD_P2PSend[offset]), count, MPI_DOUBLE, Neighbors_P2PSend[iSend],
+                       rank+1, SU2_MPI::GetComm(), &(sendReq[iSend]));
+  }
+
+  auto& recvReq = persistReq_P2PRecv[countPerPoint];
+  recvReq.reset(new SU2_MPI::Request[nP2PRecv]);
+
+  for (int iRecv = 0; iRecv < nP2PRecv; iRecv++) {
+    auto offset = countPerPoint*nPoint_P2PRecv[iRecv];
+    auto count  = countPerPoint*(nPoint_P2PRecv[iRecv+1] - nPoint_P2PRecv[iRecv]);
+    auto source = Neighbors_P2PRecv[iRecv];
+    SU2_MPI::Recv_init(&(bufD_P2PRecv[offset]), count, MPI_DOUBLE, source,
+                       source+1, SU2_MPI::GetComm(), &(recvReq[iRecv]));
+  }
+
+#endif
+
+}
+
+void CGeometry::FreePersistentP2PRequests() {
+
+#ifdef HAVE_PERSISTENT_COMMS
+
+  for (auto& reqs : persistReq_P2PSend)
+    for (int iSend = 0; iSend < nP2PSend; iSend++)
+      SU2_MPI::Request_free(&(reqs.second[iSend]));
+  persistReq_P2PSend.clear();
+
+  for (auto& reqs : persistReq_P2PRecv)
+    for (int iRecv = 0; iRecv < nP2PRecv; iRecv++)
+      SU2_MPI::Request_free(&(reqs.second[iRecv]));
+  persistReq_P2PRecv.clear();
+
+#endif
+
+}
+
+void CGeometry::FlushSharedRecvWindow() const {
+
+#ifdef HAVE_SHARED_MEMORY_COMMS
+  if (shmCommsActive) MPI_Win_sync(winD_P2PRecv);
+#endif
+
+}
+
 void CGeometry::PostP2PRecvs(CGeometry *geometry,
                              const CConfig *config,
                              unsigned short commType,
@@ -394,6 +611,27 @@ void CGeometry::PostP2PRecvs(CGeometry *geometry,
    the counts and sources, so we can launch these before we even load
    the data and send from the neighbor ranks. ---*/
 
+#ifdef HAVE_PERSISTENT_COMMS
+
+  /*--- The forward su2double comms use the persistent channels created in
+   AllocateP2PComms for this packet size. The requests are copied into the
+   generic request array so that the dynamic Waitany of the complete
+   routines works unchanged (a persistent request becomes inactive, not
+   null, once it has been waited on). ---*/
+
+  if (!val_reverse && (commType == COMM_TYPE_DOUBLE)) {
+    SU2_OMP_MASTER {
+      auto* recvReq = persistReq_P2PRecv.at(countPerPoint).get();
+      SU2_MPI::Startall(nP2PRecv, recvReq);
+      for (int iRecv = 0; iRecv < nP2PRecv; iRecv++)
+        req_P2PRecv[iRecv] = recvReq[iRecv];
+    }
+    END_SU2_OMP_MASTER
+    return;
+  }
+
+#endif
+
   SU2_OMP_MASTER
   for (int iRecv = 0; iRecv < nP2PRecv; iRecv++) {
     const auto iMessage = iRecv;
@@ -434,6 +672,10 @@ void CGeometry::PostP2PRecvs(CGeometry *geometry,
           SU2_MPI::Irecv(&(bufD_P2PSend[offset]), count, MPI_DOUBLE,
                          source, tag, SU2_MPI::GetComm(), &(req_P2PRecv[iRecv]));
           break;
+        case COMM_TYPE_FLOAT:
+          SU2_MPI::Irecv(&(bufF_P2PSend[offset]), count, MPI_FLOAT,
+                         source, tag, SU2_MPI::GetComm(), &(req_P2PRecv[iRecv]));
+          break;
         case COMM_TYPE_UNSIGNED_SHORT:
           SU2_MPI::Irecv(&(bufS_P2PSend[offset]), count, MPI_UNSIGNED_SHORT,
                          source, tag, SU2_MPI::GetComm(), &(req_P2PRecv[iRecv]));
@@ -471,6 +713,10 @@ void CGeometry::PostP2PRecvs(CGeometry *geometry,
           SU2_MPI::Irecv(&(bufD_P2PRecv[offset]), count, MPI_DOUBLE,
                          source, tag, SU2_MPI::GetComm(), &(req_P2PRecv[iMessage]));
           break;
+        case COMM_TYPE_FLOAT:
+          SU2_MPI::Irecv(&(bufF_P2PRecv[offset]), count, MPI_FLOAT,
+                         source, tag, SU2_MPI::GetComm(), &(req_P2PRecv[iMessage]));
+          break;
         case COMM_TYPE_UNSIGNED_SHORT:
           SU2_MPI::Irecv(&(bufS_P2PRecv[offset]), count, MPI_UNSIGNED_SHORT,
                          source, tag, SU2_MPI::GetComm(), &(req_P2PRecv[iMessage]));
@@ -497,6 +743,42 @@ void CGeometry::PostP2PSends(CGeometry *geometry,
 
   /*--- Post the non-blocking send as soon as the buffer is loaded. ---*/
 
+#ifdef HAVE_PERSISTENT_COMMS
+
+  /*--- The forward su2double comms use the persistent channels created in
+   AllocateP2PComms, see also PostP2PRecvs. ---*/
+
+  if (!val_reverse && (commType == COMM_TYPE_DOUBLE)) {
+    SU2_OMP_MASTER {
+
+#ifdef HAVE_SHARED_MEMORY_COMMS
+
+      /*--- If the destination shares the node, copy the packed message
+       straight into its recv buffer through the shared-memory window. The
+       empty notification message started below carries the synchronization,
+       the window is flushed before it so that the data is visible to the
+       destination when the notification arrives. ---*/
+
+      if (shmBuf_P2PSend[val_iSend] != nullptr) {
+        const auto nElem = countPerPoint*(nPoint_P2PSend[val_iSend+1] - nPoint_P2PSend[val_iSend]);
+        const su2double *src = &(bufD_P2PSend[countPerPoint*nPoint_P2PSend[val_iSend]]);
+        su2double *dst = shmBuf_P2PSend[val_iSend] + countPerPoint*shmOffset_P2PSend[val_iSend];
+        memcpy(dst, src, nElem*sizeof(su2double));
+        MPI_Win_sync(winD_P2PRecv);
+      }
+
+#endif
+
+      auto* sendReq = persistReq_P2PSend.at(countPerPoint).get();
+      SU2_MPI::Start(&(sendReq[val_iSend]));
+      req_P2PSend[val_iSend] = sendReq[val_iSend];
+    }
+    END_SU2_OMP_MASTER
+    return;
+  }
+
+#endif
+
   /*--- In some instances related to the adjoint solver, we need
    to reverse the direction of communications such that the normal
    send nodes become the recv nodes and vice-versa. ---*/
@@ -534,6 +816,10 @@ void CGeometry::PostP2PSends(CGeometry *geometry,
         SU2_MPI::Isend(&(bufD_P2PRecv[offset]), count, MPI_DOUBLE,
                        dest, tag, SU2_MPI::GetComm(), &(req_P2PSend[val_iSend]));
         break;
+      case COMM_TYPE_FLOAT:
+        SU2_MPI::Isend(&(bufF_P2PRecv[offset]), count, MPI_FLOAT,
+                       dest, tag, SU2_MPI::GetComm(), &(req_P2PSend[val_iSend]));
+        break;
       case COMM_TYPE_UNSIGNED_SHORT:
         SU2_MPI::Isend(&(bufS_P2PRecv[offset]), count, MPI_UNSIGNED_SHORT,
                        dest, tag, SU2_MPI::GetComm(), &(req_P2PSend[val_iSend]));
@@ -571,6 +857,10 @@ void CGeometry::PostP2PSends(CGeometry *geometry,
         SU2_MPI::Isend(&(bufD_P2PSend[offset]), count, MPI_DOUBLE,
                        dest, tag, SU2_MPI::GetComm(), &(req_P2PSend[val_iSend]));
         break;
+      case COMM_TYPE_FLOAT:
+        SU2_MPI::Isend(&(bufF_P2PSend[offset]), count, MPI_FLOAT,
+                       dest, tag, SU2_MPI::GetComm(), &(req_P2PSend[val_iSend]));
+        break;
       case COMM_TYPE_UNSIGNED_SHORT:
         SU2_MPI::Isend(&(bufS_P2PSend[offset]), count, MPI_UNSIGNED_SHORT,
                        dest, tag, SU2_MPI::GetComm(), &(req_P2PSend[val_iSend]));
@@ -625,8 +915,6 @@ void CGeometry::InitiateComms(CGeometry *geometry,
                               const CConfig *config,
                               unsigned short commType) const {
 
-  if (nP2PSend == 0) return;
-
   /*--- Local variables ---*/
 
   unsigned short iDim;
@@ -644,10 +932,14 @@ void CGeometry::InitiateComms(CGeometry *geometry,
   /*--- Check to make sure we have created a large enough buffer
    for these comms during preprocessing. This is only for the su2double
    buffer. It will be reallocated whenever we find a larger count
-   per point. After the first cycle of comms, this should be inactive. ---*/
+   per point. After the first cycle of comms, this should be inactive.
+   Note that the reallocation may be collective and therefore has to be
+   reached also by ranks without any messages to send. ---*/
 
   geometry->AllocateP2PComms(COUNT_PER_POINT);
 
+  if (nP2PSend == 0) return;
+
   /*--- Set some local pointers to make access simpler. ---*/
 
   su2double *bufDSend      = geometry->bufD_P2PSend;
@@ -763,8 +1055,10 @@ void CGeometry::CompleteComms(CGeometry *geometry,
     /*--- For efficiency, recv the messages dynamically based on
      the order they arrive. ---*/
 
-    SU2_OMP_MASTER
-    SU2_MPI::Waitany(nP2PRecv, req_P2PRecv, &ind, &status);
+    SU2_OMP_MASTER {
+      SU2_MPI::Waitany(nP2PRecv, req_P2PRecv, &ind, &status);
+      FlushSharedRecvWindow();
+    }
     END_SU2_OMP_MASTER
     SU2_OMP_BARRIER
 
@@ -1409,6 +1703,165 @@ void CGeometry::SetEdges(void) {
       }
     }
   }
+
+  /*--- For thread-parallel runs, renumber the edges such that the edges of each
+   *    color occupy a contiguous range. The colored loops then stream the edge
+   *    based data (nodes, normals, fluxes, etc.) with unit stride instead of
+   *    gathering it with an average stride equal to the number of colors, which
+   *    wastes most of each cache line. Within a color the ascending node order
+   *    of the edges is preserved. This has to happen here, before anything else
+   *    (dual grid quantities, sparse pattern maps, etc.) references the edge
+   *    indices. The coloring is stored for GetEdgeColoring. ---*/
+
+  if (omp_get_max_threads() > 1 && edgeColorGroupSize < nEdge && nEdge > 0) {
+
+    /*--- Create a temporary sparse pattern from the edges. ---*/
+
+    su2vector<unsigned long> outerPtr(nEdge+1);
+    su2vector<unsigned long> innerIdx(nEdge*2);
+
+    for (auto iEdge = 0ul; iEdge < nEdge; ++iEdge) {
+      outerPtr(iEdge) = 2*iEdge;
+      innerIdx(iEdge*2+0) = edges->GetNode(iEdge,0);
+      innerIdx(iEdge*2+1) = edges->GetNode(iEdge,1);
+    }
+    outerPtr(nEdge) = 2*nEdge;
+
+    CCompressedSparsePatternUL pattern(move(outerPtr), move(innerIdx));
+
+    /*--- Select the group size automatically if so requested, here so that the
+     *    renumbering below already uses the tuned coloring. ---*/
+
+    if (edgeColorAutoTune) {
+      edgeColorGroupSize = TuneEdgeColorGroupSize(pattern);
+      edgeColorAutoTune = false;
+    }
+
+    /*--- Color the edges, on failure keep the natural numbering
+     *    (GetEdgeColoring puts a fallback in place). ---*/
+
+    constexpr bool balanceColors = true;
+    auto coloring = colorSparsePattern(pattern, edgeColorGroupSize, balanceColors);
+
+    if (!coloring.empty()) {
+
+      /*--- The edges listed color after color define the new numbering. ---*/
+
+      vector<unsigned long> sequence(coloring.innerIdx(), coloring.innerIdx()+nEdge);
+
+      /*--- For vectorized edge loops, additionally reorder the edges such that
+       *    SIMD-width packets of consecutive edges do not share nodes. The SIMD
+       *    kernels scatter their fluxes lane by lane, and when two lanes of a
+       *    packet hit the same node the stores serialize on the same address,
+       *    conflict-free packets remove that overhead. The reordering must stay
+       *    within each group of the coloring since only edges of different
+       *    groups (same color) are guaranteed not to conflict across threads,
+       *    and groups are a multiple of the SIMD length when vectorization is
+       *    in use, so the packets the edge loops draw never straddle groups. ---*/
+
+      constexpr auto simdLen = simd::preferredLen<su2double>();
+
+      if (edgeColorPackSIMD && (simdLen > 1)) {
+
+        vector<unsigned long> groupEdges, deferred, packNodes;
+
+        auto shareNode = [&](unsigned long iEdge) {
+          for (auto node : packNodes)
+            if ((node == edges->GetNode(iEdge,0)) || (node == edges->GetNode(iEdge,1))) return true;
+          return false;
+        };
+
+        for (auto iColor = 0ul; iColor < coloring.getOuterSize(); ++iColor) {
+
+          const auto colorEnd = coloring.outerPtr()[iColor+1];
+
+          for (auto begin = coloring.outerPtr()[iColor]; begin < colorEnd; begin += edgeColorGroupSize) {
+
+            const auto end = min(begin+edgeColorGroupSize, colorEnd);
+
+            groupEdges.assign(sequence.begin()+begin, sequence.begin()+end);
+            deferred.clear();
+
+            auto in = groupEdges.begin();
+            auto out = sequence.begin()+begin;
+            size_t lane = 0;
+
+            auto place = [&](unsigned long iEdge) {
+              *(out++) = iEdge;
+              packNodes.push_back(edges->GetNode(iEdge,0));
+              packNodes.push_back(edges->GetNode(iEdge,1));
+              ++lane;
+            };
+
+            while ((in != groupEdges.end()) || !deferred.empty()) {
+
+              /*--- Open a packet, first retrying the edges deferred by earlier packets. ---*/
+
+              lane = 0;
+              packNodes.clear();
+
+              for (size_t i = 0; (i < deferred.size()) && (lane < simdLen);) {
+                if (!shareNode(deferred[i])) {
+                  place(deferred[i]);
+                  deferred.erase(deferred.begin()+i);
+                }
+                else ++i;
+              }
+
+              /*--- Fill the rest of the packet in order, deferring conflicting edges. ---*/
+
+              while ((lane < simdLen) && (in != groupEdges.end())) {
+                if (shareNode(*in)) deferred.push_back(*in);
+                else place(*in);
+                ++in;
+              }
+
+              /*--- If the group is exhausted, pad with deferred (conflicting) edges to
+               *    keep the packets aligned, the lane-by-lane update of the linear
+               *    system remains correct for such (now rare) packets. ---*/
+
+              while ((lane < simdLen) && (in == groupEdges.end()) && !deferred.empty()) {
+                place(deferred.front());
+                deferred.erase(deferred.begin());
+              }
+            }
+          }
+        }
+      }
+
+      vector<unsigned long> newIdx(nEdge);
+      for (auto k = 0ul; k < nEdge; ++k) newIdx[sequence[k]] = k;
+
+      /*--- Permute the edge-to-node connectivity. ---*/
+
+      auto newEdges = new CEdge(nEdge,nDim);
+      for (auto iEdge = 0ul; iEdge < nEdge; ++iEdge) {
+        newEdges->SetNodes(newIdx[iEdge], edges->GetNode(iEdge,0), edges->GetNode(iEdge,1));
+      }
+      delete edges;
+      edges = newEdges;
+
+      /*--- Update the node-to-edge connectivity. ---*/
+
+      for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+        for (auto iNode = 0u; iNode < nodes->GetnPoint(iPoint); iNode++) {
+          nodes->SetEdge(iPoint, newIdx[nodes->GetEdge(iPoint, iNode)], iNode);
+        }
+      }
+
+      /*--- With the new numbering the coloring is simply made of
+       *    contiguous ranges of edges. ---*/
+
+      su2vector<unsigned long> colorPtr(coloring.getOuterSize()+1);
+      for (auto iColor = 0ul; iColor <= coloring.getOuterSize(); ++iColor)
+        colorPtr(iColor) = coloring.outerPtr()[iColor];
+
+      su2vector<unsigned long> colorIdx(nEdge);
+      std::iota(colorIdx.data(), colorIdx.data()+nEdge, 0ul);
+
+      edgeColoring = CCompressedSparsePatternUL(move(colorPtr), move(colorIdx));
+    }
+  }
 }
 
 void CGeometry::SetFaces(void) {
@@ -1729,6 +2182,46 @@ void CGeometry::ComputeAirfoil_Section(su2double *Plane_P0, su2double *Plane_Nor
     Plane_Normal[0] = 0.0;  Plane_Normal[1] = 1.0;  Plane_Normal[2] = 0.0;
   }
 
+  /*--- On static meshes the set of boundary elements cut by a plane does not
+   change between calls, look it up so that repeated extractions of the same
+   section only visit those elements instead of scanning the whole boundary. ---*/
+
+  const bool useSectionCache = !config->GetDynamic_Grid() && !config->GetDeform_Mesh();
+
+  CSectionCandidates* sectionEntry = nullptr;
+  bool sectionHit = false;
+
+  if (useSectionCache) {
+    for (auto& entry : sectionCandidates) {
+      bool match = true;
+      for (iDim = 0; iDim < 3; iDim++) {
+        match = match && (entry.Plane_P0[iDim] == Plane_P0[iDim])
+                      && (entry.Plane_Normal[iDim] == Plane_Normal[iDim]);
+      }
+      match = match && (entry.BBox[0] == MinXCoord) && (entry.BBox[1] == MaxXCoord)
+                    && (entry.BBox[2] == MinYCoord) && (entry.BBox[3] == MaxYCoord)
+                    && (entry.BBox[4] == MinZCoord) && (entry.BBox[5] == MaxZCoord)
+                    && (entry.original_surface == original_surface);
+      if (match) {
+        sectionEntry = &entry;
+        sectionHit = true;
+        break;
+      }
+    }
+    if (!sectionHit) {
+      sectionCandidates.emplace_back();
+      sectionEntry = &sectionCandidates.back();
+      for (iDim = 0; iDim < 3; iDim++) {
+        sectionEntry->Plane_P0[iDim] = Plane_P0[iDim];
+        sectionEntry->Plane_Normal[iDim] = Plane_Normal[iDim];
+      }
+      sectionEntry->BBox[0] = MinXCoord;  sectionEntry->BBox[1] = MaxXCoord;
+      sectionEntry->BBox[2] = MinYCoord;  sectionEntry->BBox[3] = MaxYCoord;
+      sectionEntry->BBox[4] = MinZCoord;  sectionEntry->BBox[5] = MaxZCoord;
+      sectionEntry->original_surface = original_surface;
+    }
+  }
+
   /*--- Grid movement is stored using a vertices information,
    we should go from vertex to points ---*/
 
@@ -1751,11 +2244,13 @@ void CGeometry::ComputeAirfoil_Section(su2double *Plane_P0, su2double *Plane_Nor
 
   }
 
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+  /*--- Process a single boundary element, returns whether it contributed an
+   intersection with the plane (i.e. whether it is a candidate for reuse). ---*/
 
-    if (config->GetMarker_All_GeoEval(iMarker) == YES) {
+  auto ProcessElement = [&](unsigned short val_marker, unsigned long val_elem) {
 
-      for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
+        const unsigned short iMarker = val_marker;
+        const unsigned long iElem = val_elem;
 
         PointIndex=0;
 
@@ -1895,6 +2390,24 @@ void CGeometry::ComputeAirfoil_Section(su2double *Plane_P0, su2double *Plane_Nor
             }
           }
         }
+
+        return (PointIndex > 0);
+  };
+
+  if (sectionHit) {
+
+    /*--- Only revisit the elements that intersected this plane before. ---*/
+
+    for (const auto& candidate : sectionEntry->elems)
+      ProcessElement(candidate.first, candidate.second);
+  }
+  else {
+
+    for (iMarker = 0; iMarker < nMarker; iMarker++) {
+      if (config->GetMarker_All_GeoEval(iMarker) != YES) continue;
+      for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
+        if (ProcessElement(iMarker, iElem) && (sectionEntry != nullptr))
+          sectionEntry->elems.emplace_back(iMarker, iElem);
       }
     }
   }
@@ -3681,6 +4194,48 @@ const su2vector<unsigned long>& CGeometry::GetTransposeSparsePatternMap(Connecti
   return pattern.transposePtr();
 }
 
+unsigned long CGeometry::TuneEdgeColorGroupSize(const CCompressedSparsePatternUL& pattern) const
+{
+  const int nThreads = omp_get_max_threads();
+
+  /*--- Candidate group sizes, the efficiency of each resulting coloring is a
+   static model of the thread load balance, the locality argument favors the
+   largest group size that stays close to the best observed efficiency. ---*/
+
+  const unsigned long candidates[] = {64, 128, 256, 512, 1024, 2048};
+  constexpr int nCandidates = sizeof(candidates)/sizeof(candidates[0]);
+  constexpr passivedouble efficiencyMargin = 0.9;
+
+  su2double eff[nCandidates] = {0.0};
+  su2double bestEff = 0.0;
+
+  for (int i = 0; i < nCandidates; ++i) {
+    const auto coloring = colorSparsePattern(pattern, candidates[i], true);
+    if (coloring.empty()) continue;
+    eff[i] = coloringEfficiency(coloring, nThreads, candidates[i]);
+    bestEff = max(bestEff, eff[i]);
+  }
+
+  /*--- Nothing could be colored, let the caller handle the fallback. ---*/
+
+  if (bestEff <= 0.0) return edgeColorGroupSize;
+
+  unsigned long groupSize = candidates[0];
+  su2double groupEff = eff[0];
+  for (int i = 0; i < nCandidates; ++i) {
+    if (eff[i] >= efficiencyMargin*bestEff) {
+      groupSize = candidates[i];
+      groupEff = eff[i];
+    }
+  }
+
+  if ((rank == MASTER_NODE) && (MGLevel == MESH_0))
+    cout << "Edge coloring group size set to " << groupSize << " (efficiency " << groupEff
+         << "), set EDGE_COLORING_GROUP_SIZE to reuse it." << endl;
+
+  return groupSize;
+}
+
 const CCompressedSparsePatternUL& CGeometry::GetEdgeColoring(su2double* efficiency)
 {
   /*--- Check for dry run mode with dummy geometry. ---*/
@@ -3709,6 +4264,12 @@ const CCompressedSparsePatternUL& CGeometry::GetEdgeColoring(su2double* efficien
 
     CCompressedSparsePatternUL pattern(move(outerPtr), move(innerIdx));
 
+    /*--- Select the group size automatically if so requested. ---*/
+    if (edgeColorAutoTune) {
+      edgeColorGroupSize = TuneEdgeColorGroupSize(pattern);
+      edgeColorAutoTune = false;
+    }
+
     /*--- Color the edges. ---*/
     constexpr bool balanceColors = true;
     edgeColoring = colorSparsePattern(pattern, edgeColorGroupSize, balanceColors);
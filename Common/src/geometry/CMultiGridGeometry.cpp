@@ -545,6 +545,7 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry *fine_grid, CConfig *config, un
   }
 
   edgeColorGroupSize = config->GetEdgeColoringGroupSize();
+  edgeColorAutoTune = config->GetEdgeColoringAutoTune();
 
 }
 
@@ -837,8 +838,14 @@ void CMultiGridGeometry::SetVertex(const CGeometry *fine_grid, const CConfig *co
     }
   }
 
+  /*--- The vertices of each marker are stored contiguously (in vertex order) so
+   that boundary loops stream through memory, see CPhysicalGeometry::SetVertex. ---*/
+
+  vertexPool.clear();
+  vertexPool.resize(nMarker);
   for (iMarker = 0; iMarker < nMarker; iMarker++) {
     vertex[iMarker] = new CVertex* [fine_grid->GetnVertex(iMarker)+1];
+    vertexPool[iMarker].reserve(fine_grid->GetnVertex(iMarker)+1);
     nVertex[iMarker] = 0;
   }
 
@@ -856,7 +863,8 @@ void CMultiGridGeometry::SetVertex(const CGeometry *fine_grid, const CConfig *co
         for (iMarker = 0; iMarker < fine_grid->GetnMarker(); iMarker ++) {
           if ((fine_grid->nodes->GetVertex(iFinePoint, iMarker) != -1) && (nodes->GetVertex(iCoarsePoint, iMarker) == -1)) {
             iVertex = nVertex[iMarker];
-            vertex[iMarker][iVertex] = new CVertex(iCoarsePoint, nDim);
+            vertexPool[iMarker].emplace_back(iCoarsePoint, nDim);
+            vertex[iMarker][iVertex] = &vertexPool[iMarker].back();
             nodes->SetVertex(iCoarsePoint, iVertex, iMarker);
 
             /*--- Set the transformation to apply ---*/
@@ -920,44 +928,46 @@ void CMultiGridGeometry::MatchPeriodic(const CConfig *config, unsigned short val
 
 void CMultiGridGeometry::SetControlVolume(const CGeometry *fine_grid, unsigned short action) {
 
-  SU2_OMP_MASTER {
-
-  unsigned long iFinePoint, iCoarsePoint, iEdge, iParent;
-  long FineEdge, CoarseEdge;
-  unsigned short iChildren;
-  bool change_face_orientation;
-  su2double Coarse_Volume, Area;
+  /*--- Compute the area of the coarse volume, each coarse point only
+   reads the volumes of its own children. ---*/
 
-  /*--- Compute the area of the coarse volume ---*/
-  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++) {
-    nodes->SetVolume(iCoarsePoint, 0.0);
-    Coarse_Volume = 0.0;
-    for (iChildren = 0; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren ++) {
-      iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
+  SU2_OMP_FOR_STAT(roundUpDiv(nPoint, omp_get_max_threads()))
+  for (auto iCoarsePoint = 0ul; iCoarsePoint < nPoint; iCoarsePoint++) {
+    su2double Coarse_Volume = 0.0;
+    for (auto iChildren = 0u; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren++) {
+      const auto iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
       Coarse_Volume += fine_grid->nodes->GetVolume(iFinePoint);
     }
     nodes->SetVolume(iCoarsePoint, Coarse_Volume);
   }
+  END_SU2_OMP_FOR
 
   /*--- Update or not the values of faces at the edge ---*/
   if (action != ALLOCATE) {
-    edges->SetZeroValues();
+    SU2_OMP_MASTER {
+      edges->SetZeroValues();
+    } END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
   }
 
-  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++)
-    for (iChildren = 0; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren ++) {
-      iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
+  /*--- A coarse edge is only visited by the iteration of its larger point
+   (iParent < iCoarsePoint), so the accumulation of the face normals is
+   race-free and its order does not depend on the number of threads. ---*/
+
+  SU2_OMP_FOR_DYN(roundUpDiv(nPoint, 2*omp_get_max_threads()))
+  for (auto iCoarsePoint = 0ul; iCoarsePoint < nPoint; iCoarsePoint++) {
+    for (auto iChildren = 0u; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren++) {
+      const auto iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
 
       for (auto iFinePoint_Neighbor : fine_grid->nodes->GetPoints(iFinePoint)) {
-        iParent = fine_grid->nodes->GetParent_CV(iFinePoint_Neighbor);
+        const auto iParent = fine_grid->nodes->GetParent_CV(iFinePoint_Neighbor);
         if ((iParent != iCoarsePoint) && (iParent < iCoarsePoint)) {
 
-          FineEdge = fine_grid->FindEdge(iFinePoint, iFinePoint_Neighbor);
+          const auto FineEdge = fine_grid->FindEdge(iFinePoint, iFinePoint_Neighbor);
 
-          change_face_orientation = false;
-          if (iFinePoint < iFinePoint_Neighbor) change_face_orientation = true;
+          const bool change_face_orientation = (iFinePoint < iFinePoint_Neighbor);
 
-          CoarseEdge = FindEdge(iParent, iCoarsePoint);
+          const auto CoarseEdge = FindEdge(iParent, iCoarsePoint);
 
           const auto Normal = fine_grid->edges->GetNormal(FineEdge);
 
@@ -970,65 +980,97 @@ void CMultiGridGeometry::SetControlVolume(const CGeometry *fine_grid, unsigned s
         }
       }
     }
+  }
+  END_SU2_OMP_FOR
 
   /*--- Check if there is a normal with null area ---*/
 
-  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+  SU2_OMP_FOR_STAT(1024)
+  for (auto iEdge = 0ul; iEdge < nEdge; iEdge++) {
     const auto NormalFace = edges->GetNormal(iEdge);
-    Area = GeometryToolbox::Norm(nDim, NormalFace);
+    const su2double Area = GeometryToolbox::Norm(nDim, NormalFace);
     if (Area == 0.0) {
       su2double DefaultNormal[3] = {EPS*EPS};
       edges->SetNormal(iEdge, DefaultNormal);
     }
   }
+  END_SU2_OMP_FOR
+
+  /*--- Store the transfer operator in CSR form so that restrictions and
+   prolongations stream through contiguous indices and weights. The pattern
+   (parent-child relation) is fixed, the volume-ratio weights are refreshed
+   whenever the control volumes change (e.g. dynamic meshes). ---*/
+
+  if (action == ALLOCATE) {
+    SU2_OMP_MASTER {
+      su2vector<unsigned long> outerPtr(nPoint+1);
+      outerPtr(0) = 0;
+      for (auto iCoarsePoint = 0ul; iCoarsePoint < nPoint; iCoarsePoint++)
+        outerPtr(iCoarsePoint+1) = outerPtr(iCoarsePoint) + nodes->GetnChildren_CV(iCoarsePoint);
+
+      su2vector<unsigned long> innerIdx(outerPtr(nPoint));
+      for (auto iCoarsePoint = 0ul; iCoarsePoint < nPoint; iCoarsePoint++)
+        for (auto iChildren = 0u; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren++)
+          innerIdx(outerPtr(iCoarsePoint)+iChildren) = nodes->GetChildren_CV(iCoarsePoint, iChildren);
+
+      mgTransferPattern = CCompressedSparsePatternUL(move(outerPtr), move(innerIdx));
+      mgRestrictionWeight.resize(mgTransferPattern.getNumNonZeros());
+    } END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
 
+  SU2_OMP_FOR_STAT(roundUpDiv(nPoint, omp_get_max_threads()))
+  for (auto iCoarsePoint = 0ul; iCoarsePoint < nPoint; iCoarsePoint++) {
+    const su2double invVolume = 1.0 / nodes->GetVolume(iCoarsePoint);
+    const auto kEnd = mgTransferPattern.outerPtr()[iCoarsePoint+1];
+    for (auto k = mgTransferPattern.outerPtr()[iCoarsePoint]; k < kEnd; ++k)
+      mgRestrictionWeight(k) = fine_grid->nodes->GetVolume(mgTransferPattern.innerIdx()[k]) * invVolume;
   }
-  END_SU2_OMP_MASTER
-  SU2_OMP_BARRIER
+  END_SU2_OMP_FOR
 }
 
 void CMultiGridGeometry::SetBoundControlVolume(const CGeometry *fine_grid, unsigned short action) {
 
-  SU2_OMP_MASTER {
-
-  unsigned long iCoarsePoint, iFinePoint, FineVertex, iVertex;
-  unsigned short iMarker, iChildren, iDim;
-  su2double *Normal, Area, *NormalFace = nullptr;
-
-  Normal = new su2double [nDim];
-
   if (action != ALLOCATE) {
-    for (iMarker = 0; iMarker < nMarker; iMarker++)
-      for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
+    for (auto iMarker = 0u; iMarker < nMarker; iMarker++) {
+      SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+      for (auto iVertex = 0ul; iVertex < nVertex[iMarker]; iVertex++)
         vertex[iMarker][iVertex]->SetZeroValues();
+      END_SU2_OMP_FOR
+    }
   }
 
-  for (iMarker = 0; iMarker < nMarker; iMarker ++)
-    for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-      iCoarsePoint = vertex[iMarker][iVertex]->GetNode();
-      for (iChildren = 0; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren ++) {
-        iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
-        if (fine_grid->nodes->GetVertex(iFinePoint, iMarker)!=-1) {
-          FineVertex = fine_grid->nodes->GetVertex(iFinePoint, iMarker);
+  /*--- Each coarse vertex accumulates the normals of the fine vertices of
+   its children, writing only to its own normal. ---*/
+
+  for (auto iMarker = 0u; iMarker < nMarker; iMarker++) {
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (auto iVertex = 0ul; iVertex < nVertex[iMarker]; iVertex++) {
+      const auto iCoarsePoint = vertex[iMarker][iVertex]->GetNode();
+      for (auto iChildren = 0u; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren++) {
+        const auto iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
+        if (fine_grid->nodes->GetVertex(iFinePoint, iMarker) != -1) {
+          const auto FineVertex = fine_grid->nodes->GetVertex(iFinePoint, iMarker);
+          su2double Normal[MAXNDIM] = {0.0};
           fine_grid->vertex[iMarker][FineVertex]->GetNormal(Normal);
           vertex[iMarker][iVertex]->AddNormal(Normal);
         }
       }
     }
-
-  delete[] Normal;
+    END_SU2_OMP_FOR
+  }
 
   /*--- Check if there is a normal with null area ---*/
-  for (iMarker = 0; iMarker < nMarker; iMarker ++)
-    for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-      NormalFace = vertex[iMarker][iVertex]->GetNormal();
-      Area = GeometryToolbox::Norm(nDim, NormalFace);
-      if (Area == 0.0) for (iDim = 0; iDim < nDim; iDim++) NormalFace[iDim] = EPS*EPS;
-    }
 
+  for (auto iMarker = 0u; iMarker < nMarker; iMarker++) {
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (auto iVertex = 0ul; iVertex < nVertex[iMarker]; iVertex++) {
+      const auto NormalFace = vertex[iMarker][iVertex]->GetNormal();
+      const su2double Area = GeometryToolbox::Norm(nDim, NormalFace);
+      if (Area == 0.0) for (auto iDim = 0u; iDim < nDim; iDim++) NormalFace[iDim] = EPS*EPS;
+    }
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_MASTER
-  SU2_OMP_BARRIER
 }
 
 void CMultiGridGeometry::SetCoord(const CGeometry *fine_grid) {
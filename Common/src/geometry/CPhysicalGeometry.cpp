@@ -51,6 +51,8 @@
 #include <iterator>
 #include <unordered_set>
 #include <queue>
+#include <cstdint>
+#include <limits>
 #ifdef _MSC_VER
 #include <direct.h>
 #endif
@@ -61,6 +63,8 @@ CPhysicalGeometry::CPhysicalGeometry() : CGeometry() { }
 CPhysicalGeometry::CPhysicalGeometry(CConfig *config, unsigned short val_iZone, unsigned short val_nZone) : CGeometry() {
 
   edgeColorGroupSize = config->GetEdgeColoringGroupSize();
+  edgeColorAutoTune = config->GetEdgeColoringAutoTune();
+  edgeColorPackSIMD = config->GetUseVectorization();
 
   string text_line, Marker_Tag;
   ifstream mesh_file;
@@ -186,6 +190,8 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry,
                                      CConfig *config) : CGeometry() {
 
   edgeColorGroupSize = config->GetEdgeColoringGroupSize();
+  edgeColorAutoTune = config->GetEdgeColoringAutoTune();
+  edgeColorPackSIMD = config->GetUseVectorization();
 
   /*--- The new geometry class has the same problem dimension/zone. ---*/
 
@@ -467,10 +473,28 @@ CPhysicalGeometry::~CPhysicalGeometry(void) {
 }
 
 void CPhysicalGeometry::SetGlobal_to_Local_Point(void) {
-  Global_to_Local_Point.clear();
-  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    Global_to_Local_Point[nodes->GetGlobalIndex(iPoint)] = iPoint;
+  Global_to_Local_Point.resize(nPointDomain);
+  SU2_OMP_PARALLEL_(if(nPointDomain > 10000)) {
+    SU2_OMP_FOR_STAT(8192)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      Global_to_Local_Point[iPoint] = make_pair(nodes->GetGlobalIndex(iPoint), iPoint);
+    }
+    END_SU2_OMP_FOR
   }
+  END_SU2_OMP_PARALLEL
+  SortGlobalToLocalPoint();
+}
+
+void CPhysicalGeometry::SortGlobalToLocalPoint(void) {
+
+  sort(Global_to_Local_Point.begin(), Global_to_Local_Point.end());
+
+  /*--- Before a graph-based redistribution the global indices owned by a rank form a
+   *    contiguous range (linear partitioning), in which case lookups can be direct
+   *    accesses instead of binary searches. ---*/
+  Global_to_Local_Contiguous = !Global_to_Local_Point.empty() &&
+    (Global_to_Local_Point.back().first - Global_to_Local_Point.front().first + 1 ==
+     Global_to_Local_Point.size());
 }
 
 void CPhysicalGeometry::DistributeColoring(const CConfig *config,
@@ -2190,8 +2214,10 @@ void CPhysicalGeometry::LoadPoints(CConfig *config, CGeometry *geometry) {
   /*--- Create the global to local mapping, which will be useful for loading
    the elements and boundaries in subsequent steps. ---*/
 
+  Global_to_Local_Point.resize(nPoint);
   for (iPoint = 0; iPoint < nPoint; iPoint++)
-    Global_to_Local_Point[Local_to_Global_Point[iPoint]] = iPoint;
+    Global_to_Local_Point[iPoint] = make_pair(Local_to_Global_Point[iPoint], iPoint);
+  SortGlobalToLocalPoint();
 
   /*--- Set the value of Global_nPoint and Global_nPointDomain ---*/
 
@@ -2301,7 +2327,7 @@ void CPhysicalGeometry::LoadVolumeElements(CConfig *config, CGeometry *geometry)
     NODES_PER_ELEMENT = N_POINTS_TRIANGLE;
     for (iNode = 0; iNode < NODES_PER_ELEMENT; iNode++) {
       iGlobal_Index      = Conn_Tria[iElem*NODES_PER_ELEMENT+iNode];
-      Local_Nodes[iNode] = Global_to_Local_Point[iGlobal_Index];
+      Local_Nodes[iNode] = GetGlobal_to_Local_Point(iGlobal_Index);
     }
 
     /*--- Create the element object. ---*/
@@ -2333,7 +2359,7 @@ void CPhysicalGeometry::LoadVolumeElements(CConfig *config, CGeometry *geometry)
     NODES_PER_ELEMENT = N_POINTS_QUADRILATERAL;
     for (iNode = 0; iNode < NODES_PER_ELEMENT; iNode++) {
       iGlobal_Index      = Conn_Quad[iElem*NODES_PER_ELEMENT+iNode];
-      Local_Nodes[iNode] = Global_to_Local_Point[iGlobal_Index];
+      Local_Nodes[iNode] = GetGlobal_to_Local_Point(iGlobal_Index);
     }
 
     /*--- Create the element object. ---*/
@@ -2366,7 +2392,7 @@ void CPhysicalGeometry::LoadVolumeElements(CConfig *config, CGeometry *geometry)
     NODES_PER_ELEMENT = N_POINTS_TETRAHEDRON;
     for (iNode = 0; iNode < NODES_PER_ELEMENT; iNode++) {
       iGlobal_Index      = Conn_Tetr[iElem*NODES_PER_ELEMENT+iNode];
-      Local_Nodes[iNode] = Global_to_Local_Point[iGlobal_Index];
+      Local_Nodes[iNode] = GetGlobal_to_Local_Point(iGlobal_Index);
     }
 
     /*--- Create the element object. ---*/
@@ -2399,7 +2425,7 @@ void CPhysicalGeometry::LoadVolumeElements(CConfig *config, CGeometry *geometry)
     NODES_PER_ELEMENT = N_POINTS_HEXAHEDRON;
     for (iNode = 0; iNode < NODES_PER_ELEMENT; iNode++) {
       iGlobal_Index      = Conn_Hexa[iElem*NODES_PER_ELEMENT+iNode];
-      Local_Nodes[iNode] = Global_to_Local_Point[iGlobal_Index];
+      Local_Nodes[iNode] = GetGlobal_to_Local_Point(iGlobal_Index);
     }
 
     /*--- Create the element object. ---*/
@@ -2436,7 +2462,7 @@ void CPhysicalGeometry::LoadVolumeElements(CConfig *config, CGeometry *geometry)
     NODES_PER_ELEMENT = N_POINTS_PRISM;
     for (iNode = 0; iNode < NODES_PER_ELEMENT; iNode++) {
       iGlobal_Index      = Conn_Pris[iElem*NODES_PER_ELEMENT+iNode];
-      Local_Nodes[iNode] = Global_to_Local_Point[iGlobal_Index];
+      Local_Nodes[iNode] = GetGlobal_to_Local_Point(iGlobal_Index);
     }
 
     /*--- Create the element object. ---*/
@@ -2471,7 +2497,7 @@ void CPhysicalGeometry::LoadVolumeElements(CConfig *config, CGeometry *geometry)
     NODES_PER_ELEMENT = N_POINTS_PYRAMID;
     for (iNode = 0; iNode < NODES_PER_ELEMENT; iNode++) {
       iGlobal_Index      = Conn_Pyra[iElem*NODES_PER_ELEMENT+iNode];
-      Local_Nodes[iNode] = Global_to_Local_Point[iGlobal_Index];
+      Local_Nodes[iNode] = GetGlobal_to_Local_Point(iGlobal_Index);
     }
 
     /*--- Create the element object. ---*/
@@ -2717,7 +2743,7 @@ void CPhysicalGeometry::LoadSurfaceElements(CConfig *config, CGeometry *geometry
       NODES_PER_ELEMENT = N_POINTS_LINE;
       for (iNode = 0; iNode < NODES_PER_ELEMENT; iNode++) {
         iGlobal_Index      = Conn_Line[iElem*NODES_PER_ELEMENT+iNode];
-        Local_Nodes[iNode] = Global_to_Local_Point[iGlobal_Index];
+        Local_Nodes[iNode] = GetGlobal_to_Local_Point(iGlobal_Index);
       }
 
       /*--- Create the geometry object for this element. ---*/
@@ -2749,7 +2775,7 @@ void CPhysicalGeometry::LoadSurfaceElements(CConfig *config, CGeometry *geometry
       NODES_PER_ELEMENT = N_POINTS_TRIANGLE;
       for (iNode = 0; iNode < NODES_PER_ELEMENT; iNode++) {
         iGlobal_Index      = Conn_BoundTria[iElem*NODES_PER_ELEMENT+iNode];
-        Local_Nodes[iNode] = Global_to_Local_Point[iGlobal_Index];
+        Local_Nodes[iNode] = GetGlobal_to_Local_Point(iGlobal_Index);
       }
 
       /*--- Create the geometry object for this element. ---*/
@@ -2782,7 +2808,7 @@ void CPhysicalGeometry::LoadSurfaceElements(CConfig *config, CGeometry *geometry
       NODES_PER_ELEMENT = N_POINTS_QUADRILATERAL;
       for (iNode = 0; iNode < NODES_PER_ELEMENT; iNode++) {
         iGlobal_Index      = Conn_BoundQuad[iElem*NODES_PER_ELEMENT+iNode];
-        Local_Nodes[iNode] = Global_to_Local_Point[iGlobal_Index];
+        Local_Nodes[iNode] = GetGlobal_to_Local_Point(iGlobal_Index);
       }
 
       /*--- Create the geometry object for this element. ---*/
@@ -3190,8 +3216,6 @@ void CPhysicalGeometry::SetSendReceive(const CConfig *config) {
   vector<vector<unsigned long> > SendDomainLocal;       /*!< \brief SendDomain[from domain][to domain] and return the point index of the node that must me sended. */
   vector<vector<unsigned long> > ReceivedDomainLocal;   /*!< \brief SendDomain[from domain][to domain] and return the point index of the node that must me sended. */
 
-  unordered_map<unsigned long, unsigned long>::const_iterator MI;
-
   if (rank == MASTER_NODE && size > SINGLE_NODE)
     cout << "Establishing MPI communication patterns." << endl;
 
@@ -3266,8 +3290,10 @@ void CPhysicalGeometry::SetSendReceive(const CConfig *config) {
   }
 
   /*--- Set the value of some of the points ---*/
+  Global_to_Local_Point.resize(nPoint);
   for (iPoint = 0; iPoint < nPoint; iPoint++)
-    Global_to_Local_Point[Local_to_Global_Point[iPoint]] = iPoint;
+    Global_to_Local_Point[iPoint] = make_pair(Local_to_Global_Point[iPoint], iPoint);
+  SortGlobalToLocalPoint();
 
   /*--- Add the new MPI send boundaries, reset the transformation,
    and save the local value. ---*/
@@ -3277,9 +3303,8 @@ void CPhysicalGeometry::SetSendReceive(const CConfig *config) {
       nVertexDomain[nMarker] = SendDomainLocal[iDomain].size();
       for (iVertex = 0; iVertex < nVertexDomain[nMarker]; iVertex++) {
 
-        MI = Global_to_Local_Point.find(SendDomainLocal[iDomain][iVertex]);
-        if (MI != Global_to_Local_Point.end())
-          iPoint = Global_to_Local_Point[SendDomainLocal[iDomain][iVertex]];
+        const long Local_Point = GetGlobal_to_Local_Point(SendDomainLocal[iDomain][iVertex]);
+        if (Local_Point >= 0) iPoint = Local_Point;
         else iPoint = std::numeric_limits<unsigned long>::max();
 
         SendDomainLocal[iDomain][iVertex] = iPoint;
@@ -3297,9 +3322,8 @@ void CPhysicalGeometry::SetSendReceive(const CConfig *config) {
       nVertexDomain[nMarker] = ReceivedDomainLocal[iDomain].size();
       for (iVertex = 0; iVertex < nVertexDomain[nMarker]; iVertex++) {
 
-        MI = Global_to_Local_Point.find(ReceivedDomainLocal[iDomain][iVertex]);
-        if (MI != Global_to_Local_Point.end())
-          iPoint = Global_to_Local_Point[ReceivedDomainLocal[iDomain][iVertex]];
+        const long Local_Point = GetGlobal_to_Local_Point(ReceivedDomainLocal[iDomain][iVertex]);
+        if (Local_Point >= 0) iPoint = Local_Point;
         else iPoint = std::numeric_limits<unsigned long>::max();
 
         ReceivedDomainLocal[iDomain][iVertex] = iPoint;
@@ -4681,75 +4705,226 @@ void CPhysicalGeometry::SetPositive_ZArea(CConfig *config) {
 
 void CPhysicalGeometry::SetPoint_Connectivity() {
 
-  vector<vector<unsigned long> > points(nPoint);
+  /*--- Both adjacencies are assembled directly in compressed (CSR) format
+   with count-offset-fill passes, nested per-point vectors would cost nPoint
+   small allocations which dominate the setup time of large meshes. ---*/
+
+  su2vector<unsigned long> pointPtr(nPoint+1);
+  su2vector<unsigned long> pointIdx;
 
   SU2_OMP_PARALLEL
   {
-  unsigned short Node_Neighbor, iNode, iNeighbor;
-  unsigned long jElem, Point_Neighbor, iPoint, iElem;
+  unsigned long iPoint, iElem;
 
-  /*--- Loop over all the elements ---*/
+  /*--- Build the point-element adjacency: count the elements of each point,
+   convert the counts to offsets, then fill the indices. ---*/
   SU2_OMP_MASTER
   {
-    vector<vector<long> > elems(nPoint);
+    su2vector<long> elemPtr(nPoint+1);
+    for (iPoint = 0; iPoint <= nPoint; iPoint++) elemPtr(iPoint) = 0;
 
-    for (iElem = 0; iElem < nElem; iElem++) {
+    for (iElem = 0; iElem < nElem; iElem++)
+      for (unsigned short iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++)
+        ++elemPtr(elem[iElem]->GetNode(iNode)+1);
 
-      /*--- Loop over all the nodes of an element ---*/
-      for (iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++) {
-        iPoint = elem[iElem]->GetNode(iNode);
-        elems[iPoint].push_back(iElem);
-      }
-    }
-    nodes->SetElems(elems);
+    for (iPoint = 0; iPoint < nPoint; iPoint++) elemPtr(iPoint+1) += elemPtr(iPoint);
+
+    su2vector<long> elemIdx(elemPtr(nPoint));
+    vector<long> cursor(nPoint);
+    for (iPoint = 0; iPoint < nPoint; iPoint++) cursor[iPoint] = elemPtr(iPoint);
+
+    for (iElem = 0; iElem < nElem; iElem++)
+      for (unsigned short iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++)
+        elemIdx(cursor[elem[iElem]->GetNode(iNode)]++) = iElem;
+
+    nodes->SetElems(CCompressedSparsePatternL(std::move(elemPtr), std::move(elemIdx)));
   }
   END_SU2_OMP_MASTER
   SU2_OMP_BARRIER
 
-  /*--- Loop over all the points ---*/
+  /*--- Gather the unique points surrounding a point via the elements shared
+   by the point, into a scratch vector that is reused across points. ---*/
 
-  SU2_OMP_FOR_DYN(roundUpDiv(nPoint,2*omp_get_max_threads()))
-  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+  vector<unsigned long> neighbors;
 
-    /*--- Loop over all elements shared by the point ---*/
+  auto collectNeighbors = [&](unsigned long iPoint_) {
+    neighbors.clear();
 
-    for (iElem = 0; iElem < nodes->GetnElem(iPoint); iElem++) {
+    for (unsigned long nElem_ = 0; nElem_ < nodes->GetnElem(iPoint_); nElem_++) {
 
-      jElem = nodes->GetElem(iPoint, iElem);
+      const auto jElem = nodes->GetElem(iPoint_, nElem_);
 
       /*--- If we find the point iPoint in the surronding element ---*/
 
-      for (iNode = 0; iNode < elem[jElem]->GetnNodes(); iNode++) {
+      for (unsigned short iNode = 0; iNode < elem[jElem]->GetnNodes(); iNode++) {
 
-        if (elem[jElem]->GetNode(iNode) != iPoint) continue;
+        if (elem[jElem]->GetNode(iNode) != iPoint_) continue;
 
         /*--- Localize the local index of the neighbor of iPoint in the element ---*/
 
-        for (iNeighbor = 0; iNeighbor < elem[jElem]->GetnNeighbor_Nodes(iNode); iNeighbor++) {
-          Node_Neighbor = elem[jElem]->GetNeighbor_Nodes(iNode, iNeighbor);
-          Point_Neighbor = elem[jElem]->GetNode(Node_Neighbor);
+        for (unsigned short iNeighbor = 0; iNeighbor < elem[jElem]->GetnNeighbor_Nodes(iNode); iNeighbor++) {
+          const auto Node_Neighbor = elem[jElem]->GetNeighbor_Nodes(iNode, iNeighbor);
+          const auto Point_Neighbor = elem[jElem]->GetNode(Node_Neighbor);
 
           /*--- Store the point into the point, if it is new ---*/
-          auto End = points[iPoint].end();
-          if (find(points[iPoint].begin(), End, Point_Neighbor) == End)
-            points[iPoint].push_back(Point_Neighbor);
+          const auto End = neighbors.end();
+          if (find(neighbors.begin(), End, Point_Neighbor) == End)
+            neighbors.push_back(Point_Neighbor);
         }
       }
     }
+  };
+
+  /*--- First pass, count the neighbors of each point. ---*/
+
+  SU2_OMP_FOR_DYN(roundUpDiv(nPoint,2*omp_get_max_threads()))
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    collectNeighbors(iPoint);
+    pointPtr(iPoint+1) = neighbors.size();
 
     /*--- Set the number of neighbors variable, this is important for JST and multigrid in parallel. ---*/
-    nodes->SetnNeighbor(iPoint, points[iPoint].size());
+    nodes->SetnNeighbor(iPoint, neighbors.size());
   }
   END_SU2_OMP_FOR
 
+  /*--- Convert the counts to offsets and allocate the indices. ---*/
+
   SU2_OMP_MASTER
-  nodes->SetPoints(points);
+  {
+    pointPtr(0) = 0;
+    for (iPoint = 0; iPoint < nPoint; iPoint++) pointPtr(iPoint+1) += pointPtr(iPoint);
+    pointIdx.resize(pointPtr(nPoint));
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  /*--- Second pass, fill the indices. ---*/
+
+  SU2_OMP_FOR_DYN(roundUpDiv(nPoint,2*omp_get_max_threads()))
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    collectNeighbors(iPoint);
+    auto offset = pointPtr(iPoint);
+    for (auto Point_Neighbor : neighbors) pointIdx(offset++) = Point_Neighbor;
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_MASTER
+  nodes->SetPoints(CCompressedSparsePatternUL(std::move(pointPtr), std::move(pointIdx)));
   END_SU2_OMP_MASTER
 
   }
   END_SU2_OMP_PARALLEL
 }
 
+namespace {
+
+/*--- Conversion of quantized coordinates ("bits" significant bits per axis)
+ * to the transposed Hilbert index, Skilling's AxestoTranspose algorithm
+ * ("Programming the Hilbert curve", AIP Conf. Proc. 707, 2004). ---*/
+void HilbertAxesToTranspose(uint32_t* X, int bits, int nDim) {
+
+  for (uint32_t M = 1u << (bits-1); M > 1; M >>= 1) {
+    const uint32_t P = M - 1;
+    for (int i = 0; i < nDim; i++) {
+      if (X[i] & M) {
+        X[0] ^= P;
+      }
+      else {
+        const uint32_t t = (X[0] ^ X[i]) & P;
+        X[0] ^= t;
+        X[i] ^= t;
+      }
+    }
+  }
+
+  for (int i = 1; i < nDim; i++) X[i] ^= X[i-1];
+
+  uint32_t t = 0;
+  for (uint32_t M = 1u << (bits-1); M > 1; M >>= 1)
+    if (X[nDim-1] & M) t ^= M-1;
+  for (int i = 0; i < nDim; i++) X[i] ^= t;
+
+}
+
+/*--- Interleave the transposed Hilbert index into a single sort key. ---*/
+uint64_t HilbertTransposeToKey(const uint32_t* X, int bits, int nDim) {
+
+  uint64_t key = 0;
+  for (int b = bits-1; b >= 0; b--)
+    for (int i = 0; i < nDim; i++)
+      key = (key << 1) | ((X[i] >> b) & 1u);
+  return key;
+
+}
+
+/*--- Sort the owned points along a Hilbert curve through their coordinates,
+ * returning the permutation (new to old). Points that fall on the same curve
+ * location keep their relative order (stable sort). ---*/
+vector<unsigned long> HilbertPointOrder(const CPoint* nodes, unsigned long nPointDomain, unsigned short nDim) {
+
+  /*--- Bounding box of the owned points. ---*/
+
+  passivedouble minCoord[3] = {0.0}, maxCoord[3] = {0.0};
+
+  for (auto iDim = 0u; iDim < nDim; iDim++)
+    minCoord[iDim] = maxCoord[iDim] = SU2_TYPE::GetValue(nodes->GetCoord(0,iDim));
+
+  for (auto iPoint = 1ul; iPoint < nPointDomain; iPoint++) {
+    for (auto iDim = 0u; iDim < nDim; iDim++) {
+      const auto coord = SU2_TYPE::GetValue(nodes->GetCoord(iPoint,iDim));
+      minCoord[iDim] = min(minCoord[iDim], coord);
+      maxCoord[iDim] = max(maxCoord[iDim], coord);
+    }
+  }
+
+  /*--- Quantize the coordinates on a 2^BITS grid and compute the Hilbert
+   *    index of each owned point. ---*/
+
+  constexpr int BITS = 20;
+
+  vector<pair<uint64_t,unsigned long> > order(nPointDomain);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    uint32_t X[3] = {0,0,0};
+    for (auto iDim = 0u; iDim < nDim; iDim++) {
+      const auto range = max(maxCoord[iDim]-minCoord[iDim], numeric_limits<passivedouble>::epsilon());
+      const auto frac = (SU2_TYPE::GetValue(nodes->GetCoord(iPoint,iDim))-minCoord[iDim]) / range;
+      X[iDim] = min<uint32_t>(frac * ((1u << BITS) - 1) + 0.5, (1u << BITS) - 1);
+    }
+    HilbertAxesToTranspose(X, BITS, nDim);
+    order[iPoint] = make_pair(HilbertTransposeToKey(X, BITS, nDim), iPoint);
+  }
+
+  stable_sort(order.begin(), order.end());
+
+  vector<unsigned long> Result;
+  Result.reserve(nPointDomain);
+  for (const auto& keyPoint : order) Result.push_back(keyPoint.second);
+
+  return Result;
+}
+
+}
+
+unsigned long CPhysicalGeometry::GetPointBandwidth(const vector<unsigned long>& position) const {
+
+  /*--- Maximum over the owned points of the index distance to their neighbors,
+   *    i.e. the half-bandwidth of the matrices built from this graph. ---*/
+
+  unsigned long bandwidth = 0;
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    const auto pos_i = position.empty()? iPoint : position[iPoint];
+    for (auto jPoint : nodes->GetPoints(iPoint)) {
+      if (jPoint >= nPointDomain) continue;
+      const auto pos_j = position.empty()? jPoint : position[jPoint];
+      bandwidth = max(bandwidth, (pos_i > pos_j)? pos_i-pos_j : pos_j-pos_i);
+    }
+  }
+  return bandwidth;
+
+}
+
 void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
 
   queue<unsigned long> Queue;
@@ -4828,6 +5003,50 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
     Result.push_back(iPoint);
   }
 
+  ApplyPointOrdering(config, Result);
+
+}
+
+void CPhysicalGeometry::SetHilbert_Ordering(CConfig *config) {
+
+  /*--- Sort the owned points along the curve, add the MPI points
+   *    and apply as in the RCM ordering. ---*/
+
+  auto Result = HilbertPointOrder(nodes, nPointDomain, nDim);
+  Result.reserve(nPoint);
+
+  for (auto iPoint = nPointDomain; iPoint < nPoint; iPoint++) Result.push_back(iPoint);
+
+  ApplyPointOrdering(config, Result);
+
+}
+
+void CPhysicalGeometry::SetSFCIterationOrder() {
+
+  /*--- Same curve as SetHilbert_Ordering, but stored as an iteration order
+   *    instead of renumbering the points, so that mesh, restart and output
+   *    indices are untouched. Point loops that follow this order visit
+   *    neighborhoods together, improving the locality of indirect accesses. ---*/
+
+  SFCOrder = HilbertPointOrder(nodes, nPointDomain, nDim);
+
+}
+
+void CPhysicalGeometry::ApplyPointOrdering(CConfig *config, const vector<unsigned long>& Result) {
+
+  /*--- Report the bandwidth reduction achieved by the renumbering. ---*/
+
+  vector<unsigned long> position(nPoint);
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) position[Result[iPoint]] = iPoint;
+
+  unsigned long bandwidth[2] = {GetPointBandwidth(vector<unsigned long>()), GetPointBandwidth(position)};
+  unsigned long globalBandwidth[2] = {0,0};
+  SU2_MPI::Reduce(bandwidth, globalBandwidth, 2, MPI_UNSIGNED_LONG, MPI_MAX, MASTER_NODE, SU2_MPI::GetComm());
+
+  if (rank == MASTER_NODE)
+    cout << "Maximum point half-bandwidth reduced from " << globalBandwidth[0]
+         << " to " << globalBandwidth[1] << "." << endl;
+
   /*--- Reset old data structures ---*/
 
   nodes->ResetElems();
@@ -5012,11 +5231,17 @@ void CPhysicalGeometry::SetVertex(const CConfig *config) {
       nodes->SetVertex(iPoint, -1, iMarker);
 
   /*--- Create the bound vertex structure, note that the order
-   is the same as in the input file, this is important for Send/Receive part ---*/
+   is the same as in the input file, this is important for Send/Receive part.
+   The vertices of each marker are stored contiguously (in vertex order) so
+   that boundary loops stream through memory instead of chasing scattered
+   heap allocations, the pointer-based interface is unchanged. ---*/
 
   vertex = new CVertex**[nMarker];
+  vertexPool.clear();
+  vertexPool.resize(nMarker);
   for (iMarker = 0; iMarker < nMarker; iMarker++) {
     vertex[iMarker] = new CVertex* [nVertex[iMarker]];
+    vertexPool[iMarker].reserve(nVertex[iMarker]);
     nVertex[iMarker] = 0;
 
     /*--- Initialize the number of Bound Vertex for each Marker ---*/
@@ -5029,7 +5254,8 @@ void CPhysicalGeometry::SetVertex(const CConfig *config) {
 
         if ((nodes->GetVertex(iPoint, iMarker) == -1) || (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE)) {
           iVertex = nVertex[iMarker];
-          vertex[iMarker][iVertex] = new CVertex(iPoint, nDim);
+          vertexPool[iMarker].emplace_back(iPoint, nDim);
+          vertex[iMarker][iVertex] = &vertexPool[iMarker].back();
 
           if (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) {
             vertex[iMarker][iVertex]->SetRotation_Type(bound[iMarker][iElem]->GetRotation_Type());
@@ -6659,8 +6885,8 @@ void CPhysicalGeometry::MatchActuator_Disk(const CConfig *config) {
   if (nMarker_ActDiskInlet != 0) {
 
     unsigned short iMarker, iDim;
-    unsigned long iVertex, iPoint, iPointGlobal, pPoint = 0, pPointGlobal = 0, pVertex = 0, pMarker = 0, jVertex, jVertex_, jPoint, jPointGlobal, jMarker;
-    su2double *Coord_i, Coord_j[3], dist = 0.0, mindist, maxdist_local = 0.0, maxdist_global = 0.0;
+    unsigned long iVertex, iPoint, iPointGlobal, pPoint = 0, pPointGlobal = 0, pVertex = 0, pMarker = 0, jVertex;
+    su2double *Coord_i, dist = 0.0, mindist, maxdist_local = 0.0, maxdist_global = 0.0;
     int iProcessor, pProcessor = 0;
     unsigned long nLocalVertex_ActDisk = 0, MaxLocalVertex_ActDisk = 0;
     int nProcessor = size;
@@ -6754,6 +6980,28 @@ void CPhysicalGeometry::MatchActuator_Disk(const CConfig *config) {
       SU2_MPI::Allgather(Buffer_Send_Vertex, nBuffer_Vertex, MPI_UNSIGNED_LONG, Buffer_Receive_Vertex, nBuffer_Vertex, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
       SU2_MPI::Allgather(Buffer_Send_Marker, nBuffer_Marker, MPI_UNSIGNED_LONG, Buffer_Receive_Marker, nBuffer_Marker, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
 
+      /*--- Build an ADT of the gathered donor points (excluding the padding
+       entries of the gather buffers), so that each beneficiary vertex finds
+       its donor with a logarithmic search instead of a scan over all the
+       donor vertices of all ranks. The flattened buffer index identifies
+       each donor in the receive buffers. ---*/
+
+      vector<su2double> donorCoord;
+      vector<unsigned long> donorIndex;
+      donorCoord.reserve(nProcessor*MaxLocalVertex_ActDisk*nDim);
+      donorIndex.reserve(nProcessor*MaxLocalVertex_ActDisk);
+
+      for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+        for (jVertex = 0; jVertex < Buffer_Receive_nVertex[iProcessor]; jVertex++) {
+          const auto iBuffer = iProcessor*MaxLocalVertex_ActDisk + jVertex;
+          for (iDim = 0; iDim < nDim; iDim++)
+            donorCoord.push_back(Buffer_Receive_Coord[iBuffer*nDim+iDim]);
+          donorIndex.push_back(iBuffer);
+        }
+      }
+
+      CADTPointsOnlyClass donorADT(nDim, donorIndex.size(), donorCoord.data(), donorIndex.data(), false);
+
       /*--- Compute the closest point to an actuator disk inlet point ---*/
 
       maxdist_local = 0.0;
@@ -6772,38 +7020,21 @@ void CPhysicalGeometry::MatchActuator_Disk(const CConfig *config) {
 
               Coord_i = nodes->GetCoord(iPoint); mindist = 1E6; pProcessor = 0; pPoint = 0;
 
-              /*--- Loop over all the boundaries to find the pair ---*/
+              /*--- Query the donor tree to find the pair ---*/
 
               Perimeter = false;
 
-              for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-                for (jVertex = 0; jVertex < Buffer_Receive_nVertex[iProcessor]; jVertex++) {
-                  jPoint = Buffer_Receive_Point[iProcessor*MaxLocalVertex_ActDisk+jVertex];
-                  jPointGlobal = Buffer_Receive_GlobalIndex[iProcessor*MaxLocalVertex_ActDisk+jVertex];
-                  jVertex_ = Buffer_Receive_Vertex[iProcessor*MaxLocalVertex_ActDisk+jVertex];
-                  jMarker = Buffer_Receive_Marker[iProcessor*MaxLocalVertex_ActDisk+jVertex];
-
- //                 if (jPointGlobal != iPointGlobal) {
- //                 ActDisk_Perimeter
-
-                    /*--- Compute the distance ---*/
-
-                    dist = 0.0;
-                    for (iDim = 0; iDim < nDim; iDim++) {
-                      Coord_j[iDim] = Buffer_Receive_Coord[(iProcessor*MaxLocalVertex_ActDisk+jVertex)*nDim+iDim];
-                      dist += pow(Coord_j[iDim]-Coord_i[iDim], 2.0);
-                    }
-                    dist = sqrt(dist);
-
-                    if (dist < mindist) {
-                      mindist = dist; pProcessor = iProcessor; pPoint = jPoint; pPointGlobal = jPointGlobal;
-                      pVertex = jVertex_; pMarker = jMarker;
-                      if (dist == 0.0) break;
-                    }
-
-//                  }
-//                  else { Perimeter = true; mindist = 0.0; dist = 0.0; break; }
-               }
+              if (!donorIndex.empty()) {
+                unsigned long iBuffer;
+                int rankADT;
+                donorADT.DetermineNearestNode(Coord_i, dist, iBuffer, rankADT);
+
+                mindist      = dist;
+                pProcessor   = int(iBuffer/MaxLocalVertex_ActDisk);
+                pPoint       = Buffer_Receive_Point[iBuffer];
+                pPointGlobal = Buffer_Receive_GlobalIndex[iBuffer];
+                pVertex      = Buffer_Receive_Vertex[iBuffer];
+                pMarker      = Buffer_Receive_Marker[iBuffer];
               }
 
               /*--- Store the value of the pair ---*/
@@ -7338,27 +7569,296 @@ void CPhysicalGeometry::FindUniqueNode_PeriodicBound(const CConfig *config) {
 
 }
 
+bool CPhysicalGeometry::LoadDualGridCache(CConfig *config) {
+
+  /*--- The dual grid metrics depend only on the mesh and its partitioning, a
+   design cycle (SU2_DEF, SU2_CFD, SU2_DOT) recomputes them three times on the
+   same mesh. With PARTITION_CACHE enabled the first tool stores them in a
+   sidecar file next to the mesh (see StoreDualGridCache) and the others load
+   them here. The cache is bypassed for the AD builds, which must record the
+   dependence of the metrics on the coordinates, and identifies the mesh the
+   same way as the partitioning cache, a stale or foreign file is recomputed.
+   The per-rank point and edge counts are also validated, so a coloring that
+   does not match the one the file was written with is detected. ---*/
+
+#if defined(HAVE_MPI) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+
+  static bool loaded;
+
+  SU2_OMP_MASTER {
+
+    loaded = false;
+
+    const string cacheName = config->GetMesh_FileName() + ".dualgrid." + to_string(size) + ".bin";
+
+    MPI_File fhw;
+    if (MPI_File_open(SU2_MPI::GetComm(), cacheName.c_str(), MPI_MODE_RDONLY,
+                      MPI_INFO_NULL, &fhw) == MPI_SUCCESS) {
+
+      unsigned long header[4] = {0};
+      MPI_File_read_at(fhw, 0, header, 4, MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE);
+
+      if ((header[0] == 535532) && (header[1] == Global_nPointDomain) &&
+          (header[2] == Global_nElem) && (header[3] == static_cast<unsigned long>(size))) {
+
+        /*--- Read the per-rank point and edge counts and check them against
+         the local layout, every rank must match or the file is discarded. ---*/
+
+        vector<unsigned long> counts(2*size);
+        MPI_File_read_at(fhw, 4*sizeof(unsigned long), counts.data(), 2*size,
+                         MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE);
+
+        int myMatch = (counts[2*rank] == nPoint) && (counts[2*rank+1] == nEdge);
+        int allMatch;
+        SU2_MPI::Allreduce(&myMatch, &allMatch, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+
+        if (allMatch) {
+
+          /*--- Each rank reads its block of point volumes and edge normals. ---*/
+
+          MPI_Offset disp = (4 + 2*size)*sizeof(unsigned long);
+          for (int iRank = 0; iRank < rank; iRank++)
+            disp += (counts[2*iRank] + counts[2*iRank+1]*nDim)*sizeof(passivedouble);
+
+          vector<passivedouble> buf(nPoint + nEdge*nDim);
+          MPI_File_read_at_all(fhw, disp, buf.data(), buf.size(), MPI_DOUBLE, MPI_STATUS_IGNORE);
+
+          su2double my_DomainVolume = 0.0;
+          for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+            nodes->SetVolume(iPoint, buf[iPoint]);
+            my_DomainVolume += buf[iPoint];
+          }
+
+          for (auto iEdge = 0ul; iEdge < nEdge; iEdge++)
+            edges->SetNormal(iEdge, &buf[nPoint + iEdge*nDim]);
+
+          /*--- The point volumes hold exactly the contributions of the local
+           elements, so their global sum is the domain volume. ---*/
+
+          su2double DomainVolume;
+          SU2_MPI::Allreduce(&my_DomainVolume, &DomainVolume, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+          config->SetDomainVolume(DomainVolume);
+
+          if (rank == MASTER_NODE)
+            cout << "Reusing the dual grid metrics stored in " << cacheName << "." << endl;
+
+          loaded = true;
+        }
+        else if (rank == MASTER_NODE)
+          cout << "Dual grid cache " << cacheName << " does not match the partitioning, recomputing." << endl;
+      }
+      else if (rank == MASTER_NODE)
+        cout << "Dual grid cache " << cacheName << " does not match the mesh, recomputing." << endl;
+
+      MPI_File_close(&fhw);
+    }
+
+  } END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  if (!loaded) return false;
+
+  /*--- The element loop was skipped, so the element CG coordinates, which a
+   number of downstream consumers (e.g. the multigrid agglomeration) expect to
+   be set here, are computed directly, this is a fraction of the cost of the
+   full metric accumulation. ---*/
+
+  SU2_OMP_FOR_STAT(1024)
+  for (auto iElem = 0ul; iElem < nElem; iElem++) {
+    array<const su2double*, N_POINTS_MAXIMUM> Coord;
+    for (unsigned short iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++)
+      Coord[iNode] = nodes->GetCoord(elem[iElem]->GetNode(iNode));
+    elem[iElem]->SetCoord_CG(nDim, Coord);
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Midpoint vector of each edge, as at the end of SetControlVolumeImpl. ---*/
+
+  SU2_OMP_FOR_STAT(1024)
+  for (auto iEdge = 0ul; iEdge < nEdge; iEdge++) {
+    edges->SetVector_ij(iEdge, nodes->GetCoord(edges->GetNode(iEdge,0)),
+                        nodes->GetCoord(edges->GetNode(iEdge,1)));
+  }
+  END_SU2_OMP_FOR
+
+  return true;
+
+#else
+  return false;
+#endif
+}
+
+void CPhysicalGeometry::StoreDualGridCache(const CConfig *config) const {
+
+#if defined(HAVE_MPI) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+
+  SU2_OMP_MASTER {
+
+    const string cacheName = config->GetMesh_FileName() + ".dualgrid." + to_string(size) + ".bin";
+
+    MPI_File fhw;
+    int ierr = MPI_File_open(SU2_MPI::GetComm(), cacheName.c_str(), MPI_MODE_CREATE|MPI_MODE_WRONLY,
+                             MPI_INFO_NULL, &fhw);
+    if (ierr == MPI_SUCCESS) {
+
+      unsigned long header[4] = {535532, Global_nPointDomain, Global_nElem,
+                                 static_cast<unsigned long>(size)};
+      if (rank == MASTER_NODE)
+        MPI_File_write_at(fhw, 0, header, 4, MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE);
+
+      /*--- Gather the per-rank point and edge counts, they give the file
+       offsets and let the readers validate their layout. ---*/
+
+      unsigned long myCounts[2] = {nPoint, nEdge};
+      vector<unsigned long> counts(2*size);
+      SU2_MPI::Allgather(myCounts, 2, MPI_UNSIGNED_LONG, counts.data(), 2,
+                         MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+      if (rank == MASTER_NODE)
+        MPI_File_write_at(fhw, 4*sizeof(unsigned long), counts.data(), 2*size,
+                          MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE);
+
+      MPI_Offset disp = (4 + 2*size)*sizeof(unsigned long);
+      for (int iRank = 0; iRank < rank; iRank++)
+        disp += (counts[2*iRank] + counts[2*iRank+1]*nDim)*sizeof(passivedouble);
+
+      vector<passivedouble> buf(nPoint + nEdge*nDim);
+      for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+        buf[iPoint] = SU2_TYPE::GetValue(nodes->GetVolume(iPoint));
+      for (auto iEdge = 0ul; iEdge < nEdge; iEdge++)
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          buf[nPoint + iEdge*nDim + iDim] = SU2_TYPE::GetValue(edges->GetNormal(iEdge)[iDim]);
+
+      MPI_File_write_at_all(fhw, disp, buf.data(), buf.size(), MPI_DOUBLE, MPI_STATUS_IGNORE);
+      MPI_File_close(&fhw);
+
+      if (rank == MASTER_NODE)
+        cout << "Stored the dual grid metrics in " << cacheName << "." << endl;
+    }
+    else if (rank == MASTER_NODE)
+      cout << "WARNING: Could not create the dual grid cache " << cacheName << "." << endl;
+
+  } END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+#endif
+}
+
 void CPhysicalGeometry::SetControlVolume(CConfig *config, unsigned short action) {
 
+  /*--- On the first setup the metrics may be available from the preprocessing
+   cache of a previous tool invocation on this mesh (e.g. within one design
+   cycle), and are stored for the next one otherwise. Dynamic grid updates
+   always recompute. ---*/
+
+  const bool useCache = (action == ALLOCATE) && config->GetPartition_Cache();
+
+  if (useCache && LoadDualGridCache(config)) return;
+
+  /*--- Dispatch to a compile-time dimension so that the inner loops have
+   constant trip counts and fully unroll, this code runs on every time step
+   for dynamic grids. ---*/
+
+  if (nDim == 2) SetControlVolumeImpl<2>(config, action);
+  else SetControlVolumeImpl<3>(config, action);
+
+  if (useCache) StoreDualGridCache(config);
+}
+
+void CPhysicalGeometry::UpdateControlVolume(CConfig *config, const vector<uint8_t>& pointMoved) {
+
+  /*--- Count how much of the mesh actually moved. The bookkeeping of a
+   restricted update stops paying off when roughly half the points moved,
+   beyond that do the plain full recomputation. ---*/
+
+  unsigned long nMoved = 0;
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) nMoved += pointMoved[iPoint];
+
+  if (nMoved == 0) return;
+
+  if (2*nMoved > nPoint) {
+    SetControlVolume(config, UPDATE);
+    return;
+  }
+
+  if (nDim == 2) SetControlVolumeImpl<2>(config, UPDATE, &pointMoved);
+  else SetControlVolumeImpl<3>(config, UPDATE, &pointMoved);
+}
+
+template<unsigned short NDIM>
+void CPhysicalGeometry::SetControlVolumeImpl(CConfig *config, unsigned short action,
+                                             const vector<uint8_t>* pointMoved) {
+
+  constexpr unsigned short nDim = NDIM;
+
+  /*--- Restricted update after a localized deformation: only elements with a
+   moved node change their contributions, so only the volumes of their points
+   and the normals of their edges have to be rebuilt. Every element writing
+   to one of those points or edges is re-evaluated, masked to the rebuilt
+   objects, so the metrics of the untouched region are preserved exactly. ---*/
+
+  const bool selective = (pointMoved != nullptr);
+
+  static vector<uint8_t> elemRerun, pointUpd, edgeUpd;
+
+  if (selective) {
+    SU2_OMP_MASTER {
+      elemRerun.assign(nElem, false);
+      pointUpd.assign(nPoint, false);
+      edgeUpd.assign(nEdge, false);
+
+      for (auto iElem = 0ul; iElem < nElem; iElem++) {
+        const auto nNodes = elem[iElem]->GetnNodes();
+
+        bool moved = false;
+        for (unsigned short iNode = 0; iNode < nNodes; iNode++)
+          moved = moved || (*pointMoved)[elem[iElem]->GetNode(iNode)];
+        if (!moved) continue;
+
+        elemRerun[iElem] = true;
+        for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+          const auto iPoint = elem[iElem]->GetNode(iNode);
+          pointUpd[iPoint] = true;
+          for (unsigned short jNode = iNode+1; jNode < nNodes; jNode++) {
+            const auto iEdge = FindEdge(iPoint, elem[iElem]->GetNode(jNode), false);
+            if (iEdge >= 0) edgeUpd[iEdge] = true;
+          }
+        }
+      }
+
+      /*--- Elements without a moved node also contribute to the rebuilt points
+       and edges, all of them contain a rebuilt point by construction. ---*/
+      for (auto iElem = 0ul; iElem < nElem; iElem++) {
+        if (elemRerun[iElem]) continue;
+        for (unsigned short iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++)
+          elemRerun[iElem] |= pointUpd[elem[iElem]->GetNode(iNode)];
+      }
+    } END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+
   /*--- Update values of faces of the edge ---*/
   if (action != ALLOCATE) {
     su2double ZeroArea[MAXNDIM] = {0.0};
 
     SU2_OMP_FOR_STAT(1024)
     for (auto iEdge = 0ul; iEdge < nEdge; iEdge++)
-      edges->SetNormal(iEdge, ZeroArea);
+      if (!selective || edgeUpd[iEdge]) edges->SetNormal(iEdge, ZeroArea);
     END_SU2_OMP_FOR
 
     SU2_OMP_FOR_STAT(1024)
     for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
-      nodes->SetVolume(iPoint, 0.0);
+      if (!selective || pointUpd[iPoint]) nodes->SetVolume(iPoint, 0.0);
     END_SU2_OMP_FOR
   }
 
-  SU2_OMP_MASTER { /*--- The following is difficult to parallelize with threads. ---*/
+  /*--- Lambda with the contribution of one element to the volumes of its
+   points and the normals of its edges, returns the volume the element
+   adds to the domain total. ---*/
 
-  su2double my_DomainVolume = 0.0;
-  for (auto iElem = 0ul; iElem < nElem; iElem++) {
+  auto elementContribution = [&](unsigned long iElem) {
+
+    su2double elemVolume = 0.0;
 
     const auto nNodes = elem[iElem]->GetnNodes();
 
@@ -7436,31 +7936,39 @@ void CPhysicalGeometry::SetControlVolume(CConfig *config, unsigned short action)
 
         su2double Volume_i, Volume_j;
 
+        /*--- In a restricted update the element may share some of its points
+         and edges with the untouched region, those keep their metrics. ---*/
+        const bool updEdge = !selective || edgeUpd[iEdge];
+
         if (nDim == 2) {
           /*--- Two dimensional problem ---*/
-          if (change_face_orientation)
-            edges->SetNodes_Coord(iEdge, Coord_Elem_CG, Coord_Edge_CG);
-          else
-            edges->SetNodes_Coord(iEdge, Coord_Edge_CG, Coord_Elem_CG);
+          if (updEdge) {
+            if (change_face_orientation)
+              edges->SetNodes_Coord(iEdge, Coord_Elem_CG, Coord_Edge_CG);
+            else
+              edges->SetNodes_Coord(iEdge, Coord_Edge_CG, Coord_Elem_CG);
+          }
 
           Volume_i = CEdge::GetVolume(Coord[face_iNode], Coord_Edge_CG, Coord_Elem_CG);
           Volume_j = CEdge::GetVolume(Coord[face_jNode], Coord_Edge_CG, Coord_Elem_CG);
         }
         else {
           /*--- Three dimensional problem ---*/
-          if (change_face_orientation)
-            edges->SetNodes_Coord(iEdge, Coord_FaceElem_CG, Coord_Edge_CG, Coord_Elem_CG);
-          else
-            edges->SetNodes_Coord(iEdge, Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
+          if (updEdge) {
+            if (change_face_orientation)
+              edges->SetNodes_Coord(iEdge, Coord_FaceElem_CG, Coord_Edge_CG, Coord_Elem_CG);
+            else
+              edges->SetNodes_Coord(iEdge, Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
+          }
 
           Volume_i = CEdge::GetVolume(Coord[face_iNode], Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
           Volume_j = CEdge::GetVolume(Coord[face_jNode], Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
         }
 
-        nodes->AddVolume(face_iPoint, Volume_i);
-        nodes->AddVolume(face_jPoint, Volume_j);
+        if (!selective || pointUpd[face_iPoint]) nodes->AddVolume(face_iPoint, Volume_i);
+        if (!selective || pointUpd[face_jPoint]) nodes->AddVolume(face_jPoint, Volume_j);
 
-        my_DomainVolume += Volume_i+Volume_j;
+        elemVolume += Volume_i+Volume_j;
       }
     }
 
@@ -7476,6 +7984,76 @@ void CPhysicalGeometry::SetControlVolume(CConfig *config, unsigned short action)
     }
 #endif
     AD::EndPreacc();
+
+    return elemVolume;
+  };
+
+  su2double my_DomainVolume = 0.0;
+
+#if defined(HAVE_OMP) && !defined(CODI_REVERSE_TYPE)
+
+  /*--- Elements of the same color do not share grid points, and therefore
+   do not share edges either, which makes the accumulation of volumes and
+   face normals race-free within each color. The contributions to a point
+   or edge always arrive in color order, so the result does not depend on
+   the number of threads. ---*/
+
+  SU2_OMP_MASTER {
+    GetElementColoring();
+  } END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  const auto& coloring = GetElementColoring();
+
+  for (auto iColor = 0ul; iColor < coloring.getOuterSize(); ++iColor) {
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, elemColorGroupSize))
+    for (auto k = 0ul; k < coloring.getNumNonZeros(iColor); ++k) {
+      const auto iElem = coloring.innerIdx(iColor)[k];
+      if (selective && !elemRerun[iElem]) continue;
+      my_DomainVolume += elementContribution(iElem);
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- Reduce the thread-local domain volumes into a shared total. ---*/
+
+  static su2double domainVolumeShared;
+  SU2_OMP_MASTER {
+    domainVolumeShared = 0.0;
+  } END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  SU2_OMP_CRITICAL {
+    domainVolumeShared += my_DomainVolume;
+  } END_SU2_OMP_CRITICAL
+  SU2_OMP_BARRIER
+
+  my_DomainVolume = domainVolumeShared;
+
+#else
+
+  /*--- The loop must remain sequential while recording the tape for the
+   discrete adjoint, the preaccumulation above is not thread-safe. ---*/
+
+  SU2_OMP_MASTER {
+    for (auto iElem = 0ul; iElem < nElem; iElem++) {
+      if (selective && !elemRerun[iElem]) continue;
+      my_DomainVolume += elementContribution(iElem);
+    }
+  } END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+#endif
+
+  SU2_OMP_MASTER {
+
+  /*--- The elements skipped by a restricted update did not add their volume
+   to the total, recover it from the point volumes, which hold exactly the
+   contributions of the local elements. ---*/
+  if (selective) {
+    my_DomainVolume = 0.0;
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+      my_DomainVolume += nodes->GetVolume(iPoint);
   }
 
   su2double DomainVolume;
@@ -7499,10 +8077,30 @@ void CPhysicalGeometry::SetControlVolume(CConfig *config, unsigned short action)
     if (Area2 == 0.0) edges->SetNormal(iEdge, DefaultArea);
   }
   END_SU2_OMP_FOR
+
+  /*--- Store the midpoint vector of each edge, used by the MUSCL reconstruction.
+   Doing it here keeps it up to date on dynamic grids. ---*/
+  SU2_OMP_FOR_STAT(1024)
+  for (auto iEdge = 0ul; iEdge < nEdge; iEdge++) {
+    edges->SetVector_ij(iEdge, nodes->GetCoord(edges->GetNode(iEdge,0)),
+                        nodes->GetCoord(edges->GetNode(iEdge,1)));
+  }
+  END_SU2_OMP_FOR
 }
 
 void CPhysicalGeometry::SetBoundControlVolume(const CConfig *config, unsigned short action) {
 
+  /*--- Dispatch to a compile-time dimension, see SetControlVolume. ---*/
+
+  if (nDim == 2) SetBoundControlVolumeImpl<2>(config, action);
+  else SetBoundControlVolumeImpl<3>(config, action);
+}
+
+template<unsigned short NDIM>
+void CPhysicalGeometry::SetBoundControlVolumeImpl(const CConfig *config, unsigned short action) {
+
+  constexpr unsigned short nDim = NDIM;
+
   /*--- Clear normals ---*/
 
   if (action != ALLOCATE) {
@@ -8061,6 +8659,59 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig *config) {
 
   CLinearPartitioner pointPartitioner(Global_nPointDomain,0);
 
+  /*--- The coloring depends only on the mesh, the rank count, and the load
+   balancing options, and can therefore be cached in a binary sidecar file
+   next to the mesh and reused across runs (e.g. the jobs of a parameter
+   sweep), skipping the call to ParMETIS. A small header identifies the mesh
+   by its global point and element counts, a stale or foreign file is simply
+   recomputed and overwritten. ---*/
+
+  const bool useCache = config->GetPartition_Cache();
+  const string cacheName = config->GetMesh_FileName() + ".color." + to_string(size) + ".bin";
+
+  if (useCache) {
+    MPI_File fhw;
+    if (MPI_File_open(comm, cacheName.c_str(), MPI_MODE_RDONLY,
+                      MPI_INFO_NULL, &fhw) == MPI_SUCCESS) {
+
+      /*--- Every rank reads and checks the header (an SU2 binary magic number,
+       as in the binary restart files, plus the mesh identification), the
+       result is identical on all ranks so no broadcast is needed. ---*/
+
+      unsigned long header[4] = {0};
+      MPI_File_read_at(fhw, 0, header, 4, MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE);
+
+      if ((header[0] == 535532) && (header[1] == Global_nPointDomain) &&
+          (header[2] == Global_nElem) && (header[3] == static_cast<unsigned long>(size))) {
+
+        /*--- Each rank reads the colors of its linear partition of the points. ---*/
+
+        const unsigned long firstIndex = pointPartitioner.GetFirstIndexOnRank(rank);
+
+        vector<unsigned long> color(nPoint);
+        MPI_Offset disp = sizeof(header) + firstIndex*sizeof(unsigned long);
+        MPI_File_read_at_all(fhw, disp, color.data(), nPoint, MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE);
+        MPI_File_close(&fhw);
+
+        for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+          nodes->SetColor(iPoint, color[iPoint]);
+
+        if (rank == MASTER_NODE)
+          cout << "Reusing the mesh partitioning stored in " << cacheName << "." << endl;
+
+        /*--- Force free the connectivity, as after the regular coloring. ---*/
+
+        decltype(xadj)().swap(xadj);
+        decltype(adjacency)().swap(adjacency);
+        return;
+      }
+
+      MPI_File_close(&fhw);
+      if (rank == MASTER_NODE)
+        cout << "Partition cache " << cacheName << " does not match the mesh, recomputing." << endl;
+    }
+  }
+
   /*--- Some recommended defaults for the various ParMETIS options. ---*/
 
   idx_t wgtflag = 2;
@@ -8096,6 +8747,60 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig *config) {
     vwgt[iPoint] = wp + we * (xadj[iPoint+1] - xadj[iPoint]);
   }
 
+  /*--- Points on solid wall boundaries incur extra per-point work (viscous
+   * fluxes and gradients, wall distance, wall models) that the adjacency
+   * alone does not capture, on hybrid meshes this shows up as load imbalance
+   * between ranks owning boundary layer and farfield regions. Give wall
+   * points extra weight, counting markers treated with a wall function
+   * twice. Only the master rank holds the surface connectivity (with global
+   * point indices) at this stage, so the wall points are gathered there and
+   * broadcast, and each rank weights the points of its linear partition. ---*/
+
+  const long ww = config->GetParMETIS_WallWeight();
+
+  if (ww != 0) {
+
+    vector<unsigned long> wallPoints;
+    vector<long> wallWeights;
+
+    if (rank == MASTER_NODE) {
+      unordered_map<unsigned long, long> pointWeight;
+      for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+        if (!config->GetSolid_Wall(iMarker)) continue;
+        const bool wallModel = config->GetWallFunction_Treatment(
+                               config->GetMarker_All_TagBound(iMarker)) != WALL_FUNCTIONS::NONE;
+        const long markerWeight = (wallModel? 2 : 1) * ww;
+        for (unsigned long iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
+          for (unsigned short iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+            auto& wgt = pointWeight[bound[iMarker][iElem]->GetNode(iNode)];
+            wgt = max(wgt, markerWeight);
+          }
+        }
+      }
+      wallPoints.reserve(pointWeight.size());
+      wallWeights.reserve(pointWeight.size());
+      for (const auto& pw : pointWeight) {
+        wallPoints.push_back(pw.first);
+        wallWeights.push_back(pw.second);
+      }
+    }
+
+    unsigned long nWallPoints = wallPoints.size();
+    SU2_MPI::Bcast(&nWallPoints, 1, MPI_UNSIGNED_LONG, MASTER_NODE, comm);
+    wallPoints.resize(nWallPoints);
+    wallWeights.resize(nWallPoints);
+    SU2_MPI::Bcast(wallPoints.data(), nWallPoints, MPI_UNSIGNED_LONG, MASTER_NODE, comm);
+    SU2_MPI::Bcast(wallWeights.data(), nWallPoints, MPI_LONG, MASTER_NODE, comm);
+
+    const auto firstIndex = pointPartitioner.GetFirstIndexOnRank(rank);
+    const auto lastIndex  = pointPartitioner.GetLastIndexOnRank(rank);
+
+    for (unsigned long i = 0; i < nWallPoints; ++i) {
+      if ((wallPoints[i] >= firstIndex) && (wallPoints[i] < lastIndex))
+        vwgt[wallPoints[i] - firstIndex] += wallWeights[i];
+    }
+  }
+
   /*--- Create some structures that ParMETIS needs to output the partitioning. ---*/
 
   idx_t edgecut;
@@ -8120,6 +8825,38 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig *config) {
     nodes->SetColor(iPoint, part[iPoint]);
   }
 
+  /*--- Store the coloring in the sidecar file so that future runs on this
+   mesh with this rank count can reuse it. Failure to create the file is not
+   fatal, the coloring was computed and the run can proceed. ---*/
+
+  if (useCache) {
+    MPI_File fhw;
+    int ierr = MPI_File_open(comm, cacheName.c_str(), MPI_MODE_CREATE|MPI_MODE_WRONLY,
+                             MPI_INFO_NULL, &fhw);
+    if (ierr == MPI_SUCCESS) {
+      unsigned long header[4] = {535532, Global_nPointDomain, Global_nElem,
+                                 static_cast<unsigned long>(size)};
+      if (rank == MASTER_NODE)
+        MPI_File_write_at(fhw, 0, header, 4, MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE);
+
+      const unsigned long firstIndex = pointPartitioner.GetFirstIndexOnRank(rank);
+
+      vector<unsigned long> color(nPoint);
+      for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+        color[iPoint] = part[iPoint];
+
+      MPI_Offset disp = sizeof(header) + firstIndex*sizeof(unsigned long);
+      MPI_File_write_at_all(fhw, disp, color.data(), nPoint, MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE);
+      MPI_File_close(&fhw);
+
+      if (rank == MASTER_NODE)
+        cout << "Stored the mesh partitioning in " << cacheName << "." << endl;
+    }
+    else if (rank == MASTER_NODE) {
+      cout << "WARNING: Could not create the partition cache file " << cacheName << "." << endl;
+    }
+  }
+
   /*--- Force free the connectivity. ---*/
 
   decltype(xadj)().swap(xadj);
@@ -8128,6 +8865,148 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig *config) {
 #endif
 }
 
+passivedouble CPhysicalGeometry::ComputeLoadImbalance(passivedouble myWork) const {
+
+  passivedouble totWork = 0.0, maxWork = 0.0;
+
+  SU2_MPI::Allreduce(&myWork, &totWork, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(&myWork, &maxWork, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+
+  if (totWork <= 0.0) return 0.0;
+
+  return maxWork*size/totWork - 1.0;
+}
+
+bool CPhysicalGeometry::ComputeRepartitionColoring(const CConfig *config, passivedouble myWork,
+                                                   vector<unsigned long> &newColor) {
+
+#if defined(HAVE_MPI) && defined(HAVE_PARMETIS)
+
+  if (size == SINGLE_NODE) return false;
+
+  MPI_Comm comm = SU2_MPI::GetComm();
+
+  /*--- ParMETIS requires the vertices of the distributed graph to be numbered
+   in contiguous ranges per rank. The global indices of the final geometry do
+   not have this property, so a temporary numbering is built from the owned
+   point counts and propagated to the halo layer. Conveniently, this numbering
+   also encodes the current ownership, which the adaptive repartitioning uses
+   as the starting partition to minimize point migration. ---*/
+
+  vector<unsigned long> pointsPerRank(size);
+  unsigned long nOwned = nPointDomain;
+  SU2_MPI::Allgather(&nOwned, 1, MPI_UNSIGNED_LONG, pointsPerRank.data(), 1, MPI_UNSIGNED_LONG, comm);
+
+  vector<idx_t> vtxdist(size+1, 0);
+  for (int i = 0; i < size; ++i) vtxdist[i+1] = vtxdist[i] + pointsPerRank[i];
+
+  /*--- The su2double point-to-point buffers carry the numbering to the halo
+   points, the values are integers well below 2^53 and therefore exact. The
+   exchange mirrors the structure of Initiate/CompleteComms. ---*/
+
+  vector<su2double> contigID(nPoint, 0.0);
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; ++iPoint)
+    contigID[iPoint] = su2double(vtxdist[rank] + iPoint);
+
+  /*--- The buffer allocation may be collective, reach it on every rank. ---*/
+
+  AllocateP2PComms(1);
+
+  if (nP2PSend > 0) {
+    PostP2PRecvs(this, config, COMM_TYPE_DOUBLE, 1, false);
+
+    for (int iMessage = 0; iMessage < nP2PSend; iMessage++) {
+      const auto msg_offset = nPoint_P2PSend[iMessage];
+      const auto nSend = nPoint_P2PSend[iMessage+1] - msg_offset;
+      for (int iSend = 0; iSend < nSend; iSend++)
+        bufD_P2PSend[msg_offset+iSend] = contigID[Local_Point_P2PSend[msg_offset+iSend]];
+      PostP2PSends(this, config, COMM_TYPE_DOUBLE, 1, iMessage, false);
+    }
+  }
+
+  if (nP2PRecv > 0) {
+    for (int iMessage = 0; iMessage < nP2PRecv; iMessage++) {
+      int ind; SU2_MPI::Status status;
+      SU2_MPI::Waitany(nP2PRecv, req_P2PRecv, &ind, &status);
+      FlushSharedRecvWindow();
+      const auto jRecv = P2PRecv2Neighbor[status.MPI_SOURCE];
+      const auto msg_offset = nPoint_P2PRecv[jRecv];
+      const auto nRecv = nPoint_P2PRecv[jRecv+1] - msg_offset;
+      for (int iRecv = 0; iRecv < nRecv; iRecv++)
+        contigID[Local_Point_P2PRecv[msg_offset+iRecv]] = bufD_P2PRecv[msg_offset+iRecv];
+    }
+    SU2_MPI::Waitall(nP2PSend, req_P2PSend, MPI_STATUS_IGNORE);
+  }
+
+  /*--- Distributed CSR graph of the owned points (point-to-point dual mesh). ---*/
+
+  vector<idx_t> xadj_l(nPointDomain+1, 0);
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; ++iPoint)
+    xadj_l[iPoint+1] = xadj_l[iPoint] + nodes->GetnPoint(iPoint);
+
+  vector<idx_t> adjncy(xadj_l[nPointDomain]);
+  unsigned long iAdj = 0;
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; ++iPoint)
+    for (auto jPoint : nodes->GetPoints(iPoint))
+      adjncy[iAdj++] = static_cast<idx_t>(SU2_TYPE::GetValue(contigID[jPoint]));
+
+  /*--- Vertex weights from the measured work, normalized so that the global
+   average weight is 1000 to retain some integer resolution. This targets the
+   observed imbalance instead of the static cost model of the initial
+   partitioning. ---*/
+
+  passivedouble totWork = 0.0;
+  SU2_MPI::Allreduce(&myWork, &totWork, 1, MPI_DOUBLE, MPI_SUM, comm);
+  if (totWork <= 0.0) return false;
+
+  const passivedouble scale = 1000.0*Global_nPointDomain/totWork;
+  const idx_t pointWeight = max<idx_t>(1, lround(scale*myWork/nPointDomain));
+  vector<idx_t> vwgt(nPointDomain, pointWeight);
+
+  /*--- Some recommended defaults for the various ParMETIS options. The
+   ipc2redist parameter trades communication volume of the new partition
+   against the amount of point migration needed to reach it. ---*/
+
+  idx_t wgtflag = 2;
+  idx_t numflag = 0;
+  idx_t ncon    = 1;
+  idx_t nparts  = size;
+  idx_t edgecut = 0;
+  real_t ubvec  = 1.0 + config->GetParMETIS_Tolerance();
+  real_t ipc2redist = 1000.0;
+  idx_t options[METIS_NOPTIONS];
+  METIS_SetDefaultOptions(options);
+  options[1] = 0;
+
+  vector<real_t> tpwgts(size, 1.0/size);
+  vector<idx_t> part(nPointDomain);
+
+  if (rank == MASTER_NODE) cout << "Calling ParMETIS (adaptive repartitioning)...";
+  auto err = ParMETIS_V3_AdaptiveRepart(vtxdist.data(), xadj_l.data(), adjncy.data(), vwgt.data(),
+                                        nullptr, nullptr, &wgtflag, &numflag, &ncon, &nparts,
+                                        tpwgts.data(), &ubvec, &ipc2redist, options, &edgecut,
+                                        part.data(), &comm);
+  if (err != METIS_OK) SU2_MPI::Error("Adaptive repartitioning failed.", CURRENT_FUNCTION);
+  if (rank == MASTER_NODE) {
+    cout << " graph repartitioning complete (" << edgecut << " edge cuts)." << endl;
+  }
+
+  newColor.resize(nPointDomain);
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; ++iPoint)
+    newColor[iPoint] = part[iPoint];
+
+  return true;
+
+#else
+
+  /*--- Without MPI and ParMETIS there is nothing to rebalance. ---*/
+
+  (void)config; (void)myWork; (void)newColor;
+  return false;
+
+#endif
+}
+
 void CPhysicalGeometry::ComputeMeshQualityStatistics(const CConfig *config) {
 
   /*--- Resize our vectors for the 3 metrics: orthogonality, aspect
@@ -8615,6 +9494,33 @@ void CPhysicalGeometry::SetBoundSensitivity(CConfig *config) {
 
 }
 
+namespace {
+/*--- Locate the sensitivity columns in the restart field names (the list is padded
+ with "Point_ID", the returned indices follow that convention, i.e. data column + 1). ---*/
+void FindSensitivityColumns(const vector<string>& fields, unsigned short nDim,
+                            unsigned short& sens_x_idx, unsigned short& sens_y_idx,
+                            unsigned short& sens_z_idx) {
+
+  const auto itx = std::find(fields.begin(), fields.end(), "Sensitivity_x");
+  const auto ity = std::find(fields.begin(), fields.end(), "Sensitivity_y");
+  const auto itz = std::find(fields.begin(), fields.end(), "Sensitivity_z");
+
+  if (itx == fields.end()) {
+    SU2_MPI::Error("Sensitivity x not found in file.", CURRENT_FUNCTION);
+  }
+  if (ity == fields.end()) {
+    SU2_MPI::Error("Sensitivity y not found in file.", CURRENT_FUNCTION);
+  }
+  if ((nDim == 3) && (itz == fields.end())) {
+    SU2_MPI::Error("Sensitivity z not found in file.", CURRENT_FUNCTION);
+  }
+
+  sens_x_idx = std::distance(fields.begin(), itx);
+  sens_y_idx = std::distance(fields.begin(), ity);
+  sens_z_idx = (nDim == 3) ? std::distance(fields.begin(), itz) : 0;
+}
+}
+
 void CPhysicalGeometry::SetSensitivity(CConfig *config) {
 
   ifstream restart_file;
@@ -8661,6 +9567,13 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
     passivedouble Restart_Meta_Passive[8] = {0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0};
     su2double Restart_Meta[8] = {0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0};
 
+    /*--- The data is streamed in chunks of points. The file holds the full set of
+     adjoint fields but only the sensitivities are kept, so the read buffer is
+     bounded instead of scaling with nFields times the number of points. ---*/
+
+    const unsigned long maxPointsPerRead = 4096;
+    unsigned short sens_x_idx = 0, sens_y_idx = 0, sens_z_idx = 0;
+
 #ifndef HAVE_MPI
 
     /*--- Serial binary input. ---*/
@@ -8710,15 +9623,35 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
       config->fields.push_back(str_buf);
     }
 
-    /*--- For now, create a temp 1D buffer to read the data from file. ---*/
+    /*--- Locate the sensitivity columns before streaming the data. ---*/
 
-    Restart_Data = new passivedouble[nFields*GetnPointDomain()];
+    FindSensitivityColumns(config->fields, nDim, sens_x_idx, sens_y_idx, sens_z_idx);
 
-    /*--- Read in the data for the restart at all local points. ---*/
+    /*--- Stream the rows of the file in bounded chunks, keeping only the
+     sensitivity columns of the points owned by this rank. ---*/
 
-    ret = fread(Restart_Data, sizeof(passivedouble), nFields*GetnPointDomain(), fhw);
-    if (ret != (unsigned long)nFields*GetnPointDomain()) {
-      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    Restart_Data = new passivedouble[nFields*min(maxPointsPerRead, GetnPointDomain())];
+
+    unsigned long offset = 0;
+    while (offset < GetnPointDomain()) {
+
+      const unsigned long nPointRead = min(maxPointsPerRead, GetnPointDomain()-offset);
+
+      ret = fread(Restart_Data, sizeof(passivedouble), nFields*nPointRead, fhw);
+      if (ret != (unsigned long)nFields*nPointRead) {
+        SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+      }
+
+      for (unsigned long iRow = 0; iRow < nPointRead; iRow++) {
+        iPoint_Local = GetGlobal_to_Local_Point(offset+iRow);
+        if (iPoint_Local > -1) {
+          Sensitivity(iPoint_Local,0) = Restart_Data[iRow*nFields + sens_x_idx - 1];
+          Sensitivity(iPoint_Local,1) = Restart_Data[iRow*nFields + sens_y_idx - 1];
+          if (nDim == 3)
+            Sensitivity(iPoint_Local,2) = Restart_Data[iRow*nFields + sens_z_idx - 1];
+        }
+      }
+      offset += nPointRead;
     }
 
     /*--- Compute (negative) displacements and grab the metadata. ---*/
@@ -8842,12 +9775,15 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
 
     int *blocklen = new int[GetnPointDomain()];
     MPI_Aint *displace = new MPI_Aint[GetnPointDomain()];
+    vector<long> localIdx(GetnPointDomain());
 
     counter = 0;
     for (iPoint_Global = 0; iPoint_Global < GetGlobal_nPointDomain(); iPoint_Global++ ) {
-      if (GetGlobal_to_Local_Point(iPoint_Global) > -1) {
+      const long localPoint = GetGlobal_to_Local_Point(iPoint_Global);
+      if (localPoint > -1) {
         blocklen[counter] = nFields;
         displace[counter] = iPoint_Global*nFields*sizeof(passivedouble);
+        localIdx[counter] = localPoint;
         counter++;
       }
     }
@@ -8859,13 +9795,36 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
 
     MPI_File_set_view(fhw, disp, etype, filetype, (char*)"native", MPI_INFO_NULL);
 
-    /*--- For now, create a temp 1D buffer to read the data from file. ---*/
+    /*--- Locate the sensitivity columns before streaming the data. ---*/
+
+    FindSensitivityColumns(config->fields, nDim, sens_x_idx, sens_y_idx, sens_z_idx);
+
+    /*--- Stream this rank's view of the file in bounded chunks, successive
+     collective reads advance through the view. Every rank takes part in the same
+     number of reads (empty ones once it runs out of points). ---*/
+
+    Restart_Data = new passivedouble[nFields*min(maxPointsPerRead, GetnPointDomain())];
+
+    unsigned long nReadsLocal = roundUpDiv(GetnPointDomain(), maxPointsPerRead), nReads = 0;
+    SU2_MPI::Allreduce(&nReadsLocal, &nReads, 1, MPI_UNSIGNED_LONG, MPI_MAX, SU2_MPI::GetComm());
+
+    unsigned long offset = 0;
+    for (unsigned long iRead = 0; iRead < nReads; iRead++) {
 
-    Restart_Data = new passivedouble[nFields*GetnPointDomain()];
+      const unsigned long nPointRead = (offset < GetnPointDomain()) ?
+                                       min(maxPointsPerRead, GetnPointDomain()-offset) : 0;
 
-    /*--- Collective call for all ranks to read from their view simultaneously. ---*/
+      MPI_File_read_all(fhw, Restart_Data, nFields*nPointRead, MPI_DOUBLE, &status);
 
-    MPI_File_read_all(fhw, Restart_Data, nFields*GetnPointDomain(), MPI_DOUBLE, &status);
+      for (unsigned long iRow = 0; iRow < nPointRead; iRow++) {
+        iPoint_Local = localIdx[offset+iRow];
+        Sensitivity(iPoint_Local,0) = Restart_Data[iRow*nFields + sens_x_idx - 1];
+        Sensitivity(iPoint_Local,1) = Restart_Data[iRow*nFields + sens_y_idx - 1];
+        if (nDim == 3)
+          Sensitivity(iPoint_Local,2) = Restart_Data[iRow*nFields + sens_z_idx - 1];
+      }
+      offset += nPointRead;
+    }
 
     /*--- Free the derived datatype. ---*/
 
@@ -8913,56 +9872,8 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
 
 #endif
 
-    std::vector<string>::iterator itx = std::find(config->fields.begin(), config->fields.end(), "Sensitivity_x");
-    std::vector<string>::iterator ity = std::find(config->fields.begin(), config->fields.end(), "Sensitivity_y");
-    std::vector<string>::iterator itz = std::find(config->fields.begin(), config->fields.end(), "Sensitivity_z");
-
-    if (itx == config->fields.end()){
-      SU2_MPI::Error("Sensitivity x not found in file.", CURRENT_FUNCTION);
-    }
-    if (ity == config->fields.end()){
-      SU2_MPI::Error("Sensitivity y not found in file.", CURRENT_FUNCTION);
-    }
-    if (nDim == 3){
-      if (itz == config->fields.end()){
-        SU2_MPI::Error("Sensitivity z not found in file.", CURRENT_FUNCTION);
-      }
-    }
-
-    unsigned short sens_x_idx = std::distance(config->fields.begin(), itx);
-    unsigned short sens_y_idx = std::distance(config->fields.begin(), ity);
-    unsigned short sens_z_idx = 0;
-    if (nDim == 3)
-      sens_z_idx = std::distance(config->fields.begin(), itz);
-
-    /*--- Load the data from the binary restart. ---*/
-
-    counter = 0;
-    for (iPoint_Global = 0; iPoint_Global < GetGlobal_nPointDomain(); iPoint_Global++ ) {
-
-      /*--- Retrieve local index. If this node from the restart file lives
-       on the current processor, we will load and instantiate the vars. ---*/
-
-      iPoint_Local = GetGlobal_to_Local_Point(iPoint_Global);
-
-      if (iPoint_Local > -1) {
-
-        /*--- We need to store this point's data, so jump to the correct
-         offset in the buffer of data from the restart file and load it. ---*/
-
-        index = counter*nFields + sens_x_idx - 1;
-        Sensitivity(iPoint_Local,0) = Restart_Data[index];
-        index = counter*nFields + sens_y_idx - 1;
-        Sensitivity(iPoint_Local,1) = Restart_Data[index];
-
-        if (nDim == 3){
-          index = counter*nFields + sens_z_idx - 1;
-          Sensitivity(iPoint_Local,2) = Restart_Data[index];
-        }
-        /*--- Increment the overall counter for how many points have been loaded. ---*/
-        counter++;
-      }
-    }
+    delete [] Restart_Vars;
+    delete [] Restart_Data;
 
     /*--- Lastly, load the AoA sensitivity from the binary metadata. ---*/
 
@@ -10848,6 +11759,13 @@ void CPhysicalGeometry::SetWallDistance(CADTElemClass* WallADT, const CConfig* c
     /*--- Solid wall boundary nodes are present. Compute the wall
      distance for all nodes. ---*/
 
+    /*--- Wall distance of the point this thread visited previously, used to seed
+     the tree search via the triangle inequality (d(b) <= d(a) + ||b-a||). The
+     bound is tight when consecutive points are close to each other, which is
+     typically the case after the points have been renumbered for locality. ---*/
+    su2double prevCoord[MAXNDIM] = {0.0};
+    su2double prevDist = -1.0;
+
     SU2_OMP_FOR_DYN(roundUpDiv(nPoint,2*omp_get_max_threads()))
     for (unsigned long iPoint=0; iPoint<GetnPoint(); ++iPoint) {
       unsigned short markerID;
@@ -10855,7 +11773,16 @@ void CPhysicalGeometry::SetWallDistance(CADTElemClass* WallADT, const CConfig* c
       int            rankID;
       su2double      dist;
 
-      WallADT->DetermineNearestElement(nodes->GetCoord(iPoint), dist, markerID, elemID, rankID);
+      const su2double* coord = nodes->GetCoord(iPoint);
+
+      su2double distUpperBound = -1.0;
+      if (prevDist >= 0.0)
+        distUpperBound = prevDist + GeometryToolbox::Distance(nDim, coord, prevCoord);
+
+      WallADT->DetermineNearestElement(coord, dist, markerID, elemID, rankID, distUpperBound);
+
+      prevDist = dist;
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim) prevCoord[iDim] = coord[iDim];
 
       if(dist < nodes->GetWall_Distance(iPoint)){
         nodes->SetWall_Distance(iPoint, dist, rankID, iZone, markerID, elemID);
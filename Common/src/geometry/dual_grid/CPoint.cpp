@@ -147,12 +147,23 @@ void CPoint::SetElems(const vector<vector<long> >& elemsMatrix) {
   Elem = CCompressedSparsePatternL(elemsMatrix);
 }
 
+void CPoint::SetElems(CCompressedSparsePatternL&& elemsPattern) {
+
+  Elem = std::move(elemsPattern);
+}
+
 void CPoint::SetPoints(const vector<vector<unsigned long> >& pointsMatrix) {
 
   Point = CCompressedSparsePatternUL(pointsMatrix);
   Edge = CCompressedSparsePatternL(Point.outerPtr(), Point.outerPtr()+Point.getOuterSize()+1, long(-1));
 }
 
+void CPoint::SetPoints(CCompressedSparsePatternUL&& pointsPattern) {
+
+  Point = std::move(pointsPattern);
+  Edge = CCompressedSparsePatternL(Point.outerPtr(), Point.outerPtr()+Point.getOuterSize()+1, long(-1));
+}
+
 void CPoint::SetVolume_n() {
   assert(Volume_n.size() == Volume.size());
   parallelCopy(Volume.size(), Volume.data(), Volume_n.data());
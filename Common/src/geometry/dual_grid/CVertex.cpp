@@ -30,8 +30,10 @@
 
 using namespace GeometryToolbox;
 
-CVertex::CVertex(unsigned long val_point, unsigned short val_nDim) :
-  CDualGrid(val_nDim) {
+unsigned short CVertex::nDim = 0;
+
+CVertex::CVertex(unsigned long val_point, unsigned short val_nDim) {
+  nDim = val_nDim;
   Nodes[0] = val_point;
 }
 
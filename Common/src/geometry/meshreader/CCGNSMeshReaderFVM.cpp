@@ -443,150 +443,188 @@ void CCGNSMeshReaderFVM::ReadCGNSVolumeSection(int val_section) {
   vector<cgsize_t> nPoinPerElem(nElems[val_section],0);
   vector<cgsize_t> elemGlobalID(nElems[val_section],0);
 
-  /*--- Determine the size of the vector needed to read the connectivity
-   data from the CGNS file. Only call the CGNS API if we have a non-zero
-   number of elements on this rank. ---*/
-
-  cgsize_t sizeNeeded = 0, sizeOffset = 0;
-  if (nElems[val_section] > 0) {
-    if (cg_ElementPartialSize(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
-                              (cgsize_t)elementPartitioner.GetFirstIndexOnRank(rank),
-                              (cgsize_t)elementPartitioner.GetLastIndexOnRank(rank),
-                              &sizeNeeded) != CG_OK)
-    cg_error_exit();
+  /*--- Print some information to the console. ---*/
+
+  if (rank == MASTER_NODE) {
+    cout << "Loading volume section " << string(sectionName);
+    cout <<  " from file." << endl;
   }
 
-  /*--- Allocate the memory for the connectivity, the offset if needed
-   and read the data. ---*/
+  /*--- Find the number of nodes required to represent
+   this type of element. ---*/
+
+  if (cg_npe(elemType, &npe)) cg_error_exit();
+
+  /*--- Allocate the connectivity in a standard format per element:
+   [globalID vtkType n0 n1 n2 n3 n4 n5 n6 n7 n8]. ---*/
+
+  vector<cgsize_t> connElemTemp(nElems[val_section]*SU2_CONN_SIZE,0);
 
-  vector<cgsize_t> connElemCGNS(sizeNeeded,0);
   if (elemType == MIXED || elemType == NFACE_n || elemType == NGON_n) {
-    sizeOffset = nElems[val_section]+1;
-  }
-  vector<cgsize_t> connOffsetCGNS(sizeOffset,0);
 
-  /*--- Retrieve the connectivity information and store. Note that
-   we are only accessing our rank's piece of the data here in the
-   partial read function in the CGNS API. Only call the CGNS API
-   if we have a non-zero number of elements on this rank. ---*/
+    /*--- Mixed-type and polyhedral sections require the offset data to
+     interpret the connectivity, so the entire linear chunk of this rank
+     is read in a single call. First, determine the size of the vector
+     needed to read the connectivity data from the CGNS file. Only call
+     the CGNS API if we have a non-zero number of elements on this rank. ---*/
+
+    cgsize_t sizeNeeded = 0;
+    if (nElems[val_section] > 0) {
+      if (cg_ElementPartialSize(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
+                                (cgsize_t)elementPartitioner.GetFirstIndexOnRank(rank),
+                                (cgsize_t)elementPartitioner.GetLastIndexOnRank(rank),
+                                &sizeNeeded) != CG_OK)
+      cg_error_exit();
+    }
+
+    /*--- Allocate the memory for the connectivity and the offsets,
+     and retrieve the data. Note that we are only accessing our rank's
+     piece of the data here in the partial read function in the CGNS API. ---*/
 
-  if (nElems[val_section] > 0) {
-    if (elemType == MIXED || elemType == NFACE_n || elemType == NGON_n) {
+    vector<cgsize_t> connElemCGNS(sizeNeeded,0);
+    vector<cgsize_t> connOffsetCGNS(nElems[val_section]+1,0);
+
+    if (nElems[val_section] > 0) {
       if (cg_poly_elements_partial_read(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
                                         (cgsize_t)elementPartitioner.GetFirstIndexOnRank(rank),
                                         (cgsize_t)elementPartitioner.GetLastIndexOnRank(rank),
                                         connElemCGNS.data(),
                                         connOffsetCGNS.data(), NULL) != CG_OK)
       cg_error_exit();
-    } else {
-      if (cg_elements_partial_read(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
-                                   (cgsize_t)elementPartitioner.GetFirstIndexOnRank(rank),
-                                   (cgsize_t)elementPartitioner.GetLastIndexOnRank(rank),
-                                   connElemCGNS.data(), NULL) != CG_OK)
-      cg_error_exit();
     }
-  }
 
-  /*--- Print some information to the console. ---*/
+    /*--- Check whether the section contains a mixture of multiple
+     element types, which will require special handling to get the
+     element type one-by-one when reading. ---*/
 
-  if (rank == MASTER_NODE) {
-    cout << "Loading volume section " << string(sectionName);
-    cout <<  " from file." << endl;
-  }
+    const bool isMixed = (elemType == MIXED);
 
-  /*--- Find the number of nodes required to represent
-   this type of element. ---*/
+    /*--- Loop through all of the elements in this section to get more
+     information and to decide whether it has interior elements. ---*/
 
-  if (cg_npe(elemType, &npe)) cg_error_exit();
+    unsigned long counterCGNS = 0;
+    for (iElem = 0; iElem < nElems[val_section]; iElem++) {
 
-  /*--- Check whether the sections contains a mixture of multiple
-   element types, which will require special handling to get the
-   element type one-by-one when reading. ---*/
+      ElementType_t iElemType = elemType;
 
-  bool isMixed = false;
-  if (elemType == MIXED) {
-    isMixed = true;
-  }
+      /*--- If we have a mixed element section, we need to check the elem
+       type one-by-one. We also must manually advance the counter to the
+       next element's position in the buffer. ---*/
 
-  /*--- Loop through all of the elements in this section to get more
-   information and to decide whether it has interior elements. ---*/
+      if (isMixed) {
+        iElemType = ElementType_t(connElemCGNS[counterCGNS]);
+        npe       = connOffsetCGNS[iElem+1]-connOffsetCGNS[iElem]-1;
+        counterCGNS++;
+        for (int jj = 0; jj < npe; jj++) counterCGNS++;
+      }
 
-  unsigned long counterCGNS = 0;
-  for (iElem = 0; iElem < nElems[val_section]; iElem++) {
+      /*--- Store the number of points per element for the current elem. ---*/
+
+      nPoinPerElem[iElem] = npe;
+
+      /*--- Store the global ID for this element. Note the -1 to move
+       from CGNS convention to SU2 convention. We also subtract off
+       an additional offset in case we have found boundary sections
+       prior to this one, in order to keep the internal element global
+       IDs indexed starting from zero. ---*/
 
-    ElementType_t iElemType = elemType;
+      elemGlobalID[iElem] = (elementPartitioner.GetFirstIndexOnRank(rank) +
+                             iElem - elemOffset[val_section]);
 
-    /*--- If we have a mixed element section, we need to check the elem
-     type one-by-one. We also must manually advance the counter to the
-     next element's position in the buffer. ---*/
+      /* Get the VTK type for this element. */
+
+      int vtk_type;
+      string elem_name = GetCGNSElementType(iElemType, vtk_type);
+      elemTypes[iElem] = vtk_type;
 
-    if (isMixed) {
-      iElemType = ElementType_t(connElemCGNS[counterCGNS]);
-      npe       = connOffsetCGNS[iElem+1]-connOffsetCGNS[iElem]-1;
-      counterCGNS++;
-      for (int jj = 0; jj < npe; jj++) counterCGNS++;
     }
 
-    /*--- Store the number of points per element for the current elem. ---*/
+    /*--- Copy the connectivity into the standard format. ---*/
+
+    counterCGNS = 0;
+    for (iElem = 0; iElem < nElems[val_section]; iElem++) {
+
+      /*--- Store the conn in chunks of SU2_CONN_SIZE for simplicity. ---*/
+
+      unsigned long nn = iElem*SU2_CONN_SIZE;
+
+      /*--- First, store the global element ID and the VTK type. ---*/
 
-    nPoinPerElem[iElem] = npe;
+      connElemTemp[nn] = elemGlobalID[iElem]; nn++;
+      connElemTemp[nn] = elemTypes[iElem];    nn++;
 
-    /*--- Store the global ID for this element. Note the -1 to move
-     from CGNS convention to SU2 convention. We also subtract off
-     an additional offset in case we have found boundary sections
-     prior to this one, in order to keep the internal element global
-     IDs indexed starting from zero. ---*/
+      /*--- Store the connectivity values. Note we subtract one from
+       the CGNS 1-based convention. We may also need to remove the first
+       entry if this is a mixed element section. ---*/
 
-    elemGlobalID[iElem] = (elementPartitioner.GetFirstIndexOnRank(rank) +
-                           iElem - elemOffset[val_section]);
+      if (isMixed) counterCGNS++;
+      for (iNode = 0; iNode < (unsigned long)nPoinPerElem[iElem]; iNode++) {
+        connElemTemp[nn] = connElemCGNS[counterCGNS + iNode] - 1; nn++;
+      }
+      counterCGNS += nPoinPerElem[iElem];
+
+    }
+
+  } else {
 
-    /* Get the VTK type for this element. */
+    /*--- Sections with a single element type have a known size per
+     element, so they can be read in bounded chunks. At scale, many
+     smaller requests from all ranks interleave far better on parallel
+     file systems than one large request per rank, and the temporary
+     CGNS read buffer stays small since each chunk is converted into
+     the standard format as soon as it is read. ---*/
+
+    const cgsize_t maxChunkElems = 1000000;
 
     int vtk_type;
-    string elem_name = GetCGNSElementType(iElemType, vtk_type);
-    elemTypes[iElem] = vtk_type;
+    string elem_name = GetCGNSElementType(elemType, vtk_type);
 
-  }
+    const cgsize_t firstElem = elementPartitioner.GetFirstIndexOnRank(rank);
+    const cgsize_t lastElem  = elementPartitioner.GetLastIndexOnRank(rank);
 
-  /*--- Force free the memory for the conn offset from the CGNS file. ---*/
+    vector<cgsize_t> connChunk;
 
-  vector<cgsize_t>().swap(connOffsetCGNS);
+    for (cgsize_t chunkStart = firstElem;
+         (nElems[val_section] > 0) && (chunkStart <= lastElem);
+         chunkStart += maxChunkElems) {
 
-  /*--- These are internal elems. Allocate memory on each proc. ---*/
+      const cgsize_t chunkEnd   = min(chunkStart + maxChunkElems - 1, lastElem);
+      const cgsize_t nElemChunk = chunkEnd - chunkStart + 1;
 
-  vector<cgsize_t> connElemTemp(nElems[val_section]*SU2_CONN_SIZE,0);
+      connChunk.resize(nElemChunk*npe);
 
-  /*--- Copy the connectivity into the larger array with a standard
-   format per element: [globalID vtkType n0 n1 n2 n3 n4 n5 n6 n7 n8]. ---*/
+      if (cg_elements_partial_read(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
+                                   chunkStart, chunkEnd,
+                                   connChunk.data(), NULL) != CG_OK)
+      cg_error_exit();
 
-  counterCGNS = 0;
-  for (iElem = 0; iElem < nElems[val_section]; iElem++) {
+      /*--- Store the auxiliary data and the connectivity for the chunk
+       in the standard format. Note the -1 on the connectivity and the
+       element offset to move from CGNS to SU2 conventions (see the
+       mixed section branch above for the details). ---*/
 
-    /*--- Store the conn in chunks of SU2_CONN_SIZE for simplicity. ---*/
+      for (cgsize_t jElem = 0; jElem < nElemChunk; jElem++) {
 
-    unsigned long nn = iElem*SU2_CONN_SIZE;
+        iElem = (chunkStart - firstElem) + jElem;
 
-    /*--- First, store the global element ID and the VTK type. ---*/
+        nPoinPerElem[iElem] = npe;
+        elemTypes[iElem]    = vtk_type;
+        elemGlobalID[iElem] = (elementPartitioner.GetFirstIndexOnRank(rank) +
+                               iElem - elemOffset[val_section]);
 
-    connElemTemp[nn] = elemGlobalID[iElem]; nn++;
-    connElemTemp[nn] = elemTypes[iElem];    nn++;
+        unsigned long nn = iElem*SU2_CONN_SIZE;
+        connElemTemp[nn] = elemGlobalID[iElem]; nn++;
+        connElemTemp[nn] = elemTypes[iElem];    nn++;
+        for (iNode = 0; iNode < (unsigned long)npe; iNode++) {
+          connElemTemp[nn] = connChunk[jElem*npe + iNode] - 1; nn++;
+        }
 
-    /*--- Store the connectivity values. Note we subtract one from
-     the CGNS 1-based convention. We may also need to remove the first
-     entry if this is a mixed element section. ---*/
+      }
 
-    if (isMixed) counterCGNS++;
-    for (iNode = 0; iNode < (unsigned long)nPoinPerElem[iElem]; iNode++) {
-      connElemTemp[nn] = connElemCGNS[counterCGNS + iNode] - 1; nn++;
     }
-    counterCGNS += nPoinPerElem[iElem];
 
   }
 
-  /*--- Force free the memory for the conn from the CGNS file. ---*/
-
-  vector<cgsize_t>().swap(connElemCGNS);
-
   /*--- We now have the connectivity stored in linearly partitioned
    chunks. We need to loop through and decide how many elements we
    must send to each rank in order to have all elements that
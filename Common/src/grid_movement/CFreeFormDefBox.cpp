@@ -760,19 +760,80 @@ su2double *CFreeFormDefBox::EvalCartesianCoord(su2double *ParamCoord) const {
   for (iDim = 0; iDim < nDim; iDim++)
     cart_coord[iDim] = 0.0;
 
+  /*--- Evaluate the 1D blending functions once, the full basis is their tensor product. ---*/
+
+  vector<su2double> lBasis(lOrder), mBasis(mOrder), nBasis(nOrder);
+
+  for (iDegree = 0; iDegree <= lDegree; iDegree++)
+    lBasis[iDegree] = BlendingFunction[0]->GetBasis(iDegree, ParamCoord[0]);
+  for (jDegree = 0; jDegree <= mDegree; jDegree++)
+    mBasis[jDegree] = BlendingFunction[1]->GetBasis(jDegree, ParamCoord[1]);
+  for (kDegree = 0; kDegree <= nDegree; kDegree++)
+    nBasis[kDegree] = BlendingFunction[2]->GetBasis(kDegree, ParamCoord[2]);
+
   for (iDegree = 0; iDegree <= lDegree; iDegree++)
     for (jDegree = 0; jDegree <= mDegree; jDegree++)
-      for (kDegree = 0; kDegree <= nDegree; kDegree++)
-        for (iDim = 0; iDim < nDim; iDim++) {
-          cart_coord[iDim] += Coord_Control_Points[iDegree][jDegree][kDegree][iDim]
-          * BlendingFunction[0]->GetBasis(iDegree, ParamCoord[0])
-          * BlendingFunction[1]->GetBasis(jDegree, ParamCoord[1])
-          * BlendingFunction[2]->GetBasis(kDegree, ParamCoord[2]);
-        }
+      for (kDegree = 0; kDegree <= nDegree; kDegree++) {
+        const su2double blending = lBasis[iDegree]*mBasis[jDegree]*nBasis[kDegree];
+        for (iDim = 0; iDim < nDim; iDim++)
+          cart_coord[iDim] += Coord_Control_Points[iDegree][jDegree][kDegree][iDim]*blending;
+      }
 
   return cart_coord;
 }
 
+su2double *CFreeFormDefBox::EvalCartesianCoord(unsigned long val_iSurfacePoints) {
+  unsigned short iDim, iDegree, jDegree, kDegree;
+
+  const unsigned long nBasis = lOrder + mOrder + nOrder;
+
+  /*--- Allocate the cache on the first evaluation, or if the FFD box was redefined
+   with a different number of basis functions. HUGE_VAL forces the first build. ---*/
+
+  if (BlendingCache.size() != GetnSurfacePoint()*nBasis) {
+    BlendingCache.assign(GetnSurfacePoint()*nBasis, 0.0);
+    for (iDim = 0; iDim < 3; iDim++)
+      BlendingCacheParam[iDim].assign(GetnSurfacePoint(), HUGE_VAL);
+  }
+
+  su2double *basis = &BlendingCache[val_iSurfacePoints*nBasis];
+
+  /*--- Recompute the blending functions only if the parametric coordinates of
+   the point changed (e.g. after updating the coordinates of a child box). ---*/
+
+  bool rebuild = false;
+  for (iDim = 0; iDim < 3; iDim++)
+    rebuild = rebuild || (BlendingCacheParam[iDim][val_iSurfacePoints] != ParametricCoord[iDim][val_iSurfacePoints]);
+
+  if (rebuild) {
+    for (iDegree = 0; iDegree <= lDegree; iDegree++)
+      basis[iDegree] = BlendingFunction[0]->GetBasis(iDegree, ParametricCoord[0][val_iSurfacePoints]);
+    for (jDegree = 0; jDegree <= mDegree; jDegree++)
+      basis[lOrder+jDegree] = BlendingFunction[1]->GetBasis(jDegree, ParametricCoord[1][val_iSurfacePoints]);
+    for (kDegree = 0; kDegree <= nDegree; kDegree++)
+      basis[lOrder+mOrder+kDegree] = BlendingFunction[2]->GetBasis(kDegree, ParametricCoord[2][val_iSurfacePoints]);
+
+    for (iDim = 0; iDim < 3; iDim++)
+      BlendingCacheParam[iDim][val_iSurfacePoints] = ParametricCoord[iDim][val_iSurfacePoints];
+  }
+
+  /*--- Tensor contraction of the cached basis with the control point positions. ---*/
+
+  for (iDim = 0; iDim < nDim; iDim++)
+    cart_coord[iDim] = 0.0;
+
+  for (iDegree = 0; iDegree <= lDegree; iDegree++)
+    for (jDegree = 0; jDegree <= mDegree; jDegree++) {
+      const su2double basis_ij = basis[iDegree]*basis[lOrder+jDegree];
+      for (kDegree = 0; kDegree <= nDegree; kDegree++) {
+        const su2double blending = basis_ij*basis[lOrder+mOrder+kDegree];
+        for (iDim = 0; iDim < nDim; iDim++)
+          cart_coord[iDim] += Coord_Control_Points[iDegree][jDegree][kDegree][iDim]*blending;
+      }
+    }
+
+  return cart_coord;
+}
 
 su2double *CFreeFormDefBox::GetFFDGradient(su2double *val_coord, su2double *xyz) {
 
@@ -689,19 +689,25 @@ void CSurfaceMovement::SetSurface_Derivative(CGeometry *geometry, CConfig *confi
 
   unsigned short iDV = 0, iDV_Value = 0;
 
+  int nSeeded = 0;
+
   for (iDV = 0; iDV < config->GetnDV(); iDV++) {
     for (iDV_Value = 0; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++) {
 
       DV_Value = config->GetDV_Value(iDV, iDV_Value);
 
       /*--- If value of the design variable is not 0.0 we apply the differentation.
-      *     Note if multiple variables are non-zero, we end up with the sum of all the derivatives. ---*/
+      *     In vector forward mode the non-zero variables are distributed round-robin
+      *     over the derivative directions, so up to DerivativeDirections variables
+      *     are differentiated in one run. In scalar mode (one direction) this keeps
+      *     the old behavior: multiple non-zero variables sum their derivatives. ---*/
 
       if (DV_Value != 0.0) {
 
         DV_Value = 0.0;
 
-        SU2_TYPE::SetDerivative(DV_Value, 1.0);
+        SU2_TYPE::SetDerivative(DV_Value, nSeeded % SU2_TYPE::DerivativeDirections, 1.0);
+        nSeeded++;
 
         config->SetDV_Value(iDV, iDV_Value, DV_Value);
       }
@@ -1474,7 +1480,7 @@ void CSurfaceMovement::ApplyDesignVariables(CGeometry *geometry, CConfig *config
 su2double CSurfaceMovement::SetCartesianCoord(CGeometry *geometry, CConfig *config, CFreeFormDefBox *FFDBox, unsigned short iFFDBox, bool ResetDef) {
 
   su2double *CartCoordNew, Diff, my_MaxDiff = 0.0, MaxDiff,
-  *ParamCoord, VarCoord[3] = {0.0, 0.0, 0.0}, CartCoordOld[3] = {0.0, 0.0, 0.0};
+  VarCoord[3] = {0.0, 0.0, 0.0}, CartCoordOld[3] = {0.0, 0.0, 0.0};
   unsigned short iMarker, iDim;
   unsigned long iVertex, iPoint, iSurfacePoints;
 
@@ -1513,14 +1519,11 @@ su2double CSurfaceMovement::SetCartesianCoord(CGeometry *geometry, CConfig *conf
 
       geometry->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
 
-      /*--- Get the parametric coordinate of the surface point ---*/
-
-      ParamCoord = FFDBox->Get_ParametricCoord(iSurfacePoints);
+      /*--- Compute the new cartesian coordinate from the stored parametric coordinate
+       of the surface point (the blending functions are cached inside the FFD box),
+       and set the value in the FFDBox structure ---*/
 
-      /*--- Compute the new cartesian coordinate, and set the value in
-       the FFDBox structure ---*/
-
-      CartCoordNew = FFDBox->EvalCartesianCoord(ParamCoord);
+      CartCoordNew = FFDBox->EvalCartesianCoord(iSurfacePoints);
 
       /*--- If polar coordinates, compute the cartesians from the polar value ---*/
 
@@ -29,6 +29,8 @@
 #include "../../include/grid_movement/CVolumetricMovement.hpp"
 #include "../../include/adt/CADTPointsOnlyClass.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
+#include "../../include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../include/linear_algebra/CPreconditioner.hpp"
 
 CVolumetricMovement::CVolumetricMovement(void) : CGridMovement(), System(true) {
 
@@ -49,11 +51,24 @@ CVolumetricMovement::CVolumetricMovement(CGeometry *geometry, CConfig *config) :
 
   nIterMesh = 0;
 
-  /*--- Initialize matrix, solution, and r.h.s. structures for the linear solver. ---*/
+  /*--- Initialize matrix, solution, and r.h.s. structures for the linear solver.
+   In matrix-free mode the stiffness matrix is never assembled, only the fixed-DOF
+   mask and the diagonal blocks (for the preconditioner) are stored. The derivative
+   paths need the assembled (transposed) matrix and keep the standard storage. ---*/
   if (config->GetVolumetric_Movement()){
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
     LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
-    StiffMatrix.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+
+    MatrixFree = config->GetDeform_MatrixFree() && !config->GetDiscrete_Adjoint() &&
+                 (config->GetDirectDiff() == NO_DERIVATIVE);
+
+    if (MatrixFree) {
+      FixedDOF.resize(nPoint*nVar, 0);
+      InvDiagonal.resize(nPointDomain*nVar*nVar, 0.0);
+    }
+    else {
+      StiffMatrix.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+    }
   }
 }
 
@@ -63,7 +78,12 @@ void CVolumetricMovement::UpdateGridCoord(CGeometry *geometry, CConfig *config)
 
   unsigned short iDim;
   unsigned long iPoint, total_index;
-  su2double new_coord;
+  su2double new_coord, old_coord;
+
+  /*--- Track which points actually move, UpdateDualGrid uses this to restrict
+   the metric recomputation to the region the deformation touched. ---*/
+
+  PointMoved.assign(nPoint, false);
 
   /*--- Update the grid coordinates using the solution of the linear system
    after grid deformation (LinSysSol contains the x, y, z displacements). ---*/
@@ -71,18 +91,34 @@ void CVolumetricMovement::UpdateGridCoord(CGeometry *geometry, CConfig *config)
   for (iPoint = 0; iPoint < nPoint; iPoint++)
     for (iDim = 0; iDim < nDim; iDim++) {
       total_index = iPoint*nDim + iDim;
-      new_coord = geometry->nodes->GetCoord(iPoint, iDim)+LinSysSol[total_index];
+      old_coord = geometry->nodes->GetCoord(iPoint, iDim);
+      new_coord = old_coord+LinSysSol[total_index];
       if (fabs(new_coord) < EPS*EPS) new_coord = 0.0;
+      if (new_coord != old_coord) PointMoved[iPoint] = true;
       geometry->nodes->SetCoord(iPoint, iDim, new_coord);
     }
 
   /*--- LinSysSol contains the non-transformed displacements in the periodic halo cells.
    * Hence we still need a communication of the transformed coordinates, otherwise periodicity
-   * is not maintained. ---*/
+   * is not maintained. Save the halo coordinates first to also catch the points the
+   * communication moves (the transformed displacements differ from LinSysSol). ---*/
+
+  vector<su2double> haloCoord((nPoint-nPointDomain)*nDim);
+
+  for (iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+    for (iDim = 0; iDim < nDim; iDim++)
+      haloCoord[(iPoint-nPointDomain)*nDim + iDim] = geometry->nodes->GetCoord(iPoint, iDim);
 
   geometry->InitiateComms(geometry, config, COORDINATES);
   geometry->CompleteComms(geometry, config, COORDINATES);
 
+  for (iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+    for (iDim = 0; iDim < nDim; iDim++)
+      if (geometry->nodes->GetCoord(iPoint, iDim) != haloCoord[(iPoint-nPointDomain)*nDim + iDim])
+        PointMoved[iPoint] = true;
+
+  PointMovedValid = true;
+
 }
 
 void CVolumetricMovement::UpdateDualGrid(CGeometry *geometry, CConfig *config) {
@@ -90,7 +126,18 @@ void CVolumetricMovement::UpdateDualGrid(CGeometry *geometry, CConfig *config) {
   /*--- After moving all nodes, update the dual mesh. Recompute the edges and
    dual mesh control volumes in the domain and on the boundaries. ---*/
 
+#if !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+  /*--- When the moved points of the last grid update are known, restrict the
+   volume metric recomputation to the region the deformation touched. The tape
+   of the discrete adjoint needs the dependence of every metric on the
+   coordinates, so AD builds always recompute globally. ---*/
+  if (PointMovedValid) geometry->UpdateControlVolume(config, PointMoved);
+  else geometry->SetControlVolume(config, UPDATE);
+#else
   geometry->SetControlVolume(config, UPDATE);
+#endif
+  PointMovedValid = false;
+
   geometry->SetBoundControlVolume(config, UPDATE);
   geometry->SetMaxLength(config);
 
@@ -138,11 +185,17 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
 
   for (auto iNonlinear_Iter = 0ul; iNonlinear_Iter < Nonlinear_Iter; iNonlinear_Iter++) {
 
-    /*--- Initialize vector and sparse matrix ---*/
+    /*--- Initialize vector and sparse matrix (or the matrix-free equivalents) ---*/
 
     LinSysSol.SetValZero();
     LinSysRes.SetValZero();
-    StiffMatrix.SetValZero();
+    if (MatrixFree) {
+      fill(FixedDOF.begin(), FixedDOF.end(), 0);
+      fill(InvDiagonal.begin(), InvDiagonal.end(), StiffScalar(0.0));
+    }
+    else {
+      StiffMatrix.SetValZero();
+    }
 
     /*--- Compute the stiffness matrix entries for all nodes/elements in the
      mesh. FEA uses a finite element method discretization of the linear
@@ -182,15 +235,26 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     /*--- If we want no derivatives or the direct derivatives, we solve the system using the
      * normal matrix vector product and preconditioner. For the mesh sensitivities using
      * the discrete adjoint method we solve the system using the transposed matrix. ---*/
-    if (!Derivative || ((config->GetKind_SU2() == SU2_COMPONENT::SU2_CFD) && Derivative)) {
+    su2double Residual = 0.0;
+
+    if (MatrixFree) {
+
+      if (Derivative && (config->GetKind_SU2() == SU2_COMPONENT::SU2_DOT))
+        SU2_MPI::Error("The transposed (SU2_DOT) solve is not available in matrix-free mesh deformation,\n"
+                       "disable DEFORM_MATRIX_FREE.", CURRENT_FUNCTION);
+
+      Tot_Iter = SolveMatrixFree(geometry, config, Residual);
+
+    } else if (!Derivative || ((config->GetKind_SU2() == SU2_COMPONENT::SU2_CFD) && Derivative)) {
 
       Tot_Iter = System.Solve(StiffMatrix, LinSysRes, LinSysSol, geometry, config);
+      Residual = System.GetResidual();
 
     } else if (Derivative && (config->GetKind_SU2() == SU2_COMPONENT::SU2_DOT)) {
 
       Tot_Iter = System.Solve_b(StiffMatrix, LinSysRes, LinSysSol, geometry, config);
+      Residual = System.GetResidual();
     }
-    su2double Residual = System.GetResidual();
 
     /*--- Update the grid coordinates and cell volumes using the solution
      of the linear system (usol contains the x, y, z displacements). ---*/
@@ -1533,6 +1597,26 @@ void CVolumetricMovement::AddFEA_StiffMatrix(CGeometry *geometry, su2double **St
     for (jVar = 0; jVar < nVar; jVar++)
       StiffMatrix_Node[iVar][jVar] = 0.0;
 
+  /*--- In matrix-free mode only the diagonal blocks are stored, they build the
+   preconditioner, the off-diagonal action is evaluated element-wise on the fly. ---*/
+
+  if (MatrixFree) {
+    for (iVar = 0; iVar < nNodes; iVar++) {
+      const auto iPoint = PointCorners[iVar];
+      if (iPoint >= nPointDomain) continue;
+      for (iDim = 0; iDim < nVar; iDim++)
+        for (jDim = 0; jDim < nVar; jDim++)
+          InvDiagonal[(iPoint*nVar + iDim)*nVar + jDim] +=
+            SU2_TYPE::GetValue(StiffMatrix_Elem[(iVar*nVar)+iDim][(iVar*nVar)+jDim]);
+    }
+
+    for (iVar = 0; iVar < nVar; iVar++)
+      delete [] StiffMatrix_Node[iVar];
+    delete [] StiffMatrix_Node;
+
+    return;
+  }
+
   /*--- Transform the stiffness matrix for the hexahedral element into the
    contributions for the individual nodes relative to each other. ---*/
 
@@ -1558,6 +1642,236 @@ void CVolumetricMovement::AddFEA_StiffMatrix(CGeometry *geometry, su2double **St
 
 }
 
+void CVolumetricMovement::StiffnessAction(CGeometry *geometry, CConfig *config, const CSysVector<StiffScalar> &u,
+                                          CSysVector<StiffScalar> &v) {
+
+  unsigned short iVar, iDim, jDim, nNodes = 0, iNodes, jNodes, StiffMatrix_nElem = 0;
+  unsigned long iElem, iPoint, total_index, PointCorners[8];
+  su2double **StiffMatrix_Elem = nullptr, CoordCorners[8][3];
+  su2double ElemVolume = 0.0, ElemDistance = 0.0;
+
+  /*--- Allocate maximum size (quadrilateral and hexahedron) ---*/
+
+  if (nDim == 2) StiffMatrix_nElem = 8;
+  else StiffMatrix_nElem = 24;
+
+  StiffMatrix_Elem = new su2double* [StiffMatrix_nElem];
+  for (iVar = 0; iVar < StiffMatrix_nElem; iVar++)
+    StiffMatrix_Elem[iVar] = new su2double [StiffMatrix_nElem];
+
+  v.SetValZero();
+
+  /*--- Evaluate the action of the stiffness operator element-wise, the element
+   matrices are recomputed on the fly instead of being assembled and stored.
+   The element volumes and wall distances were computed during the call to
+   SetFEAMethodContributions_Elem at the start of the deformation. ---*/
+
+  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+
+    if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)      nNodes = 3;
+    if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) nNodes = 4;
+    if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON)   nNodes = 4;
+    if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID)       nNodes = 5;
+    if (geometry->elem[iElem]->GetVTK_Type() == PRISM)         nNodes = 6;
+    if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON)    nNodes = 8;
+
+    for (iNodes = 0; iNodes < nNodes; iNodes++) {
+      PointCorners[iNodes] = geometry->elem[iElem]->GetNode(iNodes);
+      for (iDim = 0; iDim < nDim; iDim++) {
+        CoordCorners[iNodes][iDim] = geometry->nodes->GetCoord(PointCorners[iNodes], iDim);
+      }
+    }
+
+    ElemVolume = geometry->elem[iElem]->GetVolume();
+
+    if ((config->GetDeform_Stiffness_Type() == SOLID_WALL_DISTANCE)) {
+      ElemDistance = 0.0;
+      for (iNodes = 0; iNodes < nNodes; iNodes++)
+        ElemDistance += geometry->nodes->GetWall_Distance(PointCorners[iNodes]);
+      ElemDistance = ElemDistance/(su2double)nNodes;
+    }
+
+    if (nDim == 2) SetFEA_StiffMatrix2D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume, ElemDistance);
+    if (nDim == 3) SetFEA_StiffMatrix3D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume, ElemDistance);
+
+    /*--- Scatter the element contribution, v += K_e * u ---*/
+
+    for (iNodes = 0; iNodes < nNodes; iNodes++) {
+      for (jNodes = 0; jNodes < nNodes; jNodes++) {
+        for (iDim = 0; iDim < nVar; iDim++) {
+          for (jDim = 0; jDim < nVar; jDim++) {
+            v[PointCorners[iNodes]*nVar+iDim] += SU2_TYPE::GetValue(StiffMatrix_Elem[(iNodes*nVar)+iDim][(jNodes*nVar)+jDim]) *
+                                                 u[PointCorners[jNodes]*nVar+jDim];
+          }
+        }
+      }
+    }
+
+  }
+
+  /*--- The degrees of freedom with prescribed displacements are identity rows
+   of the operator, equivalent to DeleteValsRowi on the assembled matrix. ---*/
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (iDim = 0; iDim < nVar; iDim++) {
+      total_index = iPoint*nVar + iDim;
+      if (FixedDOF[total_index]) v[total_index] = u[total_index];
+    }
+  }
+
+  /*--- Halo values come from their owning rank, as in the assembled product. ---*/
+
+  CSysMatrixComms::Initiate(v, geometry, config);
+  CSysMatrixComms::Complete(v, geometry, config);
+
+  /*--- Deallocate memory and exit ---*/
+
+  for (iVar = 0; iVar < StiffMatrix_nElem; iVar++)
+    delete [] StiffMatrix_Elem[iVar];
+  delete [] StiffMatrix_Elem;
+
+}
+
+namespace {
+/*--- Helper classes to drive the Krylov solvers in matrix-free mode, the
+ product delegates to the element-wise stiffness action and the preconditioner
+ applies the inverted diagonal blocks of the operator (block Jacobi). ---*/
+
+using StiffScalar = CVolumetricMovement::StiffScalar;
+
+class CStiffnessActionProduct final : public CMatrixVectorProduct<StiffScalar> {
+private:
+  CVolumetricMovement* movement;
+  CGeometry* geometry;
+  CConfig* config;
+public:
+  CStiffnessActionProduct(CVolumetricMovement* movement_, CGeometry* geometry_, CConfig* config_) :
+    movement(movement_), geometry(geometry_), config(config_) {}
+
+  inline void operator()(const CSysVector<StiffScalar> & u, CSysVector<StiffScalar> & v) const override {
+    movement->StiffnessAction(geometry, config, u, v);
+  }
+};
+
+class CStiffnessJacobiPreconditioner final : public CPreconditioner<StiffScalar> {
+private:
+  const vector<StiffScalar>& invDiag;
+  unsigned short nVar;
+  unsigned long nPointDomain;
+  CGeometry* geometry;
+  const CConfig* config;
+public:
+  CStiffnessJacobiPreconditioner(const vector<StiffScalar>& invDiag_, unsigned short nVar_,
+                                 unsigned long nPointDomain_, CGeometry* geometry_, const CConfig* config_) :
+    invDiag(invDiag_), nVar(nVar_), nPointDomain(nPointDomain_), geometry(geometry_), config(config_) {}
+
+  inline void operator()(const CSysVector<StiffScalar> & u, CSysVector<StiffScalar> & v) const override {
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+        StiffScalar sum = 0.0;
+        for (unsigned short jVar = 0; jVar < nVar; jVar++)
+          sum += invDiag[(iPoint*nVar + iVar)*nVar + jVar] * u[iPoint*nVar + jVar];
+        v[iPoint*nVar + iVar] = sum;
+      }
+    }
+    CSysMatrixComms::Initiate(v, geometry, config);
+    CSysMatrixComms::Complete(v, geometry, config);
+  }
+};
+}
+
+unsigned long CVolumetricMovement::SolveMatrixFree(CGeometry *geometry, CConfig *config, su2double &Residual) {
+
+  unsigned long iPoint, total_index;
+  unsigned short iVar, jVar, kVar;
+
+  /*--- Finish the block Jacobi preconditioner, fixed degrees of freedom become
+   identity rows of their diagonal blocks, then invert the blocks in place
+   (Gauss-Jordan with partial pivoting, the blocks are 2x2 or 3x3). ---*/
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+    StiffScalar *block = &InvDiagonal[iPoint*nVar*nVar];
+
+    for (iVar = 0; iVar < nVar; iVar++) {
+      total_index = iPoint*nVar + iVar;
+      if (FixedDOF[total_index])
+        for (jVar = 0; jVar < nVar; jVar++)
+          block[iVar*nVar + jVar] = (iVar == jVar)? 1.0 : 0.0;
+    }
+
+    StiffScalar aug[3][6] = {{0.0}};
+    for (iVar = 0; iVar < nVar; iVar++) {
+      for (jVar = 0; jVar < nVar; jVar++) aug[iVar][jVar] = block[iVar*nVar + jVar];
+      aug[iVar][nVar + iVar] = 1.0;
+    }
+    for (iVar = 0; iVar < nVar; iVar++) {
+      kVar = iVar;
+      for (jVar = iVar+1; jVar < nVar; jVar++)
+        if (fabs(aug[jVar][iVar]) > fabs(aug[kVar][iVar])) kVar = jVar;
+      if (kVar != iVar)
+        for (jVar = 0; jVar < 2*nVar; jVar++) swap(aug[iVar][jVar], aug[kVar][jVar]);
+      const StiffScalar pivot = aug[iVar][iVar];
+      for (jVar = 0; jVar < 2*nVar; jVar++) aug[iVar][jVar] /= pivot;
+      for (kVar = 0; kVar < nVar; kVar++) {
+        if (kVar == iVar) continue;
+        const StiffScalar factor = aug[kVar][iVar];
+        for (jVar = 0; jVar < 2*nVar; jVar++) aug[kVar][jVar] -= factor*aug[iVar][jVar];
+      }
+    }
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (jVar = 0; jVar < nVar; jVar++)
+        block[iVar*nVar + jVar] = aug[iVar][nVar + jVar];
+
+  }
+
+  /*--- The Krylov solvers work with the scalar type of the operator. ---*/
+
+  CSysVector<StiffScalar> rhs, sol;
+  rhs.PassiveCopy(LinSysRes);
+  sol.PassiveCopy(LinSysSol);
+
+  CStiffnessActionProduct mat_vec(this, geometry, config);
+  CStiffnessJacobiPreconditioner precond(InvDiagonal, nVar, nPointDomain, geometry, config);
+
+  const StiffScalar SolverTol = SU2_TYPE::GetValue(config->GetDeform_Linear_Solver_Error());
+  const unsigned long MaxIter = config->GetDeform_Linear_Solver_Iter();
+  const bool ScreenOutput = config->GetDeform_Output();
+
+  unsigned long IterLinSol = 0;
+  StiffScalar residual = 0.0;
+
+  switch (config->GetKind_Deform_Linear_Solver()) {
+    case BCGSTAB:
+      IterLinSol = System.BCGSTAB_LinSolver(rhs, sol, mat_vec, precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+      break;
+    case FGMRES:
+      IterLinSol = System.FGMRES_LinSolver(rhs, sol, mat_vec, precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+      break;
+    case RESTARTED_FGMRES:
+      IterLinSol = System.RFGMRES_LinSolver(rhs, sol, mat_vec, precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+      break;
+    case CA_FGMRES:
+      IterLinSol = System.FGMRES_LinSolver(rhs, sol, mat_vec, precond, SolverTol, MaxIter, residual, ScreenOutput, config, true);
+      break;
+    case CONJUGATE_GRADIENT:
+      IterLinSol = System.CG_LinSolver(rhs, sol, mat_vec, precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+      break;
+    case SMOOTHER:
+      IterLinSol = System.Smoother_LinSolver(rhs, sol, mat_vec, precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+      break;
+    default:
+      SU2_MPI::Error("The specified linear solver is not available in matrix-free mesh deformation.", CURRENT_FUNCTION);
+  }
+
+  Residual = residual;
+
+  LinSysSol.PassiveCopy(sol);
+
+  return IterLinSol;
+
+}
+
 void CVolumetricMovement::SetBoundaryDisplacements(CGeometry *geometry, CConfig *config) {
 
   unsigned short iDim, nDim = geometry->GetnDim(), iMarker, axis = 0;
@@ -1589,7 +1903,7 @@ void CVolumetricMovement::SetBoundaryDisplacements(CGeometry *geometry, CConfig
           total_index = iPoint*nDim + iDim;
           LinSysRes[total_index] = 0.0;
           LinSysSol[total_index] = 0.0;
-          StiffMatrix.DeleteValsRowi(total_index);
+          SetFixed_DOF(total_index);
         }
       }
     }
@@ -1610,7 +1924,7 @@ void CVolumetricMovement::SetBoundaryDisplacements(CGeometry *geometry, CConfig
           total_index = iPoint*nDim + iDim;
           LinSysRes[total_index] = SU2_TYPE::GetValue(VarCoord[iDim] * VarIncrement);
           LinSysSol[total_index] = SU2_TYPE::GetValue(VarCoord[iDim] * VarIncrement);
-          StiffMatrix.DeleteValsRowi(total_index);
+          SetFixed_DOF(total_index);
         }
       }
     }
@@ -1652,7 +1966,7 @@ void CVolumetricMovement::SetBoundaryDisplacements(CGeometry *geometry, CConfig
         total_index = iPoint*nDim + axis;
         LinSysRes[total_index] = 0.0;
         LinSysSol[total_index] = 0.0;
-        StiffMatrix.DeleteValsRowi(total_index);
+        SetFixed_DOF(total_index);
       }
     }
   }
@@ -1667,7 +1981,7 @@ void CVolumetricMovement::SetBoundaryDisplacements(CGeometry *geometry, CConfig
           total_index = iPoint*nDim + iDim;
           LinSysRes[total_index] = 0.0;
           LinSysSol[total_index] = 0.0;
-          StiffMatrix.DeleteValsRowi(total_index);
+          SetFixed_DOF(total_index);
         }
       }
     }
@@ -1684,7 +1998,7 @@ void CVolumetricMovement::SetBoundaryDisplacements(CGeometry *geometry, CConfig
           total_index = iPoint*nDim + iDim;
           LinSysRes[total_index] = SU2_TYPE::GetValue(VarCoord[iDim] * VarIncrement);
           LinSysSol[total_index] = SU2_TYPE::GetValue(VarCoord[iDim] * VarIncrement);
-          StiffMatrix.DeleteValsRowi(total_index);
+          SetFixed_DOF(total_index);
         }
       }
     }
@@ -1783,7 +2097,7 @@ void CVolumetricMovement::SetDomainDisplacements(CGeometry *geometry, CConfig *c
           total_index = iPoint*nDim + iDim;
           LinSysRes[total_index] = 0.0;
           LinSysSol[total_index] = 0.0;
-          StiffMatrix.DeleteValsRowi(total_index);
+          SetFixed_DOF(total_index);
         }
       }
     }
@@ -1799,7 +2113,7 @@ void CVolumetricMovement::SetDomainDisplacements(CGeometry *geometry, CConfig *c
           total_index = iPoint*nDim + iDim;
           LinSysRes[total_index] = 0.0;
           LinSysSol[total_index] = 0.0;
-          StiffMatrix.DeleteValsRowi(total_index);
+          SetFixed_DOF(total_index);
         }
       }
     }
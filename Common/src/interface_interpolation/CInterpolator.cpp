@@ -28,6 +28,7 @@
 #include "../../include/interface_interpolation/CInterpolator.hpp"
 
 #include <set>
+#include <unordered_map>
 
 #include "../../include/CConfig.hpp"
 #include "../../include/geometry/CGeometry.hpp"
@@ -71,14 +72,15 @@ void CInterpolator::Determine_ArraySize(int markDonor, int markTarget, unsigned
   Buffer_Send_nVertex_Donor[0] = nLocalVertex_Donor;
 
   /*--- Send Interface vertex information --*/
-  SU2_MPI::Allreduce(&nLocalVertex_Donor, &MaxLocalVertex_Donor, 1, MPI_UNSIGNED_LONG, MPI_MAX, SU2_MPI::GetComm());
   SU2_MPI::Allgather(Buffer_Send_nVertex_Donor, 1, MPI_UNSIGNED_LONG, Buffer_Receive_nVertex_Donor, 1,
                      MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
 }
 
 void CInterpolator::Collect_VertexInfo(int markDonor, int markTarget, unsigned long nVertexDonor, unsigned short nDim) {
-  Buffer_Send_Coord.resize(MaxLocalVertex_Donor, nDim);
-  Buffer_Send_GlobalPoint.resize(MaxLocalVertex_Donor) = -1;
+  const auto nLocalVertex = Buffer_Send_nVertex_Donor[0];
+
+  Buffer_Send_Coord.resize(nLocalVertex, nDim);
+  Buffer_Send_GlobalPoint.resize(nLocalVertex);
 
   /*--- Copy coordinates and point to the auxiliar vector --*/
   unsigned long iLocalVertexDonor = 0;
@@ -93,10 +95,26 @@ void CInterpolator::Collect_VertexInfo(int markDonor, int markTarget, unsigned l
     }
   }
 
-  SU2_MPI::Allgather(Buffer_Send_Coord.data(), MaxLocalVertex_Donor * nDim, MPI_DOUBLE, Buffer_Receive_Coord.data(),
-                     MaxLocalVertex_Donor * nDim, MPI_DOUBLE, SU2_MPI::GetComm());
-  SU2_MPI::Allgather(Buffer_Send_GlobalPoint.data(), MaxLocalVertex_Donor, MPI_UNSIGNED_LONG,
-                     Buffer_Receive_GlobalPoint.data(), MaxLocalVertex_Donor, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+  /*--- Gather the donor information of all ranks back-to-back, the memory footprint
+   *    is thus proportional to the global interface size instead of the maximum rank
+   *    contribution (padded) times the number of ranks. ---*/
+  vector<int> counts(size), displs(size), countsCoord(size), displsCoord(size);
+  unsigned long nGlobalVertexDonor = 0;
+  for (int iProcessor = 0; iProcessor < size; ++iProcessor) {
+    counts[iProcessor] = static_cast<int>(Buffer_Receive_nVertex_Donor[iProcessor]);
+    displs[iProcessor] = static_cast<int>(nGlobalVertexDonor);
+    countsCoord[iProcessor] = counts[iProcessor] * nDim;
+    displsCoord[iProcessor] = displs[iProcessor] * nDim;
+    nGlobalVertexDonor += Buffer_Receive_nVertex_Donor[iProcessor];
+  }
+  Buffer_Receive_Coord.resize(nGlobalVertexDonor, nDim);
+  Buffer_Receive_GlobalPoint.resize(nGlobalVertexDonor);
+
+  SU2_MPI::Allgatherv(Buffer_Send_Coord.data(), nLocalVertex * nDim, MPI_DOUBLE, Buffer_Receive_Coord.data(),
+                      countsCoord.data(), displsCoord.data(), MPI_DOUBLE, SU2_MPI::GetComm());
+  SU2_MPI::Allgatherv(Buffer_Send_GlobalPoint.data(), nLocalVertex, MPI_UNSIGNED_LONG,
+                      Buffer_Receive_GlobalPoint.data(), counts.data(), displs.data(), MPI_UNSIGNED_LONG,
+                      SU2_MPI::GetComm());
 }
 
 unsigned long CInterpolator::Collect_ElementInfo(int markDonor, unsigned short nDim, bool compress,
@@ -343,21 +361,23 @@ void CInterpolator::ReconstructBoundary(unsigned long val_zone, int val_marker)
   /*--- Master process replaces global point indices in Buffer_Receive_LinkedNodes by their indices in
    * Buffer_Receive_GlobalPoint, Buffer_Receive_nLinkedNodes etc. ---*/
   if (rank == MASTER_NODE) {
+    /*--- Map global point indices to global vertex indices, the direct search over
+     *    Buffer_Receive_GlobalPoint was quadratic in the interface size. ---*/
+    unordered_map<unsigned long, unsigned long> globalPointToVertex;
+    globalPointToVertex.reserve(nGlobalVertex);
+    for (unsigned long iVertex = 0; iVertex < nGlobalVertex; iVertex++)
+      globalPointToVertex[Buffer_Receive_GlobalPoint[iVertex]] = iVertex;
+
     for (unsigned long iVertex = 0; iVertex < nGlobalVertex; iVertex++) {
       unsigned long *uptr = &Buffer_Receive_LinkedNodes[Buffer_Receive_StartLinkedNodes[iVertex]];
 
       for (unsigned long jLinkedNode = 0; jLinkedNode < Buffer_Receive_nLinkedNodes[iVertex]; jLinkedNode++) {
-        const auto jPoint = uptr[jLinkedNode];
-        bool found = false;  // Global point index has been found
-        for (unsigned long kVertex = 0; kVertex < nGlobalVertex; kVertex++) {
-          if (Buffer_Receive_GlobalPoint[kVertex] == jPoint) {
-            uptr[jLinkedNode] = kVertex;
-            found = true;
-            break;
-          }
-        }
+        const auto it = globalPointToVertex.find(uptr[jLinkedNode]);
 
-        if (!found) {  // remove from list
+        if (it != globalPointToVertex.end()) {
+          uptr[jLinkedNode] = it->second;
+        }
+        else {  // remove from list
           for (unsigned long kVertex = jLinkedNode; kVertex < Buffer_Receive_nLinkedNodes[iVertex] - 1; kVertex++) {
             uptr[kVertex] = uptr[kVertex + 1];
           }
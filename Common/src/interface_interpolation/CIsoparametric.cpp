@@ -87,23 +87,18 @@ void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
     if (markDonor != -1) nVertexDonor = donor_geometry->GetnVertex(markDonor);
     if (markTarget != -1) nVertexTarget = target_geometry->GetnVertex(markTarget);
 
-    /*--- Sets MaxLocalVertex_Donor, Buffer_Receive_nVertex_Donor. ---*/
+    /*--- Sets Buffer_Receive_nVertex_Donor. ---*/
     Determine_ArraySize(markDonor, markTarget, nVertexDonor, nDim);
 
     const auto nGlobalVertexDonor = accumulate(Buffer_Receive_nVertex_Donor,
                                     Buffer_Receive_nVertex_Donor+nProcessor, 0ul);
 
-    Buffer_Send_Coord.resize(MaxLocalVertex_Donor, nDim);
-    Buffer_Send_GlobalPoint .resize(MaxLocalVertex_Donor);
-    Buffer_Receive_Coord.resize(nProcessor*MaxLocalVertex_Donor,nDim);
-    Buffer_Receive_GlobalPoint.resize(nProcessor * MaxLocalVertex_Donor);
-
     /*--- Collect coordinates and global point indices. ---*/
     Collect_VertexInfo(markDonor, markTarget, nVertexDonor, nDim);
     if (nVertexTarget) targetVertices[markTarget].resize(nVertexTarget);
 
-    /*--- Compress the vertex information, and build a map of global point to "compressed
-     *    index" to then reconstruct the donor elements in local index space. ---*/
+    /*--- Copy the vertex information (the receive buffers are compact), and build a map of
+     *    global point to donor index to then reconstruct the donor elements in local index space. ---*/
 
     su2activematrix donorCoord(nGlobalVertexDonor, nDim);
     vector<long> donorPoint(nGlobalVertexDonor);
@@ -112,11 +107,10 @@ void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
 
     auto iCount = 0ul;
     for (int iProcessor = 0; iProcessor < nProcessor; ++iProcessor) {
-      auto offset = iProcessor * MaxLocalVertex_Donor;
       for (auto iVertex = 0ul; iVertex < Buffer_Receive_nVertex_Donor[iProcessor]; ++iVertex) {
         for (int iDim = 0; iDim < nDim; ++iDim)
-          donorCoord(iCount,iDim) = Buffer_Receive_Coord(offset+iVertex, iDim);
-        donorPoint[iCount] = Buffer_Receive_GlobalPoint[offset+iVertex];
+          donorCoord(iCount,iDim) = Buffer_Receive_Coord(iCount, iDim);
+        donorPoint[iCount] = Buffer_Receive_GlobalPoint[iCount];
         donorProc[iCount] = iProcessor;
         assert((globalToLocalMap.count(donorPoint[iCount]) == 0) && "Duplicate donor point found.");
         globalToLocalMap[donorPoint[iCount]] = iCount;
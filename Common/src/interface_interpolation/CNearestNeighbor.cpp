@@ -79,18 +79,13 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
     if (markDonor != -1) nVertexDonor = donor_geometry->GetnVertex(markDonor);
     if (markTarget != -1) nVertexTarget = target_geometry->GetnVertex(markTarget);
 
-    /*--- Sets MaxLocalVertex_Donor, Buffer_Receive_nVertex_Donor. ---*/
+    /*--- Sets Buffer_Receive_nVertex_Donor. ---*/
     Determine_ArraySize(markDonor, markTarget, nVertexDonor, nDim);
     if (nVertexTarget) targetVertices[markTarget].resize(nVertexTarget);
 
     const auto nPossibleDonor = accumulate(Buffer_Receive_nVertex_Donor,
                                 Buffer_Receive_nVertex_Donor+nProcessor, 0ul);
 
-    Buffer_Send_Coord.resize(MaxLocalVertex_Donor, nDim);
-    Buffer_Send_GlobalPoint.resize(MaxLocalVertex_Donor);
-    Buffer_Receive_Coord.resize(nProcessor * MaxLocalVertex_Donor, nDim);
-    Buffer_Receive_GlobalPoint.resize(nProcessor * MaxLocalVertex_Donor);
-
     /*--- Collect coordinates and global point indices. ---*/
     Collect_VertexInfo(markDonor, markTarget, nVertexDonor, nDim);
 
@@ -115,13 +110,13 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
       /*--- Coordinates of the target point. ---*/
       const su2double* Coord_i = target_geometry->nodes->GetCoord(Point_Target);
 
-      /*--- Compute all distances. ---*/
+      /*--- Compute all distances, the receive buffers are compact and thus
+       *    indexed by the running donor count. ---*/
       for (int iProcessor = 0, iDonor = 0; iProcessor < nProcessor; ++iProcessor) {
         for (auto jVertex = 0ul; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; ++jVertex) {
 
-          const auto idx = iProcessor*MaxLocalVertex_Donor + jVertex;
-          const auto pGlobalPoint = Buffer_Receive_GlobalPoint[idx];
-          const su2double* Coord_j = Buffer_Receive_Coord[idx];
+          const auto pGlobalPoint = Buffer_Receive_GlobalPoint[iDonor];
+          const su2double* Coord_j = Buffer_Receive_Coord[iDonor];
           const auto dist2 = GeometryToolbox::SquaredDistance(nDim, Coord_i, Coord_j);
 
           donorInfo[iDonor++] = DonorInfo(dist2, pGlobalPoint, iProcessor);
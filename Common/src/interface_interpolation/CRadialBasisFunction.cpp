@@ -101,6 +101,11 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
   const bool usePolynomial = config[donorZone]->GetRadialBasisFunctionPolynomialOption();
   const su2double paramRBF = config[donorZone]->GetRadialBasisFunctionParameter();
   const su2double pruneTol = config[donorZone]->GetRadialBasisFunctionPruneTol();
+  const auto maxClusterSize = config[donorZone]->GetRadialBasisFunctionMaxClusterSize();
+
+  /*--- In partition-of-unity mode the dense donor system is replaced by small systems
+   *    over clusters of donors, each rank then interpolates its own target points. ---*/
+  const bool usePartitionOfUnity = (maxClusterSize > 0);
 
   const auto nMarkerInt = config[donorZone]->GetMarker_n_ZoneInterface()/2;
   const int nDim = donor_geometry->GetnDim();
@@ -135,7 +140,7 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
     unsigned long nVertexDonor = 0;
     if (markDonor != -1) nVertexDonor = donor_geometry->GetnVertex(markDonor);
 
-    /*--- Sets MaxLocalVertex_Donor, Buffer_Receive_nVertex_Donor. ---*/
+    /*--- Sets Buffer_Receive_nVertex_Donor. ---*/
     Determine_ArraySize(markDonor, markTarget, nVertexDonor, nDim);
 
     /*--- Compute total number of donor vertices. ---*/
@@ -143,14 +148,9 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
                                     Buffer_Receive_nVertex_Donor+nProcessor, 0ul);
 
     /*--- Gather coordinates and global point indices. ---*/
-    Buffer_Send_Coord.resize(MaxLocalVertex_Donor, nDim);
-    Buffer_Send_GlobalPoint.resize(MaxLocalVertex_Donor);
-    Buffer_Receive_Coord.resize(nProcessor * MaxLocalVertex_Donor, nDim);
-    Buffer_Receive_GlobalPoint.resize(nProcessor * MaxLocalVertex_Donor);
-
     Collect_VertexInfo(markDonor, markTarget, nVertexDonor, nDim);
 
-    /*--- Compresses the gathered donor point information to simplify computations. ---*/
+    /*--- Copies the gathered donor point information to simplify computations. ---*/
     auto& donorCoord = donorCoordinates[iMarkerInt];
     auto& donorPoint = donorGlobalPoint[iMarkerInt];
     auto& donorProc = donorProcessor[iMarkerInt];
@@ -160,11 +160,10 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
 
     auto iCount = 0ul;
     for (int iProcessor = 0; iProcessor < nProcessor; ++iProcessor) {
-      auto offset = iProcessor * MaxLocalVertex_Donor;
       for (auto iVertex = 0ul; iVertex < Buffer_Receive_nVertex_Donor[iProcessor]; ++iVertex) {
         for (int iDim = 0; iDim < nDim; ++iDim)
-          donorCoord(iCount,iDim) = Buffer_Receive_Coord(offset+iVertex, iDim);
-        donorPoint[iCount] = Buffer_Receive_GlobalPoint[offset+iVertex];
+          donorCoord(iCount,iDim) = Buffer_Receive_Coord(iCount, iDim);
+        donorPoint[iCount] = Buffer_Receive_GlobalPoint[iCount];
         donorProc[iCount] = iProcessor;
         ++iCount;
       }
@@ -187,6 +186,13 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
         swap(donorCoord(i,iDim), donorCoord(j,iDim));
     }
 
+    /*--- In partition-of-unity mode there is no large matrix inversion to schedule,
+     *    each rank processes its own target points of every interface. ---*/
+    if (usePartitionOfUnity) {
+      assignedProcessor[iMarkerInt] = rank;
+      continue;
+    }
+
     /*--- Static work scheduling over ranks based on which one has less work currently. ---*/
     int iProcessor = 0;
     for (int i = 1; i < nProcessor; ++i)
@@ -205,15 +211,17 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
   vector<vector<int> > keepPolynomialRowVec(nMarkerInt, vector<int>(nDim,1));
   vector<su2passivematrix> CinvTrucVec(nMarkerInt);
 
-  SU2_OMP_PARALLEL_(for schedule(dynamic,1))
-  for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; ++iMarkerInt) {
-    if (rank == assignedProcessor[iMarkerInt]) {
-      ComputeGeneratorMatrix(kindRBF, usePolynomial, paramRBF,
-                             donorCoordinates[iMarkerInt], nPolynomialVec[iMarkerInt],
-                             keepPolynomialRowVec[iMarkerInt], CinvTrucVec[iMarkerInt]);
+  if (!usePartitionOfUnity) {
+    SU2_OMP_PARALLEL_(for schedule(dynamic,1))
+    for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; ++iMarkerInt) {
+      if (rank == assignedProcessor[iMarkerInt]) {
+        ComputeGeneratorMatrix(kindRBF, usePolynomial, paramRBF,
+                               donorCoordinates[iMarkerInt], nPolynomialVec[iMarkerInt],
+                               keepPolynomialRowVec[iMarkerInt], CinvTrucVec[iMarkerInt]);
+      }
     }
+    END_SU2_OMP_PARALLEL
   }
-  END_SU2_OMP_PARALLEL
 
   /*--- Final loop over interface markers to compute the interpolation coefficients. ---*/
 
@@ -245,6 +253,7 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
     const auto nGlobalVertexDonor = donorCoord.rows();
 
 #ifdef HAVE_MPI
+    if (!usePartitionOfUnity) {
     /*--- For simplicity, broadcast small information about the interpolation matrix. ---*/
     SU2_MPI::Bcast(&nPolynomial, 1, MPI_INT, iProcessor, SU2_MPI::GetComm());
     SU2_MPI::Bcast(keepPolynomialRow.data(), nDim, MPI_INT, iProcessor, SU2_MPI::GetComm());
@@ -266,6 +275,7 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
       MPI_Recv(C_inv_trunc.data(), C_inv_trunc.size(), MPI_DOUBLE,
                iProcessor, 0, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
     }
+    }
 #endif
 
     /*--- Compute interpolation matrix (H). This is a large matrix-matrix product with
@@ -285,6 +295,22 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
     totalTargetPoints += nVertexTarget;
     denseSize += nVertexTarget*nGlobalVertexDonor;
 
+    /*--- Partition-of-unity mode, blend small cluster interpolants for the local targets. ---*/
+
+    if (usePartitionOfUnity) {
+      if (nVertexTarget > 0)
+        ComputePartitionOfUnityCoefficients(kindRBF, usePolynomial, paramRBF, SU2_TYPE::GetValue(pruneTol),
+                                            maxClusterSize, donorCoord, donorPoint, donorProc,
+                                            targetCoord, targetVertices[markTarget], totalDonorPoints);
+
+      /*--- Free global data that will no longer be used. ---*/
+      donorCoord.resize(0,0);
+      vector<long>().swap(donorPoint);
+      vector<int>().swap(donorProc);
+
+      continue;
+    }
+
     /*--- Distribute target slabs over the threads in the rank for processing. ---*/
 
     SU2_OMP_PARALLEL
@@ -587,3 +613,263 @@ int CRadialBasisFunction::CheckPolynomialTerms(su2double max_diff_tol, vector<in
 
   return n_polynomial;
 }
+
+void CRadialBasisFunction::ComputePartitionOfUnityCoefficients(RADIAL_BASIS type, bool usePolynomial,
+                             su2double radius, passivedouble pruneTol, unsigned long maxClusterSize,
+                             const su2activematrix& donorCoord, const vector<long>& donorPoint,
+                             const vector<int>& donorProc, const vector<const su2double*>& targetCoord,
+                             vector<CDonorInfo>& targetDonorInfo, unsigned long& totalDonorPoints) {
+
+  const int nDim = donorCoord.cols();
+  const auto nGlobalVertexDonor = donorCoord.rows();
+  const auto nVertexTarget = targetCoord.size();
+
+  /*--- Split the donor points into compact clusters of at most maxClusterSize points
+   *    by recursively bisecting the longest coordinate direction at the median. ---*/
+
+  vector<unsigned long> donorOrder(nGlobalVertexDonor);
+  iota(donorOrder.begin(), donorOrder.end(), 0ul);
+
+  vector<pair<unsigned long,unsigned long> > clusterRanges, openRanges;
+  openRanges.emplace_back(0ul, nGlobalVertexDonor);
+
+  while (!openRanges.empty()) {
+    const auto range = openRanges.back();
+    openRanges.pop_back();
+
+    if (range.second-range.first <= maxClusterSize) {
+      clusterRanges.push_back(range);
+      continue;
+    }
+
+    /*--- Find the coordinate direction with the largest extent. ---*/
+    passivedouble minCoord[3], maxCoord[3];
+    for (int iDim = 0; iDim < nDim; ++iDim) {
+      minCoord[iDim] = numeric_limits<passivedouble>::max();
+      maxCoord[iDim] = -numeric_limits<passivedouble>::max();
+    }
+    for (auto i = range.first; i < range.second; ++i) {
+      for (int iDim = 0; iDim < nDim; ++iDim) {
+        const auto x = SU2_TYPE::GetValue(donorCoord(donorOrder[i], iDim));
+        minCoord[iDim] = min(minCoord[iDim], x);
+        maxCoord[iDim] = max(maxCoord[iDim], x);
+      }
+    }
+    int splitDim = 0;
+    for (int iDim = 1; iDim < nDim; ++iDim)
+      if (maxCoord[iDim]-minCoord[iDim] > maxCoord[splitDim]-minCoord[splitDim]) splitDim = iDim;
+
+    /*--- Split at the median (the donor points are in a deterministic order at this
+     *    point, making the clusters independent of the number of ranks). ---*/
+    const auto mid = range.first + (range.second-range.first)/2;
+    nth_element(donorOrder.begin()+range.first, donorOrder.begin()+mid, donorOrder.begin()+range.second,
+                [&](unsigned long i, unsigned long j) {
+                  return donorCoord(i,splitDim) < donorCoord(j,splitDim);
+                });
+    openRanges.emplace_back(range.first, mid);
+    openRanges.emplace_back(mid, range.second);
+  }
+  const auto nClusters = clusterRanges.size();
+
+  /*--- Center and radius of the Wendland C2 weight function of each cluster. The weight
+   *    radius is larger than the cluster radius so that neighboring interpolants
+   *    overlap and are blended smoothly (Shepard partition-of-unity weights). ---*/
+
+  constexpr passivedouble overlapFactor = 1.5;
+
+  su2passivematrix centers(nClusters, nDim);
+  vector<passivedouble> weightRadius(nClusters);
+
+  auto distToCenter = [&](const su2double* coord, unsigned long iCluster) {
+    passivedouble d2 = 0.0;
+    for (int iDim = 0; iDim < nDim; ++iDim) {
+      const auto d = SU2_TYPE::GetValue(coord[iDim]) - centers(iCluster,iDim);
+      d2 += d*d;
+    }
+    return sqrt(d2);
+  };
+
+  for (auto iCluster = 0ul; iCluster < nClusters; ++iCluster) {
+    const auto range = clusterRanges[iCluster];
+
+    for (int iDim = 0; iDim < nDim; ++iDim) centers(iCluster,iDim) = 0.0;
+    for (auto i = range.first; i < range.second; ++i)
+      for (int iDim = 0; iDim < nDim; ++iDim)
+        centers(iCluster,iDim) += SU2_TYPE::GetValue(donorCoord(donorOrder[i], iDim));
+    for (int iDim = 0; iDim < nDim; ++iDim) centers(iCluster,iDim) /= range.second-range.first;
+
+    passivedouble clusterRadius = 0.0;
+    for (auto i = range.first; i < range.second; ++i)
+      clusterRadius = max(clusterRadius, distToCenter(donorCoord[donorOrder[i]], iCluster));
+
+    /*--- Guard against degenerate (single or coincident point) clusters. ---*/
+    weightRadius[iCluster] = max(overlapFactor*clusterRadius, numeric_limits<passivedouble>::epsilon());
+  }
+
+  /*--- Expand each cluster with all donor points inside its weight radius, such that
+   *    the local interpolant is exact at every donor point where its weight is > 0. ---*/
+
+  vector<vector<unsigned long> > clusterDonors(nClusters);
+
+  SU2_OMP_PARALLEL_(for schedule(dynamic,1))
+  for (auto iCluster = 0ul; iCluster < nClusters; ++iCluster) {
+    for (auto iDonor = 0ul; iDonor < nGlobalVertexDonor; ++iDonor)
+      if (distToCenter(donorCoord[iDonor], iCluster) <= weightRadius[iCluster])
+        clusterDonors[iCluster].push_back(iDonor);
+  }
+  END_SU2_OMP_PARALLEL
+
+  /*--- Sum of cluster weights for each target point, if a target point is not covered
+   *    by any weight function it falls back to the interpolant of the nearest cluster. ---*/
+
+  vector<passivedouble> sumWeights(nVertexTarget);
+  vector<long> fallbackCluster(nVertexTarget, -1);
+
+  SU2_OMP_PARALLEL_(for schedule(static,256))
+  for (auto iTarget = 0ul; iTarget < nVertexTarget; ++iTarget) {
+    passivedouble sumW = 0.0, minDist = numeric_limits<passivedouble>::max();
+    auto iNearest = 0ul;
+    for (auto iCluster = 0ul; iCluster < nClusters; ++iCluster) {
+      const auto d = distToCenter(targetCoord[iTarget], iCluster);
+      if (d < minDist) { minDist = d; iNearest = iCluster; }
+      sumW += SU2_TYPE::GetValue(Get_RadialBasisValue(RADIAL_BASIS::WENDLAND_C2, weightRadius[iCluster], d));
+    }
+    sumWeights[iTarget] = sumW;
+    if (sumW <= 0.0) fallbackCluster[iTarget] = long(iNearest);
+  }
+  END_SU2_OMP_PARALLEL
+
+  /*--- Main loop over the clusters, solve the small dense RBF system of each cluster
+   *    and accumulate the weighted coefficients of the local interpolant into the
+   *    target points covered by the cluster. ---*/
+
+  vector<vector<pair<unsigned long,passivedouble> > > contributions(nVertexTarget);
+
+  for (auto iCluster = 0ul; iCluster < nClusters; ++iCluster) {
+
+    const auto& members = clusterDonors[iCluster];
+    const auto clusterSize = members.size();
+
+    su2activematrix clusterCoord(clusterSize, nDim);
+    for (auto j = 0ul; j < clusterSize; ++j)
+      for (int iDim = 0; iDim < nDim; ++iDim)
+        clusterCoord(j,iDim) = donorCoord(members[j], iDim);
+
+    int nPolynomial = -1;
+    vector<int> keepPolynomialRow(nDim, 1);
+    su2passivematrix C_inv_trunc;
+    ComputeGeneratorMatrix(type, usePolynomial, radius, clusterCoord, nPolynomial,
+                           keepPolynomialRow, C_inv_trunc);
+
+    SU2_OMP_PARALLEL
+    {
+    vector<passivedouble> funcVec(1+nPolynomial+clusterSize);
+    vector<passivedouble> coeff(clusterSize);
+
+    SU2_OMP_FOR_DYN(32)
+    for (auto iTarget = 0ul; iTarget < nVertexTarget; ++iTarget) {
+
+      const auto d = distToCenter(targetCoord[iTarget], iCluster);
+      auto w = SU2_TYPE::GetValue(Get_RadialBasisValue(RADIAL_BASIS::WENDLAND_C2, weightRadius[iCluster], d));
+
+      if (fallbackCluster[iTarget] == long(iCluster)) w = 1.0;
+      else if (w <= 0.0) continue;
+      else w /= sumWeights[iTarget];
+
+      /*--- Evaluate the polynomial and RBF terms at the target point. ---*/
+      if (usePolynomial) {
+        funcVec[0] = 1.0;
+        for (int iDim = 0, idx = 1; iDim < nDim; ++iDim) {
+          if (!keepPolynomialRow[iDim]) continue;
+          funcVec[idx++] = SU2_TYPE::GetValue(targetCoord[iTarget][iDim]);
+        }
+      }
+      for (auto j = 0ul; j < clusterSize; ++j) {
+        const auto dist = GeometryToolbox::Distance(nDim, targetCoord[iTarget], clusterCoord[j]);
+        funcVec[1+nPolynomial+j] = SU2_TYPE::GetValue(Get_RadialBasisValue(type, radius, dist));
+      }
+
+      /*--- Multiply by the generator matrix to obtain the local coefficients. ---*/
+      for (auto j = 0ul; j < clusterSize; ++j) coeff[j] = 0.0;
+      for (auto k = 0ul; k < 1ul+nPolynomial+clusterSize; ++k) {
+        if (funcVec[k] == 0.0) continue;
+        for (auto j = 0ul; j < clusterSize; ++j)
+          coeff[j] += funcVec[k] * C_inv_trunc(k,j);
+      }
+
+      /*--- Accumulate the weighted coefficients into the target point. ---*/
+      auto& contrib = contributions[iTarget];
+      for (auto j = 0ul; j < clusterSize; ++j)
+        if (coeff[j] != 0.0) contrib.emplace_back(members[j], w*coeff[j]);
+    }
+    END_SU2_OMP_FOR
+    }
+    END_SU2_OMP_PARALLEL
+  }
+
+  /*--- Combine the contributions of overlapping clusters, prune small coefficients,
+   *    and store the donor information of each target point. ---*/
+
+  SU2_OMP_PARALLEL
+  {
+  unsigned long minDonors = 1<<30, maxDonors = 0, totalDonors = 0;
+  passivedouble sumCorr = 0.0, maxCorr = 0.0;
+  vector<passivedouble> coeffs;
+
+  SU2_OMP_FOR_DYN(32)
+  for (auto iTarget = 0ul; iTarget < nVertexTarget; ++iTarget) {
+
+    auto& contrib = contributions[iTarget];
+    sort(contrib.begin(), contrib.end());
+
+    /*--- Merge duplicate donors (shared by overlapping clusters). ---*/
+    auto nUnique = 0ul;
+    for (auto i = 0ul; i < contrib.size(); ++i) {
+      if (nUnique && contrib[i].first == contrib[nUnique-1].first)
+        contrib[nUnique-1].second += contrib[i].second;
+      else
+        contrib[nUnique++] = contrib[i];
+    }
+    contrib.resize(nUnique);
+
+    coeffs.resize(nUnique);
+    for (auto i = 0ul; i < nUnique; ++i) coeffs[i] = contrib[i].second;
+
+    /*--- Prune small coefficients. ---*/
+    auto info = PruneSmallCoefficients(pruneTol, nUnique, coeffs.begin());
+    auto nnz = info.first;
+    totalDonors += nnz;
+    minDonors = min(minDonors, nnz);
+    maxDonors = max(maxDonors, nnz);
+    auto corr = fabs(info.second-1.0); // far from 1 either way is bad;
+    sumCorr += corr;
+    maxCorr = max(maxCorr, corr);
+
+    /*--- Allocate and set donor information for this target point. ---*/
+    auto& targetVertex = targetDonorInfo[iTarget];
+    targetVertex.resize(nnz);
+
+    for (unsigned long i = 0, iSet = 0; i < nUnique; ++i) {
+      if (fabs(coeffs[i]) > 0.0) {
+        targetVertex.processor[iSet] = donorProc[contrib[i].first];
+        targetVertex.globalPoint[iSet] = donorPoint[contrib[i].first];
+        targetVertex.coefficient[iSet] = coeffs[i];
+        ++iSet;
+      }
+    }
+    vector<pair<unsigned long,passivedouble> >().swap(contrib);
+  }
+  END_SU2_OMP_FOR
+  SU2_OMP_CRITICAL
+  {
+    totalDonorPoints += totalDonors;
+    MinDonors = min(MinDonors, minDonors);
+    MaxDonors = max(MaxDonors, maxDonors);
+    AvgCorrection += sumCorr;
+    MaxCorrection = max(MaxCorrection, maxCorr);
+  }
+  END_SU2_OMP_CRITICAL
+  }
+  END_SU2_OMP_PARALLEL
+
+}
@@ -27,9 +27,13 @@
 
 #include "../../include/interface_interpolation/CSlidingMesh.hpp"
 #include "../../include/CConfig.hpp"
+#include "../../include/adt/CADTPointsOnlyClass.hpp"
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 
+#include <numeric>
+#include <unordered_map>
+
 
 CSlidingMesh::CSlidingMesh(CGeometry ****geometry_container, const CConfig* const* config,
                            unsigned int iZone, unsigned int jZone) :
@@ -41,66 +45,32 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
   /* 0 - Variable declaration */
 
-  /* --- General variables --- */
-
-  bool check;
-
-  unsigned short iDim;
-
-  unsigned long ii, jj, *uptr;
-  unsigned long vPoint;
-  unsigned long iEdgeVisited, nEdgeVisited, iNodeVisited;
-  unsigned long nAlreadyVisited, nToVisit, StartVisited;
-
-  unsigned long *alreadyVisitedDonor, *ToVisit, *tmpVect;
-  unsigned long *storeProc, *tmp_storeProc;
-
-  su2double dTMP;
-  su2double *Coeff_Vect, *tmp_Coeff_Vect;
-
-  /* --- Geometrical variables --- */
-
-  su2double *Coord_i, *Coord_j, dist, mindist, *Normal;
-  su2double Area, Area_old, tmp_Area;
-  su2double LineIntersectionLength, *Direction, length;
-
-
   /* --- Markers Variables --- */
 
   unsigned short iMarkerInt, nMarkerInt;
 
-  unsigned long iVertex, nVertexTarget;
+  unsigned long nVertexTarget;
 
   int markDonor, markTarget;
 
   /* --- Target variables --- */
 
-  unsigned long target_iPoint, jVertexTarget;
-  unsigned long nEdges_target, nNode_target;
-
   su2vector<unsigned long> Target_nLinkedNodes;
   su2vector<unsigned long> Target_StartLinkedNodes;
-  unsigned long *target_segment;
   su2vector<unsigned long> Target_LinkedNodes;
   su2vector<unsigned long> Target_GlobalPoint, Donor_GlobalPoint;
 
-  su2double *target_iMidEdge_point, *target_jMidEdge_point, **target_element;
   su2activematrix TargetPoint_Coord;
 
   /* --- Donor variables --- */
 
-  unsigned long donor_StartIndex, donor_forward_point, donor_backward_point, donor_iPoint, donor_OldiPoint;
-  unsigned long nEdges_donor, nNode_donor, nGlobalVertex_Donor;
+  unsigned long nGlobalVertex_Donor;
 
-  unsigned long nDonorPoints, iDonor;
-  unsigned long *Donor_Vect, *tmp_Donor_Vect;
   su2vector<unsigned long> Donor_nLinkedNodes;
   su2vector<unsigned long> Donor_StartLinkedNodes;
   su2vector<unsigned long> Donor_LinkedNodes;
   su2vector<unsigned long> Donor_Proc;
 
-  su2double *donor_iMidEdge_point, *donor_jMidEdge_point;
-  su2double **donor_element;
   su2activematrix DonorPoint_Coord;
 
   targetVertices.resize(config[targetZone]->GetnMarker_All());
@@ -109,20 +79,6 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
   const unsigned short nDim = donor_geometry->GetnDim();
 
-  /*--- Setting up auxiliary vectors ---*/
-
-  Donor_Vect = nullptr;
-  Coeff_Vect = nullptr;
-  storeProc  = nullptr;
-
-  tmp_Donor_Vect = nullptr;
-  tmp_Coeff_Vect = nullptr;
-  tmp_storeProc  = nullptr;
-
-  Normal    = new su2double[nDim];
-  Direction = new su2double[nDim];
-
-
   /* 2 - Find boundary tag between touching grids */
 
   /*--- Number of markers on the FSI interface ---*/
@@ -170,6 +126,22 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
     Donor_LinkedNodes      = Buffer_Receive_LinkedNodes;
     Donor_Proc             = Buffer_Receive_Proc;
 
+    /*--- Build a search tree over the global donor points and a hash map of the global
+     *    target indices, avoiding brute-force linear searches for every target vertex.
+     *    The donor boundary is fully reconstructed on each rank so a local tree is built. ---*/
+
+    vector<unsigned long> Donor_Indices(nGlobalVertex_Donor);
+    iota(Donor_Indices.begin(), Donor_Indices.end(), 0ul);
+
+    CADTPointsOnlyClass DonorADT(nDim, nGlobalVertex_Donor, DonorPoint_Coord.data(),
+                                 Donor_Indices.data(), false);
+    vector<unsigned long>().swap(Donor_Indices);
+
+    unordered_map<unsigned long, unsigned long> Target_GlobalToLocal;
+    Target_GlobalToLocal.reserve(nGlobalVertex_Target);
+    for (auto ii = 0ul; ii < nGlobalVertex_Target; ii++)
+      Target_GlobalToLocal[ Target_GlobalPoint[ii] ] = ii;
+
     /*--- Starts building the supermesh layer (2D or 3D) ---*/
     /* - For each target node, it first finds the closest donor point
      * - Then it creates the supermesh in the close proximity of the target point:
@@ -180,59 +152,50 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
     if(nDim == 2){
 
-      target_iMidEdge_point = new su2double[nDim];
-      target_jMidEdge_point = new su2double[nDim];
+      /*--- Starts with supermesh reconstruction, target vertices are independent
+       *    of each other and are distributed over the threads. ---*/
 
-      donor_iMidEdge_point = new su2double[nDim];
-      donor_jMidEdge_point = new su2double[nDim];
+      SU2_OMP_PARALLEL
+      {
+      su2double target_iMidEdge_point[2], target_jMidEdge_point[2];
+      su2double donor_iMidEdge_point[2], donor_jMidEdge_point[2];
+      su2double Direction[2];
 
-      /*--- Starts with supermesh reconstruction ---*/
+      unsigned long target_segment[2];
 
-      target_segment = new unsigned long[2];
+      /*--- Auxiliary vectors with the donors of one target vertex. ---*/
+      vector<su2double> Coeff_Vect;
+      vector<unsigned long> Donor_Vect, storeProc;
 
-      for (iVertex = 0; iVertex < nVertexTarget; iVertex++) {
-
-        nDonorPoints = 0;
+      SU2_OMP_FOR_DYN(roundUpDiv(nVertexTarget, 2*omp_get_max_threads()))
+      for (auto iVertex = 0ul; iVertex < nVertexTarget; iVertex++) {
 
         /*--- Stores coordinates of the target node ---*/
 
-        target_iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+        const auto target_iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
 
         if (target_geometry->nodes->GetDomain(target_iPoint)){
 
-          Coord_i = target_geometry->nodes->GetCoord(target_iPoint);
-
-          /*--- Brute force to find the closest donor_node ---*/
+          Coeff_Vect.clear();
+          Donor_Vect.clear();
+          storeProc.clear();
 
-          mindist = 1E6;
-          donor_StartIndex = 0;
+          const su2double* Coord_i = target_geometry->nodes->GetCoord(target_iPoint);
 
-          for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
+          /*--- Find the closest donor node with the search tree ---*/
 
-            Coord_j = DonorPoint_Coord[ donor_iPoint ];
+          su2double mindist;
+          unsigned long donor_StartIndex;
+          int donor_rank;
+          DonorADT.DetermineNearestNode(Coord_i, mindist, donor_StartIndex, donor_rank);
 
-            dist = GeometryToolbox::Distance(nDim, Coord_i, Coord_j);
-
-            if (dist < mindist) {
-              mindist = dist;
-              donor_StartIndex = donor_iPoint;
-            }
-
-            if (dist == 0.0){
-              donor_StartIndex = donor_iPoint;
-              break;
-            }
-          }
-
-          donor_iPoint    = donor_StartIndex;
-          donor_OldiPoint = donor_iPoint;
+          auto donor_iPoint    = donor_StartIndex;
+          auto donor_OldiPoint = donor_iPoint;
 
           /*--- Contruct information regarding the target cell ---*/
 
           auto dPoint = target_geometry->nodes->GetGlobalIndex(target_iPoint);
-          for (jVertexTarget = 0; jVertexTarget < nGlobalVertex_Target; jVertexTarget++)
-            if( dPoint == Target_GlobalPoint[jVertexTarget] )
-              break;
+          const auto jVertexTarget = Target_GlobalToLocal.at(dPoint);
 
           if ( Target_nLinkedNodes[jVertexTarget] == 1 ){
             target_segment[0] = Target_LinkedNodes[ Target_StartLinkedNodes[jVertexTarget] ];
@@ -243,8 +206,8 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
             target_segment[1] = Target_LinkedNodes[ Target_StartLinkedNodes[jVertexTarget] + 1];
           }
 
-          dTMP = 0;
-          for(iDim = 0; iDim < nDim; iDim++){
+          su2double dTMP = 0;
+          for(unsigned short iDim = 0; iDim < nDim; iDim++){
             target_iMidEdge_point[iDim] = ( TargetPoint_Coord(target_segment[0], iDim ) +
                                             target_geometry->nodes->GetCoord( target_iPoint , iDim) ) / 2.;
             target_jMidEdge_point[iDim] = ( TargetPoint_Coord(target_segment[1], iDim ) +
@@ -255,12 +218,12 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
           }
 
           dTMP = sqrt(dTMP);
-          for(iDim = 0; iDim < nDim; iDim++)
+          for(unsigned short iDim = 0; iDim < nDim; iDim++)
             Direction[iDim] /= dTMP;
 
-          length = GeometryToolbox::Distance(nDim, target_iMidEdge_point, target_jMidEdge_point);
+          const su2double length = GeometryToolbox::Distance(nDim, target_iMidEdge_point, target_jMidEdge_point);
 
-          check = false;
+          bool check = false;
 
           /*--- Proceeds along the forward direction (depending on which connected boundary node is found first) ---*/
 
@@ -268,12 +231,14 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
             /*--- Proceeds until the value of the intersection area is null ---*/
 
+            unsigned long donor_forward_point, donor_backward_point;
+
             if ( Donor_nLinkedNodes[donor_iPoint] == 1 ){
               donor_forward_point  = Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_iPoint] ];
               donor_backward_point = donor_iPoint;
             }
             else{
-              uptr = &Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_iPoint] ];
+              const unsigned long* uptr = &Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_iPoint] ];
 
               if( donor_OldiPoint != uptr[0] ){
                 donor_forward_point  = uptr[0];
@@ -290,15 +255,16 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
               continue;
             }
 
-            for(iDim = 0; iDim < nDim; iDim++){
+            for(unsigned short iDim = 0; iDim < nDim; iDim++){
               donor_iMidEdge_point[iDim] = ( DonorPoint_Coord(donor_forward_point, iDim) +
                                              DonorPoint_Coord(donor_iPoint, iDim) ) / 2.;
               donor_jMidEdge_point[iDim] = ( DonorPoint_Coord(donor_backward_point, iDim) +
                                              DonorPoint_Coord(donor_iPoint, iDim) ) / 2.;
             }
 
-            LineIntersectionLength = ComputeLineIntersectionLength(nDim, target_iMidEdge_point, target_jMidEdge_point,
-                                                                   donor_iMidEdge_point, donor_jMidEdge_point, Direction);
+            const su2double LineIntersectionLength =
+                ComputeLineIntersectionLength(nDim, target_iMidEdge_point, target_jMidEdge_point,
+                                              donor_iMidEdge_point, donor_jMidEdge_point, Direction);
 
             if ( LineIntersectionLength == 0.0 ){
               check = true;
@@ -307,38 +273,18 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
             /*--- In case the element intersects the target cell, update the auxiliary communication data structure ---*/
 
-            tmp_Coeff_Vect = new     su2double[ nDonorPoints + 1 ];
-            tmp_Donor_Vect = new unsigned long[ nDonorPoints + 1 ];
-            tmp_storeProc  = new unsigned long[ nDonorPoints + 1 ];
-
-            for( iDonor = 0; iDonor < nDonorPoints; iDonor++){
-              tmp_Donor_Vect[iDonor] = Donor_Vect[iDonor];
-              tmp_Coeff_Vect[iDonor] = Coeff_Vect[iDonor];
-              tmp_storeProc[iDonor]  = storeProc[iDonor];
-            }
-
-            tmp_Donor_Vect[ nDonorPoints ] = donor_iPoint;
-            tmp_Coeff_Vect[ nDonorPoints ] = LineIntersectionLength / length;
-            tmp_storeProc[  nDonorPoints ] = Donor_Proc[donor_iPoint];
-
-            delete [] Donor_Vect;
-            delete [] Coeff_Vect;
-            delete [] storeProc;
-
-            Donor_Vect = tmp_Donor_Vect;
-            Coeff_Vect = tmp_Coeff_Vect;
-            storeProc  = tmp_storeProc;
+            Donor_Vect.push_back(donor_iPoint);
+            Coeff_Vect.push_back(LineIntersectionLength / length);
+            storeProc.push_back(Donor_Proc[donor_iPoint]);
 
             donor_OldiPoint = donor_iPoint;
             donor_iPoint    = donor_forward_point;
-
-            nDonorPoints++;
           }
 
           if ( Donor_nLinkedNodes[donor_StartIndex] == 2 ){
             check = false;
 
-            uptr = &Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_StartIndex] ];
+            const unsigned long* uptr = &Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_StartIndex] ];
 
             donor_iPoint = uptr[1];
             donor_OldiPoint = donor_StartIndex;
@@ -351,12 +297,15 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
           while( !check ){
 
             /*--- Proceeds until the value of the intersection length is null ---*/
+
+            unsigned long donor_forward_point, donor_backward_point;
+
             if ( Donor_nLinkedNodes[donor_iPoint] == 1 ){
               donor_forward_point  = donor_OldiPoint;
               donor_backward_point = donor_iPoint;
             }
             else{
-              uptr = &Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_iPoint] ];
+              const unsigned long* uptr = &Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_iPoint] ];
 
               if( donor_OldiPoint != uptr[0] ){
                 donor_forward_point  = uptr[0];
@@ -373,15 +322,16 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
               continue;
             }
 
-            for(iDim = 0; iDim < nDim; iDim++){
+            for(unsigned short iDim = 0; iDim < nDim; iDim++){
               donor_iMidEdge_point[iDim] = ( DonorPoint_Coord(donor_forward_point , iDim) +
                                              DonorPoint_Coord(donor_iPoint, iDim) ) / 2.;
               donor_jMidEdge_point[iDim] = ( DonorPoint_Coord(donor_backward_point, iDim) +
                                              DonorPoint_Coord(donor_iPoint, iDim) ) / 2.;
             }
 
-            LineIntersectionLength = ComputeLineIntersectionLength(nDim, target_iMidEdge_point, target_jMidEdge_point,
-                                                                   donor_iMidEdge_point, donor_jMidEdge_point, Direction);
+            const su2double LineIntersectionLength =
+                ComputeLineIntersectionLength(nDim, target_iMidEdge_point, target_jMidEdge_point,
+                                              donor_iMidEdge_point, donor_jMidEdge_point, Direction);
 
             if ( LineIntersectionLength == 0.0 ){
               check = true;
@@ -390,163 +340,127 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
             /*--- In case the element intersects the target cell, update the auxiliary communication data structure ---*/
 
-            tmp_Coeff_Vect = new     su2double[ nDonorPoints + 1 ];
-            tmp_Donor_Vect = new unsigned long[ nDonorPoints + 1 ];
-            tmp_storeProc  = new unsigned long[ nDonorPoints + 1 ];
-
-            for( iDonor = 0; iDonor < nDonorPoints; iDonor++){
-              tmp_Donor_Vect[iDonor] = Donor_Vect[iDonor];
-              tmp_Coeff_Vect[iDonor] = Coeff_Vect[iDonor];
-              tmp_storeProc[iDonor]  = storeProc[iDonor];
-            }
-
-            tmp_Coeff_Vect[ nDonorPoints ] = LineIntersectionLength / length;
-            tmp_Donor_Vect[ nDonorPoints ] = donor_iPoint;
-            tmp_storeProc[  nDonorPoints ] = Donor_Proc[donor_iPoint];
-
-            delete [] Donor_Vect;
-            delete [] Coeff_Vect;
-            delete [] storeProc;
-
-            Donor_Vect = tmp_Donor_Vect;
-            Coeff_Vect = tmp_Coeff_Vect;
-            storeProc  = tmp_storeProc;
+            Coeff_Vect.push_back(LineIntersectionLength / length);
+            Donor_Vect.push_back(donor_iPoint);
+            storeProc.push_back(Donor_Proc[donor_iPoint]);
 
             donor_OldiPoint = donor_iPoint;
             donor_iPoint    = donor_forward_point;
-
-            nDonorPoints++;
           }
 
           /*--- Set the communication data structure and copy data from the auxiliary vectors ---*/
 
+          const auto nDonorPoints = Donor_Vect.size();
+
           targetVertices[markTarget][iVertex].resize(nDonorPoints);
 
-          for ( iDonor = 0; iDonor < nDonorPoints; iDonor++ ){
+          for ( auto iDonor = 0ul; iDonor < nDonorPoints; iDonor++ ){
             targetVertices[markTarget][iVertex].coefficient[iDonor] = Coeff_Vect[iDonor];
             targetVertices[markTarget][iVertex].globalPoint[iDonor] = Donor_GlobalPoint[Donor_Vect[iDonor]];
             targetVertices[markTarget][iVertex].processor[iDonor] = storeProc[iDonor];
           }
         }
       }
-
-      delete [] target_segment;
-
-      delete [] target_iMidEdge_point;
-      delete [] target_jMidEdge_point;
-
-      delete [] donor_iMidEdge_point;
-      delete [] donor_jMidEdge_point;
+      END_SU2_OMP_FOR
+      }
+      END_SU2_OMP_PARALLEL
     }
     else{
       /* --- 3D geometry, creates a superficial super-mesh --- */
 
-      for (iVertex = 0; iVertex < nVertexTarget; iVertex++) {
+      SU2_OMP_PARALLEL
+      {
+      /*--- Auxiliary vectors with the donors of one target vertex. ---*/
+      vector<su2double> Coeff_Vect;
+      vector<unsigned long> Donor_Vect, storeProc;
+
+      /*--- Visited donor points of the contour expansion around one target vertex. ---*/
+      vector<unsigned long> alreadyVisitedDonor, ToVisit;
 
-        nDonorPoints = 0;
+      SU2_OMP_FOR_DYN(roundUpDiv(nVertexTarget, 2*omp_get_max_threads()))
+      for (auto iVertex = 0ul; iVertex < nVertexTarget; iVertex++) {
 
         /*--- Stores coordinates of the target node ---*/
 
-        target_iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+        auto target_iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
 
         if (!target_geometry->nodes->GetDomain(target_iPoint)) continue;
 
-        Coord_i = target_geometry->nodes->GetCoord(target_iPoint);
+        Coeff_Vect.clear();
+        Donor_Vect.clear();
+        storeProc.clear();
+
+        su2double Coord_i[3], Normal[3];
 
         target_geometry->vertex[markTarget][iVertex]->GetNormal(Normal);
 
         /*--- The value of Area computed here includes also portion of boundary belonging to different marker ---*/
-        Area = GeometryToolbox::Norm(nDim, Normal);
+        su2double Area = GeometryToolbox::Norm(nDim, Normal);
 
-        for (iDim = 0; iDim < nDim; iDim++)
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
           Normal[iDim] /= Area;
 
-        for (iDim = 0; iDim < nDim; iDim++)
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
           Coord_i[iDim] = target_geometry->nodes->GetCoord(target_iPoint, iDim);
 
         auto dPoint = target_geometry->nodes->GetGlobalIndex(target_iPoint);
-        for (target_iPoint = 0; target_iPoint < nGlobalVertex_Target; target_iPoint++){
-          if( dPoint == Target_GlobalPoint[target_iPoint] )
-            break;
-        }
+        target_iPoint = Target_GlobalToLocal.at(dPoint);
 
         /*--- Build local surface dual mesh for target element ---*/
 
-        nEdges_target = Target_nLinkedNodes[target_iPoint];
+        const auto nEdges_target = Target_nLinkedNodes[target_iPoint];
 
-        nNode_target = 2*(nEdges_target + 1);
+        unsigned long nNode_target = 2*(nEdges_target + 1);
 
-        target_element = new su2double*[nNode_target];
-        for (ii = 0; ii < nNode_target; ii++)
+        su2double** target_element = new su2double*[nNode_target];
+        for (auto ii = 0ul; ii < nNode_target; ii++)
           target_element[ii] = new su2double[nDim];
 
         nNode_target = Build_3D_surface_element(Target_LinkedNodes, Target_StartLinkedNodes, Target_nLinkedNodes,
                                                 TargetPoint_Coord, target_iPoint, target_element);
 
-        /*--- Brute force to find the closest donor_node ---*/
-
-        mindist = 1E6;
-        donor_StartIndex = 0;
-
-        for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
+        /*--- Find the closest donor node with the search tree ---*/
 
-          Coord_j = DonorPoint_Coord[ donor_iPoint ];
+        su2double mindist;
+        unsigned long donor_StartIndex;
+        int donor_rank;
+        DonorADT.DetermineNearestNode(Coord_i, mindist, donor_StartIndex, donor_rank);
 
-          dist = GeometryToolbox::Distance(nDim, Coord_i, Coord_j);
+        auto donor_iPoint = donor_StartIndex;
 
-          if (dist < mindist) {
-            mindist = dist;
-            donor_StartIndex = donor_iPoint;
-          }
+        auto nEdges_donor = Donor_nLinkedNodes[donor_iPoint];
 
-          if (dist == 0.0){
-            donor_StartIndex = donor_iPoint;
-            break;
-          }
-        }
-
-        donor_iPoint = donor_StartIndex;
-
-        nEdges_donor = Donor_nLinkedNodes[donor_iPoint];
-
-        donor_element = new su2double*[ 2*nEdges_donor + 2 ];
-        for (ii = 0; ii < 2*nEdges_donor + 2; ii++)
+        su2double** donor_element = new su2double*[ 2*nEdges_donor + 2 ];
+        for (auto ii = 0ul; ii < 2*nEdges_donor + 2; ii++)
           donor_element[ii] = new su2double[nDim];
 
-        nNode_donor = Build_3D_surface_element(Donor_LinkedNodes, Donor_StartLinkedNodes, Donor_nLinkedNodes,
-                                               DonorPoint_Coord, donor_iPoint, donor_element);
+        unsigned long nNode_donor = Build_3D_surface_element(Donor_LinkedNodes, Donor_StartLinkedNodes,
+                                                             Donor_nLinkedNodes, DonorPoint_Coord, donor_iPoint,
+                                                             donor_element);
 
         Area = 0;
-        for (ii = 1; ii < nNode_target-1; ii++){
-          for (jj = 1; jj < nNode_donor-1; jj++){
+        for (auto ii = 1ul; ii < nNode_target-1; ii++){
+          for (auto jj = 1ul; jj < nNode_donor-1; jj++){
             Area += Compute_Triangle_Intersection(target_element[0], target_element[ii], target_element[ii+1],
                                                   donor_element[0], donor_element[jj], donor_element[jj+1], Normal);
           }
         }
 
-        for (ii = 0; ii < 2*nEdges_donor + 2; ii++)
+        for (auto ii = 0ul; ii < 2*nEdges_donor + 2; ii++)
           delete [] donor_element[ii];
         delete [] donor_element;
 
-        nDonorPoints = 1;
-
         /*--- In case the element intersect the target cell update the auxiliary communication data structure ---*/
 
-        Coeff_Vect = new     su2double[ nDonorPoints ];
-        Donor_Vect = new unsigned long[ nDonorPoints ];
-        storeProc  = new unsigned long[ nDonorPoints ];
-
-        Coeff_Vect[0] = Area;
-        Donor_Vect[0] = donor_iPoint;
-        storeProc[0]  = Donor_Proc[donor_iPoint];
+        Coeff_Vect.push_back(Area);
+        Donor_Vect.push_back(donor_iPoint);
+        storeProc.push_back(Donor_Proc[donor_iPoint]);
 
-        alreadyVisitedDonor = new unsigned long[1];
+        alreadyVisitedDonor.assign(1, donor_iPoint);
 
-        alreadyVisitedDonor[0] = donor_iPoint;
-        nAlreadyVisited = 1;
-        StartVisited = 0;
+        unsigned long StartVisited = 0;
 
-        Area_old = -1;
+        su2double Area_old = -1;
 
         while( Area > Area_old ){
 
@@ -557,105 +471,56 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
           Area_old = Area;
 
-          ToVisit = nullptr;
-          nToVisit = 0;
+          ToVisit.clear();
 
-          for( iNodeVisited = StartVisited; iNodeVisited < nAlreadyVisited; iNodeVisited++ ){
+          for( auto iNodeVisited = StartVisited; iNodeVisited < alreadyVisitedDonor.size(); iNodeVisited++ ){
 
-            vPoint = alreadyVisitedDonor[ iNodeVisited ];
+            const auto vPoint = alreadyVisitedDonor[ iNodeVisited ];
 
-            nEdgeVisited = Donor_nLinkedNodes[vPoint];
+            const auto nEdgeVisited = Donor_nLinkedNodes[vPoint];
 
-            for (iEdgeVisited = 0; iEdgeVisited < nEdgeVisited; iEdgeVisited++){
+            for (auto iEdgeVisited = 0ul; iEdgeVisited < nEdgeVisited; iEdgeVisited++){
 
               donor_iPoint = Donor_LinkedNodes[ Donor_StartLinkedNodes[vPoint] + iEdgeVisited];
 
               /*--- Check if the node to visit is already listed in the data structure to avoid double visits ---*/
 
-              check = 0;
+              const bool visited =
+                  (find(alreadyVisitedDonor.begin(), alreadyVisitedDonor.end(), donor_iPoint) !=
+                   alreadyVisitedDonor.end()) ||
+                  (find(ToVisit.begin(), ToVisit.end(), donor_iPoint) != ToVisit.end());
 
-              for( jj = 0; jj < nAlreadyVisited; jj++ ){
-                if( donor_iPoint == alreadyVisitedDonor[jj] ){
-                  check = 1;
-                  break;
-                }
-              }
-
-              if( check == 0 && ToVisit != nullptr){
-                for( jj = 0; jj < nToVisit; jj++ )
-                  if( donor_iPoint == ToVisit[jj] ){
-                    check = 1;
-                    break;
-                  }
-              }
-
-              if( check == 0 ){
+              if( !visited ){
                 /*--- If the node was not already visited, visit it and list it into data structure ---*/
 
-                tmpVect = new unsigned long[ nToVisit + 1 ];
-
-                for( jj = 0; jj < nToVisit; jj++ )
-                  tmpVect[jj] = ToVisit[jj];
-                tmpVect[nToVisit] = donor_iPoint;
-
-
-                  delete [] ToVisit;
-
-                ToVisit = tmpVect;
-                tmpVect = nullptr;
-
-                nToVisit++;
+                ToVisit.push_back(donor_iPoint);
 
                 /*--- Find the value of the intersection area between the current donor element and the target element --- */
 
                 nEdges_donor = Donor_nLinkedNodes[donor_iPoint];
 
                 donor_element = new su2double*[ 2*nEdges_donor + 2 ];
-                for (ii = 0; ii < 2*nEdges_donor + 2; ii++)
+                for (auto ii = 0ul; ii < 2*nEdges_donor + 2; ii++)
                   donor_element[ii] = new su2double[nDim];
 
                 nNode_donor = Build_3D_surface_element(Donor_LinkedNodes, Donor_StartLinkedNodes, Donor_nLinkedNodes,
                                                        DonorPoint_Coord, donor_iPoint, donor_element);
 
-                tmp_Area = 0;
-                for (ii = 1; ii < nNode_target-1; ii++)
-                  for (jj = 1; jj < nNode_donor-1; jj++)
+                su2double tmp_Area = 0;
+                for (auto ii = 1ul; ii < nNode_target-1; ii++)
+                  for (auto jj = 1ul; jj < nNode_donor-1; jj++)
                     tmp_Area += Compute_Triangle_Intersection(target_element[0], target_element[ii], target_element[ii+1],
                                                               donor_element[0], donor_element[jj], donor_element[jj+1], Normal);
 
-                for (ii = 0; ii < 2*nEdges_donor + 2; ii++)
+                for (auto ii = 0ul; ii < 2*nEdges_donor + 2; ii++)
                   delete [] donor_element[ii];
                 delete [] donor_element;
 
                 /*--- In case the element intersect the target cell update the auxiliary communication data structure ---*/
 
-                tmp_Coeff_Vect = new     su2double[ nDonorPoints + 1 ];
-                tmp_Donor_Vect = new unsigned long[ nDonorPoints + 1 ];
-                tmp_storeProc  = new unsigned long[ nDonorPoints + 1 ];
-
-                for( iDonor = 0; iDonor < nDonorPoints; iDonor++){
-                  tmp_Donor_Vect[iDonor] = Donor_Vect[iDonor];
-                  tmp_Coeff_Vect[iDonor] = Coeff_Vect[iDonor];
-                  tmp_storeProc[iDonor]  = storeProc[iDonor];
-                }
-
-                tmp_Coeff_Vect[ nDonorPoints ] = tmp_Area;
-                tmp_Donor_Vect[ nDonorPoints ] = donor_iPoint;
-                tmp_storeProc[  nDonorPoints ] = Donor_Proc[donor_iPoint];
-
-                delete [] Donor_Vect;
-                delete [] Coeff_Vect;
-                delete [] storeProc;
-
-                Donor_Vect = tmp_Donor_Vect;
-                Coeff_Vect = tmp_Coeff_Vect;
-                storeProc  = tmp_storeProc;
-
-                tmp_Coeff_Vect = nullptr;
-                tmp_Donor_Vect = nullptr;
-                tmp_storeProc  = nullptr;
-
-                nDonorPoints++;
+                Coeff_Vect.push_back(tmp_Area);
+                Donor_Vect.push_back(donor_iPoint);
+                storeProc.push_back(Donor_Proc[donor_iPoint]);
 
                 Area += tmp_Area;
               }
@@ -664,56 +529,33 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
           /*--- Update auxiliary data structure ---*/
 
-          StartVisited = nAlreadyVisited;
-
-          tmpVect = new unsigned long[ nAlreadyVisited + nToVisit ];
-
-          for( jj = 0; jj < nAlreadyVisited; jj++ )
-            tmpVect[jj] = alreadyVisitedDonor[jj];
+          StartVisited = alreadyVisitedDonor.size();
 
-          for( jj = 0; jj < nToVisit; jj++ )
-            tmpVect[ nAlreadyVisited + jj ] = ToVisit[jj];
-
-
-          delete [] alreadyVisitedDonor;
-
-          alreadyVisitedDonor = tmpVect;
-
-          nAlreadyVisited += nToVisit;
-
-          delete [] ToVisit;
+          alreadyVisitedDonor.insert(alreadyVisitedDonor.end(), ToVisit.begin(), ToVisit.end());
         }
 
-        delete [] alreadyVisitedDonor;
-
         /*--- Set the communication data structure and copy data from the auxiliary vectors ---*/
 
+        const auto nDonorPoints = Donor_Vect.size();
+
         targetVertices[markTarget][iVertex].resize(nDonorPoints);
 
-        for ( iDonor = 0; iDonor < nDonorPoints; iDonor++ ){
+        for ( auto iDonor = 0ul; iDonor < nDonorPoints; iDonor++ ){
           targetVertices[markTarget][iVertex].coefficient[iDonor] = Coeff_Vect[iDonor] / Area;
           targetVertices[markTarget][iVertex].globalPoint[iDonor] = Donor_GlobalPoint[Donor_Vect[iDonor]];
           targetVertices[markTarget][iVertex].processor[iDonor] = storeProc[iDonor];
         }
 
-        for (ii = 0; ii < 2*nEdges_target + 2; ii++)
+        for (auto ii = 0ul; ii < 2*nEdges_target + 2; ii++)
           delete [] target_element[ii];
         delete [] target_element;
-
-        delete [] Donor_Vect; Donor_Vect = nullptr;
-        delete [] Coeff_Vect; Coeff_Vect = nullptr;
-        delete [] storeProc;  storeProc  = nullptr;
       }
+      END_SU2_OMP_FOR
+      }
+      END_SU2_OMP_PARALLEL
     }
 
   }
-
-  delete [] Normal;
-  delete [] Direction;
-
-  delete [] Donor_Vect;
-  delete [] Coeff_Vect;
-  delete [] storeProc;
 }
 
 int CSlidingMesh::Build_3D_surface_element(const su2vector<unsigned long>& map, const su2vector<unsigned long>& startIndex,
@@ -29,8 +29,28 @@
 
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/toolboxes/allocation_toolbox.hpp"
+#include "../../include/toolboxes/memory_footprint.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <utility>
+
+namespace {
+/*!
+ * \brief Allocate and zero-initialize an array, each thread touching (and thus mapping,
+ * on NUMA systems) the same equal range of the memory it operates on in SetValZero.
+ */
+template<class T>
+void allocAndInitFirstTouch(T*& ptr, unsigned long num) {
+  ptr = MemoryAllocation::aligned_alloc<T>(64, num*sizeof(T));
+  SU2_OMP_PARALLEL {
+    const auto chunk = roundUpDiv(num, omp_get_num_threads());
+    const auto begin = chunk * omp_get_thread_num();
+    if (begin < num) memset(&ptr[begin], 0, min(chunk, num-begin)*sizeof(T));
+  }
+  END_SU2_OMP_PARALLEL
+}
+}
 
 template<class ScalarType>
 CSysMatrix<ScalarType>::CSysMatrix() :
@@ -41,6 +61,9 @@ CSysMatrix<ScalarType>::CSysMatrix() :
   nnz = nnz_ilu = 0;
   ilu_fill_in = 0;
   nLinelet = 0;
+  nAggregate = 0;
+  mvpSendRows = 0;
+  mvpStencil = 0;
 
   omp_partitions    = nullptr;
 
@@ -57,6 +80,9 @@ CSysMatrix<ScalarType>::CSysMatrix() :
 
   invM              = nullptr;
 
+  ILU_matrix_sp     = nullptr;
+  invM_sp           = nullptr;
+
 #ifdef USE_MKL
   MatrixMatrixProductJitter              = nullptr;
   MatrixVectorProductJitterBetaOne       = nullptr;
@@ -73,6 +99,8 @@ CSysMatrix<ScalarType>::~CSysMatrix(void) {
   MemoryAllocation::aligned_free(ILU_matrix);
   MemoryAllocation::aligned_free(matrix);
   MemoryAllocation::aligned_free(invM);
+  MemoryAllocation::aligned_free(ILU_matrix_sp);
+  MemoryAllocation::aligned_free(invM_sp);
 
 #ifdef USE_MKL
   mkl_jit_destroy( MatrixMatrixProductJitter );
@@ -81,6 +109,10 @@ CSysMatrix<ScalarType>::~CSysMatrix(void) {
   mkl_jit_destroy( MatrixVectorProductJitterAlphaMinusOne );
 #endif
 
+#ifdef HAVE_CUDA
+  CSysMatrixGPU::Free(gpuData);
+#endif
+
 }
 
 template<class ScalarType>
@@ -112,12 +144,12 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     /*--- FEM-type connectivity in non-structural context implies mesh deformation. ---*/
     prec = config->GetKind_Deform_Linear_Solver_Prec();
   }
-  else if (config->GetDiscrete_Adjoint() && (prec!=ILU)) {
+  else if (config->GetDiscrete_Adjoint() && (prec!=ILU) && (prec!=LEVEL_ILU)) {
     /*--- Else "upgrade" primal solver settings. ---*/
     prec = config->GetKind_DiscAdj_Linear_Prec();
   }
-  const bool ilu_needed = (prec==ILU);
-  const bool diag_needed = ilu_needed || (prec==JACOBI) || (prec==LINELET);
+  const bool ilu_needed = (prec==ILU) || (prec==LEVEL_ILU);
+  const bool diag_needed = ilu_needed || (prec==JACOBI) || (prec==LINELET) || (prec==AMG);
 
   /*--- Basic dimensions. ---*/
   nVar = nvar;
@@ -135,6 +167,9 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   col_ind = csr.innerIdx();
   dia_ptr = csr.diagPtr();
 
+  /*--- The locations recorded for strong BC enforcement depend on the pattern. ---*/
+  bcRowRegistry.clear();
+
   if (needTranspPtr)
     col_ptr = geometry->GetTransposeSparsePatternMap(type).data();
 
@@ -143,6 +178,44 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     edge_ptr.nEdge = geometry->GetnEdge();
   }
 
+  /*--- Order the rows for the matrix-vector product such that rows whose result
+   *    is sent to other ranks come first. This allows initiating the halo
+   *    exchange early and overlapping it with the computation of the interior
+   *    rows. If there are no point-to-point comms the natural order is kept. ---*/
+
+  if (geometry->nP2PSend > 0) {
+    vector<bool> isSendRow(nPointDomain, false);
+    const auto nSendTotal = geometry->nPoint_P2PSend[geometry->nP2PSend];
+    for (auto iSend = 0l; iSend < nSendTotal; ++iSend) {
+      const auto iPoint = geometry->Local_Point_P2PSend[iSend];
+      if (iPoint < nPointDomain) isSendRow[iPoint] = true;
+    }
+    mvpOrder.reserve(nPointDomain);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+      if (isSendRow[iPoint]) mvpOrder.push_back(iPoint);
+    mvpSendRows = mvpOrder.size();
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+      if (!isSendRow[iPoint]) mvpOrder.push_back(iPoint);
+  }
+
+  /*--- Detect a dominant constant stencil. In structured mesh regions the FV
+   *    dual graph gives every interior point the same number of matrix entries
+   *    (5 on quads, 7 on hexahedra), and rows of equal length already have the
+   *    (sliced) ELLPACK layout within the CSR arrays. The product kernel runs
+   *    a fully unrolled fixed-trip-count loop for the rows that match the
+   *    dominant size and falls back to the generic loop elsewhere. ---*/
+
+  if (type == ConnectivityType::FiniteVolume) {
+    unsigned long count5 = 0, count7 = 0;
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      const auto len = row_ptr[iPoint+1] - row_ptr[iPoint];
+      count5 += (len == 5);
+      count7 += (len == 7);
+    }
+    if (2*count5 > nPointDomain) mvpStencil = 5;
+    else if (2*count7 > nPointDomain) mvpStencil = 7;
+  }
+
   /*--- Get ILU sparse pattern, if fill is 0 no new data is allocated. --*/
 
   if(ilu_needed)
@@ -157,18 +230,34 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     nnz_ilu = csr_ilu.getNumNonZeros();
   }
 
-  /*--- Allocate data. ---*/
-  auto allocAndInit = [](ScalarType*& ptr, unsigned long num) {
-    ptr = MemoryAllocation::aligned_alloc<ScalarType,true>(64, num*sizeof(ScalarType));
-  };
+  /*--- Allocate data, first-touching it with the same thread partitioning that
+   *    SetValZero uses, so that on NUMA systems the pages are mapped on the
+   *    memory of the socket whose threads will work on them. ---*/
 
-  allocAndInit(matrix, nnz*nVar*nEqn);
+  allocAndInitFirstTouch(matrix, nnz*nVar*nEqn);
 
   /*--- Preconditioners. ---*/
 
-  if (ilu_needed) allocAndInit(ILU_matrix, nnz_ilu*nVar*nEqn);
+  if (ilu_needed) allocAndInitFirstTouch(ILU_matrix, nnz_ilu*nVar*nEqn);
+
+  if (diag_needed) allocAndInitFirstTouch(invM, nPointDomain*nVar*nEqn);
+
+  /*--- Optional single precision copy of the ILU factor, the triangular solves in
+   *    FP32 have roughly half the memory traffic, while the factorization and the
+   *    Krylov vectors stay in the native precision. Only doubles are demoted. ---*/
+
+  if (ilu_needed && !std::is_same<PrecScalar,ScalarType>::value && config->GetLinear_Solver_Prec_Single()) {
+    allocAndInitFirstTouch(ILU_matrix_sp, nnz_ilu*nVar*nEqn);
+    allocAndInitFirstTouch(invM_sp, nPointDomain*nVar*nEqn);
+  }
+
+  /*--- Log the allocations for the memory footprint report. ---*/
 
-  if (diag_needed) allocAndInit(invM, nPointDomain*nVar*nEqn);
+  long bytes = nnz*nVar*nEqn*sizeof(ScalarType);
+  if (ilu_needed) bytes += nnz_ilu*nVar*nEqn*sizeof(ScalarType);
+  if (diag_needed) bytes += nPointDomain*nVar*nEqn*sizeof(ScalarType);
+  if (ILU_matrix_sp != nullptr) bytes += (nnz_ilu+nPointDomain)*nVar*nEqn*sizeof(PrecScalar);
+  MemoryFootprint::Register(MemoryFootprint::SPARSE_MATRICES, bytes);
 
   /*--- Thread parallel initialization. ---*/
 
@@ -225,8 +314,6 @@ template<class T>
 void CSysMatrixComms::Initiate(const CSysVector<T>& x, CGeometry *geometry,
                                const CConfig *config, unsigned short commType) {
 
-  if (geometry->nP2PSend == 0) return;
-
   /*--- Local variables ---*/
 
   const unsigned short COUNT_PER_POINT = x.GetNVar();
@@ -250,10 +337,14 @@ void CSysMatrixComms::Initiate(const CSysVector<T>& x, CGeometry *geometry,
   /*--- Check to make sure we have created a large enough buffer
    for these comms during preprocessing. This is only for the su2double
    buffer. It will be reallocated whenever we find a larger count
-   per point. After the first cycle of comms, this should be inactive. ---*/
+   per point. After the first cycle of comms, this should be inactive.
+   Note that the reallocation may be collective and therefore has to be
+   reached also by ranks without any messages to send. ---*/
 
   geometry->AllocateP2PComms(COUNT_PER_POINT);
 
+  if (geometry->nP2PSend == 0) return;
+
   /*--- Load the specified quantity from the solver into the generic
    communication buffer in the geometry class. ---*/
 
@@ -372,8 +463,10 @@ void CSysMatrixComms::Complete(CSysVector<T>& x, CGeometry *geometry,
     /*--- For efficiency, recv the messages dynamically based on
      the order they arrive. ---*/
 
-    SU2_OMP_MASTER
-    SU2_MPI::Waitany(geometry->nP2PRecv, geometry->req_P2PRecv, &ind, &status);
+    SU2_OMP_MASTER {
+      SU2_MPI::Waitany(geometry->nP2PRecv, geometry->req_P2PRecv, &ind, &status);
+      geometry->FlushSharedRecvWindow();
+    }
     END_SU2_OMP_MASTER
     SU2_OMP_BARRIER
 
@@ -484,6 +577,10 @@ void CSysMatrix<ScalarType>::SetValZero() {
   const auto begin = chunk * omp_get_thread_num();
   const auto mySize = min(chunk, size-begin) * sizeof(ScalarType);
   memset(&matrix[begin], 0, mySize);
+#ifdef HAVE_CUDA
+  /*--- The matrix is about to be re-assembled, the device copy goes stale. ---*/
+  gpuData.matrixDirty = true;
+#endif
   SU2_OMP_BARRIER
 }
 
@@ -598,6 +695,91 @@ void CSysMatrix<ScalarType>::DeleteValsRowi(unsigned long i) {
   }
 }
 
+template<class ScalarType>
+template<unsigned long N, unsigned long L>
+void CSysMatrix<ScalarType>::MatrixVectorProductImpl(const CSysVector<ScalarType>& vec,
+                                                     CSysVector<ScalarType>& prod,
+                                                     unsigned long rowBegin, unsigned long rowEnd) const {
+
+  /*--- The block size (N) is a compile-time constant here, the
+   *    accumulators live in registers and the inner products unroll. ---*/
+
+  SU2_OMP_FOR_DYN(omp_heavy_size)
+  for (auto k = rowBegin; k < rowEnd; k++) {
+    const auto row_i = mvpOrder.empty()? k : mvpOrder[k];
+    ScalarType sum[N] = {ScalarType(0)};
+
+    auto addEntry = [&](unsigned long index) {
+      const auto block = &matrix[index*N*N];
+      const auto v = &vec[col_ind[index]*N];
+      for (auto iVar = 0ul; iVar < N; iVar++) {
+        SU2_OMP_SIMD
+        for (auto jVar = 0ul; jVar < N; jVar++)
+          sum[iVar] += block[iVar*N+jVar] * v[jVar];
+      }
+    };
+
+    const auto begin = row_ptr[row_i];
+    const auto end = row_ptr[row_i+1];
+
+    /*--- Rows of the dominant stencil size (structured mesh regions) run a
+     *    fixed trip count that unrolls completely, the branch is predictable
+     *    because such rows come in long runs. ---*/
+
+    if (L && (end - begin == L)) {
+      for (auto j = 0ul; j < L; j++) addEntry(begin + j);
+    }
+    else {
+      for (auto index = begin; index < end; index++) addEntry(index);
+    }
+
+    SU2_OMP_SIMD
+    for (auto iVar = 0ul; iVar < N; iVar++)
+      prod[row_i*N+iVar] = sum[iVar];
+  }
+  END_SU2_OMP_FOR
+}
+
+template<class ScalarType>
+template<unsigned long N>
+void CSysMatrix<ScalarType>::MatrixVectorProductStencil(const CSysVector<ScalarType>& vec,
+                                                        CSysVector<ScalarType>& prod,
+                                                        unsigned long rowBegin, unsigned long rowEnd) const {
+
+  /*--- Second level of the dispatch, on the dominant stencil size. ---*/
+
+  switch (mvpStencil) {
+    case 5: MatrixVectorProductImpl<N,5>(vec, prod, rowBegin, rowEnd); break;
+    case 7: MatrixVectorProductImpl<N,7>(vec, prod, rowBegin, rowEnd); break;
+    default: MatrixVectorProductImpl<N,0>(vec, prod, rowBegin, rowEnd); break;
+  }
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::MatrixVectorProductRange(const CSysVector<ScalarType>& vec,
+                                                      CSysVector<ScalarType>& prod,
+                                                      unsigned long rowBegin, unsigned long rowEnd) const {
+
+  /*--- Dispatch the specialized kernels for the common (square) block sizes,
+   *    the generic implementation handles any other size. ---*/
+
+  switch ((nVar == nEqn)? nVar : 0ul) {
+    case 1: MatrixVectorProductStencil<1>(vec, prod, rowBegin, rowEnd); break;
+    case 4: MatrixVectorProductStencil<4>(vec, prod, rowBegin, rowEnd); break;
+    case 5: MatrixVectorProductStencil<5>(vec, prod, rowBegin, rowEnd); break;
+    case 6: MatrixVectorProductStencil<6>(vec, prod, rowBegin, rowEnd); break;
+    case 7: MatrixVectorProductStencil<7>(vec, prod, rowBegin, rowEnd); break;
+    default:
+      SU2_OMP_FOR_DYN(omp_heavy_size)
+      for (auto k = rowBegin; k < rowEnd; k++) {
+        const auto row_i = mvpOrder.empty()? k : mvpOrder[k];
+        RowProduct(vec, row_i, &prod[row_i*nVar]);
+      }
+      END_SU2_OMP_FOR
+      break;
+  }
+}
+
 template<class ScalarType>
 void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                                  CGeometry *geometry, const CConfig *config) const {
@@ -618,27 +800,94 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType> &
 
   SU2_OMP_BARRIER
 
-  SU2_OMP_FOR_DYN(omp_heavy_size)
-  for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
-    RowProduct(vec, row_i, &prod[row_i*nVar]);
+  /*--- Compute the rows that feed the halo exchange first. ---*/
+
+  MatrixVectorProductRange(vec, prod, 0, mvpSendRows);
+
+  /*--- Initiate the non-blocking exchange of the result, and overlap
+   *    it with the computation of the interior rows. ---*/
+
+  CSysMatrixComms::Initiate(prod, geometry, config);
+
+  MatrixVectorProductRange(vec, prod, mvpSendRows, nPointDomain);
+
+  CSysMatrixComms::Complete(prod, geometry, config);
+
+}
+
+#ifdef HAVE_CUDA
+template<class ScalarType>
+void CSysMatrix<ScalarType>::GPUMatrixVectorProduct(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                                    CGeometry *geometry, const CConfig *config) const {
+
+  /*--- The device computes all owned rows, only the master thread talks to
+   *    it. The halo values of the result are then obtained from the owning
+   *    ranks via the same exchange as the host version. ---*/
+
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER {
+    CSysMatrixGPU::Product(gpuData, nPointDomain, nVar, nEqn, nnz, row_ptr, col_ind,
+                           matrix, &vec[0], vec.GetLocSize(), &prod[0]);
   }
-  END_SU2_OMP_FOR
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
 
-  /*--- MPI Parallelization. ---*/
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::GPUComputeJacobiPreconditioner(const CSysVector<ScalarType> & vec,
+                                                            CSysVector<ScalarType> & prod,
+                                                            CGeometry *geometry, const CConfig *config) const {
+
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER {
+    CSysMatrixGPU::JacobiProduct(gpuData, nPointDomain, nVar, invM, &vec[0], &prod[0]);
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
 
   CSysMatrixComms::Initiate(prod, geometry, config);
   CSysMatrixComms::Complete(prod, geometry, config);
 
 }
+#endif
 
 template<class ScalarType>
 void CSysMatrix<ScalarType>::BuildJacobiPreconditioner() {
 
-  /*--- Build Jacobi preconditioner (M = D), compute and store the inverses of the diagonal blocks. ---*/
-  SU2_OMP_FOR_(schedule(dynamic,omp_heavy_size) SU2_NOWAIT)
-  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
-    InverseDiagonalBlock(iPoint, &(invM[iPoint*nVar*nVar]));
-  END_SU2_OMP_FOR
+  /*--- Build Jacobi preconditioner (M = D), compute and store the inverses of the diagonal blocks.
+   The blocks of the scalar systems are inverted in closed form, the general path runs a
+   Gauss elimination per block. ---*/
+
+  if ((nVar == nEqn) && (nVar <= 2)) {
+    SU2_OMP_FOR_(schedule(dynamic,omp_heavy_size) SU2_NOWAIT)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      const auto* d = &matrix[dia_ptr[iPoint]*nVar*nVar];
+      auto* inv = &invM[iPoint*nVar*nVar];
+      if (nVar == 1) {
+        inv[0] = ScalarType(1) / d[0];
+      }
+      else {
+        const ScalarType det = d[0]*d[3] - d[1]*d[2];
+        inv[0] = d[3]/det;  inv[1] = -d[1]/det;
+        inv[2] = -d[2]/det; inv[3] = d[0]/det;
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+  else {
+    SU2_OMP_FOR_(schedule(dynamic,omp_heavy_size) SU2_NOWAIT)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+      InverseDiagonalBlock(iPoint, &(invM[iPoint*nVar*nVar]));
+    END_SU2_OMP_FOR
+  }
+
+#ifdef HAVE_CUDA
+  gpuData.invMDirty = true;
+#endif
 
 }
 
@@ -646,12 +895,32 @@ template<class ScalarType>
 void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                                          CGeometry *geometry, const CConfig *config) const {
 
-  /*--- Apply Jacobi preconditioner, y = D^{-1} * x, the inverse of the diagonal is already known. ---*/
+  /*--- Apply Jacobi preconditioner, y = D^{-1} * x, the inverse of the diagonal is already known.
+   The small blocks of the scalar systems are applied in place, the nVar==1 case is a plain
+   vector product that vectorizes over points. ---*/
   SU2_OMP_BARRIER
-  SU2_OMP_FOR_DYN(omp_heavy_size)
-  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
-    MatrixVectorProduct(&(invM[iPoint*nVar*nVar]), &vec[iPoint*nVar], &prod[iPoint*nVar]);
-  END_SU2_OMP_FOR
+
+  if ((nVar == nEqn) && (nVar == 1)) {
+    SU2_OMP_FOR_STAT(omp_light_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+      prod[iPoint] = invM[iPoint] * vec[iPoint];
+    END_SU2_OMP_FOR
+  }
+  else if ((nVar == nEqn) && (nVar == 2)) {
+    SU2_OMP_FOR_DYN(omp_heavy_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      const auto* m = &invM[iPoint*4];
+      prod[iPoint*2+0] = m[0]*vec[iPoint*2+0] + m[1]*vec[iPoint*2+1];
+      prod[iPoint*2+1] = m[2]*vec[iPoint*2+0] + m[3]*vec[iPoint*2+1];
+    }
+    END_SU2_OMP_FOR
+  }
+  else {
+    SU2_OMP_FOR_DYN(omp_heavy_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+      MatrixVectorProduct(&(invM[iPoint*nVar*nVar]), &vec[iPoint*nVar], &prod[iPoint*nVar]);
+    END_SU2_OMP_FOR
+  }
 
   /*--- MPI Parallelization ---*/
   CSysMatrixComms::Initiate(prod, geometry, config);
@@ -764,11 +1033,43 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
   }
   END_SU2_OMP_FOR
 
+  if (ILU_matrix_sp != nullptr) UpdateSinglePrecisionILU();
+
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::UpdateSinglePrecisionILU() {
+
+  /*--- Demote the factor after each (re-)factorization, the loss of precision is
+   *    benign since the ILU is an approximation of the matrix to begin with. ---*/
+
+  SU2_OMP_FOR_STAT(omp_light_size)
+  for (auto iVar = 0ul; iVar < nnz_ilu*nVar*nEqn; ++iVar)
+    ILU_matrix_sp[iVar] = PrecScalar(ILU_matrix[iVar]);
+  END_SU2_OMP_FOR
+
+  SU2_OMP_FOR_STAT(omp_light_size)
+  for (auto iVar = 0ul; iVar < nPointDomain*nVar*nEqn; ++iVar)
+    invM_sp[iVar] = PrecScalar(invM[iVar]);
+  END_SU2_OMP_FOR
+
 }
 
 template<class ScalarType>
 void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                                       CGeometry *geometry, const CConfig *config) const {
+  if (ILU_matrix_sp != nullptr)
+    ComputeILUPreconditionerImpl(ILU_matrix_sp, invM_sp, vec, prod, geometry, config);
+  else
+    ComputeILUPreconditionerImpl(ILU_matrix, invM, vec, prod, geometry, config);
+}
+
+template<class ScalarType>
+template<class MatType>
+void CSysMatrix<ScalarType>::ComputeILUPreconditionerImpl(const MatType* ilu, const MatType* inv,
+                                                          const CSysVector<ScalarType> & vec,
+                                                          CSysVector<ScalarType> & prod,
+                                                          CGeometry *geometry, const CConfig *config) const {
   /*--- Coherent view of vectors. ---*/
   SU2_OMP_BARRIER
 
@@ -794,7 +1095,7 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
       for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
         auto jPoint = col_ind_ilu[index];
         if (jPoint < begin) continue;
-        auto Block_ij = &ILU_matrix[index*nVar*nVar];
+        auto Block_ij = &ilu[index*nVar*nVar];
         MatrixVectorProductSub(Block_ij, &prod[jPoint*nVar], &prod[iPoint*nVar]);
       }
     }
@@ -809,11 +1110,590 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
       for (auto index = dia_ptr_ilu[iPoint]+1; index < row_ptr_ilu[iPoint+1]; index++) {
         auto jPoint = col_ind_ilu[index];
         if (jPoint >= end) break;
+        auto Block_ij = &ilu[index*nVar*nVar];
+        MatrixVectorProductSub(Block_ij, &prod[jPoint*nVar], aux_vec);
+      }
+
+      MatrixVectorProduct(&inv[iPoint*nVar*nVar], aux_vec, &prod[iPoint*nVar]);
+    }
+  }
+  END_SU2_OMP_FOR
+
+  /*--- MPI Parallelization ---*/
+
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::ComputeILULevelScheduling() {
+
+  /*--- Group the rows of the ILU pattern into level sets, such that a row in one
+   *    level only depends (via its lower/upper triangular entries) on rows of
+   *    strictly lower levels. Rows of a level can then be processed in parallel. ---*/
+
+  auto buildLevels = [this](const vector<unsigned long>& level, unsigned long nLevels,
+                            vector<unsigned long>& levelPtr, vector<unsigned long>& levelPerm) {
+    levelPtr.assign(nLevels+1, 0);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+      levelPtr[level[iPoint]+1]++;
+    for (auto iLevel = 0ul; iLevel < nLevels; ++iLevel)
+      levelPtr[iLevel+1] += levelPtr[iLevel];
+
+    levelPerm.resize(nPointDomain);
+    vector<unsigned long> idx(levelPtr.begin(), levelPtr.end()-1);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+      levelPerm[idx[level[iPoint]]++] = iPoint;
+  };
+
+  vector<unsigned long> level(nPointDomain);
+
+  /*--- Forward (lower triangular) dependencies, these also apply to the factorization. ---*/
+
+  unsigned long nLevels = 0;
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    unsigned long lev = 0;
+    for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; ++index)
+      lev = max(lev, level[col_ind_ilu[index]]+1);
+    level[iPoint] = lev;
+    nLevels = max(nLevels, lev+1);
+  }
+  buildLevels(level, nLevels, iluLevelPtr, iluLevelPerm);
+
+  /*--- Backward (upper triangular) dependencies, halo columns impose none. ---*/
+
+  nLevels = 0;
+  for (auto iPoint = nPointDomain; iPoint > 0ul;) {
+    iPoint--; // unsigned type
+    unsigned long lev = 0;
+    for (auto index = dia_ptr_ilu[iPoint]+1; index < row_ptr_ilu[iPoint+1]; ++index) {
+      const auto jPoint = col_ind_ilu[index];
+      if (jPoint >= nPointDomain) break;
+      lev = max(lev, level[jPoint]+1);
+    }
+    level[iPoint] = lev;
+    nLevels = max(nLevels, lev+1);
+  }
+  buildLevels(level, nLevels, iluLevelPtrT, iluLevelPermT);
+
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::BuildLevelILUPreconditioner() {
+
+  /*--- The level sets only depend on the sparsity, compute them on first use. ---*/
+
+  SU2_OMP_MASTER
+  if (iluLevelPtr.empty()) ComputeILULevelScheduling();
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  /*--- Copy block matrix to compute factorization in-place (as in BuildILUPreconditioner). ---*/
+
+  if (ilu_fill_in == 0) {
+    SU2_OMP_FOR_STAT(omp_light_size)
+    for (auto iVar = 0ul; iVar < nnz*nVar*nVar; ++iVar)
+      ILU_matrix[iVar] = matrix[iVar];
+    END_SU2_OMP_FOR
+  }
+  else {
+    SU2_OMP_FOR_STAT(omp_light_size)
+    for (auto iVar = 0ul; iVar < nnz_ilu*nVar*nVar; iVar++)
+      ILU_matrix[iVar] = 0.0;
+    END_SU2_OMP_FOR
+
+    SU2_OMP_FOR_DYN(omp_heavy_size)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+      for (auto index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+        auto jPoint = col_ind[index];
+        SetBlock_ILUMatrix(iPoint, jPoint, &matrix[index*nVar*nVar]);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- Factorize level by level, the elimination of a row only reads rows that
+   *    were finalized in previous levels and only writes to the row itself,
+   *    therefore rows of one level can be processed concurrently. Contrary to
+   *    the partitioned ILU no couplings between threads are dropped. ---*/
+
+  for (auto iLevel = 0ul; iLevel+1 < iluLevelPtr.size(); ++iLevel) {
+
+    SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+    for (auto k = iluLevelPtr[iLevel]; k < iluLevelPtr[iLevel+1]; ++k) {
+
+      const auto iPoint = iluLevelPerm[k];
+
+      ScalarType weight[MAXNVAR*MAXNVAR], aux_block[MAXNVAR*MAXNVAR];
+
+      /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
+
+      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+
+        /*--- jPoint is the column index (jPoint < iPoint), its
+         *    inverse diagonal was computed on a previous level. ---*/
+
+        const auto jPoint = col_ind_ilu[index];
+
+        /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
+
         auto Block_ij = &ILU_matrix[index*nVar*nVar];
+        MatrixMatrixProduct(Block_ij, &invM[jPoint*nVar*nVar], weight);
+
+        /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the jPoint row. ---*/
+
+        for (auto index_ = dia_ptr_ilu[jPoint]+1; index_ < row_ptr_ilu[jPoint+1]; index_++) {
+
+          /*--- Get the column index (kPoint > jPoint), halo columns are not factorized. ---*/
+
+          const auto kPoint = col_ind_ilu[index_];
+
+          if (kPoint >= nPointDomain) break;
+
+          /*--- If Aik exists, update it: Aik -= Aij*inv(Ajj)*Ajk ---*/
+
+          auto Block_ik = GetBlock_ILUMatrix(iPoint, kPoint);
+
+          if (Block_ik != nullptr) {
+            auto Block_jk = &ILU_matrix[index_*nVar*nVar];
+            MatrixMatrixProduct(weight, Block_jk, aux_block);
+            MatrixSubtraction(Block_ik, aux_block, Block_ik);
+          }
+        }
+
+        /*--- Lastly, store "weight" in the lower triangular part, which
+         will be reused during the forward solve in the precon/smoother. ---*/
+
+        for (auto iVar = 0ul; iVar < nVar*nVar; ++iVar)
+          Block_ij[iVar] = weight[iVar];
+      }
+
+      /*--- The row is final, invert and store its diagonal block. ---*/
+
+      InverseDiagonalBlock_ILUMatrix(iPoint, &invM[iPoint*nVar*nVar]);
+    }
+    END_SU2_OMP_FOR
+  }
+
+  if (ILU_matrix_sp != nullptr) UpdateSinglePrecisionILU();
+
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::ComputeLevelILUPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                                           CGeometry *geometry, const CConfig *config) const {
+  if (ILU_matrix_sp != nullptr)
+    ComputeLevelILUPreconditionerImpl(ILU_matrix_sp, invM_sp, vec, prod, geometry, config);
+  else
+    ComputeLevelILUPreconditionerImpl(ILU_matrix, invM, vec, prod, geometry, config);
+}
+
+template<class ScalarType>
+template<class MatType>
+void CSysMatrix<ScalarType>::ComputeLevelILUPreconditionerImpl(const MatType* ilu, const MatType* inv,
+                                                               const CSysVector<ScalarType> & vec,
+                                                               CSysVector<ScalarType> & prod,
+                                                               CGeometry *geometry, const CConfig *config) const {
+  /*--- Coherent view of vectors. ---*/
+  SU2_OMP_BARRIER
+
+  /*--- Copy vector to then work on prod in place. ---*/
+
+  SU2_OMP_FOR_STAT(omp_light_size)
+  for (auto iVar = 0ul; iVar < nPointDomain*nVar; iVar++)
+    prod[iVar] = vec[iVar];
+  END_SU2_OMP_FOR
+
+  /*--- Forward solve over level sets, rows within a level have no mutual
+   *    dependencies, the implicit barrier of the for construct synchronizes
+   *    the levels. ---*/
+
+  for (auto iLevel = 0ul; iLevel+1 < iluLevelPtr.size(); ++iLevel) {
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (auto k = iluLevelPtr[iLevel]; k < iluLevelPtr[iLevel+1]; ++k) {
+      const auto iPoint = iluLevelPerm[k];
+      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+        const auto jPoint = col_ind_ilu[index];
+        auto Block_ij = &ilu[index*nVar*nVar];
+        MatrixVectorProductSub(Block_ij, &prod[jPoint*nVar], &prod[iPoint*nVar]);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- Backwards substitution, likewise over (reverse) level sets. ---*/
+
+  for (auto iLevel = 0ul; iLevel+1 < iluLevelPtrT.size(); ++iLevel) {
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (auto k = iluLevelPtrT[iLevel]; k < iluLevelPtrT[iLevel+1]; ++k) {
+      const auto iPoint = iluLevelPermT[k];
+
+      ScalarType aux_vec[MAXNVAR];
+      for (auto iVar = 0ul; iVar < nVar; iVar++)
+        aux_vec[iVar] = prod[iPoint*nVar+iVar];
+
+      for (auto index = dia_ptr_ilu[iPoint]+1; index < row_ptr_ilu[iPoint+1]; index++) {
+        const auto jPoint = col_ind_ilu[index];
+        if (jPoint >= nPointDomain) break;
+        auto Block_ij = &ilu[index*nVar*nVar];
         MatrixVectorProductSub(Block_ij, &prod[jPoint*nVar], aux_vec);
       }
 
-      MatrixVectorProduct(&invM[iPoint*nVar*nVar], aux_vec, &prod[iPoint*nVar]);
+      MatrixVectorProduct(&inv[iPoint*nVar*nVar], aux_vec, &prod[iPoint*nVar]);
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- MPI Parallelization ---*/
+
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::BuildAMGPreconditioner() {
+
+  /*--- The fine level smoother is damped block Jacobi, build the inverse diagonal. ---*/
+
+  BuildJacobiPreconditioner();
+  SU2_OMP_BARRIER
+
+  /*--- The aggregation and the coarse sparsity depend only on the structure of the
+   *    matrix and are built once, the coarse (Galerkin) blocks are re-assembled on
+   *    every call as the matrix changes between nonlinear iterations. ---*/
+
+  SU2_OMP_MASTER
+  if (amgAggregate.empty()) {
+
+    /*--- Greedy aggregation over the sparsity graph, each point that is still free
+     *    seeds an aggregate made of itself and its free (owned) neighbors, which
+     *    for FVM meshes gives aggregates the size of a point's edge-neighborhood. ---*/
+
+    const auto unassigned = nPointDomain;
+    amgAggregate.assign(nPointDomain, unassigned);
+    nAggregate = 0;
+
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      if (amgAggregate[iPoint] != unassigned) continue;
+      amgAggregate[iPoint] = nAggregate;
+      for (auto index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; ++index) {
+        const auto jPoint = col_ind[index];
+        if ((jPoint < nPointDomain) && (amgAggregate[jPoint] == unassigned))
+          amgAggregate[jPoint] = nAggregate;
+      }
+      nAggregate++;
+    }
+
+    /*--- Absorb singleton aggregates into a neighbor, they contribute nothing to
+     *    the coarsening rate and degrade the quality of the coarse correction. ---*/
+
+    vector<unsigned long> aggSize(nAggregate, 0);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+      aggSize[amgAggregate[iPoint]]++;
+
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      if (aggSize[amgAggregate[iPoint]] != 1) continue;
+      for (auto index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; ++index) {
+        const auto jPoint = col_ind[index];
+        if ((jPoint < nPointDomain) && (amgAggregate[jPoint] != amgAggregate[iPoint])) {
+          aggSize[amgAggregate[iPoint]]--;
+          amgAggregate[iPoint] = amgAggregate[jPoint];
+          aggSize[amgAggregate[iPoint]]++;
+          break;
+        }
+      }
+    }
+
+    /*--- Compact the aggregate numbering after the merges. ---*/
+
+    unsigned long nCompact = 0;
+    for (auto iAgg = 0ul; iAgg < nAggregate; ++iAgg)
+      aggSize[iAgg] = (aggSize[iAgg] > 0)? nCompact++ : unassigned;
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+      amgAggregate[iPoint] = aggSize[amgAggregate[iPoint]];
+    nAggregate = nCompact;
+
+    /*--- Group the fine points by aggregate (CSR-like), this is what allows the
+     *    restriction and the assembly of the coarse matrix to be thread-parallel
+     *    over coarse rows without atomics. ---*/
+
+    amgPointPtr.assign(nAggregate+1, 0);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+      amgPointPtr[amgAggregate[iPoint]+1]++;
+    for (auto iAgg = 0ul; iAgg < nAggregate; ++iAgg)
+      amgPointPtr[iAgg+1] += amgPointPtr[iAgg];
+
+    amgPoint.resize(nPointDomain);
+    vector<unsigned long> position(amgPointPtr.begin(), amgPointPtr.end()-1);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+      amgPoint[position[amgAggregate[iPoint]]++] = iPoint;
+
+    /*--- Coarse sparsity, the union of the aggregates of the owned neighbors of the
+     *    members of each aggregate. Halo columns are dropped, making the coarse
+     *    correction block-Jacobi across MPI domains (the smoothers still see the
+     *    halos, which in practice is enough for scalable iteration counts). ---*/
+
+    amgRowPtr.assign(nAggregate+1, 0);
+    amgColInd.clear();
+    vector<unsigned long> cols;
+
+    for (auto iAgg = 0ul; iAgg < nAggregate; ++iAgg) {
+      cols.clear();
+      for (auto k = amgPointPtr[iAgg]; k < amgPointPtr[iAgg+1]; ++k) {
+        const auto iPoint = amgPoint[k];
+        for (auto index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; ++index)
+          if (col_ind[index] < nPointDomain)
+            cols.push_back(amgAggregate[col_ind[index]]);
+      }
+      sort(cols.begin(), cols.end());
+      cols.erase(unique(cols.begin(), cols.end()), cols.end());
+
+      amgRowPtr[iAgg+1] = amgRowPtr[iAgg] + cols.size();
+      amgColInd.insert(amgColInd.end(), cols.begin(), cols.end());
+    }
+
+    amgDiaPtr.resize(nAggregate);
+    for (auto iAgg = 0ul; iAgg < nAggregate; ++iAgg)
+      for (auto k = amgRowPtr[iAgg]; k < amgRowPtr[iAgg+1]; ++k)
+        if (amgColInd[k] == iAgg) amgDiaPtr[iAgg] = k;
+
+    /*--- Coarse matrix and working memory for the V-cycle. ---*/
+
+    amgMatrix.resize(amgColInd.size()*nVar*nVar);
+    amgInvDiag.resize(nAggregate*nVar*nVar);
+    amgRhs.resize(nAggregate*nVar);
+    amgSol.resize(nAggregate*nVar);
+    amgAux.resize(nAggregate*nVar);
+    amgCorr.resize(nPointDomain*nVar);
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  /*--- Galerkin coarse operator for piecewise-constant transfer operators, the
+   *    block of coarse entry (I,J) is the sum of all fine blocks (i,j) with i
+   *    in aggregate I and j in aggregate J. ---*/
+
+  SU2_OMP_FOR_DYN(omp_heavy_size)
+  for (auto iAgg = 0ul; iAgg < nAggregate; ++iAgg) {
+
+    for (auto k = amgRowPtr[iAgg]*nVar*nVar; k < amgRowPtr[iAgg+1]*nVar*nVar; ++k)
+      amgMatrix[k] = 0.0;
+
+    for (auto k = amgPointPtr[iAgg]; k < amgPointPtr[iAgg+1]; ++k) {
+      const auto iPoint = amgPoint[k];
+      for (auto index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; ++index) {
+        const auto jPoint = col_ind[index];
+        if (jPoint >= nPointDomain) continue;
+        auto pos = amgRowPtr[iAgg];
+        while (amgColInd[pos] != amgAggregate[jPoint]) ++pos;
+        for (auto iVar = 0ul; iVar < nVar*nVar; ++iVar)
+          amgMatrix[pos*nVar*nVar+iVar] += matrix[index*nVar*nVar+iVar];
+      }
+    }
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Invert the coarse diagonal blocks for the coarse Jacobi sweeps. ---*/
+
+  SU2_OMP_FOR_DYN(omp_heavy_size)
+  for (auto iAgg = 0ul; iAgg < nAggregate; ++iAgg) {
+    ScalarType block[MAXNVAR*MAXNVAR];
+    MatrixCopy(&amgMatrix[amgDiaPtr[iAgg]*nVar*nVar], block);
+    MatrixInverse(block, &amgInvDiag[iAgg*nVar*nVar]);
+  }
+  END_SU2_OMP_FOR
+
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::ComputeAMGPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                                      CGeometry *geometry, const CConfig *config) const {
+
+  /*--- Damping of the Jacobi smoothers and number of coarse Jacobi sweeps. ---*/
+
+  const ScalarType omega = 0.8;
+  const unsigned short nSweep = 2;
+
+  /*--- Coherent view of vectors. ---*/
+  SU2_OMP_BARRIER
+
+  /*--- Pre-smoothing, one damped Jacobi iteration from a zero initial guess. ---*/
+
+  SU2_OMP_FOR_DYN(omp_heavy_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    MatrixVectorProduct(&invM[iPoint*nVar*nVar], &vec[iPoint*nVar], &prod[iPoint*nVar]);
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      prod[iPoint*nVar+iVar] *= omega;
+  }
+  END_SU2_OMP_FOR
+
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+
+  /*--- Restrict the residual, the rhs of coarse point I is the sum of the fine
+   *    residuals over the members of aggregate I (P^T r for piecewise-constant
+   *    prolongation), the coarse solution is also cleared here. ---*/
+
+  SU2_OMP_FOR_DYN(omp_heavy_size)
+  for (auto iAgg = 0ul; iAgg < nAggregate; ++iAgg) {
+    ScalarType* rhs = &amgRhs[iAgg*nVar];
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) rhs[iVar] = 0.0;
+
+    for (auto k = amgPointPtr[iAgg]; k < amgPointPtr[iAgg+1]; ++k) {
+      const auto iPoint = amgPoint[k];
+      ScalarType aux_vec[MAXNVAR];
+      RowProduct(prod, iPoint, aux_vec);
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        rhs[iVar] += vec[iPoint*nVar+iVar] - aux_vec[iVar];
+    }
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) amgSol[iAgg*nVar+iVar] = 0.0;
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Approximate coarse solve with block Jacobi sweeps, the implicit barriers
+   *    of the loops separate reads of the old iterate from the update. ---*/
+
+  for (auto iSweep = 0u; iSweep < nSweep; ++iSweep) {
+
+    SU2_OMP_FOR_DYN(omp_heavy_size)
+    for (auto iAgg = 0ul; iAgg < nAggregate; ++iAgg) {
+      ScalarType aux_vec[MAXNVAR];
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) aux_vec[iVar] = amgRhs[iAgg*nVar+iVar];
+
+      for (auto k = amgRowPtr[iAgg]; k < amgRowPtr[iAgg+1]; ++k)
+        if (amgColInd[k] != iAgg)
+          MatrixVectorProductSub(&amgMatrix[k*nVar*nVar], &amgSol[amgColInd[k]*nVar], aux_vec);
+
+      MatrixVectorProduct(&amgInvDiag[iAgg*nVar*nVar], aux_vec, &amgAux[iAgg*nVar]);
+    }
+    END_SU2_OMP_FOR
+
+    SU2_OMP_FOR_STAT(omp_heavy_size)
+    for (auto iAgg = 0ul; iAgg < nAggregate; ++iAgg)
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        amgSol[iAgg*nVar+iVar] = amgAux[iAgg*nVar+iVar];
+    END_SU2_OMP_FOR
+  }
+
+  /*--- Prolongate and add the coarse correction (piecewise constant). ---*/
+
+  SU2_OMP_FOR_STAT(omp_heavy_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      prod[iPoint*nVar+iVar] += amgSol[amgAggregate[iPoint]*nVar+iVar];
+  END_SU2_OMP_FOR
+
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+
+  /*--- Post-smoothing, one damped Jacobi iteration. The correction goes through
+   *    working memory as an in-place update would race with the row products. ---*/
+
+  SU2_OMP_FOR_DYN(omp_heavy_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    ScalarType aux_vec[MAXNVAR];
+    RowProduct(prod, iPoint, aux_vec);
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      aux_vec[iVar] = vec[iPoint*nVar+iVar] - aux_vec[iVar];
+    MatrixVectorProduct(&invM[iPoint*nVar*nVar], aux_vec, &amgCorr[iPoint*nVar]);
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_FOR_STAT(omp_heavy_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      prod[iPoint*nVar+iVar] += omega*amgCorr[iPoint*nVar+iVar];
+  END_SU2_OMP_FOR
+
+  /*--- MPI Parallelization ---*/
+
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+
+}
+
+template<class ScalarType>
+template<unsigned long N>
+void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditionerSmall(const CSysVector<ScalarType> & vec,
+                                                              CSysVector<ScalarType> & prod,
+                                                              CGeometry *geometry, const CConfig *config) const {
+  /*--- Closed-form solve with a diagonal block, N is 1 or 2. ---*/
+  auto diagSolve = [](const ScalarType* d, const ScalarType* r, ScalarType* x) {
+    if (N == 1) {
+      x[0] = r[0] / d[0];
+    }
+    else {
+      const ScalarType det = d[0]*d[3] - d[1]*d[2];
+      x[0] = (r[0]*d[3] - r[1]*d[1]) / det;
+      x[1] = (r[1]*d[0] - r[0]*d[2]) / det;
+    }
+  };
+
+  /*--- Coherent view of vectors. ---*/
+  SU2_OMP_BARRIER
+
+  /*--- First part of the symmetric iteration: (D+L).x* = b, the lower product,
+   subtraction, and diagonal solve of each row are fused in one pass over the
+   CSR arrays (see the generic version for the thread partitioning). ---*/
+
+  SU2_OMP_FOR_STAT(1)
+  for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
+    const auto begin = omp_partitions[thread];
+    const auto end = omp_partitions[thread+1];
+
+    for (auto iPoint = begin; iPoint < end; ++iPoint) {
+      ScalarType r[N];
+      for (auto iVar = 0ul; iVar < N; ++iVar) r[iVar] = vec[iPoint*N+iVar];
+
+      for (auto index = row_ptr[iPoint]; index < dia_ptr[iPoint]; ++index) {
+        const auto jPoint = col_ind[index];
+        if (jPoint < begin) continue;
+        const auto* b = &matrix[index*N*N];
+        const auto* x = &prod[jPoint*N];
+        for (auto iVar = 0ul; iVar < N; ++iVar)
+          for (auto jVar = 0ul; jVar < N; ++jVar)
+            r[iVar] -= b[iVar*N+jVar] * x[jVar];
+      }
+      diagSolve(&matrix[dia_ptr[iPoint]*N*N], r, &prod[iPoint*N]);
+    }
+  }
+  END_SU2_OMP_FOR
+
+  /*--- MPI Parallelization ---*/
+
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+
+  /*--- Second part of the symmetric iteration: (D+U).x_(1) = D.x* ---*/
+
+  SU2_OMP_FOR_STAT(1)
+  for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
+    const auto begin = omp_partitions[thread];
+    const auto row_end = omp_partitions[thread+1];
+    const auto col_end = (row_end == nPointDomain)? nPoint : row_end;
+
+    for (auto iPoint = row_end; iPoint > begin;) {
+      iPoint--; // because of unsigned type
+      const auto* d = &matrix[dia_ptr[iPoint]*N*N];
+
+      ScalarType r[N];
+      for (auto iVar = 0ul; iVar < N; ++iVar) {
+        r[iVar] = ScalarType(0);
+        for (auto jVar = 0ul; jVar < N; ++jVar)
+          r[iVar] += d[iVar*N+jVar] * prod[iPoint*N+jVar];
+      }
+      for (auto index = dia_ptr[iPoint]+1; index < row_ptr[iPoint+1]; ++index) {
+        const auto jPoint = col_ind[index];
+        if (jPoint >= col_end) continue;
+        const auto* b = &matrix[index*N*N];
+        const auto* x = &prod[jPoint*N];
+        for (auto iVar = 0ul; iVar < N; ++iVar)
+          for (auto jVar = 0ul; jVar < N; ++jVar)
+            r[iVar] -= b[iVar*N+jVar] * x[jVar];
+      }
+      diagSolve(d, r, &prod[iPoint*N]);
     }
   }
   END_SU2_OMP_FOR
@@ -829,6 +1709,17 @@ template<class ScalarType>
 void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                                          CGeometry *geometry, const CConfig *config) const {
 
+  /*--- The scalar systems (block size 1 or 2) use the fused CSR path with
+   closed-form diagonal solves, the generic version below pays the per-block
+   helper calls and Gauss eliminations. ---*/
+
+  if (nVar == nEqn) {
+    switch (nVar) {
+      case 1: ComputeLU_SGSPreconditionerSmall<1>(vec, prod, geometry, config); return;
+      case 2: ComputeLU_SGSPreconditionerSmall<2>(vec, prod, geometry, config); return;
+    }
+  }
+
   /*--- First part of the symmetric iteration: (D+L).x* = b ---*/
 
   /*--- Coherent view of vectors. ---*/
@@ -899,11 +1790,9 @@ unsigned long CSysMatrix<ScalarType>::BuildLineletPreconditioner(CGeometry *geom
 
   assert(omp_get_thread_num()==0 && "Linelet preconditioner cannot be built by multiple threads.");
 
-  bool add_point;
-  unsigned long iEdge, iPoint, jPoint, index_Point, iLinelet, iVertex, next_Point, counter, iElem;
-  unsigned short iMarker, iNode;
-  su2double alpha = 0.9, weight, max_weight, area, volume_iPoint, volume_jPoint;
-  const su2double* normal;
+  unsigned long iPoint, iLinelet, iVertex, iElem;
+  unsigned short iMarker;
+  const su2double alpha = 0.9;
   unsigned long Local_nPoints, Local_nLineLets, Global_nPoints, Global_nLineLets, max_nElem;
 
   /*--- Memory allocation --*/
@@ -913,6 +1802,70 @@ unsigned long CSysMatrix<ScalarType>::BuildLineletPreconditioner(CGeometry *geom
   LineletBool.clear();
   LineletBool.resize(nPoint,false);
 
+  /*--- Edge weight, the ratio between weights along and across a boundary
+   *    layer (or any stretched region) is large, which both drives the growth
+   *    of the lines and identifies anisotropic points for interior seeding. ---*/
+
+  auto computeWeight = [&](unsigned long iPoint, unsigned long jPoint) {
+    const auto iEdge = geometry->FindEdge(iPoint, jPoint);
+    const su2double* normal = geometry->edges->GetNormal(iEdge);
+    su2double area;
+    if (geometry->GetnDim() == 3) area = sqrt(normal[0]*normal[0]+normal[1]*normal[1]+normal[2]*normal[2]);
+    else area = sqrt(normal[0]*normal[0]+normal[1]*normal[1]);
+    const su2double volume_iPoint = geometry->nodes->GetVolume(iPoint);
+    const su2double volume_jPoint = geometry->nodes->GetVolume(jPoint);
+    return 0.5*area*((1.0/volume_iPoint)+(1.0/volume_jPoint));
+  };
+
+  /*--- Grow a linelet from its last point, following the dominant
+   *    edge weight until an isotropic zone is reached. ---*/
+
+  auto growLinelet = [&](vector<unsigned long>& linelet) {
+    bool add_point;
+
+    do {
+
+      /*--- Compute the value of the max weight ---*/
+
+      const auto iPoint = linelet.back();
+      su2double max_weight = 0.0;
+      for (auto iNode = 0u; iNode < geometry->nodes->GetnPoint(iPoint); iNode++) {
+        const auto jPoint = geometry->nodes->GetPoint(iPoint, iNode);
+        if ((check_Point[jPoint]) && geometry->nodes->GetDomain(jPoint)) {
+          max_weight = max(max_weight, computeWeight(iPoint, jPoint));
+        }
+      }
+
+      /*--- Verify if any face of the control volume must be added ---*/
+
+      add_point = false;
+      unsigned long counter = 0;
+      auto next_Point = geometry->nodes->GetPoint(iPoint, 0);
+      for (auto iNode = 0u; iNode < geometry->nodes->GetnPoint(iPoint); iNode++) {
+        const auto jPoint = geometry->nodes->GetPoint(iPoint, iNode);
+        const su2double weight = computeWeight(iPoint, jPoint);
+        if (((check_Point[jPoint]) && (weight/max_weight > alpha) && (geometry->nodes->GetDomain(jPoint))) &&
+            ((linelet.size() == 1) || (jPoint != linelet[linelet.size()-2]))) {
+          add_point = true;
+          next_Point = jPoint;
+          counter++;
+        }
+      }
+
+      /*--- We have arrived to an isotropic zone ---*/
+
+      if (counter > 1) add_point = false;
+
+      /*--- Add a typical point to the linelet, no leading edge ---*/
+
+      if (add_point) {
+        linelet.push_back(next_Point);
+        check_Point[next_Point] = false;
+      }
+
+    } while (add_point);
+  };
+
   nLinelet = 0;
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if (config->GetSolid_Wall(iMarker) ||
@@ -921,96 +1874,180 @@ unsigned long CSysMatrix<ScalarType>::BuildLineletPreconditioner(CGeometry *geom
     }
   }
 
-  /*--- If the domain contains well defined Linelets ---*/
+  /*--- Define the basic linelets, starting from each vertex ---*/
 
-  if (nLinelet != 0) {
+  LineletPoint.clear();
+  LineletPoint.resize(nLinelet);
 
-    /*--- Basic initial allocation ---*/
+  iLinelet = 0;
 
-    LineletPoint.resize(nLinelet);
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if (config->GetSolid_Wall(iMarker) ||
+        (config->GetMarker_All_KindBC(iMarker) == DISPLACEMENT_BOUNDARY))
+    {
+      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        LineletPoint[iLinelet].push_back(iPoint);
+        check_Point[iPoint] = false;
+        iLinelet++;
+      }
+    }
+  }
 
-    /*--- Define the basic linelets, starting from each vertex ---*/
+  /*--- Create the linelet structure ---*/
 
-    iLinelet = 0;
+  for (iLinelet = 0; iLinelet < nLinelet; iLinelet++) {
+    growLinelet(LineletPoint[iLinelet]);
+  }
 
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-      if (config->GetSolid_Wall(iMarker) ||
-          (config->GetMarker_All_KindBC(iMarker) == DISPLACEMENT_BOUNDARY))
-      {
-        for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-          LineletPoint[iLinelet].push_back(iPoint);
-          check_Point[iPoint] = false;
-          iLinelet++;
-        }
-      }
+  /*--- Anisotropy-based seeding over the rest of the dual mesh. Points whose
+   *    strongest edge weight clearly dominates the weakest belong to stretched
+   *    regions that the marker-seeded lines did not reach (e.g. wakes or
+   *    refined off-body regions), grow lines from them in both directions. ---*/
+
+  const su2double aniso_ratio = 10.0;
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+    if (!check_Point[iPoint] || !geometry->nodes->GetDomain(iPoint)) continue;
+
+    su2double max_weight = 0.0, min_weight = 1e30;
+    for (auto iNode = 0u; iNode < geometry->nodes->GetnPoint(iPoint); iNode++) {
+      const auto jPoint = geometry->nodes->GetPoint(iPoint, iNode);
+      const su2double weight = computeWeight(iPoint, jPoint);
+      max_weight = max(max_weight, weight);
+      min_weight = min(min_weight, weight);
     }
+    if (max_weight < aniso_ratio*min_weight) continue;
 
-    /*--- Create the linelet structure ---*/
+    vector<unsigned long> linelet(1, iPoint);
+    check_Point[iPoint] = false;
 
-    iLinelet = 0;
+    /*--- Grow in one direction, then reverse the line and grow in the other. ---*/
 
-    do {
+    growLinelet(linelet);
+    reverse(linelet.begin(), linelet.end());
+    growLinelet(linelet);
+
+    /*--- Single points do not form a line (plain Jacobi handles them). ---*/
+
+    if (linelet.size() > 1) {
+      LineletPoint.push_back(move(linelet));
+      nLinelet++;
+    }
+    else {
+      check_Point[iPoint] = true;
+    }
+  }
 
-      index_Point = 0;
-
-      do {
-
-        /*--- Compute the value of the max weight ---*/
-
-        iPoint = LineletPoint[iLinelet][index_Point];
-        max_weight = 0.0;
-        for (iNode = 0; iNode < geometry->nodes->GetnPoint(iPoint); iNode++) {
-          jPoint = geometry->nodes->GetPoint(iPoint, iNode);
-          if ((check_Point[jPoint]) && geometry->nodes->GetDomain(jPoint)) {
-            iEdge = geometry->FindEdge(iPoint, jPoint);
-            normal = geometry->edges->GetNormal(iEdge);
-            if (geometry->GetnDim() == 3) area = sqrt(normal[0]*normal[0]+normal[1]*normal[1]+normal[2]*normal[2]);
-            else area = sqrt(normal[0]*normal[0]+normal[1]*normal[1]);
-            volume_iPoint = geometry->nodes->GetVolume(iPoint);
-            volume_jPoint = geometry->nodes->GetVolume(jPoint);
-            weight = 0.5*area*((1.0/volume_iPoint)+(1.0/volume_jPoint));
-            max_weight = max(max_weight, weight);
+  /*--- Structured-region seeding. Points surrounded exclusively by hexahedra,
+   *    prisms or quadrilaterals lie in extruded mesh regions where a line
+   *    solve converges much better than the point-implicit fallback even
+   *    without stretching (the weight criterion above never fires there).
+   *    Lines are grown through those regions following the straightest
+   *    continuation, which tracks the extrusion direction. ---*/
+
+  {
+    const auto nDim = geometry->GetnDim();
+
+    vector<bool> structured(nPoint, false);
+    for (iPoint = 0; iPoint < nPoint; iPoint++)
+      structured[iPoint] = (geometry->nodes->GetnElem(iPoint) > 0);
+
+    for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+      const auto vtk = geometry->elem[iElem]->GetVTK_Type();
+      if ((vtk == HEXAHEDRON) || (vtk == PRISM) || (vtk == QUADRILATERAL)) continue;
+      for (auto iNode = 0u; iNode < geometry->elem[iElem]->GetnNodes(); iNode++)
+        structured[geometry->elem[iElem]->GetNode(iNode)] = false;
+    }
+
+    /*--- Extend a line from its last point to the unvisited structured
+     *    neighbor that continues it most closely, stopping when the path
+     *    would have to bend (region boundary or corner). The seed point has
+     *    no direction yet, there the dominant edge weight decides. ---*/
+
+    const su2double min_cos = 0.9;
+
+    auto growStraight = [&](vector<unsigned long>& linelet) {
+      while (true) {
+        const auto n = linelet.size();
+        const auto iPoint = linelet.back();
+        const su2double* coord_i = geometry->nodes->GetCoord(iPoint);
+
+        su2double dir[3] = {0.0};
+        if (n > 1) {
+          const su2double* coord_p = geometry->nodes->GetCoord(linelet[n-2]);
+          su2double norm = 0.0;
+          for (auto iDim = 0u; iDim < nDim; iDim++) {
+            dir[iDim] = coord_i[iDim] - coord_p[iDim];
+            norm += dir[iDim]*dir[iDim];
           }
+          norm = sqrt(norm);
+          for (auto iDim = 0u; iDim < nDim; iDim++) dir[iDim] /= norm;
         }
 
-        /*--- Verify if any face of the control volume must be added ---*/
-
-        add_point = false;
-        counter = 0;
-        next_Point = geometry->nodes->GetPoint(iPoint, 0);
-        for (iNode = 0; iNode < geometry->nodes->GetnPoint(iPoint); iNode++) {
-          jPoint = geometry->nodes->GetPoint(iPoint, iNode);
-          iEdge = geometry->FindEdge(iPoint, jPoint);
-          normal = geometry->edges->GetNormal(iEdge);
-          if (geometry->GetnDim() == 3) area = sqrt(normal[0]*normal[0]+normal[1]*normal[1]+normal[2]*normal[2]);
-          else area = sqrt(normal[0]*normal[0]+normal[1]*normal[1]);
-          volume_iPoint = geometry->nodes->GetVolume(iPoint);
-          volume_jPoint = geometry->nodes->GetVolume(jPoint);
-          weight = 0.5*area*((1.0/volume_iPoint)+(1.0/volume_jPoint));
-          if (((check_Point[jPoint]) && (weight/max_weight > alpha) && (geometry->nodes->GetDomain(jPoint))) &&
-              ((index_Point == 0) || ((index_Point > 0) && (jPoint != LineletPoint[iLinelet][index_Point-1])))) {
-            add_point = true;
+        su2double best = (n > 1)? min_cos : 0.0;
+        long next_Point = -1;
+
+        for (auto iNode = 0u; iNode < geometry->nodes->GetnPoint(iPoint); iNode++) {
+          const auto jPoint = geometry->nodes->GetPoint(iPoint, iNode);
+          if (!check_Point[jPoint] || !geometry->nodes->GetDomain(jPoint) || !structured[jPoint]) continue;
+
+          su2double merit;
+          if (n > 1) {
+            const su2double* coord_j = geometry->nodes->GetCoord(jPoint);
+            su2double step[3] = {0.0}, norm = 0.0;
+            for (auto iDim = 0u; iDim < nDim; iDim++) {
+              step[iDim] = coord_j[iDim] - coord_i[iDim];
+              norm += step[iDim]*step[iDim];
+            }
+            norm = sqrt(norm);
+            merit = 0.0;
+            for (auto iDim = 0u; iDim < nDim; iDim++) merit += dir[iDim]*step[iDim]/norm;
+          }
+          else {
+            merit = computeWeight(iPoint, jPoint);
+          }
+
+          if (merit > best) {
+            best = merit;
             next_Point = jPoint;
-            counter++;
           }
         }
 
-        /*--- We have arrived to an isotropic zone ---*/
+        if (next_Point < 0) break;
+
+        linelet.push_back(next_Point);
+        check_Point[next_Point] = false;
+      }
+    };
 
-        if (counter > 1) add_point = false;
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-        /*--- Add a typical point to the linelet, no leading edge ---*/
+      if (!check_Point[iPoint] || !structured[iPoint] || !geometry->nodes->GetDomain(iPoint)) continue;
 
-        if (add_point) {
-          LineletPoint[iLinelet].push_back(next_Point);
-          check_Point[next_Point] = false;
-          index_Point++;
-        }
+      vector<unsigned long> linelet(1, iPoint);
+      check_Point[iPoint] = false;
+
+      growStraight(linelet);
+      reverse(linelet.begin(), linelet.end());
+      growStraight(linelet);
+
+      /*--- Short fragments are left to the point-implicit fallback. ---*/
+
+      if (linelet.size() > 2) {
+        LineletPoint.push_back(move(linelet));
+        nLinelet++;
+      }
+      else {
+        for (const auto jPoint : linelet) check_Point[jPoint] = true;
+      }
+    }
+  }
+
+  /*--- If the domain contains well defined Linelets ---*/
 
-      } while (add_point);
-      iLinelet++;
-    } while (iLinelet < nLinelet);
+  if (nLinelet != 0) {
 
     /*--- Identify the points that belong to a Linelet ---*/
 
@@ -1182,30 +2219,66 @@ void CSysMatrix<ScalarType>::ComputeResidual(const CSysVector<ScalarType> & sol,
 }
 
 template<class ScalarType>
-template<class OtherType>
-void CSysMatrix<ScalarType>::EnforceSolutionAtNode(const unsigned long node_i, const OtherType *x_i, CSysVector<OtherType> & b) {
+const vector<typename CSysMatrix<ScalarType>::CSparseBCEntry>&
+CSysMatrix<ScalarType>::GetBCRowEntries(unsigned long node_i) {
 
-  /*--- Eliminate the row associated with node i (Block_ii = I and all other Block_ij = 0).
-   *    To preserve eventual symmetry, also attempt to eliminate the column, if the sparse pattern is not
-   *    symmetric the entire column may not be eliminated, the result (matrix and vector) is still correct.
-   *    The vector is updated with the product of column i by the known (enforced) solution at node i. ---*/
+  auto it = bcRowRegistry.find(node_i);
+  if (it != bcRowRegistry.end()) return it->second;
+
+  /*--- First enforcement at this row, record the location of its off-diagonal blocks and
+   *    of the matching transposed blocks. The binary searches of the sparse pattern are
+   *    thus paid only once per row, on later calls the eliminations become a compact
+   *    sweep over these locations (the pattern does not change during the solve). ---*/
+
+  auto& entries = bcRowRegistry[node_i];
+  entries.reserve(row_ptr[node_i+1] - row_ptr[node_i]);
 
   for (auto index = row_ptr[node_i]; index < row_ptr[node_i+1]; ++index) {
 
-    auto node_j = col_ind[index];
+    const auto node_j = col_ind[index];
 
-    /*--- The diagonal block is handled outside the loop. ---*/
+    /*--- The diagonal block is not registered, it is handled by the callers. ---*/
     if (node_j == node_i) continue;
 
-    /*--- Delete block j on row i (bij) and ATTEMPT to delete block i on row j (bji). ---*/
-    auto bij = &matrix[index*nVar*nVar];
-    auto bji = GetBlock(node_j, node_i);
+    CSparseBCEntry entry;
+    entry.blockIJ = index;
 
-    /*--- The "attempt" part. ---*/
-    if (bji == nullptr) {
-      node_j = node_i;
-      bji = bij;
+    const auto bji = GetBlock(node_j, node_i);
+
+    if (bji != nullptr) {
+      entry.blockJI = (bji - matrix) / (nVar*nVar);
+      entry.nodeJ = node_j;
     }
+    else {
+      /*--- The pattern is not symmetric, block (j,i) does not exist, flag the entry
+       *    (nodeJ = node_i) so that only the row elimination is performed. ---*/
+      entry.blockJI = index;
+      entry.nodeJ = node_i;
+    }
+    entries.push_back(entry);
+  }
+
+  return entries;
+}
+
+template<class ScalarType>
+template<class OtherType>
+void CSysMatrix<ScalarType>::EnforceSolutionAtNode(const unsigned long node_i, const OtherType *x_i, CSysVector<OtherType> & b) {
+
+  /*--- Eliminate the row associated with node i (Block_ii = I and all other Block_ij = 0).
+   *    To preserve eventual symmetry, also attempt to eliminate the column, if the sparse pattern is not
+   *    symmetric the entire column may not be eliminated, the result (matrix and vector) is still correct.
+   *    The vector is updated with the product of column i by the known (enforced) solution at node i.
+   *    The affected sparse locations are registered on the first enforcement of each row, repeated
+   *    (per iteration) enforcements sweep them directly without searching the pattern. ---*/
+
+  for (const auto& entry : GetBCRowEntries(node_i)) {
+
+    /*--- Delete block j on row i (bij) and, if it exists, block i on row j (bji),
+     *    for an asymmetric pattern the registry aliases bji to bij (and j to i). ---*/
+    auto bij = &matrix[entry.blockIJ*nVar*nVar];
+    auto bji = &matrix[entry.blockJI*nVar*nVar];
+    const auto node_j = entry.nodeJ;
 
     for(auto iVar = 0ul; iVar < nVar; ++iVar) {
       for(auto jVar = 0ul; jVar < nVar; ++jVar) {
@@ -1231,35 +2304,44 @@ template<class OtherType>
 void CSysMatrix<ScalarType>::EnforceSolutionAtDOF(unsigned long node_i, unsigned long iVar,
                                                   OtherType x_i, CSysVector<OtherType> & b) {
 
-  for (auto index = row_ptr[node_i]; index < row_ptr[node_i+1]; ++index) {
+  /*--- Off-diagonal blocks, the locations come from the registry (see EnforceSolutionAtNode). ---*/
 
-    const auto node_j = col_ind[index];
+  for (const auto& entry : GetBCRowEntries(node_i)) {
 
-    /*--- Delete row iVar of block j on row i (bij) and ATTEMPT
-     *    to delete column iVar block i on row j (bji). ---*/
+    auto bij = &matrix[entry.blockIJ*nVar*nVar];
 
-    auto bij = &matrix[index*nVar*nVar];
-    auto bji = GetBlock(node_j, node_i);
-
-    /*--- The "attempt" part. ---*/
-    if (bji != nullptr) {
+    /*--- Delete column iVar of block i on row j (bji), if block (j,i) is part of the pattern. ---*/
+    if (entry.nodeJ != node_i) {
+      auto bji = &matrix[entry.blockJI*nVar*nVar];
       for(auto jVar = 0ul; jVar < nVar; ++jVar) {
         /*--- Column product. ---*/
-        b[node_j*nVar+jVar] -= bji[jVar*nVar+iVar] * x_i;
+        b[entry.nodeJ*nVar+jVar] -= bji[jVar*nVar+iVar] * x_i;
         /*--- Delete entries. ---*/
         bji[jVar*nVar+iVar] = 0.0;
       }
     }
 
-    /*--- Delete row. ---*/
+    /*--- Delete row iVar of block j on row i (bij). ---*/
     for(auto jVar = 0ul; jVar < nVar; ++jVar)
       bij[iVar*nVar+jVar] = 0.0;
+  }
+
+  /*--- Diagonal block, delete column and row iVar and set the diagonal entry to 1. ---*/
 
-    /*--- Set the diagonal entry of the block to 1. ---*/
-    if (node_j == node_i)
-      bij[iVar*(nVar+1)] = 1.0;
+  auto bii = &matrix[dia_ptr[node_i]*nVar*nVar];
+
+  for(auto jVar = 0ul; jVar < nVar; ++jVar) {
+    /*--- Column product. ---*/
+    b[node_i*nVar+jVar] -= bii[jVar*nVar+iVar] * x_i;
+    /*--- Delete entries. ---*/
+    bii[jVar*nVar+iVar] = 0.0;
   }
 
+  for(auto jVar = 0ul; jVar < nVar; ++jVar)
+    bii[iVar*nVar+jVar] = 0.0;
+
+  bii[iVar*(nVar+1)] = 1.0;
+
   /*--- Set known solution in rhs vector. ---*/
   b(node_i, iVar) = x_i;
 
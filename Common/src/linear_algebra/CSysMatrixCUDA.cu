@@ -0,0 +1,172 @@
+/*!
+ * \file CSysMatrixCUDA.cu
+ * \brief Implementation of the CUDA offload helpers used by CSysMatrix.
+ * \author P. Gomes
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/linear_algebra/CSysMatrixCUDA.hpp"
+
+#include <cuda_runtime.h>
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+void gpuAssert(cudaError_t code, const char* file, int line) {
+  if (code != cudaSuccess) {
+    fprintf(stderr, "CUDA error: %s (%s:%d)\n", cudaGetErrorString(code), file, line);
+    exit(EXIT_FAILURE);
+  }
+}
+#define GPU_CHECK(call) gpuAssert((call), __FILE__, __LINE__)
+
+/*--- Number of threads per CUDA block for all kernels. ---*/
+constexpr int BLOCK_SIZE = 128;
+
+/*--- Allocate a device array behind one of the type-erased pointers of
+ * CSysMatrixGPUData (no-op if it was allocated by a previous call). ---*/
+template <class T>
+T* deviceAlloc(void*& ptr, unsigned long count) {
+  if (ptr == nullptr) GPU_CHECK(cudaMalloc(&ptr, count * sizeof(T)));
+  return static_cast<T*>(ptr);
+}
+
+/*--- One thread per block row, looping over the blocks of the row. Simple,
+ * but the typical small blocks (5x5) do not give coalesced accesses much
+ * of an edge over the extra parallelism of the many independent rows. ---*/
+template <class T>
+__global__ void ProductKernel(unsigned long nPointDomain, unsigned long nVar, unsigned long nEqn,
+                              const unsigned long* rowPtr, const unsigned long* colInd, const T* matrix, const T* vec,
+                              T* prod) {
+  const unsigned long row = blockIdx.x * blockDim.x + threadIdx.x;
+  if (row >= nPointDomain) return;
+
+  for (unsigned long iVar = 0; iVar < nVar; ++iVar) {
+    T sum = 0;
+    for (unsigned long index = rowPtr[row]; index < rowPtr[row + 1]; ++index) {
+      const T* block = &matrix[(index * nVar + iVar) * nEqn];
+      const T* v = &vec[colInd[index] * nEqn];
+      for (unsigned long jVar = 0; jVar < nEqn; ++jVar) sum += block[jVar] * v[jVar];
+    }
+    prod[row * nVar + iVar] = sum;
+  }
+}
+
+/*--- One thread per block row, multiplying by the inverted diagonal block. ---*/
+template <class T>
+__global__ void JacobiKernel(unsigned long nPointDomain, unsigned long nVar, const T* invM, const T* vec, T* prod) {
+  const unsigned long row = blockIdx.x * blockDim.x + threadIdx.x;
+  if (row >= nPointDomain) return;
+
+  const T* block = &invM[row * nVar * nVar];
+  for (unsigned long iVar = 0; iVar < nVar; ++iVar) {
+    T sum = 0;
+    for (unsigned long jVar = 0; jVar < nVar; ++jVar) sum += block[iVar * nVar + jVar] * vec[row * nVar + jVar];
+    prod[row * nVar + iVar] = sum;
+  }
+}
+
+}  // namespace
+
+template <class ScalarType>
+void CSysMatrixGPU::Product(CSysMatrixGPUData& gpu, unsigned long nPointDomain, unsigned long nVar, unsigned long nEqn,
+                            unsigned long nnz, const unsigned long* rowPtr, const unsigned long* colInd,
+                            const ScalarType* matrix, const ScalarType* vec, unsigned long vecSize, ScalarType* prod) {
+  /*--- The sparsity pattern is uploaded together with the first allocation,
+   * the matrix values only when they changed since the last product. ---*/
+
+  const bool firstCall = (gpu.rowPtr == nullptr);
+
+  auto* dRowPtr = deviceAlloc<unsigned long>(gpu.rowPtr, nPointDomain + 1);
+  auto* dColInd = deviceAlloc<unsigned long>(gpu.colInd, nnz);
+  auto* dMatrix = deviceAlloc<ScalarType>(gpu.matrix, nnz * nVar * nEqn);
+  auto* dVec = deviceAlloc<ScalarType>(gpu.vec, vecSize);
+  auto* dProd = deviceAlloc<ScalarType>(gpu.prod, vecSize);
+
+  if (firstCall) {
+    GPU_CHECK(cudaMemcpy(dRowPtr, rowPtr, (nPointDomain + 1) * sizeof(unsigned long), cudaMemcpyHostToDevice));
+    GPU_CHECK(cudaMemcpy(dColInd, colInd, nnz * sizeof(unsigned long), cudaMemcpyHostToDevice));
+  }
+  if (gpu.matrixDirty) {
+    GPU_CHECK(cudaMemcpy(dMatrix, matrix, nnz * nVar * nEqn * sizeof(ScalarType), cudaMemcpyHostToDevice));
+    gpu.matrixDirty = false;
+  }
+
+  /*--- The input vector needs its halo values, which are made consistent on
+   * the host by the communications of the previous operation on it. ---*/
+
+  GPU_CHECK(cudaMemcpy(dVec, vec, vecSize * sizeof(ScalarType), cudaMemcpyHostToDevice));
+
+  const unsigned long nBlocks = (nPointDomain + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  ProductKernel<<<nBlocks, BLOCK_SIZE>>>(nPointDomain, nVar, nEqn, dRowPtr, dColInd, dMatrix, dVec, dProd);
+  GPU_CHECK(cudaPeekAtLastError());
+
+  GPU_CHECK(cudaMemcpy(prod, dProd, nPointDomain * nVar * sizeof(ScalarType), cudaMemcpyDeviceToHost));
+}
+
+template <class ScalarType>
+void CSysMatrixGPU::JacobiProduct(CSysMatrixGPUData& gpu, unsigned long nPointDomain, unsigned long nVar,
+                                  const ScalarType* invM, const ScalarType* vec, ScalarType* prod) {
+  auto* dInvM = deviceAlloc<ScalarType>(gpu.invM, nPointDomain * nVar * nVar);
+  auto* dVec = deviceAlloc<ScalarType>(gpu.vec, nPointDomain * nVar);
+  auto* dProd = deviceAlloc<ScalarType>(gpu.prod, nPointDomain * nVar);
+
+  if (gpu.invMDirty) {
+    GPU_CHECK(cudaMemcpy(dInvM, invM, nPointDomain * nVar * nVar * sizeof(ScalarType), cudaMemcpyHostToDevice));
+    gpu.invMDirty = false;
+  }
+
+  GPU_CHECK(cudaMemcpy(dVec, vec, nPointDomain * nVar * sizeof(ScalarType), cudaMemcpyHostToDevice));
+
+  const unsigned long nBlocks = (nPointDomain + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  JacobiKernel<<<nBlocks, BLOCK_SIZE>>>(nPointDomain, nVar, dInvM, dVec, dProd);
+  GPU_CHECK(cudaPeekAtLastError());
+
+  GPU_CHECK(cudaMemcpy(prod, dProd, nPointDomain * nVar * sizeof(ScalarType), cudaMemcpyDeviceToHost));
+}
+
+void CSysMatrixGPU::Free(CSysMatrixGPUData& gpu) {
+  cudaFree(gpu.matrix);
+  cudaFree(gpu.invM);
+  cudaFree(gpu.rowPtr);
+  cudaFree(gpu.colInd);
+  cudaFree(gpu.vec);
+  cudaFree(gpu.prod);
+  gpu = CSysMatrixGPUData();
+}
+
+/*--- Explicit instantiations for the scalar types of CSysMatrix
+ * (the CUDA backend is not available for AD builds). ---*/
+
+template void CSysMatrixGPU::Product<double>(CSysMatrixGPUData&, unsigned long, unsigned long, unsigned long,
+                                             unsigned long, const unsigned long*, const unsigned long*, const double*,
+                                             const double*, unsigned long, double*);
+template void CSysMatrixGPU::Product<float>(CSysMatrixGPUData&, unsigned long, unsigned long, unsigned long,
+                                            unsigned long, const unsigned long*, const unsigned long*, const float*,
+                                            const float*, unsigned long, float*);
+template void CSysMatrixGPU::JacobiProduct<double>(CSysMatrixGPUData&, unsigned long, unsigned long, const double*,
+                                                   const double*, double*);
+template void CSysMatrixGPU::JacobiProduct<float>(CSysMatrixGPUData&, unsigned long, unsigned long, const float*,
+                                                  const float*, float*);
@@ -34,6 +34,8 @@
 #include "../../include/linear_algebra/CSysMatrix.hpp"
 #include "../../include/linear_algebra/CMatrixVectorProduct.hpp"
 #include "../../include/linear_algebra/CPreconditioner.hpp"
+#include "../../include/toolboxes/profiling_toolbox.hpp"
+#include "../../include/toolboxes/allocation_toolbox.hpp"
 
 #include <limits>
 
@@ -59,6 +61,16 @@ CSysSolve<ScalarType>::CSysSolve(const bool mesh_deform_mode) :
   LinSysRes_ptr(nullptr) {
 }
 
+template<class ScalarType>
+CSysSolve<ScalarType>::~CSysSolve() {
+  /*--- The W/Z vectors are views into the arena, make sure they do not
+   *    outlive it (vector clear calls their destructors, which are no-ops
+   *    for non-owning views). ---*/
+  W.clear();
+  Z.clear();
+  MemoryAllocation::aligned_free(krylovArena);
+}
+
 template<class ScalarType>
 void CSysSolve<ScalarType>::ApplyGivens(ScalarType s, ScalarType c, ScalarType & h1, ScalarType & h2) const {
 
@@ -166,6 +178,43 @@ void CSysSolve<ScalarType>::ModGramSchmidt(int i, su2matrix<ScalarType>& Hsbg,
 
 }
 
+template<class ScalarType>
+void CSysSolve<ScalarType>::ClassicalGramSchmidt(int i, su2matrix<ScalarType>& Hsbg,
+                                                 vector<CSysVector<ScalarType> >& w) const {
+
+  /*--- Two passes of classical Gram-Schmidt (CGS2). Each pass batches its
+   *    dot products into one global reduction, so the number of blocking
+   *    communications per call is constant (3) instead of growing with i. ---*/
+
+  vector<ScalarType> h(i+1);
+
+  for (int pass = 0; pass < 2; ++pass) {
+
+    w[i+1].dots(w, i+1, h.data());
+
+    for (int k = 0; k < i+1; k++) {
+      Hsbg(k,i) = (pass == 0? ScalarType(0) : Hsbg(k,i)) + h[k];
+      w[i+1] -= h[k] * w[k];
+    }
+  }
+
+  /*--- Test the resulting vector ---*/
+
+  ScalarType nrm = w[i+1].norm();
+
+  if ((nrm <= 0.0) || (nrm != nrm)) {
+    /*--- nrm is the result of a dot product, communications are implicitly handled. ---*/
+    SU2_MPI::Error("FGMRES orthogonalization failed, linear solver diverged.", CURRENT_FUNCTION);
+  }
+
+  Hsbg(i+1,i) = nrm;
+
+  /*--- Scale the resulting vector ---*/
+
+  w[i+1] /= nrm;
+
+}
+
 template<class ScalarType>
 void CSysSolve<ScalarType>::WriteHeader(string solver, ScalarType restol, ScalarType resinit) const {
 
@@ -341,7 +390,8 @@ unsigned long CSysSolve<ScalarType>::CG_LinSolver(const CSysVector<ScalarType> &
 template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
                                                       const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
-                                                      ScalarType tol, unsigned long m, ScalarType & residual, bool monitoring, const CConfig *config) const {
+                                                      ScalarType tol, unsigned long m, ScalarType & residual, bool monitoring, const CConfig *config,
+                                                      bool ca_orth) const {
 
   const bool master = (SU2_MPI::GetRank() == MASTER_NODE) && (omp_get_thread_num() == 0);
   const bool flexible = !precond.IsIdentity();
@@ -361,11 +411,29 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
   if (W.size() <= m || (flexible && Z.size() <= m)) {
     SU2_OMP_BARRIER
     SU2_OMP_MASTER {
+      /*--- The W/Z bases are views into one contiguous arena, the arena is
+       *    only (re)allocated when the problem size or the restart length
+       *    grow, e.g. not when alternating between solvers of equal size. ---*/
+
+      /*--- Pad each vector to a multiple of 64 bytes to keep all views aligned. ---*/
+      const auto nElmVec = nextMultiple(x.GetNBlk() * x.GetNVar(), 64/sizeof(ScalarType));
+      const auto nVecs = (m+1) * (flexible? 2 : 1);
+
+      if (krylovArenaSize < nVecs*nElmVec) {
+        W.clear();
+        Z.clear();
+        MemoryAllocation::aligned_free(krylovArena);
+        krylovArenaSize = nVecs*nElmVec;
+        krylovArena = MemoryAllocation::aligned_alloc<ScalarType,true>(64, krylovArenaSize*sizeof(ScalarType));
+      }
+
       W.resize(m+1);
-      for (auto& w : W) w.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      for (auto i = 0ul; i <= m; ++i)
+        W[i].ViewExternalStorage(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), &krylovArena[i*nElmVec]);
       if (flexible) {
         Z.resize(m+1);
-        for (auto& z : Z) z.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+        for (auto i = 0ul; i <= m; ++i)
+          Z[i].ViewExternalStorage(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), &krylovArena[(m+1+i)*nElmVec]);
       }
     }
     END_SU2_OMP_MASTER
@@ -451,9 +519,10 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
       mat_vec(W[i], W[i+1]);
     }
 
-    /*---  Modified Gram-Schmidt orthogonalization ---*/
+    /*---  Gram-Schmidt orthogonalization (communication-avoiding variant on request) ---*/
 
-    ModGramSchmidt(i, H, W);
+    if (ca_orth) ClassicalGramSchmidt(i, H, W);
+    else ModGramSchmidt(i, H, W);
 
     /*---  Apply old Givens rotations to new column of the Hessenberg matrix then generate the
      new Givens rotation matrix and apply it to the last two elements of H[:][i] and g ---*/
@@ -825,6 +894,8 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
    derivatives of the residual in CSysSolve_b.
   ---*/
 
+  SU2_PROFILE_SCOPE("CSysSolve::Solve");
+
   unsigned short KindSolver, KindPrecond;
   unsigned long MaxIter;
   ScalarType SolverTol;
@@ -852,6 +923,17 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
     ScreenOutput = config->GetDeform_Output();
   }
 
+  /*--- A direct factorization pays off for small stiff systems (coarse-zone mesh
+   *    deformation, structural zones), especially with factor reuse across calls,
+   *    but its superlinear cost makes it a poor default for large systems. When a
+   *    size threshold is set, fall back to FGMRES above it so that one config can
+   *    serve zones of very different sizes. ---*/
+
+  if (((KindSolver == PASTIX_LDLT) || (KindSolver == PASTIX_LU)) && (config->GetPastixMaxDOF() > 0)) {
+    const unsigned long nDOF = geometry->GetGlobal_nPointDomain() * LinSysSol.GetNVar();
+    if (nDOF > config->GetPastixMaxDOF()) KindSolver = FGMRES;
+  }
+
   /*--- Stop the recording for the linear solver ---*/
 
   bool TapeActive = NO;
@@ -886,35 +968,136 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
 
   precond->Build();
 
+  /*--- Warm start, seed the initial guess with the (scaled) solution of the previous
+   *    call. Consecutive systems of steady problems are strongly correlated and a
+   *    zero-started Krylov method spends its first iterations re-discovering the
+   *    same low modes every nonlinear step. Only applicable when the caller zeroes
+   *    the solution (otherwise it already provides a guess), and pointless for the
+   *    direct solvers. ---*/
+
+  const bool warmStart = xIsZero && config->GetLinear_Solver_Warm_Start() &&
+                         (KindSolver != PASTIX_LDLT) && (KindSolver != PASTIX_LU);
+
+  if (warmStart) {
+    if (!warmStartReady) {
+      /*--- First call, allocate the retained solution and keep the zero guess. ---*/
+      SU2_OMP_BARRIER
+      SU2_OMP_MASTER {
+        xPrev.Initialize(LinSysSol_ptr->GetNBlk(), LinSysSol_ptr->GetNBlkDomain(),
+                         LinSysSol_ptr->GetNVar(), nullptr);
+        warmStartReady = true;
+      }
+      END_SU2_OMP_MASTER
+      SU2_OMP_BARRIER
+    }
+    else {
+      /*--- Seed the guess, the solvers need to compute a true initial residual. ---*/
+      const ScalarType scale = SU2_TYPE::GetValue(config->GetLinear_Solver_Warm_Start_Scale());
+      *LinSysSol_ptr = scale * xPrev;
+      SU2_OMP_MASTER {
+        xIsZero = false;
+      }
+      END_SU2_OMP_MASTER
+      SU2_OMP_BARRIER
+    }
+  }
+
   /*--- Solve system. ---*/
 
   unsigned long IterLinSol = 0;
   ScalarType residual = 0.0;
 
-  switch (KindSolver) {
-    case BCGSTAB:
-      IterLinSol = BCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
-      break;
-    case FGMRES:
-      IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
-      break;
-    case RESTARTED_FGMRES:
-      IterLinSol = RFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
-      break;
-    case CONJUGATE_GRADIENT:
-      IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
-      break;
-    case SMOOTHER:
-      IterLinSol = Smoother_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
-      break;
-    case PASTIX_LDLT : case PASTIX_LU:
-      Jacobian.BuildPastixPreconditioner(geometry, config, KindSolver);
-      Jacobian.ComputePastixPreconditioner(*LinSysRes_ptr, *LinSysSol_ptr, geometry, config);
-      IterLinSol = 1;
-      residual = 1e-20;
-      break;
-    default:
-      SU2_MPI::Error("Unknown type of linear solver.",CURRENT_FUNCTION);
+  auto iterativeSolve = [&](const VectorType& b, VectorType& x) {
+    unsigned long iter = 0;
+    switch (KindSolver) {
+      case BCGSTAB:
+        iter = BCGSTAB_LinSolver(b, x, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+        break;
+      case FGMRES:
+        iter = FGMRES_LinSolver(b, x, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+        break;
+      case RESTARTED_FGMRES:
+        iter = RFGMRES_LinSolver(b, x, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+        break;
+      case CA_FGMRES:
+        iter = FGMRES_LinSolver(b, x, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config, true);
+        break;
+      case CONJUGATE_GRADIENT:
+        iter = CG_LinSolver(b, x, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+        break;
+      case SMOOTHER:
+        iter = Smoother_LinSolver(b, x, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+        break;
+      case PASTIX_LDLT : case PASTIX_LU:
+        Jacobian.BuildPastixPreconditioner(geometry, config, KindSolver);
+        Jacobian.ComputePastixPreconditioner(b, x, geometry, config);
+        iter = 1;
+        residual = 1e-20;
+        break;
+      default:
+        SU2_MPI::Error("Unknown type of linear solver.",CURRENT_FUNCTION);
+    }
+    return iter;
+  };
+
+  IterLinSol = iterativeSolve(*LinSysRes_ptr, *LinSysSol_ptr);
+
+  /*--- Iterative refinement, only sensible when the solver runs in a precision lower
+   *    than the external vectors. Each sweep recomputes the residual of the accumulated
+   *    solution against the full precision RHS (the subtraction is carried out in double
+   *    before rounding) and re-enters the solver for a correction. The matrix is stored
+   *    in the reduced precision, which bounds the attainable accuracy, but the sweeps
+   *    recover the rounding of the Krylov arithmetic and of the RHS round trip. ---*/
+
+  unsigned short nRefine = 0;
+  if (!std::is_same<ScalarType,su2double>::value && (KindSolver != PASTIX_LDLT) && (KindSolver != PASTIX_LU)) {
+    nRefine = mesh_deform? config->GetDeform_Linear_Solver_Refine_Iter() :
+                           config->GetLinear_Solver_Refine_Iter();
+  }
+
+  for (auto iRefine = 0u; iRefine < nRefine; ++iRefine) {
+
+    if (!refine_ready) {
+      SU2_OMP_BARRIER
+      SU2_OMP_MASTER {
+        const auto nBlk = LinSysSol_ptr->GetNBlk();
+        const auto nBlkDomain = LinSysSol_ptr->GetNBlkDomain();
+        const auto nVar = LinSysSol_ptr->GetNVar();
+        refineRes.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+        refineSol.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+        refine_ready = true;
+      }
+      END_SU2_OMP_MASTER
+      SU2_OMP_BARRIER
+    }
+
+    mat_vec(*LinSysSol_ptr, refineRes);
+
+    const auto locSize = refineRes.GetLocSize();
+
+    SU2_OMP_FOR_STAT(1024)
+    for (auto i = 0ul; i < locSize; ++i)
+      refineRes[i] = ScalarType(SU2_TYPE::GetValue(LinSysRes[i]) - SU2_TYPE::GetValue(refineRes[i]));
+    END_SU2_OMP_FOR
+
+    refineSol.SetValZero();
+    SU2_OMP_BARRIER
+
+    IterLinSol += iterativeSolve(refineRes, refineSol);
+
+    *LinSysSol_ptr += refineSol;
+  }
+
+  /*--- Retain the solution for the next call and restore the zero-guess setting
+   *    (RFGMRES also clears it, the caller's declaration must survive both). ---*/
+
+  if (warmStart) {
+    xPrev = *LinSysSol_ptr;
+    SU2_OMP_MASTER {
+      xIsZero = true;
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
   }
 
   SU2_OMP_MASTER
@@ -944,6 +1127,12 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
       case ILU:
         if (RequiresTranspose) Jacobian.BuildILUPreconditioner();
         break;
+      case LEVEL_ILU:
+        if (RequiresTranspose) Jacobian.BuildLevelILUPreconditioner();
+        break;
+      case AMG:
+        if (RequiresTranspose) Jacobian.BuildAMGPreconditioner();
+        break;
       case JACOBI:
       case LINELET:
         if (RequiresTranspose) Jacobian.BuildJacobiPreconditioner();
@@ -1045,6 +1234,9 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
     case RESTARTED_FGMRES:
       IterLinSol = RFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol , MaxIter, Residual, ScreenOutput, config);
       break;
+    case CA_FGMRES:
+      IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol , MaxIter, Residual, ScreenOutput, config, true);
+      break;
     case BCGSTAB:
       IterLinSol = BCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol , MaxIter, Residual, ScreenOutput, config);
       break;
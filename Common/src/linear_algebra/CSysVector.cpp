@@ -27,6 +27,7 @@
 
 #include "../../include/linear_algebra/CSysVector.hpp"
 #include "../../include/toolboxes/allocation_toolbox.hpp"
+#include "../../include/toolboxes/memory_footprint.hpp"
 
 template <class ScalarType>
 void CSysVector<ScalarType>::Initialize(unsigned long numBlk, unsigned long numBlkDomain, unsigned long numVar,
@@ -40,8 +41,12 @@ void CSysVector<ScalarType>::Initialize(unsigned long numBlk, unsigned long numB
     SU2_MPI::Error("Only the master thread is allowed to initialize the vector.", CURRENT_FUNCTION);
 
   if (nElm != numBlk * numVar) {
-    MemoryAllocation::aligned_free(vec_val);
+    if (owns_mem && vec_val != nullptr) {
+      MemoryAllocation::aligned_free(vec_val);
+      MemoryFootprint::Register(MemoryFootprint::LINEAR_VECTORS, -long(nElm*sizeof(ScalarType)));
+    }
     vec_val = nullptr;
+    owns_mem = true;
   }
 
   nElm = numBlk * numVar;
@@ -50,7 +55,26 @@ void CSysVector<ScalarType>::Initialize(unsigned long numBlk, unsigned long numB
 
   omp_chunk_size = computeStaticChunkSize(nElm, omp_get_max_threads(), OMP_MAX_SIZE);
 
-  if (vec_val == nullptr) vec_val = MemoryAllocation::aligned_alloc<ScalarType,true>(64, nElm*sizeof(ScalarType));
+  if (vec_val == nullptr) {
+    vec_val = MemoryAllocation::aligned_alloc<ScalarType>(64, nElm*sizeof(ScalarType));
+    MemoryFootprint::Register(MemoryFootprint::LINEAR_VECTORS, nElm*sizeof(ScalarType));
+
+    /*--- First-touch the memory in the same static schedule as the operations
+     of the vector, so that on NUMA systems the pages are mapped on the memory
+     of the socket whose threads will work on them. Inside a parallel region
+     this degenerates to a serial initialization by the calling thread. ---*/
+
+    SU2_OMP_PARALLEL {
+      const auto nChunk = roundUpDiv(nElm, omp_chunk_size);
+      SU2_OMP_FOR_STAT(1)
+      for (auto iChunk = 0ul; iChunk < nChunk; ++iChunk) {
+        const auto begin = iChunk*omp_chunk_size;
+        memset(&vec_val[begin], 0, std::min(omp_chunk_size, nElm-begin)*sizeof(ScalarType));
+      }
+      END_SU2_OMP_FOR
+    }
+    END_SU2_OMP_PARALLEL
+  }
 
   if (val != nullptr) {
     if (!valIsArray) {
@@ -61,10 +85,33 @@ void CSysVector<ScalarType>::Initialize(unsigned long numBlk, unsigned long numB
   }
 }
 
+template <class ScalarType>
+void CSysVector<ScalarType>::ViewExternalStorage(unsigned long numBlk, unsigned long numBlkDomain,
+                                                 unsigned long numVar, ScalarType* storage) {
+  if (omp_get_thread_num())
+    SU2_MPI::Error("Only the master thread is allowed to initialize the vector.", CURRENT_FUNCTION);
+
+  if (owns_mem) {
+    if (vec_val != nullptr) MemoryFootprint::Register(MemoryFootprint::LINEAR_VECTORS, -long(nElm*sizeof(ScalarType)));
+    MemoryAllocation::aligned_free(vec_val);
+  }
+
+  nElm = numBlk * numVar;
+  nElmDomain = numBlkDomain * numVar;
+  nVar = numVar;
+
+  omp_chunk_size = computeStaticChunkSize(nElm, omp_get_max_threads(), OMP_MAX_SIZE);
+
+  vec_val = storage;
+  owns_mem = false;
+}
+
 template <class ScalarType>
 CSysVector<ScalarType>::~CSysVector() {
+  if (!owns_mem) return;
   if (!std::is_trivial<ScalarType>::value)
     for (auto i = 0ul; i < nElm; i++) vec_val[i].~ScalarType();
+  if (vec_val != nullptr) MemoryFootprint::Register(MemoryFootprint::LINEAR_VECTORS, -long(nElm*sizeof(ScalarType)));
   MemoryAllocation::aligned_free(vec_val);
 }
 
@@ -177,9 +177,41 @@ void CBlasStructure::gemm_imp(const int m,        const int n,        const int
 void CBlasStructure::gemm_inner(int m, int n, int k, const su2double *a, int lda,
                                 const su2double *b, int ldb, su2double *c, int ldc) {
 
-  /* Carry out the multiplication for this block. At the
-     moment simply a call to gemm_arbitrary. */
-  gemm_arbitrary(m, n, k, a, lda, b, ldb, c, ldc);
+  /* Register-blocked micro kernel, 4x4 blocks of c are accumulated in local
+     variables over the full k range, which removes most of the loads and
+     stores of c of the naive triple loop. The i direction has unit stride
+     in both a and c, so the compiler can vectorize it. */
+  const int mr = m - m%4;
+  const int nr = n - n%4;
+
+  for(int j=0; j<nr; j+=4) {
+    for(int i=0; i<mr; i+=4) {
+
+      su2double cc[4][4];
+      for(int jj=0; jj<4; ++jj)
+        for(int ii=0; ii<4; ++ii)
+          cc[ii][jj] = C(i+ii, j+jj);
+
+      for(int p=0; p<k; ++p) {
+        const su2double a0 = A(i,  p), a1 = A(i+1,p), a2 = A(i+2,p), a3 = A(i+3,p);
+        const su2double b0 = B(p,j  ), b1 = B(p,j+1), b2 = B(p,j+2), b3 = B(p,j+3);
+
+        cc[0][0] += a0*b0; cc[1][0] += a1*b0; cc[2][0] += a2*b0; cc[3][0] += a3*b0;
+        cc[0][1] += a0*b1; cc[1][1] += a1*b1; cc[2][1] += a2*b1; cc[3][1] += a3*b1;
+        cc[0][2] += a0*b2; cc[1][2] += a1*b2; cc[2][2] += a2*b2; cc[3][2] += a3*b2;
+        cc[0][3] += a0*b3; cc[1][3] += a1*b3; cc[2][3] += a2*b3; cc[3][3] += a3*b3;
+      }
+
+      for(int jj=0; jj<4; ++jj)
+        for(int ii=0; ii<4; ++ii)
+          C(i+ii, j+jj) = cc[ii][jj];
+    }
+  }
+
+  /* Ragged edges: the remaining rows for the first nr columns,
+     and the remaining columns for all rows. */
+  if(mr < m) gemm_arbitrary(m-mr, nr, k, &A(mr,0), lda, b, ldb, &C(mr,0), ldc);
+  if(nr < n) gemm_arbitrary(m, n-nr, k, a, lda, &B(0,nr), ldb, &C(0,nr), ldc);
 }
 
 /* Naive gemm implementation to handle arbitrary sized matrices. */
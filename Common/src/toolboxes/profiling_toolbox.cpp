@@ -0,0 +1,69 @@
+/*!
+ * \file profiling_toolbox.cpp
+ * \brief Counters and operator new overrides of the heap allocation audit.
+ * \note  Compiled in only when the PROFILE preprocessor symbol is defined,
+ *        the overrides count while an audit scope is open and otherwise
+ *        only forward to malloc/free.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/profiling_toolbox.hpp"
+
+#ifdef PROFILE
+
+#include <cstdlib>
+#include <new>
+
+namespace KernelProfiling {
+namespace AllocationAudit {
+
+std::atomic<unsigned long> nAllocations(0);
+std::atomic<unsigned long> nBytes(0);
+std::atomic<bool> counting(false);
+
+namespace {
+inline void* countedAlloc(std::size_t size) {
+  if (counting.load(std::memory_order_relaxed)) {
+    nAllocations.fetch_add(1, std::memory_order_relaxed);
+    nBytes.fetch_add(size, std::memory_order_relaxed);
+  }
+  void* ptr = std::malloc(size? size : 1);
+  if (ptr == nullptr) throw std::bad_alloc();
+  return ptr;
+}
+}
+
+}
+}
+
+/*--- Global replacements, they must live in exactly one translation unit. ---*/
+
+void* operator new(std::size_t size) { return KernelProfiling::AllocationAudit::countedAlloc(size); }
+
+void* operator new[](std::size_t size) { return KernelProfiling::AllocationAudit::countedAlloc(size); }
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+
+#endif
@@ -29,6 +29,9 @@
 #include "../include/wall_model.hpp"
 #include "../../SU2_CFD/include/fluid/CFluidModel.hpp"
 
+#include <algorithm>
+#include <numeric>
+
 /* Prototypes for Lapack functions, if MKL or LAPACK is used. */
 #if defined (HAVE_MKL) || defined(HAVE_LAPACK)
 extern "C" void dgtsv_(int*, int*, passivedouble*, passivedouble*,
@@ -42,6 +45,8 @@ CWallModel::CWallModel(CConfig *config) {
   Pr_turb = config->GetPrandtl_Turb();
 
   karman = config->GetwallModel_Kappa(); // von Karman constant -> k = 0.41; or 0.38;
+
+  tol = config->GetwallModel_Tol();     // Convergence tolerance of the iterative procedure.
 }
 
 void CWallModel::WallShearStressAndHeatFlux(const su2double rhoExchange,
@@ -58,6 +63,32 @@ void CWallModel::WallShearStressAndHeatFlux(const su2double rhoExchange,
                                             su2double       &ViscosityWall,
                                             su2double       &kOverCvWall) {}
 
+void CWallModel::WallShearStressAndHeatFlux(const unsigned long nPoints,
+                                            const su2double *tExchange,
+                                            const su2double *velExchange,
+                                            const su2double *muExchange,
+                                            const su2double *pExchange,
+                                            const su2double Wall_HeatFlux,
+                                            const bool      HeatFlux_Prescribed,
+                                            const su2double Wall_Temperature,
+                                            const bool      Temperature_Prescribed,
+                                            CFluidModel     *FluidModel,
+                                            su2double       *tauWall,
+                                            su2double       *qWall,
+                                            su2double       *ViscosityWall,
+                                            su2double       *kOverCvWall) {
+
+  /* Default implementation: treat the points of the batch one by one via the
+     scalar version. Derived classes may share the convergence loop instead. */
+  for(unsigned long i=0; i<nPoints; ++i) {
+    WallShearStressAndHeatFlux(tExchange[i], velExchange[i], muExchange[i], pExchange[i],
+                               Wall_HeatFlux, HeatFlux_Prescribed,
+                               Wall_Temperature, Temperature_Prescribed,
+                               FluidModel, tauWall[i], qWall[i],
+                               ViscosityWall[i], kOverCvWall[i]);
+  }
+}
+
 CWallModel1DEQ::CWallModel1DEQ(CConfig      *config,
                                const string &Marker_Tag)
   :  CWallModel(config) {
@@ -113,13 +144,28 @@ void CWallModel1DEQ::WallShearStressAndHeatFlux(const su2double tExchange,
                                                 su2double &ViscosityWall,
                                                 su2double &kOverCvWall) {
 
+  /* The scalar version is simply a batch of one point. */
+  WallShearStressAndHeatFlux(1, &tExchange, &velExchange, &muExchange, &pExchange,
+                             Wall_HeatFlux, HeatFlux_Prescribed,
+                             TWall, Temperature_Prescribed,
+                             FluidModel, &tauWall, &qWall,
+                             &ViscosityWall, &kOverCvWall);
+}
 
-  /* Set tau wall to initial guess
-   */
-  tauWall = 0.5;
-  qWall = 0.0;
-  ViscosityWall = 0.0;
-  kOverCvWall = 0.0;
+void CWallModel1DEQ::WallShearStressAndHeatFlux(const unsigned long nPoints,
+                                                const su2double *tExchange,
+                                                const su2double *velExchange,
+                                                const su2double *muExchange,
+                                                const su2double *pExchange,
+                                                const su2double Wall_HeatFlux,
+                                                const bool      HeatFlux_Prescribed,
+                                                const su2double TWall,
+                                                const bool      Temperature_Prescribed,
+                                                CFluidModel    *FluidModel,
+                                                su2double *tauWall,
+                                                su2double *qWall,
+                                                su2double *ViscosityWall,
+                                                su2double *kOverCvWall) {
 
   /* Set some constants, assuming air at standard conditions
   Todo: Read values below from the config file or from solver.
@@ -133,14 +179,23 @@ void CWallModel1DEQ::WallShearStressAndHeatFlux(const su2double tExchange,
   su2double gamma = 1.4;
   su2double c_p = (gamma*R)/(gamma-1);
   su2double c_v = R/(gamma-1);
-  su2double h_wall = c_p * TWall;
-  su2double h_bc   = c_p * tExchange;
-  unsigned short nfa = numPoints + 1;
+  const unsigned short nfa = numPoints + 1;
+
+  /* Initialize the state of the batch. The temperature profiles of the points
+     must persist between the iterations, hence they are stored per point. The
+     wall shear stress is set to the initial guess. */
+  vector<su2double> T(nPoints*nfa);
+  for(unsigned long p=0; p<nPoints; ++p) {
+    for(unsigned short i=0; i<nfa; ++i) T[p*nfa+i] = tExchange[p];
+    tauWall[p] = 0.5;
+    qWall[p] = 0.0;
+    ViscosityWall[p] = 0.0;
+    kOverCvWall[p] = 0.0;
+  }
 
-  /* Set up vectors
-   */
-  vector<su2double> T(nfa, tExchange);
-  vector<su2double> mu_fa(nfa, muExchange);
+  /* Set up the workspace of one iteration of one point. It is shared by all
+     points of the batch, so the allocations are amortized over the batch. */
+  vector<su2double> mu_fa(nfa, 0.0);
   vector<su2double> tmp(nfa, 0.0);
   vector<su2double> u(numPoints, 0.0);
   vector<su2double> lower(numPoints-1,0.0);
@@ -148,193 +203,205 @@ void CWallModel1DEQ::WallShearStressAndHeatFlux(const su2double tExchange,
   vector<su2double> diagonal(numPoints,0.0);
   vector<su2double> rhs(numPoints,0.0);
 
-  /* Set parameters for control
-   */
-  bool converged = false;
+  /* The points share one convergence loop. Initially all points are active,
+     converged points are removed from the active set after every iteration. */
+  vector<unsigned long> activePoints(nPoints);
+  iota(activePoints.begin(), activePoints.end(), 0ul);
+
   unsigned short iter = 0, max_iter = 25;
-  su2double tauWall_prev = 0.0, tol = 1e-3,  aux_rhs=0.0;
-  su2double qWall_prev=0.0;
+  su2double aux_rhs=0.0;
   su2double mut, nu, mu_lam, rho, utau, y_plus, D;
 
-  while (converged == false){
+  while (!activePoints.empty() && iter < max_iter){
 
     iter += 1;
-    if (iter == max_iter) converged = true;
-
-    tauWall_prev = tauWall;
-    qWall_prev = qWall;
-
-    /* Calculate total viscosity
-    note: rho and mu_lam will be a function of temperature when solving an energy equation
-     */
-    for(unsigned short i=0; i < nfa; ++i){
-      mu_lam = C_1 * pow(T[i]/T_ref, 1.5) * ((T_ref + S)/ (T[i] + S));
-      mu_fa[i] = mu_lam;
-    }
-
-    for(unsigned short i=1; i < nfa; ++i){
-      rho = pExchange / (R*T[i]);
-      nu = mu_fa[i] / rho;
-      utau = sqrt(tauWall / rho);
-      y_plus = y_fa[i] * utau / nu;
-      D = pow(1.0 - exp((-y_plus)/A),2.0);
-      mut = rho * karman * y_fa[i] * utau * D;
-      mu_fa[i] += mut;
-    }
 
-    /* Momentum matrix
-     The solution vector is u at y_cv
-     */
-    lower.assign(numPoints-1,0.0);
-    upper.assign(numPoints-1,0.0);
-    diagonal.assign(numPoints,0.0);
-    rhs.assign(numPoints,0.0);
-
-    /* Top bc
-     */
-    diagonal[numPoints - 1] = 1.0;
-    rhs[numPoints - 1] = velExchange;
-
-    /* Internal cvs
-     */
-    for (unsigned short i=1; i < (numPoints - 1); ++i){
-      upper[i]  =  mu_fa[i + 1] / (y_cv[i + 1] -  y_cv[i] );
-      lower[i-1]  = mu_fa[i] / (y_cv[i] -  y_cv[i - 1] );
-      diagonal[i] = -1.0 * (upper[i] + lower[i - 1]);
-    }
-
-    /* Wall BC
-     */
-    upper[0] = mu_fa[1]/(y_cv[1] - y_cv[0]);
-    diagonal[0] = -1.0 * (upper[0] + mu_fa[0]/(y_cv[0]-y_fa[0]) );
-    rhs[0] = 0.0;
-
-    /* Solve the matrix problem to get the velocity field
-       - rhs returns the solution
-    */
+    unsigned long nActive = 0;
+    for(unsigned long pp=0; pp<activePoints.size(); ++pp) {
+
+      const unsigned long p = activePoints[pp];
+      su2double *Tp = T.data() + p*nfa;
+
+      const su2double tauWall_prev = tauWall[p];
+      const su2double qWall_prev = qWall[p];
+      su2double h_wall = c_p * TWall;
+      const su2double h_bc = c_p * tExchange[p];
+
+      /* Calculate total viscosity
+      note: rho and mu_lam will be a function of temperature when solving an energy equation
+       */
+      for(unsigned short i=0; i < nfa; ++i){
+        mu_lam = C_1 * pow(Tp[i]/T_ref, 1.5) * ((T_ref + S)/ (Tp[i] + S));
+        mu_fa[i] = mu_lam;
+      }
+
+      for(unsigned short i=1; i < nfa; ++i){
+        rho = pExchange[p] / (R*Tp[i]);
+        nu = mu_fa[i] / rho;
+        utau = sqrt(tauWall[p] / rho);
+        y_plus = y_fa[i] * utau / nu;
+        D = pow(1.0 - exp((-y_plus)/A),2.0);
+        mut = rho * karman * y_fa[i] * utau * D;
+        mu_fa[i] += mut;
+      }
+
+      /* Momentum matrix
+       The solution vector is u at y_cv
+       */
+      lower.assign(numPoints-1,0.0);
+      upper.assign(numPoints-1,0.0);
+      diagonal.assign(numPoints,0.0);
+      rhs.assign(numPoints,0.0);
+
+      /* Top bc
+       */
+      diagonal[numPoints - 1] = 1.0;
+      rhs[numPoints - 1] = velExchange[p];
+
+      /* Internal cvs
+       */
+      for (unsigned short i=1; i < (numPoints - 1); ++i){
+        upper[i]  =  mu_fa[i + 1] / (y_cv[i + 1] -  y_cv[i] );
+        lower[i-1]  = mu_fa[i] / (y_cv[i] -  y_cv[i - 1] );
+        diagonal[i] = -1.0 * (upper[i] + lower[i - 1]);
+      }
+
+      /* Wall BC
+       */
+      upper[0] = mu_fa[1]/(y_cv[1] - y_cv[0]);
+      diagonal[0] = -1.0 * (upper[0] + mu_fa[0]/(y_cv[0]-y_fa[0]) );
+      rhs[0] = 0.0;
+
+      /* Solve the matrix problem to get the velocity field
+         - rhs returns the solution
+      */
 #if (defined(HAVE_MKL) || defined(HAVE_LAPACK)) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
-    int info, nrhs = 1;
+      int info, nrhs = 1;
 
-    dgtsv_(&numPoints,&nrhs,lower.data(),diagonal.data(),upper.data(),rhs.data(),&numPoints, &info);
-    if (info != 0)
-      SU2_MPI::Error("Unsuccessful call to dgtsv_", CURRENT_FUNCTION);
+      dgtsv_(&numPoints,&nrhs,lower.data(),diagonal.data(),upper.data(),rhs.data(),&numPoints, &info);
+      if (info != 0)
+        SU2_MPI::Error("Unsuccessful call to dgtsv_", CURRENT_FUNCTION);
 #else
-    SU2_MPI::Error("Not compiled with MKL or LAPACK support", CURRENT_FUNCTION);
+      SU2_MPI::Error("Not compiled with MKL or LAPACK support", CURRENT_FUNCTION);
 #endif
 
-    u = rhs;
-
-    /* Update total viscosity
-     */
-    for(unsigned short i=0; i < nfa; ++i){
-      mu_lam = C_1 * pow(T[i]/T_ref, 1.5) * ((T_ref + S)/ (T[i] + S));
-      mu_fa[i] = mu_lam;
-      tmp[i] = mu_lam/Pr_lam;
-    }
-    /* Update tauWall
-     */
-    tauWall = mu_fa[0] * (u[0] - 0.0)/(y_cv[0]-y_fa[0]);
-    for(unsigned short i=1; i < nfa; ++i){
-      rho = pExchange / (R*T[i]);
-      nu = mu_fa[i] / rho;
-      utau = sqrt(tauWall / rho);
-      y_plus = y_fa[i] * utau / nu;
-      D = pow(1.0 - exp((-y_plus)/A),2.0);
-      mut = rho * karman * y_fa[i] * utau * D;
-      mu_fa[i] += mut;
-      tmp[i] += mut/Pr_turb;
-    }
-
-    /* Energy matrix
-     The Solution vector is Enthalpy at y_cv
-     */
-    lower.assign(numPoints-1,0.0);
-    upper.assign(numPoints-1,0.0);
-    diagonal.assign(numPoints,0.0);
-    rhs.assign(numPoints,0.0);
-
-    /* Internal cvs
-     */
-    for (unsigned short i=1; i < (numPoints - 1); ++i){
-      upper[i]  =  tmp[i + 1] / (y_cv[i + 1] -  y_cv[i] );
-      lower[i-1]  = tmp[i] / (y_cv[i] -  y_cv[i - 1] );
-      diagonal[i] = -1.0 * (upper[i] + lower[i - 1]);
-    }
-
-    /* Top BC
-     */
-    diagonal[numPoints - 1] = 1.0;
-
-    /* Wall BC
-     */
-    upper[0] = tmp[1]/(y_cv[1] - y_cv[0]);
-    diagonal[0] = -1.0 * (upper[0] + tmp[0]/(y_cv[0]-y_fa[0]) );
-    aux_rhs = tmp[0]/(y_cv[0]-y_fa[0]);
-
-    /* RHS of the Energy equation
-       - Compute flux -- (mu + mu_t) * u * du/dy --
-     */
-
-    /* Zero flux at the wall
-     */
-    tmp[0] = 0. ;
-    for (unsigned short i=1; i < numPoints; ++i){
-      tmp[i] = 0.5* (mu_fa[i]) * (u[i] + u[i-1]) * (u[i] -u[i-1])/(y_cv[i] -  y_cv[i - 1] )  ;
-    }
-    for (unsigned short i=0; i < (numPoints - 1); ++i){
-      rhs[i] = -tmp[i+1] + tmp[i];
-    }
-
-    if (HeatFlux_Prescribed == true){
-      /* dT/dy = 0 -> Twall = T[1] */
-      h_wall = c_p * T[1];
-    }
-
-    rhs[0] -= aux_rhs * h_wall;
-    rhs[numPoints-1] = h_bc;
-
-    /* Solve the matrix problem to get the Enthalpy field
-     */
+      u = rhs;
+
+      /* Update total viscosity
+       */
+      for(unsigned short i=0; i < nfa; ++i){
+        mu_lam = C_1 * pow(Tp[i]/T_ref, 1.5) * ((T_ref + S)/ (Tp[i] + S));
+        mu_fa[i] = mu_lam;
+        tmp[i] = mu_lam/Pr_lam;
+      }
+      /* Update tauWall
+       */
+      tauWall[p] = mu_fa[0] * (u[0] - 0.0)/(y_cv[0]-y_fa[0]);
+      for(unsigned short i=1; i < nfa; ++i){
+        rho = pExchange[p] / (R*Tp[i]);
+        nu = mu_fa[i] / rho;
+        utau = sqrt(tauWall[p] / rho);
+        y_plus = y_fa[i] * utau / nu;
+        D = pow(1.0 - exp((-y_plus)/A),2.0);
+        mut = rho * karman * y_fa[i] * utau * D;
+        mu_fa[i] += mut;
+        tmp[i] += mut/Pr_turb;
+      }
+
+      /* Energy matrix
+       The Solution vector is Enthalpy at y_cv
+       */
+      lower.assign(numPoints-1,0.0);
+      upper.assign(numPoints-1,0.0);
+      diagonal.assign(numPoints,0.0);
+      rhs.assign(numPoints,0.0);
+
+      /* Internal cvs
+       */
+      for (unsigned short i=1; i < (numPoints - 1); ++i){
+        upper[i]  =  tmp[i + 1] / (y_cv[i + 1] -  y_cv[i] );
+        lower[i-1]  = tmp[i] / (y_cv[i] -  y_cv[i - 1] );
+        diagonal[i] = -1.0 * (upper[i] + lower[i - 1]);
+      }
+
+      /* Top BC
+       */
+      diagonal[numPoints - 1] = 1.0;
+
+      /* Wall BC
+       */
+      upper[0] = tmp[1]/(y_cv[1] - y_cv[0]);
+      diagonal[0] = -1.0 * (upper[0] + tmp[0]/(y_cv[0]-y_fa[0]) );
+      aux_rhs = tmp[0]/(y_cv[0]-y_fa[0]);
+
+      /* RHS of the Energy equation
+         - Compute flux -- (mu + mu_t) * u * du/dy --
+       */
+
+      /* Zero flux at the wall
+       */
+      tmp[0] = 0. ;
+      for (unsigned short i=1; i < numPoints; ++i){
+        tmp[i] = 0.5* (mu_fa[i]) * (u[i] + u[i-1]) * (u[i] -u[i-1])/(y_cv[i] -  y_cv[i - 1] )  ;
+      }
+      for (unsigned short i=0; i < (numPoints - 1); ++i){
+        rhs[i] = -tmp[i+1] + tmp[i];
+      }
+
+      if (HeatFlux_Prescribed == true){
+        /* dT/dy = 0 -> Twall = T[1] */
+        h_wall = c_p * Tp[1];
+      }
+
+      rhs[0] -= aux_rhs * h_wall;
+      rhs[numPoints-1] = h_bc;
+
+      /* Solve the matrix problem to get the Enthalpy field
+       */
 #if (defined(HAVE_MKL) || defined(HAVE_LAPACK)) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
-    dgtsv_(&numPoints,&nrhs,lower.data(),diagonal.data(),upper.data(),rhs.data(),&numPoints, &info);
-    if (info != 0)
-      SU2_MPI::Error("Unsuccessful call to dgtsv_", CURRENT_FUNCTION);
+      dgtsv_(&numPoints,&nrhs,lower.data(),diagonal.data(),upper.data(),rhs.data(),&numPoints, &info);
+      if (info != 0)
+        SU2_MPI::Error("Unsuccessful call to dgtsv_", CURRENT_FUNCTION);
 #else
-    SU2_MPI::Error("Not compiled with MKL or LAPACK support", CURRENT_FUNCTION);
+      SU2_MPI::Error("Not compiled with MKL or LAPACK support", CURRENT_FUNCTION);
 #endif
 
-    /* Get Temperature from enthalpy
-      - Temperature will be at face
-     */
-    T[0] = h_wall/c_p;
-    T[numPoints] = h_bc/c_p;
-    for (unsigned short i=0; i < numPoints-1; i++){
-      T[i+1] = 0.5 * (rhs[i] + rhs[i+1])/c_p;
+      /* Get Temperature from enthalpy
+        - Temperature will be at face
+       */
+      Tp[0] = h_wall/c_p;
+      Tp[numPoints] = h_bc/c_p;
+      for (unsigned short i=0; i < numPoints-1; i++){
+        Tp[i+1] = 0.5 * (rhs[i] + rhs[i+1])/c_p;
+      }
+
+      /* Final update tauWall
+       */
+      mu_lam = C_1 * pow(Tp[0]/T_ref, 1.5) * ((T_ref + S)/ (Tp[0] + S));
+
+      /* These quantities will be returned.
+       */
+      tauWall[p] = mu_lam * (u[0] - 0.0)/(y_cv[0]-y_fa[0]);
+      qWall[p] = mu_lam * (c_p / Pr_lam) * -(Tp[1] - Tp[0]) / (y_fa[1]-y_fa[0]);
+      ViscosityWall[p] = mu_lam;
+      //kOverCvWall = c_p / c_v * (mu[0]/Pr_lam + muTurb[0]/Pr_turb);
+      kOverCvWall[p] = c_p / c_v * (mu_lam/Pr_lam);
+
+      /* Final check of the Y+
+       */
+      rho = pExchange[p] / (R * Tp[0]);
+      if (y_cv[0] * sqrt(tauWall[p]/rho) / (mu_lam/rho) > 1.0)
+        SU2_MPI::Error("Y+ greater than one: Increase the number of points or growth ratio.", CURRENT_FUNCTION);
+
+      /* Define a norm. Points that have not converged yet remain
+         in the active set for the next iteration.
+       */
+      if (!(abs(1.0 - tauWall[p]/tauWall_prev) < tol && abs(1.0 - qWall[p]/qWall_prev) < tol)){
+        activePoints[nActive++] = p;
+      }
     }
 
-    /* Final update tauWall
-     */
-    mu_lam = C_1 * pow(T[0]/T_ref, 1.5) * ((T_ref + S)/ (T[0] + S));
-
-    /* These quantities will be returned.
-     */
-    tauWall = mu_lam * (u[0] - 0.0)/(y_cv[0]-y_fa[0]);
-    qWall = mu_lam * (c_p / Pr_lam) * -(T[1] - T[0]) / (y_fa[1]-y_fa[0]);
-    ViscosityWall = mu_lam;
-    //kOverCvWall = c_p / c_v * (mu[0]/Pr_lam + muTurb[0]/Pr_turb);
-    kOverCvWall = c_p / c_v * (mu_lam/Pr_lam);
-
-    /* Final check of the Y+
-     */
-    rho = pExchange / (R * T[0]);
-    if (y_cv[0] * sqrt(tauWall/rho) / (mu_lam/rho) > 1.0)
-      SU2_MPI::Error("Y+ greater than one: Increase the number of points or growth ratio.", CURRENT_FUNCTION);
-
-    /* Define a norm
-     */
-    if (abs(1.0 - tauWall/tauWall_prev) < tol && abs(1.0 - qWall/qWall_prev) < tol){
-      converged = true;
-    }
+    activePoints.resize(nActive);
   }
 }
 
@@ -348,6 +415,31 @@ CWallModelLogLaw::CWallModelLogLaw(CConfig      *config,
      and set the exchange height. */
   const su2double *doubleInfo = config->GetWallFunction_DoubleInfo(Marker_Tag);
   h_wm = doubleInfo[0];
+
+  /* Build the lookup table for the inverse of the Reichardt profile. The
+     Reynolds number based on the exchange height and the friction velocity
+     equals y+ u+(y+), which is a monotone function of y+. Its logarithm is
+     tabulated for a log-spaced range of y+ values, such that the friction
+     velocity can be obtained by interpolation rather than a cold-started
+     Newton iteration. */
+  const int nTable = 512;
+  const su2double logYPlusMin = log(1.e-2), logYPlusMax = log(1.e6);
+
+  logYPlusTable.resize(nTable);
+  logRePlusTable.resize(nTable);
+  for(int i=0; i<nTable; ++i) {
+    const su2double logYPlus = logYPlusMin + i*(logYPlusMax - logYPlusMin)/(nTable-1);
+    const su2double y_plus   = exp(logYPlus);
+
+    logYPlusTable[i]  = logYPlus;
+    logRePlusTable[i] = log(y_plus*ReichardtUPlus(y_plus));
+  }
+}
+
+su2double CWallModelLogLaw::ReichardtUPlus(const su2double y_plus) const {
+
+  return log(karman*y_plus + 1.0)/karman
+       + (C - log(karman)/karman)*(1.0 - exp(-y_plus/11.0) - (y_plus/11.0)*exp(-0.33*y_plus));
 }
 
 void CWallModelLogLaw::WallShearStressAndHeatFlux(const su2double tExchange,
@@ -377,13 +469,26 @@ void CWallModelLogLaw::WallShearStressAndHeatFlux(const su2double tExchange,
   const su2double c_v      = FluidModel->GetCv();
   const su2double nu_wall  = mu_wall / rho_wall;
 
-  /* Initial guess of the friction velocity. */
+  /* Initial guess of the friction velocity. The Reynolds number based on the
+     exchange height corresponds to y+ u+ of the Reichardt profile, hence the
+     guess is obtained by interpolation in the lookup table, which makes the
+     Newton iteration below converge in one or two steps. Outside the range of
+     the table the crude estimate of the original implementation is used. */
   su2double u_tau = max(0.01*velExchange, 1.e-5);
 
+  const su2double logRe = log(max(velExchange, 1.e-25)*h_wm/nu_wall);
+  if(logRe >= logRePlusTable.front() && logRe <= logRePlusTable.back()) {
+    const unsigned long i = min<unsigned long>(logRePlusTable.size()-2,
+                            upper_bound(logRePlusTable.begin(), logRePlusTable.end(), logRe)
+                          - logRePlusTable.begin() - 1);
+    const su2double ww = (logRe - logRePlusTable[i])/(logRePlusTable[i+1] - logRePlusTable[i]);
+    const su2double logYPlus = logYPlusTable[i] + ww*(logYPlusTable[i+1] - logYPlusTable[i]);
+    u_tau = exp(logYPlus)*nu_wall/h_wm;
+  }
+
   /* Set parameters for control of the Newton iteration. */
   bool converged = false;
   unsigned short iter = 0, max_iter = 50;
-  const su2double tol=1e-3;
 
   while (converged == false){
 
@@ -396,8 +501,7 @@ void CWallModelLogLaw::WallShearStressAndHeatFlux(const su2double tExchange,
     /* Reichardt boundary layer analytical law
        fprime is the differentiation of the Reichardt law with repect to u_tau.
      */
-    const su2double fval = velExchange/u_tau0 - ((C - log(karman)/karman)*(1.0 - exp(-y_plus/11.0)
-                         - (y_plus/11.0)*exp(-0.33*y_plus))) - log(karman*y_plus + 1.0)/karman;
+    const su2double fval = velExchange/u_tau0 - ReichardtUPlus(y_plus);
     const su2double fprime = -velExchange/pow(u_tau0,2.0)
                            + (- C + log(karman)/karman)*(-(1.0/11.0)*h_wm*exp(-0.33*y_plus)/nu_wall
                            +                              (1.0/11.0)*h_wm*exp(-(1.0/11.0)*y_plus)/nu_wall
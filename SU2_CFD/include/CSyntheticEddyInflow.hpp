@@ -0,0 +1,120 @@
+/*!
+ * \file CSyntheticEddyInflow.hpp
+ * \brief Header file for the class CSyntheticEddyInflow.
+ *        The implementations are in the <i>CSyntheticEddyInflow.cpp</i> file.
+ * \version 7.2.1 "Blackbird"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2021, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../../Common/include/parallelization/mpi_structure.hpp"
+#include "../../Common/include/CConfig.hpp"
+#include "../../Common/include/geometry/CGeometry.hpp"
+
+using namespace std;
+
+/*!
+ * \class CSyntheticEddyInflow
+ * \brief Synthetic eddy method (SEM) inflow generator attached to one inlet marker.
+ *
+ * A population of eddies is kept in a box around the marker, convected through it
+ * each time step and recycled on the upstream face when they leave. The induced
+ * velocity fluctuation is evaluated in memory at every inlet vertex, replacing the
+ * re-reading of unsteady inlet profile files from disk. The eddy stream is seeded
+ * from the config so that reruns are reproducible, and every rank holding a part
+ * of the marker evolves an identical population so that the generated field is
+ * continuous across partition boundaries.
+ */
+class CSyntheticEddyInflow {
+
+protected:
+
+  unsigned short nDim;       /*!< \brief Dimension of the problem (2 or 3). */
+  unsigned long nEddy;       /*!< \brief Number of eddies in the population. */
+  su2double sigma;           /*!< \brief Eddy length scale. */
+  su2double intensity;       /*!< \brief Fluctuation intensity relative to the local inlet velocity. */
+
+  su2double boxMin[3];       /*!< \brief Lower corner of the eddy box (marker bounding box + sigma). */
+  su2double boxMax[3];       /*!< \brief Upper corner of the eddy box. */
+  su2double boxVolume;       /*!< \brief Volume (area in 2D) of the eddy box. */
+  su2double convDir[3];      /*!< \brief Mean inward normal of the marker, the eddy convection direction. */
+  unsigned short convAxis;   /*!< \brief Coordinate axis most aligned with the convection direction. */
+  su2double convVel;         /*!< \brief Eddy convection speed (free-stream velocity magnitude). */
+
+  vector<su2double> eddyPos;    /*!< \brief Eddy positions, nEddy x nDim. */
+  vector<short> eddySign;       /*!< \brief Eddy intensity signs (+-1), nEddy x 3. */
+
+  mt19937 generator;            /*!< \brief Random generator, advanced identically on every rank. */
+
+  unsigned long lastTimeIter;   /*!< \brief Last time iteration the population was convected at. */
+
+  /*!
+   * \brief Draw a new position and signs for one eddy.
+   * \param[in] iEddy - Index of the eddy.
+   * \param[in] upstream - If true place it on the upstream face of the box, else anywhere inside.
+   */
+  void SpawnEddy(unsigned long iEddy, bool upstream);
+
+public:
+
+  /*!
+   * \brief Constructor of the CSyntheticEddyInflow class. Collective: every rank must
+   *        construct the generator of every inlet marker, the marker bounding box and
+   *        mean normal are global reductions.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] markerTag - Tag of the inlet marker the eddies are attached to.
+   */
+  CSyntheticEddyInflow(CGeometry *geometry, const CConfig *config, const string& markerTag);
+
+  /*!
+   * \brief Convect the eddy population by one time step and recycle the eddies that
+   *        left the box. No-op if already called for the current time iteration, so
+   *        it can be invoked from the boundary routine of each solver.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void UpdateEddies(const CConfig *config);
+
+  /*!
+   * \brief Evaluate the velocity fluctuation induced by the eddy population.
+   * \param[in] coord - Coordinates of the inlet vertex.
+   * \param[in] velMag - Local inlet velocity magnitude, scales the fluctuation.
+   * \param[out] uPrime - Velocity fluctuation (nDim components).
+   */
+  void GetFluctuation(const su2double *coord, su2double velMag, su2double *uPrime) const;
+
+};
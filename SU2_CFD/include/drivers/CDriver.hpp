@@ -331,6 +331,19 @@ public:
    */
   void Postprocessing();
 
+  /*!
+   * \brief Hand over an adapted mesh without restarting the process: the current
+   *        solution is written to the restart file, the mesh-sized structures
+   *        (geometry, solvers, numerics, integration) are rebuilt for the new
+   *        mesh, and the solution is reloaded onto it, interpolating between the
+   *        meshes (see CSolver::InterpolateRestartData). The config, iteration,
+   *        and output/history state are preserved.
+   * \note Implemented for steady single-zone problems, the typical outer
+   *       adaptation loop with an external remesher.
+   * \param[in] meshFileName - Name of the adapted mesh file.
+   */
+  void AdaptMesh(const string& meshFileName);
+
   /*!
    * \brief A virtual member.
    */
@@ -596,6 +609,15 @@ public:
    */
   void SetMeshDisplacement(unsigned short iMarker, unsigned long iVertex, passivedouble DispX, passivedouble DispY, passivedouble DispZ);
 
+  /*!
+   * \brief Set the mesh displacements of all vertices of a marker in one call,
+   * to avoid the per-vertex call overhead in coupled simulations.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] values - Flat array of displacements, 3 components per vertex
+   * (the third component is ignored in 2D).
+   */
+  void SetMarkerMeshDisplacements(unsigned short iMarker, const vector<passivedouble>& values);
+
   /*!
    * \brief Communicate the boundary mesh displacements in a python call
    */
@@ -620,6 +642,14 @@ public:
   void SetFEA_Loads(unsigned short iMarker, unsigned long iVertex, passivedouble LoadX,
                     passivedouble LoadY, passivedouble LoadZ);
 
+  /*!
+   * \brief Set the loads of all vertices of a marker for the structural solver
+   * in one call, to avoid the per-vertex call overhead in coupled simulations.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] values - Flat array of loads, 3 components per vertex.
+   */
+  void SetMarkerFEA_Loads(unsigned short iMarker, const vector<passivedouble>& values);
+
   /*!
    * \brief Return the displacements from the FEA solver.
    * \param[in] iMarker - Marker identifier.
@@ -628,6 +658,15 @@ public:
    */
   vector<passivedouble> GetFEA_Displacements(unsigned short iMarker, unsigned long iVertex) const;
 
+  /*!
+   * \brief Return the displacements of all vertices of a marker from the FEA
+   * solver in one call.
+   * \param[in] iMarker - Marker identifier.
+   * \return Flat array of displacements, 3 components per vertex
+   * (the third component is zero in 2D).
+   */
+  vector<passivedouble> GetMarkerFEA_Displacements(unsigned short iMarker) const;
+
   /*!
    * \brief Return the velocities from the FEA Solver.
    * \param[in] iMarker - Marker identifier.
@@ -662,6 +701,63 @@ public:
    */
   vector<passivedouble> GetFlowLoad(unsigned short iMarker, unsigned long iVertex) const;
 
+  /*!
+   * \brief Get the flow loads of all vertices of a marker in one call, to
+   * avoid the per-vertex call overhead in coupled simulations.
+   * \param[in] iMarker - Marker identifier.
+   * \return Flat array of loads, 3 components per vertex
+   * (the third component is zero in 2D).
+   */
+  vector<passivedouble> GetMarkerFlowLoads(unsigned short iMarker) const;
+
+  /*!
+   * \brief Load the current solution into the volume data sorter without writing any
+   * files, for in-situ co-processing (the sorted fields can then be queried below).
+   */
+  void CollectVolumeOutputData();
+
+  /*!
+   * \brief Get the names of the sorted volume output fields.
+   */
+  vector<string> GetVolumeOutputFieldNames() const;
+
+  /*!
+   * \brief Get the number of points of this rank's linear partition of the sorted volume output.
+   */
+  unsigned long GetVolumeOutputnPoints() const;
+
+  /*!
+   * \brief Get the sorted values of one volume output field on this rank.
+   * \param[in] iField - Index into the field names.
+   */
+  vector<passivedouble> GetVolumeOutputField(unsigned short iField) const;
+
+  /*!
+   * \brief Get the global indices of this rank's owned points in a zone, used to
+   * re-map the in-memory solution handoff between differently partitioned instances.
+   * \param[in] iZone - Zone identifier.
+   */
+  vector<unsigned long> GetZoneSolutionIndices(unsigned short iZone) const;
+
+  /*!
+   * \brief Get the solution of one solver of a zone at all owned points, so that
+   * converged zone states can be handed to another driver instance directly,
+   * without the restart file round-trip of staggered startup scripts.
+   * \param[in] iZone - Zone identifier.
+   * \param[in] iSolver - Solver position in the container (e.g. FLOW_SOL, HEAT_SOL, FEA_SOL).
+   * \return Flat array of nVar values per owned point, ordered as GetZoneSolutionIndices.
+   */
+  vector<passivedouble> GetZoneSolution(unsigned short iZone, unsigned short iSolver) const;
+
+  /*!
+   * \brief Set the solution of one solver of a zone at all owned points and update
+   * the halo points, counterpart of GetZoneSolution.
+   * \param[in] iZone - Zone identifier.
+   * \param[in] iSolver - Solver position in the container (e.g. FLOW_SOL, HEAT_SOL, FEA_SOL).
+   * \param[in] values - Flat array of nVar values per owned point.
+   */
+  void SetZoneSolution(unsigned short iZone, unsigned short iSolver, const vector<passivedouble>& values);
+
   /*!
    * \brief Set the adjoint of the flow tractions (from the extra step -
    * the repeated methods should be unified once the postprocessing strategy is in place).
@@ -30,6 +30,8 @@
 
 #include "CDriver.hpp"
 
+class CParaviewVTMFileWriter;
+
 /*!
  * \class CMultizoneDriver
  * \brief Class for driving zone-specific iterations.
@@ -56,6 +58,16 @@ protected:
 
   bool *prefixed_motion;     /*!< \brief Determines if a fixed motion is imposed in the config file. */
 
+  bool *zone_converged;      /*!< \brief Whether each zone met its convergence criteria at the last outer check. */
+  bool *zone_updated;        /*!< \brief Whether each zone was solved (i.e. its solution may have changed) in its last visit. */
+
+  unsigned long *nInnerIterBase;  /*!< \brief Inner-iteration budget of each zone as given in the config. */
+  su2double *bgs_res_old;         /*!< \brief BGS residual norm of each zone at the previous outer iteration. */
+
+  vector<unsigned short> zone_order;  /*!< \brief Execution order of the Gauss-Seidel sweep, donor zones ahead of their targets. */
+
+  CParaviewVTMFileWriter* vtmWriterShared;  /*!< \brief Multiblock writer shared between the outputs of all zones. */
+
 public:
 
   /*!
@@ -129,6 +141,32 @@ public:
    */
   bool Transfer_Data(unsigned short donorZone, unsigned short targetZone);
 
+  /*!
+   * \brief Check whether the inner solve of a zone can be skipped in the current outer iteration,
+   *        i.e. the zone converged and none of the zones it receives data from was updated.
+   * \param[in] val_iZone - Zone to be checked.
+   * \return Boolean that determines whether the zone solve can be skipped.
+   */
+  bool SkipZoneSolve(unsigned short val_iZone) const;
+
+  /*!
+   * \brief Compute the execution order of the Gauss-Seidel sweep from the coupling graph
+   *        defined by the interfaces, scheduling donor zones ahead of the zones they feed
+   *        so that each solve sees interface data of the current outer iteration. Two-way
+   *        couplings form cycles, broken at the zone with the fewest unresolved donors.
+   */
+  void SetZoneOrder();
+
+  /*!
+   * \brief Adapt the inner-iteration budget of a zone based on the contraction of its BGS residual,
+   *        an Aitken-style prediction of how much the interface data will change in the next outer
+   *        iteration. While the coupling contracts the budget is cut, if it stalls it is restored.
+   * \param[in] val_iZone - Zone to be adapted.
+   * \param[in] res_bgs - Largest BGS residual over the solvers of the zone at the current outer iteration.
+   * \param[in] OuterIter - Current outer iteration.
+   */
+  void AdaptInnerIterations(unsigned short val_iZone, su2double res_bgs, unsigned long OuterIter);
+
   /*!
    * \brief Check if simulation converged and return appropriate boolean.
    * \param[in] TimeIter - Current time iteration.
@@ -40,6 +40,16 @@ protected:
 
   unsigned long TimeIter;
 
+  unsigned short SweepIndex = 0;  /*!< \brief Next entry of the AOA_SWEEP continuation list. */
+
+  /*!
+   * \brief Advance the angle-of-attack continuation sweep to the next angle, if any,
+   *        updating the config and the farfield state in-place so that the solve
+   *        continues from the retained solution.
+   * \return true if a new angle was set and the solver should keep iterating.
+   */
+  bool AdvanceAlphaSweep();
+
 public:
 
   /*!
@@ -62,6 +72,12 @@ public:
    */
   void StartSolver() override;
 
+  /*!
+   * \brief Evaluate the objective function(s) from the restart solution without solving,
+   *        used for frozen-flow finite differences of the objectives (OBJECTIVE_REPLAY).
+   */
+  void ObjectiveReplay();
+
   /*!
    * \brief Preprocess the single-zone iteration
    */
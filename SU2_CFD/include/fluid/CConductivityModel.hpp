@@ -28,6 +28,7 @@
 #pragma once
 
 #include "../../../Common/include/basic_types/datatype_structure.hpp"
+#include "../../../Common/include/parallelization/omp_structure.hpp"
 
 using namespace std;
 
@@ -68,4 +69,22 @@ class CConductivityModel {
    */
   virtual void SetDerConductivity(su2double t, su2double rho, su2double dmudrho_t, su2double dmudt_rho,
                                   su2double cp) = 0;
+
+  /*!
+   * \brief Evaluate the conductivity and its derivatives for a batch of points.
+   * The base implementation loops over the point-wise evaluation, closed-form
+   * models override it with a vectorizable loop.
+   */
+  virtual void ComputeConductivities(unsigned long n_point, const su2double* t, const su2double* rho,
+                                     const su2double* mu_lam, su2double mu_turb, const su2double* cp,
+                                     const su2double* dmudrho_t, const su2double* dmudt_rho, su2double* kt,
+                                     su2double* dktdrho_t, su2double* dktdt_rho) {
+    for (auto i = 0ul; i < n_point; ++i) {
+      SetConductivity(t[i], rho[i], mu_lam[i], mu_turb, cp[i]);
+      kt[i] = GetConductivity();
+      SetDerConductivity(t[i], rho[i], dmudrho_t[i], dmudt_rho[i], cp[i]);
+      dktdrho_t[i] = Getdktdrho_T();
+      dktdt_rho[i] = GetdktdT_rho();
+    }
+  }
 };
@@ -67,6 +67,21 @@ class CConstantConductivity final : public CConductivityModel {
   void SetDerConductivity(su2double t, su2double rho, su2double dmudrho_t, su2double dmudt_rho, su2double cp) override {
   }
 
+  /*!
+   * \brief Evaluate the conductivity and its derivatives for a batch of points.
+   */
+  void ComputeConductivities(unsigned long n_point, const su2double* t, const su2double* rho, const su2double* mu_lam,
+                             su2double mu_turb, const su2double* cp, const su2double* dmudrho_t,
+                             const su2double* dmudt_rho, su2double* kt, su2double* dktdrho_t,
+                             su2double* dktdt_rho) override {
+    SU2_OMP_SIMD
+    for (auto i = 0ul; i < n_point; ++i) {
+      kt[i] = kt_;
+      dktdrho_t[i] = 0.0;
+      dktdt_rho[i] = 0.0;
+    }
+  }
+
  private:
   su2double kt_{0.0};        /*!< \brief Thermal conductivity. */
   su2double dktdrho_t_{0.0}; /*!< \brief DktDrho_T. */
@@ -71,6 +71,29 @@ class CConstantPrandtl final : public CConductivityModel {
     dktdt_rho_ = dmudt_rho * cp / pr_lam_;
   }
 
+  /*!
+   * \brief Evaluate the conductivity and its derivatives for a batch of points.
+   */
+  void ComputeConductivities(unsigned long n_point, const su2double* t, const su2double* rho, const su2double* mu_lam,
+                             su2double mu_turb, const su2double* cp, const su2double* dmudrho_t,
+                             const su2double* dmudt_rho, su2double* kt, su2double* dktdrho_t,
+                             su2double* dktdt_rho) override {
+    const su2double pr_inv = 1.0 / pr_lam_;
+    SU2_OMP_SIMD
+    for (auto i = 0ul; i < n_point; ++i) {
+      kt[i] = mu_lam[i] * cp[i] * pr_inv;
+      dktdrho_t[i] = dmudrho_t[i] * cp[i] * pr_inv;
+      dktdt_rho[i] = dmudt_rho[i] * cp[i] * pr_inv;
+    }
+
+    /*--- Leave the point-wise state consistent with the last point of the batch. ---*/
+    if (n_point > 0) {
+      kt_ = kt[n_point - 1];
+      dktdrho_t_ = dktdrho_t[n_point - 1];
+      dktdt_rho_ = dktdt_rho[n_point - 1];
+    }
+  }
+
  private:
   su2double kt_{0.0};        /*!< \brief Thermal conductivity. */
   su2double dktdrho_t_{0.0}; /*!< \brief DktDrho_T. */
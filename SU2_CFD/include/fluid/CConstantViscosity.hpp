@@ -61,6 +61,19 @@ class CConstantViscosity final : public CViscosityModel {
    */
   void SetViscosity(su2double t, su2double rho) override {}
 
+  /*!
+   * \brief Evaluate the viscosity and its derivatives for a batch of points.
+   */
+  void ComputeViscosities(unsigned long n_point, const su2double* t, const su2double* rho, su2double* mu,
+                          su2double* dmudrho_t, su2double* dmudt_rho) override {
+    SU2_OMP_SIMD
+    for (auto i = 0ul; i < n_point; ++i) {
+      mu[i] = mu_;
+      dmudrho_t[i] = 0.0;
+      dmudt_rho[i] = 0.0;
+    }
+  }
+
   /*!
    * \brief Set Viscosity Derivatives.
    */
@@ -227,6 +227,71 @@ class CFluidModel {
    */
   virtual void SetTDState_rhoe(su2double rho, su2double e) {}
 
+  /*!
+   * \brief Compute the thermodynamic state of a batch of points from ("e, rho").
+   * The base implementation loops over the point-wise evaluation, models with
+   * cheap closed-form states can override it with a vectorizable array loop.
+   * \param[in] val_nPoint - number of points in the batch.
+   * \param[in] val_rho - densities of the points.
+   * \param[in] val_e - static energies of the points.
+   * \param[out] val_pressure - pressures of the points.
+   * \param[out] val_temperature - temperatures of the points.
+   * \param[out] val_soundspeed2 - squared speeds of sound of the points.
+   * \param[out] val_dPdrho_e - pressure derivatives w.r.t. density of the points.
+   * \param[out] val_dPde_rho - pressure derivatives w.r.t. static energy of the points.
+   */
+  virtual void ComputeTDState_rhoe(unsigned long val_nPoint, const su2double* val_rho, const su2double* val_e,
+                                   su2double* val_pressure, su2double* val_temperature, su2double* val_soundspeed2,
+                                   su2double* val_dPdrho_e, su2double* val_dPde_rho) {
+    for (auto iPoint = 0ul; iPoint < val_nPoint; ++iPoint) {
+      SetTDState_rhoe(val_rho[iPoint], val_e[iPoint]);
+      val_pressure[iPoint] = Pressure;
+      val_temperature[iPoint] = Temperature;
+      val_soundspeed2[iPoint] = SoundSpeed2;
+      val_dPdrho_e[iPoint] = dPdrho_e;
+      val_dPde_rho[iPoint] = dPde_rho;
+    }
+  }
+
+  /*!
+   * \brief Compute the transport properties and their derivatives for a batch
+   * of points whose thermodynamic state is given by ("e, rho"), see
+   * ComputeTDState_rhoe. The base implementation loops over the point-wise
+   * evaluation, models with closed-form states can override it to forward the
+   * batch to the viscosity and conductivity sub-models.
+   * \param[in] val_nPoint - number of points in the batch.
+   * \param[in] val_rho - densities of the points.
+   * \param[in] val_e - static energies of the points.
+   * \param[in] val_temperature - temperatures of the points.
+   * \param[out] val_mu - laminar viscosities of the points.
+   * \param[out] val_dmudrho_T - viscosity derivatives w.r.t. density of the points.
+   * \param[out] val_dmudT_rho - viscosity derivatives w.r.t. temperature of the points.
+   * \param[out] val_kt - thermal conductivities of the points.
+   * \param[out] val_dktdrho_T - conductivity derivatives w.r.t. density of the points.
+   * \param[out] val_dktdT_rho - conductivity derivatives w.r.t. temperature of the points.
+   * \param[out] val_cp - specific heats at constant pressure of the points.
+   * \param[out] val_dTdrho_e - temperature derivatives w.r.t. density of the points.
+   * \param[out] val_dTde_rho - temperature derivatives w.r.t. static energy of the points.
+   */
+  virtual void ComputeTransport_rhoe(unsigned long val_nPoint, const su2double* val_rho, const su2double* val_e,
+                                     const su2double* val_temperature, su2double* val_mu, su2double* val_dmudrho_T,
+                                     su2double* val_dmudT_rho, su2double* val_kt, su2double* val_dktdrho_T,
+                                     su2double* val_dktdT_rho, su2double* val_cp, su2double* val_dTdrho_e,
+                                     su2double* val_dTde_rho) {
+    for (auto iPoint = 0ul; iPoint < val_nPoint; ++iPoint) {
+      SetTDState_rhoe(val_rho[iPoint], val_e[iPoint]);
+      val_mu[iPoint] = GetLaminarViscosity();
+      val_dmudrho_T[iPoint] = Getdmudrho_T();
+      val_dmudT_rho[iPoint] = GetdmudT_rho();
+      val_kt[iPoint] = GetThermalConductivity();
+      val_dktdrho_T[iPoint] = Getdktdrho_T();
+      val_dktdT_rho[iPoint] = GetdktdT_rho();
+      val_cp[iPoint] = Cp;
+      val_dTdrho_e[iPoint] = dTdrho_e;
+      val_dTde_rho[iPoint] = dTde_rho;
+    }
+  }
+
   /*!
    * \brief virtual member that would be different for each gas model implemented
    * \param[in] InputSpec - Input pair for FLP calls ("PT").
@@ -54,6 +54,46 @@ class CIdealGas : public CFluidModel {
    */
   void SetTDState_rhoe(su2double rho, su2double e) override;
 
+  /*!
+   * \brief Set the Dimensionless State of a batch of points using Density and Internal Energy,
+   * the closed-form ideal gas relations allow the compiler to vectorize the loop.
+   * \param[in] val_nPoint - number of points in the batch.
+   * \param[in] val_rho - densities of the points.
+   * \param[in] val_e - static energies of the points.
+   * \param[out] val_pressure - pressures of the points.
+   * \param[out] val_temperature - temperatures of the points.
+   * \param[out] val_soundspeed2 - squared speeds of sound of the points.
+   * \param[out] val_dPdrho_e - pressure derivatives w.r.t. density of the points.
+   * \param[out] val_dPde_rho - pressure derivatives w.r.t. static energy of the points.
+   */
+  void ComputeTDState_rhoe(unsigned long val_nPoint, const su2double* val_rho, const su2double* val_e,
+                           su2double* val_pressure, su2double* val_temperature, su2double* val_soundspeed2,
+                           su2double* val_dPdrho_e, su2double* val_dPde_rho) override;
+
+  /*!
+   * \brief Compute the transport properties and their derivatives for a batch of points,
+   * forwarding the batch to the viscosity and conductivity sub-models. The specific heat
+   * and the temperature derivatives are closed-form for an ideal gas.
+   * \param[in] val_nPoint - number of points in the batch.
+   * \param[in] val_rho - densities of the points.
+   * \param[in] val_e - static energies of the points.
+   * \param[in] val_temperature - temperatures of the points.
+   * \param[out] val_mu - laminar viscosities of the points.
+   * \param[out] val_dmudrho_T - viscosity derivatives w.r.t. density of the points.
+   * \param[out] val_dmudT_rho - viscosity derivatives w.r.t. temperature of the points.
+   * \param[out] val_kt - thermal conductivities of the points.
+   * \param[out] val_dktdrho_T - conductivity derivatives w.r.t. density of the points.
+   * \param[out] val_dktdT_rho - conductivity derivatives w.r.t. temperature of the points.
+   * \param[out] val_cp - specific heats at constant pressure of the points.
+   * \param[out] val_dTdrho_e - temperature derivatives w.r.t. density of the points.
+   * \param[out] val_dTde_rho - temperature derivatives w.r.t. static energy of the points.
+   */
+  void ComputeTransport_rhoe(unsigned long val_nPoint, const su2double* val_rho, const su2double* val_e,
+                             const su2double* val_temperature, su2double* val_mu, su2double* val_dmudrho_T,
+                             su2double* val_dmudT_rho, su2double* val_kt, su2double* val_dktdrho_T,
+                             su2double* val_dktdT_rho, su2double* val_cp, su2double* val_dTdrho_e,
+                             su2double* val_dTde_rho) override;
+
   /*!
    * \brief Set the Dimensionless State using Pressure  and Temperature
    * \param[in] P - first thermodynamic variable.
@@ -47,6 +47,7 @@ private:
 
   vector<su2double>
   ArrheniusCoefficient,             /*!< \brief Arrhenius reaction coefficient */
+  LogArrheniusCoefficient,          /*!< \brief Natural log of the Arrhenius coefficient, for log-space rate evaluation */
   ArrheniusEta,                     /*!< \brief Arrhenius reaction temperature exponent */
   ArrheniusTheta,                   /*!< \brief Arrhenius reaction characteristic temperature */
   CharVibTemp,                      /*!< \brief Characteristic vibrational temperature for e_vib */
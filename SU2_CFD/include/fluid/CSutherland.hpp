@@ -75,6 +75,29 @@ class CSutherland final : public CViscosityModel {
     dmudt_rho_ = mu_ref_ * (t_ref_ + s_) * ts_inv * sqrt(t_nondim) * (1.5 * t_ref_inv - t_nondim * ts_inv);
   }
 
+  /*!
+   * \brief Evaluate the viscosity and its derivatives for a batch of points.
+   */
+  void ComputeViscosities(unsigned long n_point, const su2double* t, const su2double* rho, su2double* mu,
+                          su2double* dmudrho_t, su2double* dmudt_rho) override {
+    const su2double t_ref_inv = 1.0 / t_ref_;
+    SU2_OMP_SIMD
+    for (auto i = 0ul; i < n_point; ++i) {
+      const su2double t_nondim = t_ref_inv * t[i];
+      const su2double ts_inv = 1.0 / (t[i] + s_);
+      const su2double sqrt_t = sqrt(t_nondim);
+      mu[i] = mu_ref_ * t_nondim * sqrt_t * (t_ref_ + s_) * ts_inv;
+      dmudrho_t[i] = 0.0;
+      dmudt_rho[i] = mu_ref_ * (t_ref_ + s_) * ts_inv * sqrt_t * (1.5 * t_ref_inv - t_nondim * ts_inv);
+    }
+
+    /*--- Leave the point-wise state consistent with the last point of the batch. ---*/
+    if (n_point > 0) {
+      SetViscosity(t[n_point - 1], rho[n_point - 1]);
+      SetDerViscosity(t[n_point - 1], rho[n_point - 1]);
+    }
+  }
+
  private:
   su2double mu_{0.0};        /*!< \brief Dynamic viscosity. */
   su2double dmudrho_t_{0.0}; /*!< \brief DmuDrho_T. */
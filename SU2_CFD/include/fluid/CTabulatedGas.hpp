@@ -0,0 +1,190 @@
+/*!
+ * \file CTabulatedGas.hpp
+ * \brief Defines a tabulated evaluation of an underlying fluid model.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "CFluidModel.hpp"
+
+/*!
+ * \class CTabulatedGas
+ * \brief Child class that replaces the (rho, e) state evaluation of any other
+ * fluid model by bilinear interpolation in a structured table sampled at startup.
+ * The table avoids the iterative equation-of-state inversions of the real gas
+ * models (CVanDerWaalsGas, CPengRobinson) in the per-point primitive update,
+ * which dominates the cost of real gas simulations. States outside the table
+ * range, and all non-(rho, e) calls (boundary conditions, initialization),
+ * fall through to the exact base model.
+ */
+class CTabulatedGas final : public CFluidModel {
+ protected:
+  unique_ptr<CFluidModel> BaseModel; /*!< \brief Model the table is sampled from. */
+
+  su2double Density_Min{0.0};  /*!< \brief Smallest density covered by the table. */
+  su2double Density_Max{0.0};  /*!< \brief Largest density covered by the table. */
+  su2double Energy_Min{0.0};   /*!< \brief Smallest static energy covered by the table. */
+  su2double Energy_Max{0.0};   /*!< \brief Largest static energy covered by the table. */
+  su2double DeltaDensity{0.0}; /*!< \brief Density spacing of the table nodes. */
+  su2double DeltaEnergy{0.0};  /*!< \brief Static energy spacing of the table nodes. */
+  unsigned long nDensity{0};   /*!< \brief Number of table nodes in the density direction. */
+  unsigned long nEnergy{0};    /*!< \brief Number of table nodes in the static energy direction. */
+
+  /*--- Structure-of-arrays storage of the table nodes, one contiguous array per
+   property (density index fastest) so that evaluating a batch of points is a
+   series of independent, vectorizable interpolations. ---*/
+  vector<su2double> Table_Pressure;    /*!< \brief Pressure at the table nodes. */
+  vector<su2double> Table_Temperature; /*!< \brief Temperature at the table nodes. */
+  vector<su2double> Table_SoundSpeed2; /*!< \brief Squared speed of sound at the table nodes. */
+  vector<su2double> Table_dPdrho_e;    /*!< \brief dP/drho at the table nodes. */
+  vector<su2double> Table_dPde_rho;    /*!< \brief dP/de at the table nodes. */
+  vector<su2double> Table_dTdrho_e;    /*!< \brief dT/drho at the table nodes. */
+  vector<su2double> Table_dTde_rho;    /*!< \brief dT/de at the table nodes. */
+  vector<su2double> Table_Entropy;     /*!< \brief Entropy at the table nodes. */
+
+  /*!
+   * \brief Whether a state falls inside the range covered by the table.
+   */
+  bool InRange(su2double rho, su2double e) const {
+    return (rho >= Density_Min) && (rho <= Density_Max) && (e >= Energy_Min) && (e <= Energy_Max);
+  }
+
+  /*!
+   * \brief Bilinear interpolation of one property array at an in-range state.
+   */
+  su2double Interpolate(const vector<su2double>& table, unsigned long i, unsigned long j,
+                        su2double wRho, su2double wEnergy) const {
+    const su2double* row0 = &table[j * nDensity + i];
+    const su2double* row1 = row0 + nDensity;
+    return (1.0 - wEnergy) * ((1.0 - wRho) * row0[0] + wRho * row0[1]) +
+           wEnergy * ((1.0 - wRho) * row1[0] + wRho * row1[1]);
+  }
+
+  /*!
+   * \brief Lower node index and interpolation weight of a coordinate.
+   */
+  static void GetCell(su2double val, su2double valMin, su2double delta, unsigned long nNodes,
+                      unsigned long& index, su2double& weight) {
+    su2double cell = (val - valMin) / delta;
+    if (cell < 0.0) cell = 0.0;
+    index = static_cast<unsigned long>(cell);
+    if (index > nNodes - 2) index = nNodes - 2;
+    weight = cell - index;
+  }
+
+  /*!
+   * \brief Copy the state of the base model into this model after a delegated call.
+   */
+  void CopyStateFromBase();
+
+ public:
+  /*!
+   * \brief Constructor of the class, samples the base model on the table nodes.
+   * \param[in] val_baseModel - Model to tabulate, the table takes ownership of it.
+   * \param[in] val_rhoMin - Smallest density covered by the table.
+   * \param[in] val_rhoMax - Largest density covered by the table.
+   * \param[in] val_eMin - Smallest static energy covered by the table.
+   * \param[in] val_eMax - Largest static energy covered by the table.
+   * \param[in] val_nPoints - Number of table nodes per direction.
+   */
+  CTabulatedGas(CFluidModel* val_baseModel, su2double val_rhoMin, su2double val_rhoMax,
+                su2double val_eMin, su2double val_eMax, unsigned short val_nPoints);
+
+  /*!
+   * \brief Set the Dimensionless State using Density and Internal Energy,
+   * interpolated from the table (exact base model outside the table range).
+   * \param[in] rho - first thermodynamic variable.
+   * \param[in] e - second thermodynamic variable.
+   */
+  void SetTDState_rhoe(su2double rho, su2double e) override;
+
+  /*!
+   * \brief Set the Dimensionless State of a batch of points using Density and Internal
+   * Energy, a vectorizable interpolation loop with a scalar clean-up pass for the
+   * points outside the table range.
+   * \param[in] val_nPoint - number of points in the batch.
+   * \param[in] val_rho - densities of the points.
+   * \param[in] val_e - static energies of the points.
+   * \param[out] val_pressure - pressures of the points.
+   * \param[out] val_temperature - temperatures of the points.
+   * \param[out] val_soundspeed2 - squared speeds of sound of the points.
+   * \param[out] val_dPdrho_e - pressure derivatives w.r.t. density of the points.
+   * \param[out] val_dPde_rho - pressure derivatives w.r.t. static energy of the points.
+   */
+  void ComputeTDState_rhoe(unsigned long val_nPoint, const su2double* val_rho, const su2double* val_e,
+                           su2double* val_pressure, su2double* val_temperature, su2double* val_soundspeed2,
+                           su2double* val_dPdrho_e, su2double* val_dPde_rho) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Temperature (delegated to the base model).
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] T - second thermodynamic variable.
+   */
+  void SetTDState_PT(su2double P, su2double T) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Density (delegated to the base model).
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void SetTDState_Prho(su2double P, su2double rho) override;
+
+  /*!
+   * \brief Set the Dimensionless Internal Energy using Pressure and Density (delegated to the base model).
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void SetEnergy_Prho(su2double P, su2double rho) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Enthalpy and Entropy (delegated to the base model).
+   * \param[in] h - first thermodynamic variable (h).
+   * \param[in] s - second thermodynamic variable (s).
+   */
+  void SetTDState_hs(su2double h, su2double s) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Density and Temperature (delegated to the base model).
+   * \param[in] rho - first thermodynamic variable (rho).
+   * \param[in] T - second thermodynamic variable (T).
+   */
+  void SetTDState_rhoT(su2double rho, su2double T) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Entropy (delegated to the base model).
+   * \param[in] P - first thermodynamic variable (P).
+   * \param[in] s - second thermodynamic variable (s).
+   */
+  void SetTDState_Ps(su2double P, su2double s) override;
+
+  /*!
+   * \brief Compute derivatives of enthalpy and entropy needed for subsonic inflow BC
+   * (delegated to the base model).
+   * \param[in] P - first thermodynamic variable (P).
+   * \param[in] rho - second thermodynamic variable (rho).
+   */
+  void ComputeDerivativeNRBC_Prho(su2double P, su2double rho) override;
+};
@@ -28,6 +28,7 @@
 #pragma once
 
 #include "../../../Common/include/basic_types/datatype_structure.hpp"
+#include "../../../Common/include/parallelization/omp_structure.hpp"
 
 using namespace std;
 
@@ -67,4 +68,20 @@ class CViscosityModel {
    * \brief Set Viscosity Derivatives.
    */
   virtual void SetDerViscosity(su2double t, su2double rho) = 0;
+
+  /*!
+   * \brief Evaluate the viscosity and its derivatives for a batch of points.
+   * The base implementation loops over the point-wise evaluation, closed-form
+   * models override it with a vectorizable loop.
+   */
+  virtual void ComputeViscosities(unsigned long n_point, const su2double* t, const su2double* rho, su2double* mu,
+                                  su2double* dmudrho_t, su2double* dmudt_rho) {
+    for (auto i = 0ul; i < n_point; ++i) {
+      SetViscosity(t[i], rho[i]);
+      mu[i] = GetViscosity();
+      SetDerViscosity(t[i], rho[i]);
+      dmudrho_t[i] = Getdmudrho_T();
+      dmudt_rho[i] = GetdmudT_rho();
+    }
+  }
 };
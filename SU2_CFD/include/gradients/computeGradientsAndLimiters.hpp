@@ -0,0 +1,304 @@
+/*!
+ * \file computeGradientsAndLimiters.hpp
+ * \brief Fused computation of Green-Gauss gradients and limiters.
+ * \note This kernel merges computeGradientsGreenGauss.hpp and
+ *       computeLimiters_impl.hpp into a single sweep over the grid
+ *       points, reading the field (and the coordinates) once instead
+ *       of twice, and exchanging gradients and limiters with a single
+ *       halo communication. It must be included after those two files
+ *       (no include guards, see e.g. CFVMFlowSolverBase.inl).
+ * \author P. Gomes
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+namespace detail {
+
+/*!
+ * \brief Compute Green-Gauss gradients and a point-based limiter of a field
+ *        in one sweep over the grid points.
+ * \note The caller is responsible for falling back to the separate kernels
+ *       when fusion is not possible: periodic boundaries require intermediate
+ *       communications, and a frozen limiter (discrete adjoint) cannot be made
+ *       passive without also freezing the gradient.
+ *       See the non-fused implementations for the documentation of the
+ *       arguments and template parameters, "kindMpiComm" here must identify a
+ *       quantity that packs the gradient and the limiter together.
+ */
+template<size_t nDim, ENUM_LIMITER LimiterKind, class FieldType, class GradientType>
+void computeGradientsAndLimiters(CSolver* solver,
+                                 MPI_QUANTITIES kindMpiComm,
+                                 CGeometry& geometry,
+                                 const CConfig& config,
+                                 size_t varBegin,
+                                 size_t varEnd,
+                                 const FieldType& field,
+                                 GradientType& gradient,
+                                 FieldType& fieldMin,
+                                 FieldType& fieldMax,
+                                 FieldType& limiter)
+{
+  constexpr size_t MAXNVAR = 32;
+
+  if (varEnd > MAXNVAR)
+    SU2_MPI::Error("Number of variables is too large, increase MAXNVAR.", CURRENT_FUNCTION);
+
+  const size_t nPointDomain = geometry.GetnPointDomain();
+
+#ifdef HAVE_OMP
+  constexpr size_t OMP_MAX_CHUNK = 512;
+
+  const auto chunkSize = computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_CHUNK);
+#endif
+
+  CLimiterDetails<LimiterKind> limiterDetails;
+
+  limiterDetails.preprocess(geometry, config, varBegin, varEnd, field);
+
+  /*--- For each (non-halo) volume integrate over its faces (edges),
+   *    then limit the resulting gradient. ---*/
+
+  SU2_OMP_FOR_DYN(chunkSize)
+  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  {
+    auto nodes = geometry.nodes;
+    const auto coord_i = nodes->GetCoord(iPoint);
+
+    /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
+    if (omp_get_num_threads() == 1) AD::StartPreacc();
+    AD::SetPreaccIn(coord_i, nDim);
+    AD::SetPreaccIn(nodes->GetVolume(iPoint));
+    AD::SetPreaccIn(nodes->GetPeriodicVolume(iPoint));
+
+    /*--- Clear the gradient and initialize the min/max values. --*/
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+    {
+      AD::SetPreaccIn(field(iPoint,iVar));
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        gradient(iPoint, iVar, iDim) = 0.0;
+
+      fieldMax(iPoint,iVar) = field(iPoint,iVar);
+      fieldMin(iPoint,iVar) = field(iPoint,iVar);
+    }
+
+    /*--- Handle averaging and division by volume in one constant. ---*/
+
+    su2double volume = nodes->GetVolume(iPoint) + nodes->GetPeriodicVolume(iPoint);
+    su2double halfOnVol = 0.5 / volume;
+
+    /*--- Add a contribution due to each neighbor, track the min/max
+     *    field values over the neighbors in the same sweep. ---*/
+
+    for (size_t iNeigh = 0; iNeigh < nodes->GetnPoint(iPoint); ++iNeigh)
+    {
+      size_t iEdge = nodes->GetEdge(iPoint,iNeigh);
+      size_t jPoint = nodes->GetPoint(iPoint,iNeigh);
+
+      /*--- Determine if edge points inwards or outwards of iPoint.
+       *    If inwards we need to flip the area vector. ---*/
+
+      su2double dir = (iPoint < jPoint)? 1.0 : -1.0;
+      su2double weight = dir * halfOnVol;
+
+      const auto area = geometry.edges->GetNormal(iEdge);
+      AD::SetPreaccIn(area, nDim);
+      AD::SetPreaccIn(nodes->GetCoord(jPoint), nDim);
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      {
+        AD::SetPreaccIn(field(jPoint,iVar));
+
+        su2double flux = weight * (field(iPoint,iVar) + field(jPoint,iVar));
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          gradient(iPoint, iVar, iDim) += flux * area[iDim];
+
+        fieldMax(iPoint,iVar) = max(fieldMax(iPoint,iVar), field(jPoint,iVar));
+        fieldMin(iPoint,iVar) = min(fieldMin(iPoint,iVar), field(jPoint,iVar));
+      }
+    }
+
+    /*--- Add boundary fluxes, same markers as the boundary
+     *    loop of the non-fused version. ---*/
+
+    if (nodes->GetBoundary(iPoint))
+    {
+      for (size_t iMarker = 0; iMarker < geometry.GetnMarker(); ++iMarker)
+      {
+        if ((config.GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
+            (config.GetMarker_All_KindBC(iMarker) != NEARFIELD_BOUNDARY) &&
+            (config.GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY) &&
+            (config.GetMarker_All_KindBC(iMarker) != SEND_RECEIVE))
+        {
+          const long iVertex = nodes->GetVertex(iPoint, iMarker);
+          if (iVertex < 0) continue;
+
+          const auto area = geometry.vertex[iMarker][iVertex]->GetNormal();
+          AD::SetPreaccIn(area, nDim);
+
+          for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+          {
+            su2double flux = field(iPoint,iVar) / volume;
+
+            for (size_t iDim = 0; iDim < nDim; ++iDim)
+              gradient(iPoint, iVar, iDim) -= flux * area[iDim];
+          }
+        }
+      }
+    }
+
+    /*--- The gradient of iPoint is now complete, compute the min/max
+     *    projections in a second pass over the neighbors (whose data
+     *    is still in cache). ---*/
+
+    su2double projMax[MAXNVAR], projMin[MAXNVAR];
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      projMax[iVar] = projMin[iVar] = 0.0;
+
+    for (auto jPoint : nodes->GetPoints(iPoint))
+    {
+      const auto coord_j = nodes->GetCoord(jPoint);
+
+      /*--- Distance vector from iPoint to face (middle of the edge). ---*/
+
+      su2double dist_ij[nDim] = {0.0};
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        dist_ij[iDim] = 0.5 * (coord_j[iDim] - coord_i[iDim]);
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      {
+        su2double proj = 0.0;
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          proj += dist_ij[iDim] * gradient(iPoint,iVar,iDim);
+
+        projMax[iVar] = max(projMax[iVar], proj);
+        projMin[iVar] = min(projMin[iVar], proj);
+      }
+    }
+
+    /*--- Compute the geometric factor. ---*/
+
+    su2double geoFactor = limiterDetails.geometricFactor(iPoint, geometry);
+
+    /*--- Final limiter computation for each variable, get the min limiter
+     *    out of the positive/negative projections and deltas. ---*/
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+    {
+      su2double limMax = limiterDetails.limiterFunction(iVar, projMax[iVar],
+                         fieldMax(iPoint,iVar) - field(iPoint,iVar));
+
+      su2double limMin = limiterDetails.limiterFunction(iVar, projMin[iVar],
+                         fieldMin(iPoint,iVar) - field(iPoint,iVar));
+
+      limiter(iPoint,iVar) = geoFactor * min(limMax, limMin);
+
+      AD::SetPreaccOut(limiter(iPoint,iVar));
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        AD::SetPreaccOut(gradient(iPoint,iVar,iDim));
+    }
+
+    AD::EndPreacc();
+  }
+  END_SU2_OMP_FOR
+
+  /*--- If no solver was provided we do not communicate. ---*/
+
+  if (solver == nullptr) return;
+
+  /*--- Obtain the gradients and limiters at halo points from the
+   *    MPI ranks that own them, in a single exchange. ---*/
+
+  solver->InitiateComms(&geometry, &config, kindMpiComm);
+  solver->CompleteComms(&geometry, &config, kindMpiComm);
+
+}
+} // end namespace
+
+/*!
+ * \brief Instantiations for 2D and 3D and for each point-based limiter.
+ */
+template<class FieldType, class GradientType>
+void computeGradientsAndLimiters(ENUM_LIMITER LimiterKind,
+                                 CSolver* solver,
+                                 MPI_QUANTITIES kindMpiComm,
+                                 CGeometry& geometry,
+                                 const CConfig& config,
+                                 size_t varBegin,
+                                 size_t varEnd,
+                                 const FieldType& field,
+                                 GradientType& gradient,
+                                 FieldType& fieldMin,
+                                 FieldType& fieldMax,
+                                 FieldType& limiter)
+{
+  if (geometry.GetnDim() != 2 && geometry.GetnDim() != 3)
+    SU2_MPI::Error("Too many dimensions to compute gradients and limiters.", CURRENT_FUNCTION);
+
+#define INSTANTIATE(KIND)\
+if (geometry.GetnDim() == 2) {\
+  detail::computeGradientsAndLimiters<2,KIND>(solver, kindMpiComm, geometry, config, varBegin,\
+                                              varEnd, field, gradient, fieldMin, fieldMax, limiter);\
+} else {\
+  detail::computeGradientsAndLimiters<3,KIND>(solver, kindMpiComm, geometry, config, varBegin,\
+                                              varEnd, field, gradient, fieldMin, fieldMax, limiter);\
+}
+  switch (LimiterKind) {
+    case BARTH_JESPERSEN:
+    {
+      INSTANTIATE(BARTH_JESPERSEN);
+      break;
+    }
+    case VENKATAKRISHNAN:
+    {
+      INSTANTIATE(VENKATAKRISHNAN);
+      break;
+    }
+    case VENKATAKRISHNAN_WANG:
+    {
+      INSTANTIATE(VENKATAKRISHNAN_WANG);
+      break;
+    }
+    case WALL_DISTANCE:
+    {
+      INSTANTIATE(WALL_DISTANCE);
+      break;
+    }
+    case SHARP_EDGES:
+    {
+      INSTANTIATE(SHARP_EDGES);
+      break;
+    }
+    default:
+    {
+      SU2_MPI::Error("The limiter is not compatible with the fused computation.", CURRENT_FUNCTION);
+      break;
+    }
+  }
+#undef INSTANTIATE
+}
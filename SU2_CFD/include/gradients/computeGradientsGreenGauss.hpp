@@ -31,6 +31,96 @@
 
 namespace detail {
 
+/*!
+ * \brief Edge-based reducer strategy for the interior contributions of the
+ *        Green-Gauss gradients, analogous to the edge-flux reducer of the
+ *        flow solvers.
+ * \note The plain nodal gather visits every edge from both of its end points
+ *       and recomputes the face average twice, which on wide thread counts
+ *       makes the loop memory-bound. Here a first conflict-free pass over the
+ *       edges stores the averages, the nodal gather then only streams them.
+ *       No AD preaccumulation is performed, the strategy targets hybrid
+ *       parallel runs where preaccumulation is disabled anyway.
+ */
+template<size_t nDim, class FieldType, class GradientType>
+void computeGradientsGreenGaussReducer(CGeometry& geometry,
+                                       const FieldType& field,
+                                       size_t varBegin,
+                                       size_t varEnd,
+                                       GradientType& gradient)
+{
+  const size_t nPointDomain = geometry.GetnPointDomain();
+  const size_t nEdge = geometry.GetnEdge();
+  const size_t nVarTot = varEnd - varBegin;
+
+  /*--- Shared workspace for the per-edge averages, grown on demand and kept
+   across calls like the other communication-sized buffers. ---*/
+
+  static vector<su2double> edgeAvg;
+
+  SU2_OMP_MASTER {
+    if (edgeAvg.size() < nEdge*nVarTot) edgeAvg.resize(nEdge*nVarTot);
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+#ifdef HAVE_OMP
+  constexpr size_t OMP_MAX_CHUNK = 512;
+
+  const auto edgeChunk = computeStaticChunkSize(nEdge, omp_get_max_threads(), OMP_MAX_CHUNK);
+  const auto chunkSize = computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_CHUNK);
+#endif
+
+  /*--- First pass, store the average of the field over each edge. ---*/
+
+  SU2_OMP_FOR_STAT(edgeChunk)
+  for (size_t iEdge = 0; iEdge < nEdge; ++iEdge)
+  {
+    const size_t iPoint = geometry.edges->GetNode(iEdge,0);
+    const size_t jPoint = geometry.edges->GetNode(iEdge,1);
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      edgeAvg[iEdge*nVarTot + (iVar-varBegin)] = 0.5 * (field(iPoint,iVar) + field(jPoint,iVar));
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Second pass, gather the stored averages into the nodal gradients. ---*/
+
+  SU2_OMP_FOR_DYN(chunkSize)
+  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  {
+    auto nodes = geometry.nodes;
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        gradient(iPoint, iVar, iDim) = 0.0;
+
+    const su2double oneOnVol = 1.0 / (nodes->GetVolume(iPoint)+nodes->GetPeriodicVolume(iPoint));
+
+    for (size_t iNeigh = 0; iNeigh < nodes->GetnPoint(iPoint); ++iNeigh)
+    {
+      size_t iEdge = nodes->GetEdge(iPoint,iNeigh);
+      size_t jPoint = nodes->GetPoint(iPoint,iNeigh);
+
+      /*--- The edge average already carries the factor 1/2, the direction
+       of the edge decides the sign of the contribution. ---*/
+
+      su2double weight = (iPoint < jPoint)? oneOnVol : -oneOnVol;
+
+      const auto area = geometry.edges->GetNormal(iEdge);
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      {
+        su2double flux = weight * edgeAvg[iEdge*nVarTot + (iVar-varBegin)];
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          gradient(iPoint, iVar, iDim) += flux * area[iDim];
+      }
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
 /*!
  * \brief Compute the gradient of a field using the Green-Gauss theorem.
  * \note Template nDim to allow efficient unrolling of inner loops.
@@ -69,66 +159,76 @@ void computeGradientsGreenGauss(CSolver* solver,
   const auto chunkSize = computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_CHUNK);
 #endif
 
-  /*--- For each (non-halo) volume integrate over its faces (edges). ---*/
-
-  SU2_OMP_FOR_DYN(chunkSize)
-  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
-  {
-    auto nodes = geometry.nodes;
+  /*--- For each (non-halo) volume integrate over its faces (edges). The
+   reducer strategy stores the per-edge averages in a first conflict-free
+   pass instead of recomputing them for both end points. ---*/
 
-    /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
-    if (omp_get_num_threads() == 1) AD::StartPreacc();
-    AD::SetPreaccIn(nodes->GetVolume(iPoint));
-    AD::SetPreaccIn(nodes->GetPeriodicVolume(iPoint));
+  if (config.GetGradient_ReducerStrategy()) {
 
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-      AD::SetPreaccIn(field(iPoint,iVar));
+    computeGradientsGreenGaussReducer<nDim>(geometry, field, varBegin, varEnd, gradient);
 
-    /*--- Clear the gradient. --*/
+  } else {
 
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-      for (size_t iDim = 0; iDim < nDim; ++iDim)
-        gradient(iPoint, iVar, iDim) = 0.0;
+    SU2_OMP_FOR_DYN(chunkSize)
+    for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+    {
+      auto nodes = geometry.nodes;
 
-    /*--- Handle averaging and division by volume in one constant. ---*/
+      /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
+      if (omp_get_num_threads() == 1) AD::StartPreacc();
+      AD::SetPreaccIn(nodes->GetVolume(iPoint));
+      AD::SetPreaccIn(nodes->GetPeriodicVolume(iPoint));
 
-    su2double halfOnVol = 0.5 / (nodes->GetVolume(iPoint)+nodes->GetPeriodicVolume(iPoint));
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        AD::SetPreaccIn(field(iPoint,iVar));
 
-    /*--- Add a contribution due to each neighbor. ---*/
+      /*--- Clear the gradient. --*/
 
-    for (size_t iNeigh = 0; iNeigh < nodes->GetnPoint(iPoint); ++iNeigh)
-    {
-      size_t iEdge = nodes->GetEdge(iPoint,iNeigh);
-      size_t jPoint = nodes->GetPoint(iPoint,iNeigh);
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          gradient(iPoint, iVar, iDim) = 0.0;
 
-      /*--- Determine if edge points inwards or outwards of iPoint.
-       *    If inwards we need to flip the area vector. ---*/
+      /*--- Handle averaging and division by volume in one constant. ---*/
 
-      su2double dir = (iPoint < jPoint)? 1.0 : -1.0;
-      su2double weight = dir * halfOnVol;
+      su2double halfOnVol = 0.5 / (nodes->GetVolume(iPoint)+nodes->GetPeriodicVolume(iPoint));
 
-      const auto area = geometry.edges->GetNormal(iEdge);
-      AD::SetPreaccIn(area, nDim);
+      /*--- Add a contribution due to each neighbor. ---*/
 
-      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      for (size_t iNeigh = 0; iNeigh < nodes->GetnPoint(iPoint); ++iNeigh)
       {
-        AD::SetPreaccIn(field(jPoint,iVar));
+        size_t iEdge = nodes->GetEdge(iPoint,iNeigh);
+        size_t jPoint = nodes->GetPoint(iPoint,iNeigh);
 
-        su2double flux = weight * (field(iPoint,iVar) + field(jPoint,iVar));
+        /*--- Determine if edge points inwards or outwards of iPoint.
+         *    If inwards we need to flip the area vector. ---*/
+
+        su2double dir = (iPoint < jPoint)? 1.0 : -1.0;
+        su2double weight = dir * halfOnVol;
+
+        const auto area = geometry.edges->GetNormal(iEdge);
+        AD::SetPreaccIn(area, nDim);
+
+        for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        {
+          AD::SetPreaccIn(field(jPoint,iVar));
+
+          su2double flux = weight * (field(iPoint,iVar) + field(jPoint,iVar));
+
+          for (size_t iDim = 0; iDim < nDim; ++iDim)
+            gradient(iPoint, iVar, iDim) += flux * area[iDim];
+        }
 
-        for (size_t iDim = 0; iDim < nDim; ++iDim)
-          gradient(iPoint, iVar, iDim) += flux * area[iDim];
       }
 
-    }
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          AD::SetPreaccOut(gradient(iPoint,iVar,iDim));
 
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-      for (size_t iDim = 0; iDim < nDim; ++iDim)
-        AD::SetPreaccOut(gradient(iPoint,iVar,iDim));
+      AD::EndPreacc();
+    }
+    END_SU2_OMP_FOR
 
-    AD::EndPreacc();
   }
-  END_SU2_OMP_FOR
 
   /*--- Add boundary fluxes. ---*/
 
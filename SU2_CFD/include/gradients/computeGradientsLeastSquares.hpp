@@ -28,6 +28,7 @@
 
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../../Common/include/containers/container_decorators.hpp"
 
 namespace detail {
 
@@ -60,17 +61,44 @@ FORCEINLINE void computeSmatrix(su2double r11, su2double r12, su2double r13,
   Smatrix[2][2] = (z33*z33)/detR2;
 }
 
+/*!
+ * \brief Computation of the gradient (S*c) for one point, the c vector
+ *        is the one accumulated in "gradient" by the main loop.
+ */
+template<size_t nDim, class GradientType>
+FORCEINLINE void multiplySmatrix(size_t iPoint,
+                                 size_t varBegin,
+                                 size_t varEnd,
+                                 const su2double Smatrix[nDim][nDim],
+                                 GradientType& gradient)
+{
+  for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+  {
+    su2double Cvector[nDim] = {0.0};
+
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      for (size_t jDim = 0; jDim < nDim; ++jDim)
+        Cvector[iDim] += Smatrix[min(iDim,jDim)][max(iDim,jDim)] * gradient(iPoint, iVar, jDim);
+
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      gradient(iPoint, iVar, iDim) = Cvector[iDim];
+  }
+}
+
 /*!
  * \brief Solve the least-squares problem for one point.
  * \note See detail::computeGradientsLeastSquares for the
  *       purpose of template "nDim" and "periodic".
+ * \note If a cache is provided the pseudoinverse (S matrix) is stored
+ *       in it for reuse in later calls (only valid on static grids).
  */
 template<size_t nDim, bool periodic, class GradientType, class RMatrixType>
 FORCEINLINE void solveLeastSquares(size_t iPoint,
                                    size_t varBegin,
                                    size_t varEnd,
                                    const RMatrixType& Rmatrix,
-                                   GradientType& gradient)
+                                   GradientType& gradient,
+                                   C3DDoubleMatrix* smatrixCache = nullptr)
 {
   const auto eps = pow(std::numeric_limits<passivedouble>::epsilon(),2);
 
@@ -132,20 +160,20 @@ FORCEINLINE void solveLeastSquares(size_t iPoint,
     AD::EndPreacc();
   }
 
-  /*--- Computation of the gradient: S*c ---*/
-
-  for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-  {
-    su2double Cvector[nDim] = {0.0};
-
-    for (size_t iDim = 0; iDim < nDim; ++iDim)
-      for (size_t jDim = 0; jDim < nDim; ++jDim)
-        Cvector[iDim] += Smatrix[min(iDim,jDim)][max(iDim,jDim)] * gradient(iPoint, iVar, jDim);
+  /*--- Store the pseudoinverse for reuse, only the upper triangular part is accessed. ---*/
 
+  if (smatrixCache != nullptr) {
     for (size_t iDim = 0; iDim < nDim; ++iDim)
-      gradient(iPoint, iVar, iDim) = Cvector[iDim];
+      for (size_t jDim = iDim; jDim < nDim; ++jDim) {
+        (*smatrixCache)(iPoint,iDim,jDim) = Smatrix[iDim][jDim];
+        AD::SetPreaccOut((*smatrixCache)(iPoint,iDim,jDim));
+      }
   }
 
+  /*--- Computation of the gradient: S*c ---*/
+
+  multiplySmatrix<nDim>(iPoint, varBegin, varEnd, Smatrix, gradient);
+
   if (!periodic) {
     /*--- Stop preacc here instead as gradient is only out. ---*/
     for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
@@ -170,6 +198,8 @@ FORCEINLINE void solveLeastSquares(size_t iPoint,
  * \param[in] varEnd - Index of last variable for which to compute the gradient.
  * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
  * \param[out] Rmatrix - Generic object implementing operator (iPoint, iDim, iDim).
+ * \param[in,out] smatrixCache - Optional, cache of per-point pseudoinverses, built on the
+ *                first call and reused afterwards (callers must only pass it on static grids).
  */
 template<size_t nDim, class FieldType, class GradientType, class RMatrixType>
 void computeGradientsLeastSquares(CSolver* solver,
@@ -182,12 +212,22 @@ void computeGradientsLeastSquares(CSolver* solver,
                                   size_t varBegin,
                                   size_t varEnd,
                                   GradientType& gradient,
-                                  RMatrixType& Rmatrix)
+                                  RMatrixType& Rmatrix,
+                                  C3DDoubleMatrix* smatrixCache = nullptr)
 {
   const bool periodic = (solver != nullptr) && (config.GetnMarker_Periodic() > 0);
 
   const size_t nPointDomain = geometry.GetnPointDomain();
 
+  /*--- The pseudoinverse of the least-squares problem depends only on the grid
+   *    coordinates, on static grids it can be cached to reduce the per-iteration
+   *    work to accumulating the right-hand side (c vector) and computing S*c.
+   *    With periodic boundaries the R matrices receive corrections after the
+   *    first loop and so cannot be inverted ahead of time. ---*/
+
+  const bool buildCache = (smatrixCache != nullptr) && !periodic && (smatrixCache->size() == 0);
+  const bool applyCache = (smatrixCache != nullptr) && !periodic && !buildCache;
+
 #ifdef HAVE_OMP
   constexpr size_t OMP_MAX_CHUNK = 512;
 
@@ -195,11 +235,131 @@ void computeGradientsLeastSquares(CSolver* solver,
                      omp_get_max_threads(), OMP_MAX_CHUNK);
 #endif
 
+  /*--- Optional persistent measured-cost thread ranges for the point loops, the
+   *    per-point cost varies with the number of neighbors and equal chunks leave
+   *    some imbalance that the measured times recover. ---*/
+
+  const bool costSchedule = config.GetCost_Guided_Schedule() && (omp_get_max_threads() > 1);
+
+  /*--- Allocate the cache on first use (sized as the Rmatrix of CVariable). ---*/
+
+  if (buildCache) {
+    /*--- All threads decide to build based on the empty cache, sync before resizing it. ---*/
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER {
+      smatrixCache->resize(geometry.GetnPoint(), nDim, nDim);
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+
+  /*--- Space-filling-curve iteration order (if one was built), consecutive
+   *    points then share neighbors and the indirect accesses stay in cache. ---*/
+
+  const auto& sfc = geometry.GetSFCOrder();
+
+  /*--- Fast path, reuse the cached pseudoinverses. ---*/
+
+  if (applyCache)
+  {
+    auto cachedPointLoop = [&](size_t kPoint)
+    {
+      const auto iPoint = sfc.empty()? kPoint : sfc[kPoint];
+      auto nodes = geometry.nodes;
+      const auto coord_i = nodes->GetCoord(iPoint);
+
+      /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
+      if (omp_get_num_threads() == 1) AD::StartPreacc();
+      AD::SetPreaccIn(coord_i, nDim);
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        AD::SetPreaccIn(field(iPoint,iVar));
+
+      /*--- The cached pseudoinverse is an input, geometry does not change. ---*/
+
+      su2double Smatrix[nDim][nDim] = {{0.0}};
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        for (size_t jDim = iDim; jDim < nDim; ++jDim) {
+          AD::SetPreaccIn((*smatrixCache)(iPoint,iDim,jDim));
+          Smatrix[iDim][jDim] = (*smatrixCache)(iPoint,iDim,jDim);
+        }
+
+      /*--- Clear gradient, used to accumulate the entries of c:= transpose(A)*b. ---*/
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          gradient(iPoint, iVar, iDim) = 0.0;
+
+      for (auto jPoint : nodes->GetPoints(iPoint))
+      {
+        const auto coord_j = geometry.nodes->GetCoord(jPoint);
+        AD::SetPreaccIn(coord_j, nDim);
+
+        /*--- Distance vector from iPoint to jPoint ---*/
+
+        su2double dist_ij[nDim] = {0.0};
+        GeometryToolbox::Distance(nDim, coord_j, coord_i, dist_ij);
+
+        /*--- Compute inverse weight, default 1 (unweighted). ---*/
+
+        su2double weight = 1.0;
+        if(weighted) weight = GeometryToolbox::SquaredNorm(nDim, dist_ij);
+
+        if (weight > 0.0)
+        {
+          weight = 1.0 / weight;
+
+          for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+          {
+            AD::SetPreaccIn(field(jPoint,iVar));
+
+            su2double delta_ij = weight * (field(jPoint,iVar) - field(iPoint,iVar));
+
+            for (size_t iDim = 0; iDim < nDim; ++iDim)
+              gradient(iPoint, iVar, iDim) += dist_ij[iDim] * delta_ij;
+          }
+        }
+      }
+
+      /*--- Computation of the gradient: S*c ---*/
+
+      multiplySmatrix<nDim>(iPoint, varBegin, varEnd, Smatrix, gradient);
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          AD::SetPreaccOut(gradient(iPoint, iVar, iDim));
+      AD::EndPreacc();
+    };
+
+    if (costSchedule) {
+      static COmpCostPartitioner partitioner;
+      size_t beginPoint = 0, endPoint = nPointDomain;
+      partitioner.beginRange(nPointDomain, beginPoint, endPoint);
+      for (size_t kPoint = beginPoint; kPoint < endPoint; ++kPoint) cachedPointLoop(kPoint);
+      partitioner.endRange();
+    }
+    else {
+      SU2_OMP_FOR_DYN(chunkSize)
+      for (size_t kPoint = 0; kPoint < nPointDomain; ++kPoint) cachedPointLoop(kPoint);
+      END_SU2_OMP_FOR
+    }
+
+    /*--- Obtain the gradients at halo points from the MPI ranks that own them. ---*/
+
+    if (solver != nullptr)
+    {
+      solver->InitiateComms(&geometry, &config, kindMpiComm);
+      solver->CompleteComms(&geometry, &config, kindMpiComm);
+    }
+    return;
+  }
+
   /*--- First loop over non-halo points of the grid. ---*/
 
-  SU2_OMP_FOR_DYN(chunkSize)
-  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  auto pointLoop = [&](size_t kPoint)
   {
+    const auto iPoint = sfc.empty()? kPoint : sfc[kPoint];
     auto nodes = geometry.nodes;
     const auto coord_i = nodes->GetCoord(iPoint);
 
@@ -282,10 +442,23 @@ void computeGradientsLeastSquares(CSolver* solver,
     else {
       /*--- Periodic comms are not needed, solve the LS problem for iPoint. ---*/
 
-      solveLeastSquares<nDim, false>(iPoint, varBegin, varEnd, Rmatrix, gradient);
+      solveLeastSquares<nDim, false>(iPoint, varBegin, varEnd, Rmatrix, gradient,
+                                     buildCache? smatrixCache : nullptr);
     }
+  };
+
+  if (costSchedule) {
+    static COmpCostPartitioner partitioner;
+    size_t beginPoint = 0, endPoint = nPointDomain;
+    partitioner.beginRange(nPointDomain, beginPoint, endPoint);
+    for (size_t kPoint = beginPoint; kPoint < endPoint; ++kPoint) pointLoop(kPoint);
+    partitioner.endRange();
+  }
+  else {
+    SU2_OMP_FOR_DYN(chunkSize)
+    for (size_t kPoint = 0; kPoint < nPointDomain; ++kPoint) pointLoop(kPoint);
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_FOR
 
   /*--- Correct the gradient values across any periodic boundaries. ---*/
 
@@ -332,15 +505,16 @@ void computeGradientsLeastSquares(CSolver* solver,
                                   size_t varBegin,
                                   size_t varEnd,
                                   GradientType& gradient,
-                                  RMatrixType& Rmatrix) {
+                                  RMatrixType& Rmatrix,
+                                  C3DDoubleMatrix* smatrixCache = nullptr) {
   switch (geometry.GetnDim()) {
   case 2:
     detail::computeGradientsLeastSquares<2>(solver, kindMpiComm, kindPeriodicComm, geometry, config,
-                                            weighted, field, varBegin, varEnd, gradient, Rmatrix);
+                                            weighted, field, varBegin, varEnd, gradient, Rmatrix, smatrixCache);
     break;
   case 3:
     detail::computeGradientsLeastSquares<3>(solver, kindMpiComm, kindPeriodicComm, geometry, config,
-                                            weighted, field, varBegin, varEnd, gradient, Rmatrix);
+                                            weighted, field, varBegin, varEnd, gradient, Rmatrix, smatrixCache);
     break;
   default:
     SU2_MPI::Error("Too many dimensions to compute gradients.", CURRENT_FUNCTION);
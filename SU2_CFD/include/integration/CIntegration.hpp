@@ -150,6 +150,32 @@ public:
                                    CNumerics ******numerics_container, CConfig **config,
                                    unsigned short RunTime_EqSystem, unsigned short iZone, unsigned short iInst) { };
 
+  /*!
+   * \brief Whether the *_IterationCore methods are implemented, i.e. this integration
+   *        can run inside a persistent parallel region spanning multiple systems.
+   */
+  virtual bool SupportsPersistentParallel() const { return false; }
+
+  /*!
+   * \brief Body of MultiGrid_Iteration, to be called from inside a parallel region
+   *        (or serially), allowing one region to span several systems.
+   */
+  virtual void MultiGrid_IterationCore(CGeometry ****geometry, CSolver *****solver_container,
+                                       CNumerics ******numerics_container, CConfig **config,
+                                       unsigned short RunTime_EqSystem, unsigned short iZone, unsigned short iInst) {
+    SU2_MPI::Error("MultiGrid_IterationCore is not implemented by this integration class.", CURRENT_FUNCTION);
+  }
+
+  /*!
+   * \brief Body of SingleGrid_Iteration, to be called from inside a parallel region
+   *        (or serially), allowing one region to span several systems.
+   */
+  virtual void SingleGrid_IterationCore(CGeometry ****geometry, CSolver *****solver_container,
+                                        CNumerics ******numerics_container, CConfig **config,
+                                        unsigned short RunTime_EqSystem, unsigned short iZone, unsigned short iInst) {
+    SU2_MPI::Error("SingleGrid_IterationCore is not implemented by this integration class.", CURRENT_FUNCTION);
+  }
+
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
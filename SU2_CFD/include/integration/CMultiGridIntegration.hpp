@@ -52,7 +52,25 @@ public:
                            CNumerics ******numerics_container, CConfig **config,
                            unsigned short RunTime_EqSystem, unsigned short iZone, unsigned short iInst) override;
 
+  /*!
+   * \brief The multigrid iteration supports running inside a persistent parallel region.
+   */
+  inline bool SupportsPersistentParallel() const override { return true; }
+
+  /*!
+   * \brief Body of MultiGrid_Iteration, see the base class for details.
+   */
+  void MultiGrid_IterationCore(CGeometry ****geometry, CSolver *****solver_container,
+                               CNumerics ******numerics_container, CConfig **config,
+                               unsigned short RunTime_EqSystem, unsigned short iZone, unsigned short iInst) override;
+
 private:
+  /*--- Convergence control of the full multigrid start-up (coarse-to-fine cascade). ---*/
+
+  su2double FMG_RefResidual = 0.0;  /*!< \brief Log residual when the current start-up level was entered. */
+  unsigned long FMG_LevelIter = 0;  /*!< \brief Iterations spent on the current start-up level. */
+  bool FMG_RefSet = false;          /*!< \brief Whether the reference residual of the level has been stored. */
+
   /*!
    * \brief Perform a Full-Approximation Storage (FAS) Multigrid.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -165,9 +183,12 @@ private:
    * \param[in] config - Definition of the particular problem.
    * \param[in] iMesh - Index of the mesh in multigrid computations.
    * \param[in] InclSharedDomain - Include the shared domain in the interpolation.
+   * \param[in] completeComms - If false, only initiate the halo exchange of the restricted
+   *            solution, the caller completes it after overlapping independent work.
    */
   void SetRestricted_Solution(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
-                              CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config);
+                              CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config,
+                              bool completeComms = true);
 
   /*!
    * \brief Initialize the adjoint solution using the primal problem.
@@ -74,6 +74,12 @@ private:
   unsigned short precondIters = 0;
   su2double precondTol = 0.0;
 
+  /*--- The approximate Jacobian used for preconditioning only needs to track
+   * the solution loosely, it can be frozen for a number of iterations during
+   * which the residual evaluation skips the Jacobian assembly entirely. ---*/
+  unsigned short jacRefreshPeriod = 1;
+  unsigned short jacRefreshCount = 0;
+
   /*--- For a number of iterations, or before a certain residual drop,
    * use the quasi-Newton approach instead of Newton-Krylov. If both
    * criteria are zero, or the solver does not provide a linear
@@ -174,6 +180,12 @@ private:
    */
   void ComputeResiduals(ResEvalType type);
 
+  /*!
+   * \brief Set the right hand side of the linear system (-Residual) and monitor the residuals,
+   * like the solver's PrepareImplicitIteration, but without touching the frozen Jacobian.
+   */
+  void PrepareLinearResidual();
+
   /*!
    * \brief Compute the step size for finite differences.
    */
@@ -80,4 +80,16 @@ public:
                             CNumerics ******numerics_container, CConfig **config,
                             unsigned short RunTime_EqSystem, unsigned short iZone, unsigned short iInst) override;
 
+  /*!
+   * \brief The single grid iteration supports running inside a persistent parallel region.
+   */
+  inline bool SupportsPersistentParallel() const override { return true; }
+
+  /*!
+   * \brief Body of SingleGrid_Iteration, see the base class for details.
+   */
+  void SingleGrid_IterationCore(CGeometry ****geometry, CSolver *****solver_container,
+                                CNumerics ******numerics_container, CConfig **config,
+                                unsigned short RunTime_EqSystem, unsigned short iZone, unsigned short iInst) override;
+
 };
@@ -53,6 +53,9 @@
  * \param[out] fieldMin - Minimum field values over direct neighbors of each point.
  * \param[out] fieldMax - As above but maximum values.
  * \param[out] limiter - Reconstruction limiter for the field.
+ * \param[in] recomputeMask - Optional, points for which the limiter is recomputed,
+ *            others keep their current value (incremental mode, see
+ *            CFVMFlowSolverBase::SetPrimitive_Limiter, not compatible with periodicity).
  *
  * Template parameters:
  * \param nDim - Number of dimensions.
@@ -73,7 +76,8 @@ void computeLimiters_impl(CSolver* solver,
                           const GradientType& gradient,
                           FieldType& fieldMin,
                           FieldType& fieldMax,
-                          FieldType& limiter)
+                          FieldType& limiter,
+                          const su2vector<bool>* recomputeMask = nullptr)
 {
   constexpr size_t MAXNVAR = 32;
 
@@ -129,6 +133,10 @@ void computeLimiters_impl(CSolver* solver,
   SU2_OMP_FOR_DYN(chunkSize)
   for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
   {
+    /*--- In incremental mode only the points whose stencil changed are updated. ---*/
+
+    if (recomputeMask && !(*recomputeMask)(iPoint)) continue;
+
     auto nodes = geometry.nodes;
     const auto coord_i = nodes->GetCoord(iPoint);
 
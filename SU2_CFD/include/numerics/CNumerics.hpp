@@ -28,10 +28,12 @@
 
 #pragma once
 
+#include <cassert>
 #include <cmath>
 #include <iostream>
 #include <limits>
 #include <cstdlib>
+#include <vector>
 
 #include "../../../Common/include/CConfig.hpp"
 #include "../../../Common/include/linear_algebra/blas_structure.hpp"
@@ -48,6 +50,53 @@ class CNumerics {
 protected:
   enum : size_t {MAXNDIM = 3}; /*!< \brief Max number of space dimensions, used in some static arrays. */
 
+  /*--- Numerics instances are private to one thread. Packing the hot work arrays of a
+   scheme into one contiguous slab (instead of scattered allocations) keeps the
+   per-thread scratch working set in as few pages as possible. ---*/
+
+  std::vector<su2double> scratchSlab;     /*!< \brief Contiguous backing storage for the scratch arrays. */
+  std::vector<su2double*> scratchRows;    /*!< \brief Backing storage for the row pointers of scratch matrices. */
+  unsigned long scratchOffset = 0;        /*!< \brief First free entry of the slab. */
+  unsigned long scratchRowOffset = 0;     /*!< \brief First free entry of the row pointer storage. */
+
+  /*!
+   * \brief Reserve one contiguous slab for the scratch arrays of the scheme, any
+   * previously carved arrays are invalidated.
+   * \param[in] nEntries - Total number of su2double entries of all arrays and matrices.
+   * \param[in] nRows - Total number of rows of all matrices.
+   */
+  void ReserveScratch(unsigned long nEntries, unsigned long nRows = 0) {
+    scratchSlab.assign(nEntries, 0.0);
+    scratchRows.assign(nRows, nullptr);
+    scratchOffset = scratchRowOffset = 0;
+  }
+
+  /*!
+   * \brief Carve an array out of the scratch slab, the storage is owned by the slab.
+   * \param[in] n - Number of entries of the array.
+   */
+  su2double* ScratchArray(unsigned long n) {
+    if (scratchOffset + n > scratchSlab.size())
+      SU2_MPI::Error("Undersized scratch slab, check the ReserveScratch call of the scheme.", CURRENT_FUNCTION);
+    su2double* array = scratchSlab.data() + scratchOffset;
+    scratchOffset += n;
+    return array;
+  }
+
+  /*!
+   * \brief Carve a matrix out of the scratch slab, the rows are contiguous.
+   * \param[in] nRows - Number of rows of the matrix.
+   * \param[in] nCols - Number of columns of the matrix.
+   */
+  su2double** ScratchMatrix(unsigned long nRows, unsigned long nCols) {
+    if (scratchRowOffset + nRows > scratchRows.size())
+      SU2_MPI::Error("Undersized scratch row storage, check the ReserveScratch call of the scheme.", CURRENT_FUNCTION);
+    su2double** matrix = scratchRows.data() + scratchRowOffset;
+    scratchRowOffset += nRows;
+    for (auto iRow = 0ul; iRow < nRows; ++iRow) matrix[iRow] = ScratchArray(nCols);
+    return matrix;
+  }
+
   unsigned short nDim, nVar;  /*!< \brief Number of dimensions and variables. */
   su2double Gamma;            /*!< \brief Fluid's Gamma constant (ratio of specific heats). */
   su2double Gamma_Minus_One;  /*!< \brief Fluids's Gamma - 1.0  . */
@@ -40,6 +40,7 @@ class CSource_NEMO : public CNEMONumerics {
 private:
 
   su2double *Y, **dYdr;                  // Mass fraction
+  vector<su2double> rhos;                /*!< \brief Species densities work array. */
 
   su2double*  residual = nullptr;        /*!< \brief The source residual. */
   su2double** jacobian = nullptr;
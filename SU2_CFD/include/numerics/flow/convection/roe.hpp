@@ -70,11 +70,6 @@ public:
    */
   CUpwRoeBase_Flow(unsigned short val_nDim, unsigned short val_nVar, const CConfig* config, bool val_low_dissipation);
 
-  /*!
-   * \brief Destructor of the class.
-   */
-  ~CUpwRoeBase_Flow(void) override;
-
   /*!
    * \brief Compute the flux from node i to node j, part common to most Roe schemes.
    * \param[in] config - Definition of the particular problem.
@@ -210,11 +205,6 @@ public:
    */
   CUpwTurkel_Flow(unsigned short val_nDim, unsigned short val_nVar, const CConfig* config);
 
-  /*!
-   * \brief Destructor of the class.
-   */
-  ~CUpwTurkel_Flow(void) override;
-
   /*!
    * \brief Compute the Roe's flux between two nodes i and j.
    * \param[in] config - Definition of the particular problem.
@@ -263,11 +253,6 @@ public:
    */
   CUpwGeneralRoe_Flow(unsigned short val_nDim, unsigned short val_nVar, const CConfig* config);
 
-  /*!
-   * \brief Destructor of the class.
-   */
-  ~CUpwGeneralRoe_Flow(void) override;
-
   /*!
    * \brief Compute the Roe's flux between two nodes i and j.
    * \param[in] config - Definition of the particular problem.
@@ -252,6 +252,36 @@ public:
 
 };
 
+/*!
+ * \class CSourceSpongeLayer
+ * \brief Class for the source term integration of a sponge layer, which damps
+ *        the conservative state towards the free-stream state inside its
+ *        support region. The solver restricts the evaluation to a compact
+ *        list of the supported points.
+ * \ingroup SourceDiscr
+ */
+class CSourceSpongeLayer final : public CSourceBase_Flow {
+  su2double U_inf[5];   /*!< \brief Free-stream conservative state the solution is damped towards. */
+  su2double Damping;    /*!< \brief Damping coefficient of the sponge layer. */
+  bool implicit;
+
+public:
+  /*!
+   * \param[in] val_nDim - Number of dimensions of the problem.
+   * \param[in] val_nVar - Number of variables of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  CSourceSpongeLayer(unsigned short val_nDim, unsigned short val_nVar, const CConfig* config);
+
+  /*!
+   * \brief Source term integration for the sponge layer damping.
+   * \param[in] config - Definition of the particular problem.
+   * \return Lightweight const-view of residual and Jacobian.
+   */
+  ResidualType<> ComputeResidual(const CConfig* config) override;
+
+};
+
 /*!
  * \class CSourceRotatingFrame_Flow
  * \brief Class for a rotating frame source term.
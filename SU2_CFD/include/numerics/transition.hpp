@@ -221,8 +221,25 @@ private:
   su2double alpha_global;
   su2double Vorticity;
 
+  /*-- Precomputed empirical correlations, they only depend on the free-stream
+   *   turbulence intensity and are evaluated once in the constructor. --*/
+  su2double tu;            /*!< \brief Turbulence intensity in percent. */
+  su2double rey_tc_corr;   /*!< \brief Polynomial part of the Re_theta_c correlation. */
+  su2double flen_corr;     /*!< \brief Flength correlation. */
+  su2double re_theta_corr; /*!< \brief Intensity-dependent factor of the Re_theta correlation. */
+
+  enum : int { N_FLAMBDA = 64 };      /*!< \brief Number of intervals of the f_lambda table. */
+  su2double flambda_tab[N_FLAMBDA+1]; /*!< \brief f_lambda correlation tabulated over the clip range of lambda. */
+
   bool implicit;
 
+  /*!
+   * \brief Evaluate the tabulated f_lambda correlation by linear interpolation.
+   * \param[in] lambda - Pressure-gradient parameter, clipped to [-0.1, 0.1].
+   * \return Value of the f_lambda correlation.
+   */
+  su2double FlambdaCorrelation(su2double lambda) const;
+
 public:
   bool debugme; // For debugging only, remove this. -AA
 
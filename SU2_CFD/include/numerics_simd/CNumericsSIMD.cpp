@@ -31,9 +31,23 @@
 #include "flow/convection/roe.hpp"
 #include "flow/convection/centered.hpp"
 #include "flow/diffusion/viscous_fluxes.hpp"
+#include "turbulent/turb_fluxes.hpp"
 
 namespace {
 
+/*!
+ * \brief Map a limiter kind to the one that instantiates its reconstruction
+ * kernel. The point-based kinds only gather precomputed limiter values in the
+ * edge loop, their kernels are identical, so they share one instantiation.
+ */
+inline ENUM_LIMITER effectiveLimiter(ENUM_LIMITER kind) {
+  switch (kind) {
+    case NO_LIMITER: return NO_LIMITER;
+    case VAN_ALBADA_EDGE: return VAN_ALBADA_EDGE;
+    default: return VENKATAKRISHNAN;
+  }
+}
+
 /*!
  * \brief Upwind factory implementation for ideal gas.
  */
@@ -42,7 +56,17 @@ CNumericsSIMD* createUpwindIdealNumerics(const CConfig& config, int iMesh, const
   CNumericsSIMD* obj = nullptr;
   switch (config.GetKind_Upwind_Flow()) {
     case ROE:
-      obj = new CRoeScheme<ViscousDecorator>(config, iMesh, turbVars);
+      switch (effectiveLimiter(static_cast<ENUM_LIMITER>(config.GetKind_SlopeLimit_Flow()))) {
+        case NO_LIMITER:
+          obj = new CRoeScheme<ViscousDecorator, NO_LIMITER>(config, iMesh, turbVars);
+          break;
+        case VAN_ALBADA_EDGE:
+          obj = new CRoeScheme<ViscousDecorator, VAN_ALBADA_EDGE>(config, iMesh, turbVars);
+          break;
+        default:
+          obj = new CRoeScheme<ViscousDecorator, VENKATAKRISHNAN>(config, iMesh, turbVars);
+          break;
+      }
       break;
   }
   return obj;
@@ -122,6 +146,38 @@ CNumericsSIMD* createNumerics(const CConfig& config, int iMesh, const CVariable*
   return obj;
 }
 
+/*!
+ * \brief SST factory implementation, inner dispatch on the flow limiter.
+ */
+template<size_t NDIM, ENUM_LIMITER LimiterTurb>
+CNumericsSIMD* createSSTNumericsImpl(const CConfig& config, const su2double* constants,
+                                     const CVariable* flowVars) {
+  switch (effectiveLimiter(static_cast<ENUM_LIMITER>(config.GetKind_SlopeLimit_Flow()))) {
+    case NO_LIMITER:
+      return new CCompressibleSSTFlux<NDIM, LimiterTurb, NO_LIMITER>(config, constants, flowVars);
+    case VAN_ALBADA_EDGE:
+      return new CCompressibleSSTFlux<NDIM, LimiterTurb, VAN_ALBADA_EDGE>(config, constants, flowVars);
+    default:
+      return new CCompressibleSSTFlux<NDIM, LimiterTurb, VENKATAKRISHNAN>(config, constants, flowVars);
+  }
+}
+
+/*!
+ * \brief SST factory implementation, outer dispatch on the turbulence limiter.
+ */
+template<size_t NDIM>
+CNumericsSIMD* createSSTNumerics(const CConfig& config, const su2double* constants,
+                                 const CVariable* flowVars) {
+  switch (effectiveLimiter(static_cast<ENUM_LIMITER>(config.GetKind_SlopeLimit_Turb()))) {
+    case NO_LIMITER:
+      return createSSTNumericsImpl<NDIM, NO_LIMITER>(config, constants, flowVars);
+    case VAN_ALBADA_EDGE:
+      return createSSTNumericsImpl<NDIM, VAN_ALBADA_EDGE>(config, constants, flowVars);
+    default:
+      return createSSTNumericsImpl<NDIM, VENKATAKRISHNAN>(config, constants, flowVars);
+  }
+}
+
 } // namespace
 
 /*!
@@ -138,3 +194,14 @@ CNumericsSIMD* CNumericsSIMD::CreateNumerics(const CConfig& config, int nDim, in
 
   return nullptr;
 }
+
+/*!
+ * \brief Instantiates the 2D and 3D versions of the SST edge numerics.
+ */
+CNumericsSIMD* CNumericsSIMD::CreateSSTNumerics(const CConfig& config, int nDim, const su2double* constants,
+                                                const CVariable* flowVars) {
+  if (nDim == 2) return createSSTNumerics<2>(config, constants, flowVars);
+  if (nDim == 3) return createSSTNumerics<3>(config, constants, flowVars);
+
+  return nullptr;
+}
@@ -96,4 +96,14 @@ public:
    */
   static CNumericsSIMD* CreateNumerics(const CConfig& config, int nDim, int iMesh, const CVariable* turbVars = nullptr);
 
+  /*!
+   * \brief Factory method for the SST model numerics (convective + viscous).
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] constants - Constants of the model.
+   * \param[in] flowVars - Flow variables.
+   */
+  static CNumericsSIMD* CreateSSTNumerics(const CConfig& config, int nDim, const su2double* constants,
+                                          const CVariable* flowVars);
+
 };
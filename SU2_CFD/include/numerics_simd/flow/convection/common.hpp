@@ -31,6 +31,9 @@
 #include "../../util.hpp"
 #include "../variables.hpp"
 #include "../../../variables/CNSVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+#include <limits>
+#include "../../../limiters/CLimiterDetails.hpp"
 
 /*!
  * \brief Unlimited reconstruction.
@@ -78,30 +81,36 @@ FORCEINLINE void musclEdgeLimited(Int iPoint,
   auto grad_i = gatherVariables<nVar,nDim>(iPoint, gradient);
   auto grad_j = gatherVariables<nVar,nDim>(jPoint, gradient);
 
+  /*--- Same formulation (and epsilon) as the scalar path, with the
+   *    projections over half the edge length as in that path. ---*/
+
+  const Double eps(EPS);
+
   for (size_t iVar = 0; iVar < nVar; ++iVar) {
-    const Double proj_i = dot(grad_i[iVar], vector_ij);
-    const Double proj_j = dot(grad_j[iVar], vector_ij);
+    const Double proj_i = 0.5 * dot(grad_i[iVar], vector_ij);
+    const Double proj_j = 0.5 * dot(grad_j[iVar], vector_ij);
     const Double delta_ij = V.j.all(iVar) - V.i.all(iVar);
-    const Double delta_ij_2 = pow(delta_ij, 2) + 1e-6;
-    /// TODO: Customize the limiter function.
-    const Double lim_i = (delta_ij_2 + proj_i*delta_ij) / (pow(proj_i,2) + delta_ij_2);
-    const Double lim_j = (delta_ij_2 + proj_j*delta_ij) / (pow(proj_j,2) + delta_ij_2);
-    V.i.all(iVar) += lim_i * 0.5 * proj_i;
-    V.j.all(iVar) -= lim_j * 0.5 * proj_j;
+    const Double lim_i = LimiterHelpers<Double>::vanAlbadaFunction(proj_i, delta_ij, eps);
+    const Double lim_j = LimiterHelpers<Double>::vanAlbadaFunction(proj_j, delta_ij, eps);
+    V.i.all(iVar) += lim_i * proj_i;
+    V.j.all(iVar) -= lim_j * proj_j;
   }
 }
 
 /*!
  * \brief Retrieve primitive variables for points i/j, reconstructing them if needed.
+ * \note The limiter kind is a compile-time parameter so that each kind gets a
+ *       fully specialized kernel without runtime dispatch on the hot path
+ *       (the point-based kinds gather precomputed values and therefore share
+ *       the same kernel, the factory maps them to one specialization).
  * \param[in] iPoint, jPoint - Nodes of the edge.
  * \param[in] muscl - If true, reconstruct, else simply fetch.
  * \param[in] vector_ij - Distance vector from i to j.
  * \param[in] solution - Entire solution container (a derived CVariable).
  * \return Pair of primitive variables.
  */
-template<class ReconVarType, class PrimVarType, size_t nDim, class VariableType>
+template<class ReconVarType, ENUM_LIMITER Limiter, class PrimVarType, size_t nDim, class VariableType>
 FORCEINLINE CPair<ReconVarType> reconstructPrimitives(Int iPoint, Int jPoint, bool muscl,
-                                                      ENUM_LIMITER limiterType,
                                                       const CPair<PrimVarType>& V1st,
                                                       const VectorDbl<nDim>& vector_ij,
                                                       const VariableType& solution) {
@@ -118,18 +127,17 @@ FORCEINLINE CPair<ReconVarType> reconstructPrimitives(Int iPoint, Int jPoint, bo
   }
 
   if (muscl) {
-    switch (limiterType) {
-    case NO_LIMITER:
+    /*--- These branches resolve at compile time. ---*/
+    if (Limiter == NO_LIMITER) {
       musclUnlimited(iPoint, vector_ij, 0.5, gradients, V.i.all);
       musclUnlimited(jPoint, vector_ij,-0.5, gradients, V.j.all);
-      break;
-    case VAN_ALBADA_EDGE:
+    }
+    else if (Limiter == VAN_ALBADA_EDGE) {
       musclEdgeLimited(iPoint, jPoint, vector_ij, gradients, V);
-      break;
-    default:
+    }
+    else {
       musclPointLimited(iPoint, vector_ij, 0.5, limiters, gradients, V.i.all);
       musclPointLimited(jPoint, vector_ij,-0.5, limiters, gradients, V.j.all);
-      break;
     }
     /// TODO: Extra reconstruction checks needed.
   }
@@ -317,6 +325,19 @@ FORCEINLINE MatrixDbl<nDim+2> inviscidProjJac(Double gamma, RandomAccessIterator
   return jac;
 }
 
+/*!
+ * \brief Harten-type entropy correction of a convective eigenvalue.
+ * \note Smooth (C1) rational blend of |lambda| towards the cut-off "eps",
+ * identical to the hard clip max(|lambda|, eps) outside of it. The selection
+ * is done with mask arithmetic so that SIMD lanes never diverge.
+ */
+FORCEINLINE Double entropyCorrectedEigenvalue(Double lambda, Double eps) {
+  const Double absLambda = abs(lambda);
+  const Double isSmall = absLambda < eps;
+  const Double blend = 0.5 * (absLambda*absLambda / max(eps,EPS) + eps);
+  return isSmall*blend + (1-isSmall)*absLambda;
+}
+
 /*!
  * \brief (Low) Dissipation coefficient for Roe schemes.
  */
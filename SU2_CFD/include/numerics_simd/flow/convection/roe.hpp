@@ -45,7 +45,7 @@
  * data from CVariable. Derived is meant to implement small details,
  * Base is meant to do heavy lifting.
  */
-template<class Derived, class Base>
+template<class Derived, class Base, ENUM_LIMITER Limiter>
 class CRoeBase : public Base {
 protected:
   using Base::nDim;
@@ -59,7 +59,6 @@ protected:
   const bool finestGrid;
   const bool dynamicGrid;
   const bool muscl;
-  const ENUM_LIMITER typeLimiter;
 
   /*!
    * \brief Constructor, store some constants and forward args to base.
@@ -71,8 +70,7 @@ protected:
     entropyFix(config.GetEntropyFix_Coeff()),
     finestGrid(iMesh == MESH_0),
     dynamicGrid(config.GetDynamic_Grid()),
-    muscl(finestGrid && config.GetMUSCL_Flow()),
-    typeLimiter(static_cast<ENUM_LIMITER>(config.GetKind_SlopeLimit_Flow())) {
+    muscl(finestGrid && config.GetMUSCL_Flow()) {
   }
 
 public:
@@ -115,8 +113,8 @@ public:
     V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
     V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
 
-    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
-                  iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad>, Limiter>(
+                  iPoint, jPoint, muscl, V1st, vector_ij, solution);
 
     /*--- Compute conservative variables. ---*/
 
@@ -152,12 +150,13 @@ public:
     lambda(nDim) = projVel + roeAvg.speedSound;
     lambda(nDim+1) = projVel - roeAvg.speedSound;
 
-    /*--- Apply Mavriplis' entropy correction to eigenvalues. ---*/
+    /*--- Apply the entropy correction to the eigenvalues, Mavriplis'
+     *    cut-off with Harten's smooth limiting near zero. ---*/
 
-    Double maxLambda = abs(projVel) + roeAvg.speedSound;
+    const Double epsFix = entropyFix * (abs(projVel) + roeAvg.speedSound);
 
     for (size_t iVar = 0; iVar < nVar; ++iVar) {
-      lambda(iVar) = max(abs(lambda(iVar)), entropyFix*maxLambda);
+      lambda(iVar) = entropyCorrectedEigenvalue(lambda(iVar), epsFix);
     }
 
     /*--- Inviscid fluxes and Jacobians. ---*/
@@ -217,10 +216,10 @@ public:
  * \class CRoeScheme
  * \brief Classical Roe scheme.
  */
-template<class Decorator>
-class CRoeScheme : public CRoeBase<CRoeScheme<Decorator>,Decorator> {
+template<class Decorator, ENUM_LIMITER Limiter>
+class CRoeScheme : public CRoeBase<CRoeScheme<Decorator,Limiter>,Decorator,Limiter> {
 private:
-  using Base = CRoeBase<CRoeScheme<Decorator>,Decorator>;
+  using Base = CRoeBase<CRoeScheme<Decorator,Limiter>,Decorator,Limiter>;
   using Base::nDim;
   using Base::nVar;
   using Base::gamma;
@@ -0,0 +1,232 @@
+/*!
+ * \file turb_fluxes.hpp
+ * \brief Vectorized convective and viscous fluxes for turbulence transport equations.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../CNumericsSIMD.hpp"
+#include "../util.hpp"
+#include "../flow/variables.hpp"
+#include "../flow/convection/common.hpp"
+#include "../flow/diffusion/common.hpp"
+#include "../../variables/CFlowVariable.hpp"
+#include "../../variables/CTurbSSTVariable.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \brief Type to store a small vector of transported scalars with the
+ * accessor expected by the gradient and reconstruction helpers.
+ */
+template<size_t nVar_>
+struct CTurbVariables {
+  static constexpr size_t nVar = nVar_;
+  VectorDbl<nVar> all;
+};
+
+/*!
+ * \class CCompressibleSSTFlux
+ * \brief Scalar upwind convective flux and corrected average-of-gradients viscous
+ * flux for the SST model equations (equivalent to CUpwSca_TurbSST + CAvgGrad_TurbSST),
+ * compressible flow. Unlike the flow schemes this class is not decorated, the two
+ * contributions are fused because they share most of the gathered data.
+ */
+template<size_t NDIM, ENUM_LIMITER LimiterTurb, ENUM_LIMITER LimiterFlow>
+class CCompressibleSSTFlux final : public CNumericsSIMD {
+protected:
+  static constexpr size_t nDim = NDIM;
+  static constexpr size_t nVar = 2;
+  static constexpr size_t nPrimVar = nDim+7;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+
+  const su2double sigma_k1;
+  const su2double sigma_k2;
+  const su2double sigma_om1;
+  const su2double sigma_om2;
+  const bool dynamicGrid;
+  const bool muscl;
+  const bool musclFlow;
+
+  const CFlowVariable* flowVars;
+
+public:
+  /*!
+   * \brief Constructor, store constants and the access point to the flow variables.
+   */
+  CCompressibleSSTFlux(const CConfig& config, const su2double* constants,
+                       const CVariable* flowVars_) :
+    sigma_k1(constants[0]),
+    sigma_k2(constants[1]),
+    sigma_om1(constants[2]),
+    sigma_om2(constants[3]),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(config.GetMUSCL_Turb()),
+    musclFlow(config.GetMUSCL_Flow() && muscl &&
+              (config.GetKind_ConvNumScheme_Flow() == SPACE_UPWIND)),
+    flowVars(static_cast<const CFlowVariable*>(flowVars_)) {
+  }
+
+  /*!
+   * \brief Convective and viscous fluxes of the SST equations for one edge (SIMD group).
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme_Turb() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CTurbSSTVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+
+    /*--- Turbulence variables, with and without reconstruction (the
+     *    gradient correction needs the un-reconstructed values). ---*/
+
+    CPair<CTurbVariables<nVar> > turb;
+    turb.i.all = gatherVariables<nVar>(iPoint, solution.GetSolution());
+    turb.j.all = gatherVariables<nVar>(jPoint, solution.GetSolution());
+
+    auto turbRec = turb;
+    if (muscl) {
+      const auto& gradients = solution.GetGradient_Reconstruction();
+      /*--- These branches resolve at compile time. ---*/
+      if (LimiterTurb == NO_LIMITER) {
+        musclUnlimited(iPoint, vector_ij, 0.5, gradients, turbRec.i.all);
+        musclUnlimited(jPoint, vector_ij,-0.5, gradients, turbRec.j.all);
+      }
+      else if (LimiterTurb == VAN_ALBADA_EDGE) {
+        musclEdgeLimited(iPoint, jPoint, vector_ij, gradients, turbRec);
+      }
+      else {
+        musclPointLimited(iPoint, vector_ij, 0.5, solution.GetLimiter(), gradients, turbRec.i.all);
+        musclPointLimited(jPoint, vector_ij,-0.5, solution.GetLimiter(), gradients, turbRec.j.all);
+      }
+    }
+
+    /*--- Flow primitives, reconstructed only for the convective flux. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, flowVars->GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, flowVars->GetPrimitive());
+
+    const auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad>, LimiterFlow>(
+                       iPoint, jPoint, musclFlow, V1st, vector_ij, *flowVars);
+
+    /*--- Upwind convective flux, "a0" and "a1" are also the Jacobians. ---*/
+
+    Double projVel = 0.0;
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      const auto gridVel_i = gatherVariables<nDim>(iPoint, gridVel);
+      const auto gridVel_j = gatherVariables<nDim>(jPoint, gridVel);
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        projVel += 0.5 * (V.i.velocity(iDim) + V.j.velocity(iDim) -
+                          gridVel_i(iDim) - gridVel_j(iDim)) * normal(iDim);
+      }
+    } else {
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        projVel += 0.5 * (V.i.velocity(iDim) + V.j.velocity(iDim)) * normal(iDim);
+      }
+    }
+
+    const Double a0 = 0.5 * (projVel + abs(projVel));
+    const Double a1 = 0.5 * (projVel - abs(projVel));
+
+    VectorDbl<nVar> flux;
+    MatrixDbl<nVar> jac_i, jac_j;
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = a0 * V.i.density() * turbRec.i.all(iVar) +
+                   a1 * V.j.density() * turbRec.j.all(iVar);
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        jac_i(iVar,jVar) = Double(0.0);
+        jac_j(iVar,jVar) = Double(0.0);
+      }
+      jac_i(iVar,iVar) = a0;
+      jac_j(iVar,iVar) = a1;
+    }
+
+    /*--- Viscous contribution, compute distance and handle zero
+     *    without "ifs" by making it large. ---*/
+
+    auto dist2_ij = squaredNorm(vector_ij);
+    Double mask = dist2_ij < EPS*EPS;
+    dist2_ij += mask / (EPS*EPS);
+
+    /*--- Corrected mean gradient (un-reconstructed variables). ---*/
+
+    auto avgGrad = averageGradient<nVar,nDim>(iPoint, jPoint, solution.GetGradient());
+    correctGradient(turb, vector_ij, dist2_ij, avgGrad);
+
+    /*--- Effective diffusivity of each equation, blended with F1. ---*/
+
+    const Double F1_i = gatherVariables(iPoint, solution.GetF1blending());
+    const Double F1_j = gatherVariables(jPoint, solution.GetF1blending());
+
+    const Double diff_kine = 0.5 * (V1st.i.laminarVisc() + V1st.j.laminarVisc() +
+                                    (F1_i*sigma_k1 + (1.0-F1_i)*sigma_k2) * V1st.i.eddyVisc() +
+                                    (F1_j*sigma_k1 + (1.0-F1_j)*sigma_k2) * V1st.j.eddyVisc());
+    const Double diff_omega = 0.5 * (V1st.i.laminarVisc() + V1st.j.laminarVisc() +
+                                     (F1_i*sigma_om1 + (1.0-F1_i)*sigma_om2) * V1st.i.eddyVisc() +
+                                     (F1_j*sigma_om1 + (1.0-F1_j)*sigma_om2) * V1st.j.eddyVisc());
+
+    flux(0) -= diff_kine * dot(avgGrad[0], normal);
+    flux(1) -= diff_omega * dot(avgGrad[1], normal);
+
+    if (implicit) {
+      /*--- TSL approximation for the derivatives of the gradients. ---*/
+      const Double proj_ij = dot(vector_ij, normal) / dist2_ij;
+
+      jac_i(0,0) += diff_kine * proj_ij / V1st.i.density();
+      jac_i(1,1) += diff_omega * proj_ij / V1st.i.density();
+
+      jac_j(0,0) -= diff_kine * proj_ij / V1st.j.density();
+      jac_j(1,1) -= diff_omega * proj_ij / V1st.j.density();
+    }
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
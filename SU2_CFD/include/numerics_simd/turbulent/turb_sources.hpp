@@ -0,0 +1,183 @@
+/*!
+ * \file turb_sources.hpp
+ * \brief Vectorized (SIMD) source terms for turbulence models.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../CNumericsSIMD.hpp"
+#include "../util.hpp"
+#include "../../../../Common/include/CConfig.hpp"
+
+/*!
+ * \class CSASourceTerms
+ * \brief SIMD evaluation of the source terms of the standard SA model, equivalent
+ * to CSourcePieceWise_TurbSA (including rough walls, the rotation correction, and
+ * the BC transition model). Source terms are point-wise, one call evaluates one
+ * SIMD group of points, the caller gathers the inputs and scatters the residual
+ * and Jacobian (see CTurbSASolver::Source_Residual). Lanes where the wall distance
+ * is (numerically) zero produce no source, the singular terms are clipped and the
+ * result masked instead of branching.
+ */
+template<size_t NDIM>
+class CSASourceTerms {
+protected:
+  static constexpr size_t nDim = NDIM;
+
+  /*--- Closure constants (same values as CSourceBase_TurbSA). ---*/
+  const su2double cv1_3 = pow(7.1, 3.0);
+  const su2double k2 = pow(0.41, 2.0);
+  const su2double cb1 = 0.1355;
+  const su2double cw2 = 0.3;
+  const su2double cw3_6 = pow(2.0, 6.0);
+  const su2double sigma = 2.0 / 3.0;
+  const su2double cb2 = 0.622;
+  const su2double cb2_sigma = cb2 / sigma;
+  const su2double cw1 = cb1 / k2 + (1.0 + cb2) / sigma;
+  const su2double cr1 = 0.5;
+
+  const bool rotating_frame;
+  const bool transitionBC;
+  const su2double intensity; /*!< \brief Free-stream turbulence intensity in percent (BC model). */
+
+public:
+  /*!
+   * \brief Constructor, extract the problem flags from the config.
+   */
+  CSASourceTerms(const CConfig& config) :
+    rotating_frame(config.GetRotating_Frame()),
+    transitionBC(config.GetKind_Trans_Model() == BC),
+    intensity(100 * config.GetTurbulenceIntensity_FreeStream()) {
+  }
+
+  /*!
+   * \brief Source term and Jacobian for one SIMD group of points.
+   * \param[in] nue - SA variable (nu tilde).
+   * \param[in] density - Flow density.
+   * \param[in] laminarVisc - Laminar (dynamic) viscosity.
+   * \param[in] vorticity - Vorticity vector (3 components also in 2D).
+   * \param[in] strainMag - Strain rate magnitude (only used with rotating frame).
+   * \param[in] nueGrad - Gradient of the SA variable.
+   * \param[in] wallDist - Wall distance, already modified for roughness.
+   * \param[in] roughness - Roughness height of the closest wall.
+   * \param[in] volume - Volume of the dual cells.
+   * \param[out] residual - Integrated source term.
+   * \param[out] jacobian - Derivative of the residual w.r.t. nue (1x1 block).
+   * \param[out] gammaBC - Intermittency of the BC transition model (1 otherwise).
+   */
+  FORCEINLINE void Compute(const Double& nue, const Double& density, const Double& laminarVisc,
+                           const VectorDbl<3>& vorticity, const Double& strainMag,
+                           const VectorDbl<nDim>& nueGrad, const Double& wallDist,
+                           const Double& roughness, const Double& volume,
+                           Double& residual, Double& jacobian, Double& gammaBC) const {
+
+    /*--- Evaluate Omega with the rotational correction term. ---*/
+
+    Double Omega = norm(vorticity);
+    if (rotating_frame) Omega += 2.0 * min(0.0, strainMag - Omega);
+
+    /*--- Clip the distance instead of testing it, the "active" factor
+     *    zeroes the result for on-wall points at the end. ---*/
+
+    const Double active = wallDist > 1.0e-10;
+    const Double dist = max(wallDist, 1.0e-10);
+    const Double dist_2 = dist * dist;
+    const Double nu = laminarVisc / density;
+
+    /*--- Production term, with the modified relations for roughness
+     *    (Aupoix & Spalart 2003, roughness is 0 for smooth walls). ---*/
+
+    const Double Ji = nue / nu + cr1 * (roughness / (dist + EPS));
+    const Double Ji_2 = Ji * Ji;
+    const Double Ji_3 = Ji_2 * Ji;
+    const Double fv1 = Ji_3 / (Ji_3 + cv1_3);
+    const Double fv2 = 1.0 - nue / (nu + nue * fv1);
+
+    const Double inv_k2_d2 = 1.0 / (k2 * dist_2);
+
+    const Double Shat = max(Omega + nue * fv2 * inv_k2_d2, 1.0e-10);
+    const Double inv_Shat = 1.0 / Shat;
+
+    Double prodFactor = cb1;
+    gammaBC = 1.0;
+
+    if (transitionBC) {
+
+      /*--- BC model constants (2020 revision). ---*/
+      const su2double chi_1 = 0.002;
+      const su2double chi_2 = 50.0;
+
+      /*--- MENTER correlation, only a function of the turbulence intensity. ---*/
+      const su2double re_theta_t = 803.73 * pow(intensity + 0.6067, -1.027);
+
+      const Double nu_t = nue * fv1;
+      const Double re_theta = density * dist_2 * Omega / laminarVisc / 2.193;
+
+      const Double term1 = sqrt(max(re_theta - re_theta_t, 0.0) / (chi_1 * re_theta_t));
+      const Double term2 = sqrt(max(nu_t * chi_2 / nu, 0.0));
+
+      gammaBC = 1.0 - exp(-(term1 + term2));
+      prodFactor = prodFactor * gammaBC;
+    }
+
+    const Double production = prodFactor * Shat * nue * volume;
+
+    /*--- Destruction term, integer powers by multiplication. ---*/
+
+    const Double r = min(nue * inv_Shat * inv_k2_d2, 10.0);
+    const Double r_2 = r * r;
+    const Double r_5 = r_2 * r_2 * r;
+    const Double g = r + cw2 * (r_5 * r - r);
+    const Double g_2 = g * g;
+    const Double g_6 = g_2 * g_2 * g_2;
+    const Double glim = pow((1.0 + cw3_6) / (g_6 + cw3_6), 1.0 / 6.0);
+    const Double fw = g * glim;
+
+    const Double destruction = cw1 * fw * nue * nue / dist_2 * volume;
+
+    /*--- Diffusion (cross production) term. ---*/
+
+    const Double crossProduction = cb2_sigma * squaredNorm(nueGrad) * volume;
+
+    residual = active * (production - destruction + crossProduction);
+
+    /*--- Implicit part, the comparison factors replace the scalar branches
+     *    that zero the derivatives where the clips are active. ---*/
+
+    const Double dfv1 = 3.0 * Ji_2 * cv1_3 / (nu * (Ji_3 + cv1_3) * (Ji_3 + cv1_3));
+    const Double dfv2_den = 1.0 + Ji * fv1;
+    const Double dfv2 = -(1.0 / nu - Ji_2 * dfv1) / (dfv2_den * dfv2_den);
+    const Double dShat = (Shat > 1.0e-10) * (fv2 + nue * dfv2) * inv_k2_d2;
+
+    const Double dProduction = prodFactor * (nue * dShat + Shat) * volume;
+
+    const Double dr = (r < 10.0) * (Shat - nue * dShat) * inv_Shat * inv_Shat * inv_k2_d2;
+    const Double dg = dr * (1.0 + cw2 * (6.0 * r_5 - 1.0));
+    const Double dfw = dg * glim * (1.0 - g_6 / (g_6 + cw3_6));
+
+    const Double dDestruction = cw1 * (dfw * nue + 2.0 * fw) * nue / dist_2 * volume;
+
+    jacobian = active * (dProduction - dDestruction);
+  }
+};
@@ -33,6 +33,9 @@
 #include <sstream>
 #include <iomanip>
 #include <limits>
+#include <functional>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
@@ -43,6 +46,8 @@ class CGeometry;
 class CSolver;
 class CFileWriter;
 class CParallelDataSorter;
+class CParaviewVTMFileWriter;
+class CProbeOutput;
 class CConfig;
 
 using namespace std;
@@ -81,6 +86,8 @@ protected:
   string historyFilename;   /*!< \brief The history filename*/
   char char_histfile[200];  /*! \brief Temporary variable to store the history filename */
   ofstream histFile;        /*! \brief Output file stream for the history */
+  stringstream histBuffer;  /*! \brief Formatted history rows waiting to be written to histFile */
+  std::thread histWriteThread; /*! \brief Background thread flushing the history buffer to file */
 
   bool cauchyTimeConverged; /*! \brief: Flag indicating that solver is already converged. Needed for writing restart files. */
 
@@ -163,6 +170,22 @@ protected:
 
    CParallelDataSorter* volumeDataSorter;    //!< Volume data sorter
    CParallelDataSorter* surfaceDataSorter;   //!< Surface data sorter
+   CProbeOutput* probeOutput = nullptr;      //!< Time-resolved point probes, allocated on first use
+
+   bool allowAsyncWrites;                    //!< Asynchronous writing was requested and is supported
+   bool deferWriters;                        //!< WriteToFile may queue writers instead of writing (only in SetResult_Files)
+   std::thread asyncWriteThread;             //!< Background thread performing the deferred file writes
+   std::vector<std::pair<CFileWriter*, unsigned short> >
+   asyncWriters;                             //!< Writers (and their format) queued for the background thread
+
+   std::function<void(const CParallelDataSorter*, unsigned long)>
+   coProcessingHook;                         //!< In-situ consumer of the sorted volume data
+
+   std::vector<passivedouble> restartKeyframe; //!< Sorted data of the last full restart, for delta-encoded restarts
+   std::string restartKeyframeName;          //!< Name (without extension) of the last full restart file
+   unsigned long restartDeltaCount = 0;      //!< Restart writes since the last full restart (keyframe)
+
+   CParaviewVTMFileWriter** sharedVTMWriter; //!< Slot of the vtm writer shared between all zones (owned by the driver)
 
    vector<string> volumeFieldNames;     //!< Vector containing the volume field names
    unsigned short nVolumeFields;        /*!< \brief Number of fields in the volume output */
@@ -227,6 +250,10 @@ protected:
   bool convergence;              /*!< \brief To indicate if the solver has converged or not. */
   su2double initResidual;        /*!< \brief Initial value of the residual to evaluate the convergence level. */
   vector<string> convFields;     /*!< \brief Name of the field to be monitored for convergence. */
+  vector<su2double> convFieldEps;  /*!< \brief Per-field tolerance paired with convFields (empty: use the global values). */
+  su2double cauchyVarianceEps;   /*!< \brief Relative standard deviation below which an oscillating coefficient converges. */
+  su2double residualSlopeEps;    /*!< \brief Mean residual slope below which a residual counts as stalled/converged. */
+  vector<vector<su2double> > convValueSerie;  /*!< \brief Window of raw monitored values for the variance and slope criteria. */
 
   /*----------------------------- Adaptive CFL ----------------------------*/
 
@@ -269,6 +296,43 @@ public:
    */
   void Load_Data(CGeometry *geometry, CConfig *config, CSolver **solver_container);
 
+  /*!
+   * \brief Register an in-situ co-processing hook, called with a read-only view of
+   *        the sorted volume data (and the iteration count) at every volume output
+   *        interval, before any file writers run (no files need to be requested).
+   *        The view is only valid for the duration of the call.
+   * \param[in] hook - The callback, pass an empty function to unregister.
+   */
+  void SetCoProcessingHook(std::function<void(const CParallelDataSorter*, unsigned long)> hook) {
+    coProcessingHook = std::move(hook);
+  }
+
+  /*!
+   * \brief Get the volume data sorter, e.g. to query the sorted output data
+   *        after a call to Load_Data.
+   */
+  const CParallelDataSorter* GetVolumeDataSorter() const { return volumeDataSorter; }
+
+  /*!
+   * \brief Register the slot of a vtm writer shared between the outputs of all zones,
+   *        multiblock files are then aggregated into a single write epoch by the driver.
+   * \param[in] writerSlot - Pointer to the driver-owned writer slot.
+   */
+  void SetSharedVTMWriter(CParaviewVTMFileWriter** writerSlot) { sharedVTMWriter = writerSlot; }
+
+  /*!
+   * \brief Wait for the asynchronous write of the previous output files to finish,
+   *        required before re-sorting the output data they read from.
+   */
+  void FlushAsyncWrites();
+
+  /*!
+   * \brief Hand the queued writers to a background thread, which performs the
+   *        (collective) writes while the solver advances the next time steps.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void LaunchAsyncWrites(CConfig *config);
+
   /*!
    * \brief Preprocess the history output by setting the history fields and opening the history file.
    * \param[in] config - Definition of the particular problem.
@@ -466,6 +530,13 @@ public:
   bool SetResult_Files(CGeometry *geometry, CConfig *config, CSolver** solver_container,
                        unsigned long iter, bool force_writing = false);
 
+  /*!
+   * \brief Delete the data sorters and probes, e.g. after mesh adaptation, they are
+   *        re-allocated with the new mesh sizes on the next output. The history
+   *        state is not touched.
+   */
+  void ResetDataSorters();
+
   /*!
    * \brief Get convergence time convergence of the specified windowed-time-averaged ouput of the problem.
    *        Delays solver stop, if Cauchy time convergence criterion is fullfilled, but 2nd order
@@ -500,6 +571,13 @@ protected:
    */
   void SetHistoryFile_Output(const CConfig *config);
 
+  /*!
+   * \brief Write the buffered history rows to the history file on a background
+   * thread, once enough of them accumulated (or immediately if forced).
+   * \param[in] force - Write whatever is buffered, synchronously.
+   */
+  void FlushHistoryBuffer(bool force);
+
   /*!
    * \brief Write the screen header.
    * \param[in] config - Definition of the particular problem.
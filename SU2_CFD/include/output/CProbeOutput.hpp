@@ -0,0 +1,93 @@
+/*!
+ * \file CProbeOutput.hpp
+ * \brief Headers of the probe output class.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "../../../Common/include/basic_types/datatype_structure.hpp"
+
+class CConfig;
+class CGeometry;
+class CSolver;
+
+/*!
+ * \class CProbeOutput
+ * \brief Time-resolved point probes sampled into an in-memory buffer and
+ *        flushed as binary appends, for e.g. microphone signals in aeroacoustics.
+ *
+ * The probes are located once with an ADT search over the grid points, each
+ * probe is owned by the rank holding the nearest node. Sampling a step only
+ * copies the solution of the probed nodes into a local buffer, communication
+ * and file access happen when the buffers are flushed.
+ */
+class CProbeOutput {
+private:
+  int rank;            /*!< \brief MPI rank. */
+  int size;            /*!< \brief MPI size. */
+
+  unsigned short nDim;       /*!< \brief Number of spatial dimensions. */
+  unsigned long nProbe;      /*!< \brief Global number of probes. */
+  unsigned long nVarSample;  /*!< \brief Number of values stored per sample (record size). */
+  unsigned long nSampled;    /*!< \brief Number of steps sampled since the last flush. */
+  unsigned long flushFreq;   /*!< \brief Number of buffered steps between flushes. */
+
+  std::string fileName;      /*!< \brief Name of the binary probe file. */
+  bool headerWritten;        /*!< \brief Whether the file header has been written. */
+
+  std::vector<unsigned long> probeOfRank;  /*!< \brief Global indices of the probes owned by this rank. */
+  std::vector<unsigned long> pointOfProbe; /*!< \brief Local point nearest to each owned probe. */
+  std::vector<passivedouble> probeCoords;  /*!< \brief Coordinates of all probes, written to the header. */
+
+  std::vector<passivedouble> sampleBuf;    /*!< \brief Ring buffer of sample records of the owned probes. */
+
+public:
+  /*!
+   * \brief Constructor, locates the probes defined in the config file.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  CProbeOutput(const CConfig *config, CGeometry *geometry);
+
+  /*!
+   * \brief Destructor, flushes the remaining buffered samples (collective).
+   */
+  ~CProbeOutput();
+
+  /*!
+   * \brief Sample the flow solution at the owned probes (collective, call once per step).
+   * \param[in] solver - The solver containers of the zone.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iter - Current iteration (time iteration in unsteady runs).
+   */
+  void Sample(CSolver **solver, const CConfig *config, unsigned long iter);
+
+  /*!
+   * \brief Gather the buffered samples on the master rank and append them to the binary file.
+   */
+  void Flush();
+};
@@ -31,6 +31,7 @@
 #include <sys/stat.h>
 #include <vector>
 #include <string>
+#include <cstdio>
 #include <cstring>
 #include <fstream>
 
@@ -73,11 +74,42 @@ protected:
       return rc == 0 ? stat_buf.st_size : -1;
   }
 
+  /*!
+   * \brief Append a value in scientific notation (6 digits, as the ASCII writers
+   *        have always used) followed by a tab to an in-memory output buffer.
+   * \param[in,out] buf - Buffer the formatted value is appended to.
+   * \param[in] val - Value to format.
+   */
+  static inline void AppendScientific(std::string& buf, passivedouble val){
+    char str[32];
+    snprintf(str, sizeof(str), "%.6e\t", val);
+    buf += str;
+  }
+
+  /*!
+   * \brief Append an integer value and a separator to an in-memory output buffer.
+   * \param[in,out] buf - Buffer the formatted value is appended to.
+   * \param[in] val - Value to format.
+   * \param[in] sep - Separator appended after the value.
+   */
+  static inline void AppendInteger(std::string& buf, unsigned long val, char sep = '\t'){
+    char str[32];
+    snprintf(str, sizeof(str), "%lu%c", val, sep);
+    buf += str;
+  }
+
   /*!
    * \brief Filename
    */
   string fileName;
 
+  /*!
+   * \brief Temporary name the file is written under, it is renamed to the final
+   *        name once complete so that an interrupted write (e.g. the job being
+   *        killed mid-checkpoint) cannot clobber the previous good file.
+   */
+  string tempName;
+
   /*!
    * \brief The parallel data sorter
    */
@@ -66,6 +66,11 @@ class CParaviewVTMFileWriter final: public CFileWriter{
    */
   su2double accumulatedBandwidth;
 
+  /*!
+   * \brief Write the master file in a single pass (shared writer for all zones)
+   */
+  bool aggregated;
+
 public:
 
   /*!
@@ -80,8 +85,16 @@ public:
    * \param[in] valTime - The current physical time
    * \param[in] valiZone - The index of the current zone
    * \param[in] valnZone - The total number of zones
+   * \param[in] valAggregated - If <TRUE> the writer is shared between all zones and writes the master file in one pass
+   */
+  CParaviewVTMFileWriter(string valFileName, string valFolderName, su2double valTime, unsigned short valiZone,
+                         unsigned short valnZone, bool valAggregated = false);
+
+  /*!
+   * \brief Set the zone the following datasets belong to and create its folder (aggregated mode)
+   * \param[in] valiZone - The index of the current zone
    */
-  CParaviewVTMFileWriter(string valFileName, string valFolderName, su2double valTime, unsigned short valiZone, unsigned short valnZone);
+  void SetCurrentZone(unsigned short valiZone);
 
   /*!
    * \brief Destructor
@@ -30,6 +30,17 @@
 
 class CSU2BinaryFileWriter final: public CFileWriter{
 
+  const bool singlePrec;  //!< Write the data section in single precision (flagged in the header)
+
+  /*!
+   * \brief Sorted data of the keyframe the delta is encoded against, or null for a full write.
+   */
+  const vector<passivedouble>* keyframe;
+
+  /*!
+   * \brief Name of the keyframe restart file (without extension), recorded in the delta file.
+   */
+  string keyframeName;
 
 public:
 
@@ -38,12 +49,27 @@ public:
    */
   const static string fileExt;
 
+  /*!
+   * \brief Magic number flagging a delta-encoded restart file.
+   */
+  static constexpr int MAGIC_DELTA = 535533;
+
+  /*!
+   * \brief Fixed size of the keyframe file name field in delta-encoded files.
+   */
+  static constexpr int KEYFRAME_NAME_SIZE = 256;
+
   /*!
    * \brief Construct a file writer using field names and the data sorter.
    * \param[in] valFileName - The name of the file
    * \param[in] valDataSorter - The parallel sorted data to write
+   * \param[in] valSinglePrec - If <TRUE> write the data section in single precision
+   * \param[in] valKeyframe - If set, only the sparse differences of the sorted data
+   *            against this keyframe snapshot are written (delta-encoded restart).
+   * \param[in] valKeyframeName - Name of the keyframe restart file, without extension.
    */
-  CSU2BinaryFileWriter(string valFileName, CParallelDataSorter* valDataSorter);
+  CSU2BinaryFileWriter(string valFileName, CParallelDataSorter* valDataSorter, bool valSinglePrec = false,
+                       const vector<passivedouble>* valKeyframe = nullptr, string valKeyframeName = "");
 
   /*!
    * \brief Destructor
@@ -55,4 +81,11 @@ public:
    */
   void Write_Data() override;
 
+private:
+
+  /*!
+   * \brief Write the sparse differences against the keyframe snapshot.
+   */
+  void WriteDeltaData();
+
 };
@@ -33,6 +33,9 @@ class CSurfaceFVMDataSorter final: public CParallelDataSorter{
 
   const CFVMDataSorter* volumeSorter;               //!< Pointer to the volume sorter instance
   map<unsigned long,unsigned long> Renumber2Global; //! Structure to map the local sorted point ID to the global point ID
+  bool layoutCached = false;                        //!< Whether the sorted surface layout of a previous write can be reused
+  vector<string> cachedMarkerList;                  //!< Marker list for which the cached surface layout was built
+  vector<unsigned long> surfIndex;                  //!< Local volume-sorter indices of the surface points, in sorted order
 public:
 
   /*!
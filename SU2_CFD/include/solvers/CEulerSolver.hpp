@@ -27,8 +27,11 @@
 
 #pragma once
 
+#include <memory>
+
 #include "CFVMFlowSolverBase.hpp"
 #include "../variables/CEulerVariable.hpp"
+#include "../CSyntheticEddyInflow.hpp"
 
 /*!
  * \class CEulerSolver
@@ -61,6 +64,11 @@ protected:
   Inflow_Pressure_Total = 0.0,   /*!< \brief Fan face pressure for each boundary. */
   Inflow_Mach_Total = 0.0,       /*!< \brief Fan face mach number for each boundary. */
   InverseDesign = 0.0;           /*!< \brief Inverse design functional for each boundary. */
+  vector<unsigned long> SpongePoints;  /*!< \brief Compact list of the points inside the sponge layer support. */
+  bool SpongeMaskValid = false;        /*!< \brief Whether the sponge point list is up to date, it is rebuilt when the mesh moves. */
+
+  vector<unique_ptr<CSyntheticEddyInflow> > SEMInflow; /*!< \brief Synthetic eddy inflow generator of each inlet marker (null if disabled). */
+
   vector<vector<unsigned long> > DonorGlobalIndex;  /*!< \brief Value of the donor global index. */
   vector<su2activematrix> DonorPrimVar;       /*!< \brief Value of the donor variables at each boundary. */
   vector<vector<su2double> > ActDisk_DeltaP;  /*!< \brief Value of the Delta P. */
@@ -171,6 +179,13 @@ protected:
   void SetFarfield_AoA(CGeometry *geometry, CSolver **solver_container,
                        CConfig *config, unsigned short iMesh, bool Output);
 
+  /*!
+   * \brief Recompute the freestream velocity vector from the flow angles of the
+   *        config, keeping its magnitude ("Velocity_Inf" is shared with config).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void UpdateFarfieldVelocity(const CConfig *config) final;
+
   /*!
    * \brief Compute Ducros Sensor for Roe Dissipation.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -708,6 +723,18 @@ public:
                               CConfig *config,
                               unsigned short iRKStep) final;
 
+  /*!
+   * \brief Update the solution using the strong-stability-preserving third-order RK scheme.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iRKStep - Current step of the Runge-Kutta iteration.
+   */
+  void SSPRK3_Iteration(CGeometry *geometry,
+                        CSolver **solver_container,
+                        CConfig *config,
+                        unsigned short iRKStep) final;
+
   /*!
    * \brief Check for convergence of the Fixed CL mode to the target CL
    * \param[in] config - Definition of the particular problem.
@@ -104,6 +104,12 @@ protected:
   DummyVectorOfLocks UpdateLocks;
 #endif
 
+  /*--- Cached positions in the Jacobian sparse pattern of the node-pair blocks of each element,
+   *    the scatter pattern does not change between (nonlinear) iterations and searching it is
+   *    a large part of the assembly cost. Built on first use. ---*/
+  vector<unsigned long> ElemKBlockOffset;  /*!< \brief Start of each element's entries in ElemKBlocks. */
+  vector<unsigned long> ElemKBlocks;       /*!< \brief Block positions, nNodes^2 per element, row major. */
+
   bool element_based;          /*!< \brief Bool to determine if an element-based file is used. */
   bool topol_filter_applied;   /*!< \brief True if density filtering has been performed. */
   bool initial_calc = true;    /*!< \brief Becomes false after first call to Preprocessing. */
@@ -287,6 +293,12 @@ public:
     return geometry->nodes->GetCoord(indexNode, iDim);
   }
 
+  /*!
+   * \brief Build the cached element-to-Jacobian scatter map (no-op if already built).
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void BuildStiffnessScatterMap(const CGeometry *geometry);
+
   /*!
    * \brief Compute the stiffness matrix of the problem.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -168,6 +168,10 @@ protected:
                                                                        elements of a higher time level and the time integration
                                                                        points for ADER-DG. */
 
+  vector<su2double> timeInterpolTimesWeightADER_DG; /*!< \brief Product of the time integration weights (including the factor 1/2
+                                                                of the parameter interval) and the time interpolation matrix,
+                                                                precomputed for the ADER-DG predictor step. */
+
   unsigned int sizeWorkArray;     /*!< \brief The size of the work array needed. */
 
   vector<su2double> TolSolADER;   /*!< \brief Vector, which stores the tolerances for the conserved
@@ -215,6 +215,23 @@ class CFVMFlowSolverBase : public CSolver {
 
   CNumericsSIMD* edgeNumerics = nullptr; /*!< \brief Object for edge flux computation. */
 
+  /*--- Dual time stepping, the part of the source term built from the solutions
+   * at time n and n-1 (and the GCL terms on dynamic grids) is constant during
+   * the sub-iterations of a physical time step, hence it is precomputed once
+   * per time step instead of being rebuilt in every sub-iteration. ---*/
+
+  CSysVector<su2double> DualTime_Residual;  /*!< \brief Constant-in-subiteration part of the dual time source term, allocated lazily. */
+  unsigned long DualTime_TimeIter = 0;      /*!< \brief Time iteration for which DualTime_Residual was computed. */
+  unsigned long DualTime_OuterIter = 0;     /*!< \brief Outer iteration for which DualTime_Residual was computed (multizone meshes may deform per outer iteration). */
+
+  /*--- Incremental limiter computation, the limiter of a point is only recomputed
+   * when the primitives of its stencil changed significantly since the values
+   * stored at the last (full or partial) recomputation. ---*/
+
+  su2activematrix LimiterFieldRef;     /*!< \brief Primitives at the last limiter recomputation. */
+  su2vector<bool> LimiterPointChanged; /*!< \brief Points whose primitives changed beyond the threshold. */
+  su2vector<bool> LimiterRecompute;    /*!< \brief Points whose limiter must be recomputed. */
+
   /*!
    * \brief The highest level in the variable hierarchy the DERIVED solver can safely use.
    */
@@ -228,7 +245,7 @@ class CFVMFlowSolverBase : public CSolver {
   /*!
    * \brief Default constructor, this class is not directly instantiable.
    */
-  CFVMFlowSolverBase() : CSolver() {}
+  CFVMFlowSolverBase() : CSolver() { JacobianFreezeCapable = true; }
 
   /*!
    * \brief Set reference values for pressure, forces, etc., e.g. "AeroCoeffForceRef".
@@ -278,6 +295,14 @@ class CFVMFlowSolverBase : public CSolver {
    */
   void SumEdgeFluxes(const CGeometry* geometry);
 
+  /*!
+   * \brief Determine the points whose limiter must be recomputed (incremental mode).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \return Mask of points to recompute, or nullptr on full recomputations.
+   */
+  const su2vector<bool>* LimiterRecomputeMask(const CGeometry* geometry, const CConfig* config);
+
   /*!
    * \brief Computes and sets the required auxilliary vars (and gradients) for axisymmetric flow.
    */
@@ -357,10 +382,48 @@ class CFVMFlowSolverBase : public CSolver {
 
     ompMasterAssignBarrier(Min_Delta_Time,1e30, Max_Delta_Time,0.0, Global_Delta_UnstTimeND,1e30);
 
-    /*--- Loop domain points. ---*/
+    /*--- Thread-local variables for min/max reduction, shared between the
+     *    fused interior pass and the boundary-point pass below. ---*/
+
+    su2double minDt = 1e30, maxDt = 0.0;
+
+    /*--- Time step of one point from its accumulated eigenvalues. Called from
+     *    the accumulation loop for interior points, whose eigenvalues are
+     *    complete once their neighbors were visited, so they do not have to be
+     *    streamed through the cache a second time by a separate pass. ---*/
+
+    auto pointTimeStep = [&](unsigned long iPoint) {
+
+      su2double Vol = geometry->nodes->GetVolume(iPoint);
+
+      if (Vol != 0.0) {
+        su2double Local_Delta_Time = nodes->GetLocalCFL(iPoint)*Vol / nodes->GetMax_Lambda_Inv(iPoint);
+
+        if(viscous) {
+          su2double dt_visc = nodes->GetLocalCFL(iPoint)*K_v*Vol*Vol / nodes->GetMax_Lambda_Visc(iPoint);
+          Local_Delta_Time = min(Local_Delta_Time, dt_visc);
+        }
+
+        minDt = min(minDt, Local_Delta_Time);
+        maxDt = max(maxDt, Local_Delta_Time);
+
+        nodes->SetDelta_Time(iPoint, min(Local_Delta_Time, config->GetMax_DeltaTime()));
+      }
+      else {
+        nodes->SetDelta_Time(iPoint,0.0);
+      }
+    };
+
+    /*--- Loop domain points, following the space-filling-curve iteration
+     *    order if one was built so that the indirect neighbor accesses of
+     *    consecutive points hit nearby cache lines. ---*/
+
+    const auto& sfc = geometry->GetSFCOrder();
 
     SU2_OMP_FOR_DYN(omp_chunk_size)
-    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    for (auto kPoint = 0ul; kPoint < nPointDomain; ++kPoint) {
+
+      const auto iPoint = sfc.empty()? kPoint : sfc[kPoint];
 
       /*--- Set maximum eigenvalues to zero. ---*/
 
@@ -407,6 +470,11 @@ class CFVMFlowSolverBase : public CSolver {
         nodes->AddMax_Lambda_Visc(iPoint, Lambda);
       }
 
+      /*--- Interior points have no boundary contributions, their time step
+       *    follows immediately while the eigenvalues are still in cache. ---*/
+
+      if (!geometry->nodes->GetBoundary(iPoint)) pointTimeStep(iPoint);
+
     }
     END_SU2_OMP_FOR
 
@@ -456,55 +524,34 @@ class CFVMFlowSolverBase : public CSolver {
       }
     }
 
-    /*--- Each element uses their own speed, steady state simulation. ---*/
+    /*--- Each element uses their own speed, steady state simulation. The
+     *    interior points were handled in the accumulation loop, only the
+     *    boundary points had contributions added since then. ---*/
     {
-      /*--- Thread-local variables for min/max reduction. ---*/
-      su2double minDt = 1e30, maxDt = 0.0;
-
       SU2_OMP_FOR_(schedule(static,omp_chunk_size) SU2_NOWAIT)
       for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
-
-        su2double Vol = geometry->nodes->GetVolume(iPoint);
-
-        if (Vol != 0.0) {
-          su2double Local_Delta_Time = nodes->GetLocalCFL(iPoint)*Vol / nodes->GetMax_Lambda_Inv(iPoint);
-
-          if(viscous) {
-            su2double dt_visc = nodes->GetLocalCFL(iPoint)*K_v*Vol*Vol / nodes->GetMax_Lambda_Visc(iPoint);
-            Local_Delta_Time = min(Local_Delta_Time, dt_visc);
-          }
-
-          minDt = min(minDt, Local_Delta_Time);
-          maxDt = max(maxDt, Local_Delta_Time);
-
-          nodes->SetDelta_Time(iPoint, min(Local_Delta_Time, config->GetMax_DeltaTime()));
-        }
-        else {
-          nodes->SetDelta_Time(iPoint,0.0);
-        }
+        if (geometry->nodes->GetBoundary(iPoint)) pointTimeStep(iPoint);
       }
       END_SU2_OMP_FOR
-      /*--- Min/max over threads. ---*/
-      SU2_OMP_CRITICAL
-      {
-        Min_Delta_Time = min(Min_Delta_Time, minDt);
-        Max_Delta_Time = max(Max_Delta_Time, maxDt);
-        Global_Delta_Time = Min_Delta_Time;
-      }
-      END_SU2_OMP_CRITICAL
-      SU2_OMP_BARRIER
+      /*--- Min/max over threads, merged once without a critical section. ---*/
+      using MinMax = pair<su2double,su2double>;
+      const MinMax dtLocal = ompThreadReduction(MinMax(minDt, maxDt),
+        [](const MinMax& a, const MinMax& b) {
+          return MinMax(min(a.first,b.first), max(a.second,b.second));
+        });
+      ompMasterAssignBarrier(Min_Delta_Time,dtLocal.first, Max_Delta_Time,dtLocal.second,
+                             Global_Delta_Time,dtLocal.first);
     }
 
-    /*--- Compute the min/max dt (in parallel, now over mpi ranks). ---*/
+    /*--- Compute the min/max dt (in parallel, now over mpi ranks), the max is
+     *    negated so that the two values travel in one MPI_MIN message. ---*/
 
     SU2_OMP_MASTER
     if (config->GetComm_Level() == COMM_FULL) {
-      su2double rbuf_time;
-      SU2_MPI::Allreduce(&Min_Delta_Time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
-      Min_Delta_Time = rbuf_time;
-
-      SU2_MPI::Allreduce(&Max_Delta_Time, &rbuf_time, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
-      Max_Delta_Time = rbuf_time;
+      su2double sbuf_time[2] = {Min_Delta_Time, -Max_Delta_Time}, rbuf_time[2];
+      SU2_MPI::Allreduce(sbuf_time, rbuf_time, 2, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
+      Min_Delta_Time = rbuf_time[0];
+      Max_Delta_Time = -rbuf_time[1];
     }
     END_SU2_OMP_MASTER
     SU2_OMP_BARRIER
@@ -554,14 +601,12 @@ class CFVMFlowSolverBase : public CSolver {
         glbDtND = min(glbDtND, config->GetUnst_CFL()*Global_Delta_Time / nodes->GetLocalCFL(iPoint));
       }
       END_SU2_OMP_FOR
-      SU2_OMP_CRITICAL
-      Global_Delta_UnstTimeND = min(Global_Delta_UnstTimeND, glbDtND);
-      END_SU2_OMP_CRITICAL
-      SU2_OMP_BARRIER
+      /*--- Min over threads, merged once without a critical section. ---*/
+      glbDtND = ompThreadReduction(glbDtND,
+        [](const su2double& a, const su2double& b) {return min(a,b);});
 
       SU2_OMP_MASTER {
-        SU2_MPI::Allreduce(&Global_Delta_UnstTimeND, &glbDtND, 1, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
-        Global_Delta_UnstTimeND = glbDtND;
+        SU2_MPI::Allreduce(&glbDtND, &Global_Delta_UnstTimeND, 1, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
 
         config->SetDelta_UnstTimeND(Global_Delta_UnstTimeND);
       }
@@ -765,16 +810,34 @@ class CFVMFlowSolverBase : public CSolver {
 
     static_assert(IntegrationType == CLASSICAL_RK4_EXPLICIT ||
                   IntegrationType == RUNGE_KUTTA_EXPLICIT ||
+                  IntegrationType == SSPRK3_EXPLICIT ||
                   IntegrationType == EULER_EXPLICIT, "");
 
     const bool adjoint = config->GetContinuous_Adjoint();
 
-    const su2double RK_AlphaCoeff = config->Get_Alpha_RKStep(iRKStep);
+    /*--- The alpha coefficients of the config only apply to RUNGE_KUTTA_EXPLICIT,
+     *    for the other schemes iRKStep may exceed the size of the list. ---*/
+    const su2double RK_AlphaCoeff = (IntegrationType == RUNGE_KUTTA_EXPLICIT)?
+                                    config->Get_Alpha_RKStep(iRKStep) : su2double(1.0);
 
     /*--- Hard-coded classical RK4 coefficients. Will be added to config. ---*/
     const su2double RK_FuncCoeff[] = {1.0/6.0, 1.0/3.0, 1.0/3.0, 1.0/6.0};
     const su2double RK_TimeCoeff[] = {0.5, 0.5, 1.0, 1.0};
 
+    /*--- SSP-RK3 (Shu-Osher) coefficients, each stage is the convex combination
+     *    u = omega*u_old + beta*(u - dt*R), only the old solution is needed as
+     *    extra storage (2N scheme). ---*/
+    constexpr passivedouble SSPRK_Omega[] = {0.0, 0.75, 1.0/3.0};
+    constexpr passivedouble SSPRK_Beta[]  = {1.0, 0.25, 2.0/3.0};
+
+    /*--- Optional residual smoothing, increases the stable time step of the
+     *    explicit schemes at the cost of a few Jacobi sweeps. ---*/
+
+    if (config->GetResidual_Smoothing_Sweeps() > 0) {
+      Residual_Smoothing(geometry, config, config->GetResidual_Smoothing_Sweeps(),
+                         config->GetResidual_Smoothing_Coeff());
+    }
+
     /*--- Set shared residual variables to 0 and declare
      *    local ones for current thread to work on. ---*/
 
@@ -784,6 +847,8 @@ class CFVMFlowSolverBase : public CSolver {
     const su2double* coordMax[MAXNVAR] = {nullptr};
     unsigned long idxMax[MAXNVAR] = {0};
 
+    const auto resStride = ResidualSamplingStride(config);
+
     /*--- Update the solution and residuals ---*/
 
     if (!adjoint) {
@@ -813,6 +878,12 @@ class CFVMFlowSolverBase : public CSolver {
               nodes->AddSolution(iPoint, iVar, -Res*Delta*RK_AlphaCoeff);
               break;
 
+            case SSPRK3_EXPLICIT:
+              /*--- Fused single-pass stage combination. ---*/
+              nodes->SetSolution(iPoint, iVar, SSPRK_Omega[iRKStep]*nodes->GetSolution_Old(iPoint,iVar) +
+                                 SSPRK_Beta[iRKStep]*(nodes->GetSolution(iPoint,iVar) - Res*Delta));
+              break;
+
             case CLASSICAL_RK4_EXPLICIT:
             {
               su2double tmp_time = -1.0*RK_TimeCoeff[iRKStep]*Delta;
@@ -831,12 +902,15 @@ class CFVMFlowSolverBase : public CSolver {
             break;
           }
 
-          /*--- Update residual information for current thread. ---*/
-          resRMS[iVar] += Res*Res;
-          if (fabs(Res) > resMax[iVar]) {
-            resMax[iVar] = fabs(Res);
-            idxMax[iVar] = iPoint;
-            coordMax[iVar] = geometry->nodes->GetCoord(iPoint);
+          /*--- Update residual information for current thread, restricted to
+           a deterministic point subset on the sampled iterations. ---*/
+          if ((iPoint % resStride) == 0) {
+            resRMS[iVar] += Res*Res;
+            if (fabs(Res) > resMax[iVar]) {
+              resMax[iVar] = fabs(Res);
+              idxMax[iVar] = iPoint;
+              coordMax[iVar] = geometry->nodes->GetCoord(iPoint);
+            }
           }
         }
       }
@@ -844,7 +918,7 @@ class CFVMFlowSolverBase : public CSolver {
       /*--- Reduce residual information over all threads in this rank. ---*/
       SU2_OMP_CRITICAL
       for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-        Residual_RMS[iVar] += resRMS[iVar];
+        Residual_RMS[iVar] += resStride*resRMS[iVar];
         AddRes_Max(iVar, resMax[iVar], geometry->nodes->GetGlobalIndex(idxMax[iVar]), coordMax[iVar]);
       }
       END_SU2_OMP_CRITICAL
@@ -891,7 +965,8 @@ class CFVMFlowSolverBase : public CSolver {
   template<class DiagonalPrecond>
   void PrepareImplicitIteration_impl(DiagonalPrecond& preconditioner, CGeometry *geometry, CConfig *config) {
 
-    const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+    /*--- A frozen Jacobian keeps the pseudotime term from the iteration that assembled it. ---*/
+    const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !JacobianFrozen;
 
     /*--- Set shared residual variables to 0 and declare local ones for current thread to work on. ---*/
 
@@ -901,6 +976,8 @@ class CFVMFlowSolverBase : public CSolver {
     const su2double* coordMax[MAXNVAR] = {nullptr};
     unsigned long idxMax[MAXNVAR] = {0};
 
+    const auto resStride = ResidualSamplingStride(config);
+
     /*--- Add pseudotime term to Jacobian. ---*/
 
     if (implicit) {
@@ -948,19 +1025,24 @@ class CFVMFlowSolverBase : public CSolver {
         LinSysRes[total_index] = - (LinSysRes[total_index] + local_Res_TruncError[iVar]);
         LinSysSol[total_index] = 0.0;
 
-        su2double Res = fabs(LinSysRes[total_index]);
-        resRMS[iVar] += Res*Res;
-        if (Res > resMax[iVar]) {
-          resMax[iVar] = Res;
-          idxMax[iVar] = iPoint;
-          coordMax[iVar] = geometry->nodes->GetCoord(iPoint);
+        /*--- Residual bookkeeping, restricted to a deterministic point subset
+         on the sampled iterations (the stride is 1 otherwise). ---*/
+
+        if ((iPoint % resStride) == 0) {
+          su2double Res = fabs(LinSysRes[total_index]);
+          resRMS[iVar] += Res*Res;
+          if (Res > resMax[iVar]) {
+            resMax[iVar] = Res;
+            idxMax[iVar] = iPoint;
+            coordMax[iVar] = geometry->nodes->GetCoord(iPoint);
+          }
         }
       }
     }
     END_SU2_OMP_FOR
     SU2_OMP_CRITICAL
     for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-      Residual_RMS[iVar] += resRMS[iVar];
+      Residual_RMS[iVar] += resStride*resRMS[iVar];
       AddRes_Max(iVar, resMax[iVar], geometry->nodes->GetGlobalIndex(idxMax[iVar]), coordMax[iVar]);
     }
     END_SU2_OMP_CRITICAL
@@ -1016,8 +1098,24 @@ class CFVMFlowSolverBase : public CSolver {
 
     su2double strainMax = 0.0, omegaMax = 0.0;
 
+    /*--- Some consumers read the vorticity or strain magnitude at halo points: the
+     *    Ducros sensor of the low dissipation schemes, the SST shear-stress limiter
+     *    (Postprocessing evaluates muT over all points before the halo exchange of
+     *    the viscous fluxes), and the vortex tilting measure of SA-EDDES (averaged
+     *    over the neighbors in SetDES_LengthScale). The remaining consumers
+     *    (turbulence sources, the volume output) loop over owned points, skip the
+     *    halos in that case, the halo primitive gradients this kernel would read
+     *    are valid in both cases. ---*/
+
+    const bool haloVorticityNeeded = (config.GetKind_RoeLowDiss() == FD_DUCROS) ||
+                                     (config.GetKind_RoeLowDiss() == NTS_DUCROS) ||
+                                     (config.GetKind_Turb_Model() == TURB_MODEL::SST) ||
+                                     (config.GetKind_Turb_Model() == TURB_MODEL::SST_SUST) ||
+                                     (config.GetKind_HybridRANSLES() == SA_EDDES);
+    const unsigned long nPointComp = haloVorticityNeeded ? nPoint : nPointDomain;
+
     SU2_OMP_FOR_STAT(omp_chunk_size)
-    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    for (unsigned long iPoint = 0; iPoint < nPointComp; ++iPoint) {
 
       const auto VelocityGradient = nodes->GetGradient_Primitive(iPoint, VelocityOffset);
       auto Vorticity = nodes->GetVorticity(iPoint);
@@ -1043,27 +1141,29 @@ class CFVMFlowSolverBase : public CSolver {
         Div += VelocityGradient(iDim, iDim);
       Div /= 3.0;
 
-      StrainMag(iPoint) = 0.0;
+      /*--- Accumulate in a local variable so the sum stays in registers. ---*/
+
+      su2double strain = 0.0;
 
       /*--- Add diagonal part ---*/
 
       for (unsigned long iDim = 0; iDim < nDim; iDim++) {
-        StrainMag(iPoint) += pow(VelocityGradient(iDim, iDim) - Div, 2);
+        strain += pow(VelocityGradient(iDim, iDim) - Div, 2);
       }
       if (nDim == 2) {
-        StrainMag(iPoint) += pow(Div, 2);
+        strain += pow(Div, 2);
       }
 
       /*--- Add off diagonals ---*/
 
-      StrainMag(iPoint) += 2.0*pow(0.5*(VelocityGradient(0,1) + VelocityGradient(1,0)), 2);
+      strain += 2.0*pow(0.5*(VelocityGradient(0,1) + VelocityGradient(1,0)), 2);
 
       if (nDim == 3) {
-        StrainMag(iPoint) += 2.0*pow(0.5*(VelocityGradient(0,2) + VelocityGradient(2,0)), 2);
-        StrainMag(iPoint) += 2.0*pow(0.5*(VelocityGradient(1,2) + VelocityGradient(2,1)), 2);
+        strain += 2.0*pow(0.5*(VelocityGradient(0,2) + VelocityGradient(2,0)), 2);
+        strain += 2.0*pow(0.5*(VelocityGradient(1,2) + VelocityGradient(2,1)), 2);
       }
 
-      StrainMag(iPoint) = sqrt(2.0*StrainMag(iPoint));
+      StrainMag(iPoint) = sqrt(2.0*strain);
       AD::SetPreaccOut(StrainMag(iPoint));
 
       /*--- Max is not differentiable, so we not register them for preacc. ---*/
@@ -1075,19 +1175,18 @@ class CFVMFlowSolverBase : public CSolver {
     END_SU2_OMP_FOR
 
     if ((iMesh == MESH_0) && (config.GetComm_Level() == COMM_FULL)) {
-      SU2_OMP_CRITICAL {
-        StrainMag_Max = max(StrainMag_Max, strainMax);
-        Omega_Max = max(Omega_Max, omegaMax);
-      }
-      END_SU2_OMP_CRITICAL
+      /*--- Max over threads, merged once without a critical section. ---*/
+      using MaxPair = pair<su2double,su2double>;
+      const MaxPair myMax = ompThreadReduction(MaxPair(strainMax, omegaMax),
+        [](const MaxPair& a, const MaxPair& b) {
+          return MaxPair(max(a.first,b.first), max(a.second,b.second));
+        });
 
-      SU2_OMP_BARRIER
       SU2_OMP_MASTER {
-        su2double MyOmega_Max = Omega_Max;
-        su2double MyStrainMag_Max = StrainMag_Max;
-
-        SU2_MPI::Allreduce(&MyStrainMag_Max, &StrainMag_Max, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
-        SU2_MPI::Allreduce(&MyOmega_Max, &Omega_Max, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+        su2double sbuf[2] = {myMax.first, myMax.second}, rbuf[2];
+        SU2_MPI::Allreduce(sbuf, rbuf, 2, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+        StrainMag_Max = rbuf[0];
+        Omega_Max = rbuf[1];
       }
       END_SU2_OMP_MASTER
       SU2_OMP_BARRIER
@@ -1151,6 +1250,15 @@ class CFVMFlowSolverBase : public CSolver {
    */
   void SetPrimitive_Limiter(CGeometry* geometry, const CConfig* config) final;
 
+  /*!
+   * \brief Compute the Green-Gauss reconstruction gradient and the limiter of the
+   *        primitive variables in a single sweep, falls back to the separate
+   *        computations when fusion is not possible.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetPrimitive_Gradient_Limiter(CGeometry* geometry, const CConfig* config);
+
   /*!
    * \brief Implementation of implicit Euler iteration.
    */
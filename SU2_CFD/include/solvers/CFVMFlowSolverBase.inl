@@ -29,9 +29,31 @@
 #include "../gradients/computeGradientsGreenGauss.hpp"
 #include "../gradients/computeGradientsLeastSquares.hpp"
 #include "../limiters/computeLimiters.hpp"
+#include "../gradients/computeGradientsAndLimiters.hpp"
 #include "../numerics_simd/CNumericsSIMD.hpp"
 #include "CFVMFlowSolverBase.hpp"
 
+/*!
+ * \brief Sum a set of scalars and per-marker arrays over all ranks using a single
+ *        reduction, many small messages are latency-bound at scale.
+ */
+template <size_t nScalar, size_t nArray>
+void packedCoeffAllreduce(su2double* (&scalars)[nScalar], su2double* (&arrays)[nArray], int arraySize) {
+  vector<su2double> sendBuf;
+  sendBuf.reserve(nScalar + nArray * arraySize);
+  for (const auto* scalar : scalars) sendBuf.push_back(*scalar);
+  for (const auto* array : arrays) sendBuf.insert(sendBuf.end(), array, array + arraySize);
+
+  vector<su2double> recvBuf(sendBuf.size());
+  SU2_MPI::Allreduce(sendBuf.data(), recvBuf.data(), static_cast<int>(sendBuf.size()), MPI_DOUBLE, MPI_SUM,
+                     SU2_MPI::GetComm());
+
+  int k = 0;
+  for (auto* scalar : scalars) *scalar = recvBuf[k++];
+  for (auto* array : arrays)
+    for (int i = 0; i < arraySize; ++i) array[i] = recvBuf[k++];
+}
+
 template <class V, ENUM_REGIME R>
 void CFVMFlowSolverBase<V, R>::AeroCoeffsArray::allocate(int size) {
   _size = size;
@@ -360,7 +382,8 @@ void CFVMFlowSolverBase<V, R>::SetPrimitive_Gradient_GG(CGeometry* geometry, con
   const auto comm = reconstruction? PRIMITIVE_GRAD_REC : PRIMITIVE_GRADIENT;
   const auto commPer = reconstruction? PERIODIC_PRIM_GG_R : PERIODIC_PRIM_GG;
 
-  computeGradientsGreenGauss(this, comm, commPer, *geometry, *config, primitives, 0, nPrimVarGrad, gradient);
+  computeGradientsGreenGauss(this, comm, commPer, *geometry, *config, primitives, 0, GetnPrimVarGradActive(),
+                             gradient);
 }
 
 template <class V, ENUM_REGIME R>
@@ -384,8 +407,83 @@ void CFVMFlowSolverBase<V, R>::SetPrimitive_Gradient_LS(CGeometry* geometry, con
   auto& gradient = reconstruction ? nodes->GetGradient_Reconstruction() : nodes->GetGradient_Primitive();
   const auto comm = reconstruction? PRIMITIVE_GRAD_REC : PRIMITIVE_GRADIENT;
 
-  computeGradientsLeastSquares(this, comm, commPer, *geometry, *config, weighted,
-                               primitives, 0, nPrimVarGrad, gradient, rmatrix);
+  /*--- On static grids the pseudoinverse of the least squares problem can be cached,
+   *    in the discrete adjoint that would detach the gradient from the coordinates. ---*/
+  auto* smatrixCache = (config->GetDynamic_Grid() || config->GetDeform_Mesh() || config->GetDiscrete_Adjoint())?
+                       nullptr : nodes->GetSmatrixCache(weighted);
+
+  computeGradientsLeastSquares(this, comm, commPer, *geometry, *config, weighted, primitives, 0,
+                               GetnPrimVarGradActive(), gradient, rmatrix, smatrixCache);
+}
+
+template <class V, ENUM_REGIME R>
+const su2vector<bool>* CFVMFlowSolverBase<V, R>::LimiterRecomputeMask(const CGeometry* geometry, const CConfig* config) {
+
+  const su2double threshold = config->GetLimiterRecomputeThreshold();
+
+  /*--- The incremental mode requires comparable limiters across periodic pairs,
+   *    and a complete tape in the discrete adjoint. ---*/
+
+  if ((threshold <= 0.0) || (config->GetnMarker_Periodic() > 0) || config->GetDiscrete_Adjoint())
+    return nullptr;
+
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+
+  /*--- Recompute everywhere on the first call and periodically thereafter. ---*/
+
+  const bool fullRefresh = (LimiterFieldRef.rows() != nPoint) ||
+                           (config->GetInnerIter() % config->GetLimiterRefreshPeriod() == 0);
+
+  if (fullRefresh) {
+    SU2_OMP_MASTER {
+      LimiterFieldRef.resize(nPoint, nPrimVarGrad);
+      LimiterPointChanged.resize(nPoint);
+      LimiterRecompute.resize(nPointDomain);
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+      for (auto iVar = 0u; iVar < nPrimVarGrad; ++iVar)
+        LimiterFieldRef(iPoint, iVar) = nodes->GetPrimitive(iPoint, iVar);
+    END_SU2_OMP_FOR
+
+    return nullptr;
+  }
+
+  /*--- Flag the points (including halos) whose primitives changed significantly
+   *    since the reference values, and update the reference of those points (the
+   *    limiters that depend on them are recomputed below, so small changes cannot
+   *    accumulate without ever triggering a recomputation). ---*/
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    bool changed = false;
+    for (auto iVar = 0u; iVar < nPrimVarGrad; ++iVar) {
+      const su2double ref = LimiterFieldRef(iPoint, iVar);
+      changed = changed || (fabs(nodes->GetPrimitive(iPoint, iVar) - ref) > threshold * max(fabs(ref), EPS));
+    }
+    LimiterPointChanged(iPoint) = changed;
+    if (changed)
+      for (auto iVar = 0u; iVar < nPrimVarGrad; ++iVar)
+        LimiterFieldRef(iPoint, iVar) = nodes->GetPrimitive(iPoint, iVar);
+  }
+  END_SU2_OMP_FOR
+
+  /*--- The limiter of a point depends on its direct neighbors. ---*/
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    bool recompute = LimiterPointChanged(iPoint);
+    for (auto jPoint : geometry->nodes->GetPoints(iPoint))
+      recompute = recompute || LimiterPointChanged(jPoint);
+    LimiterRecompute(iPoint) = recompute;
+  }
+  END_SU2_OMP_FOR
+
+  return &LimiterRecompute;
 }
 
 template <class V, ENUM_REGIME R>
@@ -397,8 +495,38 @@ void CFVMFlowSolverBase<V, R>::SetPrimitive_Limiter(CGeometry* geometry, const C
   auto& primMax = nodes->GetSolution_Max();
   auto& limiter = nodes->GetLimiter_Primitive();
 
+  /*--- In incremental mode only the points whose stencil changed are recomputed. ---*/
+  const auto* recomputeMask = LimiterRecomputeMask(geometry, config);
+
   computeLimiters(kindLimiter, this, PRIMITIVE_LIMITER, PERIODIC_LIM_PRIM_1, PERIODIC_LIM_PRIM_2, *geometry, *config, 0,
-                  nPrimVarGrad, primitives, gradient, primMin, primMax, limiter);
+                  nPrimVarGrad, primitives, gradient, primMin, primMax, limiter, recomputeMask);
+}
+
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::SetPrimitive_Gradient_Limiter(CGeometry* geometry, const CConfig* config) {
+  /*--- The fused kernel cannot insert the intermediate communications required by
+   *    periodic boundaries, it cannot freeze the limiter without also freezing
+   *    the gradient, and it cannot skip points in incremental limiter mode, in
+   *    those cases fall back to the separate computations. ---*/
+
+  const bool frozen = config->GetDiscrete_Adjoint() && config->GetFrozen_Limiter_Disc();
+  const bool incremental = config->GetLimiterRecomputeThreshold() > 0.0;
+
+  if ((config->GetnMarker_Periodic() > 0) || frozen || incremental) {
+    SetPrimitive_Gradient_GG(geometry, config, true);
+    SetPrimitive_Limiter(geometry, config);
+    return;
+  }
+
+  const auto kindLimiter = static_cast<ENUM_LIMITER>(config->GetKind_SlopeLimit_Flow());
+  const auto& primitives = nodes->GetPrimitive();
+  auto& gradient = nodes->GetGradient_Reconstruction();
+  auto& primMin = nodes->GetSolution_Min();
+  auto& primMax = nodes->GetSolution_Max();
+  auto& limiter = nodes->GetLimiter_Primitive();
+
+  computeGradientsAndLimiters(kindLimiter, this, PRIMITIVE_GRAD_REC_LIM, *geometry, *config, 0,
+                              nPrimVarGrad, primitives, gradient, primMin, primMax, limiter);
 }
 
 template <class V, ENUM_REGIME R>
@@ -927,7 +1055,7 @@ void CFVMFlowSolverBase<V, R>::LoadRestart_impl(CGeometry **geometry, CSolver **
   /*--- Delete the class memory that is used to load the restart. ---*/
 
   delete [] Restart_Vars; Restart_Vars = nullptr;
-  delete [] Restart_Data; Restart_Data = nullptr;
+  FreeRestartData();
 
   }
   END_SU2_OMP_MASTER
@@ -1615,171 +1743,216 @@ void CFVMFlowSolverBase<V, FlowRegime>::SetResidual_DualTime(CGeometry *geometry
 
   TimeStep = config->GetDelta_UnstTimeND();
 
-  /*--- Compute the dual time-stepping source term for static meshes ---*/
+  /*--- The contributions built from the solutions at time n and n-1 (and, on
+   dynamic grids, the GCL terms) are constant during the sub-iterations of a
+   physical time step. They are precomputed once per time step (per outer
+   iteration in multizone cases, where the mesh may deform between outer
+   iterations) into DualTime_Residual, which is allocated lazily since steady
+   computations never need it. While the tape for the discrete adjoint is being
+   recorded the precomputation cannot be reused, because the stored values
+   would not be part of the active computational graph. ---*/
+
+  const bool rebuild = (DualTime_Residual.GetLocSize() == 0) ||
+                       (DualTime_TimeIter != config->GetTimeIter()) ||
+                       (DualTime_OuterIter != config->GetOuterIter()) ||
+                       AD::TapeActive();
+
+  if (rebuild) {
+
+    SU2_OMP_MASTER {
+      if (DualTime_Residual.GetLocSize() == 0)
+        DualTime_Residual.Initialize(nPoint, nPointDomain, nVar, 0.0);
+      DualTime_TimeIter = config->GetTimeIter();
+      DualTime_OuterIter = config->GetOuterIter();
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
 
-  if (!dynamic_grid) {
+    /*--- Compute the constant part of the source term for static meshes ---*/
 
-    /*--- Loop over all nodes (excluding halos) ---*/
+    if (!dynamic_grid) {
 
-    AD::StartNoSharedReading();
+      /*--- Loop over all nodes (excluding halos) ---*/
 
-    SU2_OMP_FOR_STAT(omp_chunk_size)
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      AD::StartNoSharedReading();
 
-      /*--- Retrieve the solution at time levels n-1, n, and n+1. Note that
-       we are currently iterating on U^n+1 and that U^n & U^n-1 are fixed,
-       previous solutions that are stored in memory. ---*/
+      SU2_OMP_FOR_STAT(omp_chunk_size)
+      for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-      U_time_nM1 = nodes->GetSolution_time_n1(iPoint);
-      U_time_n   = nodes->GetSolution_time_n(iPoint);
-      U_time_nP1 = nodes->GetSolution(iPoint);
+        /*--- Retrieve the solution at time levels n-1 and n. Note that
+         we are currently iterating on U^n+1 and that U^n & U^n-1 are fixed,
+         previous solutions that are stored in memory. ---*/
 
-      /*--- CV volume at time n+1. As we are on a static mesh, the volume
-       of the CV will remained fixed for all time steps. ---*/
+        U_time_nM1 = nodes->GetSolution_time_n1(iPoint);
+        U_time_n   = nodes->GetSolution_time_n(iPoint);
 
-      Volume_nP1 = geometry->nodes->GetVolume(iPoint);
+        /*--- CV volume at time n+1. As we are on a static mesh, the volume
+         of the CV will remained fixed for all time steps. ---*/
 
-      /*--- Compute the dual time-stepping source term based on the chosen
-       time discretization scheme (1st- or 2nd-order).---*/
+        Volume_nP1 = geometry->nodes->GetVolume(iPoint);
 
-      for (iVar = 0; iVar < nVar; iVar++) {
-        if (first_order)
-          LinSysRes(iPoint,iVar) += (U_time_nP1[iVar] - U_time_n[iVar])*Volume_nP1 / TimeStep;
-        if (second_order)
-          LinSysRes(iPoint,iVar) += ( 3.0*U_time_nP1[iVar] - 4.0*U_time_n[iVar]
-                                     +1.0*U_time_nM1[iVar])*Volume_nP1 / (2.0*TimeStep);
-      }
+        /*--- Store the part of the dual time-stepping source term that does
+         not depend on U^n+1, based on the chosen time discretization scheme
+         (1st- or 2nd-order).---*/
 
-      /*--- Compute the Jacobian contribution due to the dual time source term. ---*/
-      if (implicit) {
-        if (first_order) Jacobian.AddVal2Diag(iPoint, Volume_nP1/TimeStep);
-        if (second_order) Jacobian.AddVal2Diag(iPoint, (Volume_nP1*3.0)/(2.0*TimeStep));
+        for (iVar = 0; iVar < nVar; iVar++) {
+          su2double sourceConst = 0.0;
+          if (first_order)
+            sourceConst = -U_time_n[iVar]*Volume_nP1 / TimeStep;
+          if (second_order)
+            sourceConst = (-4.0*U_time_n[iVar]
+                           +1.0*U_time_nM1[iVar])*Volume_nP1 / (2.0*TimeStep);
+          DualTime_Residual(iPoint,iVar) = sourceConst;
+        }
       }
+      END_SU2_OMP_FOR
+
+      AD::EndNoSharedReading();
+
     }
-    END_SU2_OMP_FOR
 
-    AD::EndNoSharedReading();
+    else {
 
-  }
+      /*--- The GCL loops below accumulate into the array, clear it first. ---*/
 
-  else {
+      SU2_OMP_FOR_STAT(omp_chunk_size)
+      for (iPoint = 0; iPoint < nPointDomain; ++iPoint)
+        for (iVar = 0; iVar < nVar; iVar++)
+          DualTime_Residual(iPoint,iVar) = 0.0;
+      END_SU2_OMP_FOR
 
-    /*--- For unsteady flows on dynamic meshes (rigidly transforming or
-     dynamically deforming), the Geometric Conservation Law (GCL) should be
-     satisfied in conjunction with the ALE formulation of the governing
-     equations. The GCL prevents accuracy issues caused by grid motion, i.e.
-     a uniform free-stream should be preserved through a moving grid. First,
-     we will loop over the edges and boundaries to compute the GCL component
-     of the dual time source term that depends on grid velocities. ---*/
+      /*--- For unsteady flows on dynamic meshes (rigidly transforming or
+       dynamically deforming), the Geometric Conservation Law (GCL) should be
+       satisfied in conjunction with the ALE formulation of the governing
+       equations. The GCL prevents accuracy issues caused by grid motion, i.e.
+       a uniform free-stream should be preserved through a moving grid. First,
+       we will loop over the edges and boundaries to compute the GCL component
+       of the dual time source term that depends on grid velocities. ---*/
 
-    SU2_OMP_FOR_STAT(omp_chunk_size)
-    for (iPoint = 0; iPoint < nPointDomain; ++iPoint) {
+      SU2_OMP_FOR_STAT(omp_chunk_size)
+      for (iPoint = 0; iPoint < nPointDomain; ++iPoint) {
 
-      GridVel_i = geometry->nodes->GetGridVel(iPoint);
-      U_time_n = nodes->GetSolution_time_n(iPoint);
+        GridVel_i = geometry->nodes->GetGridVel(iPoint);
+        U_time_n = nodes->GetSolution_time_n(iPoint);
 
-      for (iNeigh = 0; iNeigh < geometry->nodes->GetnPoint(iPoint); iNeigh++) {
+        for (iNeigh = 0; iNeigh < geometry->nodes->GetnPoint(iPoint); iNeigh++) {
 
-        iEdge = geometry->nodes->GetEdge(iPoint, iNeigh);
-        Normal = geometry->edges->GetNormal(iEdge);
+          iEdge = geometry->nodes->GetEdge(iPoint, iNeigh);
+          Normal = geometry->edges->GetNormal(iEdge);
 
-        jPoint = geometry->nodes->GetPoint(iPoint, iNeigh);
-        GridVel_j = geometry->nodes->GetGridVel(jPoint);
+          jPoint = geometry->nodes->GetPoint(iPoint, iNeigh);
+          GridVel_j = geometry->nodes->GetGridVel(jPoint);
 
-        /*--- Determine whether to consider the normal outward or inward. ---*/
-        su2double dir = (iPoint < jPoint)? 0.5 : -0.5;
+          /*--- Determine whether to consider the normal outward or inward. ---*/
+          su2double dir = (iPoint < jPoint)? 0.5 : -0.5;
 
-        Residual_GCL = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          Residual_GCL += dir*(GridVel_i[iDim]+GridVel_j[iDim])*Normal[iDim];
+          Residual_GCL = 0.0;
+          for (iDim = 0; iDim < nDim; iDim++)
+            Residual_GCL += dir*(GridVel_i[iDim]+GridVel_j[iDim])*Normal[iDim];
 
-        for (iVar = 0; iVar < nVar; iVar++)
-          LinSysRes(iPoint,iVar) += U_time_n[iVar]*Residual_GCL;
+          for (iVar = 0; iVar < nVar; iVar++)
+            DualTime_Residual(iPoint,iVar) += U_time_n[iVar]*Residual_GCL;
+        }
       }
-    }
-    END_SU2_OMP_FOR
+      END_SU2_OMP_FOR
 
-    /*--- Loop over the boundary edges ---*/
+      /*--- Loop over the boundary edges ---*/
 
-    for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
-      if ((config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
-          (config->GetMarker_All_KindBC(iMarker) != NEARFIELD_BOUNDARY) &&
-          (config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY)) {
+      for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+        if ((config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
+            (config->GetMarker_All_KindBC(iMarker) != NEARFIELD_BOUNDARY) &&
+            (config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY)) {
 
-        SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
-        for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+          SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+          for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
 
-          /*--- Get the index for node i plus the boundary face normal ---*/
+            /*--- Get the index for node i plus the boundary face normal ---*/
 
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+            iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+            Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
 
-          /*--- Grid velocities stored at boundary node i ---*/
+            /*--- Grid velocities stored at boundary node i ---*/
 
-          GridVel_i = geometry->nodes->GetGridVel(iPoint);
+            GridVel_i = geometry->nodes->GetGridVel(iPoint);
 
-          /*--- Compute the GCL term by dotting the grid velocity with the face
-           normal. The normal is negated to match the boundary convention. ---*/
+            /*--- Compute the GCL term by dotting the grid velocity with the face
+             normal. The normal is negated to match the boundary convention. ---*/
 
-          Residual_GCL = 0.0;
-          for (iDim = 0; iDim < nDim; iDim++)
-            Residual_GCL -= 0.5*(GridVel_i[iDim]+GridVel_i[iDim])*Normal[iDim];
+            Residual_GCL = 0.0;
+            for (iDim = 0; iDim < nDim; iDim++)
+              Residual_GCL -= 0.5*(GridVel_i[iDim]+GridVel_i[iDim])*Normal[iDim];
 
-          /*--- Compute the GCL component of the source term for node i ---*/
+            /*--- Compute the GCL component of the source term for node i ---*/
 
-          U_time_n = nodes->GetSolution_time_n(iPoint);
-          for (iVar = 0; iVar < nVar; iVar++)
-            LinSysRes(iPoint,iVar) += U_time_n[iVar]*Residual_GCL;
+            U_time_n = nodes->GetSolution_time_n(iPoint);
+            for (iVar = 0; iVar < nVar; iVar++)
+              DualTime_Residual(iPoint,iVar) += U_time_n[iVar]*Residual_GCL;
+          }
+          END_SU2_OMP_FOR
         }
-        END_SU2_OMP_FOR
       }
-    }
 
-    /*--- Loop over all nodes (excluding halos) to compute the remainder
-     of the dual time-stepping source term. ---*/
+      /*--- Loop over all nodes (excluding halos) to compute the remainder
+       of the constant part of the dual time-stepping source term. ---*/
 
-    AD::StartNoSharedReading();
-
-    SU2_OMP_FOR_STAT(omp_chunk_size)
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      AD::StartNoSharedReading();
 
-      /*--- Retrieve the solution at time levels n-1, n, and n+1. Note that
-       we are currently iterating on U^n+1 and that U^n & U^n-1 are fixed,
-       previous solutions that are stored in memory. ---*/
+      SU2_OMP_FOR_STAT(omp_chunk_size)
+      for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-      U_time_nM1 = nodes->GetSolution_time_n1(iPoint);
-      U_time_n   = nodes->GetSolution_time_n(iPoint);
-      U_time_nP1 = nodes->GetSolution(iPoint);
+        U_time_nM1 = nodes->GetSolution_time_n1(iPoint);
+        U_time_n   = nodes->GetSolution_time_n(iPoint);
 
-      /*--- CV volume at time n-1 and n+1. In the case of dynamically deforming
-       grids, the volumes will change. On rigidly transforming grids, the
-       volumes will remain constant. ---*/
+        /*--- CV volume at time n-1 and n+1. In the case of dynamically deforming
+         grids, the volumes will change. On rigidly transforming grids, the
+         volumes will remain constant. ---*/
 
-      Volume_nM1 = geometry->nodes->GetVolume_nM1(iPoint);
-      Volume_nP1 = geometry->nodes->GetVolume(iPoint);
+        Volume_nM1 = geometry->nodes->GetVolume_nM1(iPoint);
+        Volume_nP1 = geometry->nodes->GetVolume(iPoint);
 
-      /*--- Compute the dual time-stepping source residual. Due to the
-       introduction of the GCL term above, the remainder of the source residual
-       due to the time discretization has a new form.---*/
+        /*--- Store the part of the source residual that does not depend on
+         U^n+1. Due to the introduction of the GCL term above, the remainder
+         of the source residual due to the time discretization has a new form.---*/
 
-      for (iVar = 0; iVar < nVar; iVar++) {
-        if (first_order)
-          LinSysRes(iPoint,iVar) += (U_time_nP1[iVar] - U_time_n[iVar])*(Volume_nP1/TimeStep);
-        if (second_order)
-          LinSysRes(iPoint,iVar) += (U_time_nP1[iVar] - U_time_n[iVar])*(3.0*Volume_nP1/(2.0*TimeStep))
-                                     + (U_time_nM1[iVar] - U_time_n[iVar])*(Volume_nM1/(2.0*TimeStep));
+        for (iVar = 0; iVar < nVar; iVar++) {
+          if (first_order)
+            DualTime_Residual(iPoint,iVar) += -U_time_n[iVar]*(Volume_nP1/TimeStep);
+          if (second_order)
+            DualTime_Residual(iPoint,iVar) += -U_time_n[iVar]*(3.0*Volume_nP1/(2.0*TimeStep))
+                                              + (U_time_nM1[iVar] - U_time_n[iVar])*(Volume_nM1/(2.0*TimeStep));
+        }
       }
+      END_SU2_OMP_FOR
 
-      /*--- Compute the Jacobian contribution due to the dual time source term. ---*/
-      if (implicit) {
-        if (first_order) Jacobian.AddVal2Diag(iPoint, Volume_nP1/TimeStep);
-        if (second_order) Jacobian.AddVal2Diag(iPoint, (Volume_nP1*3.0)/(2.0*TimeStep));
-      }
+      AD::EndNoSharedReading();
     }
-    END_SU2_OMP_FOR
+  }
+
+  /*--- Add the precomputed constant part together with the U^n+1 contribution,
+   which changes every sub-iteration, and the Jacobian contribution due to the
+   dual time source term. This is the only full-field pass that remains in the
+   sub-iterations of a physical time step. ---*/
 
-    AD::EndNoSharedReading();
+  AD::StartNoSharedReading();
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+    U_time_nP1 = nodes->GetSolution(iPoint);
+    Volume_nP1 = geometry->nodes->GetVolume(iPoint);
+
+    su2double coeff = 0.0;
+    if (first_order) coeff = Volume_nP1/TimeStep;
+    if (second_order) coeff = (Volume_nP1*3.0)/(2.0*TimeStep);
+
+    for (iVar = 0; iVar < nVar; iVar++)
+      LinSysRes(iPoint,iVar) += U_time_nP1[iVar]*coeff + DualTime_Residual(iPoint,iVar);
+
+    if (implicit) Jacobian.AddVal2Diag(iPoint, coeff);
   }
+  END_SU2_OMP_FOR
+
+  AD::EndNoSharedReading();
 
 }
 
@@ -1789,7 +1962,6 @@ void CFVMFlowSolverBase<V, FlowRegime>::Pressure_Forces(const CGeometry* geometr
   unsigned short iDim, iMarker, Boundary, Monitoring, iMarker_Monitoring;
   su2double Pressure = 0.0, NFPressOF, RefPressure;
   const su2double *Normal = nullptr, *Coord = nullptr;
-  string Marker_Tag, Monitoring_Tag;
   su2double AxiFactor;
 
   su2double Alpha = config->GetAoA() * PI_NUMBER / 180.0;
@@ -1822,6 +1994,11 @@ void CFVMFlowSolverBase<V, FlowRegime>::Pressure_Forces(const CGeometry* geometr
   SurfaceInvCoeff.setZero();
   SurfaceCoeff.setZero();
 
+  /*--- Resolve the monitoring index of each marker once, instead of matching
+   tags inside the marker loop. ---*/
+
+  const auto markerMonitoring = config->GetMarker_All_to_Monitoring();
+
   /*--- Loop over the Euler and Navier-Stokes markers ---*/
 
   for (iMarker = 0; iMarker < nMarker; iMarker++) {
@@ -1830,13 +2007,8 @@ void CFVMFlowSolverBase<V, FlowRegime>::Pressure_Forces(const CGeometry* geometr
 
     /*--- Obtain the origin for the moment computation for a particular marker ---*/
 
-    if (Monitoring == YES) {
-      for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
-        Monitoring_Tag = config->GetMarker_Monitoring_TagBound(iMarker_Monitoring);
-        Marker_Tag = config->GetMarker_All_TagBound(iMarker);
-        if (Marker_Tag == Monitoring_Tag) Origin = config->GetRefOriginMoment(iMarker_Monitoring);
-      }
-    }
+    if ((Monitoring == YES) && (markerMonitoring[iMarker] < config->GetnMarker_Monitoring()))
+      Origin = config->GetRefOriginMoment(markerMonitoring[iMarker]);
 
     if (config->GetSolid_Wall(iMarker) || (Boundary == NEARFIELD_BOUNDARY) || (Boundary == INLET_FLOW) ||
         (Boundary == OUTLET_FLOW) || (Boundary == ACTDISK_INLET) || (Boundary == ACTDISK_OUTLET) ||
@@ -1967,21 +2139,18 @@ void CFVMFlowSolverBase<V, FlowRegime>::Pressure_Forces(const CGeometry* geometr
 
           /*--- Compute the coefficients per surface ---*/
 
-          for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
-            Monitoring_Tag = config->GetMarker_Monitoring_TagBound(iMarker_Monitoring);
-            Marker_Tag = config->GetMarker_All_TagBound(iMarker);
-            if (Marker_Tag == Monitoring_Tag) {
-              SurfaceInvCoeff.CL[iMarker_Monitoring] += InvCoeff.CL[iMarker];
-              SurfaceInvCoeff.CD[iMarker_Monitoring] += InvCoeff.CD[iMarker];
-              SurfaceInvCoeff.CSF[iMarker_Monitoring] += InvCoeff.CSF[iMarker];
-              SurfaceInvCoeff.CEff[iMarker_Monitoring] = SurfaceInvCoeff.CL[iMarker_Monitoring] / (SurfaceInvCoeff.CD[iMarker_Monitoring] + EPS);
-              SurfaceInvCoeff.CFx[iMarker_Monitoring] += InvCoeff.CFx[iMarker];
-              SurfaceInvCoeff.CFy[iMarker_Monitoring] += InvCoeff.CFy[iMarker];
-              SurfaceInvCoeff.CFz[iMarker_Monitoring] += InvCoeff.CFz[iMarker];
-              SurfaceInvCoeff.CMx[iMarker_Monitoring] += InvCoeff.CMx[iMarker];
-              SurfaceInvCoeff.CMy[iMarker_Monitoring] += InvCoeff.CMy[iMarker];
-              SurfaceInvCoeff.CMz[iMarker_Monitoring] += InvCoeff.CMz[iMarker];
-            }
+          iMarker_Monitoring = markerMonitoring[iMarker];
+          if (iMarker_Monitoring < config->GetnMarker_Monitoring()) {
+            SurfaceInvCoeff.CL[iMarker_Monitoring] += InvCoeff.CL[iMarker];
+            SurfaceInvCoeff.CD[iMarker_Monitoring] += InvCoeff.CD[iMarker];
+            SurfaceInvCoeff.CSF[iMarker_Monitoring] += InvCoeff.CSF[iMarker];
+            SurfaceInvCoeff.CEff[iMarker_Monitoring] = SurfaceInvCoeff.CL[iMarker_Monitoring] / (SurfaceInvCoeff.CD[iMarker_Monitoring] + EPS);
+            SurfaceInvCoeff.CFx[iMarker_Monitoring] += InvCoeff.CFx[iMarker];
+            SurfaceInvCoeff.CFy[iMarker_Monitoring] += InvCoeff.CFy[iMarker];
+            SurfaceInvCoeff.CFz[iMarker_Monitoring] += InvCoeff.CFz[iMarker];
+            SurfaceInvCoeff.CMx[iMarker_Monitoring] += InvCoeff.CMx[iMarker];
+            SurfaceInvCoeff.CMy[iMarker_Monitoring] += InvCoeff.CMy[iMarker];
+            SurfaceInvCoeff.CMz[iMarker_Monitoring] += InvCoeff.CMz[iMarker];
           }
 
         }
@@ -1998,70 +2167,30 @@ void CFVMFlowSolverBase<V, FlowRegime>::Pressure_Forces(const CGeometry* geometr
 
 #ifdef HAVE_MPI
 
-  /*--- Add AllBound information using all the nodes ---*/
+  /*--- Add AllBound and surface information using all the nodes, all the
+   *    monitored coefficients are packed into a single reduction. ---*/
 
   if (config->GetComm_Level() == COMM_FULL) {
-    auto Allreduce = [](su2double x) {
-      su2double tmp = x;
-      x = 0.0;
-      SU2_MPI::Allreduce(&tmp, &x, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      return x;
-    };
-    AllBoundInvCoeff.CD = Allreduce(AllBoundInvCoeff.CD);
-    AllBoundInvCoeff.CL = Allreduce(AllBoundInvCoeff.CL);
-    AllBoundInvCoeff.CSF = Allreduce(AllBoundInvCoeff.CSF);
-    AllBoundInvCoeff.CEff = AllBoundInvCoeff.CL / (AllBoundInvCoeff.CD + EPS);
+    const int nMarkerMon = config->GetnMarker_Monitoring();
 
-    AllBoundInvCoeff.CMx = Allreduce(AllBoundInvCoeff.CMx);
-    AllBoundInvCoeff.CMy = Allreduce(AllBoundInvCoeff.CMy);
-    AllBoundInvCoeff.CMz = Allreduce(AllBoundInvCoeff.CMz);
+    su2double* scalars[] = {&AllBoundInvCoeff.CD,   &AllBoundInvCoeff.CL,   &AllBoundInvCoeff.CSF,
+                            &AllBoundInvCoeff.CMx,  &AllBoundInvCoeff.CMy,  &AllBoundInvCoeff.CMz,
+                            &AllBoundInvCoeff.CoPx, &AllBoundInvCoeff.CoPy, &AllBoundInvCoeff.CoPz,
+                            &AllBoundInvCoeff.CFx,  &AllBoundInvCoeff.CFy,  &AllBoundInvCoeff.CFz,
+                            &AllBoundInvCoeff.CT,   &AllBoundInvCoeff.CQ,   &AllBound_CNearFieldOF_Inv};
 
-    AllBoundInvCoeff.CoPx = Allreduce(AllBoundInvCoeff.CoPx);
-    AllBoundInvCoeff.CoPy = Allreduce(AllBoundInvCoeff.CoPy);
-    AllBoundInvCoeff.CoPz = Allreduce(AllBoundInvCoeff.CoPz);
+    su2double* arrays[] = {SurfaceInvCoeff.CL,  SurfaceInvCoeff.CD,  SurfaceInvCoeff.CSF,
+                           SurfaceInvCoeff.CFx, SurfaceInvCoeff.CFy, SurfaceInvCoeff.CFz,
+                           SurfaceInvCoeff.CMx, SurfaceInvCoeff.CMy, SurfaceInvCoeff.CMz};
 
-    AllBoundInvCoeff.CFx = Allreduce(AllBoundInvCoeff.CFx);
-    AllBoundInvCoeff.CFy = Allreduce(AllBoundInvCoeff.CFy);
-    AllBoundInvCoeff.CFz = Allreduce(AllBoundInvCoeff.CFz);
+    packedCoeffAllreduce(scalars, arrays, nMarkerMon);
 
-    AllBoundInvCoeff.CT = Allreduce(AllBoundInvCoeff.CT);
-    AllBoundInvCoeff.CQ = Allreduce(AllBoundInvCoeff.CQ);
+    AllBoundInvCoeff.CEff = AllBoundInvCoeff.CL / (AllBoundInvCoeff.CD + EPS);
     AllBoundInvCoeff.CMerit = AllBoundInvCoeff.CT / (AllBoundInvCoeff.CQ + EPS);
-    AllBound_CNearFieldOF_Inv = Allreduce(AllBound_CNearFieldOF_Inv);
-  }
-
-  /*--- Add the forces on the surfaces using all the nodes ---*/
-
-  if (config->GetComm_Level() == COMM_FULL) {
-    int nMarkerMon = config->GetnMarker_Monitoring();
-
-    /*--- Use the same buffer for all reductions. We could avoid the copy back into
-     *    the original variable by swaping pointers, but it is safer this way... ---*/
-
-    su2double* buffer = new su2double[nMarkerMon];
-
-    auto Allreduce_inplace = [buffer](int size, su2double* x) {
-      SU2_MPI::Allreduce(x, buffer, size, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      for (int i = 0; i < size; ++i) x[i] = buffer[i];
-    };
-
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CL);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CD);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CSF);
 
     for (iMarker_Monitoring = 0; iMarker_Monitoring < nMarkerMon; iMarker_Monitoring++)
       SurfaceInvCoeff.CEff[iMarker_Monitoring] =
           SurfaceInvCoeff.CL[iMarker_Monitoring] / (SurfaceInvCoeff.CD[iMarker_Monitoring] + EPS);
-
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CFx);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CFy);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CFz);
-
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CMx);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CMy);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CMz);
-
-    delete[] buffer;
   }
 
 #endif
@@ -2109,7 +2238,6 @@ void CFVMFlowSolverBase<V, FlowRegime>::Momentum_Forces(const CGeometry* geometr
   unsigned short iDim, iMarker, Boundary, Monitoring, iMarker_Monitoring;
   su2double MassFlow, Density;
   const su2double *Normal = nullptr, *Coord = nullptr;
-  string Marker_Tag, Monitoring_Tag;
   su2double AxiFactor;
 
   su2double Alpha = config->GetAoA() * PI_NUMBER / 180.0;
@@ -2125,6 +2253,25 @@ void CFVMFlowSolverBase<V, FlowRegime>::Momentum_Forces(const CGeometry* geometr
   AllBoundMntCoeff.setZero();
   SurfaceMntCoeff.setZero();
 
+  /*--- Only inlet/outlet-type markers contribute momentum forces. Without any of
+   them in the config (the common external-aero case) there is nothing to traverse
+   or reduce, and all contributions to the totals below would be zero. The marker
+   set is the same on every rank, so all ranks skip the reduction together. ---*/
+
+  bool hasMntMarkers = false;
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+    Boundary = config->GetMarker_All_KindBC(iMarker);
+    hasMntMarkers = hasMntMarkers || (Boundary == INLET_FLOW) || (Boundary == OUTLET_FLOW) ||
+                    (Boundary == ACTDISK_INLET) || (Boundary == ACTDISK_OUTLET) ||
+                    (Boundary == ENGINE_INFLOW) || (Boundary == ENGINE_EXHAUST);
+  }
+  if (!hasMntMarkers) return;
+
+  /*--- Resolve the monitoring index of each marker once, instead of matching
+   tags inside the marker loop. ---*/
+
+  const auto markerMonitoring = config->GetMarker_All_to_Monitoring();
+
   /*--- Loop over the Inlet -Outlet Markers  ---*/
 
   for (iMarker = 0; iMarker < nMarker; iMarker++) {
@@ -2133,13 +2280,8 @@ void CFVMFlowSolverBase<V, FlowRegime>::Momentum_Forces(const CGeometry* geometr
 
     /*--- Obtain the origin for the moment computation for a particular marker ---*/
 
-    if (Monitoring == YES) {
-      for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
-        Monitoring_Tag = config->GetMarker_Monitoring_TagBound(iMarker_Monitoring);
-        Marker_Tag = config->GetMarker_All_TagBound(iMarker);
-        if (Marker_Tag == Monitoring_Tag) Origin = config->GetRefOriginMoment(iMarker_Monitoring);
-      }
-    }
+    if ((Monitoring == YES) && (markerMonitoring[iMarker] < config->GetnMarker_Monitoring()))
+      Origin = config->GetRefOriginMoment(markerMonitoring[iMarker]);
 
     if ((Boundary == INLET_FLOW) || (Boundary == OUTLET_FLOW) || (Boundary == ACTDISK_INLET) ||
         (Boundary == ACTDISK_OUTLET) || (Boundary == ENGINE_INFLOW) || (Boundary == ENGINE_EXHAUST)) {
@@ -2258,21 +2400,18 @@ void CFVMFlowSolverBase<V, FlowRegime>::Momentum_Forces(const CGeometry* geometr
 
         /*--- Compute the coefficients per surface ---*/
 
-        for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
-          Monitoring_Tag = config->GetMarker_Monitoring_TagBound(iMarker_Monitoring);
-          Marker_Tag = config->GetMarker_All_TagBound(iMarker);
-          if (Marker_Tag == Monitoring_Tag) {
-            SurfaceMntCoeff.CL[iMarker_Monitoring] += MntCoeff.CL[iMarker];
-            SurfaceMntCoeff.CD[iMarker_Monitoring] += MntCoeff.CD[iMarker];
-            SurfaceMntCoeff.CSF[iMarker_Monitoring] += MntCoeff.CSF[iMarker];
-            SurfaceMntCoeff.CEff[iMarker_Monitoring] = SurfaceMntCoeff.CL[iMarker_Monitoring] / (SurfaceMntCoeff.CD[iMarker_Monitoring] + EPS);
-            SurfaceMntCoeff.CFx[iMarker_Monitoring] += MntCoeff.CFx[iMarker];
-            SurfaceMntCoeff.CFy[iMarker_Monitoring] += MntCoeff.CFy[iMarker];
-            SurfaceMntCoeff.CFz[iMarker_Monitoring] += MntCoeff.CFz[iMarker];
-            SurfaceMntCoeff.CMx[iMarker_Monitoring] += MntCoeff.CMx[iMarker];
-            SurfaceMntCoeff.CMy[iMarker_Monitoring] += MntCoeff.CMy[iMarker];
-            SurfaceMntCoeff.CMz[iMarker_Monitoring] += MntCoeff.CMz[iMarker];
-          }
+        iMarker_Monitoring = markerMonitoring[iMarker];
+        if (iMarker_Monitoring < config->GetnMarker_Monitoring()) {
+          SurfaceMntCoeff.CL[iMarker_Monitoring] += MntCoeff.CL[iMarker];
+          SurfaceMntCoeff.CD[iMarker_Monitoring] += MntCoeff.CD[iMarker];
+          SurfaceMntCoeff.CSF[iMarker_Monitoring] += MntCoeff.CSF[iMarker];
+          SurfaceMntCoeff.CEff[iMarker_Monitoring] = SurfaceMntCoeff.CL[iMarker_Monitoring] / (SurfaceMntCoeff.CD[iMarker_Monitoring] + EPS);
+          SurfaceMntCoeff.CFx[iMarker_Monitoring] += MntCoeff.CFx[iMarker];
+          SurfaceMntCoeff.CFy[iMarker_Monitoring] += MntCoeff.CFy[iMarker];
+          SurfaceMntCoeff.CFz[iMarker_Monitoring] += MntCoeff.CFz[iMarker];
+          SurfaceMntCoeff.CMx[iMarker_Monitoring] += MntCoeff.CMx[iMarker];
+          SurfaceMntCoeff.CMy[iMarker_Monitoring] += MntCoeff.CMy[iMarker];
+          SurfaceMntCoeff.CMz[iMarker_Monitoring] += MntCoeff.CMz[iMarker];
         }
       }
     }
@@ -2280,70 +2419,30 @@ void CFVMFlowSolverBase<V, FlowRegime>::Momentum_Forces(const CGeometry* geometr
 
 #ifdef HAVE_MPI
 
-  /*--- Add AllBound information using all the nodes ---*/
+  /*--- Add AllBound and surface information using all the nodes, all the
+   *    monitored coefficients are packed into a single reduction. ---*/
 
   if (config->GetComm_Level() == COMM_FULL) {
-    auto Allreduce = [](su2double x) {
-      su2double tmp = x;
-      x = 0.0;
-      SU2_MPI::Allreduce(&tmp, &x, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      return x;
-    };
-
-    AllBoundMntCoeff.CD = Allreduce(AllBoundMntCoeff.CD);
-    AllBoundMntCoeff.CL = Allreduce(AllBoundMntCoeff.CL);
-    AllBoundMntCoeff.CSF = Allreduce(AllBoundMntCoeff.CSF);
-    AllBoundMntCoeff.CEff = AllBoundMntCoeff.CL / (AllBoundMntCoeff.CD + EPS);
+    const int nMarkerMon = config->GetnMarker_Monitoring();
 
-    AllBoundMntCoeff.CFx = Allreduce(AllBoundMntCoeff.CFx);
-    AllBoundMntCoeff.CFy = Allreduce(AllBoundMntCoeff.CFy);
-    AllBoundMntCoeff.CFz = Allreduce(AllBoundMntCoeff.CFz);
+    su2double* scalars[] = {&AllBoundMntCoeff.CD,   &AllBoundMntCoeff.CL,   &AllBoundMntCoeff.CSF,
+                            &AllBoundMntCoeff.CFx,  &AllBoundMntCoeff.CFy,  &AllBoundMntCoeff.CFz,
+                            &AllBoundMntCoeff.CMx,  &AllBoundMntCoeff.CMy,  &AllBoundMntCoeff.CMz,
+                            &AllBoundMntCoeff.CoPx, &AllBoundMntCoeff.CoPy, &AllBoundMntCoeff.CoPz,
+                            &AllBoundMntCoeff.CT,   &AllBoundMntCoeff.CQ};
 
-    AllBoundMntCoeff.CMx = Allreduce(AllBoundMntCoeff.CMx);
-    AllBoundMntCoeff.CMy = Allreduce(AllBoundMntCoeff.CMy);
-    AllBoundMntCoeff.CMz = Allreduce(AllBoundMntCoeff.CMz);
+    su2double* arrays[] = {SurfaceMntCoeff.CL,  SurfaceMntCoeff.CD,  SurfaceMntCoeff.CSF,
+                           SurfaceMntCoeff.CFx, SurfaceMntCoeff.CFy, SurfaceMntCoeff.CFz,
+                           SurfaceMntCoeff.CMx, SurfaceMntCoeff.CMy, SurfaceMntCoeff.CMz};
 
-    AllBoundMntCoeff.CoPx = Allreduce(AllBoundMntCoeff.CoPx);
-    AllBoundMntCoeff.CoPy = Allreduce(AllBoundMntCoeff.CoPy);
-    AllBoundMntCoeff.CoPz = Allreduce(AllBoundMntCoeff.CoPz);
+    packedCoeffAllreduce(scalars, arrays, nMarkerMon);
 
-    AllBoundMntCoeff.CT = Allreduce(AllBoundMntCoeff.CT);
-    AllBoundMntCoeff.CQ = Allreduce(AllBoundMntCoeff.CQ);
+    AllBoundMntCoeff.CEff = AllBoundMntCoeff.CL / (AllBoundMntCoeff.CD + EPS);
     AllBoundMntCoeff.CMerit = AllBoundMntCoeff.CT / (AllBoundMntCoeff.CQ + EPS);
-  }
-
-  /*--- Add the forces on the surfaces using all the nodes ---*/
-
-  if (config->GetComm_Level() == COMM_FULL) {
-    int nMarkerMon = config->GetnMarker_Monitoring();
-
-    /*--- Use the same buffer for all reductions. We could avoid the copy back into
-     *    the original variable by swaping pointers, but it is safer this way... ---*/
-
-    su2double* buffer = new su2double[nMarkerMon];
-
-    auto Allreduce_inplace = [buffer](int size, su2double* x) {
-      SU2_MPI::Allreduce(x, buffer, size, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      for (int i = 0; i < size; ++i) x[i] = buffer[i];
-    };
-
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CL);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CD);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CSF);
 
     for (iMarker_Monitoring = 0; iMarker_Monitoring < nMarkerMon; iMarker_Monitoring++)
       SurfaceMntCoeff.CEff[iMarker_Monitoring] =
           SurfaceMntCoeff.CL[iMarker_Monitoring] / (SurfaceMntCoeff.CD[iMarker_Monitoring] + EPS);
-
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CFx);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CFy);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CFz);
-
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CMx);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CMy);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CMz);
-
-    delete[] buffer;
   }
 
 #endif
@@ -2399,7 +2498,7 @@ void CFVMFlowSolverBase<V, FlowRegime>::Friction_Forces(const CGeometry* geometr
   const su2double *Coord = nullptr, *Coord_Normal = nullptr, *Normal = nullptr;
   const su2double minYPlus = config->GetwallModel_MinYPlus();
 
-  string Marker_Tag, Monitoring_Tag;
+  string Marker_Tag;
 
   su2double Alpha = config->GetAoA() * PI_NUMBER / 180.0;
   su2double Beta = config->GetAoS() * PI_NUMBER / 180.0;
@@ -2439,6 +2538,11 @@ void CFVMFlowSolverBase<V, FlowRegime>::Friction_Forces(const CGeometry* geometr
     Surface_MaxHF_Visc[iMarker_Monitoring] = 0.0;
   }
 
+  /*--- Resolve the monitoring index of each marker once, instead of matching
+   tags inside the marker loop. ---*/
+
+  const auto markerMonitoring = config->GetMarker_All_to_Monitoring();
+
   /*--- Loop over the Navier-Stokes markers ---*/
 
   for (iMarker = 0; iMarker < nMarker; iMarker++) {
@@ -2449,12 +2553,8 @@ void CFVMFlowSolverBase<V, FlowRegime>::Friction_Forces(const CGeometry* geometr
     /*--- Obtain the origin for the moment computation for a particular marker ---*/
 
     const auto Monitoring = config->GetMarker_All_Monitoring(iMarker);
-    if (Monitoring == YES) {
-      for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
-        Monitoring_Tag = config->GetMarker_Monitoring_TagBound(iMarker_Monitoring);
-        if (Marker_Tag == Monitoring_Tag) Origin = config->GetRefOriginMoment(iMarker_Monitoring);
-      }
-    }
+    if ((Monitoring == YES) && (markerMonitoring[iMarker] < config->GetnMarker_Monitoring()))
+      Origin = config->GetRefOriginMoment(markerMonitoring[iMarker]);
 
     /*--- Forces initialization at each Marker ---*/
 
@@ -2689,23 +2789,20 @@ void CFVMFlowSolverBase<V, FlowRegime>::Friction_Forces(const CGeometry* geometr
 
       /*--- Compute the coefficients per surface ---*/
 
-      for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
-        Monitoring_Tag = config->GetMarker_Monitoring_TagBound(iMarker_Monitoring);
-        Marker_Tag = config->GetMarker_All_TagBound(iMarker);
-        if (Marker_Tag == Monitoring_Tag) {
-          SurfaceViscCoeff.CL[iMarker_Monitoring] += ViscCoeff.CL[iMarker];
-          SurfaceViscCoeff.CD[iMarker_Monitoring] += ViscCoeff.CD[iMarker];
-          SurfaceViscCoeff.CSF[iMarker_Monitoring] += ViscCoeff.CSF[iMarker];
-          SurfaceViscCoeff.CEff[iMarker_Monitoring] = SurfaceViscCoeff.CL[iMarker_Monitoring] / (SurfaceViscCoeff.CD[iMarker_Monitoring] + EPS);
-          SurfaceViscCoeff.CFx[iMarker_Monitoring] += ViscCoeff.CFx[iMarker];
-          SurfaceViscCoeff.CFy[iMarker_Monitoring] += ViscCoeff.CFy[iMarker];
-          SurfaceViscCoeff.CFz[iMarker_Monitoring] += ViscCoeff.CFz[iMarker];
-          SurfaceViscCoeff.CMx[iMarker_Monitoring] += ViscCoeff.CMx[iMarker];
-          SurfaceViscCoeff.CMy[iMarker_Monitoring] += ViscCoeff.CMy[iMarker];
-          SurfaceViscCoeff.CMz[iMarker_Monitoring] += ViscCoeff.CMz[iMarker];
-          Surface_HF_Visc[iMarker_Monitoring] += HF_Visc[iMarker];
-          Surface_MaxHF_Visc[iMarker_Monitoring] += pow(MaxHF_Visc[iMarker], MaxNorm);
-        }
+      iMarker_Monitoring = markerMonitoring[iMarker];
+      if (iMarker_Monitoring < config->GetnMarker_Monitoring()) {
+        SurfaceViscCoeff.CL[iMarker_Monitoring] += ViscCoeff.CL[iMarker];
+        SurfaceViscCoeff.CD[iMarker_Monitoring] += ViscCoeff.CD[iMarker];
+        SurfaceViscCoeff.CSF[iMarker_Monitoring] += ViscCoeff.CSF[iMarker];
+        SurfaceViscCoeff.CEff[iMarker_Monitoring] = SurfaceViscCoeff.CL[iMarker_Monitoring] / (SurfaceViscCoeff.CD[iMarker_Monitoring] + EPS);
+        SurfaceViscCoeff.CFx[iMarker_Monitoring] += ViscCoeff.CFx[iMarker];
+        SurfaceViscCoeff.CFy[iMarker_Monitoring] += ViscCoeff.CFy[iMarker];
+        SurfaceViscCoeff.CFz[iMarker_Monitoring] += ViscCoeff.CFz[iMarker];
+        SurfaceViscCoeff.CMx[iMarker_Monitoring] += ViscCoeff.CMx[iMarker];
+        SurfaceViscCoeff.CMy[iMarker_Monitoring] += ViscCoeff.CMy[iMarker];
+        SurfaceViscCoeff.CMz[iMarker_Monitoring] += ViscCoeff.CMz[iMarker];
+        Surface_HF_Visc[iMarker_Monitoring] += HF_Visc[iMarker];
+        Surface_MaxHF_Visc[iMarker_Monitoring] += pow(MaxHF_Visc[iMarker], MaxNorm);
       }
     }
   }
@@ -2718,75 +2815,35 @@ void CFVMFlowSolverBase<V, FlowRegime>::Friction_Forces(const CGeometry* geometr
 
 #ifdef HAVE_MPI
 
-  /*--- Add AllBound information using all the nodes ---*/
+  /*--- Add AllBound and surface information using all the nodes, all the
+   *    monitored coefficients are packed into a single reduction. ---*/
 
   if (config->GetComm_Level() == COMM_FULL) {
-    auto Allreduce = [](su2double x) {
-      su2double tmp = x;
-      x = 0.0;
-      SU2_MPI::Allreduce(&tmp, &x, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      return x;
-    };
-    AllBoundViscCoeff.CD = Allreduce(AllBoundViscCoeff.CD);
-    AllBoundViscCoeff.CL = Allreduce(AllBoundViscCoeff.CL);
-    AllBoundViscCoeff.CSF = Allreduce(AllBoundViscCoeff.CSF);
-    AllBoundViscCoeff.CEff = AllBoundViscCoeff.CL / (AllBoundViscCoeff.CD + EPS);
-
-    AllBoundViscCoeff.CMx = Allreduce(AllBoundViscCoeff.CMx);
-    AllBoundViscCoeff.CMy = Allreduce(AllBoundViscCoeff.CMy);
-    AllBoundViscCoeff.CMz = Allreduce(AllBoundViscCoeff.CMz);
-
-    AllBoundViscCoeff.CFx = Allreduce(AllBoundViscCoeff.CFx);
-    AllBoundViscCoeff.CFy = Allreduce(AllBoundViscCoeff.CFy);
-    AllBoundViscCoeff.CFz = Allreduce(AllBoundViscCoeff.CFz);
-
-    AllBoundViscCoeff.CoPx = Allreduce(AllBoundViscCoeff.CoPx);
-    AllBoundViscCoeff.CoPy = Allreduce(AllBoundViscCoeff.CoPy);
-    AllBoundViscCoeff.CoPz = Allreduce(AllBoundViscCoeff.CoPz);
-
-    AllBoundViscCoeff.CT = Allreduce(AllBoundViscCoeff.CT);
-    AllBoundViscCoeff.CQ = Allreduce(AllBoundViscCoeff.CQ);
-    AllBoundViscCoeff.CMerit = AllBoundViscCoeff.CT / (AllBoundViscCoeff.CQ + EPS);
+    const int nMarkerMon = config->GetnMarker_Monitoring();
 
-    AllBound_HF_Visc = Allreduce(AllBound_HF_Visc);
-    AllBound_MaxHF_Visc = pow(Allreduce(pow(AllBound_MaxHF_Visc, MaxNorm)), 1.0 / MaxNorm);
-  }
-
-  /*--- Add the forces on the surfaces using all the nodes ---*/
+    /*--- The max heat flux is reduced as a p-norm. ---*/
+    su2double MaxHF = pow(AllBound_MaxHF_Visc, MaxNorm);
 
-  if (config->GetComm_Level() == COMM_FULL) {
-    int nMarkerMon = config->GetnMarker_Monitoring();
+    su2double* scalars[] = {&AllBoundViscCoeff.CD,   &AllBoundViscCoeff.CL,   &AllBoundViscCoeff.CSF,
+                            &AllBoundViscCoeff.CMx,  &AllBoundViscCoeff.CMy,  &AllBoundViscCoeff.CMz,
+                            &AllBoundViscCoeff.CFx,  &AllBoundViscCoeff.CFy,  &AllBoundViscCoeff.CFz,
+                            &AllBoundViscCoeff.CoPx, &AllBoundViscCoeff.CoPy, &AllBoundViscCoeff.CoPz,
+                            &AllBoundViscCoeff.CT,   &AllBoundViscCoeff.CQ,   &AllBound_HF_Visc, &MaxHF};
 
-    /*--- Use the same buffer for all reductions. We could avoid the copy back into
-     *    the original variable by swaping pointers, but it is safer this way... ---*/
+    su2double* arrays[] = {SurfaceViscCoeff.CL,   SurfaceViscCoeff.CD,  SurfaceViscCoeff.CSF,
+                           SurfaceViscCoeff.CFx,  SurfaceViscCoeff.CFy, SurfaceViscCoeff.CFz,
+                           SurfaceViscCoeff.CMx,  SurfaceViscCoeff.CMy, SurfaceViscCoeff.CMz,
+                           Surface_HF_Visc.data(), Surface_MaxHF_Visc.data()};
 
-    su2double* buffer = new su2double[nMarkerMon];
+    packedCoeffAllreduce(scalars, arrays, nMarkerMon);
 
-    auto Allreduce_inplace = [buffer](int size, su2double* x) {
-      SU2_MPI::Allreduce(x, buffer, size, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      for (int i = 0; i < size; ++i) x[i] = buffer[i];
-    };
-
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CL);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CD);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CSF);
+    AllBoundViscCoeff.CEff = AllBoundViscCoeff.CL / (AllBoundViscCoeff.CD + EPS);
+    AllBoundViscCoeff.CMerit = AllBoundViscCoeff.CT / (AllBoundViscCoeff.CQ + EPS);
+    AllBound_MaxHF_Visc = pow(MaxHF, 1.0 / MaxNorm);
 
     for (iMarker_Monitoring = 0; iMarker_Monitoring < nMarkerMon; iMarker_Monitoring++)
       SurfaceViscCoeff.CEff[iMarker_Monitoring] =
           SurfaceViscCoeff.CL[iMarker_Monitoring] / (SurfaceViscCoeff.CD[iMarker_Monitoring] + EPS);
-
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CFx);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CFy);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CFz);
-
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CMx);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CMy);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CMz);
-
-    Allreduce_inplace(nMarkerMon, Surface_HF_Visc.data());
-    Allreduce_inplace(nMarkerMon, Surface_MaxHF_Visc.data());
-
-    delete[] buffer;
   }
 
 #endif
@@ -320,6 +320,18 @@ public:
                               CConfig *config,
                               unsigned short iRKStep) final;
 
+  /*!
+   * \brief Update the solution using the strong-stability-preserving third-order RK scheme.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iRKStep - Current step of the Runge-Kutta iteration.
+   */
+  void SSPRK3_Iteration(CGeometry *geometry,
+                        CSolver **solver_container,
+                        CConfig *config,
+                        unsigned short iRKStep) final;
+
   /*!
    * \brief Update the solution using the explicit Euler scheme.
    * \param[in] geometry - Geometrical definition of the problem.
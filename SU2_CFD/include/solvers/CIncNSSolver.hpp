@@ -37,6 +37,9 @@
  */
 class CIncNSSolver final : public CIncEulerSolver {
 
+  su2double StreamwisePeriodic_GlobalArea = 0.0;      /*!< \brief Cached global area [m^2] of the periodic "outlet" marker, it only changes if the grid moves. */
+  bool StreamwisePeriodic_GeomIntegralsValid = false; /*!< \brief Whether the cached area and integrated heatflux for streamwise periodic flow are up to date. */
+
   /*!
    * \brief Generic implementation of the isothermal, heatflux and heat-transfer/convection walls.
    */
@@ -329,6 +329,16 @@ public:
   void ClassicalRK4_Iteration(CGeometry *geometry, CSolver **solver_container,
                               CConfig *config, unsigned short iRKStep) final;
 
+  /*!
+   * \brief Update the solution using the strong-stability-preserving third-order RK scheme.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iRKStep - Runge-Kutta step.
+   */
+  void SSPRK3_Iteration(CGeometry *geometry, CSolver **solver_container,
+                        CConfig *config, unsigned short iRKStep) final;
+
   /*!
    * \brief Prepare an implicit iteration.
    * \param[in] geometry - Geometrical definition of the problem.
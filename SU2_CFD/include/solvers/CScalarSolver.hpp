@@ -32,6 +32,8 @@
 #include "../variables/CScalarVariable.hpp"
 #include "CSolver.hpp"
 
+class CNumericsSIMD;
+
 /*!
  * \class CScalarSolver
  * \brief Main class for defining a scalar solver.
@@ -71,6 +73,8 @@ class CScalarSolver : public CSolver {
   /*--- Edge fluxes for reducer strategy (see the notes in CEulerSolver.hpp). ---*/
   CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
 
+  CNumericsSIMD* edgeNumerics = nullptr; /*!< \brief Object for edge flux computation (if the solver supports it). */
+
   /*!
    * \brief The highest level in the variable hierarchy this solver can safely use.
    */
@@ -81,6 +85,22 @@ class CScalarSolver : public CSolver {
    */
   inline CVariable* GetBaseClassPointerToNodes() final { return nodes; }
 
+  /*!
+   * \brief Instantiate a vectorized numerics object, only derived solvers with
+   * SIMD support override this (e.g. CTurbSSTSolver), if "edgeNumerics" is left
+   * null the solver falls back to the generic edge loop in Upwind_Residual.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) {}
+
+  /*!
+   * \brief Compute the convective and viscous residuals at all edges with the vectorized numerics.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void EdgeFluxResidual(const CGeometry* geometry, const CConfig* config);
+
   /*!
    * \brief Compute the viscous flux for the turbulent equation at a particular edge.
    * \tparam SolverSpecificNumericsFunc - lambda-function, that implements solver specific contributions to numerics.
@@ -161,7 +181,7 @@ class CScalarSolver : public CSolver {
    * \brief Sum the edge fluxes for each cell to populate the residual vector, only used on coarse grids.
    * \param[in] geometry - Geometrical definition of the problem.
    */
-  void SumEdgeFluxes(CGeometry* geometry);
+  void SumEdgeFluxes(const CGeometry* geometry);
 
   /*!
    * \brief Compute a suitable under-relaxation parameter to limit the change in the solution variables over
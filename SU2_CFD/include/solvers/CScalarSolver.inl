@@ -26,6 +26,7 @@
 
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 #include "../../include/solvers/CScalarSolver.hpp"
 #include "../../include/variables/CFlowVariable.hpp"
 
@@ -35,6 +36,8 @@ CScalarSolver<VariableType>::CScalarSolver(bool conservative) : CSolver(), Conse
 template <class VariableType>
 CScalarSolver<VariableType>::CScalarSolver(CGeometry* geometry, CConfig* config, bool conservative)
     : CSolver(), Conservative(conservative) {
+  JacobianFreezeCapable = true;
+
   nMarker = config->GetnMarker_All();
 
   /*--- Store the number of vertices on each marker for deallocation later ---*/
@@ -78,11 +81,23 @@ CScalarSolver<VariableType>::CScalarSolver(CGeometry* geometry, CConfig* config,
 template <class VariableType>
 CScalarSolver<VariableType>::~CScalarSolver() {
   delete nodes;
+  delete edgeNumerics;
 }
 
 template <class VariableType>
 void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver** solver_container,
                                                CNumerics** numerics_container, CConfig* config, unsigned short iMesh) {
+  /*--- Use the vectorized numerics if the derived solver provides them, they
+   *    include the viscous fluxes (source terms are point-wise and therefore
+   *    not part of the edge loop). ---*/
+  if (config->GetUseVectorization()) {
+    if (!edgeNumerics) InstantiateEdgeNumerics(solver_container, config);
+    if (edgeNumerics) {
+      EdgeFluxResidual(geometry, config);
+      return;
+    }
+  }
+
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
   const bool muscl = config->GetMUSCL_Turb();
   const bool limiter = (config->GetKind_SlopeLimit_Turb() != NO_LIMITER);
@@ -124,6 +139,11 @@ void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver**
       auto iPoint = geometry->edges->GetNode(iEdge, 0);
       auto jPoint = geometry->edges->GetNode(iEdge, 1);
 
+      /*--- Skip edges inside frozen (converged) regions, neither point is updated
+       and their partial residuals are discarded before the implicit solve. ---*/
+
+      if (!ReducerStrategy && GetPointFrozen(iPoint) && GetPointFrozen(jPoint)) continue;
+
       numerics->SetNormal(geometry->edges->GetNormal(iEdge));
 
       /*--- Primitive variables w/o reconstruction ---*/
@@ -145,13 +165,9 @@ void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver**
       if (muscl || musclFlow) {
         const su2double *Limiter_i = nullptr, *Limiter_j = nullptr;
 
-        const auto Coord_i = geometry->nodes->GetCoord(iPoint);
-        const auto Coord_j = geometry->nodes->GetCoord(jPoint);
+        /*--- Use the precomputed i-to-midpoint vector of the edge. ---*/
 
-        su2double Vector_ij[MAXNDIM] = {0.0};
-        for (iDim = 0; iDim < nDim; iDim++) {
-          Vector_ij[iDim] = 0.5 * (Coord_j[iDim] - Coord_i[iDim]);
-        }
+        const su2double* Vector_ij = geometry->edges->GetVector_ij(iEdge);
 
         if (musclFlow) {
           /*--- Reconstruct mean flow primitive variables. ---*/
@@ -242,7 +258,51 @@ void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver**
 }
 
 template <class VariableType>
-void CScalarSolver<VariableType>::SumEdgeFluxes(CGeometry* geometry) {
+void CScalarSolver<VariableType>::EdgeFluxResidual(const CGeometry* geometry, const CConfig* config) {
+  /*--- For hybrid parallel AD, pause preaccumulation if there is shared reading of
+   * variables, otherwise switch to the faster adjoint evaluation mode. ---*/
+  bool pausePreacc = false;
+  if (ReducerStrategy)
+    pausePreacc = AD::PausePreaccumulation();
+  else
+    AD::StartNoSharedReading();
+
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring) {
+    /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    for (auto k = 0ul; k < color.size; k += Double::Size) {
+      Int iEdge;
+      Double mask;
+      for (auto j = 0ul; j < Double::Size; ++j) {
+        bool in = (k + j < color.size);
+        mask[j] = in;
+        iEdge[j] = color.indices[k + j * in];
+      }
+
+      if (ReducerStrategy) {
+        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::REDUCTION, mask, EdgeFluxes, Jacobian);
+      } else {
+        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::COLORING, mask, LinSysRes, Jacobian);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- Restore preaccumulation and adjoint evaluation state. ---*/
+  AD::ResumePreaccumulation(pausePreacc);
+  if (!ReducerStrategy) AD::EndNoSharedReading();
+
+  if (ReducerStrategy) {
+    SumEdgeFluxes(geometry);
+    if (config->GetKind_TimeIntScheme_Turb() == EULER_IMPLICIT) {
+      Jacobian.SetDiagonalAsColumnSum();
+    }
+  }
+}
+
+template <class VariableType>
+void CScalarSolver<VariableType>::SumEdgeFluxes(const CGeometry* geometry) {
   SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
     LinSysRes.SetBlock_Zero(iPoint);
@@ -286,6 +346,8 @@ void CScalarSolver<VariableType>::PrepareImplicitIteration(CGeometry* geometry,
   const su2double* coordMax[MAXNVAR] = {nullptr};
   unsigned long idxMax[MAXNVAR] = {0};
 
+  const auto resStride = ResidualSamplingStride(config);
+
   /*--- Build implicit system ---*/
 
   SU2_OMP_FOR_(schedule(static, omp_chunk_size) SU2_NOWAIT)
@@ -294,13 +356,14 @@ void CScalarSolver<VariableType>::PrepareImplicitIteration(CGeometry* geometry,
     su2double dt = nodes->GetLocalCFL(iPoint) / flowNodes->GetLocalCFL(iPoint) * flowNodes->GetDelta_Time(iPoint);
     nodes->SetDelta_Time(iPoint, dt);
 
-    /*--- Modify matrix diagonal to improve diagonal dominance. ---*/
+    /*--- Modify matrix diagonal to improve diagonal dominance. A frozen Jacobian
+     keeps the pseudotime term from the iteration that assembled it. ---*/
 
     if (dt != 0.0) {
       su2double Vol = geometry->nodes->GetVolume(iPoint) + geometry->nodes->GetPeriodicVolume(iPoint);
-      Jacobian.AddVal2Diag(iPoint, Vol / dt);
+      if (!JacobianFrozen) Jacobian.AddVal2Diag(iPoint, Vol / dt);
     } else {
-      Jacobian.SetVal2Diag(iPoint, 1.0);
+      if (!JacobianFrozen) Jacobian.SetVal2Diag(iPoint, 1.0);
       LinSysRes.SetBlock_Zero(iPoint);
     }
 
@@ -311,19 +374,24 @@ void CScalarSolver<VariableType>::PrepareImplicitIteration(CGeometry* geometry,
       LinSysRes[total_index] = -LinSysRes[total_index];
       LinSysSol[total_index] = 0.0;
 
-      su2double Res = fabs(LinSysRes[total_index]);
-      resRMS[iVar] += Res * Res;
-      if (Res > resMax[iVar]) {
-        resMax[iVar] = Res;
-        idxMax[iVar] = iPoint;
-        coordMax[iVar] = geometry->nodes->GetCoord(iPoint);
+      /*--- Residual bookkeeping, restricted to a deterministic point subset
+       on the sampled iterations (the stride is 1 otherwise). ---*/
+
+      if ((iPoint % resStride) == 0) {
+        su2double Res = fabs(LinSysRes[total_index]);
+        resRMS[iVar] += Res * Res;
+        if (Res > resMax[iVar]) {
+          resMax[iVar] = Res;
+          idxMax[iVar] = iPoint;
+          coordMax[iVar] = geometry->nodes->GetCoord(iPoint);
+        }
       }
     }
   }
   END_SU2_OMP_FOR
   SU2_OMP_CRITICAL
   for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-    Residual_RMS[iVar] += resRMS[iVar];
+    Residual_RMS[iVar] += resStride * resRMS[iVar];
     AddRes_Max(iVar, resMax[iVar], geometry->nodes->GetGlobalIndex(idxMax[iVar]), coordMax[iVar]);
   }
   END_SU2_OMP_CRITICAL
@@ -36,6 +36,7 @@
 #include <algorithm>
 #include <iostream>
 #include <set>
+#include <unordered_map>
 #include <stdlib.h>
 #include <stdio.h>
 
@@ -76,11 +77,13 @@ protected:
   su2double ResLinSolver;        /*!< \brief Final linear solver residual. */
   unsigned short NonLinRes_Counter;   /*!< \brief Number of elements of the nonlinear residual indicator series. */
   vector<su2double> NonLinRes_Series; /*!< \brief Vector holding the nonlinear residual indicator series. */
+  vector<su2double> localCFLSnapshot; /*!< \brief Snapshot of the local CFL field used to bound neighbor ratios in local CFL adaption. */
   su2double Old_Func,  /*!< \brief Old value of the nonlinear residual indicator. */
   New_Func;            /*!< \brief Current value of the nonlinear residual indicator. */
   unsigned short nVar,           /*!< \brief Number of variables of the problem. */
   nPrimVar,                      /*!< \brief Number of primitive variables of the problem. */
   nPrimVarGrad,                  /*!< \brief Number of primitive variables of the problem in the gradient computation. */
+  nPrimVarGradActive,            /*!< \brief Number of primitive gradient variables with an active consumer, 0 means all of them. */
   nSecondaryVar,                 /*!< \brief Number of primitive variables of the problem. */
   nSecondaryVarGrad,             /*!< \brief Number of primitive variables of the problem in the gradient computation. */
   nVarGrad,                      /*!< \brief Number of variables for deallocating the LS Cvector. */
@@ -101,6 +104,16 @@ protected:
   su2activematrix Point_Max_Coord;     /*!< \brief Vector with pointers to the coords of the maximal residual for each variable. */
   su2activematrix Point_Max_Coord_BGS; /*!< \brief Vector with pointers to the coords of the maximal residual for each variable. */
 
+  bool JacobianFreezeCapable = false; /*!< \brief Whether the solver tolerates iterating with a frozen Jacobian. */
+  bool JacobianFrozen = false;        /*!< \brief The Jacobian is reused (not assembled) on the current iteration. */
+  unsigned short JacFreezeCount = 0;  /*!< \brief Iterations since the Jacobian was last assembled. */
+
+  vector<uint8_t> PointFrozen;  /*!< \brief Per-point mask of converged (frozen) regions, bit 1 marks a converged
+                                 point, bit 2 marks a point frozen by UpdateFrozenRegions (all neighbors converged). */
+
+  vector<uint8_t> ReducedFidelity;  /*!< \brief Per-point mask of the far field region where the adjoint recording
+                                     drops the numerics to first order, see SetAdjointFidelityMask. */
+
   /*--- Variables that need to go. ---*/
 
   su2double *Residual,      /*!< \brief Auxiliary nVar vector. */
@@ -131,9 +144,16 @@ protected:
   su2activevector iPoint_UndLapl;  /*!< \brief Auxiliary variable for the undivided Laplacians. */
   su2activevector jPoint_UndLapl;  /*!< \brief Auxiliary variable for the undivided Laplacians. */
 
+  su2activevector resSmoothWork;    /*!< \brief Ping-pong workspace for the residual smoothing sweeps. */
+  vector<uint8_t> resSmoothFixed;   /*!< \brief Points whose residual is not smoothed (physical boundaries). */
+
   int *Restart_Vars;                /*!< \brief Auxiliary structure for holding the number of variables and points in a restart. */
   int Restart_ExtIter;              /*!< \brief Auxiliary structure for holding the external iteration offset from a restart. */
   passivedouble *Restart_Data;      /*!< \brief Auxiliary structure for holding the data values from a restart. */
+  void *Restart_Map;                /*!< \brief Base address of the memory map of the restart file, if Restart_Data points into it. */
+  size_t Restart_Map_Size;          /*!< \brief Size of the memory map of the restart file. */
+  unordered_map<string, unsigned short> Restart_FieldIndex; /*!< \brief Lookup from restart field name to its column in Restart_Data. */
+  unsigned long Restart_LayoutHash; /*!< \brief Hash of the restart field-name layout. */
   unsigned short nOutputVariables;  /*!< \brief Number of variables to write. */
 
   unsigned long nMarker;            /*!< \brief Total number of markers using the grid information. */
@@ -262,6 +282,32 @@ public:
                      const CConfig *config,
                      unsigned short commType);
 
+  /*!
+   * \brief Variant of InitiateComms() that aggregates multiple quantities into a single message per neighbor.
+   * \note The quantities are packed in the given order, hence all of them must be fully
+   * computed before initiating the exchange, and they must share the same datatype.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config   - Definition of the particular problem.
+   * \param[in] commTypes - Enumerated types for the quantities to be communicated.
+   * \param[in] nComms   - Number of quantities to aggregate.
+   */
+  void InitiateComms(CGeometry *geometry,
+                     const CConfig *config,
+                     const unsigned short *commTypes,
+                     unsigned short nComms);
+
+  /*!
+   * \brief Routine to complete an aggregated exchange launched by InitiateComms() and unpacking of the data in the solver class.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config   - Definition of the particular problem.
+   * \param[in] commTypes - Enumerated types for the quantities to be unpacked, as passed to InitiateComms().
+   * \param[in] nComms   - Number of quantities to aggregate.
+   */
+  void CompleteComms(CGeometry *geometry,
+                     const CConfig *config,
+                     const unsigned short *commTypes,
+                     unsigned short nComms);
+
   /*!
    * \brief Helper function to define the type and number of variables per point for each communication type.
    * \param[in] config - Definition of the particular problem.
@@ -320,12 +366,48 @@ public:
    */
   void SetResidual_RMS(const CGeometry *geometry, const CConfig *config);
 
+  /*!
+   * \brief Whether the residual norms of the current inner iteration are exact, i.e. not an
+   * iteration where residual sampling replaces the global reductions by local estimates.
+   * \param[in] config - Definition of the particular problem.
+   */
+  static bool ExactResidualIteration(const CConfig *config) {
+    const auto interval = config->GetResidual_Sampling_Interval();
+    return (interval <= 1) || (config->GetInnerIter() % interval == 0);
+  }
+
+  /*!
+   * \brief Point stride for the residual bookkeeping of the current inner iteration. The
+   * accumulated squared residuals are scaled by the stride so that "SetResidual_RMS" can
+   * finalize sampled and exact sums alike.
+   * \param[in] config - Definition of the particular problem.
+   */
+  static unsigned long ResidualSamplingStride(const CConfig *config) {
+    /*--- Deterministic subset, every 8th point, on the sampled iterations. ---*/
+    return ExactResidualIteration(config) ? 1 : 8;
+  }
+
   /*!
    * \brief Communicate the value of the max residual and RMS residual.
    * \param[in] val_iterlinsolver - Number of linear iterations.
    */
   void SetResidual_BGS(const CGeometry *geometry, const CConfig *config);
 
+  /*!
+   * \brief Smooth the residuals (LinSysRes) with Jacobi iterations, R^{k+1}_i = (R^0_i +
+   *        coeff * sum_j R^k_j) / (1 + coeff * n_i), leaving physical boundary points untouched.
+   * \note Each sweep streams the residuals once (fused gather and update via a ping-pong
+   *       workspace) instead of the gather / update / boundary-restore passes of a naive
+   *       implementation, which matters for the explicit schemes where this stage would
+   *       otherwise double the residual memory traffic.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] nSmooth - Number of smoothing sweeps.
+   * \param[in] smoothCoeff - Smoothing coefficient.
+   */
+  void Residual_Smoothing(CGeometry *geometry, const CConfig *config,
+                          unsigned short nSmooth, su2double smoothCoeff);
+
   /*!
    * \brief Set the value of the max residual and RMS residual.
    * \param[in] val_iterlinsolver - Number of linear iterations.
@@ -406,6 +488,16 @@ public:
    */
   inline unsigned short GetnPrimVarGrad(void) const { return nPrimVarGrad; }
 
+  /*!
+   * \brief Get the number of primitive gradient variables with an active consumer.
+   * \note Solvers may exclude trailing gradient variables that nothing reads (e.g.
+   * the uniform temperature without an energy equation), which shrinks both the
+   * gradient computation and its halo exchange.
+   */
+  inline unsigned short GetnPrimVarGradActive(void) const {
+    return (nPrimVarGradActive != 0) ? nPrimVarGradActive : nPrimVarGrad;
+  }
+
   /*!
    * \brief Get the number of variables of the problem.
    */
@@ -450,6 +542,86 @@ public:
     SU2_OMP_BARRIER
   }
 
+  /*!
+   * \brief Decide if the Jacobian is frozen (reused without assembly) on the current implicit
+   * iteration, called by the integration once at the start of each iteration of the solver.
+   * \note While frozen, the space integration runs in explicit mode to skip the assembly,
+   * the implicit solve then reuses the matrix from the last iteration that refreshed it.
+   * \param[in] config - Definition of the particular problem.
+   * \return true if this iteration must skip the Jacobian assembly.
+   */
+  inline bool JacobianFreezeStep(const CConfig* config) {
+    const auto period = config->GetJacobianFreezePeriod();
+
+    const bool active = JacobianFreezeCapable && (period > 1) &&
+                        (config->GetKind_TimeIntScheme() == EULER_IMPLICIT) &&
+                        !config->GetDiscrete_Adjoint();
+
+    SU2_OMP_MASTER {
+      JacobianFrozen = active && (JacFreezeCount != 0);
+      JacFreezeCount = active? (JacFreezeCount + 1) % period : 0;
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+
+    return JacobianFrozen;
+  }
+
+  /*!
+   * \brief Whether the Jacobian is frozen on the current iteration.
+   */
+  inline bool GetJacobianFrozen() const { return JacobianFrozen; }
+
+  /*!
+   * \brief Mark the Jacobian as frozen/active, used to propagate the state to coarse multigrid levels.
+   */
+  inline void SetJacobianFrozen(bool frozen) { JacobianFrozen = frozen; }
+
+  /*!
+   * \brief Whether a point lies inside a frozen (converged) region, edge loops may skip
+   * edges whose two points are frozen since neither point is updated.
+   * \param[in] iPoint - Point index.
+   */
+  inline bool GetPointFrozen(unsigned long iPoint) const {
+    return !PointFrozen.empty() && (PointFrozen[iPoint] & 2);
+  }
+
+  /*!
+   * \brief Whether a point lies in the reduced-fidelity far field of the adjoint recording,
+   * edges between two such points use first-order numerics, see SetAdjointFidelityMask.
+   * \param[in] iPoint - Point index.
+   */
+  inline bool GetPointReducedFidelity(unsigned long iPoint) const {
+    return !ReducedFidelity.empty() && ReducedFidelity[iPoint];
+  }
+
+  /*!
+   * \brief Build the reduced-fidelity mask for the discrete adjoint recording: points farther
+   * than ADJ_FIDELITY_RADIUS from solid walls (where the sensitivities of a shape design
+   * barely depend on the numerics) may drop to first order to shrink the tape. The mask is
+   * empty, keeping full fidelity everywhere, unless the option is set on an adjoint run.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetAdjointFidelityMask(CGeometry *geometry, const CConfig *config);
+
+  /*!
+   * \brief Update the mask of frozen (converged) regions from the per-point residual magnitude,
+   * called by the integration after the time integration of the solver, inside an OpenMP
+   * parallel region. Points are frozen only if all their neighbors are also converged, so a
+   * margin of active points surrounds each cluster and rising residuals thaw it from the
+   * outside. The whole domain is thawed periodically to re-check frozen points.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void UpdateFrozenRegions(CGeometry *geometry, const CConfig *config);
+
+  /*!
+   * \brief Force a null update at points inside frozen regions by turning their Jacobian
+   * rows into identity and zeroing their residual, called before the implicit solve.
+   */
+  void EnforceFrozenPoints();
+
   /*!
    * \brief Get the maximal residual, this is useful for the convergence history.
    * \param[in] val_var - Index of the variable.
@@ -457,6 +629,13 @@ public:
    */
   inline su2double GetRes_RMS(unsigned short val_var) const { return Residual_RMS[val_var]; }
 
+  /*!
+   * \brief Adds to the (squared) RMS residual of a variable, to be finalized by "SetResidual_RMS".
+   * \param[in] val_var - Index of the variable.
+   * \param[in] val_residual - Squared residual contribution to add in the position <i>val_var</i>.
+   */
+  inline void AddRes_RMS(unsigned short val_var, su2double val_residual) { Residual_RMS[val_var] += val_residual; }
+
   /*!
    * \brief Adds the maximal residual, this is useful for the convergence history (overload).
    * \param[in] val_var - Index of the variable.
@@ -1446,6 +1625,18 @@ public:
                                              CConfig *config,
                                              unsigned short iRKStep) { }
 
+  /*!
+   * \brief A virtual member.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iRKStep - Current step of the Runge-Kutta iteration.
+   */
+  inline virtual void SSPRK3_Iteration(CGeometry *geometry,
+                                       CSolver **solver_container,
+                                       CConfig *config,
+                                       unsigned short iRKStep) { }
+
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -3518,6 +3709,53 @@ public:
                                const CConfig *config,
                                string val_filename);
 
+  /*!
+   * \brief Get the keyframe referenced by a delta-encoded binary restart file.
+   * \param[in] val_filename - String name of the restart file.
+   * \return Name of the keyframe file (without extension), empty if the file is not a delta.
+   */
+  string GetRestartDeltaKeyframe(string val_filename) const;
+
+  /*!
+   * \brief Patch the restart data of the keyframe with the sparse differences of a delta file.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - String name of the delta-encoded restart file.
+   */
+  void ApplyRestartDelta(CGeometry *geometry, const CConfig *config, string val_filename);
+
+  /*!
+   * \brief Free the memory holding the restart data, Restart_Data may point into
+   *        a memory map of the restart file instead of owning its storage.
+   */
+  void FreeRestartData();
+
+  /*!
+   * \brief Build the field-name lookup table and the layout hash for the restart
+   *        data just read, called at the end of the ASCII and binary readers.
+   */
+  void BuildRestartFieldLookup();
+
+  /*!
+   * \brief Get the column of a field in the restart data in O(1), e.g. to locate the
+   *        variables of a solver without per-field string scans and without assuming
+   *        a fixed layout, so that files with extra or missing fields can be handled.
+   * \param[in] val_fieldName - Name of the field, without the quotes used in file headers.
+   * \return Column index of the field in Restart_Data, or -1 if it is not present.
+   */
+  short GetRestartFieldIndex(const string& val_fieldName) const {
+    const auto it = Restart_FieldIndex.find(val_fieldName);
+    return (it != Restart_FieldIndex.end()) ? static_cast<short>(it->second) : -1;
+  }
+
+  /*!
+   * \brief Get the hash of the restart field layout. Equal hashes mean identical field
+   *        names in identical order, allowing offsets from a previous read to be reused
+   *        without comparing the names again.
+   * \return FNV-1a hash of the restart field names.
+   */
+  unsigned long GetRestartLayoutHash() const { return Restart_LayoutHash; }
+
   /*!
    * \brief Read the metadata from a native SU2 restart file (ASCII or binary).
    * \param[in] geometry - Geometrical definition of the problem.
@@ -3830,6 +4068,13 @@ public:
    */
   inline virtual void SetVelocity_Inf(unsigned short val_dim, su2double val_velocity) { }
 
+  /*!
+   * \brief A virtual member, recompute the farfield velocity vector from the flow
+   *        angles currently set in the config (e.g. after a continuation update).
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void UpdateFarfieldVelocity(const CConfig *config) { }
+
   /*!
    * \brief A virtual member.
    * \param[in] kind_recording - Kind of AD recording.
@@ -30,6 +30,8 @@
 
 #include "CTurbSolver.hpp"
 
+class CFlowVariable;
+
 /*!
  * \class CTurbSASolver
  * \brief Main class for defining the turbulence model solver.
@@ -51,6 +53,18 @@ private:
                           CGeometry *geometry,
                           CConfig *config);
 
+  /*!
+   * \brief Vectorized (SIMD) evaluation of the source terms of the standard model,
+   * used by Source_Residual when vectorization is enabled.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] flowNodes - Flow variables.
+   * \param[in] config - Definition of the particular problem.
+   */
+  template<size_t nDim>
+  void SourceResidualVectorized(CGeometry *geometry,
+                                CFlowVariable *flowNodes,
+                                const CConfig *config);
+
   /*!
    * \brief Compute nu tilde from the wall functions.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -56,6 +56,13 @@ private:
                      const CConfig *config,
                      unsigned short val_marker);
 
+  /*!
+   * \brief Instantiate the vectorized numerics (combined convective and viscous fluxes).
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InstantiateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) final;
+
 
 public:
   /*!
@@ -105,6 +105,15 @@ public:
    */
   bool SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel) final;
 
+  /*!
+   * \brief Set the primitive and secondary variables from a thermodynamic state evaluated in
+   * a batch (see CFluidModel::ComputeTDState_rhoe), the velocity must already be set. Falls
+   * back to the point-wise update (which restores the old solution) for non-physical states.
+   * \return True if the solution is physical.
+   */
+  bool SetPrimVar(unsigned long iPoint, su2double pressure, su2double temperature, su2double soundspeed2,
+                  su2double val_dPdrho_e, su2double val_dPde_rho, CFluidModel *FluidModel);
+
   /*!
    * \brief A virtual member.
    */
@@ -249,4 +249,15 @@ class CFlowVariable : public CVariable {
    * \return Vector of magnitudes.
    */
   inline su2activevector& GetStrainMag() { return StrainMag; }
+
+  /*!
+   * \brief Compute the bytes allocated by the major containers of the class.
+   * \return Number of allocated bytes.
+   */
+  unsigned long GetFootprint() const override {
+    return CVariable::GetFootprint() +
+           sizeof(su2double) * (Primitive.size() + Gradient_Primitive.size() + Gradient_Aux.size() +
+                                Limiter_Primitive.size() + Velocity2.size() + Solution_New.size() +
+                                HB_Source.size() + Vorticity.size() + StrainMag.size());
+  }
 };
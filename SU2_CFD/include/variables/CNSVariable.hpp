@@ -150,6 +150,19 @@ public:
   bool SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2double turb_ke, CFluidModel *FluidModel) override;
   using CVariable::SetPrimVar;
 
+  /*!
+   * \brief Set the primitive and secondary variables from a thermodynamic and transport state
+   * evaluated in a batch (see CFluidModel::ComputeTDState_rhoe and ComputeTransport_rhoe), the
+   * velocity must already be set. Falls back to the point-wise update (which restores the old
+   * solution) for non-physical states.
+   * \return True if the solution is physical.
+   */
+  bool SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2double turb_ke, su2double pressure,
+                  su2double temperature, su2double soundspeed2, su2double val_dPdrho_e, su2double val_dPde_rho,
+                  su2double val_dTdrho_e, su2double val_dTde_rho, su2double laminar_visc, su2double val_dmudrho_T,
+                  su2double val_dmudT_rho, su2double thermal_cond, su2double val_dktdrho_T, su2double val_dktdT_rho,
+                  su2double cp, CFluidModel *FluidModel);
+
   /*!
    * \brief Set all the secondary variables (partial derivatives) for compressible flows
    */
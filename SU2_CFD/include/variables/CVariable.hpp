@@ -50,6 +50,10 @@ class CVariable {
 protected:
   using VectorType = C2DContainer<unsigned long, su2double, StorageType::ColumnMajor, 64, DynamicSize, 1>;
   using MatrixType = C2DContainer<unsigned long, su2double, StorageType::RowMajor,    64, DynamicSize, DynamicSize>;
+  /*--- Row major (point major) storage keeps the variables of each point contiguous,
+   *    which is what the su2double* accessors and the per-point gathers of the SIMD
+   *    numerics (C2DContainer::get) require. ---*/
+  static_assert(MatrixType::IsRowMajor, "Needed to return rows as pointers.");
 
   MatrixType Solution;       /*!< \brief Solution of the problem. */
   MatrixType Solution_Old;   /*!< \brief Old solution of the problem R-K. */
@@ -70,6 +74,7 @@ protected:
 
   CVectorOfMatrix Gradient;  /*!< \brief Gradient of the solution of the problem. */
   C3DDoubleMatrix Rmatrix;   /*!< \brief Geometry-based matrix for weighted least squares gradient calculations. */
+  C3DDoubleMatrix SmatrixCache[2]; /*!< \brief Cached least squares pseudoinverses (unweighted/weighted), only allocated on static grids. */
 
   MatrixType Limiter;        /*!< \brief Limiter of the solution of the problem. */
   MatrixType Solution_Max;   /*!< \brief Max solution for limiter computation. */
@@ -267,6 +272,15 @@ public:
    */
   void Set_Solution_time_n1();
 
+  /*!
+   * \brief Shift the solution time history, time n becomes time n-1 and the current
+   * solution becomes time n, used when advancing to the next physical time step.
+   * \note The n-1 level takes over the storage of the n level without copying, only
+   * the current solution is copied since it remains in use, this halves the cost of
+   * the per-step history update. Must be called inside an OpenMP parallel region.
+   */
+  void Shift_Solution_time();
+
   /*!
    * \brief Set the variable solution at time n.
    * \param[in] iPoint - Point index.
@@ -682,6 +696,7 @@ public:
    * \return Reference to gradient.
    */
   inline CVectorOfMatrix& GetGradient(void) { return Gradient; }
+  inline const CVectorOfMatrix& GetGradient(void) const { return Gradient; }
 
   /*!
    * \brief Get the value of the solution gradient.
@@ -723,11 +738,37 @@ public:
    */
   inline C3DDoubleMatrix& GetRmatrix(void) { return Rmatrix; }
 
+  /*!
+   * \brief Get the cache of least squares pseudoinverses, which depend only on the
+   *        grid coordinates and are thus reusable on static grids.
+   * \param[in] weighted - Cache for weighted or unweighted least squares.
+   * \return Pointer to the cache container, empty until built by the gradient computation.
+   */
+  inline C3DDoubleMatrix* GetSmatrixCache(bool weighted) { return &SmatrixCache[weighted]; }
+
+  /*!
+   * \brief Compute the bytes allocated by the major containers of the class,
+   *        derived classes add the fields they introduce.
+   * \return Number of allocated bytes.
+   */
+  virtual unsigned long GetFootprint() const {
+    return sizeof(su2double) *
+               (Solution.size() + Solution_Old.size() + External.size() + UnderRelaxation.size() + LocalCFL.size() +
+                Solution_time_n.size() + Solution_time_n1.size() + Delta_Time.size() + Gradient.size() +
+                Rmatrix.size() + SmatrixCache[0].size() + SmatrixCache[1].size() + Limiter.size() +
+                Solution_Max.size() + Solution_Min.size() + AuxVar.size() + Grad_AuxVar.size() +
+                Max_Lambda_Inv.size() + Max_Lambda_Visc.size() + Lambda.size() + Sensor.size() +
+                Undivided_Laplacian.size() + Res_TruncError.size() + Residual_Old.size() + Residual_Sum.size() +
+                Solution_BGS_k.size()) +
+           sizeof(int) * (AD_InputIndex.size() + AD_OutputIndex.size());
+  }
+
   /*!
    * \brief Get the slope limiter.
    * \return Reference to the limiters vector.
    */
   inline MatrixType& GetLimiter(void) { return Limiter; }
+  inline const MatrixType& GetLimiter(void) const { return Limiter; }
 
   /*!
    * \brief Get the value of the slope limiter.
@@ -0,0 +1,196 @@
+/*!
+ * \file CSyntheticEddyInflow.cpp
+ * \brief Synthetic eddy method inflow generator for inlet markers.
+ * \version 7.2.1 "Blackbird"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2021, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/CSyntheticEddyInflow.hpp"
+
+#include <limits>
+
+CSyntheticEddyInflow::CSyntheticEddyInflow(CGeometry *geometry, const CConfig *config, const string& markerTag) {
+
+  nDim      = geometry->GetnDim();
+  nEddy     = config->GetInlet_SEM_nEddy();
+  sigma     = config->GetInlet_SEM_LengthScale();
+  intensity = config->GetInlet_SEM_Intensity();
+
+  if (sigma <= 0.0)
+    SU2_MPI::Error("INLET_SEM_LENGTH_SCALE must be positive when INLET_SEM_INTENSITY is set.", CURRENT_FUNCTION);
+
+  /*--- Find the local index of the marker, ranks that do not hold a part of it
+   *    still participate in the reductions below with empty contributions. ---*/
+
+  short localMarker = -1;
+  for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++)
+    if (config->GetMarker_All_TagBound(iMarker) == markerTag) localMarker = iMarker;
+
+  /*--- Bounding box of the marker and its mean inward normal (the convection
+   *    direction of the eddies), reduced over all ranks. ---*/
+
+  passivedouble myMin[3], myMax[3], myDir[3] = {0.0, 0.0, 0.0};
+
+  for (auto iDim = 0u; iDim < 3; iDim++) {
+    myMin[iDim] =  numeric_limits<passivedouble>::max();
+    myMax[iDim] = -numeric_limits<passivedouble>::max();
+  }
+
+  if (localMarker >= 0) {
+    for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(localMarker); iVertex++) {
+      const auto iPoint = geometry->vertex[localMarker][iVertex]->GetNode();
+      if (!geometry->nodes->GetDomain(iPoint)) continue;
+
+      for (auto iDim = 0u; iDim < nDim; iDim++) {
+        const auto coord = SU2_TYPE::GetValue(geometry->nodes->GetCoord(iPoint, iDim));
+        myMin[iDim] = min(myMin[iDim], coord);
+        myMax[iDim] = max(myMax[iDim], coord);
+      }
+
+      /*--- Vertex normals point out of the domain, negate for the inflow direction. ---*/
+
+      const auto normal = geometry->vertex[localMarker][iVertex]->GetNormal();
+      for (auto iDim = 0u; iDim < nDim; iDim++)
+        myDir[iDim] -= SU2_TYPE::GetValue(normal[iDim]);
+    }
+  }
+
+  passivedouble globMin[3], globMax[3], globDir[3];
+  SU2_MPI::Allreduce(myMin, globMin, 3, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(myMax, globMax, 3, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(myDir, globDir, 3, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+  passivedouble dirNorm = 0.0;
+  for (auto iDim = 0u; iDim < nDim; iDim++) dirNorm += pow(globDir[iDim], 2);
+  dirNorm = sqrt(max(dirNorm, numeric_limits<passivedouble>::epsilon()));
+
+  /*--- Expand the box by one length scale so that eddies influence the whole
+   *    marker while entering and leaving, and cache the derived quantities. ---*/
+
+  boxVolume = 1.0;
+  convAxis = 0;
+  for (auto iDim = 0u; iDim < 3; iDim++) {
+    boxMin[iDim] = 0.0; boxMax[iDim] = 0.0; convDir[iDim] = 0.0;
+  }
+  for (auto iDim = 0u; iDim < nDim; iDim++) {
+    boxMin[iDim] = globMin[iDim] - sigma;
+    boxMax[iDim] = globMax[iDim] + sigma;
+    boxVolume *= boxMax[iDim] - boxMin[iDim];
+    convDir[iDim] = globDir[iDim] / dirNorm;
+    if (fabs(convDir[iDim]) > fabs(convDir[convAxis])) convAxis = iDim;
+  }
+
+  convVel = config->GetModVel_FreeStreamND();
+
+  /*--- Seed from the config and the position of the marker in the config file,
+   *    identical on every rank so that all ranks evolve the same population. ---*/
+
+  generator.seed(config->GetInlet_SEM_Seed() + config->GetMarker_CfgFile_TagBound(markerTag));
+
+  eddyPos.resize(nEddy*nDim);
+  eddySign.resize(nEddy*3);
+
+  for (auto iEddy = 0ul; iEddy < nEddy; iEddy++) SpawnEddy(iEddy, false);
+
+  lastTimeIter = numeric_limits<unsigned long>::max();
+
+}
+
+void CSyntheticEddyInflow::SpawnEddy(unsigned long iEddy, bool upstream) {
+
+  uniform_real_distribution<passivedouble> uniform(0.0, 1.0);
+
+  for (auto iDim = 0u; iDim < nDim; iDim++)
+    eddyPos[iEddy*nDim+iDim] = boxMin[iDim] + uniform(generator)*(boxMax[iDim] - boxMin[iDim]);
+
+  /*--- Recycled eddies re-enter through the upstream face of the box. ---*/
+
+  if (upstream)
+    eddyPos[iEddy*nDim+convAxis] = (convDir[convAxis] > 0.0)? boxMin[convAxis] : boxMax[convAxis];
+
+  for (auto iDim = 0u; iDim < 3; iDim++)
+    eddySign[iEddy*3+iDim] = (uniform(generator) < 0.5)? -1 : 1;
+
+}
+
+void CSyntheticEddyInflow::UpdateEddies(const CConfig *config) {
+
+  /*--- Convect only once per time iteration, the boundary routines of multiple
+   *    solvers (flow, turbulence) may all ask for an update. ---*/
+
+  const auto timeIter = config->GetTimeIter();
+  if (timeIter == lastTimeIter) return;
+  lastTimeIter = timeIter;
+
+  const su2double dist = convVel * config->GetDelta_UnstTimeND();
+  if (dist == 0.0) return;
+
+  for (auto iEddy = 0ul; iEddy < nEddy; iEddy++) {
+
+    bool outside = false;
+    for (auto iDim = 0u; iDim < nDim; iDim++) {
+      eddyPos[iEddy*nDim+iDim] += convDir[iDim]*dist;
+      outside = outside || (eddyPos[iEddy*nDim+iDim] < boxMin[iDim]) ||
+                           (eddyPos[iEddy*nDim+iDim] > boxMax[iDim]);
+    }
+
+    if (outside) SpawnEddy(iEddy, true);
+  }
+
+}
+
+void CSyntheticEddyInflow::GetFluctuation(const su2double *coord, su2double velMag, su2double *uPrime) const {
+
+  for (auto iDim = 0u; iDim < nDim; iDim++) uPrime[iDim] = 0.0;
+
+  /*--- Superposition of the tent-shaped eddies, normalized so that the variance
+   *    of each component is (intensity * velMag)^2 for a filled box. ---*/
+
+  for (auto iEddy = 0ul; iEddy < nEddy; iEddy++) {
+
+    su2double shape = 1.0;
+    for (auto iDim = 0u; iDim < nDim; iDim++) {
+      const su2double r = fabs(coord[iDim] - eddyPos[iEddy*nDim+iDim]) / sigma;
+      if (r >= 1.0) { shape = 0.0; break; }
+      shape *= sqrt(1.5)*(1.0 - r);
+    }
+    if (shape == 0.0) continue;
+
+    for (auto iDim = 0u; iDim < nDim; iDim++)
+      uPrime[iDim] += su2double(eddySign[iEddy*3+iDim]) * shape;
+  }
+
+  const su2double scale = intensity * velMag * sqrt(boxVolume / (nEddy * pow(sigma, int(nDim))));
+
+  for (auto iDim = 0u; iDim < nDim; iDim++) uPrime[iDim] *= scale;
+
+}
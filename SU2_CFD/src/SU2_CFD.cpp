@@ -26,6 +26,7 @@
  */
 
 #include "../include/SU2_CFD.hpp"
+#include "../../Common/include/toolboxes/profiling_toolbox.hpp"
 
 /* LIBXSMM include files, if supported. */
 #ifdef HAVE_LIBXSMM
@@ -89,6 +90,48 @@ int main(int argc, char *argv[]) {
    file is specified, default.cfg is used) ---*/
   strcpy(config_file_name, filename.c_str());
 
+  /*--- Ensemble mode: the top-level config only lists the case configs, the MPI
+   communicator is partitioned into one contiguous group of ranks per case and
+   each group runs its case concurrently, paying the startup cost once per group
+   instead of once per job. From here on each rank proceeds exactly as a normal
+   run of its case, on the group communicator. ---*/
+
+  {
+    const CConfig ensembleConfig(config_file_name, SU2_COMPONENT::SU2_CFD);
+    const int nCases = ensembleConfig.GetnEnsembleCases();
+
+    if ((nCases > 0) && !dry_run) {
+#ifdef HAVE_MPI
+      int worldRank, worldSize;
+      SU2_MPI::Comm_rank(MPICommunicator, &worldRank);
+      SU2_MPI::Comm_size(MPICommunicator, &worldSize);
+
+      if (worldSize < nCases)
+        SU2_MPI::Error("Ensemble mode needs at least one rank per case.", CURRENT_FUNCTION);
+
+      /*--- Balanced contiguous blocks, case i owns ranks [i*size/N, (i+1)*size/N). ---*/
+
+      int iCase = 0;
+      while ((iCase+1)*worldSize/nCases <= worldRank) ++iCase;
+
+      if (worldRank == 0)
+        cout << "Ensemble run: " << worldSize << " ranks partitioned between "
+             << nCases << " cases." << endl;
+
+      SU2_MPI::Comm caseComm;
+      MPI_Comm_split(MPICommunicator, iCase, worldRank, &caseComm);
+
+      MPICommunicator = caseComm;
+      SU2_MPI::SetComm(caseComm);
+
+      strcpy(config_file_name, ensembleConfig.GetEnsembleCase(iCase).c_str());
+#else
+      SU2_MPI::Error("Ensemble mode requires an MPI build, the cases cannot run concurrently.",
+                     CURRENT_FUNCTION);
+#endif
+    }
+  }
+
   /*--- Read the name and format of the input mesh file to get from the mesh
    file the number of zones and dimensions from the numerical grid (required
    for variables allocation). ---*/
@@ -159,6 +202,10 @@ int main(int argc, char *argv[]) {
 
   delete driver;
 
+  /*--- Dump the kernel timing statistics, if profiling is compiled in. ---*/
+
+  SU2_PROFILE_REPORT("su2_kernel_profile.json");
+
   /*---Finalize libxsmm, if supported. ---*/
 #ifdef HAVE_LIBXSMM
   libxsmm_finalize();
@@ -33,6 +33,7 @@
 #include "../../include/iteration/CIterationFactory.hpp"
 #include "../../include/iteration/CTurboIteration.hpp"
 #include "../../../Common/include/toolboxes/CQuasiNewtonInvLeastSquares.hpp"
+#include "../../../Common/include/toolboxes/profiling_toolbox.hpp"
 
 CDiscAdjSinglezoneDriver::CDiscAdjSinglezoneDriver(char* confFile,
                                                    unsigned short val_nZone,
@@ -263,7 +264,17 @@ void CDiscAdjSinglezoneDriver::SetRecording(RECORDING kind_recording){
     }
   }
 
-  /*---Enable recording and register input of the iteration --- */
+  const bool wrt_AD_stats = (kind_recording != RECORDING::CLEAR_INDICES) &&
+                            config_container[ZONE_0]->GetWrt_AD_Statistics();
+#ifdef CODI_REVERSE_TYPE
+  su2double memInput = 0.0, memDependencies = 0.0, memIteration = 0.0;
+#endif
+
+  /*---Enable recording and register input of the iteration. The recorded
+   section must stay free of heap allocations, the audit (active in PROFILE
+   builds) flags regressions. --- */
+
+  SU2_ALLOC_AUDIT_SCOPE("adjoint_recording");
 
   if (kind_recording != RECORDING::CLEAR_INDICES){
 
@@ -272,15 +283,27 @@ void CDiscAdjSinglezoneDriver::SetRecording(RECORDING kind_recording){
     iteration->RegisterInput(solver_container, geometry_container, config_container, ZONE_0, INST_0, kind_recording);
   }
 
+#ifdef CODI_REVERSE_TYPE
+  if (wrt_AD_stats) memInput = AD::TapeMemoryUsed();
+#endif
+
   /*--- Set the dependencies of the iteration ---*/
 
   iteration->SetDependencies(solver_container, geometry_container, numerics_container, config_container, ZONE_0,
                              INST_0, kind_recording);
 
+#ifdef CODI_REVERSE_TYPE
+  if (wrt_AD_stats) memDependencies = AD::TapeMemoryUsed();
+#endif
+
   /*--- Do one iteration of the direct solver ---*/
 
   DirectRun(kind_recording);
 
+#ifdef CODI_REVERSE_TYPE
+  if (wrt_AD_stats) memIteration = AD::TapeMemoryUsed();
+#endif
+
   /*--- Store the recording state ---*/
 
   RecordingState = kind_recording;
@@ -293,9 +316,20 @@ void CDiscAdjSinglezoneDriver::SetRecording(RECORDING kind_recording){
 
   SetObjFunction();
 
-  if (kind_recording != RECORDING::CLEAR_INDICES && config_container[ZONE_0]->GetWrt_AD_Statistics()) {
+  if (wrt_AD_stats) {
     if (rank == MASTER_NODE) AD::PrintStatistics();
 #ifdef CODI_REVERSE_TYPE
+    /*--- Break the tape memory down by recording phase, to show where the
+     memory goes and which kernels could still benefit from preaccumulation. ---*/
+    if (rank == MASTER_NODE) {
+      cout << "Tape memory per recording phase (rank 0)\n";
+      cout << "-------------------------------------\n";
+      cout << "  Input registration     :  " << memInput << " MB\n";
+      cout << "  Dependency recording   :  " << memDependencies - memInput << " MB\n";
+      cout << "  Direct iteration       :  " << memIteration - memDependencies << " MB\n";
+      cout << "  Outputs and objective  :  " << AD::TapeMemoryUsed() - memIteration << " MB\n";
+      cout << "-------------------------------------\n" << endl;
+    }
     if (size > SINGLE_NODE) {
       su2double myMem = AD::getGlobalTape().getTapeValues().getUsedMemorySize(), totMem = 0.0;
       SU2_MPI::Allreduce(&myMem, &totMem, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
@@ -35,6 +35,7 @@
 #include "../../../Common/include/interface_interpolation/CInterpolator.hpp"
 #include "../../../Common/include/interface_interpolation/CInterpolatorFactory.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/memory_footprint.hpp"
 #include "../../include/definition_structure.hpp"
 #include "../../include/integration/CIntegrationFactory.hpp"
 #include "../../include/interfaces/cfd/CConservativeVarsInterface.hpp"
@@ -271,6 +272,33 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
     MDOFsDomain += DOFsPerPoint * geometry_container[iZone][INST_0][MESH_0]->GetGlobal_nPointDomain() / (1.0e6);
   }
 
+  /*--- Report the memory footprint of the major containers, the linear algebra
+   *    registered itself on allocation, the solution variables are queried here,
+   *    and the dual-grid contribution is estimated from its dimensions. ---*/
+
+  if (config_container[ZONE_0]->GetWrt_MemoryFootprint() && !dry_run) {
+    unsigned long nPointGlobal = 0;
+    for (iZone = 0; iZone < nZone; iZone++) {
+      nPointGlobal += geometry_container[iZone][INST_0][MESH_0]->GetGlobal_nPointDomain();
+      for (iInst = 0; iInst < nInst[iZone]; iInst++) {
+        for (unsigned short iMesh = 0; iMesh <= config_container[iZone]->GetnMGLevels(); iMesh++) {
+          for (auto iSol = 0u; iSol < MAX_SOLS; iSol++) {
+            auto* solver = solver_container[iZone][iInst][iMesh][iSol];
+            if (solver != nullptr && solver->GetNodes() != nullptr)
+              MemoryFootprint::Register(MemoryFootprint::SOLUTION_VARIABLES, solver->GetNodes()->GetFootprint());
+          }
+          /*--- Coordinates, dual volumes, normals, and element connectivity. ---*/
+          const auto* geometry = geometry_container[iZone][iInst][iMesh];
+          const long geoBytes = sizeof(su2double) * (geometry->GetnPoint() * (geometry->GetnDim() + 3ul) +
+                                                     geometry->GetnEdge() * (geometry->GetnDim() + 2ul)) +
+                                sizeof(unsigned long) * geometry->GetnElem() * 8ul;
+          MemoryFootprint::Register(MemoryFootprint::GRID_GEOMETRY, geoBytes);
+        }
+      }
+    }
+    MemoryFootprint::Report(nPointGlobal);
+  }
+
   /*--- Reset timer for compute/output performance benchmarking. ---*/
 
   StopTime = SU2_MPI::Wtime();
@@ -333,6 +361,81 @@ void CDriver::SetContainers_Null() {
   strcpy(runtime_file_name, "runtime.dat");
 }
 
+void CDriver::AdaptMesh(const string& meshFileName) {
+
+  CConfig* config = config_container[ZONE_0];
+
+  if ((nZone > 1) || (nInst[ZONE_0] > 1))
+    SU2_MPI::Error("The mesh adaptation handoff supports a single zone and instance.", CURRENT_FUNCTION);
+  if (config->GetTime_Domain())
+    SU2_MPI::Error("The mesh adaptation handoff is implemented for steady problems.", CURRENT_FUNCTION);
+  if (config->GetFEMSolver())
+    SU2_MPI::Error("The mesh adaptation handoff is not available for FEM problems.", CURRENT_FUNCTION);
+
+  if (rank == MASTER_NODE)
+    cout << endl << "----------------------- Mesh Adaptation Handoff --------------------------" << endl;
+
+  /*--- Write the current solution, the rebuilt solvers restart from it and
+   interpolate between the meshes since the point counts will not match
+   (see CSolver::InterpolateRestartData). Requires RESTART in OUTPUT_FILES. ---*/
+
+  output_container[ZONE_0]->SetResult_Files(geometry_container[ZONE_0][INST_0][MESH_0], config,
+                                            solver_container[ZONE_0][INST_0][MESH_0], 0, true);
+
+  /*--- Tear down every mesh-sized structure of the zone, in the same order as
+   Postprocessing(). The config, iteration, output (history state), and the
+   driver-level containers are preserved. ---*/
+
+  Numerics_Postprocessing(numerics_container[ZONE_0], solver_container[ZONE_0][INST_0],
+                          geometry_container[ZONE_0][INST_0], config, INST_0);
+  Integration_Postprocessing(integration_container[ZONE_0], geometry_container[ZONE_0][INST_0], config, INST_0);
+  Solver_Postprocessing(solver_container[ZONE_0], geometry_container[ZONE_0][INST_0], config, INST_0);
+
+  for (unsigned short iMGlevel = 0; iMGlevel < config->GetnMGLevels() + 1; iMGlevel++)
+    delete geometry_container[ZONE_0][INST_0][iMGlevel];
+  delete[] geometry_container[ZONE_0][INST_0];
+  geometry_container[ZONE_0][INST_0] = nullptr;
+
+  delete grid_movement[ZONE_0][INST_0];
+  grid_movement[ZONE_0][INST_0] = nullptr;
+  delete surface_movement[ZONE_0];
+  surface_movement[ZONE_0] = nullptr;
+
+  /*--- Point the config at the new mesh and at the solution just written. ---*/
+
+  config->SetMesh_FileName(meshFileName);
+  config->SetSolution_FileName(config->GetRestart_FileName());
+  config->SetRestart(true);
+
+  /*--- Rebuild the mesh-dependent structures, same sequence as the constructor.
+   Solver_Preprocessing reloads the solution through the restart machinery. ---*/
+
+  Geometrical_Preprocessing(config, geometry_container[ZONE_0][INST_0], false);
+
+  CGeometry::ComputeWallDistance(config_container, geometry_container);
+
+  Solver_Preprocessing(config, geometry_container[ZONE_0][INST_0], solver_container[ZONE_0][INST_0]);
+
+  Numerics_Preprocessing(config, geometry_container[ZONE_0][INST_0], solver_container[ZONE_0][INST_0],
+                         numerics_container[ZONE_0][INST_0]);
+
+  Integration_Preprocessing(config, solver_container[ZONE_0][INST_0][MESH_0], integration_container[ZONE_0][INST_0]);
+
+  DynamicMesh_Preprocessing(config, geometry_container[ZONE_0][INST_0], solver_container[ZONE_0][INST_0],
+                            iteration_container[ZONE_0][INST_0], grid_movement[ZONE_0][INST_0],
+                            surface_movement[ZONE_0]);
+
+  StaticMesh_Preprocessing(config, geometry_container[ZONE_0][INST_0]);
+
+  /*--- The output data sorters are sized by the old mesh, drop them so they are
+   re-allocated on the next output, the history state is untouched. ---*/
+
+  output_container[ZONE_0]->ResetDataSorters();
+
+  if (rank == MASTER_NODE)
+    cout << "Solution transferred to the adapted mesh." << endl;
+}
+
 void CDriver::Postprocessing() {
   const bool wrt_perf = config_container[ZONE_0]->GetWrt_Performance();
 
@@ -703,15 +806,30 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig* config, CGeometry**& geomet
   if (rank == MASTER_NODE) cout << "Setting point connectivity." << endl;
   geometry[MESH_0]->SetPoint_Connectivity();
 
-  /*--- Renumbering points using Reverse Cuthill McKee ordering ---*/
+  /*--- Renumbering points for better locality in the linear solver ---*/
 
-  if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
-  geometry[MESH_0]->SetRCM_Ordering(config);
+  switch (config->GetKind_Point_Reordering()) {
+    case POINT_REORDERING::NONE:
+      /*--- Without renumbering, build a space-filling-curve iteration order
+       *    so that point loops still visit neighborhoods together. ---*/
+      geometry[MESH_0]->SetSFCIterationOrder();
+      break;
+    case POINT_REORDERING::RCM:
+      if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
+      geometry[MESH_0]->SetRCM_Ordering(config);
+      break;
+    case POINT_REORDERING::HILBERT:
+      if (rank == MASTER_NODE) cout << "Renumbering points (Hilbert Space-Filling Curve Ordering)." << endl;
+      geometry[MESH_0]->SetHilbert_Ordering(config);
+      break;
+  }
 
   /*--- recompute elements surrounding points, points surrounding points ---*/
 
-  if (rank == MASTER_NODE) cout << "Recomputing point connectivity." << endl;
-  geometry[MESH_0]->SetPoint_Connectivity();
+  if (config->GetKind_Point_Reordering() != POINT_REORDERING::NONE) {
+    if (rank == MASTER_NODE) cout << "Recomputing point connectivity." << endl;
+    geometry[MESH_0]->SetPoint_Connectivity();
+  }
 
   /*--- Compute elements surrounding elements ---*/
 
@@ -1641,6 +1759,8 @@ void CDriver::Numerics_Preprocessing(CConfig* config, CGeometry** geometry, CSol
                  (config->GetEnergy_Equation() && !config->GetStreamwise_Periodic_Temperature()))
           numerics[iMGlevel][FLOW_SOL][source_second_term] =
               new CSourceIncStreamwisePeriodic_Outlet(nDim, nVar_Flow, config);
+        else if (!incompressible && config->GetSponge_Layer())
+          numerics[iMGlevel][FLOW_SOL][source_second_term] = new CSourceSpongeLayer(nDim, nVar_Flow, config);
         else
           numerics[iMGlevel][FLOW_SOL][source_second_term] = new CSourceNothing(nDim, nVar_Flow, config);
       }
@@ -3366,6 +3486,13 @@ void CHBDriver::SetHarmonicBalance(unsigned short iInst) {
   /*--- Compute various source terms for explicit direct, implicit direct, and adjoint problems ---*/
   /*--- Loop over all grid levels ---*/
   for (iMGlevel = 0; iMGlevel <= config_container[ZONE_0]->GetnMGLevels(); iMGlevel++) {
+
+    /*--- Cache the variable containers of all instances on this grid level,
+          they are dereferenced nInst times per point below. ---*/
+    vector<CVariable*> instNodes(nInstHB);
+    for (jInst = 0; jInst < nInstHB; jInst++)
+      instNodes[jInst] = solver_container[ZONE_0][jInst][iMGlevel][adjoint? ADJFLOW_SOL : FLOW_SOL]->GetNodes();
+
     /*--- Loop over each node in the volume mesh ---*/
     for (iPoint = 0; iPoint < geometry_container[ZONE_0][iInst][iMGlevel]->GetnPoint(); iPoint++) {
       for (iVar = 0; iVar < nVar; iVar++) {
@@ -3377,12 +3504,11 @@ void CHBDriver::SetHarmonicBalance(unsigned short iInst) {
         /*--- Retrieve solution at this node in current zone ---*/
         for (iVar = 0; iVar < nVar; iVar++) {
           if (!adjoint) {
-            U[iVar] = solver_container[ZONE_0][jInst][iMGlevel][FLOW_SOL]->GetNodes()->GetSolution(iPoint, iVar);
+            U[iVar] = instNodes[jInst]->GetSolution(iPoint, iVar);
             Source[iVar] += U[iVar] * D[iInst][jInst];
 
             if (implicit) {
-              U_old[iVar] =
-                  solver_container[ZONE_0][jInst][iMGlevel][FLOW_SOL]->GetNodes()->GetSolution_Old(iPoint, iVar);
+              U_old[iVar] = instNodes[jInst]->GetSolution_Old(iPoint, iVar);
               deltaU = U[iVar] - U_old[iVar];
               Source[iVar] += deltaU * D[iInst][jInst];
             }
@@ -3390,28 +3516,21 @@ void CHBDriver::SetHarmonicBalance(unsigned short iInst) {
           }
 
           else {
-            Psi[iVar] = solver_container[ZONE_0][jInst][iMGlevel][ADJFLOW_SOL]->GetNodes()->GetSolution(iPoint, iVar);
+            Psi[iVar] = instNodes[jInst]->GetSolution(iPoint, iVar);
             Source[iVar] += Psi[iVar] * D[jInst][iInst];
 
             if (implicit) {
-              Psi_old[iVar] =
-                  solver_container[ZONE_0][jInst][iMGlevel][ADJFLOW_SOL]->GetNodes()->GetSolution_Old(iPoint, iVar);
+              Psi_old[iVar] = instNodes[jInst]->GetSolution_Old(iPoint, iVar);
               deltaPsi = Psi[iVar] - Psi_old[iVar];
               Source[iVar] += deltaPsi * D[jInst][iInst];
             }
           }
         }
+      }
 
-        /*--- Store sources for current row ---*/
-        for (iVar = 0; iVar < nVar; iVar++) {
-          if (!adjoint) {
-            solver_container[ZONE_0][iInst][iMGlevel][FLOW_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar,
-                                                                                                       Source[iVar]);
-          } else {
-            solver_container[ZONE_0][iInst][iMGlevel][ADJFLOW_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar,
-                                                                                                          Source[iVar]);
-          }
-        }
+      /*--- Store sources for current row, once the sum over the columns is complete. ---*/
+      for (iVar = 0; iVar < nVar; iVar++) {
+        instNodes[iInst]->SetHarmonicBalance_Source(iPoint, iVar, Source[iVar]);
       }
     }
   }
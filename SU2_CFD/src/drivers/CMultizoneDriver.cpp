@@ -29,6 +29,7 @@
 #include "../../include/definition_structure.hpp"
 #include "../../../Common/include/interface_interpolation/CInterpolator.hpp"
 #include "../../include/output/COutput.hpp"
+#include "../../include/output/filewriter/CParaviewVTMFileWriter.hpp"
 #include "../../include/iteration/CIteration.hpp"
 
 CMultizoneDriver::CMultizoneDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunicator) :
@@ -61,6 +62,22 @@ CMultizoneDriver::CMultizoneDriver(char* confFile, unsigned short val_nZone, SU2
     }
   }
 
+  /*--- Bookkeeping to skip the solve of zones that can no longer change. ---*/
+  zone_converged = new bool[nZone];
+  zone_updated   = new bool[nZone];
+  for (iZone = 0; iZone < nZone; iZone++){
+    zone_converged[iZone] = false;
+    zone_updated[iZone]   = true;
+  }
+
+  /*--- Bookkeeping to adapt the inner-iteration budget of each zone. ---*/
+  nInnerIterBase = new unsigned long[nZone];
+  bgs_res_old    = new su2double[nZone];
+  for (iZone = 0; iZone < nZone; iZone++){
+    nInnerIterBase[iZone] = config_container[iZone]->GetnInner_Iter();
+    bgs_res_old[iZone]    = 0.0;
+  }
+
   /*----------------------------------------------------*/
   /*------ Determine the properties of the problem -----*/
   /*----------------------------------------------------*/
@@ -117,6 +134,17 @@ CMultizoneDriver::CMultizoneDriver(char* confFile, unsigned short val_nZone, SU2
     }
   }
 
+  /*--- Order the Gauss-Seidel sweep according to the coupling graph. ---*/
+
+  SetZoneOrder();
+
+  /*--- Aggregate the multiblock (vtm) volume output of all zones into a single
+   *    shared writer, created on demand in Output() and written in one pass. ---*/
+
+  vtmWriterShared = nullptr;
+  for (iZone = 0; iZone < nZone; iZone++)
+    output_container[iZone]->SetSharedVTMWriter(&vtmWriterShared);
+
 }
 
 CMultizoneDriver::~CMultizoneDriver(void) {
@@ -134,6 +162,14 @@ CMultizoneDriver::~CMultizoneDriver(void) {
 
   delete [] prefixed_motion;
 
+  delete [] zone_converged;
+  delete [] zone_updated;
+
+  delete [] nInnerIterBase;
+  delete [] bgs_res_old;
+
+  delete vtmWriterShared;
+
 }
 
 void CMultizoneDriver::StartSolver() {
@@ -282,13 +318,28 @@ void CMultizoneDriver::Run_GaussSeidel() {
 
   for (iZone = 0; iZone < nZone; iZone++) {
     config_container[iZone]->SetOuterIter(0ul);
+    zone_converged[iZone] = false;
+    zone_updated[iZone]   = true;
+    /*--- Start every time step with the full inner-iteration budget. ---*/
+    config_container[iZone]->SetnInner_Iter(nInnerIterBase[iZone]);
+    bgs_res_old[iZone] = 0.0;
   }
 
   /*--- Loop over the number of outer iterations ---*/
   for (auto iOuter_Iter = 0ul; iOuter_Iter < driver_config->GetnOuter_Iter(); iOuter_Iter++){
 
-    /*--- Loop over the number of zones (IZONE) ---*/
-    for (iZone = 0; iZone < nZone; iZone++){
+    /*--- Loop over the zones, donors ahead of their targets (see SetZoneOrder) ---*/
+    for (auto iSweep = 0u; iSweep < nZone; iSweep++){
+
+      iZone = zone_order[iSweep];
+
+      /*--- Converged zones whose donor zones are also frozen cannot change,
+       *    skip the transfers and the solve until a donor is updated again. ---*/
+      if (SkipZoneSolve(iZone)) {
+        zone_updated[iZone] = false;
+        continue;
+      }
+      zone_updated[iZone] = true;
 
       /*--- In principle, the mesh does not need to be updated ---*/
       UpdateMesh = 0;
@@ -301,7 +352,7 @@ void CMultizoneDriver::Run_GaussSeidel() {
       /*--- Transfer from all the remaining zones ---*/
       for (auto jZone = 0u; jZone < nZone; jZone++){
         /*--- The target zone is iZone ---*/
-        if (jZone != iZone){
+        if (jZone != iZone && interface_container[jZone][iZone] != nullptr){
           DeformMesh = Transfer_Data(jZone, iZone);
           if (DeformMesh) UpdateMesh+=1;
         }
@@ -332,6 +383,11 @@ void CMultizoneDriver::Run_Jacobi() {
 
   for (iZone = 0; iZone < nZone; iZone++) {
     config_container[iZone]->SetOuterIter(0ul);
+    zone_converged[iZone] = false;
+    zone_updated[iZone]   = true;
+    /*--- Start every time step with the full inner-iteration budget. ---*/
+    config_container[iZone]->SetnInner_Iter(nInnerIterBase[iZone]);
+    bgs_res_old[iZone] = 0.0;
   }
 
   /*--- Loop over the number of outer iterations ---*/
@@ -363,6 +419,13 @@ void CMultizoneDriver::Run_Jacobi() {
       /*--- Loop over the number of zones (IZONE) ---*/
     for (iZone = 0; iZone < nZone; iZone++){
 
+      /*--- Converged zones whose donor zones are also frozen cannot change. ---*/
+      if (SkipZoneSolve(iZone)) {
+        zone_updated[iZone] = false;
+        continue;
+      }
+      zone_updated[iZone] = true;
+
       /*--- Set the OuterIter ---*/
       config_container[iZone]->SetOuterIter(iOuter_Iter);
       config_container[iZone]->Set_StartTime(SU2_MPI::Wtime());
@@ -402,15 +465,30 @@ bool CMultizoneDriver::OuterConvergence(unsigned long OuterIter) {
 
     auto solvers = solver_container[iZone][INST_0][MESH_0];
 
+    su2double res_bgs = 0.0;
+
     for (unsigned short iSol = 0; iSol < MAX_SOLS; iSol++){
-      if (solvers[iSol] != nullptr)
+      if (solvers[iSol] != nullptr) {
         solvers[iSol]->ComputeResidual_Multizone(geometry_container[iZone][INST_0][MESH_0], config_container[iZone]);
+
+        for (unsigned short iVar = 0; iVar < solvers[iSol]->GetnVar(); iVar++)
+          res_bgs = max(res_bgs, solvers[iSol]->GetRes_BGS(iVar));
+      }
     }
 
+    /*--- Adapt the inner-iteration budget of the zone for the next outer iteration. ---*/
+
+    AdaptInnerIterations(iZone, res_bgs, OuterIter);
+
     /*--- Make sure that everything is loaded into the output container. ---*/
 
     output_container[iZone]->SetHistory_Output(geometry_container[iZone][INST_0][MESH_0], solvers, config_container[iZone]);
 
+    /*--- Keep track of which zones met their convergence criteria, zones that did
+     *    may be skipped in the following outer iterations (see SkipZoneSolve). ---*/
+
+    zone_converged[iZone] = output_container[iZone]->GetConvergence();
+
   }
 
   /*--- Print out the convergence data to screen and history file. ---*/
@@ -472,6 +550,15 @@ void CMultizoneDriver::Output(unsigned long TimeIter) {
                                                             solver_container[iZone][INST_0][MESH_0], TimeIter, StopCalc );
   }
 
+  /*--- The zones above only append their blocks to the shared multiblock writer,
+   *    write the master file once after all zones have been aggregated. ---*/
+
+  if (vtmWriterShared != nullptr){
+    vtmWriterShared->Write_Data();
+    delete vtmWriterShared;
+    vtmWriterShared = nullptr;
+  }
+
   if (wrote_files){
 
     StopTime = SU2_MPI::Wtime();
@@ -624,6 +711,110 @@ bool CMultizoneDriver::Transfer_Data(unsigned short donorZone, unsigned short ta
   return UpdateMesh;
 }
 
+void CMultizoneDriver::SetZoneOrder() {
+
+  /*--- Count, for each zone, the donor zones that have not been scheduled yet. ---*/
+
+  vector<unsigned short> nPendingDonors(nZone, 0);
+  for (auto targetZone = 0u; targetZone < nZone; targetZone++) {
+    for (auto donorZone = 0u; donorZone < nZone; donorZone++) {
+      if (donorZone != targetZone && interface_container[donorZone][targetZone] != nullptr)
+        nPendingDonors[targetZone]++;
+    }
+  }
+
+  vector<bool> scheduled(nZone, false);
+  zone_order.clear();
+  zone_order.reserve(nZone);
+
+  while (zone_order.size() < size_t(nZone)) {
+
+    /*--- Schedule the first zone with all of its donors resolved. Zones that do not
+     *    feed each other (e.g. the solid zones of a CHT case) keep their config order.
+     *    If no such zone exists the coupling graph has a cycle (any two-way coupling),
+     *    which is broken at the zone with the fewest unresolved donors. ---*/
+
+    auto next = nZone;
+    for (auto jZone = 0u; jZone < nZone; jZone++) {
+      if (scheduled[jZone]) continue;
+      if (nPendingDonors[jZone] == 0) { next = jZone; break; }
+      if (next == nZone || nPendingDonors[jZone] < nPendingDonors[next]) next = jZone;
+    }
+
+    scheduled[next] = true;
+    zone_order.push_back(next);
+
+    /*--- The zones fed by the scheduled zone have one donor fewer pending. ---*/
+
+    for (auto targetZone = 0u; targetZone < nZone; targetZone++) {
+      if (targetZone != next && interface_container[next][targetZone] != nullptr && nPendingDonors[targetZone] > 0)
+        nPendingDonors[targetZone]--;
+    }
+  }
+
+}
+
+bool CMultizoneDriver::SkipZoneSolve(unsigned short val_iZone) const {
+
+  if (!driver_config->GetMultizone_Freeze_Converged()) return false;
+
+  /*--- The zone itself needs to have met its convergence criteria. ---*/
+
+  if (!zone_converged[val_iZone]) return false;
+
+  /*--- And all the zones it receives data from must be frozen, otherwise
+   *    the incoming interface data may wake this zone up again. ---*/
+
+  for (auto jZone = 0u; jZone < nZone; jZone++) {
+    if (jZone != val_iZone && interface_container[jZone][val_iZone] != nullptr && zone_updated[jZone])
+      return false;
+  }
+
+  return true;
+}
+
+void CMultizoneDriver::AdaptInnerIterations(unsigned short val_iZone, su2double res_bgs, unsigned long OuterIter) {
+
+  if (!driver_config->GetMultizone_Adapt_InnerIter()) return;
+
+  CConfig* config = config_container[val_iZone];
+  const unsigned long nInnerBase = nInnerIterBase[val_iZone];
+
+  /*--- Zones solved in a single inner iteration have nothing to adapt. ---*/
+
+  if (nInnerBase <= 1) return;
+
+  const su2double res_old = bgs_res_old[val_iZone];
+  bgs_res_old[val_iZone] = res_bgs;
+
+  /*--- Two outer iterations are needed before the contraction can be measured. ---*/
+
+  if ((OuterIter == 0) || (res_old <= 0.0)) return;
+
+  /*--- Aitken-style secant estimate of the outer-loop contraction: the ratio of
+   *    successive BGS residuals predicts how much the interface data will change
+   *    in the next outer iteration. While the coupling contracts well, the inner
+   *    solve does not need to resolve the zone much further than that change and
+   *    the budget can be cut. If the contraction stalls or reverses, the full
+   *    budget is restored so that the coupling tolerance stays in control. ---*/
+
+  const su2double theta = res_bgs / res_old;
+
+  unsigned long nInner = config->GetnInner_Iter();
+
+  if (theta >= 1.0) nInner = nInnerBase;
+  else if (theta < 0.75) nInner /= 2;
+
+  /*--- Keep the budget between a floor that keeps the zone moving and the
+   *    value requested in the config. ---*/
+
+  nInner = max(nInner, max(2ul, nInnerBase/10));
+  nInner = min(nInner, nInnerBase);
+
+  config->SetnInner_Iter(nInner);
+
+}
+
 bool CMultizoneDriver::Monitor(unsigned long TimeIter){
 
   /*--- Check whether the inner solver has converged --- */
@@ -67,6 +67,23 @@ void CSinglezoneDriver::StartSolver() {
   if (config_container[ZONE_0]->GetRestart() && driver_config->GetTime_Domain())
     TimeIter = config_container[ZONE_0]->GetRestart_Iter();
 
+  /*--- Objective replay: re-evaluate the objectives from the restarted
+   *    (frozen) solution and return without entering the solver loop. ---*/
+  if (config_container[ZONE_0]->GetObjective_Replay()) {
+    ObjectiveReplay();
+    return;
+  }
+
+  /*--- Check the requirements of the angle-of-attack continuation sweep. ---*/
+  if (config_container[ZONE_0]->GetnAoA_Sweep() > 0) {
+    if (config_container[ZONE_0]->GetTime_Domain() || !config_container[ZONE_0]->GetFluidProblem())
+      SU2_MPI::Error("AOA_SWEEP is only implemented for steady fluid problems.", CURRENT_FUNCTION);
+    if (config_container[ZONE_0]->GetKind_Regime() != ENUM_REGIME::COMPRESSIBLE)
+      SU2_MPI::Error("AOA_SWEEP is only implemented for compressible flows.", CURRENT_FUNCTION);
+    if (config_container[ZONE_0]->GetFixed_CL_Mode())
+      SU2_MPI::Error("AOA_SWEEP cannot be combined with fixed CL mode.", CURRENT_FUNCTION);
+  }
+
   /*--- Run the problem until the number of time iterations required is reached. ---*/
   while ( TimeIter < config_container[ZONE_0]->GetnTime_Iter() ) {
 
@@ -90,6 +107,17 @@ void CSinglezoneDriver::StartSolver() {
 
     Monitor(TimeIter);
 
+    /*--- Continuation for angle-of-attack sweeps: once converged, update the flow
+     *    conditions in-place and keep iterating on the retained solution (and
+     *    Jacobian/preconditioner structures), skipping the restart round-trip.
+     *    The history file accumulates the records of every sweep point, volume
+     *    results are only written for the final point. ---*/
+
+    if (StopCalc && AdvanceAlphaSweep()) {
+      StopCalc = false;
+      continue;
+    }
+
     /*--- Output the solution in files. ---*/
 
     Output(TimeIter);
@@ -110,6 +138,77 @@ void CSinglezoneDriver::StartSolver() {
 
 }
 
+void CSinglezoneDriver::ObjectiveReplay() {
+
+  auto* config = config_container[ZONE_0];
+  auto* geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  auto** solvers = solver_container[ZONE_0][INST_0][MESH_0];
+
+  if (!config->GetRestart())
+    SU2_MPI::Error("OBJECTIVE_REPLAY requires a restart solution (RESTART_SOL= YES).", CURRENT_FUNCTION);
+  if (!config->GetFluidProblem() || (solvers[FLOW_SOL] == nullptr))
+    SU2_MPI::Error("OBJECTIVE_REPLAY is only implemented for fluid problems.", CURRENT_FUNCTION);
+  if (config->GetTime_Domain())
+    SU2_MPI::Error("OBJECTIVE_REPLAY is only implemented for steady problems.", CURRENT_FUNCTION);
+
+  if (rank == MASTER_NODE)
+    cout << endl << "Objective replay: evaluating the objectives on the current mesh with "
+         << "the flow field frozen at the restart solution." << endl;
+
+  /*--- Recompute primitives and gradients on the (possibly perturbed) mesh. ---*/
+
+  SU2_OMP_PARALLEL {
+    solvers[FLOW_SOL]->Preprocessing(geometry, solvers, config, MESH_0, 0, RUNTIME_FLOW_SYS, false);
+  }
+  END_SU2_OMP_PARALLEL
+
+  /*--- Evaluate the surface forces and the objectives, the same sequence the
+   *    discrete adjoint drivers use when recording the objective function. ---*/
+
+  solvers[FLOW_SOL]->Pressure_Forces(geometry, config);
+  solvers[FLOW_SOL]->Momentum_Forces(geometry, config);
+  solvers[FLOW_SOL]->Friction_Forces(geometry, config);
+
+  solvers[FLOW_SOL]->Evaluate_ObjFunc(config);
+
+  /*--- Write one history entry so that the values are machine readable. ---*/
+
+  output_container[ZONE_0]->SetHistory_Output(geometry, solvers, config, config->GetTimeIter(),
+                                              config->GetOuterIter(), config->GetInnerIter());
+
+  if (rank == MASTER_NODE)
+    cout << "Objective replay: combo objective = "
+         << solvers[FLOW_SOL]->GetTotal_ComboObj() << "." << endl;
+
+}
+
+bool CSinglezoneDriver::AdvanceAlphaSweep() {
+
+  auto* config = config_container[ZONE_0];
+
+  if (SweepIndex >= config->GetnAoA_Sweep()) return false;
+
+  const su2double AoA = config->GetAoA_Sweep(SweepIndex);
+  SweepIndex++;
+
+  if (rank == MASTER_NODE) {
+    cout << endl << "-------------------------- Continuation Sweep ---------------------------" << endl;
+    cout << "Advancing to AOA = " << AoA << " deg (point " << SweepIndex << "/"
+         << config->GetnAoA_Sweep() << "), the solution is retained." << endl;
+    cout << "-------------------------------------------------------------------------" << endl;
+  }
+
+  /*--- Update the angle and the farfield velocity on all grid levels, the same
+   *    in-place update the fixed CL mode performs between iterations. ---*/
+
+  config->SetAoA(AoA);
+
+  for (auto iMesh = 0u; iMesh <= config->GetnMGLevels(); iMesh++)
+    solver_container[ZONE_0][INST_0][iMesh][FLOW_SOL]->UpdateFarfieldVelocity(config);
+
+  return true;
+}
+
 void CSinglezoneDriver::Preprocess(unsigned long TimeIter) {
 
   /*--- Set runtime option ---*/
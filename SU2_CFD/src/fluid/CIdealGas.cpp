@@ -51,6 +51,45 @@ void CIdealGas::SetTDState_rhoe(su2double rho, su2double e) {
   if (ComputeEntropy) Entropy = (1.0 / Gamma_Minus_One * log(Temperature) + log(1.0 / Density)) * Gas_Constant;
 }
 
+void CIdealGas::ComputeTDState_rhoe(unsigned long val_nPoint, const su2double* val_rho, const su2double* val_e,
+                                    su2double* val_pressure, su2double* val_temperature, su2double* val_soundspeed2,
+                                    su2double* val_dPdrho_e, su2double* val_dPde_rho) {
+  /*--- No member state is touched inside the loop, allowing vectorization. ---*/
+  SU2_OMP_SIMD
+  for (auto iPoint = 0ul; iPoint < val_nPoint; ++iPoint) {
+    val_pressure[iPoint] = Gamma_Minus_One * val_rho[iPoint] * val_e[iPoint];
+    val_temperature[iPoint] = Gamma_Minus_One * val_e[iPoint] / Gas_Constant;
+    val_soundspeed2[iPoint] = Gamma * Gamma_Minus_One * val_e[iPoint];
+    val_dPdrho_e[iPoint] = Gamma_Minus_One * val_e[iPoint];
+    val_dPde_rho[iPoint] = Gamma_Minus_One * val_rho[iPoint];
+  }
+
+  /*--- Leave the point-wise state consistent with the last point of the batch,
+   as the point-wise method would. ---*/
+  if (val_nPoint > 0) SetTDState_rhoe(val_rho[val_nPoint - 1], val_e[val_nPoint - 1]);
+}
+
+void CIdealGas::ComputeTransport_rhoe(unsigned long val_nPoint, const su2double* val_rho, const su2double* val_e,
+                                      const su2double* val_temperature, su2double* val_mu, su2double* val_dmudrho_T,
+                                      su2double* val_dmudT_rho, su2double* val_kt, su2double* val_dktdrho_T,
+                                      su2double* val_dktdT_rho, su2double* val_cp, su2double* val_dTdrho_e,
+                                      su2double* val_dTde_rho) {
+  /*--- The specific heat and the temperature derivatives are closed-form. ---*/
+  SU2_OMP_SIMD
+  for (auto iPoint = 0ul; iPoint < val_nPoint; ++iPoint) {
+    val_cp[iPoint] = Cp;
+    val_dTdrho_e[iPoint] = 0.0;
+    val_dTde_rho[iPoint] = Gamma_Minus_One / Gas_Constant;
+  }
+
+  /*--- The sub-models provide their own batched (and where possible
+   vectorized) evaluation of the transport properties. ---*/
+  LaminarViscosity->ComputeViscosities(val_nPoint, val_temperature, val_rho, val_mu, val_dmudrho_T, val_dmudT_rho);
+
+  ThermalConductivity->ComputeConductivities(val_nPoint, val_temperature, val_rho, val_mu, Mu_Turb, val_cp,
+                                             val_dmudrho_T, val_dmudT_rho, val_kt, val_dktdrho_T, val_dktdT_rho);
+}
+
 void CIdealGas::SetTDState_PT(su2double P, su2double T) {
   su2double e = T * Gas_Constant / Gamma_Minus_One;
   su2double rho = P / (T * Gas_Constant);
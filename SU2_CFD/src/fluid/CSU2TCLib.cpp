@@ -614,6 +614,12 @@ CSU2TCLib::CSU2TCLib(const CConfig* config, unsigned short val_nDim, bool viscou
 
   if (ionization) { nHeavy = nSpecies-1; nEl = 1; }
   else            { nHeavy = nSpecies;   nEl = 0; }
+
+  /*--- Precompute the log-space Arrhenius coefficients, so the rate constants
+   can be evaluated with a single exp per rate. ---*/
+  LogArrheniusCoefficient.resize(nReactions, 0.0);
+  for (unsigned short iReaction = 0; iReaction < nReactions; iReaction++)
+    LogArrheniusCoefficient[iReaction] = log(ArrheniusCoefficient[iReaction]);
 }
 
 CSU2TCLib::~CSU2TCLib(){}
@@ -670,8 +676,9 @@ vector<su2double>& CSU2TCLib::ComputeSpeciesCvVibEle(su2double val_T){
       /*--- Electronic energy ---*/
       if (nElStates[iSpecies] != 0) {
         num = 0.0; num2 = 0.0;
-        denom = ElDegeneracy[iSpecies][0] * exp(-CharElTemp[iSpecies][0]/val_T);
-        num3  = ElDegeneracy[iSpecies][0] * (CharElTemp[iSpecies][0]/(val_T*val_T))*exp(-CharElTemp[iSpecies][0]/val_T);
+        exptv = exp(-CharElTemp[iSpecies][0]/val_T);
+        denom = ElDegeneracy[iSpecies][0] * exptv;
+        num3  = ElDegeneracy[iSpecies][0] * (CharElTemp[iSpecies][0]/(val_T*val_T))*exptv;
         for (iEl = 1; iEl < nElStates[iSpecies]; iEl++) {
           thoTve = CharElTemp[iSpecies][iEl]/val_T;
           exptv = exp(-CharElTemp[iSpecies][iEl]/val_T);
@@ -713,12 +720,13 @@ vector<su2double>& CSU2TCLib::ComputeMixtureEnergies(){
     else
       Ev = 0.0;
 
-    // Species electronic energy
+    // Species electronic energy (one exp per electron state)
     num = 0.0;
     denom = ElDegeneracy(iSpecies,0) * exp(-CharElTemp(iSpecies,0)/Tve);
     for (iEl = 1; iEl < nElStates[iSpecies]; iEl++) {
-      num   += ElDegeneracy(iSpecies,iEl) * CharElTemp(iSpecies,iEl) * exp(-CharElTemp(iSpecies,iEl)/Tve);
-      denom += ElDegeneracy(iSpecies,iEl) * exp(-CharElTemp(iSpecies,iEl)/Tve);
+      const su2double exptv = exp(-CharElTemp(iSpecies,iEl)/Tve);
+      num   += ElDegeneracy(iSpecies,iEl) * CharElTemp(iSpecies,iEl) * exptv;
+      denom += ElDegeneracy(iSpecies,iEl) * exptv;
     }
     Ee = Ru/MolarMass[iSpecies] * (num/denom);
 
@@ -772,12 +780,13 @@ vector<su2double>& CSU2TCLib::ComputeSpeciesEve(su2double val_T, bool vibe_only)
       else
         Ev = 0.0;
 
-      /*--- Calculate electronic energy ---*/
+      /*--- Calculate electronic energy (one exp per electron state) ---*/
       num = 0.0;
       denom = ElDegeneracy[iSpecies][0] * exp(-CharElTemp[iSpecies][0]/val_T);
       for (iEl = 1; iEl < nElStates[iSpecies]; iEl++) {
-        num   += ElDegeneracy[iSpecies][iEl] * CharElTemp[iSpecies][iEl] * exp(-CharElTemp[iSpecies][iEl]/val_T);
-        denom += ElDegeneracy[iSpecies][iEl] * exp(-CharElTemp[iSpecies][iEl]/val_T);
+        const su2double exptv = exp(-CharElTemp[iSpecies][iEl]/val_T);
+        num   += ElDegeneracy[iSpecies][iEl] * CharElTemp[iSpecies][iEl] * exptv;
+        denom += ElDegeneracy[iSpecies][iEl] * exptv;
       }
       Eel = Ru/MolarMass[iSpecies] * (num/denom);
     }
@@ -813,6 +822,11 @@ vector<su2double>& CSU2TCLib::ComputeNetProductionRates(bool implicit, const su2
   /*--- Define preferential dissociation coefficient ---*/
   //alpha = 0.3; //TODO: make this a config option?
 
+  /*--- The rate-controlling temperatures and rate constants of all reactions are
+   evaluated in log-space, the logs of the temperatures are shared. ---*/
+  const su2double logT   = log(T);
+  const su2double logTve = log(Tve);
+
   /*--- Loop over all reactions ---*/
   for (iReaction = 0; iReaction < nReactions; iReaction++) {
 
@@ -821,8 +835,8 @@ vector<su2double>& CSU2TCLib::ComputeNetProductionRates(bool implicit, const su2
     bf = Tcf_b[iReaction];
     ab = Tcb_a[iReaction];
     bb = Tcb_b[iReaction];
-    Trxnf = pow(T, af)*pow(Tve, bf);
-    Trxnb = pow(T, ab)*pow(Tve, bb);
+    Trxnf = exp(af*logT + bf*logTve);
+    Trxnb = exp(ab*logT + bb*logTve);
 
     /*--- Calculate the modified temperature ---*/
     Thf = 0.5 * (Trxnf+T_min + sqrt((Trxnf-T_min)*(Trxnf-T_min)+epsilon*epsilon));
@@ -835,9 +849,10 @@ vector<su2double>& CSU2TCLib::ComputeNetProductionRates(bool implicit, const su2
     Keq = exp(  A[0]*(Thb/1E4) + A[1] + A[2]*log(1E4/Thb)
         + A[3]*(1E4/Thb) + A[4]*(1E4/Thb)*(1E4/Thb) );
 
-    /*--- Calculate rate coefficients ---*/
-    kf  = ArrheniusCoefficient[iReaction] * exp(ArrheniusEta[iReaction]*log(Thf)) * exp(-ArrheniusTheta[iReaction]/Thf);
-    kfb = ArrheniusCoefficient[iReaction] * exp(ArrheniusEta[iReaction]*log(Thb)) * exp(-ArrheniusTheta[iReaction]/Thb);
+    /*--- Calculate rate coefficients (one exp per rate, the pre-exponential
+     factor is folded into the exponent in log-space) ---*/
+    kf  = exp(LogArrheniusCoefficient[iReaction] + ArrheniusEta[iReaction]*log(Thf) - ArrheniusTheta[iReaction]/Thf);
+    kfb = exp(LogArrheniusCoefficient[iReaction] + ArrheniusEta[iReaction]*log(Thb) - ArrheniusTheta[iReaction]/Thb);
     kb  = kfb / Keq;
 
     /*--- Determine production & destruction of each species ---*/
@@ -1564,7 +1579,6 @@ void CSU2TCLib::ThermalConductivitiesGY(){
 
 vector<su2double>& CSU2TCLib::ComputeTemperatures(vector<su2double>& val_rhos, su2double rhoE, su2double rhoEve, su2double rhoEvel){
 
-  vector<su2double> val_eves;
   rhos = val_rhos;
 
   /*----------Translational temperature----------*/
@@ -1600,7 +1614,9 @@ vector<su2double>& CSU2TCLib::ComputeTemperatures(vector<su2double>& val_rhos, s
 
   for (unsigned short iIter = 0; iIter < maxBIter; iIter++) {
     Tve      = (Tve_o+Tve2)/2.0;
-    val_eves = ComputeSpeciesEve(Tve);
+    /*--- Species energies for all species at once, evaluated into a reused
+     member buffer to avoid one allocation per bisection iteration. ---*/
+    const auto& val_eves = ComputeSpeciesEve(Tve);
     rhoEve_t = 0.0;
     for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) rhoEve_t += rhos[iSpecies] * val_eves[iSpecies];
     if (fabs(rhoEve_t - rhoEve) < Btol) {
@@ -0,0 +1,201 @@
+/*!
+ * \file CTabulatedGas.cpp
+ * \brief Source of the tabulated evaluation of an underlying fluid model.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/fluid/CTabulatedGas.hpp"
+
+CTabulatedGas::CTabulatedGas(CFluidModel* val_baseModel, su2double val_rhoMin, su2double val_rhoMax,
+                             su2double val_eMin, su2double val_eMax, unsigned short val_nPoints)
+    : CFluidModel(), BaseModel(val_baseModel) {
+
+  Density_Min = val_rhoMin;
+  Density_Max = val_rhoMax;
+  Energy_Min = val_eMin;
+  Energy_Max = val_eMax;
+  nDensity = val_nPoints;
+  nEnergy = val_nPoints;
+  DeltaDensity = (Density_Max - Density_Min) / su2double(nDensity - 1);
+  DeltaEnergy = (Energy_Max - Energy_Min) / su2double(nEnergy - 1);
+
+  /*--- Sample the base model on the table nodes. ---*/
+
+  const auto nNodes = nDensity * nEnergy;
+  Table_Pressure.resize(nNodes);
+  Table_Temperature.resize(nNodes);
+  Table_SoundSpeed2.resize(nNodes);
+  Table_dPdrho_e.resize(nNodes);
+  Table_dPde_rho.resize(nNodes);
+  Table_dTdrho_e.resize(nNodes);
+  Table_dTde_rho.resize(nNodes);
+  Table_Entropy.resize(nNodes);
+
+  for (auto jEnergy = 0ul; jEnergy < nEnergy; ++jEnergy) {
+    const su2double e = Energy_Min + jEnergy * DeltaEnergy;
+    for (auto iDensity = 0ul; iDensity < nDensity; ++iDensity) {
+      const su2double rho = Density_Min + iDensity * DeltaDensity;
+      BaseModel->SetTDState_rhoe(rho, e);
+
+      const auto iNode = jEnergy * nDensity + iDensity;
+      Table_Pressure[iNode] = BaseModel->GetPressure();
+      Table_Temperature[iNode] = BaseModel->GetTemperature();
+      Table_SoundSpeed2[iNode] = BaseModel->GetSoundSpeed2();
+      Table_dPdrho_e[iNode] = BaseModel->GetdPdrho_e();
+      Table_dPde_rho[iNode] = BaseModel->GetdPde_rho();
+      Table_dTdrho_e[iNode] = BaseModel->GetdTdrho_e();
+      Table_dTde_rho[iNode] = BaseModel->GetdTde_rho();
+      Table_Entropy[iNode] = BaseModel->GetEntropy();
+    }
+  }
+
+  /*--- The specific heats do not depend on the evaluation point for the models
+   of this hierarchy, take them from the base model. ---*/
+
+  Cp = BaseModel->GetCp();
+  Cv = BaseModel->GetCv();
+}
+
+void CTabulatedGas::CopyStateFromBase() {
+  Density = BaseModel->GetDensity();
+  StaticEnergy = BaseModel->GetStaticEnergy();
+  Pressure = BaseModel->GetPressure();
+  Temperature = BaseModel->GetTemperature();
+  SoundSpeed2 = BaseModel->GetSoundSpeed2();
+  Entropy = BaseModel->GetEntropy();
+  dPdrho_e = BaseModel->GetdPdrho_e();
+  dPde_rho = BaseModel->GetdPde_rho();
+  dTdrho_e = BaseModel->GetdTdrho_e();
+  dTde_rho = BaseModel->GetdTde_rho();
+  dhdrho_P = BaseModel->Getdhdrho_P();
+  dhdP_rho = BaseModel->GetdhdP_rho();
+  dsdrho_P = BaseModel->Getdsdrho_P();
+  dsdP_rho = BaseModel->GetdsdP_rho();
+}
+
+void CTabulatedGas::SetTDState_rhoe(su2double rho, su2double e) {
+
+  if (!InRange(rho, e)) {
+    BaseModel->SetTDState_rhoe(rho, e);
+    CopyStateFromBase();
+    return;
+  }
+
+  unsigned long i, j;
+  su2double wRho, wEnergy;
+  GetCell(rho, Density_Min, DeltaDensity, nDensity, i, wRho);
+  GetCell(e, Energy_Min, DeltaEnergy, nEnergy, j, wEnergy);
+
+  Density = rho;
+  StaticEnergy = e;
+  Pressure = Interpolate(Table_Pressure, i, j, wRho, wEnergy);
+  Temperature = Interpolate(Table_Temperature, i, j, wRho, wEnergy);
+  SoundSpeed2 = Interpolate(Table_SoundSpeed2, i, j, wRho, wEnergy);
+  dPdrho_e = Interpolate(Table_dPdrho_e, i, j, wRho, wEnergy);
+  dPde_rho = Interpolate(Table_dPde_rho, i, j, wRho, wEnergy);
+  dTdrho_e = Interpolate(Table_dTdrho_e, i, j, wRho, wEnergy);
+  dTde_rho = Interpolate(Table_dTde_rho, i, j, wRho, wEnergy);
+  Entropy = Interpolate(Table_Entropy, i, j, wRho, wEnergy);
+}
+
+void CTabulatedGas::ComputeTDState_rhoe(unsigned long val_nPoint, const su2double* val_rho, const su2double* val_e,
+                                        su2double* val_pressure, su2double* val_temperature,
+                                        su2double* val_soundspeed2, su2double* val_dPdrho_e,
+                                        su2double* val_dPde_rho) {
+
+  /*--- Interpolate every point (clamped to the table range), no member state is
+   touched and the property arrays are independent, allowing vectorization. ---*/
+
+  bool allInRange = true;
+
+  for (auto iPoint = 0ul; iPoint < val_nPoint; ++iPoint) {
+    unsigned long i, j;
+    su2double wRho, wEnergy;
+    GetCell(val_rho[iPoint], Density_Min, DeltaDensity, nDensity, i, wRho);
+    GetCell(val_e[iPoint], Energy_Min, DeltaEnergy, nEnergy, j, wEnergy);
+    if (wRho > 1.0) wRho = 1.0;
+    if (wEnergy > 1.0) wEnergy = 1.0;
+
+    val_pressure[iPoint] = Interpolate(Table_Pressure, i, j, wRho, wEnergy);
+    val_temperature[iPoint] = Interpolate(Table_Temperature, i, j, wRho, wEnergy);
+    val_soundspeed2[iPoint] = Interpolate(Table_SoundSpeed2, i, j, wRho, wEnergy);
+    val_dPdrho_e[iPoint] = Interpolate(Table_dPdrho_e, i, j, wRho, wEnergy);
+    val_dPde_rho[iPoint] = Interpolate(Table_dPde_rho, i, j, wRho, wEnergy);
+
+    allInRange = allInRange && InRange(val_rho[iPoint], val_e[iPoint]);
+  }
+
+  /*--- Clean-up pass, re-evaluate out-of-range points with the exact base model. ---*/
+
+  if (!allInRange) {
+    for (auto iPoint = 0ul; iPoint < val_nPoint; ++iPoint) {
+      if (InRange(val_rho[iPoint], val_e[iPoint])) continue;
+      BaseModel->SetTDState_rhoe(val_rho[iPoint], val_e[iPoint]);
+      val_pressure[iPoint] = BaseModel->GetPressure();
+      val_temperature[iPoint] = BaseModel->GetTemperature();
+      val_soundspeed2[iPoint] = BaseModel->GetSoundSpeed2();
+      val_dPdrho_e[iPoint] = BaseModel->GetdPdrho_e();
+      val_dPde_rho[iPoint] = BaseModel->GetdPde_rho();
+    }
+  }
+
+  /*--- Leave the point-wise state consistent with the last point of the batch,
+   as the point-wise method would. ---*/
+
+  if (val_nPoint > 0) SetTDState_rhoe(val_rho[val_nPoint - 1], val_e[val_nPoint - 1]);
+}
+
+void CTabulatedGas::SetTDState_PT(su2double P, su2double T) {
+  BaseModel->SetTDState_PT(P, T);
+  CopyStateFromBase();
+}
+
+void CTabulatedGas::SetTDState_Prho(su2double P, su2double rho) {
+  BaseModel->SetTDState_Prho(P, rho);
+  CopyStateFromBase();
+}
+
+void CTabulatedGas::SetEnergy_Prho(su2double P, su2double rho) {
+  BaseModel->SetEnergy_Prho(P, rho);
+  StaticEnergy = BaseModel->GetStaticEnergy();
+}
+
+void CTabulatedGas::SetTDState_hs(su2double h, su2double s) {
+  BaseModel->SetTDState_hs(h, s);
+  CopyStateFromBase();
+}
+
+void CTabulatedGas::SetTDState_rhoT(su2double rho, su2double T) {
+  BaseModel->SetTDState_rhoT(rho, T);
+  CopyStateFromBase();
+}
+
+void CTabulatedGas::SetTDState_Ps(su2double P, su2double s) {
+  BaseModel->SetTDState_Ps(P, s);
+  CopyStateFromBase();
+}
+
+void CTabulatedGas::ComputeDerivativeNRBC_Prho(su2double P, su2double rho) {
+  BaseModel->ComputeDerivativeNRBC_Prho(P, rho);
+  CopyStateFromBase();
+}
@@ -197,6 +197,23 @@ void CIntegration::Time_Integration(CGeometry *geometry, CSolver **solver_contai
 
   unsigned short MainSolver = config->GetContainerPosition(RunTime_EqSystem);
 
+  /*--- If the Jacobian of the solver is frozen on this iteration the space
+   integration ran in explicit mode to skip the assembly, restore implicit
+   time integration here so the solve reuses the stored matrix. ---*/
+
+  const bool frozenJac = solver_container[MainSolver]->GetJacobianFrozen();
+
+  if (frozenJac) {
+    config->SetKind_TimeIntScheme(EULER_IMPLICIT);
+    SU2_OMP_BARRIER
+  }
+
+  /*--- Force a null update at points inside frozen (converged) regions
+   before the system is solved. ---*/
+
+  if (config->GetRegion_Freezing())
+    solver_container[MainSolver]->EnforceFrozenPoints();
+
   switch (config->GetKind_TimeIntScheme()) {
     case (RUNGE_KUTTA_EXPLICIT):
       solver_container[MainSolver]->ExplicitRK_Iteration(geometry, solver_container, config, iRKStep);
@@ -204,6 +221,9 @@ void CIntegration::Time_Integration(CGeometry *geometry, CSolver **solver_contai
     case (CLASSICAL_RK4_EXPLICIT):
       solver_container[MainSolver]->ClassicalRK4_Iteration(geometry, solver_container, config, iRKStep);
       break;
+    case (SSPRK3_EXPLICIT):
+      solver_container[MainSolver]->SSPRK3_Iteration(geometry, solver_container, config, iRKStep);
+      break;
     case (EULER_EXPLICIT):
       solver_container[MainSolver]->ExplicitEuler_Iteration(geometry, solver_container, config);
       break;
@@ -212,6 +232,18 @@ void CIntegration::Time_Integration(CGeometry *geometry, CSolver **solver_contai
       break;
   }
 
+  if (frozenJac) {
+    SU2_OMP_BARRIER
+    config->SetKind_TimeIntScheme(EULER_EXPLICIT);
+  }
+
+  /*--- Track the per-point residual magnitude and update the mask of frozen
+   regions for the next iteration. ---*/
+
+  if (config->GetRegion_Freezing() &&
+      ((RunTime_EqSystem == RUNTIME_FLOW_SYS) || (RunTime_EqSystem == RUNTIME_TURB_SYS)))
+    solver_container[MainSolver]->UpdateFrozenRegions(geometry, config);
+
 }
 
 void CIntegration::SetDualTime_Geometry(CGeometry *geometry, CSolver *mesh_solver, const CConfig *config, unsigned short iMesh) {
@@ -237,9 +269,9 @@ void CIntegration::SetDualTime_Solver(const CGeometry *geometry, CSolver *solver
 
   SU2_OMP_PARALLEL
   {
-  /*--- Store old solution ---*/
-  solver->GetNodes()->Set_Solution_time_n1();
-  solver->GetNodes()->Set_Solution_time_n();
+  /*--- Store old solution, the n-1 level takes over the storage of the
+   n level so only the current solution is actually copied. ---*/
+  solver->GetNodes()->Shift_Solution_time();
 
   SU2_OMP_MASTER
   solver->ResetCFLAdapt();
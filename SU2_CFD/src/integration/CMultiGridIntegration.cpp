@@ -39,6 +39,26 @@ void CMultiGridIntegration::MultiGrid_Iteration(CGeometry ****geometry,
                                                 unsigned short iZone,
                                                 unsigned short iInst) {
 
+  const unsigned short Solver_Position = config[iZone]->GetContainerPosition(RunTime_EqSystem);
+
+  /*--- Start an OpenMP parallel region covering the entire MG iteration, if the solver supports it. ---*/
+
+  SU2_OMP_PARALLEL_(if(solver_container[iZone][iInst][MESH_0][Solver_Position]->GetHasHybridParallel()))
+  {
+    MultiGrid_IterationCore(geometry, solver_container, numerics_container, config, RunTime_EqSystem, iZone, iInst);
+  }
+  END_SU2_OMP_PARALLEL
+
+}
+
+void CMultiGridIntegration::MultiGrid_IterationCore(CGeometry ****geometry,
+                                                    CSolver *****solver_container,
+                                                    CNumerics ******numerics_container,
+                                                    CConfig **config,
+                                                    unsigned short RunTime_EqSystem,
+                                                    unsigned short iZone,
+                                                    unsigned short iInst) {
+
   bool direct;
   switch (config[iZone]->GetKind_Solver()) {
     case EULER:
@@ -64,11 +84,6 @@ void CMultiGridIntegration::MultiGrid_Iteration(CGeometry ****geometry,
 
   const unsigned short Solver_Position = config[iZone]->GetContainerPosition(RunTime_EqSystem);
 
-  /*--- Start an OpenMP parallel region covering the entire MG iteration, if the solver supports it. ---*/
-
-  SU2_OMP_PARALLEL_(if(solver_container[iZone][iInst][MESH_0][Solver_Position]->GetHasHybridParallel()))
-  {
-
   su2double monitor = 1.0;
   bool FullMG = false;
 
@@ -92,9 +107,19 @@ void CMultiGridIntegration::MultiGrid_Iteration(CGeometry ****geometry,
                             geometry[iZone][iInst][FinestMesh],
                             config[iZone]);
 
-    SU2_OMP_MASTER
-    config[iZone]->SubtractFinestMesh();
-    END_SU2_OMP_MASTER
+    SU2_OMP_MASTER {
+      config[iZone]->SubtractFinestMesh();
+
+      /*--- Reset the convergence control for the next start-up level. ---*/
+
+      Convergence_FullMG = false;
+      FMG_RefSet = false;
+      FMG_LevelIter = 0;
+
+      if (rank == MASTER_NODE)
+        cout << "Full Multigrid: prolongating the solution to mesh level "
+             << config[iZone]->GetFinestMesh() << "." << endl;
+    } END_SU2_OMP_MASTER
     SU2_OMP_BARRIER
   }
 
@@ -102,6 +127,22 @@ void CMultiGridIntegration::MultiGrid_Iteration(CGeometry ****geometry,
 
   FinestMesh = config[iZone]->GetFinestMesh();
 
+  /*--- Decide if the Jacobians of the solver are frozen on this iteration, in
+   which case preprocessing and space integration run in explicit mode on all
+   grid levels to skip the assembly, Time_Integration restores the implicit
+   smoothing with the stored matrices. ---*/
+
+  const bool frozenJac = solver_container[iZone][iInst][MESH_0][Solver_Position]->JacobianFreezeStep(config[iZone]);
+
+  if (frozenJac) {
+    SU2_OMP_MASTER
+    for (unsigned short iMesh = 1; iMesh <= config[iZone]->GetnMGLevels(); iMesh++)
+      solver_container[iZone][iInst][iMesh][Solver_Position]->SetJacobianFrozen(true);
+    END_SU2_OMP_MASTER
+    config[iZone]->SetKind_TimeIntScheme(EULER_EXPLICIT);
+    SU2_OMP_BARRIER
+  }
+
   /*--- Perform the Full Approximation Scheme multigrid ---*/
 
   MultiGrid_Cycle(geometry, solver_container, numerics_container, config,
@@ -121,8 +162,36 @@ void CMultiGridIntegration::MultiGrid_Iteration(CGeometry ****geometry,
                             numerics_container[iZone][iInst], config[iZone],
                             FinestMesh, RunTime_EqSystem, &monitor);
 
+  /*--- Convergence control of the full multigrid start-up: mark the current
+   level as converged once its residual has dropped enough orders of magnitude
+   or the per-level iteration budget is exhausted, the solution is prolongated
+   to the next finer level at the start of the following iteration. The RMS
+   residuals are globally reduced, so the decision is consistent on all ranks. ---*/
+
+  if (FullMG && direct && (FinestMesh != MESH_0)) {
+    SU2_OMP_MASTER {
+      const su2double res = log10(max(solver_container[iZone][iInst][FinestMesh][Solver_Position]->GetRes_RMS(0), EPS));
+      if (!FMG_RefSet) { FMG_RefResidual = res; FMG_RefSet = true; }
+      FMG_LevelIter++;
+      if ((FMG_RefResidual - res >= config[iZone]->GetFullMG_ResOrderDrop()) ||
+          (FMG_LevelIter >= config[iZone]->GetFullMG_MaxLevelIter())) {
+        Convergence_FullMG = true;
+      }
+    } END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+
+  /*--- Restore implicit time integration after a frozen-Jacobian iteration, this is
+   done last so that the preprocessing above does not clear the stored Jacobian. ---*/
+
+  if (frozenJac) {
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER
+    for (unsigned short iMesh = 1; iMesh <= config[iZone]->GetnMGLevels(); iMesh++)
+      solver_container[iZone][iInst][iMesh][Solver_Position]->SetJacobianFrozen(false);
+    END_SU2_OMP_MASTER
+    config[iZone]->SetKind_TimeIntScheme(EULER_IMPLICIT);
   }
-  END_SU2_OMP_PARALLEL
 
 }
 
@@ -160,6 +229,9 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
     case CLASSICAL_RK4_EXPLICIT:
       iRKLimit = 4;
       break;
+    case SSPRK3_EXPLICIT:
+      iRKLimit = 3;
+      break;
     case EULER_EXPLICIT:
     case EULER_IMPLICIT:
       iRKLimit = 1;
@@ -234,11 +306,16 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
     Space_Integration(geometry_fine, solver_container_fine, numerics_fine, config, iMesh, NO_RK_ITER, RunTime_EqSystem);
 
-    SetResidual_Term(geometry_fine, solver_fine);
+    /*--- Compute $r_(k+1) = F_(k+1)(I^(k+1)_k u_k)$. Only initiate the halo exchange
+     of the restricted solution here, it is completed after accumulating the residual
+     on the fine grid (independent local work), overlapping the latency-bound
+     coarse-level exchange with fine-level computation. ---*/
 
-    /*--- Compute $r_(k+1) = F_(k+1)(I^(k+1)_k u_k)$ ---*/
+    SetRestricted_Solution(RunTime_EqSystem, solver_fine, solver_coarse, geometry_fine, geometry_coarse, config, false);
+
+    SetResidual_Term(geometry_fine, solver_fine);
 
-    SetRestricted_Solution(RunTime_EqSystem, solver_fine, solver_coarse, geometry_fine, geometry_coarse, config);
+    solver_coarse->CompleteComms(geometry_coarse, config, SOLUTION);
 
     solver_coarse->Preprocessing(geometry_coarse, solver_container_coarse, config, iMesh+1, NO_RK_ITER, RunTime_EqSystem, false);
 
@@ -303,28 +380,27 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
 void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
                                                       CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
-  unsigned long Point_Fine, Point_Coarse, iVertex;
-  unsigned short iMarker, iChildren, iVar;
-  su2double Area_Parent, Area_Children;
+  unsigned long Point_Coarse, iVertex;
+  unsigned short iMarker, iVar;
   const su2double *Solution_Fine = nullptr, *Solution_Coarse = nullptr;
 
   const unsigned short nVar = sol_coarse->GetnVar();
 
+  const auto& transfer = geo_coarse->GetMGTransferPattern();
+  const su2double* weight = geo_coarse->GetMGRestrictionWeights();
+
   su2double *Solution = new su2double[nVar];
 
   SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
 
-    Area_Parent = geo_coarse->nodes->GetVolume(Point_Coarse);
-
     for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = 0.0;
 
-    for (iChildren = 0; iChildren < geo_coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
-      Point_Fine = geo_coarse->nodes->GetChildren_CV(Point_Coarse, iChildren);
-      Area_Children = geo_fine->nodes->GetVolume(Point_Fine);
-      Solution_Fine = sol_fine->GetNodes()->GetSolution(Point_Fine);
+    const auto kEnd = transfer.outerPtr()[Point_Coarse+1];
+    for (auto k = transfer.outerPtr()[Point_Coarse]; k < kEnd; ++k) {
+      Solution_Fine = sol_fine->GetNodes()->GetSolution(transfer.innerIdx()[k]);
       for (iVar = 0; iVar < nVar; iVar++)
-        Solution[iVar] -= Solution_Fine[iVar]*Area_Children/Area_Parent;
+        Solution[iVar] -= weight[k]*Solution_Fine[iVar];
     }
 
     Solution_Coarse = sol_coarse->GetNodes()->GetSolution(Point_Coarse);
@@ -360,95 +436,32 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
     }
   }
 
-  /*--- MPI the set solution old ---*/
+  /*--- MPI the set solution old. The injection of the correction into the fine
+   grid residual only reads owned coarse points, so it is overlapped with the
+   halo exchange. ---*/
 
   sol_coarse->InitiateComms(geo_coarse, config, SOLUTION_OLD);
-  sol_coarse->CompleteComms(geo_coarse, config, SOLUTION_OLD);
 
   SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
-    for (iChildren = 0; iChildren < geo_coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
-      Point_Fine = geo_coarse->nodes->GetChildren_CV(Point_Coarse, iChildren);
-      sol_fine->LinSysRes.SetBlock(Point_Fine, sol_coarse->GetNodes()->GetSolution_Old(Point_Coarse));
+    const auto kEnd = transfer.outerPtr()[Point_Coarse+1];
+    for (auto k = transfer.outerPtr()[Point_Coarse]; k < kEnd; ++k) {
+      sol_fine->LinSysRes.SetBlock(transfer.innerIdx()[k], sol_coarse->GetNodes()->GetSolution_Old(Point_Coarse));
     }
   }
   END_SU2_OMP_FOR
 
+  sol_coarse->CompleteComms(geo_coarse, config, SOLUTION_OLD);
+
 }
 
 void CMultiGridIntegration::SmoothProlongated_Correction(unsigned short RunTime_EqSystem, CSolver *solver, CGeometry *geometry,
                                                          unsigned short val_nSmooth, su2double val_smooth_coeff, CConfig *config) {
 
-  /*--- Check if there is work to do. ---*/
-  if (val_nSmooth == 0) return;
-
-  const su2double *Residual_Old, *Residual_Sum, *Residual_j;
-  unsigned short iVar, iSmooth, iMarker, iNeigh;
-  unsigned long iPoint, jPoint, iVertex;
-
-  const unsigned short nVar = solver->GetnVar();
-
-  SU2_OMP_FOR_STAT(roundUpDiv(geometry->GetnPoint(), omp_get_num_threads()))
-  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-    Residual_Old = solver->LinSysRes.GetBlock(iPoint);
-    solver->GetNodes()->SetResidual_Old(iPoint,Residual_Old);
-  }
-  END_SU2_OMP_FOR
-
-  /*--- Jacobi iterations. ---*/
-
-  for (iSmooth = 0; iSmooth < val_nSmooth; iSmooth++) {
-
-    /*--- Loop over all mesh points (sum the residuals of direct neighbors). ---*/
-
-    SU2_OMP_FOR_STAT(roundUpDiv(geometry->GetnPoint(), omp_get_num_threads()))
-    for (iPoint = 0; iPoint < geometry->GetnPoint(); ++iPoint) {
-
-      solver->GetNodes()->SetResidualSumZero(iPoint);
-
-      for (iNeigh = 0; iNeigh < geometry->nodes->GetnPoint(iPoint); ++iNeigh) {
-        jPoint = geometry->nodes->GetPoint(iPoint, iNeigh);
-        Residual_j = solver->LinSysRes.GetBlock(jPoint);
-        solver->GetNodes()->AddResidual_Sum(iPoint, Residual_j);
-      }
-
-    }
-    END_SU2_OMP_FOR
-
-    /*--- Loop over all mesh points (update residuals with the neighbor averages). ---*/
-
-    SU2_OMP_FOR_STAT(roundUpDiv(geometry->GetnPoint(), omp_get_num_threads()))
-    for (iPoint = 0; iPoint < geometry->GetnPoint(); ++iPoint) {
-
-      su2double factor = 1.0/(1.0+val_smooth_coeff*su2double(geometry->nodes->GetnPoint(iPoint)));
-
-      Residual_Sum = solver->GetNodes()->GetResidual_Sum(iPoint);
-      Residual_Old = solver->GetNodes()->GetResidual_Old(iPoint);
-
-      for (iVar = 0; iVar < nVar; iVar++)
-        solver->LinSysRes(iPoint,iVar) = (Residual_Old[iVar] + val_smooth_coeff*Residual_Sum[iVar])*factor;
-    }
-    END_SU2_OMP_FOR
-
-    /*--- Restore original residuals (without average) at boundary points. ---*/
-
-    for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
-      if ((config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
-          (config->GetMarker_All_KindBC(iMarker) != NEARFIELD_BOUNDARY) &&
-          (config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY)) {
-
-        SU2_OMP_FOR_STAT(32)
-        for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-          Residual_Old = solver->GetNodes()->GetResidual_Old(iPoint);
-          solver->LinSysRes.SetBlock(iPoint, Residual_Old);
-        }
-        END_SU2_OMP_FOR
-      }
-    }
-
-  }
+  /*--- The fused smoothing kernel keeps boundary residuals at their original value,
+   *    which is equivalent to the former restore-after-each-sweep implementation. ---*/
 
+  solver->Residual_Smoothing(geometry, config, val_nSmooth, val_smooth_coeff);
 }
 
 void CMultiGridIntegration::SetProlongated_Correction(CSolver *sol_fine, CGeometry *geo_fine,
@@ -482,14 +495,15 @@ void CMultiGridIntegration::SetProlongated_Correction(CSolver *sol_fine, CGeomet
 
 void CMultiGridIntegration::SetProlongated_Solution(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
                                                     CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
-  unsigned long Point_Fine, Point_Coarse;
-  unsigned short iChildren;
+  unsigned long Point_Coarse;
+
+  const auto& transfer = geo_coarse->GetMGTransferPattern();
 
   SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
-    for (iChildren = 0; iChildren < geo_coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
-      Point_Fine = geo_coarse->nodes->GetChildren_CV(Point_Coarse, iChildren);
-      sol_fine->GetNodes()->SetSolution(Point_Fine, sol_coarse->GetNodes()->GetSolution(Point_Coarse));
+    const auto kEnd = transfer.outerPtr()[Point_Coarse+1];
+    for (auto k = transfer.outerPtr()[Point_Coarse]; k < kEnd; ++k) {
+      sol_fine->GetNodes()->SetSolution(transfer.innerIdx()[k], sol_coarse->GetNodes()->GetSolution(Point_Coarse));
     }
   }
   END_SU2_OMP_FOR
@@ -498,13 +512,15 @@ void CMultiGridIntegration::SetProlongated_Solution(unsigned short RunTime_EqSys
 void CMultiGridIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine,
                                             CGeometry *geo_coarse, CConfig *config, unsigned short iMesh) {
 
-  unsigned long Point_Fine, Point_Coarse, iVertex;
-  unsigned short iMarker, iVar, iChildren;
+  unsigned long Point_Coarse, iVertex;
+  unsigned short iMarker, iVar;
   const su2double *Residual_Fine;
 
   const unsigned short nVar = sol_coarse->GetnVar();
   su2double factor = config->GetDamp_Res_Restric();
 
+  const auto& transfer = geo_coarse->GetMGTransferPattern();
+
   su2double *Residual = new su2double[nVar];
 
   SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
@@ -514,9 +530,9 @@ void CMultiGridIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coar
 
     for (iVar = 0; iVar < nVar; iVar++) Residual[iVar] = 0.0;
 
-    for (iChildren = 0; iChildren < geo_coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
-      Point_Fine = geo_coarse->nodes->GetChildren_CV(Point_Coarse, iChildren);
-      Residual_Fine = sol_fine->LinSysRes.GetBlock(Point_Fine);
+    const auto kEnd = transfer.outerPtr()[Point_Coarse+1];
+    for (auto k = transfer.outerPtr()[Point_Coarse]; k < kEnd; ++k) {
+      Residual_Fine = sol_fine->LinSysRes.GetBlock(transfer.innerIdx()[k]);
       for (iVar = 0; iVar < nVar; iVar++)
         Residual[iVar] += factor*Residual_Fine[iVar];
     }
@@ -557,35 +573,35 @@ void CMultiGridIntegration::SetResidual_Term(CGeometry *geometry, CSolver *solve
 }
 
 void CMultiGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
-                                                   CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
+                                                   CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config,
+                                                   bool completeComms) {
 
-  unsigned long iVertex, Point_Fine, Point_Coarse;
-  unsigned short iMarker, iVar, iChildren;
-  su2double Area_Parent, Area_Children;
+  unsigned long iVertex, Point_Coarse;
+  unsigned short iMarker, iVar;
   const su2double *Solution_Fine = nullptr, *Grid_Vel = nullptr;
 
   const unsigned short Solver_Position = config->GetContainerPosition(RunTime_EqSystem);
   const unsigned short nVar = sol_coarse->GetnVar();
   const bool grid_movement = config->GetGrid_Movement();
 
+  const auto& transfer = geo_coarse->GetMGTransferPattern();
+  const su2double* weight = geo_coarse->GetMGRestrictionWeights();
+
   su2double *Solution = new su2double[nVar];
 
-  /*--- Compute coarse solution from fine solution ---*/
+  /*--- Compute coarse solution from fine solution, applying the restriction
+   operator in CSR form (volume-weighted average of the children). ---*/
 
   SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
 
-    Area_Parent = geo_coarse->nodes->GetVolume(Point_Coarse);
-
     for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = 0.0;
 
-    for (iChildren = 0; iChildren < geo_coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
-
-      Point_Fine = geo_coarse->nodes->GetChildren_CV(Point_Coarse, iChildren);
-      Area_Children = geo_fine->nodes->GetVolume(Point_Fine);
-      Solution_Fine = sol_fine->GetNodes()->GetSolution(Point_Fine);
+    const auto kEnd = transfer.outerPtr()[Point_Coarse+1];
+    for (auto k = transfer.outerPtr()[Point_Coarse]; k < kEnd; ++k) {
+      Solution_Fine = sol_fine->GetNodes()->GetSolution(transfer.innerIdx()[k]);
       for (iVar = 0; iVar < nVar; iVar++) {
-        Solution[iVar] += Solution_Fine[iVar]*Area_Children/Area_Parent;
+        Solution[iVar] += weight[k]*Solution_Fine[iVar];
       }
     }
 
@@ -631,42 +647,43 @@ void CMultiGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSyst
     }
   }
 
-  /*--- MPI the new interpolated solution ---*/
+  /*--- MPI the new interpolated solution, the completion can be deferred by the
+   caller to overlap the exchange with independent local work. ---*/
 
   sol_coarse->InitiateComms(geo_coarse, config, SOLUTION);
-  sol_coarse->CompleteComms(geo_coarse, config, SOLUTION);
+  if (completeComms) sol_coarse->CompleteComms(geo_coarse, config, SOLUTION);
 
 }
 
 void CMultiGridIntegration::SetRestricted_Gradient(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
                                                    CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
-  unsigned long Point_Fine, Point_Coarse;
-  unsigned short iVar, iDim, iChildren;
-  su2double Area_Parent, Area_Children;
+  unsigned long Point_Coarse;
+  unsigned short iVar, iDim;
 
   const unsigned short nDim = geo_coarse->GetnDim();
   const unsigned short nVar = sol_coarse->GetnVar();
 
+  const auto& transfer = geo_coarse->GetMGTransferPattern();
+  const su2double* weight = geo_coarse->GetMGRestrictionWeights();
+
   su2double **Gradient = new su2double* [nVar];
   for (iVar = 0; iVar < nVar; iVar++)
     Gradient[iVar] = new su2double [nDim];
 
   SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPoint(), omp_get_num_threads()))
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPoint(); Point_Coarse++) {
-    Area_Parent = geo_coarse->nodes->GetVolume(Point_Coarse);
 
     for (iVar = 0; iVar < nVar; iVar++)
       for (iDim = 0; iDim < nDim; iDim++)
         Gradient[iVar][iDim] = 0.0;
 
-    for (iChildren = 0; iChildren < geo_coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
-      Point_Fine = geo_coarse->nodes->GetChildren_CV(Point_Coarse, iChildren);
-      Area_Children = geo_fine->nodes->GetVolume(Point_Fine);
-      auto Gradient_fine = sol_fine->GetNodes()->GetGradient(Point_Fine);
+    const auto kEnd = transfer.outerPtr()[Point_Coarse+1];
+    for (auto k = transfer.outerPtr()[Point_Coarse]; k < kEnd; ++k) {
+      auto Gradient_fine = sol_fine->GetNodes()->GetGradient(transfer.innerIdx()[k]);
 
       for (iVar = 0; iVar < nVar; iVar++)
         for (iDim = 0; iDim < nDim; iDim++)
-          Gradient[iVar][iDim] += Gradient_fine[iVar][iDim]*Area_Children/Area_Parent;
+          Gradient[iVar][iDim] += weight[k]*Gradient_fine[iVar][iDim];
     }
     sol_coarse->GetNodes()->SetGradient(Point_Coarse,Gradient);
   }
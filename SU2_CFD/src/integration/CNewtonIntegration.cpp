@@ -73,6 +73,7 @@ void CNewtonIntegration::Setup() {
   tolRelaxFactor = iparam[2];
   fullTolResidual = dparam[2];
   finDiffStepND = SU2_TYPE::GetValue(dparam[3]);
+  jacRefreshPeriod = max<unsigned short>(1, iparam[3]);
 
   const auto nVar = solvers[FLOW_SOL]->GetnVar();
   const auto nPoint = geometry->GetnPoint();
@@ -141,6 +142,65 @@ void CNewtonIntegration::ComputeResiduals(ResEvalType type) {
 
 }
 
+void CNewtonIntegration::PrepareLinearResidual() {
+
+  constexpr size_t MAXNVAR = 20;
+
+  auto solver = solvers[FLOW_SOL];
+  const auto nVar = solver->GetnVar();
+
+  /*--- As in the solver's PrepareImplicitIteration, set the right hand side
+   of the system (-Residual) and initial guess (x = 0) and monitor the
+   residuals, but leave the frozen preconditioner Jacobian untouched. ---*/
+
+  solver->SetResToZero();
+
+  su2double resMax[MAXNVAR] = {0.0}, resRMS[MAXNVAR] = {0.0};
+  const su2double* coordMax[MAXNVAR] = {nullptr};
+  unsigned long idxMax[MAXNVAR] = {0};
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
+
+    /*--- Multigrid contribution to residual. ---*/
+
+    su2double* local_Res_TruncError = solver->GetNodes()->GetResTruncError(iPoint);
+
+    if (solver->GetNodes()->GetDelta_Time(iPoint) == 0.0) {
+      for (auto iVar = 0u; iVar < nVar; iVar++) {
+        solver->LinSysRes(iPoint,iVar) = 0.0;
+        local_Res_TruncError[iVar] = 0.0;
+      }
+    }
+
+    for (auto iVar = 0u; iVar < nVar; iVar++) {
+      solver->LinSysRes(iPoint,iVar) = -(solver->LinSysRes(iPoint,iVar) + local_Res_TruncError[iVar]);
+      solver->LinSysSol(iPoint,iVar) = 0.0;
+
+      su2double Res = fabs(solver->LinSysRes(iPoint,iVar));
+      resRMS[iVar] += Res*Res;
+      if (Res > resMax[iVar]) {
+        resMax[iVar] = Res;
+        idxMax[iVar] = iPoint;
+        coordMax[iVar] = geometry->nodes->GetCoord(iPoint);
+      }
+    }
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_CRITICAL
+  for (auto iVar = 0u; iVar < nVar; iVar++) {
+    solver->AddRes_RMS(iVar, resRMS[iVar]);
+    solver->AddRes_Max(iVar, resMax[iVar], geometry->nodes->GetGlobalIndex(idxMax[iVar]), coordMax[iVar]);
+  }
+  END_SU2_OMP_CRITICAL
+  SU2_OMP_BARRIER
+
+  /*--- Compute the root mean square residual. ---*/
+
+  solver->SetResidual_RMS(geometry, config);
+}
+
 void CNewtonIntegration::ComputeFinDiffStep() {
 
   static su2double rmsSol;
@@ -185,17 +245,35 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
 
   solvers[FLOW_SOL]->Set_OldSolution();
 
+  /*--- Decide if the approximate Jacobian is refreshed on this iteration, while
+   it is frozen the residual evaluation skips the Jacobian assembly. During the
+   startup period the Jacobian is the matrix of the quasi-Newton solve and must
+   always be current, likewise if the solver cannot provide a preconditioner
+   the default evaluation mode is kept. ---*/
+
+  const bool refreshJacobian = startupPeriod || !preconditioner || (jacRefreshCount+1 >= jacRefreshPeriod);
+
   /*--- Current residual. ---*/
 
-  ComputeResiduals(DEFAULT);
+  ComputeResiduals(refreshJacobian? DEFAULT : EXPLICIT);
 
-  /*--- Compute the approximate Jacobian for preconditioning. ---*/
+  /*--- Compute the approximate Jacobian for preconditioning, or only update
+   the right hand side of the system if the Jacobian is frozen. ---*/
 
   solvers[FLOW_SOL]->SetTime_Step(geometry, solvers, config, MESH_0, config->GetTimeIter());
 
-  solvers[FLOW_SOL]->PrepareImplicitIteration(geometry, solvers, config);
+  if (refreshJacobian) {
+    solvers[FLOW_SOL]->PrepareImplicitIteration(geometry, solvers, config);
 
-  if (preconditioner) preconditioner->Build();
+    if (preconditioner) preconditioner->Build();
+  }
+  else {
+    PrepareLinearResidual();
+  }
+
+  SU2_OMP_MASTER
+  jacRefreshCount = refreshJacobian? 0 : jacRefreshCount+1;
+  END_SU2_OMP_MASTER
 
   SU2_OMP_FOR_STAT(omp_chunk_size)
   for (auto i = 0ul; i < LinSysRes.GetNElmDomain(); ++i)
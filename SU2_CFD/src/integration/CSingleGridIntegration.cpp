@@ -42,12 +42,35 @@ void CSingleGridIntegration::SingleGrid_Iteration(CGeometry ****geometry, CSolve
 
   SU2_OMP_PARALLEL_(if(solver_container[iZone][iInst][MESH_0][Solver_Position]->GetHasHybridParallel()))
   {
+    SingleGrid_IterationCore(geometry, solver_container, numerics_container, config, RunTime_EqSystem, iZone, iInst);
+  }
+  END_SU2_OMP_PARALLEL
+
+}
+
+void CSingleGridIntegration::SingleGrid_IterationCore(CGeometry ****geometry, CSolver *****solver_container,
+                                                      CNumerics ******numerics_container, CConfig **config,
+                                                      unsigned short RunTime_EqSystem, unsigned short iZone,
+                                                      unsigned short iInst) {
+
+  const unsigned short Solver_Position = config[iZone]->GetContainerPosition(RunTime_EqSystem);
 
   unsigned short FinestMesh = config[iZone]->GetFinestMesh();
 
   CGeometry* geometry_fine = geometry[iZone][iInst][FinestMesh];
   CSolver** solvers_fine = solver_container[iZone][iInst][FinestMesh];
 
+  /*--- Decide if the Jacobian of the solver is frozen on this iteration, in
+   which case preprocessing and space integration run in explicit mode to skip
+   the assembly, Time_Integration restores the implicit solve. ---*/
+
+  const bool frozenJac = solvers_fine[Solver_Position]->JacobianFreezeStep(config[iZone]);
+
+  if (frozenJac) {
+    config[iZone]->SetKind_TimeIntScheme(EULER_EXPLICIT);
+    SU2_OMP_BARRIER
+  }
+
   /*--- Preprocessing ---*/
 
   solvers_fine[Solver_Position]->Preprocessing(geometry_fine, solvers_fine, config[iZone],
@@ -106,37 +129,41 @@ void CSingleGridIntegration::SingleGrid_Iteration(CGeometry ****geometry, CSolve
 
   }
 
+  /*--- Restore implicit time integration after a frozen-Jacobian iteration. ---*/
+
+  if (frozenJac) {
+    SU2_OMP_BARRIER
+    config[iZone]->SetKind_TimeIntScheme(EULER_IMPLICIT);
   }
-  END_SU2_OMP_PARALLEL
+
 }
 
 void CSingleGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
                                                     CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
-  unsigned long Point_Fine, Point_Coarse;
-  unsigned short iVar, iChildren;
-  su2double Area_Parent, Area_Children;
+  unsigned long Point_Coarse;
+  unsigned short iVar;
   const su2double *Solution_Fine;
 
   unsigned short nVar = sol_coarse->GetnVar();
 
+  const auto& transfer = geo_coarse->GetMGTransferPattern();
+  const su2double* weight = geo_coarse->GetMGRestrictionWeights();
+
   su2double *Solution = new su2double[nVar];
 
-  /*--- Compute coarse solution from fine solution ---*/
+  /*--- Compute coarse solution from fine solution, applying the restriction
+   operator in CSR form (volume-weighted average of the children). ---*/
 
   SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
 
-    Area_Parent = geo_coarse->nodes->GetVolume(Point_Coarse);
-
     for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = 0.0;
 
-    for (iChildren = 0; iChildren < geo_coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
-
-      Point_Fine = geo_coarse->nodes->GetChildren_CV(Point_Coarse, iChildren);
-      Area_Children = geo_fine->nodes->GetVolume(Point_Fine);
-      Solution_Fine = sol_fine->GetNodes()->GetSolution(Point_Fine);
+    const auto kEnd = transfer.outerPtr()[Point_Coarse+1];
+    for (auto k = transfer.outerPtr()[Point_Coarse]; k < kEnd; ++k) {
+      Solution_Fine = sol_fine->GetNodes()->GetSolution(transfer.innerIdx()[k]);
       for (iVar = 0; iVar < nVar; iVar++)
-        Solution[iVar] += Solution_Fine[iVar]*Area_Children/Area_Parent;
+        Solution[iVar] += weight[k]*Solution_Fine[iVar];
     }
 
     sol_coarse->GetNodes()->SetSolution(Point_Coarse,Solution);
@@ -156,25 +183,23 @@ void CSingleGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSys
 void CSingleGridIntegration::SetRestricted_EddyVisc(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
                                                     CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
 
-  unsigned long iVertex, Point_Fine, Point_Coarse;
-  unsigned short iMarker, iChildren;
-  su2double Area_Parent, Area_Children, EddyVisc_Fine, EddyVisc;
+  unsigned long iVertex, Point_Coarse;
+  unsigned short iMarker;
+  su2double EddyVisc;
+
+  const auto& transfer = geo_coarse->GetMGTransferPattern();
+  const su2double* weight = geo_coarse->GetMGRestrictionWeights();
 
   /*--- Compute coarse Eddy Viscosity from fine solution ---*/
 
   SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
 
-    Area_Parent = geo_coarse->nodes->GetVolume(Point_Coarse);
-
     EddyVisc = 0.0;
 
-    for (iChildren = 0; iChildren < geo_coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
-      Point_Fine = geo_coarse->nodes->GetChildren_CV(Point_Coarse, iChildren);
-      Area_Children = geo_fine->nodes->GetVolume(Point_Fine);
-      EddyVisc_Fine = sol_fine->GetNodes()->GetmuT(Point_Fine);
-      EddyVisc += EddyVisc_Fine*Area_Children/Area_Parent;
-    }
+    const auto kEnd = transfer.outerPtr()[Point_Coarse+1];
+    for (auto k = transfer.outerPtr()[Point_Coarse]; k < kEnd; ++k)
+      EddyVisc += weight[k]*sol_fine->GetNodes()->GetmuT(transfer.innerIdx()[k]);
 
     sol_coarse->GetNodes()->SetmuT(Point_Coarse,EddyVisc);
 
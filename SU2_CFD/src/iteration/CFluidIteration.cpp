@@ -97,31 +97,80 @@ void CFluidIteration::Iterate(COutput* output, CIntegration**** integration, CGe
       break;
   }
 
-  /*--- Solve the Euler, Navier-Stokes or Reynolds-averaged Navier-Stokes (RANS) equations (one iteration) ---*/
+  /*--- Solve the Euler, Navier-Stokes or Reynolds-averaged Navier-Stokes (RANS) equations (one iteration),
+   the turbulence model, and the CFL adaptation. When the integration classes implement the *_IterationCore
+   entry points and the solvers are hybrid-parallel, one OpenMP parallel region spans all of them to avoid
+   forking and joining the thread team once per system. ---*/
 
-  integration[val_iZone][val_iInst][FLOW_SOL]->MultiGrid_Iteration(geometry, solver, numerics, config, RUNTIME_FLOW_SYS,
-                                                                   val_iZone, val_iInst);
+  const bool turbulent = (config[val_iZone]->GetKind_Solver() == RANS ||
+                          config[val_iZone]->GetKind_Solver() == DISC_ADJ_RANS ||
+                          config[val_iZone]->GetKind_Solver() == INC_RANS ||
+                          config[val_iZone]->GetKind_Solver() == DISC_ADJ_INC_RANS) && !frozen_visc;
+  const bool adapt_cfl = (config[val_iZone]->GetCFL_Adapt() == YES) && (!disc_adj);
 
-  /*--- If the flow integration is not fully coupled, run the various single grid integrations. ---*/
+  CIntegration* flowIntegration = integration[val_iZone][val_iInst][FLOW_SOL];
+  CIntegration* turbIntegration = integration[val_iZone][val_iInst][TURB_SOL];
+  CSolver** solvers0 = solver[val_iZone][val_iInst][MESH_0];
 
-  if ((config[val_iZone]->GetKind_Solver() == RANS || config[val_iZone]->GetKind_Solver() == DISC_ADJ_RANS ||
-       config[val_iZone]->GetKind_Solver() == INC_RANS || config[val_iZone]->GetKind_Solver() == DISC_ADJ_INC_RANS) &&
-      !frozen_visc) {
-    /*--- Solve the turbulence model ---*/
+  const bool singleRegion = flowIntegration->SupportsPersistentParallel() &&
+                            solvers0[FLOW_SOL]->GetHasHybridParallel() &&
+                            (!turbulent || (turbIntegration->SupportsPersistentParallel() &&
+                                            solvers0[TURB_SOL]->GetHasHybridParallel()));
 
-    config[val_iZone]->SetGlobalParam(RANS, RUNTIME_TURB_SYS);
-    integration[val_iZone][val_iInst][TURB_SOL]->SingleGrid_Iteration(geometry, solver, numerics, config,
-                                                                      RUNTIME_TURB_SYS, val_iZone, val_iInst);
+  if (singleRegion) {
 
-    /*--- Solve transition model ---*/
+    SU2_OMP_PARALLEL
+    {
+      flowIntegration->MultiGrid_IterationCore(geometry, solver, numerics, config, RUNTIME_FLOW_SYS,
+                                               val_iZone, val_iInst);
 
-    if (config[val_iZone]->GetKind_Trans_Model() == LM) {
-      config[val_iZone]->SetGlobalParam(RANS, RUNTIME_TRANS_SYS);
-      integration[val_iZone][val_iInst][TRANS_SOL]->SingleGrid_Iteration(geometry, solver, numerics, config,
-                                                                         RUNTIME_TRANS_SYS, val_iZone, val_iInst);
+      /*--- Solve the turbulence model ---*/
+
+      if (turbulent) {
+        SU2_OMP_BARRIER
+        SU2_OMP_MASTER
+        config[val_iZone]->SetGlobalParam(RANS, RUNTIME_TURB_SYS);
+        END_SU2_OMP_MASTER
+        SU2_OMP_BARRIER
+
+        turbIntegration->SingleGrid_IterationCore(geometry, solver, numerics, config, RUNTIME_TURB_SYS,
+                                                  val_iZone, val_iInst);
+      }
+
+      /*--- Adapt the CFL number using an exponential progression with under-relaxation approach,
+       it only depends on the flow and turbulence solvers so it can run before the remaining systems. ---*/
+
+      if (adapt_cfl) {
+        SU2_OMP_BARRIER
+        solvers0[FLOW_SOL]->AdaptCFLNumber(geometry[val_iZone][val_iInst], solver[val_iZone][val_iInst],
+                                           config[val_iZone]);
+      }
+    }
+    END_SU2_OMP_PARALLEL
+
+  }
+  else {
+
+    flowIntegration->MultiGrid_Iteration(geometry, solver, numerics, config, RUNTIME_FLOW_SYS,
+                                         val_iZone, val_iInst);
+
+    /*--- Solve the turbulence model ---*/
+
+    if (turbulent) {
+      config[val_iZone]->SetGlobalParam(RANS, RUNTIME_TURB_SYS);
+      turbIntegration->SingleGrid_Iteration(geometry, solver, numerics, config,
+                                            RUNTIME_TURB_SYS, val_iZone, val_iInst);
     }
   }
 
+  /*--- Solve transition model (not hybrid-parallel, kept outside the single region) ---*/
+
+  if (turbulent && config[val_iZone]->GetKind_Trans_Model() == LM) {
+    config[val_iZone]->SetGlobalParam(RANS, RUNTIME_TRANS_SYS);
+    integration[val_iZone][val_iInst][TRANS_SOL]->SingleGrid_Iteration(geometry, solver, numerics, config,
+                                                                       RUNTIME_TRANS_SYS, val_iZone, val_iInst);
+  }
+
   if (config[val_iZone]->GetWeakly_Coupled_Heat()) {
     config[val_iZone]->SetGlobalParam(RANS, RUNTIME_HEAT_SYS);
     integration[val_iZone][val_iInst][HEAT_SOL]->SingleGrid_Iteration(geometry, solver, numerics, config,
@@ -137,10 +186,10 @@ void CFluidIteration::Iterate(COutput* output, CIntegration**** integration, CGe
 
   /*--- Adapt the CFL number using an exponential progression with under-relaxation approach. ---*/
 
-  if ((config[val_iZone]->GetCFL_Adapt() == YES) && (!disc_adj)) {
+  if (adapt_cfl && !singleRegion) {
     SU2_OMP_PARALLEL
-    solver[val_iZone][val_iInst][MESH_0][FLOW_SOL]->AdaptCFLNumber(geometry[val_iZone][val_iInst],
-                                                                   solver[val_iZone][val_iInst], config[val_iZone]);
+    solvers0[FLOW_SOL]->AdaptCFLNumber(geometry[val_iZone][val_iInst],
+                                       solver[val_iZone][val_iInst], config[val_iZone]);
     END_SU2_OMP_PARALLEL
   }
 
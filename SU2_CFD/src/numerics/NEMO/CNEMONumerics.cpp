@@ -86,70 +86,41 @@ void CNEMONumerics::GetInviscidProjFlux(const su2double *val_U,
                                         const su2double *val_V,
                                         const su2double *val_normal,
                                         su2double *val_Proj_Flux) {
-  unsigned short iSpecies, iVar;
+  unsigned short iSpecies;
   su2double rho, u, v, w, rhoEve, P, H;
   const su2double *rhos;
 
-  /*--- Initialize vectors ---*/
-  for (iVar = 0; iVar < nVar; iVar++)
-    val_Proj_Flux[iVar] = 0.0;
-
   /*--- Rename for convienience ---*/
   rho    = val_V[RHO_INDEX];
   u      = val_V[VEL_INDEX];
   v      = val_V[VEL_INDEX+1];
-  w      = val_V[VEL_INDEX+2];
   P      = val_V[P_INDEX];
   H      = val_V[H_INDEX];
   rhoEve = val_U[nSpecies+nDim+1];
   rhos   = &val_V[RHOS_INDEX];
 
-  if (nDim == 2) {
+  /*--- All convective fluxes scale with the projected velocity, computing
+   it first fuses the per-dimension species passes into a single
+   contiguous one. ---*/
+
+  const su2double proj_vel = GeometryToolbox::DotProduct(nDim, &val_V[VEL_INDEX], val_normal);
+
+  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+    val_Proj_Flux[iSpecies] = rhos[iSpecies] * proj_vel;
 
-    /*--- iDim = 0 (x-direction) ---*/
-    for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
-      val_Proj_Flux[iSpecies]  = (rhos[iSpecies]*u) * val_normal[0];
-    val_Proj_Flux[nSpecies]    = (rho*u*u + P)      * val_normal[0];
-    val_Proj_Flux[nSpecies+1]  = (rho*u*v)          * val_normal[0];
-    val_Proj_Flux[nSpecies+2]  = (rho*u*H)          * val_normal[0];
-    val_Proj_Flux[nSpecies+3]  = (rhoEve*u)         * val_normal[0];
-
-    /*---- iDim = 1 (y-direction) ---*/
-    for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
-      val_Proj_Flux[iSpecies] += (rhos[iSpecies]*v) * val_normal[1];
-    val_Proj_Flux[nSpecies]   += (rho*v*u)          * val_normal[1];
-    val_Proj_Flux[nSpecies+1] += (rho*v*v + P)      * val_normal[1];
-    val_Proj_Flux[nSpecies+2] += (rho*v*H)          * val_normal[1];
-    val_Proj_Flux[nSpecies+3] += (rhoEve*v)         * val_normal[1];
+  if (nDim == 2) {
+    val_Proj_Flux[nSpecies]   = rho*u*proj_vel + P*val_normal[0];
+    val_Proj_Flux[nSpecies+1] = rho*v*proj_vel + P*val_normal[1];
+    val_Proj_Flux[nSpecies+2] = rho*H*proj_vel;
+    val_Proj_Flux[nSpecies+3] = rhoEve*proj_vel;
   }
   else {
-
-    /*--- iDim = 0 (x-direction) ---*/
-    for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
-      val_Proj_Flux[iSpecies]  = (rhos[iSpecies]*u) * val_normal[0];
-    val_Proj_Flux[nSpecies]    = (rho*u*u + P)      * val_normal[0];
-    val_Proj_Flux[nSpecies+1]  = (rho*u*v)          * val_normal[0];
-    val_Proj_Flux[nSpecies+2]  = (rho*u*w)          * val_normal[0];
-    val_Proj_Flux[nSpecies+3]  = (rho*u*H)          * val_normal[0];
-    val_Proj_Flux[nSpecies+4]  = (rhoEve*u)         * val_normal[0];
-
-    /*--- iDim = 0 (y-direction) ---*/
-    for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
-      val_Proj_Flux[iSpecies] += (rhos[iSpecies]*v) * val_normal[1];
-    val_Proj_Flux[nSpecies]   += (rho*v*u)          * val_normal[1];
-    val_Proj_Flux[nSpecies+1] += (rho*v*v + P)      * val_normal[1];
-    val_Proj_Flux[nSpecies+2] += (rho*v*w)          * val_normal[1];
-    val_Proj_Flux[nSpecies+3] += (rho*v*H)          * val_normal[1];
-    val_Proj_Flux[nSpecies+4] += (rhoEve*v)         * val_normal[1];
-
-    /*--- iDim = 0 (z-direction) ---*/
-    for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
-      val_Proj_Flux[iSpecies] += (rhos[iSpecies]*w) * val_normal[2];
-    val_Proj_Flux[nSpecies]   += (rho*w*u)          * val_normal[2];
-    val_Proj_Flux[nSpecies+1] += (rho*w*v)          * val_normal[2];
-    val_Proj_Flux[nSpecies+2] += (rho*w*w + P)      * val_normal[2];
-    val_Proj_Flux[nSpecies+3] += (rho*w*H)          * val_normal[2];
-    val_Proj_Flux[nSpecies+4] += (rhoEve*w)         * val_normal[2];
+    w = val_V[VEL_INDEX+2];
+    val_Proj_Flux[nSpecies]   = rho*u*proj_vel + P*val_normal[0];
+    val_Proj_Flux[nSpecies+1] = rho*v*proj_vel + P*val_normal[1];
+    val_Proj_Flux[nSpecies+2] = rho*w*proj_vel + P*val_normal[2];
+    val_Proj_Flux[nSpecies+3] = rho*H*proj_vel;
+    val_Proj_Flux[nSpecies+4] = rhoEve*proj_vel;
   }
 }
 
@@ -240,14 +211,9 @@ void CNEMONumerics::GetViscousProjFlux(su2double *val_primvar,
   su2double rho, T, Tve, RuSI, Ru;
   auto& Ms = fluidmodel->GetSpeciesMolarMass();
 
-  su2activematrix Flux_Tensor(nVar,nDim);
-
   /*--- Initialize ---*/
-  for (iVar = 0; iVar < nVar; iVar++) {
+  for (iVar = 0; iVar < nVar; iVar++)
     Proj_Flux_Tensor[iVar] = 0.0;
-    for (iDim = 0; iDim < nDim; iDim++)
-      Flux_Tensor[iVar][iDim] = 0.0;
-  }
 
   /*--- Rename for convenience ---*/
   Ds  = val_diffusioncoeff;
@@ -293,40 +259,34 @@ void CNEMONumerics::GetViscousProjFlux(su2double *val_primvar,
   /*--- Compute the viscous stress tensor ---*/
   ComputeStressTensor(nDim,tau,val_gradprimvar+VEL_INDEX, mu);
 
-  /*--- Populate entries in the viscous flux vector ---*/
+  if (ionization) {
+    SU2_MPI::Error("NEED TO IMPLEMENT IONIZED FUNCTIONALITY!!!",CURRENT_FUNCTION);
+  }
+
+  /*--- Populate entries in the projected viscous flux vector. The mass,
+   enthalpy and vib-el energy diffusion contributions of each species are
+   accumulated in one fused pass per dimension. ---*/
   for (iDim = 0; iDim < nDim; iDim++) {
+
     /*--- Species diffusion velocity ---*/
     for (iSpecies = 0; iSpecies < nHeavy; iSpecies++) {
-      Flux_Tensor[iSpecies][iDim] = rho*Ds[iSpecies]*GV[RHOS_INDEX+iSpecies][iDim]
+      const su2double Js = rho*Ds[iSpecies]*GV[RHOS_INDEX+iSpecies][iDim]
           - V[RHOS_INDEX+iSpecies]*Vector[iDim];
-    }
-    if (ionization) {
-      SU2_MPI::Error("NEED TO IMPLEMENT IONIZED FUNCTIONALITY!!!",CURRENT_FUNCTION);
+      Proj_Flux_Tensor[iSpecies]         += Js * val_normal[iDim];
+      Proj_Flux_Tensor[nSpecies+nDim]    += Js * hs[iSpecies] * val_normal[iDim];
+      Proj_Flux_Tensor[nSpecies+nDim+1]  += Js * val_eve[iSpecies] * val_normal[iDim];
     }
 
     /*--- Shear stress related terms ---*/
-    Flux_Tensor[nSpecies+nDim][iDim] = 0.0;
     for (jDim = 0; jDim < nDim; jDim++) {
-      Flux_Tensor[nSpecies+jDim][iDim]  = tau[iDim][jDim];
-      Flux_Tensor[nSpecies+nDim][iDim] += tau[iDim][jDim]*val_primvar[VEL_INDEX+jDim];
-    }
-
-    /*--- Diffusion terms ---*/
-    for (iSpecies = 0; iSpecies < nHeavy; iSpecies++) {
-      Flux_Tensor[nSpecies+nDim][iDim]   += Flux_Tensor[iSpecies][iDim] * hs[iSpecies];
-      Flux_Tensor[nSpecies+nDim+1][iDim] += Flux_Tensor[iSpecies][iDim] * val_eve[iSpecies];
+      Proj_Flux_Tensor[nSpecies+jDim] += tau[iDim][jDim] * val_normal[iDim];
+      Proj_Flux_Tensor[nSpecies+nDim] += tau[iDim][jDim]*val_primvar[VEL_INDEX+jDim] * val_normal[iDim];
     }
 
     /*--- Heat transfer terms ---*/
-    Flux_Tensor[nSpecies+nDim][iDim]   += ktr*GV[T_INDEX][iDim] +
-        kve*GV[TVE_INDEX][iDim];
-    Flux_Tensor[nSpecies+nDim+1][iDim] += kve*GV[TVE_INDEX][iDim];
-  }
-
-  for (iVar = 0; iVar < nVar; iVar++) {
-    for (iDim = 0; iDim < nDim; iDim++) {
-      Proj_Flux_Tensor[iVar] += Flux_Tensor[iVar][iDim]*val_normal[iDim];
-    }
+    Proj_Flux_Tensor[nSpecies+nDim]   += (ktr*GV[T_INDEX][iDim] +
+        kve*GV[TVE_INDEX][iDim]) * val_normal[iDim];
+    Proj_Flux_Tensor[nSpecies+nDim+1] += kve*GV[TVE_INDEX][iDim] * val_normal[iDim];
   }
 }
 
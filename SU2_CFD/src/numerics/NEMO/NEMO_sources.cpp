@@ -39,7 +39,8 @@ CSource_NEMO::CSource_NEMO(unsigned short val_nDim,
 
   /*--- Allocate arrays ---*/
   Y = new su2double[nSpecies];
-  
+  rhos.resize(nSpecies,0.0);
+
   dYdr = new su2double*[nSpecies];
   for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
     dYdr[iSpecies] = new su2double[nSpecies];
@@ -76,9 +77,6 @@ CNumerics::ResidualType<> CSource_NEMO::ComputeChemistry(const CConfig *config)
   unsigned short iSpecies, iVar;
   unsigned short jVar;
 
-  vector<su2double> rhos;
-  rhos.resize(nSpecies,0.0);
-
   /*--- Initialize residual and Jacobian arrays ---*/
   for (iVar = 0; iVar < nVar; iVar++) {
     residual[iVar] = 0.0;
@@ -128,9 +126,6 @@ CNumerics::ResidualType<> CSource_NEMO::ComputeVibRelaxation(const CConfig *conf
   su2double res_min = -1E6;
   su2double res_max = 1E6;
 
-  vector<su2double> rhos;
-  rhos.resize(nSpecies,0.0);
-
   /*--- Initialize residual and Jacobian arrays ---*/
   for (iVar = 0; iVar < nVar; iVar++) {
     residual[iVar] = 0.0;
@@ -311,8 +306,6 @@ CNumerics::ResidualType<> CSource_NEMO::ComputeAxisymmetric(const CConfig *confi
       sumJeve_y += -(rho*Ds[iSpecies]*GV[RHOS_INDEX+iSpecies][1] - V_i[RHOS_INDEX+iSpecies]*Vector) * eve_i[iSpecies];
     }
 
-    for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
-      residual[iSpecies] -= 0.0;
     residual[nSpecies] -= Volume*(yinv*total_viscosity_i*(GV[nSpecies+2][1]+GV[nSpecies+3][0])
                                                          -TWO3*AuxVar_Grad_i[0][0]);
     residual[nSpecies+1] -= Volume*(yinv*total_viscosity_i*2*(GV[nSpecies+3][1]-v*yinv)
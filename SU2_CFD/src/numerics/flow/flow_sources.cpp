@@ -487,6 +487,46 @@ CNumerics::ResidualType<> CSourceGravity::ComputeResidual(const CConfig* config)
   return ResidualType<>(residual, jacobian, nullptr);
 }
 
+CSourceSpongeLayer::CSourceSpongeLayer(unsigned short val_nDim, unsigned short val_nVar, const CConfig* config) :
+                    CSourceBase_Flow(val_nDim, val_nVar, config) {
+
+  implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+
+  Damping = config->GetSponge_Layer_Coeff();
+
+  /*--- Assemble the free-stream conservative state the solution is damped towards. ---*/
+
+  const su2double Density_Inf = config->GetDensity_FreeStreamND();
+
+  U_inf[0] = Density_Inf;
+  for (unsigned short iDim = 0; iDim < nDim; iDim++)
+    U_inf[iDim+1] = Density_Inf * config->GetVelocity_FreeStreamND()[iDim];
+  U_inf[nDim+1] = Density_Inf * config->GetEnergy_FreeStreamND();
+
+}
+
+CNumerics::ResidualType<> CSourceSpongeLayer::ComputeResidual(const CConfig* config) {
+
+  unsigned short iVar, jVar;
+
+  /*--- Damp the conservative state towards the free-stream state. ---*/
+
+  for (iVar = 0; iVar < nVar; iVar++)
+    residual[iVar] = -Damping * Volume * (U_i[iVar] - U_inf[iVar]);
+
+  /*--- The source term Jacobian is diagonal. ---*/
+
+  if (implicit) {
+    for (iVar = 0; iVar < nVar; iVar++) {
+      for (jVar = 0; jVar < nVar; jVar++)
+        jacobian[iVar][jVar] = 0.0;
+      jacobian[iVar][iVar] = -Damping * Volume;
+    }
+  }
+
+  return ResidualType<>(residual, jacobian, nullptr);
+}
+
 CSourceRotatingFrame_Flow::CSourceRotatingFrame_Flow(unsigned short val_nDim, unsigned short val_nVar, const CConfig* config) :
                            CSourceBase_Flow(val_nDim, val_nVar, config) {
 
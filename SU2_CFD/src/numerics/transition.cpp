@@ -338,12 +338,48 @@ CSourcePieceWise_TransLM::CSourcePieceWise_TransLM(unsigned short val_nDim, unsi
   flen_global  = 12.0;
   alpha_global = 0.85;
 
+  /*-- Precompute the empirical correlations, their only input besides the
+   *   transported variables is the free-stream turbulence intensity (in
+   *   percent, hence the factor 100). --*/
+  tu = 100.0*config->GetTurbulenceIntensity_FreeStream();
+
+  rey_tc_corr = 4.45*pow(tu,3) - 5.7*pow(tu,2) + 1.37*tu + 0.585;
+  flen_corr   = 0.171*pow(tu,2) - 0.0083*tu + 0.0306;
+
+  if (tu <= 1.3) re_theta_corr = 1173.51 - 589.428*tu + 0.2196/(tu*tu);
+  else re_theta_corr = 331.5*pow(tu-0.5658,-0.671);
+
+  /*-- Tabulate f_lambda over the clip range of lambda, [-0.1, 0.1], this
+   *   removes the exp/pow chains from the fixed-point loop of the source
+   *   term, the correlation is empirical and smooth so the interpolation
+   *   error is well below its own uncertainty. --*/
+  const su2double pressFactor = exp(-pow(2.0/3.0*tu, 1.5));
+  const su2double accelFactor = 0.275*exp(-2.0*tu);
+
+  for (int i = 0; i <= N_FLAMBDA; ++i) {
+    const su2double lambda = -0.1 + 0.2*i/N_FLAMBDA;
+    if (lambda <= 0.0)
+      flambda_tab[i] = 1.0 - (-12.986*lambda - 123.66*lambda*lambda - 405.689*lambda*lambda*lambda)*pressFactor;
+    else
+      flambda_tab[i] = 1.0 + accelFactor*(1.0 - exp(-35.0*lambda));
+  }
+
   /*-- For debugging -AA --*/
   debugme = 0;
 }
 
 CSourcePieceWise_TransLM::~CSourcePieceWise_TransLM(void) { }
 
+su2double CSourcePieceWise_TransLM::FlambdaCorrelation(su2double lambda) const {
+
+  /*--- Interval index, lambda is already clipped to [-0.1, 0.1] by the caller. ---*/
+  const su2double s = (lambda + 0.1)/0.2*N_FLAMBDA;
+  const int i = min(max(int(SU2_TYPE::GetValue(s)), 0), N_FLAMBDA-1);
+  const su2double w = s - i;
+
+  return (1.0-w)*flambda_tab[i] + w*flambda_tab[i+1];
+}
+
 void CSourcePieceWise_TransLM::ComputeResidual_TransLM(su2double *val_residual, su2double **val_Jacobian_i,
                                                        su2double **val_Jacobian_j, CConfig *config, su2double &gamma_sep) {
   //************************************************//
@@ -365,7 +401,7 @@ void CSourcePieceWise_TransLM::ComputeResidual_TransLM(su2double *val_residual,
   //SU2_CPP2C DECL_LIST END
 
   /*-- Local intermediate variables --*/
-  su2double rey_tc, flen, re_v, strain, f_onset1, f_onset2, f_onset3, f_onset, f_turb, tu;
+  su2double rey_tc, flen, re_v, strain, f_onset1, f_onset2, f_onset3, f_onset, f_turb;
 
   su2double prod, des;
   su2double f_lambda, re_theta = 0.0, re_theta_lim, r_t;
@@ -400,8 +436,8 @@ void CSourcePieceWise_TransLM::ComputeResidual_TransLM(su2double *val_residual,
 //  rey  = config->GetReynolds();
 //  mach = config->GetMach();
 
-  /*--- turbulence intensity in the transition model is a percentage, so multiply by 100 ---*/
-  tu   = 100.0 * config->GetTurbulenceIntensity_FreeStream();
+  /*--- The turbulence intensity (tu) and the empirical correlations that only
+        depend on it are precomputed in the constructor. ---*/
   //SU2_CPP2C COMMENT END
 
   /*--- Compute vorticity and strain (TODO: Update for 3D) ---*/
@@ -418,8 +454,8 @@ void CSourcePieceWise_TransLM::ComputeResidual_TransLM(su2double *val_residual,
 
     /*-- Intermittency eq.: --*/
 
-    rey_tc = (4.45*pow(tu,3) - 5.7*pow(tu,2) + 1.37*tu + 0.585)*TransVar_i[1];
-    flen   = 0.171*pow(tu,2) - 0.0083*tu + 0.0306;
+    rey_tc = rey_tc_corr*TransVar_i[1];
+    flen   = flen_corr;
 
     re_v   = U_i[0]*pow(dist_i,2.)/Laminar_Viscosity_i*strain;  // Vorticity Reynolds number
 
@@ -470,27 +506,18 @@ void CSourcePieceWise_TransLM::ComputeResidual_TransLM(su2double *val_residual,
 
     re_theta_lim = 20.;
 
-    /*-- Fixed-point iterations to solve REth correlation --*/
+    /*-- Fixed-point iterations to solve REth correlation, the intensity
+         factor and f_lambda come from the precomputed correlations --*/
     f_lambda = 1.;
     for (int iter=0; iter<10; iter++) {
-      if (tu <= 1.3) {
-        re_theta = f_lambda * (1173.51-589.428*tu+0.2196/(tu*tu));
-      } else {
-        re_theta = 331.5 * f_lambda*pow(tu-0.5658,-0.671);
-      }
-      re_theta = max(re_theta, re_theta_lim);
+      re_theta = max(f_lambda*re_theta_corr, re_theta_lim);
 
       theta  = re_theta * Laminar_Viscosity_i / (U_i[0]*Velocity_Mag);
 
       lambda = U_i[0]*theta*theta*du_ds / Laminar_Viscosity_i;
       lambda = min(max(-0.1, lambda),0.1);
 
-      if (lambda<=0.0) {
-        f_lambda = 1. - (-12.986*lambda - 123.66*lambda*lambda -
-                         405.689*lambda*lambda*lambda)*exp(-pow(2./3*tu,1.5));
-      } else {
-        f_lambda = 1. + 0.275*(1.-exp(-35.*lambda))*exp(-2.*tu);
-      }
+      f_lambda = FlambdaCorrelation(lambda);
     }
 
     /*-- Calculate blending function f_theta --*/
@@ -512,28 +539,6 @@ void CSourcePieceWise_TransLM::ComputeResidual_TransLM(su2double *val_residual,
     val_residual[1] = c_theta*U_i[0]/time_scale *  (1.-f_theta) * (re_theta-TransVar_i[1]);
 
     //SU2_CPP2C COMMENT START
-    cout << "val_res0: "  << val_residual[0]      << endl;
-    cout << "val_res1: "  << val_residual[1]      << endl;
-    cout << "dist_i: "    << dist_i               << endl;
-    cout << "re_v: "      << re_v                 << endl;
-    cout << "c_a1: "      << c_a1                 << endl;
-    cout << "strain: "    << strain               << endl;
-    cout << "primgrad10: "<< PrimVar_Grad_i[1][0] << endl;
-    cout << "primgrad11: "<< PrimVar_Grad_i[1][1] << endl;
-    cout << "primgrad20: "<< PrimVar_Grad_i[2][0] << endl;
-    cout << "primgrad21: "<< PrimVar_Grad_i[2][1] << endl;
-    cout << "f_onset: "   << f_onset              << endl;
-    cout << "TransVar0: " << TransVar_i[0]        << endl;
-    cout << "prod: "      << prod                 << endl;
-    cout << "c_a2: "      << c_a2                 << endl;
-    cout << "Vorticity: " << Vorticity            << endl;
-    cout << "f_turb: "    << f_turb               << endl;
-    cout << "des: "       << des                  << endl;
-    cout << "du_ds: "     << du_ds                << endl;
-    cout << "r_t:    "    << r_t                  << endl;
-    cout << "rey_tc: "    << rey_tc               << endl;
-    cout << "re_theta: "  << re_theta             << endl;
-
     /*-- Calculate term for separation correction --*/
     f_reattach = exp(-pow(0.05*r_t,4));
     gamma_sep = s1*max(0., re_v/(3.235*rey_tc)-1.)*f_reattach;
@@ -559,7 +564,7 @@ void CSourcePieceWise_TransLM::ComputeResidual_TransLM(su2double *val_residual,
 void CSourcePieceWise_TransLM::CSourcePieceWise_TransLM__ComputeResidual_TransLM_d(const su2double *TransVar_i, const su2double *TransVar_id, su2double *val_residual, su2double *val_residuald, CConfig *config)
 {
   su2double rey_tc, flen, re_v, strain, f_onset1, f_onset2, f_onset3, f_onset,
-  f_turb, tu;
+  f_turb;
   su2double rey_tcd, f_onset1d, f_onset2d, f_onsetd;
   su2double prod, des;
   su2double prodd, desd;
@@ -588,8 +593,7 @@ void CSourcePieceWise_TransLM::CSourcePieceWise_TransLM__ComputeResidual_TransLM
 //  tu = 0.0;
 //  rey  = config->GetReynolds();
 //  mach = config->GetMach();
-  /* --- turbulence intensity for transition models is in percentages, so multiply by 100 ---*/ 
-  tu   = 100.0 * config->GetTurbulenceIntensity_FreeStream();
+  /* --- the turbulence intensity and its correlations are precomputed in the constructor ---*/
   /*--- Compute vorticity and strain (TODO: Update for 3D) ---*/
   Vorticity = fabs(PrimVar_Grad_i[1][1] - PrimVar_Grad_i[2][0]);
   /*-- Strain = sqrt(2*Sij*Sij) --*/
@@ -601,12 +605,9 @@ void CSourcePieceWise_TransLM::CSourcePieceWise_TransLM__ComputeResidual_TransLM
   if (dist_i > 0.0) {
     /*-- Intermittency eq.: --*/
     // Only operate away from wall
-    result1 = pow(tu, 3);
-    result2 = pow(tu, 2);
-    rey_tcd = (4.45*result1-5.7*result2+1.37*tu+0.585)*TransVar_id[1];
-    rey_tc = (4.45*result1-5.7*result2+1.37*tu+0.585)*TransVar_i[1];
-    result1 = pow(tu, 2);
-    flen = 0.171*result1 - 0.0083*tu + 0.0306;
+    rey_tcd = rey_tc_corr*TransVar_id[1];
+    rey_tc = rey_tc_corr*TransVar_i[1];
+    flen = flen_corr;
     result1 = pow(dist_i, 2.);
     re_v = U_i[0]*result1/Laminar_Viscosity_i*strain;
     /*-- f_onset controls transition onset location --*/
@@ -696,12 +697,7 @@ void CSourcePieceWise_TransLM::CSourcePieceWise_TransLM__ComputeResidual_TransLM
     {
       su2double x3;
       for (int iter = 0; iter < 10; ++iter) {
-        if (tu <= 1.3)
-          re_theta = f_lambda*(1173.51-589.428*tu+0.2196/(tu*tu));
-        else {
-          result1 = pow(tu - 0.5658, -0.671);
-          re_theta = 331.5*f_lambda*result1;
-        }
+        re_theta = f_lambda*re_theta_corr;
         if (re_theta < re_theta_lim) re_theta = re_theta_lim;
         theta = re_theta*Laminar_Viscosity_i/(U_i[0]*Velocity_Mag);
         lambda = U_i[0]*theta*theta*du_ds/Laminar_Viscosity_i;
@@ -713,12 +709,7 @@ void CSourcePieceWise_TransLM::CSourcePieceWise_TransLM__ComputeResidual_TransLM
           lambda = 0.1;
         else
           lambda = x3;
-        if (lambda <= 0.0) {
-          result1 = pow(2./3*tu, 1.5);
-          f_lambda = 1. - (-12.986*lambda-123.66*lambda*lambda-405.689
-                           *lambda*lambda*lambda)*exp(-result1);
-        } else
-          f_lambda = 1. + 0.275*(1.-exp(-35.*lambda))*exp(-2.*tu);
+        f_lambda = FlambdaCorrelation(lambda);
       }
     }
     /*-- Calculate blending function f_theta --*/
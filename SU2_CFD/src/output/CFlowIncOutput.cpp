@@ -521,6 +521,10 @@ void CFlowIncOutput::SetVolumeOutputFields(CConfig *config){
   }
 
   AddCommonFVMOutputs(config);
+
+  if (config->GetTime_Domain()){
+    SetTimeAveragedFields();
+  }
 }
 
 void CFlowIncOutput::LoadVolumeData(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned long iPoint){
@@ -670,6 +674,10 @@ void CFlowIncOutput::LoadVolumeData(CConfig *config, CGeometry *geometry, CSolve
   }
 
   LoadCommonFVMOutputs(config, geometry, iPoint);
+
+  if (config->GetTime_Domain()){
+    LoadTimeAveragedData(iPoint, Node_Flow);
+  }
 }
 
 void CFlowIncOutput::LoadSurfaceData(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned long iPoint, unsigned short iMarker, unsigned long iVertex){
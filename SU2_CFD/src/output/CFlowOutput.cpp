@@ -129,20 +129,25 @@ void CFlowOutput::SetAnalyzeSurface(const CSolver *solver, const CGeometry *geom
   const bool axisymmetric               = config->GetAxisymmetric();
   const unsigned short nMarker_Analyze  = config->GetnMarker_Analyze();
 
-  vector<su2double> Surface_MassFlow          (nMarker,0.0);
-  vector<su2double> Surface_Mach              (nMarker,0.0);
-  vector<su2double> Surface_Temperature       (nMarker,0.0);
-  vector<su2double> Surface_Density           (nMarker,0.0);
-  vector<su2double> Surface_Enthalpy          (nMarker,0.0);
-  vector<su2double> Surface_NormalVelocity    (nMarker,0.0);
-  vector<su2double> Surface_StreamVelocity2   (nMarker,0.0);
-  vector<su2double> Surface_TransvVelocity2   (nMarker,0.0);
-  vector<su2double> Surface_Pressure          (nMarker,0.0);
-  vector<su2double> Surface_TotalTemperature  (nMarker,0.0);
-  vector<su2double> Surface_TotalPressure     (nMarker,0.0);
-  vector<su2double> Surface_VelocityIdeal     (nMarker,0.0);
-  vector<su2double> Surface_Area              (nMarker,0.0);
-  vector<su2double> Surface_MassFlow_Abs      (nMarker,0.0);
+  /*--- The surface sums are accumulated directly segmented by analyze marker
+   (resolved once from the marker tag), so the bookkeeping stays proportional
+   to the number of analyzed surfaces when markers fragment across ranks. ---*/
+
+  const auto markerAnalyze = config->GetMarker_All_to_Analyze();
+
+  vector<su2double> Surface_MassFlow_Local          (nMarker_Analyze,0.0);
+  vector<su2double> Surface_Mach_Local              (nMarker_Analyze,0.0);
+  vector<su2double> Surface_Temperature_Local       (nMarker_Analyze,0.0);
+  vector<su2double> Surface_Density_Local           (nMarker_Analyze,0.0);
+  vector<su2double> Surface_Enthalpy_Local          (nMarker_Analyze,0.0);
+  vector<su2double> Surface_NormalVelocity_Local    (nMarker_Analyze,0.0);
+  vector<su2double> Surface_StreamVelocity2_Local   (nMarker_Analyze,0.0);
+  vector<su2double> Surface_TransvVelocity2_Local   (nMarker_Analyze,0.0);
+  vector<su2double> Surface_Pressure_Local          (nMarker_Analyze,0.0);
+  vector<su2double> Surface_TotalTemperature_Local  (nMarker_Analyze,0.0);
+  vector<su2double> Surface_TotalPressure_Local     (nMarker_Analyze,0.0);
+  vector<su2double> Surface_Area_Local              (nMarker_Analyze,0.0);
+  vector<su2double> Surface_MassFlow_Abs_Local      (nMarker_Analyze,0.0);
 
   su2double  Tot_Surface_MassFlow          = 0.0;
   su2double  Tot_Surface_Mach              = 0.0;
@@ -162,7 +167,10 @@ void CFlowOutput::SetAnalyzeSurface(const CSolver *solver, const CGeometry *geom
 
   for (iMarker = 0; iMarker < nMarker; iMarker++) {
 
-    if (config->GetMarker_All_Analyze(iMarker) == YES) {
+    if ((config->GetMarker_All_Analyze(iMarker) == YES) &&
+        (markerAnalyze[iMarker] < nMarker_Analyze)) {
+
+      iMarker_Analyze = markerAnalyze[iMarker];
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
         iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
@@ -237,51 +245,35 @@ void CFlowOutput::SetAnalyzeSurface(const CSolver *solver, const CGeometry *geom
 
           /*--- Compute the mass Surface_MassFlow ---*/
 
-          Surface_Area[iMarker]             += Area;
-          Surface_MassFlow[iMarker]         += MassFlow;
-          Surface_MassFlow_Abs[iMarker]     += abs(MassFlow);
+          Surface_Area_Local[iMarker_Analyze]             += Area;
+          Surface_MassFlow_Local[iMarker_Analyze]         += MassFlow;
+          Surface_MassFlow_Abs_Local[iMarker_Analyze]     += abs(MassFlow);
 
           if (Kind_Average == AVERAGE_MASSFLUX) Weight = abs(MassFlow);
           else if (Kind_Average == AVERAGE_AREA) Weight = abs(Area);
           else Weight = 1.0;
 
-          Surface_Mach[iMarker]             += Mach*Weight;
-          Surface_Temperature[iMarker]      += Temperature*Weight;
-          Surface_Density[iMarker]          += Density*Weight;
-          Surface_Enthalpy[iMarker]         += Enthalpy*Weight;
-          Surface_NormalVelocity[iMarker]   += Vn*Weight;
-          Surface_Pressure[iMarker]         += Pressure*Weight;
-          Surface_TotalTemperature[iMarker] += TotalTemperature*Weight;
-          Surface_TotalPressure[iMarker]    += TotalPressure*Weight;
+          Surface_Mach_Local[iMarker_Analyze]             += Mach*Weight;
+          Surface_Temperature_Local[iMarker_Analyze]      += Temperature*Weight;
+          Surface_Density_Local[iMarker_Analyze]          += Density*Weight;
+          Surface_Enthalpy_Local[iMarker_Analyze]         += Enthalpy*Weight;
+          Surface_NormalVelocity_Local[iMarker_Analyze]   += Vn*Weight;
+          Surface_Pressure_Local[iMarker_Analyze]         += Pressure*Weight;
+          Surface_TotalTemperature_Local[iMarker_Analyze] += TotalTemperature*Weight;
+          Surface_TotalPressure_Local[iMarker_Analyze]    += TotalPressure*Weight;
 
           /*--- For now, always used the area to weight the uniformities. ---*/
 
           Weight = abs(Area);
 
-          Surface_StreamVelocity2[iMarker]   += Vn2*Weight;
-          Surface_TransvVelocity2[iMarker]   += Vtang2*Weight;
+          Surface_StreamVelocity2_Local[iMarker_Analyze]   += Vn2*Weight;
+          Surface_TransvVelocity2_Local[iMarker_Analyze]   += Vtang2*Weight;
 
         }
       }
     }
   }
 
-  /*--- Copy to the appropriate structure ---*/
-
-  vector<su2double> Surface_MassFlow_Local          (nMarker_Analyze,0.0);
-  vector<su2double> Surface_Mach_Local              (nMarker_Analyze,0.0);
-  vector<su2double> Surface_Temperature_Local       (nMarker_Analyze,0.0);
-  vector<su2double> Surface_Density_Local           (nMarker_Analyze,0.0);
-  vector<su2double> Surface_Enthalpy_Local          (nMarker_Analyze,0.0);
-  vector<su2double> Surface_NormalVelocity_Local    (nMarker_Analyze,0.0);
-  vector<su2double> Surface_StreamVelocity2_Local   (nMarker_Analyze,0.0);
-  vector<su2double> Surface_TransvVelocity2_Local   (nMarker_Analyze,0.0);
-  vector<su2double> Surface_Pressure_Local          (nMarker_Analyze,0.0);
-  vector<su2double> Surface_TotalTemperature_Local  (nMarker_Analyze,0.0);
-  vector<su2double> Surface_TotalPressure_Local     (nMarker_Analyze,0.0);
-  vector<su2double> Surface_Area_Local              (nMarker_Analyze,0.0);
-  vector<su2double> Surface_MassFlow_Abs_Local      (nMarker_Analyze,0.0);
-
   vector<su2double> Surface_MassFlow_Total          (nMarker_Analyze,0.0);
   vector<su2double> Surface_Mach_Total              (nMarker_Analyze,0.0);
   vector<su2double> Surface_Temperature_Total       (nMarker_Analyze,0.0);
@@ -298,56 +290,39 @@ void CFlowOutput::SetAnalyzeSurface(const CSolver *solver, const CGeometry *geom
 
   vector<su2double> Surface_MomentumDistortion_Total (nMarker_Analyze,0.0);
 
-  /*--- Compute the numerical fan face Mach number, mach number, temperature and the total area ---*/
-
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-
-    if (config->GetMarker_All_Analyze(iMarker) == YES)  {
-
-      for (iMarker_Analyze= 0; iMarker_Analyze < nMarker_Analyze; iMarker_Analyze++) {
-
-        /*--- Add the Surface_MassFlow, and Surface_Area to the particular boundary ---*/
+  /*--- Pack all the surface sums into one buffer to pay the latency of a
+   single Allreduce instead of one per quantity, every iteration. ---*/
+
+  const pair<const vector<su2double>*, vector<su2double>*> reductions[] = {
+    {&Surface_MassFlow_Local, &Surface_MassFlow_Total},
+    {&Surface_Mach_Local, &Surface_Mach_Total},
+    {&Surface_Temperature_Local, &Surface_Temperature_Total},
+    {&Surface_Density_Local, &Surface_Density_Total},
+    {&Surface_Enthalpy_Local, &Surface_Enthalpy_Total},
+    {&Surface_NormalVelocity_Local, &Surface_NormalVelocity_Total},
+    {&Surface_StreamVelocity2_Local, &Surface_StreamVelocity2_Total},
+    {&Surface_TransvVelocity2_Local, &Surface_TransvVelocity2_Total},
+    {&Surface_Pressure_Local, &Surface_Pressure_Total},
+    {&Surface_TotalTemperature_Local, &Surface_TotalTemperature_Total},
+    {&Surface_TotalPressure_Local, &Surface_TotalPressure_Total},
+    {&Surface_Area_Local, &Surface_Area_Total},
+    {&Surface_MassFlow_Abs_Local, &Surface_MassFlow_Abs_Total},
+  };
 
-        if (config->GetMarker_All_TagBound(iMarker) == config->GetMarker_Analyze_TagBound(iMarker_Analyze)) {
-          Surface_MassFlow_Local[iMarker_Analyze]          += Surface_MassFlow[iMarker];
-          Surface_Mach_Local[iMarker_Analyze]              += Surface_Mach[iMarker];
-          Surface_Temperature_Local[iMarker_Analyze]       += Surface_Temperature[iMarker];
-          Surface_Density_Local[iMarker_Analyze]           += Surface_Density[iMarker];
-          Surface_Enthalpy_Local[iMarker_Analyze]          += Surface_Enthalpy[iMarker];
-          Surface_NormalVelocity_Local[iMarker_Analyze]    += Surface_NormalVelocity[iMarker];
-          Surface_StreamVelocity2_Local[iMarker_Analyze]   += Surface_StreamVelocity2[iMarker];
-          Surface_TransvVelocity2_Local[iMarker_Analyze]   += Surface_TransvVelocity2[iMarker];
-          Surface_Pressure_Local[iMarker_Analyze]          += Surface_Pressure[iMarker];
-          Surface_TotalTemperature_Local[iMarker_Analyze]  += Surface_TotalTemperature[iMarker];
-          Surface_TotalPressure_Local[iMarker_Analyze]     += Surface_TotalPressure[iMarker];
-          Surface_Area_Local[iMarker_Analyze]              += Surface_Area[iMarker];
-          Surface_MassFlow_Abs_Local[iMarker_Analyze]      += Surface_MassFlow_Abs[iMarker];
-        }
+  vector<su2double> sendBuffer, recvBuffer;
+  for (const auto& red : reductions)
+    sendBuffer.insert(sendBuffer.end(), red.first->begin(), red.first->end());
+  recvBuffer.resize(sendBuffer.size());
 
-      }
-
-    }
+  SU2_MPI::Allreduce(sendBuffer.data(), recvBuffer.data(), sendBuffer.size(),
+                     MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
 
+  auto it = recvBuffer.begin();
+  for (const auto& red : reductions) {
+    copy(it, it + red.second->size(), red.second->begin());
+    it += red.second->size();
   }
 
-  auto Allreduce = [](const vector<su2double>& src, vector<su2double>& dst) {
-    SU2_MPI::Allreduce(src.data(), dst.data(), src.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-  };
-
-  Allreduce(Surface_MassFlow_Local, Surface_MassFlow_Total);
-  Allreduce(Surface_Mach_Local, Surface_Mach_Total);
-  Allreduce(Surface_Temperature_Local, Surface_Temperature_Total);
-  Allreduce(Surface_Density_Local, Surface_Density_Total);
-  Allreduce(Surface_Enthalpy_Local, Surface_Enthalpy_Total);
-  Allreduce(Surface_NormalVelocity_Local, Surface_NormalVelocity_Total);
-  Allreduce(Surface_StreamVelocity2_Local, Surface_StreamVelocity2_Total);
-  Allreduce(Surface_TransvVelocity2_Local, Surface_TransvVelocity2_Total);
-  Allreduce(Surface_Pressure_Local, Surface_Pressure_Total);
-  Allreduce(Surface_TotalTemperature_Local, Surface_TotalTemperature_Total);
-  Allreduce(Surface_TotalPressure_Local, Surface_TotalPressure_Total);
-  Allreduce(Surface_Area_Local, Surface_Area_Total);
-  Allreduce(Surface_MassFlow_Abs_Local, Surface_MassFlow_Abs_Total);
-
   /*--- Compute the value of Surface_Area_Total, and Surface_Pressure_Total, and
    set the value in the config structure for future use ---*/
 
@@ -2760,17 +2735,23 @@ void CFlowOutput::SetTimeAveragedFields(){
   AddVolumeOutput("RMS_V",   "RMS[v]", "TIME_AVERAGE", "RMS v");
   AddVolumeOutput("RMS_UV",  "RMS[uv]", "TIME_AVERAGE", "RMS uv");
   AddVolumeOutput("RMS_P",   "RMS[Pressure]",   "TIME_AVERAGE", "RMS Pressure");
+  AddVolumeOutput("RMS_UP",  "RMS[up]", "TIME_AVERAGE", "RMS up");
+  AddVolumeOutput("RMS_VP",  "RMS[vp]", "TIME_AVERAGE", "RMS vp");
   AddVolumeOutput("UUPRIME", "u'u'", "TIME_AVERAGE", "Mean Reynolds-stress component u'u'");
   AddVolumeOutput("VVPRIME", "v'v'", "TIME_AVERAGE", "Mean Reynolds-stress component v'v'");
   AddVolumeOutput("UVPRIME", "u'v'", "TIME_AVERAGE", "Mean Reynolds-stress component u'v'");
   AddVolumeOutput("PPRIME",  "p'p'",   "TIME_AVERAGE", "Mean pressure fluctuation p'p'");
+  AddVolumeOutput("UPPRIME", "u'p'", "TIME_AVERAGE", "Mean pressure-velocity correlation u'p'");
+  AddVolumeOutput("VPPRIME", "v'p'", "TIME_AVERAGE", "Mean pressure-velocity correlation v'p'");
   if (nDim == 3){
     AddVolumeOutput("RMS_W",   "RMS[w]", "TIME_AVERAGE", "RMS u");
     AddVolumeOutput("RMS_UW", "RMS[uw]", "TIME_AVERAGE", "RMS uw");
     AddVolumeOutput("RMS_VW", "RMS[vw]", "TIME_AVERAGE", "RMS vw");
+    AddVolumeOutput("RMS_WP", "RMS[wp]", "TIME_AVERAGE", "RMS wp");
     AddVolumeOutput("WWPRIME", "w'w'", "TIME_AVERAGE", "Mean Reynolds-stress component w'w'");
     AddVolumeOutput("UWPRIME", "w'u'", "TIME_AVERAGE", "Mean Reynolds-stress component w'u'");
     AddVolumeOutput("VWPRIME", "w'v'", "TIME_AVERAGE", "Mean Reynolds-stress component w'v'");
+    AddVolumeOutput("WPPRIME", "w'p'", "TIME_AVERAGE", "Mean pressure-velocity correlation w'p'");
   }
 }
 
@@ -2787,10 +2768,13 @@ void CFlowOutput::LoadTimeAveragedData(unsigned long iPoint, CVariable *Node_Flo
   SetAvgVolumeOutputValue("RMS_V", iPoint, pow(Node_Flow->GetVelocity(iPoint,1),2));
   SetAvgVolumeOutputValue("RMS_UV", iPoint, Node_Flow->GetVelocity(iPoint,0) * Node_Flow->GetVelocity(iPoint,1));
   SetAvgVolumeOutputValue("RMS_P", iPoint, pow(Node_Flow->GetPressure(iPoint),2));
+  SetAvgVolumeOutputValue("RMS_UP", iPoint, Node_Flow->GetVelocity(iPoint,0) * Node_Flow->GetPressure(iPoint));
+  SetAvgVolumeOutputValue("RMS_VP", iPoint, Node_Flow->GetVelocity(iPoint,1) * Node_Flow->GetPressure(iPoint));
   if (nDim == 3){
     SetAvgVolumeOutputValue("RMS_W", iPoint, pow(Node_Flow->GetVelocity(iPoint,2),2));
     SetAvgVolumeOutputValue("RMS_VW", iPoint, Node_Flow->GetVelocity(iPoint,2) * Node_Flow->GetVelocity(iPoint,1));
     SetAvgVolumeOutputValue("RMS_UW", iPoint,  Node_Flow->GetVelocity(iPoint,2) * Node_Flow->GetVelocity(iPoint,0));
+    SetAvgVolumeOutputValue("RMS_WP", iPoint, Node_Flow->GetVelocity(iPoint,2) * Node_Flow->GetPressure(iPoint));
   }
 
   const su2double umean  = GetVolumeOutputValue("MEAN_VELOCITY-X", iPoint);
@@ -2801,18 +2785,25 @@ void CFlowOutput::LoadTimeAveragedData(unsigned long iPoint, CVariable *Node_Flo
   const su2double pmean  = GetVolumeOutputValue("MEAN_PRESSURE", iPoint);
   const su2double ppmean = GetVolumeOutputValue("RMS_P", iPoint);
 
+  const su2double upmean = GetVolumeOutputValue("RMS_UP", iPoint);
+  const su2double vpmean = GetVolumeOutputValue("RMS_VP", iPoint);
+
   SetVolumeOutputValue("UUPRIME", iPoint, -(umean*umean - uumean));
   SetVolumeOutputValue("VVPRIME", iPoint, -(vmean*vmean - vvmean));
   SetVolumeOutputValue("UVPRIME", iPoint, -(umean*vmean - uvmean));
   SetVolumeOutputValue("PPRIME",  iPoint, -(pmean*pmean - ppmean));
+  SetVolumeOutputValue("UPPRIME", iPoint, -(umean*pmean - upmean));
+  SetVolumeOutputValue("VPPRIME", iPoint, -(vmean*pmean - vpmean));
   if (nDim == 3){
     const su2double wmean  = GetVolumeOutputValue("MEAN_VELOCITY-Z", iPoint);
     const su2double wwmean = GetVolumeOutputValue("RMS_W", iPoint);
     const su2double uwmean = GetVolumeOutputValue("RMS_UW", iPoint);
     const su2double vwmean = GetVolumeOutputValue("RMS_VW", iPoint);
+    const su2double wpmean = GetVolumeOutputValue("RMS_WP", iPoint);
     SetVolumeOutputValue("WWPRIME", iPoint, -(wmean*wmean - wwmean));
     SetVolumeOutputValue("UWPRIME", iPoint, -(umean*wmean - uwmean));
     SetVolumeOutputValue("VWPRIME",  iPoint, -(vmean*wmean - vwmean));
+    SetVolumeOutputValue("WPPRIME",  iPoint, -(wmean*pmean - wpmean));
   }
 }
 
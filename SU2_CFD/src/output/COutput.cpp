@@ -29,6 +29,7 @@
 #include "../../include/solvers/CSolver.hpp"
 
 #include "../../include/output/COutput.hpp"
+#include "../../include/output/CProbeOutput.hpp"
 #include "../../include/output/filewriter/CFVMDataSorter.hpp"
 #include "../../include/output/filewriter/CFEMDataSorter.hpp"
 #include "../../include/output/filewriter/CCGNSFileWriter.hpp"
@@ -45,6 +46,7 @@
 #include "../../include/output/filewriter/CSU2FileWriter.hpp"
 #include "../../include/output/filewriter/CSU2BinaryFileWriter.hpp"
 #include "../../include/output/filewriter/CSU2MeshFileWriter.hpp"
+#include "../../../Common/include/toolboxes/profiling_toolbox.hpp"
 
 
 COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
@@ -62,7 +64,9 @@ COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
   convergenceTable = new PrintingToolbox::CTablePrinter(&std::cout);
   multiZoneHeaderTable = new PrintingToolbox::CTablePrinter(&std::cout);
   fileWritingTable = new PrintingToolbox::CTablePrinter(&std::cout);
-  historyFileTable = new PrintingToolbox::CTablePrinter(&histFile, "");
+  /*--- The history table prints into a buffer that is written to histFile in
+   batches (possibly on a background thread), see FlushHistoryBuffer. ---*/
+  historyFileTable = new PrintingToolbox::CTablePrinter(&histBuffer, "");
 
   /*--- Set default filenames ---*/
 
@@ -125,9 +129,24 @@ COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
     convFields.emplace_back(config->GetConv_Field(iField));
   }
 
+  /*--- Optional per-field tolerances and the variance/slope based criteria. ---*/
+
+  cauchyVarianceEps = config->GetCauchy_Variance_Eps();
+  residualSlopeEps = config->GetResidual_Slope_Eps();
+
+  if (config->GetnConv_Field_Eps() > 0){
+    if (config->GetnConv_Field_Eps() != config->GetnConv_Field()){
+      SU2_MPI::Error("CONV_FIELD_EPS must list one tolerance per entry of CONV_FIELD.", CURRENT_FUNCTION);
+    }
+    for (unsigned short iField = 0; iField < config->GetnConv_Field_Eps(); iField++){
+      convFieldEps.push_back(config->GetConv_Field_Eps(iField));
+    }
+  }
+
   newFunc = vector<su2double>(convFields.size());
   oldFunc = vector<su2double>(convFields.size());
   cauchySerie = vector<vector<su2double>>(convFields.size(), vector<su2double>(nCauchy_Elems, 0.0));
+  convValueSerie = vector<vector<su2double>>(convFields.size(), vector<su2double>(nCauchy_Elems, 0.0));
   cauchyValue = 0.0;
   convergence = false;
 
@@ -171,9 +190,32 @@ COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
 
   headerNeeded = false;
 
+  /*--- Asynchronous writing of the binary volume files, outside of serial builds
+   *    this requires thread-safe MPI (see the --thread_multiple CLI option). ---*/
+
+  allowAsyncWrites = config->GetWrt_Async();
+  deferWriters = false;
+  sharedVTMWriter = nullptr;
+#ifdef HAVE_MPI
+  if (allowAsyncWrites) {
+    int provided = 0;
+    MPI_Query_thread(&provided);
+    if (provided < MPI_THREAD_MULTIPLE) {
+      allowAsyncWrites = false;
+      if (rank == MASTER_NODE) {
+        cout << "WARNING: WRT_ASYNC= YES requires full MPI thread support, launch SU2_CFD with\n"
+             << "         --thread_multiple to enable it. Falling back to synchronous output." << endl;
+      }
+    }
+  }
+#endif
+
 }
 
 COutput::~COutput(void) {
+  FlushAsyncWrites();
+  FlushHistoryBuffer(true);
+
   delete convergenceTable;
   delete multiZoneHeaderTable;
   delete fileWritingTable;
@@ -181,6 +223,24 @@ COutput::~COutput(void) {
 
   delete volumeDataSorter;
   delete surfaceDataSorter;
+  delete probeOutput;
+}
+
+void COutput::ResetDataSorters() {
+
+  /*--- Writers queued on the old sorted buffers must finish first. ---*/
+
+  FlushAsyncWrites();
+
+  delete volumeDataSorter;
+  volumeDataSorter = nullptr;
+  delete surfaceDataSorter;
+  surfaceDataSorter = nullptr;
+
+  /*--- The probes hold point indices of the old mesh, flush and relocate them. ---*/
+
+  delete probeOutput;
+  probeOutput = nullptr;
 }
 
 void COutput::SetHistory_Output(CGeometry *geometry,
@@ -299,16 +359,84 @@ void COutput::Load_Data(CGeometry *geometry, CConfig *config, CSolver** solver_c
 
   LoadDataIntoSorter(config, geometry, solver_container);
 
-  /*--- Partition and sort the volume output data -- */
+  /*--- Partition and sort the volume output data, writers of the previous output
+   *    files may still be reading the sorted data in asynchronous mode. -- */
+
+  FlushAsyncWrites();
 
   volumeDataSorter->SortOutputData();
 
 }
 
+void COutput::FlushAsyncWrites() {
+
+  if (asyncWriteThread.joinable()) asyncWriteThread.join();
+
+}
+
+void COutput::FlushHistoryBuffer(bool force) {
+
+  /*--- A few KiB cover several rows, writing them in one go keeps the
+   formatting out of the iteration path without the file lagging far
+   behind the run. Only one flush thread is alive at a time. ---*/
+
+  constexpr std::streamoff flushSize = 4096;
+
+  const auto buffered = histBuffer.tellp();
+  if (!force && buffered < flushSize) return;
+
+  if (histWriteThread.joinable()) histWriteThread.join();
+
+  if (buffered <= 0) return;
+
+  std::string text = histBuffer.str();
+  histBuffer.str("");
+
+  if (force) {
+    histFile << text;
+    histFile.flush();
+  }
+  else {
+    histWriteThread = std::thread([this, text]() {
+      histFile << text;
+      histFile.flush();
+    });
+  }
+}
+
+void COutput::LaunchAsyncWrites(CConfig *config) {
+
+  if (asyncWriters.empty()) return;
+
+  /*--- The thread takes ownership of the queued writers, it is joined before the
+   *    data sorters are re-used (FlushAsyncWrites) and on destruction. ---*/
+
+  vector<pair<CFileWriter*, unsigned short> > writers;
+  writers.swap(asyncWriters);
+
+  asyncWriteThread = std::thread([writers, config]() {
+    for (auto writer : writers) {
+
+      writer.first->Write_Data();
+
+      if (writer.second == RESTART_BINARY) {
+        config->SetRestart_Bandwidth_Agg(config->GetRestart_Bandwidth_Agg() + writer.first->Get_Bandwidth());
+      }
+      delete writer.first;
+    }
+  });
+
+}
+
 void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short format, string fileName){
 
   CFileWriter *fileWriter = nullptr;
 
+  /*--- The writers about to be created read from the data sorters, wait for any
+   *    pending asynchronous writes before (re-)sorting data into them. ---*/
+
+  FlushAsyncWrites();
+
   unsigned short lastindex = fileName.find_last_of(".");
   fileName = fileName.substr(0, lastindex);
 
@@ -345,18 +473,44 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
 
       break;
 
-    case RESTART_BINARY:
+    case RESTART_BINARY: {
 
       if (fileName.empty())
         fileName = config->GetFilename(restartFilename, "", curTimeIter);
 
+      /*--- Delta-encoded checkpointing: between periodic full restarts (keyframes)
+       *    only the sparse differences against the last keyframe are written. A new
+       *    keyframe is forced when the file name repeats (e.g. steady runs or
+       *    overwrite mode), a delta must never reference a file it replaces. ---*/
+
+      const vector<passivedouble>* keyframe = nullptr;
+
+      if (config->GetWrt_Restart_Delta()) {
+        const bool fullWrite = restartKeyframe.empty() || (restartKeyframeName == fileName) ||
+                               (restartDeltaCount >= config->GetRestart_Keyframe_Interval());
+        if (fullWrite) {
+          const passivedouble* data = volumeDataSorter->GetData();
+          const unsigned long nData = volumeDataSorter->GetFieldNames().size()*volumeDataSorter->GetnPoints();
+          restartKeyframe.assign(data, data + nData);
+          restartKeyframeName = fileName;
+          restartDeltaCount = 0;
+        }
+        else {
+          keyframe = &restartKeyframe;
+        }
+        restartDeltaCount++;
+      }
+
       if (rank == MASTER_NODE) {
-          (*fileWritingTable) << "SU2 restart" << fileName + CSU2BinaryFileWriter::fileExt;
+          (*fileWritingTable) << (keyframe? "SU2 restart (delta)" : "SU2 restart")
+                              << fileName + CSU2BinaryFileWriter::fileExt;
       }
 
-      fileWriter = new CSU2BinaryFileWriter(fileName, volumeDataSorter);
+      fileWriter = new CSU2BinaryFileWriter(fileName, volumeDataSorter, config->GetWrt_Restart_Single(),
+                                            keyframe, restartKeyframeName);
 
       break;
+    }
 
     case MESH:
 
@@ -466,14 +620,29 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
 
         fileName = config->GetUnsteady_FileName(config->GetCaseName(), curTimeIter, "");
 
-        /*--- Allocate the vtm file writer ---*/
+        /*--- Allocate the vtm file writer, or append to the writer shared between
+         *    all zones if the multi-zone driver registered one. In the shared mode
+         *    each zone only adds its blocks, the master file is written in a single
+         *    pass by the driver once all zones have been aggregated. ---*/
+
+        CParaviewVTMFileWriter* vtmWriter = nullptr;
 
-        fileWriter = new CParaviewVTMFileWriter(fileName, fileName, GetHistoryFieldValue("CUR_TIME"),
-                                                config->GetiZone(), config->GetnZone());
+        if (sharedVTMWriter != nullptr) {
+          if (*sharedVTMWriter == nullptr)
+            *sharedVTMWriter = new CParaviewVTMFileWriter(fileName, fileName, GetHistoryFieldValue("CUR_TIME"),
+                                                          config->GetiZone(), config->GetnZone(), true);
+          vtmWriter = *sharedVTMWriter;
+          vtmWriter->SetCurrentZone(config->GetiZone());
+        }
+        else {
+
+          fileWriter = new CParaviewVTMFileWriter(fileName, fileName, GetHistoryFieldValue("CUR_TIME"),
+                                                  config->GetiZone(), config->GetnZone());
 
-        /*--- We cast the pointer to its true type, to avoid virtual functions ---*/
+          /*--- We cast the pointer to its true type, to avoid virtual functions ---*/
 
-        CParaviewVTMFileWriter* vtmWriter = dynamic_cast<CParaviewVTMFileWriter*>(fileWriter);
+          vtmWriter = dynamic_cast<CParaviewVTMFileWriter*>(fileWriter);
+        }
 
         if (rank == MASTER_NODE) {
             (*fileWritingTable) << "Paraview Multiblock"
@@ -720,6 +889,16 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
 
   if (fileWriter != nullptr){
 
+    /*--- The binary volume writers can be deferred to a background thread, they only
+     *    read the (volume) sorted data which is not touched again until the next
+     *    output, SetResult_Files launches the queued writers after the loop over
+     *    the (remaining, synchronous) output files. ---*/
+
+    if (allowAsyncWrites && deferWriters && (format == RESTART_BINARY || format == PARAVIEW_BINARY)) {
+      asyncWriters.emplace_back(fileWriter, format);
+      return;
+    }
+
     /*--- Write data to file ---*/
 
     fileWriter->Write_Data();
@@ -758,6 +937,16 @@ bool COutput::GetCauchyCorrectedTimeConvergence(const CConfig *config){
 bool COutput::SetResult_Files(CGeometry *geometry, CConfig *config, CSolver** solver_container,
                               unsigned long iter, bool force_writing){
 
+  SU2_PROFILE_SCOPE("COutput::SetResult_Files");
+
+  /*--- Sample the time-resolved point probes every step, independently of the
+   volume output frequency, they keep their own buffer and flush schedule. ---*/
+
+  if (config->GetnProbeCoord() > 0) {
+    if (probeOutput == nullptr) probeOutput = new CProbeOutput(config, geometry);
+    probeOutput->Sample(solver_container, config, iter);
+  }
+
   bool writeFiles = WriteVolume_Output(config, iter, force_writing || cauchyTimeConverged);
 
   /*--- Check if the data sorters are allocated, if not, allocate them. --- */
@@ -773,10 +962,18 @@ bool COutput::SetResult_Files(CGeometry *geometry, CConfig *config, CSolver** so
 
   if (writeFiles){
 
-    /*--- Partition and sort the data --- */
+    /*--- Partition and sort the data, waiting for writers of the
+     *    previous output files that may still be reading it. --- */
+
+    FlushAsyncWrites();
 
     volumeDataSorter->SortOutputData();
 
+    /*--- Hand the sorted buffers to the in-situ hook (if any) before the file
+     *    writers, co-processing works without requesting any volume files. ---*/
+
+    if (coProcessingHook) coProcessingHook(volumeDataSorter, iter);
+
     unsigned short nVolumeFiles = config->GetnVolumeOutputFiles();
     auto VolumeFiles = config->GetVolumeOutputFiles();
 
@@ -787,7 +984,10 @@ bool COutput::SetResult_Files(CGeometry *geometry, CConfig *config, CSolver** so
     }
 
     /*--- Loop through all requested output files and write
-     * the partitioned and sorted data stored in the data sorters. ---*/
+     * the partitioned and sorted data stored in the data sorters.
+     * The binary volume writers may be queued for asynchronous writing. ---*/
+
+    deferWriters = allowAsyncWrites;
 
     for (unsigned short iFile = 0; iFile < nVolumeFiles; iFile++){
 
@@ -795,6 +995,8 @@ bool COutput::SetResult_Files(CGeometry *geometry, CConfig *config, CSolver** so
 
     }
 
+    deferWriters = false;
+
     if (rank == MASTER_NODE && nVolumeFiles != 0){
       fileWritingTable->PrintFooter();
       headerNeeded = true;
@@ -804,6 +1006,11 @@ bool COutput::SetResult_Files(CGeometry *geometry, CConfig *config, CSolver** so
 
     WriteAdditionalFiles(config, geometry, solver_container);
 
+    /*--- Perform the deferred writes in the background while the solver
+     *    advances the next time steps. ---*/
+
+    LaunchAsyncWrites(config);
+
     return true;
   }
 
@@ -823,19 +1030,21 @@ void COutput::PrintConvergenceSummary(){
   for (unsigned short iField_Conv = 0; iField_Conv < convFields.size(); iField_Conv++){
     const string &convField = convFields[iField_Conv];
     if (historyOutput_Map.at(convField).fieldType == HistoryFieldType::COEFFICIENT) {
+      const su2double fieldEps = convFieldEps.empty()? cauchyEps : convFieldEps[iField_Conv];
       string convMark = "No";
-      if ( historyOutput_Map.at("CAUCHY_" + convField).value < cauchyEps) convMark = "Yes";
+      if ( historyOutput_Map.at("CAUCHY_" + convField).value < fieldEps) convMark = "Yes";
       ConvSummary << historyOutput_Map.at("CAUCHY_" + convField).fieldName
           <<  historyOutput_Map.at("CAUCHY_" + convField).value
-          << " < " + PrintingToolbox::to_string(cauchyEps) << convMark;
+          << " < " + PrintingToolbox::to_string(fieldEps) << convMark;
     }
     else if (historyOutput_Map.at(convField).fieldType == HistoryFieldType::RESIDUAL ||
         historyOutput_Map.at(convField).fieldType == HistoryFieldType::AUTO_RESIDUAL)  {
+      const su2double fieldMinVal = convFieldEps.empty()? minLogResidual : convFieldEps[iField_Conv];
       string convMark = "No";
-      if (historyOutput_Map.at(convField).value < minLogResidual) convMark = "Yes";
+      if (historyOutput_Map.at(convField).value < fieldMinVal) convMark = "Yes";
       ConvSummary << historyOutput_Map.at(convField).fieldName
           << historyOutput_Map.at(convField).value
-          << " < " + PrintingToolbox::to_string(minLogResidual) << convMark;
+          << " < " + PrintingToolbox::to_string(fieldMinVal) << convMark;
     }
   }
   ConvSummary.PrintFooter();
@@ -860,10 +1069,24 @@ bool COutput::Convergence_Monitoring(CConfig *config, unsigned long Iteration) {
         SU2_MPI::Error("SU2 has diverged (NaN detected).", CURRENT_FUNCTION);
       }
 
+      /*--- Keep a window of the raw monitored values for the
+       * variance and slope based criteria below. ---*/
+
+      if (Iteration == 0){
+        for (iCounter = 0; iCounter < nCauchy_Elems; iCounter++){
+          convValueSerie[iField_Conv][iCounter] = monitor;
+        }
+      }
+      convValueSerie[iField_Conv][Iteration % nCauchy_Elems] = monitor;
+
+      const bool windowFull = (Iteration >= max(config->GetStartConv_Iter(), nCauchy_Elems));
+
       /*--- Cauchy based convergence criteria ---*/
 
       if (historyOutput_Map.at(convField).fieldType == HistoryFieldType::COEFFICIENT) {
 
+        const su2double fieldEps = convFieldEps.empty()? cauchyEps : convFieldEps[iField_Conv];
+
         if (Iteration == 0){
           for (iCounter = 0; iCounter < nCauchy_Elems; iCounter++){
             cauchySerie[iField_Conv][iCounter] = 0.0;
@@ -882,14 +1105,33 @@ bool COutput::Convergence_Monitoring(CConfig *config, unsigned long Iteration) {
 
         cauchyValue /= nCauchy_Elems;
 
-        if (cauchyValue >= cauchyEps) { fieldConverged = false;}
+        if (cauchyValue >= fieldEps) { fieldConverged = false;}
         else { fieldConverged = true;}
 
+        /*--- Variance based criteria: a coefficient that only oscillates in its
+         * last digits never satisfies the Cauchy check above, but is converged in
+         * a statistical sense once the relative standard deviation over the
+         * window drops below the tolerance. ---*/
+
+        if (!fieldConverged && (cauchyVarianceEps > 0.0) && windowFull){
+          su2double mean = 0.0, variance = 0.0;
+          for (iCounter = 0; iCounter < nCauchy_Elems; iCounter++)
+            mean += convValueSerie[iField_Conv][iCounter];
+          mean /= nCauchy_Elems;
+          for (iCounter = 0; iCounter < nCauchy_Elems; iCounter++)
+            variance += pow(convValueSerie[iField_Conv][iCounter] - mean, 2);
+          variance /= nCauchy_Elems;
+
+          if (sqrt(variance) < cauchyVarianceEps*max(fabs(mean), su2double(EPS))){
+            fieldConverged = true;
+          }
+        }
+
         /*--- Start monitoring only if the current iteration
          *  is larger than the number of cauchy elements and
          * the number of start-up iterations --- */
 
-        if (Iteration < max(config->GetStartConv_Iter(), nCauchy_Elems)){
+        if (!windowFull){
           fieldConverged = false;
         }
 
@@ -906,11 +1148,25 @@ bool COutput::Convergence_Monitoring(CConfig *config, unsigned long Iteration) {
       if (historyOutput_Map.at(convField).fieldType == HistoryFieldType::RESIDUAL ||
           historyOutput_Map.at(convField).fieldType == HistoryFieldType::AUTO_RESIDUAL) {
 
+        const su2double fieldMinVal = convFieldEps.empty()? minLogResidual : convFieldEps[iField_Conv];
+
         /*--- Check the convergence ---*/
 
-        if (Iteration != 0 && (monitor <= minLogResidual)) { fieldConverged = true;  }
+        if (Iteration != 0 && (monitor <= fieldMinVal)) { fieldConverged = true;  }
         else { fieldConverged = false; }
 
+        /*--- Slope based criteria: once the mean decrease over the window falls
+         * below the tolerance (orders of magnitude per iteration) the residual
+         * has stalled and further iterations only burn time. ---*/
+
+        if (!fieldConverged && (residualSlopeEps > 0.0) && windowFull){
+          const su2double oldest = convValueSerie[iField_Conv][(Iteration+1) % nCauchy_Elems];
+          const su2double slope = fabs(monitor - oldest)/(nCauchy_Elems-1);
+          if (slope < residualSlopeEps){
+            fieldConverged = true;
+          }
+        }
+
       }
 
       /*--- Do not apply any convergence criteria of the number
@@ -1044,10 +1300,10 @@ void COutput::SetHistoryFile_Header(const CConfig *config) {
   }
 
   if (config->GetTabular_FileFormat() == TAB_TECPLOT) {
-    histFile << "VARIABLES = \\" << endl;
+    histBuffer << "VARIABLES = \\" << endl;
   }
   historyFileTable->PrintHeader();
-  histFile.flush();
+  FlushHistoryBuffer(true);
 }
 
 
@@ -1081,9 +1337,10 @@ void COutput::SetHistoryFile_Output(const CConfig *config) {
     }
   }
 
-  /*--- Print the string to file and remove the last two characters (a separator and a space) ---*/
+  /*--- Hand the formatted row(s) to the background writer, forcing them out
+   when the run converged so the file is complete before the result files. ---*/
 
-  histFile.flush();
+  FlushHistoryBuffer(convergence);
 }
 
 void COutput::SetScreen_Header(const CConfig *config) {
@@ -1756,6 +2013,10 @@ void COutput::Postprocess_HistoryData(CConfig *config){
       }
       if (config->GetDirectDiff() != NO_DERIVATIVE){
         SetHistoryOutputValue("D_" + fieldIdentifier, SU2_TYPE::GetDerivative(currentField.value));
+        for (int iDir = 1; iDir < SU2_TYPE::DerivativeDirections; iDir++){
+          SetHistoryOutputValue("D" + to_string(iDir) + "_" + fieldIdentifier,
+                                SU2_TYPE::GetDerivative(currentField.value, iDir));
+        }
       }
     }
   }
@@ -1813,6 +2074,17 @@ void COutput::Postprocess_HistoryFields(CConfig *config){
         AddHistoryOutput("D_"      + fieldIdentifier, "d["     + currentField.fieldName + "]",
                          currentField.screenFormat, "D_"      + currentField.outputGroup,
                          "Derivative value (DIRECT_DIFF=YES)", HistoryFieldType::AUTO_COEFFICIENT);
+
+        /*--- In vector forward mode each additional derivative direction gets its own
+         * field, D_ remains the (first) direction of scalar forward builds. ---*/
+
+        for (int iDir = 1; iDir < SU2_TYPE::DerivativeDirections; iDir++){
+          AddHistoryOutput("D" + to_string(iDir) + "_" + fieldIdentifier,
+                           "d" + to_string(iDir) + "[" + currentField.fieldName + "]",
+                           currentField.screenFormat, "D_" + currentField.outputGroup,
+                           "Derivative value, direction " + to_string(iDir) + " (DIRECT_DIFF=YES)",
+                           HistoryFieldType::AUTO_COEFFICIENT);
+        }
       }
     }
   }
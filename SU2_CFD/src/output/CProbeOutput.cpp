@@ -0,0 +1,192 @@
+/*!
+ * \file CProbeOutput.cpp
+ * \brief Time-resolved point probes with buffered binary output.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/output/CProbeOutput.hpp"
+
+#include <fstream>
+
+#include "../../../Common/include/CConfig.hpp"
+#include "../../../Common/include/geometry/CGeometry.hpp"
+#include "../../../Common/include/adt/CADTPointsOnlyClass.hpp"
+#include "../../include/solvers/CSolver.hpp"
+
+CProbeOutput::CProbeOutput(const CConfig *config, CGeometry *geometry) :
+  rank(SU2_MPI::GetRank()),
+  size(SU2_MPI::GetSize()),
+  nDim(geometry->GetnDim()),
+  nProbe(0),
+  nVarSample(0),
+  nSampled(0),
+  flushFreq(max<unsigned long>(1, config->GetProbe_Wrt_Freq())),
+  fileName("probes.bin"),
+  headerWritten(false) {
+
+  const unsigned short nCoord = config->GetnProbeCoord();
+  if (nCoord % nDim != 0)
+    SU2_MPI::Error("PROBE_LOCATIONS must contain nDim coordinates per probe.", CURRENT_FUNCTION);
+  nProbe = nCoord / nDim;
+  if (nProbe == 0) return;
+
+  probeCoords.resize(nCoord);
+  for (unsigned short iCoord = 0; iCoord < nCoord; iCoord++)
+    probeCoords[iCoord] = SU2_TYPE::GetValue(config->GetProbeCoord(iCoord));
+
+  /*--- Build an ADT of the owned grid points and locate the node nearest
+   to each probe, this is done only once per run. ---*/
+
+  const auto nPointDomain = geometry->GetnPointDomain();
+  vector<su2double> coords(nPointDomain*nDim);
+  vector<unsigned long> pointIDs(nPointDomain);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    pointIDs[iPoint] = iPoint;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      coords[iPoint*nDim+iDim] = geometry->nodes->GetCoord(iPoint, iDim);
+  }
+
+  CADTPointsOnlyClass pointADT(nDim, nPointDomain, coords.data(), pointIDs.data(), false);
+
+  vector<passivedouble> dist(nProbe, 1e30), minDist(nProbe);
+  vector<unsigned long> nearest(nProbe, 0);
+
+  if (!pointADT.IsEmpty()) {
+    for (auto iProbe = 0ul; iProbe < nProbe; iProbe++) {
+      su2double coor[3] = {0.0}, d;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        coor[iDim] = config->GetProbeCoord(iProbe*nDim+iDim);
+
+      unsigned long pointID; int rankID;
+      pointADT.DetermineNearestNode(coor, d, pointID, rankID);
+      dist[iProbe] = SU2_TYPE::GetValue(d);
+      nearest[iProbe] = pointID;
+    }
+  }
+
+  /*--- The rank with the globally nearest node owns the probe and samples it,
+   ties (e.g. periodic duplicates) go to the lower rank. ---*/
+
+  SU2_MPI::Allreduce(dist.data(), minDist.data(), nProbe, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
+
+  vector<int> owner(nProbe), ownerMin(nProbe);
+  for (auto iProbe = 0ul; iProbe < nProbe; iProbe++)
+    owner[iProbe] = (dist[iProbe] == minDist[iProbe])? rank : size;
+
+  SU2_MPI::Allreduce(owner.data(), ownerMin.data(), nProbe, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+
+  for (auto iProbe = 0ul; iProbe < nProbe; iProbe++) {
+    if (ownerMin[iProbe] == rank) {
+      probeOfRank.push_back(iProbe);
+      pointOfProbe.push_back(nearest[iProbe]);
+    }
+  }
+}
+
+CProbeOutput::~CProbeOutput() { Flush(); }
+
+void CProbeOutput::Sample(CSolver **solver, const CConfig *config, unsigned long iter) {
+
+  if ((nProbe == 0) || (solver[FLOW_SOL] == nullptr)) return;
+
+  auto* nodes = solver[FLOW_SOL]->GetNodes();
+  const auto nVar = solver[FLOW_SOL]->GetnVar();
+
+  if (nVarSample == 0) {
+    /*--- Record layout: probe index, iteration, time, pressure, solution. ---*/
+    nVarSample = 4 + nVar;
+    sampleBuf.reserve(probeOfRank.size() * nVarSample * flushFreq);
+  }
+
+  const passivedouble time = SU2_TYPE::GetValue(config->GetCurrent_UnstTime());
+
+  for (auto iLocal = 0ul; iLocal < probeOfRank.size(); iLocal++) {
+    const auto iPoint = pointOfProbe[iLocal];
+
+    sampleBuf.push_back(passivedouble(probeOfRank[iLocal]));
+    sampleBuf.push_back(passivedouble(iter));
+    sampleBuf.push_back(time);
+    sampleBuf.push_back(SU2_TYPE::GetValue(nodes->GetPressure(iPoint)));
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      sampleBuf.push_back(SU2_TYPE::GetValue(nodes->GetSolution(iPoint, iVar)));
+  }
+
+  /*--- The flush is collective, nSampled counts steps and is therefore
+   identical on every rank, also on those that own no probe. ---*/
+
+  nSampled++;
+  if (nSampled >= flushFreq) Flush();
+}
+
+void CProbeOutput::Flush() {
+
+  if ((nProbe == 0) || (nVarSample == 0)) return;
+
+  /*--- Gather the buffered records on the master rank and append them in one
+   write, each record carries its probe index and iteration so the order in
+   the file does not matter. ---*/
+
+  if (rank == MASTER_NODE) {
+    ofstream file;
+    if (!headerWritten) {
+      file.open(fileName.c_str(), ios::out | ios::binary);
+
+      const char magic[8] = {'S','U','2','P','R','O','B','E'};
+      const unsigned long header[3] = {nProbe, nDim, nVarSample};
+      file.write(magic, sizeof(magic));
+      file.write(reinterpret_cast<const char*>(header), sizeof(header));
+      file.write(reinterpret_cast<const char*>(probeCoords.data()),
+                 probeCoords.size()*sizeof(passivedouble));
+      headerWritten = true;
+    }
+    else {
+      file.open(fileName.c_str(), ios::out | ios::binary | ios::app);
+    }
+
+    file.write(reinterpret_cast<const char*>(sampleBuf.data()),
+               sampleBuf.size()*sizeof(passivedouble));
+
+    vector<passivedouble> recvBuf;
+    for (int iRank = 1; iRank < size; iRank++) {
+      unsigned long count = 0;
+      SU2_MPI::Status status;
+      SU2_MPI::Recv(&count, 1, MPI_UNSIGNED_LONG, iRank, 0, SU2_MPI::GetComm(), &status);
+      if (count == 0) continue;
+
+      recvBuf.resize(count);
+      SU2_MPI::Recv(recvBuf.data(), int(count), MPI_DOUBLE, iRank, 1, SU2_MPI::GetComm(), &status);
+      file.write(reinterpret_cast<const char*>(recvBuf.data()), count*sizeof(passivedouble));
+    }
+    file.close();
+  }
+  else {
+    unsigned long count = sampleBuf.size();
+    SU2_MPI::Send(&count, 1, MPI_UNSIGNED_LONG, MASTER_NODE, 0, SU2_MPI::GetComm());
+    if (count > 0)
+      SU2_MPI::Send(sampleBuf.data(), int(count), MPI_DOUBLE, MASTER_NODE, 1, SU2_MPI::GetComm());
+  }
+
+  sampleBuf.clear();
+  nSampled = 0;
+}
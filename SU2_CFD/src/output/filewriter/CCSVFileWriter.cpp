@@ -27,6 +27,7 @@
 
 #include "../../../include/output/filewriter/CCSVFileWriter.hpp"
 #include "../../../include/output/filewriter/CParallelDataSorter.hpp"
+#include <cstdio>
 
 CCSVFileWriter::CCSVFileWriter(string valFileName, CParallelDataSorter *valDataSorter) :
   CFileWriter(std::move(valFileName), valDataSorter, std::move(".csv")){}
@@ -57,7 +58,6 @@ void CCSVFileWriter::Write_Data(){
   const vector<string> fieldNames = dataSorter->GetFieldNames();
 
   ofstream Surf_file;
-  Surf_file.precision(15);
 
   /*--- Find the max number of surface vertices among all
    partitions so we can set up buffers. The master node will handle
@@ -131,7 +131,21 @@ void CCSVFileWriter::Write_Data(){
     }
     Surf_file << "\"" << fieldNames[fieldNames.size()-1] << "\"" << endl;
 
-    /*--- Loop through all of the collected data and write each node's values ---*/
+    /*--- Loop through all of the collected data and write each node's values.
+     The lines are formatted with snprintf into a large in-memory buffer that
+     is written with a single stream operation, per-value iostream formatting
+     dominates the writing time of small surfaces. ---*/
+
+    unsigned long totalVertex = 0;
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
+      totalVertex += Buffer_Recv_nVertex[iProcessor];
+
+    /*--- Rough estimate, 24 characters per formatted value. ---*/
+
+    string writeBuffer;
+    writeBuffer.reserve(totalVertex*(fieldNames.size()+1)*24);
+
+    char valBuffer[64];
 
     for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
       for (iPoint = 0; iPoint < Buffer_Recv_nVertex[iProcessor]; iPoint++) {
@@ -142,7 +156,8 @@ void CCSVFileWriter::Write_Data(){
 
         /*--- Write global index values. ---*/
 
-        Surf_file << bufL_Recv[index] << ", ";
+        snprintf(valBuffer, sizeof(valBuffer), "%lu, ", bufL_Recv[index]);
+        writeBuffer += valBuffer;
 
         /*--- Reset index for solution data access. ---*/
 
@@ -152,14 +167,17 @@ void CCSVFileWriter::Write_Data(){
         /*--- Write the solution data for each field variable. ---*/
 
         for (iVar = 0; iVar < fieldNames.size(); iVar++){
-          Surf_file << scientific << bufD_Recv[index + iVar];
-          if (iVar != fieldNames.size() -1) Surf_file << ", ";
+          snprintf(valBuffer, sizeof(valBuffer), "%.15e", SU2_TYPE::GetValue(bufD_Recv[index + iVar]));
+          writeBuffer += valBuffer;
+          if (iVar != fieldNames.size() -1) writeBuffer += ", ";
         }
-        Surf_file << endl;
+        writeBuffer += '\n';
 
       }
     }
 
+    Surf_file << writeBuffer;
+
     /*--- Close the file. ---*/
 
     Surf_file.close();
@@ -78,23 +78,33 @@ void CParaviewFileWriter::Write_Data(){
   SU2_MPI::Barrier(SU2_MPI::GetComm());
 #endif
 
+  /*--- Format each section of this rank into an in-memory buffer before taking
+   *    our turn on the file. All ranks format their text concurrently while
+   *    waiting for the ranks ahead of them, and formatting with snprintf into a
+   *    buffer is much cheaper than the per-value stream insertions (sentry,
+   *    locale) that used to run inside the critical turn. ---*/
+
+  string buf;
+
   /*--- Each processor opens the file. ---*/
 
   Paraview_File.open(fileName.c_str(), ios::out | ios::app);
 
   /*--- Write surface and volumetric point coordinates. ---*/
 
+  buf.reserve(dataSorter->GetnPoints()*3*15);
+  for (iPoint = 0; iPoint < dataSorter->GetnPoints(); iPoint++) {
+    for (iDim = 0; iDim < nDim; iDim++)
+      AppendScientific(buf, dataSorter->GetData(iDim, iPoint));
+    if (nDim == 2) buf += "0.0\t";
+  }
+
   for (iProcessor = 0; iProcessor < size; iProcessor++) {
     if (rank == iProcessor) {
 
       /*--- Write the node data from this proc ---*/
 
-
-      for (iPoint = 0; iPoint < dataSorter->GetnPoints(); iPoint++) {
-        for (iDim = 0; iDim < nDim; iDim++)
-          Paraview_File << scientific << dataSorter->GetData(iDim, iPoint) << "\t";
-        if (nDim == 2) Paraview_File << scientific << "0.0" << "\t";
-      }
+      Paraview_File.write(buf.data(), buf.size());
     }
 
     Paraview_File.flush();
@@ -127,72 +137,30 @@ void CParaviewFileWriter::Write_Data(){
   SU2_MPI::Barrier(SU2_MPI::GetComm());
 #endif
 
-  /*--- Write connectivity data. ---*/
-
-  for (iProcessor = 0; iProcessor < size; iProcessor++) {
-    if (rank == iProcessor) {
-
-
-      for (iElem = 0; iElem < nParallel_Line; iElem++) {
-        Paraview_File << N_POINTS_LINE << "\t";
-        Paraview_File << dataSorter->GetElem_Connectivity(LINE, iElem, 0)-1 << "\t";
-        Paraview_File << dataSorter->GetElem_Connectivity(LINE, iElem, 1)-1 << "\t";
-      }
-
-      for (iElem = 0; iElem < nParallel_Tria; iElem++) {
-        Paraview_File << N_POINTS_TRIANGLE << "\t";
-        Paraview_File <<  dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 0)-1 << "\t";
-        Paraview_File <<  dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 1)-1 << "\t";
-        Paraview_File <<  dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 2)-1 << "\t";
-      }
-
-      for (iElem = 0; iElem < nParallel_Quad; iElem++) {
-        Paraview_File << N_POINTS_QUADRILATERAL << "\t";
-        Paraview_File <<  dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 0)-1 << "\t";
-        Paraview_File <<  dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 1)-1 << "\t";
-        Paraview_File <<  dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 2)-1 << "\t";
-        Paraview_File <<  dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 3)-1 << "\t";
-      }
-
+  /*--- Write connectivity data, each element is preceded by its node count and
+   *    the node indices are zero-based in the vtk format. ---*/
 
-      for (iElem = 0; iElem < nParallel_Tetr; iElem++) {
-        Paraview_File << N_POINTS_TETRAHEDRON << "\t";
-        Paraview_File << dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 0)-1 << "\t"
-                      << dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 1)-1 << "\t";
-        Paraview_File << dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 2)-1 << "\t"
-                      << dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 3)-1 << "\t";
-      }
+  auto appendConn = [&](GEO_TYPE type, unsigned long nElem, unsigned short nNode) {
+    for (unsigned long jElem = 0; jElem < nElem; jElem++) {
+      AppendInteger(buf, nNode);
+      for (unsigned short iNode = 0; iNode < nNode; iNode++)
+        AppendInteger(buf, dataSorter->GetElem_Connectivity(type, jElem, iNode)-1);
+    }
+  };
 
-      for (iElem = 0; iElem < nParallel_Hexa; iElem++) {
-        Paraview_File << N_POINTS_HEXAHEDRON << "\t";
-        Paraview_File << dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 0)-1 << "\t"
-                      << dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 1)-1 << "\t";
-        Paraview_File << dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 2)-1 << "\t"
-                      << dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 3)-1 << "\t";
-        Paraview_File << dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 4)-1 << "\t"
-                      << dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 5)-1 << "\t";
-        Paraview_File << dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 6)-1 << "\t"
-                      << dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 7)-1 << "\t";
-      }
+  buf.clear();
+  appendConn(LINE, nParallel_Line, N_POINTS_LINE);
+  appendConn(TRIANGLE, nParallel_Tria, N_POINTS_TRIANGLE);
+  appendConn(QUADRILATERAL, nParallel_Quad, N_POINTS_QUADRILATERAL);
+  appendConn(TETRAHEDRON, nParallel_Tetr, N_POINTS_TETRAHEDRON);
+  appendConn(HEXAHEDRON, nParallel_Hexa, N_POINTS_HEXAHEDRON);
+  appendConn(PRISM, nParallel_Pris, N_POINTS_PRISM);
+  appendConn(PYRAMID, nParallel_Pyra, N_POINTS_PYRAMID);
 
-      for (iElem = 0; iElem < nParallel_Pris; iElem++) {
-        Paraview_File << N_POINTS_PRISM << "\t";
-        Paraview_File << dataSorter->GetElem_Connectivity(PRISM, iElem, 0)-1 << "\t"
-                      << dataSorter->GetElem_Connectivity(PRISM, iElem, 1)-1 << "\t";
-        Paraview_File << dataSorter->GetElem_Connectivity(PRISM, iElem, 2)-1 << "\t"
-                      << dataSorter->GetElem_Connectivity(PRISM, iElem, 3)-1 << "\t";
-        Paraview_File << dataSorter->GetElem_Connectivity(PRISM, iElem, 4)-1 << "\t"
-                      << dataSorter->GetElem_Connectivity(PRISM, iElem, 5)-1 << "\t";
-      }
+  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+    if (rank == iProcessor) {
 
-      for (iElem = 0; iElem < nParallel_Pyra; iElem++) {
-        Paraview_File << N_POINTS_PYRAMID << "\t";
-        Paraview_File << dataSorter->GetElem_Connectivity(PYRAMID, iElem, 0)-1 << "\t"
-                      << dataSorter->GetElem_Connectivity(PYRAMID, iElem, 1)-1 << "\t";
-        Paraview_File << dataSorter->GetElem_Connectivity(PYRAMID, iElem, 2)-1 << "\t"
-                      << dataSorter->GetElem_Connectivity(PYRAMID, iElem, 3)-1 << "\t";
-        Paraview_File << dataSorter->GetElem_Connectivity(PYRAMID, iElem, 4)-1 << "\t";
-      }
+      Paraview_File.write(buf.data(), buf.size());
 
     }    Paraview_File.flush();
 #ifdef HAVE_MPI
@@ -212,15 +180,18 @@ void CParaviewFileWriter::Write_Data(){
   SU2_MPI::Barrier(SU2_MPI::GetComm());
 #endif
 
+  buf.clear();
+  for (iElem = 0; iElem < nParallel_Line; iElem++) buf += "3\t";
+  for (iElem = 0; iElem < nParallel_Tria; iElem++) buf += "5\t";
+  for (iElem = 0; iElem < nParallel_Quad; iElem++) buf += "9\t";
+  for (iElem = 0; iElem < nParallel_Tetr; iElem++) buf += "10\t";
+  for (iElem = 0; iElem < nParallel_Hexa; iElem++) buf += "12\t";
+  for (iElem = 0; iElem < nParallel_Pris; iElem++) buf += "13\t";
+  for (iElem = 0; iElem < nParallel_Pyra; iElem++) buf += "14\t";
+
   for (iProcessor = 0; iProcessor < size; iProcessor++) {
     if (rank == iProcessor) {
-      for (iElem = 0; iElem < nParallel_Line; iElem++) Paraview_File << "3\t";
-      for (iElem = 0; iElem < nParallel_Tria; iElem++) Paraview_File << "5\t";
-      for (iElem = 0; iElem < nParallel_Quad; iElem++) Paraview_File << "9\t";
-      for (iElem = 0; iElem < nParallel_Tetr; iElem++) Paraview_File << "10\t";
-      for (iElem = 0; iElem < nParallel_Hexa; iElem++) Paraview_File << "12\t";
-      for (iElem = 0; iElem < nParallel_Pris; iElem++) Paraview_File << "13\t";
-      for (iElem = 0; iElem < nParallel_Pyra; iElem++) Paraview_File << "14\t";
+      Paraview_File.write(buf.data(), buf.size());
     }
     Paraview_File.flush();
 #ifdef HAVE_MPI
@@ -293,16 +264,20 @@ void CParaviewFileWriter::Write_Data(){
 
       /*--- Write surface and volumetric point coordinates. ---*/
 
+      buf.clear();
+      for (iPoint = 0; iPoint < dataSorter->GetnPoints(); iPoint++) {
+        AppendScientific(buf, dataSorter->GetData(VarCounter+0, iPoint));
+        AppendScientific(buf, dataSorter->GetData(VarCounter+1, iPoint));
+        if (nDim == 3) AppendScientific(buf, dataSorter->GetData(VarCounter+2, iPoint));
+        if (nDim == 2) buf += "0.0\t";
+      }
+
       for (iProcessor = 0; iProcessor < size; iProcessor++) {
         if (rank == iProcessor) {
 
           /*--- Write the node data from this proc ---*/
 
-          for (iPoint = 0; iPoint < dataSorter->GetnPoints(); iPoint++) {
-            Paraview_File << scientific << dataSorter->GetData(VarCounter+0, iPoint) << "\t" << dataSorter->GetData(VarCounter+1, iPoint) << "\t";
-            if (nDim == 3) Paraview_File << scientific << dataSorter->GetData(VarCounter+2, iPoint) << "\t";
-            if (nDim == 2) Paraview_File << scientific << "0.0" << "\t";
-          }
+          Paraview_File.write(buf.data(), buf.size());
         }
 
         Paraview_File.flush();
@@ -328,14 +303,17 @@ void CParaviewFileWriter::Write_Data(){
 
       /*--- Write surface and volumetric point coordinates. ---*/
 
+      buf.clear();
+      for (iPoint = 0; iPoint < dataSorter->GetnPoints(); iPoint++) {
+        AppendScientific(buf, dataSorter->GetData(VarCounter, iPoint));
+      }
+
       for (iProcessor = 0; iProcessor < size; iProcessor++) {
         if (rank == iProcessor) {
 
           /*--- Write the node data from this proc ---*/
 
-          for (iPoint = 0; iPoint < dataSorter->GetnPoints(); iPoint++) {
-            Paraview_File << scientific << dataSorter->GetData(VarCounter, iPoint) << "\t";
-          }
+          Paraview_File.write(buf.data(), buf.size());
 
         }
         Paraview_File.flush();
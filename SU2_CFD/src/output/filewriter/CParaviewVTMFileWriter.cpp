@@ -35,9 +35,10 @@
 const string CParaviewVTMFileWriter::fileExt = ".vtm";
 
 CParaviewVTMFileWriter::CParaviewVTMFileWriter(string valFileName, string valFolderName, su2double valTime,
-                                               unsigned short valiZone, unsigned short valnZone)
+                                               unsigned short valiZone, unsigned short valnZone, bool valAggregated)
   : CFileWriter(std::move(valFileName), fileExt),
-    folderName(std::move(valFolderName)), iZone(valiZone), nZone(valnZone), curTime(valTime){
+    folderName(std::move(valFolderName)), iZone(valiZone), nZone(valnZone), curTime(valTime),
+    aggregated(valAggregated){
 
   if (rank == MASTER_NODE){
 #if defined(_WIN32) || defined(_WIN64) || defined (__WINDOWS__)
@@ -58,19 +59,35 @@ CParaviewVTMFileWriter::~CParaviewVTMFileWriter(){
 
 }
 
+void CParaviewVTMFileWriter::SetCurrentZone(unsigned short valiZone){
+
+  /*--- In aggregated mode one writer is shared by all zones, set the zone
+   * the following datasets belong to and make sure its folder exists ---*/
+
+  iZone = valiZone;
+
+  if (rank == MASTER_NODE){
+#if defined(_WIN32) || defined(_WIN64) || defined (__WINDOWS__)
+    _mkdir((folderName + "/zone_" + to_string(iZone)).c_str());
+#else
+    mkdir((folderName + "/zone_" + to_string(iZone)).c_str(), 0777);
+#endif
+  }
+}
+
 void CParaviewVTMFileWriter::Write_Data(){
 
-  /*--- If we are in the first zone, create new file and write the file header,
-   * otherwise append to already existing file ---*/
+  /*--- If we are in the first zone (or write all zones in one pass), create new
+   * file and write the file header, otherwise append to already existing file ---*/
 
   if (rank == MASTER_NODE){
     ofstream multiBlockFile;
-    if (iZone == 0)
+    if (aggregated || iZone == 0)
       multiBlockFile.open (fileName.c_str());
     else
       multiBlockFile.open(fileName.c_str(), ios::app);
 
-    if (iZone == 0){
+    if (aggregated || iZone == 0){
       multiBlockFile << "<VTKFile type=\"vtkMultiBlockDataSet\" version=\"1.0\">" << endl;
       multiBlockFile << "<vtkMultiBlockDataSet>" << endl;
     }
@@ -79,9 +96,10 @@ void CParaviewVTMFileWriter::Write_Data(){
 
     multiBlockFile << output.str();
 
-    /*--- If we are in the last zone, write the additional data and close all blocks ---*/
+    /*--- If we are in the last zone (or write all zones in one pass),
+     * write the additional data and close all blocks ---*/
 
-    if (iZone == nZone-1){
+    if (aggregated || iZone == nZone-1){
       multiBlockFile << "</vtkMultiBlockDataSet>" << endl;
       multiBlockFile << "<FieldData>" << endl;
       multiBlockFile << "<DataArray type='Float32' Name='TimeValue'>" << endl;
@@ -29,8 +29,11 @@
 
 const string CSU2BinaryFileWriter::fileExt = ".dat";
 
-CSU2BinaryFileWriter::CSU2BinaryFileWriter(string valFileName, CParallelDataSorter *valDataSorter)  :
-  CFileWriter(std::move(valFileName), valDataSorter, fileExt){}
+CSU2BinaryFileWriter::CSU2BinaryFileWriter(string valFileName, CParallelDataSorter *valDataSorter,
+                                           bool valSinglePrec, const vector<passivedouble>* valKeyframe,
+                                           string valKeyframeName)  :
+  CFileWriter(std::move(valFileName), valDataSorter, fileExt), singlePrec(valSinglePrec),
+  keyframe(valKeyframe), keyframeName(std::move(valKeyframeName)){}
 
 
 CSU2BinaryFileWriter::~CSU2BinaryFileWriter(){
@@ -39,6 +42,13 @@ CSU2BinaryFileWriter::~CSU2BinaryFileWriter(){
 
 void CSU2BinaryFileWriter::Write_Data(){
 
+  /*--- Write only the differences against the keyframe when delta encoding. ---*/
+
+  if (keyframe != nullptr) {
+    WriteDeltaData();
+    return;
+  }
+
   /*--- Local variables ---*/
 
   unsigned short iVar;
@@ -53,10 +63,11 @@ void CSU2BinaryFileWriter::Write_Data(){
   /*--- Prepare the first ints containing the counts. The first is a
    magic number that we can use to check for binary files (it is the hex
    representation for "SU2"). The second two values are number of variables
-   and number of points (DoFs). ---*/
+   and number of points (DoFs). The fourth flags a single precision
+   data section (0 indicates the original double precision format). ---*/
 
   int var_buf_size = 5;
-  int var_buf[5] = {535532, nVar, (int)nPoint_Global, 0, 0};
+  int var_buf[5] = {535532, nVar, (int)nPoint_Global, singlePrec? 1 : 0, 0};
 
   /*--- Open the file using MPI I/O ---*/
 
@@ -79,14 +90,118 @@ void CSU2BinaryFileWriter::Write_Data(){
 
   /*--- Compute various data sizes --- */
 
-  unsigned long sizeInBytesPerPoint = sizeof(passivedouble)*nVar;
+  unsigned long sizeofElem          = singlePrec? sizeof(float) : sizeof(passivedouble);
+  unsigned long sizeInBytesPerPoint = sizeofElem*nVar;
   unsigned long sizeInBytesLocal    = sizeInBytesPerPoint*nParallel_Poin;
   unsigned long sizeInBytesGlobal   = sizeInBytesPerPoint*nPoint_Global;
   unsigned long offsetInBytes       = sizeInBytesPerPoint*dataSorter->GetnPointCumulative(rank);
 
-  /*--- Collectively write the actual data to file ---*/
+  /*--- Collectively write the actual data to file, demoting it first if the
+   single precision format was requested (halves size and write volume). ---*/
+
+  if (singlePrec) {
+    const passivedouble* data = dataSorter->GetData();
+    vector<float> buf(nVar*nParallel_Poin);
+    for (auto i = 0ul; i < buf.size(); ++i) buf[i] = static_cast<float>(data[i]);
+
+    WriteMPIBinaryDataAll(buf.data(), sizeInBytesLocal, sizeInBytesGlobal, offsetInBytes);
+  }
+  else {
+    WriteMPIBinaryDataAll(dataSorter->GetData(), sizeInBytesLocal, sizeInBytesGlobal, offsetInBytes);
+  }
+
+  /*--- Close the file ---*/
+
+  CloseMPIFile();
+
+}
+
+void CSU2BinaryFileWriter::WriteDeltaData(){
+
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+  unsigned short nVar = fieldNames.size();
+  unsigned long nParallel_Poin = dataSorter->GetnPoints();
+  unsigned long nPoint_Global = dataSorter->GetnPointsGlobal();
+
+  char str_buf[CGNS_STRING_SIZE];
+
+  /*--- Gather the sparse differences against the keyframe snapshot. The
+   comparison is made in the precision that is written, so that entries that
+   only differ below it are not stored. Indices are ascending global flat
+   positions (point*nVar+var) into the data section of the keyframe. ---*/
+
+  const passivedouble* data = dataSorter->GetData();
+  const unsigned long nLocal = nVar*nParallel_Poin;
+  const unsigned long offsetIdx = dataSorter->GetnPointCumulative(rank)*nVar;
+
+  vector<unsigned long> deltaIdx;
+  vector<passivedouble> deltaVal;
+  vector<float> deltaValF;
+
+  for (auto i = 0ul; i < nLocal; ++i) {
+    if (singlePrec) {
+      const float val = static_cast<float>(data[i]);
+      if (val != static_cast<float>((*keyframe)[i])) {
+        deltaIdx.push_back(offsetIdx + i);
+        deltaValF.push_back(val);
+      }
+    }
+    else if (data[i] != (*keyframe)[i]) {
+      deltaIdx.push_back(offsetIdx + i);
+      deltaVal.push_back(data[i]);
+    }
+  }
+
+  /*--- Size and offset of this rank's entries within the file sections. ---*/
+
+  unsigned long nEntries = deltaIdx.size(), nEntriesGlobal = 0, offsetEntries = 0;
+
+  vector<unsigned long> allEntries(size);
+  SU2_MPI::Allgather(&nEntries, 1, MPI_UNSIGNED_LONG, allEntries.data(), 1,
+                     MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+  for (int iRank = 0; iRank < size; ++iRank) {
+    if (iRank < rank) offsetEntries += allEntries[iRank];
+    nEntriesGlobal += allEntries[iRank];
+  }
+
+  /*--- The header mirrors the one of a full restart with a different magic
+   number, so that readers (and older versions of the code) can tell the
+   formats apart. ---*/
+
+  int var_buf_size = 5;
+  int var_buf[5] = {MAGIC_DELTA, nVar, (int)nPoint_Global, singlePrec? 1 : 0, 0};
+
+  /*--- Open the file using MPI I/O and write the header and variable names
+   exactly like the full restart format. ---*/
+
+  OpenMPIFile();
+
+  WriteMPIBinaryData(var_buf, var_buf_size*sizeof(int), MASTER_NODE);
+
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+    strncpy(str_buf, fieldNames[iVar].c_str(), CGNS_STRING_SIZE);
+    WriteMPIBinaryData(str_buf, CGNS_STRING_SIZE*sizeof(char), MASTER_NODE);
+  }
+
+  /*--- Record the keyframe this delta reconstructs from, and the number of
+   sparse entries that follow. ---*/
+
+  char kf_buf[KEYFRAME_NAME_SIZE] = {};
+  strncpy(kf_buf, keyframeName.c_str(), KEYFRAME_NAME_SIZE-1);
+  WriteMPIBinaryData(kf_buf, KEYFRAME_NAME_SIZE*sizeof(char), MASTER_NODE);
+
+  WriteMPIBinaryData(&nEntriesGlobal, sizeof(unsigned long), MASTER_NODE);
+
+  /*--- Collectively write the index section followed by the value section. ---*/
+
+  WriteMPIBinaryDataAll(deltaIdx.data(), nEntries*sizeof(unsigned long),
+                        nEntriesGlobal*sizeof(unsigned long), offsetEntries*sizeof(unsigned long));
+
+  const unsigned long sizeofElem = singlePrec? sizeof(float) : sizeof(passivedouble);
+  const void* values = singlePrec? static_cast<const void*>(deltaValF.data())
+                                 : static_cast<const void*>(deltaVal.data());
 
-  WriteMPIBinaryDataAll(dataSorter->GetData(), sizeInBytesLocal, sizeInBytesGlobal, offsetInBytes);
+  WriteMPIBinaryDataAll(values, nEntries*sizeofElem, nEntriesGlobal*sizeofElem, offsetEntries*sizeofElem);
 
   /*--- Close the file ---*/
 
@@ -67,6 +67,23 @@ void CSurfaceFVMDataSorter::SortOutputData() {
   const unsigned long nElemTria = GetnElem(TRIANGLE);
   const unsigned long nElemQuad = GetnElem(QUADRILATERAL);
 
+  /*--- If the sorted surface layout of a previous write is still valid
+   (static mesh, same markers), the communication of the point lists and
+   the renumbering can be skipped entirely. We only refresh the field data
+   for the cached set of surface points, reusing the data buffer that was
+   sized during the first sort. ---*/
+
+  if (layoutCached) {
+
+    for (int jj = 0; jj < VARS_PER_POINT; jj++) {
+      for (iPoint = 0; iPoint < nPoints; iPoint++) {
+        dataBuffer[iPoint*VARS_PER_POINT + jj] = volumeSorter->GetData(jj, surfIndex[iPoint]);
+      }
+    }
+
+    return;
+  }
+
   /*--- Prepare to check and communicate the nodes that each proc has
    locally from the surface connectivity. ---*/
 
@@ -393,6 +410,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
 
   nPoints = 0;
   Renumber2Global.clear();
+  surfIndex.clear();
 
   for (iPoint = 0; iPoint < volumeSorter->GetnPoints(); iPoint++) {
     if (surfPoint[iPoint] != -1) {
@@ -401,6 +419,11 @@ void CSurfaceFVMDataSorter::SortOutputData() {
 
       Renumber2Global[nPoints] = surfPoint[iPoint];
 
+      /*--- Remember the local volume-sorter index so that repeated writes
+       can re-extract the field data without rebuilding the mask. ---*/
+
+      surfIndex.push_back(iPoint);
+
       /*--- Increment total number of surface points found locally. ---*/
 
       nPoints++;
@@ -1065,6 +1088,12 @@ void CSurfaceFVMDataSorter::SortOutputData() {
   delete [] nElem_Flag;
   delete [] Local_Halo;
 
+  /*--- The layout (communication pattern, renumbering, and renumbered
+   connectivity) is now complete and can be reused by subsequent writes
+   as long as the connectivity is not sorted again. ---*/
+
+  layoutCached = true;
+
 }
 
 void CSurfaceFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometry, bool val_sort) {
@@ -1085,6 +1114,16 @@ void CSurfaceFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometr
 
 void CSurfaceFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometry, const vector<string> &markerList) {
 
+  /*--- For static meshes the surface connectivity does not change between
+   writes, so the layout cached by a previous call to SortOutputData (which
+   renumbered the connectivity in place) can be reused as is. ---*/
+
+  if (layoutCached && !config->GetDynamic_Grid() && !config->GetDeform_Mesh() &&
+      (markerList == cachedMarkerList)) return;
+
+  layoutCached = false;
+  cachedMarkerList = markerList;
+
   /*--- Sort connectivity for each type of element (excluding halos). Note
    In these routines, we sort the connectivity into a linear partitioning
    across all processors based on the global index of the grid nodes. ---*/
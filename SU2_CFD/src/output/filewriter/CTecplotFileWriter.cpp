@@ -45,7 +45,7 @@ void CTecplotFileWriter::Write_Data(){
 
   unsigned short iVar;
 
-  unsigned long iPoint, iElem;
+  unsigned long iPoint;
 
   int iProcessor;
 
@@ -121,6 +121,46 @@ void CTecplotFileWriter::Write_Data(){
   SU2_MPI::Barrier(SU2_MPI::GetComm());
 #endif
 
+  /*--- Format the node data and the connectivity of this rank into in-memory
+   *    buffers before taking our turn on the file. All ranks format their text
+   *    concurrently while waiting for the ranks ahead of them, and formatting
+   *    with snprintf into a buffer is much cheaper than the per-value stream
+   *    insertions (sentry, locale) that used to run inside the critical turn. ---*/
+
+  string dataBuf;
+  dataBuf.reserve(dataSorter->GetnPoints()*fieldNames.size()*15);
+
+  for (iPoint = 0; iPoint < dataSorter->GetnPoints(); iPoint++) {
+    for (iVar = 0; iVar < fieldNames.size(); iVar++)
+      AppendScientific(dataBuf, dataSorter->GetData(iVar, iPoint));
+    dataBuf += '\n';
+  }
+
+  /*--- Tecplot requires degenerate elements to be written with repeated nodes,
+   *    the node sequence of each supported element type encodes this. ---*/
+
+  auto appendConn = [&](string& buf, GEO_TYPE type, unsigned long nElem,
+                        const vector<unsigned short>& nodeSeq) {
+    for (unsigned long jElem = 0; jElem < nElem; jElem++) {
+      for (size_t iNode = 0; iNode < nodeSeq.size(); iNode++) {
+        const char sep = (iNode+1 == nodeSeq.size())? '\n' : '\t';
+        AppendInteger(buf, dataSorter->GetElem_Connectivity(type, jElem, nodeSeq[iNode]), sep);
+      }
+    }
+  };
+
+  string connBuf;
+  connBuf.reserve((nParallel_Line + nParallel_Tria + nParallel_Quad + 2*(nParallel_Tetr +
+                   nParallel_Hexa + nParallel_Pris + nParallel_Pyra))*4*8);
+
+  appendConn(connBuf, LINE, nParallel_Line, {0,1});
+  appendConn(connBuf, TRIANGLE, nParallel_Tria, {0,1,2,2});
+  appendConn(connBuf, QUADRILATERAL, nParallel_Quad, {0,1,2,3});
+  appendConn(connBuf, TETRAHEDRON, nParallel_Tetr, {0,1,2,2,3,3,3,3});
+  appendConn(connBuf, HEXAHEDRON, nParallel_Hexa, {0,1,2,3,4,5,6,7});
+  appendConn(connBuf, PRISM, nParallel_Pris, {0,1,1,2,3,4,4,5});
+  appendConn(connBuf, PYRAMID, nParallel_Pyra, {0,1,2,3,4,4,4,4});
+
   /*--- Each processor opens the file. ---*/
 
   Tecplot_File.open(fileName.c_str(), ios::out | ios::app);
@@ -132,12 +172,7 @@ void CTecplotFileWriter::Write_Data(){
 
       /*--- Write the node data from this proc ---*/
 
-
-      for (iPoint = 0; iPoint < dataSorter->GetnPoints(); iPoint++) {
-        for (iVar = 0; iVar < fieldNames.size(); iVar++)
-          Tecplot_File << scientific << dataSorter->GetData(iVar, iPoint) << "\t";
-        Tecplot_File << endl;
-      }
+      Tecplot_File.write(dataBuf.data(), dataBuf.size());
     }
 
     Tecplot_File.flush();
@@ -152,55 +187,7 @@ void CTecplotFileWriter::Write_Data(){
   for (iProcessor = 0; iProcessor < size; iProcessor++) {
     if (rank == iProcessor) {
 
-      for (iElem = 0; iElem < nParallel_Line; iElem++) {
-        Tecplot_File << dataSorter->GetElem_Connectivity(LINE, iElem, 0) << "\t";
-        Tecplot_File << dataSorter->GetElem_Connectivity(LINE, iElem, 1)<< "\n";
-      }
-
-
-      for (iElem = 0; iElem < nParallel_Tria; iElem++) {
-        Tecplot_File << dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 0) << "\t";
-        Tecplot_File << dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 1) << "\t";
-        Tecplot_File << dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 2) << "\t";
-        Tecplot_File << dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 2) << "\n";
-      }
-
-      for (iElem = 0; iElem < nParallel_Quad; iElem++) {
-        Tecplot_File << dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 0) << "\t";
-        Tecplot_File << dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 1) << "\t";
-        Tecplot_File << dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 2) << "\t";
-        Tecplot_File << dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 3) << "\n";
-      }
-
-      for (iElem = 0; iElem < nParallel_Tetr; iElem++) {
-        Tecplot_File << dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 0) << "\t" << dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 1) << "\t";
-        Tecplot_File << dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 2) << "\t" << dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 2) << "\t";
-        Tecplot_File << dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 3) << "\t" << dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 3) << "\t";
-        Tecplot_File << dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 3) << "\t" << dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 3) << "\n";
-      }
-
-      for (iElem = 0; iElem < nParallel_Hexa; iElem++) {
-        Tecplot_File << dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 0) << "\t" << dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 1) << "\t";
-        Tecplot_File << dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 2) << "\t" << dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 3) << "\t";
-        Tecplot_File << dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 4) << "\t" << dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 5) << "\t";
-        Tecplot_File << dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 6) << "\t" << dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 7) << "\n";
-      }
-
-      for (iElem = 0; iElem < nParallel_Pris; iElem++) {
-        Tecplot_File << dataSorter->GetElem_Connectivity(PRISM, iElem, 0) << "\t" << dataSorter->GetElem_Connectivity(PRISM, iElem, 1) << "\t";
-        Tecplot_File << dataSorter->GetElem_Connectivity(PRISM, iElem, 1) << "\t" << dataSorter->GetElem_Connectivity(PRISM, iElem, 2) << "\t";
-        Tecplot_File << dataSorter->GetElem_Connectivity(PRISM, iElem, 3) << "\t" << dataSorter->GetElem_Connectivity(PRISM, iElem, 4) << "\t";
-        Tecplot_File << dataSorter->GetElem_Connectivity(PRISM, iElem, 4) << "\t" << dataSorter->GetElem_Connectivity(PRISM, iElem, 5) << "\n";
-      }
-
-      for (iElem = 0; iElem < nParallel_Pyra; iElem++) {
-        Tecplot_File << dataSorter->GetElem_Connectivity(PYRAMID, iElem, 0) << "\t" << dataSorter->GetElem_Connectivity(PYRAMID, iElem, 1) << "\t";
-        Tecplot_File << dataSorter->GetElem_Connectivity(PYRAMID, iElem, 2) << "\t" << dataSorter->GetElem_Connectivity(PYRAMID, iElem, 3) << "\t";
-        Tecplot_File << dataSorter->GetElem_Connectivity(PYRAMID, iElem, 4) << "\t" << dataSorter->GetElem_Connectivity(PYRAMID, iElem, 4) << "\t";
-        Tecplot_File << dataSorter->GetElem_Connectivity(PYRAMID, iElem, 4) << "\t" << dataSorter->GetElem_Connectivity(PYRAMID, iElem, 4) << "\n";
-      }
-
-
+      Tecplot_File.write(connBuf.data(), connBuf.size());
     }
     Tecplot_File.flush();
 #ifdef HAVE_MPI
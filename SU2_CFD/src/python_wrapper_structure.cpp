@@ -28,6 +28,8 @@
 
 #include "../include/drivers/CDriver.hpp"
 #include "../include/drivers/CSinglezoneDriver.hpp"
+#include "../include/output/COutput.hpp"
+#include "../include/output/filewriter/CParallelDataSorter.hpp"
 #include "../../Common/include/toolboxes/geometry_toolbox.hpp"
 
 void CDriver::PythonInterface_Preprocessing(CConfig **config, CGeometry ****geometry, CSolver *****solver){
@@ -659,6 +661,23 @@ void CDriver::SetFEA_Loads(unsigned short iMarker, unsigned long iVertex, passiv
 
 }
 
+void CDriver::SetMarkerFEA_Loads(unsigned short iMarker, const vector<passivedouble>& values) {
+
+  CSolver *solver = solver_container[ZONE_0][INST_0][MESH_0][FEA_SOL];
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  const unsigned long nVertex = geometry->GetnVertex(iMarker);
+
+  if (values.size() != 3*nVertex)
+    SU2_MPI::Error("Expected 3 load components per vertex of the marker.", CURRENT_FUNCTION);
+
+  for (unsigned long iVertex = 0; iVertex < nVertex; ++iVertex) {
+    const unsigned long iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    const su2double NodalForce[3] = {values[3*iVertex], values[3*iVertex+1], values[3*iVertex+2]};
+    solver->GetNodes()->Set_FlowTraction(iPoint, NodalForce);
+  }
+
+}
+
 vector<passivedouble> CDriver::GetFEA_Displacements(unsigned short iMarker, unsigned long iVertex) const {
 
   unsigned long iPoint;
@@ -683,6 +702,24 @@ vector<passivedouble> CDriver::GetFEA_Displacements(unsigned short iMarker, unsi
   return Displacements_passive;
 }
 
+vector<passivedouble> CDriver::GetMarkerFEA_Displacements(unsigned short iMarker) const {
+
+  CSolver *solver = solver_container[ZONE_0][INST_0][MESH_0][FEA_SOL];
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  const unsigned long nVertex = geometry->GetnVertex(iMarker);
+  const unsigned short nDim = geometry->GetnDim();
+
+  vector<passivedouble> Displacements(3*nVertex, 0.0);
+
+  for (unsigned long iVertex = 0; iVertex < nVertex; ++iVertex) {
+    const unsigned long iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+      Displacements[3*iVertex+iDim] = SU2_TYPE::GetValue(solver->GetNodes()->GetSolution(iPoint, iDim));
+  }
+
+  return Displacements;
+}
+
 
 vector<passivedouble> CDriver::GetFEA_Velocity(unsigned short iMarker, unsigned long iVertex) const {
 
@@ -853,6 +890,23 @@ void CDriver::SetMeshDisplacement(unsigned short iMarker, unsigned long iVertex,
 
 }
 
+void CDriver::SetMarkerMeshDisplacements(unsigned short iMarker, const vector<passivedouble>& values) {
+
+  CSolver *solver = solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL];
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  const unsigned long nVertex = geometry->GetnVertex(iMarker);
+
+  if (values.size() != 3*nVertex)
+    SU2_MPI::Error("Expected 3 displacement components per vertex of the marker.", CURRENT_FUNCTION);
+
+  for (unsigned long iVertex = 0; iVertex < nVertex; ++iVertex) {
+    const unsigned long iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    const su2double MeshDispl[3] = {values[3*iVertex], values[3*iVertex+1], values[3*iVertex+2]};
+    solver->GetNodes()->SetBound_Disp(iPoint, MeshDispl);
+  }
+
+}
+
 void CDriver::CommunicateMeshDisplacement(void) {
 
   solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->InitiateComms(geometry_container[ZONE_0][INST_0][MESH_0],
@@ -890,3 +944,128 @@ vector<passivedouble> CDriver::GetFlowLoad(unsigned short iMarker, unsigned long
   return FlowLoad_passive;
 
 }
+
+vector<passivedouble> CDriver::GetMarkerFlowLoads(unsigned short iMarker) const {
+
+  CSolver *solver = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL];
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  const unsigned long nVertex = geometry->GetnVertex(iMarker);
+  const unsigned short nDim = geometry->GetnDim();
+
+  vector<passivedouble> FlowLoads(3*nVertex, 0.0);
+
+  if (config_container[ZONE_0]->GetSolid_Wall(iMarker)) {
+    for (unsigned long iVertex = 0; iVertex < nVertex; ++iVertex) {
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+        FlowLoads[3*iVertex+iDim] = SU2_TYPE::GetValue(solver->GetVertexTractions(iMarker, iVertex, iDim));
+    }
+  }
+
+  return FlowLoads;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/* Functions related to in-situ (co-processing) output */
+////////////////////////////////////////////////////////////////////////////////
+
+void CDriver::CollectVolumeOutputData() {
+
+  /*--- Load the current solution into the volume data sorter without writing
+   any files, afterwards the sorted fields can be queried below. ---*/
+
+  output_container[ZONE_0]->Load_Data(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0],
+                                      solver_container[ZONE_0][INST_0][MESH_0]);
+}
+
+vector<string> CDriver::GetVolumeOutputFieldNames() const {
+
+  const auto* sorter = output_container[ZONE_0]->GetVolumeDataSorter();
+  if (sorter == nullptr)
+    SU2_MPI::Error("No volume output data, call CollectVolumeOutputData first.", CURRENT_FUNCTION);
+
+  return sorter->GetFieldNames();
+}
+
+unsigned long CDriver::GetVolumeOutputnPoints() const {
+
+  const auto* sorter = output_container[ZONE_0]->GetVolumeDataSorter();
+  if (sorter == nullptr)
+    SU2_MPI::Error("No volume output data, call CollectVolumeOutputData first.", CURRENT_FUNCTION);
+
+  return sorter->GetnPoints();
+}
+
+vector<passivedouble> CDriver::GetVolumeOutputField(unsigned short iField) const {
+
+  const auto* sorter = output_container[ZONE_0]->GetVolumeDataSorter();
+  if (sorter == nullptr)
+    SU2_MPI::Error("No volume output data, call CollectVolumeOutputData first.", CURRENT_FUNCTION);
+
+  /*--- The rank owns a linear partition of the global points, in the same
+   order for every field (see CParallelDataSorter). ---*/
+
+  vector<passivedouble> values(sorter->GetnPoints());
+  for (auto iPoint = 0ul; iPoint < values.size(); ++iPoint)
+    values[iPoint] = sorter->GetData(iField, iPoint);
+
+  return values;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/* Functions for the in-memory handoff of zone states between instances.      */
+////////////////////////////////////////////////////////////////////////////////
+
+vector<unsigned long> CDriver::GetZoneSolutionIndices(unsigned short iZone) const {
+
+  const auto* geometry = geometry_container[iZone][INST_0][MESH_0];
+  const auto nPointDomain = geometry->GetnPointDomain();
+
+  vector<unsigned long> indices(nPointDomain);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+    indices[iPoint] = geometry->nodes->GetGlobalIndex(iPoint);
+
+  return indices;
+}
+
+vector<passivedouble> CDriver::GetZoneSolution(unsigned short iZone, unsigned short iSolver) const {
+
+  auto* solver = solver_container[iZone][INST_0][MESH_0][iSolver];
+  if (solver == nullptr)
+    SU2_MPI::Error("The requested solver does not exist in this zone.", CURRENT_FUNCTION);
+
+  const auto nPointDomain = geometry_container[iZone][INST_0][MESH_0]->GetnPointDomain();
+  const auto nVar = solver->GetnVar();
+
+  vector<passivedouble> values(nPointDomain*nVar);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+    for (auto iVar = 0u; iVar < nVar; ++iVar)
+      values[iPoint*nVar+iVar] = SU2_TYPE::GetValue(solver->GetNodes()->GetSolution(iPoint, iVar));
+
+  return values;
+}
+
+void CDriver::SetZoneSolution(unsigned short iZone, unsigned short iSolver, const vector<passivedouble>& values) {
+
+  auto* solver = solver_container[iZone][INST_0][MESH_0][iSolver];
+  if (solver == nullptr)
+    SU2_MPI::Error("The requested solver does not exist in this zone.", CURRENT_FUNCTION);
+
+  auto* geometry = geometry_container[iZone][INST_0][MESH_0];
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const auto nVar = solver->GetnVar();
+
+  if (values.size() != nPointDomain*nVar)
+    SU2_MPI::Error("Size of the solution vector does not match owned points times variables.", CURRENT_FUNCTION);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+    for (auto iVar = 0u; iVar < nVar; ++iVar)
+      solver->GetNodes()->SetSolution(iPoint, iVar, values[iPoint*nVar+iVar]);
+
+  /*--- Update the halo points so that the handoff is equivalent to a restart read. ---*/
+
+  solver->InitiateComms(geometry, config_container[iZone], SOLUTION);
+  solver->CompleteComms(geometry, config_container[iZone], SOLUTION);
+}
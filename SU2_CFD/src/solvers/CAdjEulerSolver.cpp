@@ -3949,8 +3949,8 @@ void CAdjEulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConf
   /*--- Delete the class memory that is used to load the restart. ---*/
 
   delete [] Restart_Vars;
-  delete [] Restart_Data;
-  Restart_Vars = nullptr; Restart_Data = nullptr;
+  Restart_Vars = nullptr;
+  FreeRestartData();
 
 }
 
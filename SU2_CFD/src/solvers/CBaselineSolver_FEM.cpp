@@ -380,8 +380,8 @@ void CBaselineSolver_FEM::LoadRestart(CGeometry **geometry, CSolver ***solver, C
   /*--- Delete the class memory that is used to load the restart. ---*/
 
   delete [] Restart_Vars;
-  delete [] Restart_Data;
-  Restart_Vars = nullptr; Restart_Data = nullptr;
+  Restart_Vars = nullptr;
+  FreeRestartData();
 
 }
 
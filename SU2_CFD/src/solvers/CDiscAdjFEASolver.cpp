@@ -47,6 +47,8 @@ CDiscAdjFEASolver::CDiscAdjFEASolver(CGeometry *geometry, CConfig *config, CSolv
   nPoint       = geometry->GetnPoint();
   nPointDomain = geometry->GetnPointDomain();
 
+  omp_chunk_size = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_SIZE);
+
   /*--- Define some auxiliary vectors related to the residual ---*/
 
   Residual_RMS.resize(nVar,1.0);
@@ -244,44 +246,70 @@ void CDiscAdjFEASolver::ExtractAdjoint_Solution(CGeometry *geometry, CConfig *co
 
   if (!config->GetMultizone_Problem()) nodes->Set_OldSolution();
 
-  /*--- Extract and store the adjoint solution ---*/
+  /*--- Thread-local residual variables. ---*/
+
+  su2double resMax[MAXNVAR] = {0.0}, resRMS[MAXNVAR] = {0.0};
+  const su2double* coordMax[MAXNVAR] = {nullptr};
+  unsigned long idxMax[MAXNVAR] = {0};
 
+  /*--- Extract and store the adjoint solution, compute the residuals. ---*/
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
   for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
     su2double Solution[MAXNVAR] = {0.0};
     direct_solver->GetNodes()->GetAdjointSolution(iPoint,Solution);
     nodes->SetSolution(iPoint,Solution);
+
+    if (iPoint < nPointDomain) {
+      for (auto iVar = 0u; iVar < nVar; iVar++) {
+        const su2double residual = Solution[iVar] - nodes->GetSolution_Old(iPoint,iVar);
+
+        /*--- Update residual information for current thread. ---*/
+        resRMS[iVar] += residual*residual;
+        if (fabs(residual) > resMax[iVar]) {
+          resMax[iVar] = fabs(residual);
+          idxMax[iVar] = iPoint;
+          coordMax[iVar] = geometry->nodes->GetCoord(iPoint);
+        }
+      }
+    }
   }
+  END_SU2_OMP_FOR
 
+  /*--- Residuals and time_n terms are not needed when evaluating multizone cross terms. ---*/
   if (CrossTerm) return;
 
+  SetResToZero();
+
+  /*--- Reduce residual information over all threads in this rank. ---*/
+  SU2_OMP_CRITICAL
+  for (auto iVar = 0u; iVar < nVar; iVar++) {
+    Residual_RMS[iVar] += resRMS[iVar];
+    AddRes_Max(iVar, resMax[iVar], geometry->nodes->GetGlobalIndex(idxMax[iVar]), coordMax[iVar]);
+  }
+  END_SU2_OMP_CRITICAL
+  SU2_OMP_BARRIER
+
+  SetResidual_RMS(geometry, config);
+
+  SU2_OMP_MASTER {
+    SetIterLinSolver(direct_solver->System.GetIterations());
+    SetResLinSolver(direct_solver->System.GetResidual());
+  }
+  END_SU2_OMP_MASTER
+
   /*--- Extract and store the adjoint solution at time n (including accel. and velocity) ---*/
 
   if (config->GetTime_Domain()) {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
     for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
       su2double Solution[MAXNVAR] = {0.0};
       direct_solver->GetNodes()->GetAdjointSolution_time_n(iPoint,Solution);
       nodes->Set_Solution_time_n(iPoint,Solution);
     }
+    END_SU2_OMP_FOR
   }
 
-  /*--- Set the residuals ---*/
-
-  SetResToZero();
-
-  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
-    for (auto iVar = 0u; iVar < nVar; iVar++){
-      su2double residual = nodes->GetSolution(iPoint, iVar) - nodes->GetSolution_Old(iPoint, iVar);
-
-      Residual_RMS[iVar] += residual*residual;
-      AddRes_Max(iVar,fabs(residual),geometry->nodes->GetGlobalIndex(iPoint),geometry->nodes->GetCoord(iPoint));
-    }
-  }
-
-  SetResidual_RMS(geometry, config);
-
-  SetIterLinSolver(direct_solver->System.GetIterations());
-  SetResLinSolver(direct_solver->System.GetResidual());
-
 }
 
 void CDiscAdjFEASolver::ExtractAdjoint_Variables(CGeometry *geometry, CConfig *config){
@@ -290,22 +318,27 @@ void CDiscAdjFEASolver::ExtractAdjoint_Variables(CGeometry *geometry, CConfig *c
 
   /*--- Sensitivities of material properties and design variables. ---*/
 
-  E.GetDerivative();
-  Nu.GetDerivative();
-  Rho.GetDerivative();
-  Rho_DL.GetDerivative();
-  if (de_effects) EField.GetDerivative();
-  if (fea_dv) DV.GetDerivative();
+  SU2_OMP_MASTER {
+    E.GetDerivative();
+    Nu.GetDerivative();
+    Rho.GetDerivative();
+    Rho_DL.GetDerivative();
+    if (de_effects) EField.GetDerivative();
+    if (fea_dv) DV.GetDerivative();
+  }
+  END_SU2_OMP_MASTER
 
   /*--- Extract the flow traction sensitivities. ---*/
 
   if (config->GetnMarker_Fluid_Load() > 0) {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
     for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++){
       for (unsigned short iDim = 0; iDim < nDim; iDim++){
         su2double val_sens = direct_solver->GetNodes()->ExtractFlowTraction_Sensitivity(iPoint,iDim);
         nodes->SetFlowTractionSensitivity(iPoint, iDim, val_sens);
       }
     }
+    END_SU2_OMP_FOR
   }
 
 }
@@ -316,11 +349,11 @@ void CDiscAdjFEASolver::SetAdjoint_Output(CGeometry *geometry, CConfig *config){
   const bool deform_mesh = (config->GetnMarker_Deform_Mesh() > 0);
   const bool multizone = config->GetMultizone_Problem();
 
-  su2double Solution[MAXNVAR] = {0.0};
-
-  unsigned short iVar;
-
+  SU2_OMP_FOR_STAT(omp_chunk_size)
   for (auto iPoint = 0ul; iPoint < nPoint; iPoint++){
+    su2double Solution[MAXNVAR] = {0.0};
+    unsigned short iVar;
+
     for (iVar = 0; iVar < nVar; iVar++)
       Solution[iVar] = nodes->GetSolution(iPoint,iVar);
 
@@ -341,6 +374,7 @@ void CDiscAdjFEASolver::SetAdjoint_Output(CGeometry *geometry, CConfig *config){
 
     direct_solver->GetNodes()->SetAdjointSolution(iPoint,Solution);
   }
+  END_SU2_OMP_FOR
 }
 
 void CDiscAdjFEASolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config_container, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output){
@@ -29,9 +29,11 @@
 #include "../../include/variables/CNSVariable.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
+#include "../../../Common/include/toolboxes/profiling_toolbox.hpp"
 #include "../../include/fluid/CIdealGas.hpp"
 #include "../../include/fluid/CVanDerWaalsGas.hpp"
 #include "../../include/fluid/CPengRobinson.hpp"
+#include "../../include/fluid/CTabulatedGas.hpp"
 #include "../../include/numerics_simd/CNumericsSIMD.hpp"
 #include "../../include/limiters/CLimiterDetails.hpp"
 
@@ -329,6 +331,28 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config,
 
   CommunicateInitialState(geometry, config);
 
+  /*--- Reduced-fidelity far field for the adjoint recording, if requested. ---*/
+
+  SetAdjointFidelityMask(geometry, config);
+
+  /*--- Synthetic eddy inflow generators, one per inlet marker. Construction is
+   *    collective (global marker bounding box), loop the config-file markers so
+   *    that ranks without a local piece of a marker still participate. ---*/
+
+  SEMInflow.resize(nMarker);
+  if ((config->GetInlet_SEM_Intensity() > 0.0) && (iMesh == MESH_0)) {
+    for (auto iMarkerCfg = 0u; iMarkerCfg < config->GetnMarker_CfgFile(); iMarkerCfg++) {
+      const auto markerTag = config->GetMarker_CfgFile_TagBound(iMarkerCfg);
+      if (config->GetMarker_CfgFile_KindBC(markerTag) != INLET_FLOW) continue;
+
+      auto generator = std::unique_ptr<CSyntheticEddyInflow>(new CSyntheticEddyInflow(geometry, config, markerTag));
+
+      for (iMarker = 0; iMarker < nMarker; iMarker++)
+        if (config->GetMarker_All_TagBound(iMarker) == markerTag)
+          SEMInflow[iMarker] = std::move(generator);
+    }
+  }
+
   /*--- Add the solver name (max 8 characters). ---*/
   SolverName = "C.FLOW";
 
@@ -1084,6 +1108,21 @@ void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMes
         break;
     }
 
+    /*--- Optionally replace the iterative equation of state inversions of the real
+     *    gas models by bilinear interpolation in a table sampled from them now. ---*/
+
+    if (config->GetTabulated_FluidModel() &&
+        ((config->GetKind_FluidModel() == VW_GAS) || (config->GetKind_FluidModel() == PR_GAS))) {
+      const su2double Energy_Ref_Tab = pow(config->GetVelocity_Ref(), 2);
+      const su2double* rhoLim = config->GetTabulated_Rho_Limits();
+      const su2double* eLim = config->GetTabulated_Energy_Limits();
+      FluidModel[thread] = new CTabulatedGas(FluidModel[thread],
+                                             rhoLim[0] / config->GetDensity_Ref(),
+                                             rhoLim[1] / config->GetDensity_Ref(),
+                                             eLim[0] / Energy_Ref_Tab, eLim[1] / Energy_Ref_Tab,
+                                             config->GetnTabulated_Points());
+    }
+
     GetFluidModel()->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
     if (viscous) {
       GetFluidModel()->SetLaminarViscosityModel(config);
@@ -1571,7 +1610,13 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   if (!Output && muscl && !center) {
 
-    /*--- Gradient computation for MUSCL reconstruction. ---*/
+    /*--- Gradient computation for MUSCL reconstruction, fused
+     *    with the limiter computation when possible. ---*/
+
+    if ((config->GetKind_Gradient_Method_Recon() == GREEN_GAUSS) && limiter && !van_albada) {
+      SetPrimitive_Gradient_Limiter(geometry, config);
+      return;
+    }
 
     switch (config->GetKind_Gradient_Method_Recon()) {
       case GREEN_GAUSS:
@@ -1596,17 +1641,43 @@ unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, c
 
   AD::StartNoSharedReading();
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
+  /*--- Process the points in batches, evaluating the thermodynamic state of each batch with a
+   *    single call into the fluid model. This avoids the per-point virtual dispatch and allows
+   *    models with closed-form states (e.g. CIdealGas) to vectorize the evaluation. ---*/
+
+  constexpr unsigned long BATCH_SIZE = 64;
+
+  su2double rho[BATCH_SIZE], energy[BATCH_SIZE], pressure[BATCH_SIZE], temperature[BATCH_SIZE],
+            soundspeed2[BATCH_SIZE], dPdrho_e[BATCH_SIZE], dPde_rho[BATCH_SIZE];
+
+  SU2_OMP_FOR_STAT(roundUpDiv(omp_chunk_size, BATCH_SIZE))
+  for (unsigned long begin = 0; begin < nPoint; begin += BATCH_SIZE) {
+
+    const auto batchSize = min(BATCH_SIZE, nPoint - begin);
+
+    /*--- Gather the inputs of the fluid model, computing the velocities on the way. ---*/
+
+    for (auto i = 0ul; i < batchSize; ++i) {
+      const auto iPoint = begin + i;
+      nodes->SetVelocity(iPoint);   // Computes velocity and velocity^2
+      rho[i] = nodes->GetDensity(iPoint);
+      energy[i] = nodes->GetEnergy(iPoint) - 0.5 * nodes->GetVelocity2(iPoint);
+    }
+
+    GetFluidModel()->ComputeTDState_rhoe(batchSize, rho, energy, pressure, temperature,
+                                         soundspeed2, dPdrho_e, dPde_rho);
 
     /*--- Compressible flow, primitive variables nDim+9, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
 
-    bool physical = nodes->SetPrimVar(iPoint, GetFluidModel());
-    nodes->SetSecondaryVar(iPoint, GetFluidModel());
+    for (auto i = 0ul; i < batchSize; ++i) {
+      const auto iPoint = begin + i;
+      bool physical = nodes->SetPrimVar(iPoint, pressure[i], temperature[i], soundspeed2[i],
+                                        dPdrho_e[i], dPde_rho[i], GetFluidModel());
 
-    /* Check for non-realizable states for reporting. */
+      /* Check for non-realizable states for reporting. */
 
-    if (!physical) nonPhysicalPoints++;
+      if (!physical) nonPhysicalPoints++;
+    }
   }
   END_SU2_OMP_FOR
 
@@ -1668,12 +1739,16 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
 void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                      CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
 
+  SU2_PROFILE_SCOPE("CEulerSolver::Centered_Residual");
+
   EdgeFluxResidual(geometry, solver_container, config);
 }
 
 void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container,
                                    CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
+  SU2_PROFILE_SCOPE("CEulerSolver::Upwind_Residual");
+
   if (config->GetUseVectorization()) {
     EdgeFluxResidual(geometry, solver_container, config);
     return;
@@ -1726,6 +1801,11 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
     auto iPoint = geometry->edges->GetNode(iEdge,0);
     auto jPoint = geometry->edges->GetNode(iEdge,1);
 
+    /*--- Skip edges inside frozen (converged) regions, neither point is updated
+     and their partial residuals are discarded before the implicit solve. ---*/
+
+    if (!ReducerStrategy && GetPointFrozen(iPoint) && GetPointFrozen(jPoint)) continue;
+
     numerics->SetNormal(geometry->edges->GetNormal(iEdge));
 
     auto Coord_i = geometry->nodes->GetCoord(iPoint);
@@ -1749,21 +1829,22 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
     auto V_i = nodes->GetPrimitive(iPoint); auto V_j = nodes->GetPrimitive(jPoint);
     auto S_i = nodes->GetSecondary(iPoint); auto S_j = nodes->GetSecondary(jPoint);
 
-    /*--- Set them with or without high order reconstruction using MUSCL strategy. ---*/
+    /*--- Set them with or without high order reconstruction using MUSCL strategy.
+     In the reduced-fidelity far field of an adjoint recording the reconstruction
+     is skipped, which keeps its operations off the tape. ---*/
 
-    if (!muscl) {
+    const bool reduced = GetPointReducedFidelity(iPoint) && GetPointReducedFidelity(jPoint);
+
+    if (!muscl || reduced) {
 
       numerics->SetPrimitive(V_i, V_j);
       numerics->SetSecondary(S_i, S_j);
 
     }
     else {
-      /*--- Reconstruction ---*/
+      /*--- Reconstruction, using the precomputed i-to-midpoint vector of the edge. ---*/
 
-      su2double Vector_ij[MAXNDIM] = {0.0};
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Vector_ij[iDim] = 0.5*(Coord_j[iDim] - Coord_i[iDim]);
-      }
+      const su2double* Vector_ij = geometry->edges->GetVector_ij(iEdge);
 
       auto Gradient_i = nodes->GetGradient_Reconstruction(iPoint);
       auto Gradient_j = nodes->GetGradient_Reconstruction(jPoint);
@@ -1993,6 +2074,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
   const bool harmonic_balance = (config->GetTime_Marching() == TIME_MARCHING::HARMONIC_BALANCE);
   const bool windgust         = config->GetWind_Gust();
   const bool body_force       = config->GetBody_Force();
+  const bool sponge           = config->GetSponge_Layer();
   const bool ideal_gas        = (config->GetKind_FluidModel() == STANDARD_AIR) ||
                                 (config->GetKind_FluidModel() == IDEAL_GAS);
   const bool rans             = (config->GetKind_Turb_Model() != TURB_MODEL::NONE);
@@ -2028,6 +2110,63 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
     AD::EndNoSharedReading();
   }
 
+  if (sponge) {
+
+    /*--- Build the compact list of points inside the sponge layer support,
+     such that the source term only visits its own support instead of the
+     whole domain. The list depends on the coordinates of the points and is
+     therefore rebuilt whenever the mesh moves. ---*/
+
+    if (!SpongeMaskValid || config->GetDynamic_Grid()) {
+      SU2_OMP_BARRIER
+      SU2_OMP_MASTER {
+        const su2double* box = config->GetSponge_Layer_Box();
+        SpongePoints.clear();
+        for (unsigned long jPoint = 0; jPoint < nPointDomain; jPoint++) {
+          bool inside = true;
+          for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+            const su2double coord = geometry->nodes->GetCoord(jPoint, iDim);
+            inside = inside && (coord >= box[iDim]) && (coord <= box[iDim+3]);
+          }
+          if (inside) SpongePoints.push_back(jPoint);
+        }
+        SpongeMaskValid = true;
+      }
+      END_SU2_OMP_MASTER
+      SU2_OMP_BARRIER
+    }
+
+    /*--- The sponge layer occupies the second source term slot. ---*/
+    CNumerics* second_numerics = numerics_container[SOURCE_SECOND_TERM + omp_get_thread_num()*MAX_TERMS];
+
+    /*--- Loop over the points of the sponge layer support ---*/
+    AD::StartNoSharedReading();
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (unsigned long i = 0; i < SpongePoints.size(); i++) {
+
+      const unsigned long jPoint = SpongePoints[i];
+
+      /*--- Load the conservative variables ---*/
+      second_numerics->SetConservative(nodes->GetSolution(jPoint),
+                                       nodes->GetSolution(jPoint));
+
+      /*--- Load the volume of the dual mesh cell ---*/
+      second_numerics->SetVolume(geometry->nodes->GetVolume(jPoint));
+
+      /*--- Compute the sponge layer source residual ---*/
+      auto residual = second_numerics->ComputeResidual(config);
+
+      /*--- Add the source residual to the total ---*/
+      LinSysRes.AddBlock(jPoint, residual);
+
+      /*--- Add the implicit Jacobian contribution ---*/
+      if (implicit) Jacobian.AddBlock2Diag(jPoint, residual.jacobian_i);
+
+    }
+    END_SU2_OMP_FOR
+    AD::EndNoSharedReading();
+  }
+
   if (rotating_frame) {
 
     /*--- Include the residual contribution from GCL due to the static
@@ -2383,6 +2522,12 @@ void CEulerSolver::ClassicalRK4_Iteration(CGeometry *geometry, CSolver **solver_
   Explicit_Iteration<CLASSICAL_RK4_EXPLICIT>(geometry, solver_container, config, iRKStep);
 }
 
+void CEulerSolver::SSPRK3_Iteration(CGeometry *geometry, CSolver **solver_container,
+                                    CConfig *config, unsigned short iRKStep) {
+
+  Explicit_Iteration<SSPRK3_EXPLICIT>(geometry, solver_container, config, iRKStep);
+}
+
 void CEulerSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
   Explicit_Iteration<EULER_EXPLICIT>(geometry, solver_container, config, 0);
@@ -4068,6 +4213,24 @@ void CEulerSolver::SetFarfield_AoA(CGeometry *geometry, CSolver **solver_contain
   }
 }
 
+void CEulerSolver::UpdateFarfieldVelocity(const CConfig *config) {
+
+  const su2double AoA = config->GetAoA()*PI_NUMBER/180.0;
+  const su2double AoS = config->GetAoS()*PI_NUMBER/180.0;
+
+  const su2double Vel_Infty_Mag = GeometryToolbox::Norm(nDim, Velocity_Inf);
+
+  if (nDim == 2) {
+    Velocity_Inf[0] = cos(AoA)*Vel_Infty_Mag;
+    Velocity_Inf[1] = sin(AoA)*Vel_Infty_Mag;
+  }
+  else {
+    Velocity_Inf[0] = cos(AoA)*cos(AoS)*Vel_Infty_Mag;
+    Velocity_Inf[1] = sin(AoS)*Vel_Infty_Mag;
+    Velocity_Inf[2] = sin(AoA)*cos(AoS)*Vel_Infty_Mag;
+  }
+}
+
 bool CEulerSolver::FixedCL_Convergence(CConfig* config, bool convergence) {
   const su2double Target_CL = config->GetTarget_CL();
   const auto curr_iter = config->GetInnerIter();
@@ -4287,9 +4450,12 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
 
   su2double *Normal = new su2double[nDim];
 
-  /*--- Loop over all the vertices on this boundary marker ---*/
+  /*--- First pass, batched construction of the ghost states of the whole marker.
+   *    This loop is pure arithmetic on local data (no virtual dispatch into the
+   *    numerics), the states are stored in CharacPrimVar and consumed by the
+   *    flux pass below. ---*/
 
-  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
     iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
@@ -4300,15 +4466,10 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
 
     if (geometry->nodes->GetDomain(iPoint)) {
 
-      /*--- Index of the closest interior node ---*/
-
-      Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
-
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
       geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
-      conv_numerics->SetNormal(Normal);
 
       /*--- Retrieve solution at the farfield boundary node ---*/
       V_domain = nodes->GetPrimitive(iPoint);
@@ -4444,7 +4605,34 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
       V_infty[nDim+2] = Density;
       V_infty[nDim+3] = Energy + Pressure/Density;
 
+    }
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Second pass, compute the fluxes with the stored ghost states. ---*/
+
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
+    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+
+    V_infty = GetCharacPrimVar(val_marker, iVertex);
+
+    /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
+
+    if (geometry->nodes->GetDomain(iPoint)) {
+
+      /*--- Index of the closest interior node ---*/
+
+      Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
 
+      /*--- Normal vector for this vertex (negate for outward convention) ---*/
+
+      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
+      conv_numerics->SetNormal(Normal);
+
+      /*--- Retrieve solution at the farfield boundary node ---*/
+      V_domain = nodes->GetPrimitive(iPoint);
 
       /*--- Set various quantities in the numerics class ---*/
 
@@ -6462,6 +6650,17 @@ void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
   bool tkeNeeded = (config->GetKind_Turb_Model() == TURB_MODEL::SST) || (config->GetKind_Turb_Model() == TURB_MODEL::SST_SUST);
   su2double *Normal = new su2double[nDim];
 
+  /*--- Convect the synthetic eddy population once per time step. ---*/
+
+  const bool semInflow = !SEMInflow.empty() && (SEMInflow[val_marker] != nullptr);
+
+  if (semInflow) {
+    SU2_OMP_MASTER
+    SEMInflow[val_marker]->UpdateEddies(config);
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+
   /*--- Loop over all the vertices on this boundary marker ---*/
 
   SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
@@ -6673,6 +6872,17 @@ void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
           break;
       }
 
+      /*--- Superpose the synthetic turbulent fluctuations on the inlet state,
+       *    keeping the total enthalpy consistent with the new kinetic energy. ---*/
+
+      if (semInflow) {
+        su2double uPrime[MAXNDIM] = {0.0};
+        const su2double VelMag2 = GeometryToolbox::SquaredNorm(nDim, &V_inlet[1]);
+        SEMInflow[val_marker]->GetFluctuation(geometry->nodes->GetCoord(iPoint), sqrt(VelMag2), uPrime);
+        for (iDim = 0; iDim < nDim; iDim++) V_inlet[iDim+1] += uPrime[iDim];
+        V_inlet[nDim+3] += 0.5*(GeometryToolbox::SquaredNorm(nDim, &V_inlet[1]) - VelMag2);
+      }
+
       /*--- Set various quantities in the solver class ---*/
 
       conv_numerics->SetPrimitive(V_domain, V_inlet);
@@ -701,12 +701,52 @@ void CFEASolver::SetInitialCondition(CGeometry **geometry, CSolver ***solver_con
   END_SU2_OMP_PARALLEL
 }
 
+void CFEASolver::BuildStiffnessScatterMap(const CGeometry *geometry) {
+
+  if (!ElemKBlocks.empty()) return;
+
+  const auto nElem = geometry->GetnElem();
+  ElemKBlockOffset.resize(nElem+1);
+  ElemKBlockOffset[0] = 0;
+
+  for (auto iElem = 0ul; iElem < nElem; ++iElem) {
+    int EL_KIND;
+    unsigned short nNodes;
+    GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+    ElemKBlockOffset[iElem+1] = ElemKBlockOffset[iElem] + nNodes*nNodes;
+  }
+
+  /*--- Search the sparse pattern once for every node pair of every element, the
+        assembly can then scatter its blocks without repeating the searches on
+        every nonlinear iteration. ---*/
+
+  ElemKBlocks.resize(ElemKBlockOffset[nElem]);
+
+  for (auto iElem = 0ul; iElem < nElem; ++iElem) {
+    int EL_KIND;
+    unsigned short nNodes;
+    GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+
+    auto* blocks = &ElemKBlocks[ElemKBlockOffset[iElem]];
+    for (auto iNode = 0u; iNode < nNodes; ++iNode) {
+      const auto iPoint = geometry->elem[iElem]->GetNode(iNode);
+      for (auto jNode = 0u; jNode < nNodes; ++jNode) {
+        const auto jPoint = geometry->elem[iElem]->GetNode(jNode);
+        *(blocks++) = Jacobian.GetBlockOffset(iPoint, jPoint);
+      }
+    }
+  }
+}
+
 void CFEASolver::Compute_StiffMatrix(CGeometry *geometry, CNumerics **numerics, const CConfig *config) {
 
   const bool topology_mode = config->GetTopology_Optimization();
   const su2double simp_exponent = config->GetSIMP_Exponent();
   const su2double simp_minstiff = config->GetSIMP_MinStiffness();
 
+  /*--- Build the element-to-Jacobian scatter map on first use. ---*/
+  BuildStiffnessScatterMap(geometry);
+
   /*--- Start OpenMP parallel region. ---*/
 
   SU2_OMP_PARALLEL
@@ -776,7 +816,7 @@ void CFEASolver::Compute_StiffMatrix(CGeometry *geometry, CNumerics **numerics,
 
           for (jNode = 0; jNode < nNodes; jNode++) {
             auto Kab = element->Get_Kab(iNode, jNode);
-            Jacobian.AddBlock(indexNode[iNode], indexNode[jNode], Kab, simp_penalty);
+            Jacobian.AddBlockAt(ElemKBlocks[ElemKBlockOffset[iElem] + iNode*nNodes + jNode], Kab, simp_penalty);
           }
 
           if (LockStrategy) omp_unset_lock(&UpdateLocks[indexNode[iNode]]);
@@ -801,6 +841,9 @@ void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CNumeri
   const su2double simp_exponent = config->GetSIMP_Exponent();
   const su2double simp_minstiff = config->GetSIMP_MinStiffness();
 
+  /*--- Build the element-to-Jacobian scatter map on first use. ---*/
+  BuildStiffnessScatterMap(geometry);
+
   /*--- Start OpenMP parallel region. ---*/
 
   SU2_OMP_PARALLEL
@@ -897,7 +940,7 @@ void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CNumeri
           for (jNode = 0; jNode < nNodes; jNode++) {
 
             /*--- Get a pointer to the matrix block to perform the update. ---*/
-            auto Kij = Jacobian.GetBlock(indexNode[iNode], indexNode[jNode]);
+            auto Kij = Jacobian.GetBlockAt(ElemKBlocks[ElemKBlockOffset[iElem] + iNode*nNodes + jNode]);
 
             /*--- Retrieve the values of the FEA term. ---*/
             auto Kab = fea_elem->Get_Kab(iNode, jNode);
@@ -3218,7 +3261,7 @@ void CFEASolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *c
   /*--- Delete the class memory that is used to load the restart. ---*/
 
   delete [] Restart_Vars; Restart_Vars = nullptr;
-  delete [] Restart_Data; Restart_Data = nullptr;
+  FreeRestartData();
 
 }
 
@@ -374,6 +374,20 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
 
     VecTotResDOFsADER.assign(nVar*nDOFsLocTot, 0.0);
     VecSolDOFsPredictorADER.resize(nTimeDOFs*nVar*nDOFsLocTot);
+
+    /*--- Precompute the product of the time integration weights, including
+          the factor 1/2 of the parameter interval [-1..1], and the time
+          interpolation matrix. The predictor step applies this combination
+          for every element in every iteration, only the time step of the
+          element is still missing from the combined weights. ---*/
+    const unsigned short nTimeIntegrationPoints = config->GetnTimeIntegrationADER_DG();
+    const su2double     *timeIntegrationWeights = config->GetWeightsIntegrationADER_DG();
+
+    timeInterpolTimesWeightADER_DG.resize(nTimeIntegrationPoints*nTimeDOFs);
+    for(unsigned short intPoint=0; intPoint<nTimeIntegrationPoints; ++intPoint)
+      for(unsigned short iTimeDOF=0; iTimeDOF<nTimeDOFs; ++iTimeDOF)
+        timeInterpolTimesWeightADER_DG[intPoint*nTimeDOFs+iTimeDOF] = 0.5*timeIntegrationWeights[intPoint]
+            *timeInterpolDOFToIntegrationADER_DG[intPoint*nTimeDOFs+iTimeDOF];
   }
   else {
 
@@ -4076,8 +4090,7 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
 
             default: {
 
-              cout << "Task not defined. This should not happen." << endl;
-              exit(1);
+              SU2_MPI::Error("Task not defined. This should not happen.", CURRENT_FUNCTION);
             }
           }
         }
@@ -4171,7 +4184,6 @@ void CFEM_DG_EulerSolver::ADER_DG_PredictorStep(CConfig             *config,
   /* Get the data of the ADER time integration scheme. */
   const unsigned short nTimeDOFs              = config->GetnTimeDOFsADER_DG();
   const unsigned short nTimeIntegrationPoints = config->GetnTimeIntegrationADER_DG();
-  const su2double     *timeIntegrationWeights = config->GetWeightsIntegrationADER_DG();
   const bool          useAliasedPredictor     = config->GetKind_ADER_Predictor() == ADER_ALIASED_PREDICTOR;
 
    /* Determine the number of solution entities that are treated simultaneously
@@ -4402,9 +4414,12 @@ void CFEM_DG_EulerSolver::ADER_DG_PredictorStep(CConfig             *config,
                account for this offset in the loop below. */
             const su2double *resThisInt = resInt + nVar*(intPoint - intStart);
 
-            /* Store the interpolation data for this time integration point. */
+            /* Store the interpolation data for this time integration point, as
+               well as its precomputed combination with the integration weight. */
             const su2double *DOFToThisTimeInt = timeInterpolDOFToIntegrationADER_DG
                                               + intPoint*nTimeDOFs;
+            const su2double *weightsThisTimeInt = timeInterpolTimesWeightADER_DG.data()
+                                                + intPoint*nTimeDOFs;
 
             /* Update the actual interpolation. Make a distinction between
                2D and 3D for performance reasons. */
@@ -4419,11 +4434,11 @@ void CFEM_DG_EulerSolver::ADER_DG_PredictorStep(CConfig             *config,
 
                     /* Determine the index where the 1st residual of the 1st spatial
                        DOF starts for this time DOF. Also determine the multiplication
-                       factor for this time DOF. The factor 0.5 is present, because
-                       the length of the interval in parameter space, [-1..1], is 2. */
+                       factor for this time DOF, the combination of the integration
+                       weight (including the factor 0.5 of the parameter interval
+                       [-1..1]) and the interpolation matrix is precomputed. */
                     const unsigned int indResThisTimeDOF = nVar*(iTimeDOF-DOFStart);
-                    const su2double w = 0.5*timeIntegrationWeights[intPoint]
-                                      * VecDeltaTime[l]*DOFToThisTimeInt[iTimeDOF];
+                    const su2double w = VecDeltaTime[l]*weightsThisTimeInt[iTimeDOF];
 
                     /* Loop over the number of spatial DOFs to update their residuals. Note
                        the minus sign, see the comment in the larger comment section above. */
@@ -4453,11 +4468,11 @@ void CFEM_DG_EulerSolver::ADER_DG_PredictorStep(CConfig             *config,
 
                     /* Determine the index where the 1st residual of the 1st spatial
                        DOF starts for this time DOF. Also determine the multiplication
-                       factor for this time DOF. The factor 0.5 is present, because
-                       the length of the interval in parameter space, [-1..1], is 2. */
+                       factor for this time DOF, the combination of the integration
+                       weight (including the factor 0.5 of the parameter interval
+                       [-1..1]) and the interpolation matrix is precomputed. */
                     const unsigned int indResThisTimeDOF = nVar*(iTimeDOF-DOFStart);
-                    const su2double w = 0.5*timeIntegrationWeights[intPoint]
-                                      * VecDeltaTime[l]*DOFToThisTimeInt[iTimeDOF];
+                    const su2double w = VecDeltaTime[l]*weightsThisTimeInt[iTimeDOF];
 
                     /* Loop over the number of spatial DOFs to update their residuals. Note
                        the minus sign, see the comment in the larger comment section above. */
@@ -6635,16 +6650,6 @@ void CFEM_DG_EulerSolver::CreateFinalResidual(const unsigned short timeLevel,
     elemEnd   = nVolElemHaloPerTimeLevel[timeLevel+1];
   }
 
-  /* For the halo elements the residual is initialized to zero. */
-  if( !ownedElements ) {
-
-    for(unsigned long l=elemStart; l<elemEnd; ++l) {
-      su2double *resDOFsElem = VecResDOFs.data() + nVar*volElem[l].offsetDOFsSolLocal;
-      for(unsigned short i=0; i<(nVar*volElem[l].nDOFsSol); ++i)
-        resDOFsElem[i] = 0.0;
-    }
-  }
-
   /* Loop over the required element range. */
   for(unsigned long l=elemStart; l<elemEnd; ++l) {
 
@@ -6652,8 +6657,14 @@ void CFEM_DG_EulerSolver::CreateFinalResidual(const unsigned short timeLevel,
     for(unsigned long i=volElem[l].offsetDOFsSolLocal;
                       i<(volElem[l].offsetDOFsSolLocal+volElem[l].nDOFsSol); ++i) {
 
-      /* Create the final residual by summing up all contributions. */
+      /* For the halo elements there is no volume contribution and the residual
+         must be initialized to zero. This is fused with the summation below to
+         avoid a separate pass over the residuals of the halo DOFs. */
       su2double *resDOF = VecResDOFs.data() + nVar*i;
+      if( !ownedElements )
+        for(unsigned short k=0; k<nVar; ++k) resDOF[k] = 0.0;
+
+      /* Create the final residual by summing up all contributions. */
       for(unsigned long j=nEntriesResFaces[i]; j<nEntriesResFaces[i+1]; ++j) {
         const su2double *resFace = VecResFaces.data() + nVar*entriesResFaces[j];
         for(unsigned short k=0; k<nVar; ++k)
@@ -9499,7 +9510,7 @@ void CFEM_DG_EulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, C
   /*--- Delete the class memory that is used to load the restart. ---*/
 
   delete [] Restart_Vars;
-  delete [] Restart_Data;
-  Restart_Vars = nullptr; Restart_Data = nullptr;
+  Restart_Vars = nullptr;
+  FreeRestartData();
 
 }
@@ -6273,11 +6273,33 @@ void CFEM_DG_NSSolver::WallTreatmentViscousFluxes(
                                         su2double          *kOverCvInt,
                                         CWallModel         *wallModel) {
 
+  /* Define the vectors, in which the exchange data and the results of the wall
+     model are gathered, such that all exchange points of a boundary face can be
+     treated in one batched wall model evaluation. */
+  vector<su2double> tExchange, velTanExchange, muExchange, pExchange, dirTanExchange;
+  vector<su2double> tauWallInt, qWallInt, ViscosityWallInt, kOverCvWallInt;
+
   /* Loop over the simultaneously treated faces. */
   for(unsigned short l=0; l<nFaceSimul; ++l) {
     const unsigned short llNVar = l*nVar;
 
-    /* Loop over the donors for this boundary face. */
+    /* Determine the total number of exchange points of this face and allocate
+       the memory to gather the exchange data and to store the results. */
+    const unsigned short nIntTot = surfElem[l].nIntPerWallFunctionDonor.back();
+
+    tExchange.resize(nIntTot);
+    velTanExchange.resize(nIntTot);
+    muExchange.resize(nIntTot);
+    pExchange.resize(nIntTot);
+    dirTanExchange.assign(3*nIntTot, 0.0);
+
+    tauWallInt.resize(nIntTot);
+    qWallInt.resize(nIntTot);
+    ViscosityWallInt.resize(nIntTot);
+    kOverCvWallInt.resize(nIntTot);
+
+    /* Loop over the donors for this boundary face to gather the data in the
+       exchange points. */
     for(unsigned long j=0; j<surfElem[l].donorsWallFunction.size(); ++j) {
 
       /* Easier storage of the element ID of the donor and set the pointer
@@ -6321,9 +6343,9 @@ void CFEM_DG_NSSolver::WallTreatmentViscousFluxes(
         su2double eInt    = rhoInv*solInt[nVar-1] - 0.5*vel2Mag;
 
         FluidModel->SetTDState_rhoe(solInt[0], eInt);
-        const su2double Pressure = FluidModel->GetPressure();
-        const su2double Temperature = FluidModel->GetTemperature();
-        const su2double LaminarViscosity= FluidModel->GetLaminarViscosity();
+        pExchange[i]  = FluidModel->GetPressure();
+        tExchange[i]  = FluidModel->GetTemperature();
+        muExchange[i] = FluidModel->GetLaminarViscosity();
 
         /* Subtract the prescribed wall velocity, i.e. grid velocity
            from the velocity in the exchange point. */
@@ -6340,42 +6362,55 @@ void CFEM_DG_NSSolver::WallTreatmentViscousFluxes(
         su2double velTan = sqrt(vel[0]*vel[0] + vel[1]*vel[1] + vel[2]*vel[2]);
         velTan = max(velTan,1.e-25);
 
-        su2double dirTan[] = {0.0, 0.0, 0.0};
-        for(unsigned short k=0; k<nDim; ++k) dirTan[k] = vel[k]/velTan;
-
-        /* Compute the wall shear stress and heat flux vector using
-           the wall model. */
-        su2double tauWall, qWall, ViscosityWall, kOverCvWall;
-
-        wallModel->WallShearStressAndHeatFlux(Temperature, velTan, LaminarViscosity, Pressure,
-                                              Wall_HeatFlux, HeatFlux_Prescribed,
-                                              Wall_Temperature, Temperature_Prescribed,
-                                              FluidModel, tauWall, qWall, ViscosityWall,
-                                              kOverCvWall);
-
-        /* Compute the wall velocity in tangential direction. */
-        const su2double *solWallInt = solIntL + NPad*ii + llNVar;
-        su2double velWallTan = 0.0;
-        for(unsigned short k=0; k<nDim; ++k)
-          velWallTan += solWallInt[k+1]*dirTan[k];
-        velWallTan /= solWallInt[0];
-
-        /* Determine the position where the viscous fluxes, viscosity and
-           thermal conductivity must be stored. */
-        su2double *normalFlux = viscFluxes + NPad*ii + llNVar;
-
-        const unsigned short ind = l*nInt + ii;
-        viscosityInt[ind] = ViscosityWall;
-        kOverCvInt[ind]   = kOverCvWall;
-
-        /* Compute the viscous normal flux. Note that the unscaled normals
-           must be used, hence the multiplication with normals[nDim]. */
-        normalFlux[0] = 0.0;
-        for(unsigned short k=0; k<nDim; ++k)
-          normalFlux[k+1] = -normals[nDim]*tauWall*dirTan[k];
-        normalFlux[nVar-1] = normals[nDim]*(qWall - tauWall*velWallTan);
+        velTanExchange[i] = velTan;
+        for(unsigned short k=0; k<nDim; ++k) dirTanExchange[3*i+k] = vel[k]/velTan;
       }
     }
+
+    /* Compute the wall shear stress and heat flux for all exchange points of
+       this face in one batched call to the wall model. */
+    wallModel->WallShearStressAndHeatFlux(nIntTot, tExchange.data(), velTanExchange.data(),
+                                          muExchange.data(), pExchange.data(),
+                                          Wall_HeatFlux, HeatFlux_Prescribed,
+                                          Wall_Temperature, Temperature_Prescribed,
+                                          FluidModel, tauWallInt.data(), qWallInt.data(),
+                                          ViscosityWallInt.data(), kOverCvWallInt.data());
+
+    /* Loop over the exchange points to scatter the wall data to the viscous
+       fluxes in the integration points. */
+    for(unsigned short i=0; i<nIntTot; ++i) {
+
+      /* Easier storage of the actual integration point, its normal and the
+         wall data computed by the wall model. */
+      const unsigned short ii = surfElem[l].intPerWallFunctionDonor[i];
+      const su2double *normals = surfElem[l].metricNormalsFace.data() + ii*(nDim+1);
+      const su2double *dirTan  = dirTanExchange.data() + 3*i;
+
+      const su2double tauWall = tauWallInt[i];
+      const su2double qWall   = qWallInt[i];
+
+      /* Compute the wall velocity in tangential direction. */
+      const su2double *solWallInt = solIntL + NPad*ii + llNVar;
+      su2double velWallTan = 0.0;
+      for(unsigned short k=0; k<nDim; ++k)
+        velWallTan += solWallInt[k+1]*dirTan[k];
+      velWallTan /= solWallInt[0];
+
+      /* Determine the position where the viscous fluxes, viscosity and
+         thermal conductivity must be stored. */
+      su2double *normalFlux = viscFluxes + NPad*ii + llNVar;
+
+      const unsigned short ind = l*nInt + ii;
+      viscosityInt[ind] = ViscosityWallInt[i];
+      kOverCvInt[ind]   = kOverCvWallInt[i];
+
+      /* Compute the viscous normal flux. Note that the unscaled normals
+         must be used, hence the multiplication with normals[nDim]. */
+      normalFlux[0] = 0.0;
+      for(unsigned short k=0; k<nDim; ++k)
+        normalFlux[k+1] = -normals[nDim]*tauWall*dirTan[k];
+      normalFlux[nVar-1] = normals[nDim]*(qWall - tauWall*velWallTan);
+    }
   }
 }
 
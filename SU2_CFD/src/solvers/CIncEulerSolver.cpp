@@ -112,6 +112,14 @@ CIncEulerSolver::CIncEulerSolver(CGeometry *geometry, CConfig *config, unsigned
 
   nVarGrad = nPrimVarGrad;
 
+  /*--- Without an energy equation the temperature, the density, and the artificial
+   compressibility factor are uniform and nothing consumes their gradients, restrict
+   the gradient computation and its halo exchange to pressure and velocity. ---*/
+
+  if (!config->GetEnergy_Equation() && !config->GetWeakly_Coupled_Heat() &&
+      (config->GetKind_DensityModel() == INC_DENSITYMODEL::CONSTANT))
+    nPrimVarGradActive = nDim+1;
+
   nMarker      = config->GetnMarker_All();
   nPoint       = geometry->GetnPoint();
   nPointDomain = geometry->GetnPointDomain();
@@ -208,6 +216,10 @@ CIncEulerSolver::CIncEulerSolver(CGeometry *geometry, CConfig *config, unsigned
 
   CommunicateInitialState(geometry, config);
 
+  /*--- Reduced-fidelity far field for the adjoint recording, if requested. ---*/
+
+  SetAdjointFidelityMask(geometry, config);
+
   /*--- Add the solver name (max 8 characters) ---*/
   SolverName = "INC.FLOW";
 
@@ -918,7 +930,13 @@ void CIncEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contai
 
   if (!Output && muscl && !center) {
 
-    /*--- Gradient computation for MUSCL reconstruction. ---*/
+    /*--- Gradient computation for MUSCL reconstruction, fused
+     *    with the limiter computation when possible. ---*/
+
+    if ((config->GetKind_Gradient_Method_Recon() == GREEN_GAUSS) && limiter && !van_albada) {
+      SetPrimitive_Gradient_Limiter(geometry, config);
+      return;
+    }
 
     switch (config->GetKind_Gradient_Method_Recon()) {
       case GREEN_GAUSS:
@@ -1155,17 +1173,16 @@ void CIncEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
     auto V_i = nodes->GetPrimitive(iPoint);
     auto V_j = nodes->GetPrimitive(jPoint);
 
-    /*--- High order reconstruction using MUSCL strategy ---*/
+    /*--- High order reconstruction using MUSCL strategy, skipped in the
+     reduced-fidelity far field of an adjoint recording. ---*/
 
-    if (muscl) {
+    const bool reduced = GetPointReducedFidelity(iPoint) && GetPointReducedFidelity(jPoint);
 
-      auto Coord_i = geometry->nodes->GetCoord(iPoint);
-      auto Coord_j = geometry->nodes->GetCoord(jPoint);
+    if (muscl && !reduced) {
 
-      su2double Vector_ij[MAXNDIM] = {0.0};
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Vector_ij[iDim] = 0.5*(Coord_j[iDim] - Coord_i[iDim]);
-      }
+      /*--- Use the precomputed i-to-midpoint vector of the edge. ---*/
+
+      const su2double* Vector_ij = geometry->edges->GetVector_ij(iEdge);
 
       auto Gradient_i = nodes->GetGradient_Reconstruction(iPoint);
       auto Gradient_j = nodes->GetGradient_Reconstruction(jPoint);
@@ -1802,6 +1819,12 @@ void CIncEulerSolver::ClassicalRK4_Iteration(CGeometry *geometry, CSolver **solv
   Explicit_Iteration<CLASSICAL_RK4_EXPLICIT>(geometry, solver_container, config, iRKStep);
 }
 
+void CIncEulerSolver::SSPRK3_Iteration(CGeometry *geometry, CSolver **solver_container,
+                                       CConfig *config, unsigned short iRKStep) {
+
+  Explicit_Iteration<SSPRK3_EXPLICIT>(geometry, solver_container, config, iRKStep);
+}
+
 void CIncEulerSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
   Explicit_Iteration<EULER_EXPLICIT>(geometry, solver_container, config, 0);
@@ -68,9 +68,13 @@ void CIncNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   CommonPreprocessing(geometry, solver_container, config, iMesh, iRKStep, RunTime_EqSystem, Output);
 
-  /*--- Compute gradient for MUSCL reconstruction ---*/
+  /*--- Compute gradient for MUSCL reconstruction,
+   *    fused with the limiter computation when possible. ---*/
 
-  if (config->GetReconstructionGradientRequired() && muscl && !center) {
+  const bool fusedGradLim = muscl && !center && limiter && !van_albada && !Output &&
+                            (config->GetKind_Gradient_Method_Recon() == GREEN_GAUSS);
+
+  if (config->GetReconstructionGradientRequired() && muscl && !center && !fusedGradLim) {
     switch (config->GetKind_Gradient_Method_Recon()) {
       case GREEN_GAUSS:
         SetPrimitive_Gradient_GG(geometry, config, true); break;
@@ -93,7 +97,8 @@ void CIncNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
   /*--- Compute the limiters ---*/
 
   if (muscl && !center && limiter && !van_albada && !Output) {
-    SetPrimitive_Limiter(geometry, config);
+    if (fusedGradLim) SetPrimitive_Gradient_Limiter(geometry, config);
+    else SetPrimitive_Limiter(geometry, config);
   }
 
   ComputeVorticityAndStrainMag(*config, iMesh);
@@ -136,10 +141,18 @@ void CIncNSSolver::GetStreamwise_Periodic_Properties(const CGeometry *geometry,
   const auto InnerIter = config->GetInnerIter();
   const auto OuterIter = config->GetOuterIter();
 
+  /*--- The outlet area and the integrated heatflux depend on the mesh and the config alone,
+        so they are computed once and cached as long as the grid does not move. This routine
+        runs in the preprocessing of every iteration (i.e. every RK stage) and would
+        otherwise pay two additional global reductions each time. ---*/
+  const bool updateGeomIntegrals = !StreamwisePeriodic_GeomIntegralsValid ||
+                                   config->GetGrid_Movement() || config->GetDeform_Mesh();
+
   su2double Area_Local            = 0.0,
             MassFlow_Local        = 0.0,
             Average_Density_Local = 0.0,
-            Temperature_Local     = 0.0;
+            Temperature_Local     = 0.0,
+            HeatFlow_Local        = 0.0;
 
   for (auto iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
 
@@ -176,15 +189,55 @@ void CIncNSSolver::GetStreamwise_Periodic_Properties(const CGeometry *geometry,
     } // loop periodic boundaries
   } // loop MarkerAll
 
-  // MPI Communication: Sum Area, Sum rho*A & T*A and divide by AreaGlobbal, sum massflow
-  su2double Area_Global(0), Average_Density_Global(0), MassFlow_Global(0), Temperature_Global(0);
-  SU2_MPI::Allreduce(&Area_Local,            &Area_Global,            1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-  SU2_MPI::Allreduce(&Average_Density_Local, &Average_Density_Global, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-  SU2_MPI::Allreduce(&MassFlow_Local,        &MassFlow_Global,        1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-  SU2_MPI::Allreduce(&Temperature_Local,     &Temperature_Global,     1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  if (config->GetEnergy_Equation() && updateGeomIntegrals) {
+    /*---------------------------------------------------------------------------------------------*/
+    /*--- 3. Compute the integrated Heatflow [W] for the energy equation source term, heatflux  ---*/
+    /*---    boundary term and recovered Temperature. The computation is not completely clear.  ---*/
+    /*---    Here the Heatflux from all Bounary markers in the config-file is used.             ---*/
+    /*---------------------------------------------------------------------------------------------*/
+
+    /*--- Loop over all heatflux Markers ---*/
+    for (auto iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+
+      if (config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX) {
 
-  Average_Density_Global /= Area_Global;
-  Temperature_Global /= Area_Global;
+        /*--- Identify the boundary by string name and retrive heatflux from config ---*/
+        const auto Marker_StringTag = config->GetMarker_All_TagBound(iMarker);
+        const su2double Wall_HeatFlux = config->GetWall_HeatFlux(Marker_StringTag);
+
+        for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+
+          auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+
+          if (!geometry->nodes->GetDomain(iPoint)) continue;
+
+          const auto AreaNormal = geometry->vertex[iMarker][iVertex]->GetNormal();
+
+          const su2double FaceArea = GeometryToolbox::Norm(nDim, AreaNormal);
+
+          HeatFlow_Local += FaceArea * (-1.0) * Wall_HeatFlux/config->GetHeat_Flux_Ref();;
+        } // loop Vertices
+      } // loop Heatflux marker
+    } // loop AllMarker
+  } // if energy
+
+  /*--- MPI Communication: all surface integrals are packed into a single reduction, the area
+        and integrated heatflux only take part in it while their cached values are stale. ---*/
+  su2double sendBuf[5] = {MassFlow_Local, Average_Density_Local, Temperature_Local, Area_Local, HeatFlow_Local};
+  su2double recvBuf[5] = {0.0, 0.0, 0.0, 0.0, 0.0};
+  const int nReduce = updateGeomIntegrals ? 5 : 3;
+  SU2_MPI::Allreduce(sendBuf, recvBuf, nReduce, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+  if (updateGeomIntegrals) {
+    StreamwisePeriodic_GlobalArea = recvBuf[3];
+    if (config->GetEnergy_Equation()) SPvals.Streamwise_Periodic_IntegratedHeatFlow = recvBuf[4];
+    StreamwisePeriodic_GeomIntegralsValid = true;
+  }
+
+  const su2double MassFlow_Global = recvBuf[0];
+  const su2double Area_Global = StreamwisePeriodic_GlobalArea;
+  const su2double Average_Density_Global = recvBuf[1] / Area_Global;
+  const su2double Temperature_Global = recvBuf[2] / Area_Global;
 
   /*--- Set solver variables ---*/
   SPvals.Streamwise_Periodic_MassFlow = MassFlow_Global;
@@ -226,47 +279,6 @@ void CIncNSSolver::GetStreamwise_Periodic_Properties(const CGeometry *geometry,
     }
 
   } // if massflow
-
-
-  if (config->GetEnergy_Equation()) {
-    /*---------------------------------------------------------------------------------------------*/
-    /*--- 3. Compute the integrated Heatflow [W] for the energy equation source term, heatflux  ---*/
-    /*---    boundary term and recovered Temperature. The computation is not completely clear.  ---*/
-    /*---    Here the Heatflux from all Bounary markers in the config-file is used.             ---*/
-    /*---------------------------------------------------------------------------------------------*/
-
-    su2double HeatFlow_Local = 0.0, HeatFlow_Global = 0.0;
-
-    /*--- Loop over all heatflux Markers ---*/
-    for (auto iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-
-      if (config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX) {
-
-        /*--- Identify the boundary by string name and retrive heatflux from config ---*/
-        const auto Marker_StringTag = config->GetMarker_All_TagBound(iMarker);
-        const su2double Wall_HeatFlux = config->GetWall_HeatFlux(Marker_StringTag);
-
-        for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-
-          auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-
-          if (!geometry->nodes->GetDomain(iPoint)) continue;
-
-          const auto AreaNormal = geometry->vertex[iMarker][iVertex]->GetNormal();
-
-          const su2double FaceArea = GeometryToolbox::Norm(nDim, AreaNormal);
-
-          HeatFlow_Local += FaceArea * (-1.0) * Wall_HeatFlux/config->GetHeat_Flux_Ref();;
-        } // loop Vertices
-      } // loop Heatflux marker
-    } // loop AllMarker
-
-    /*--- MPI Communication sum up integrated Heatflux from all processes ---*/
-    SU2_MPI::Allreduce(&HeatFlow_Local, &HeatFlow_Global, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-
-    /*--- Set the solver variable Integrated Heatflux ---*/
-    SPvals.Streamwise_Periodic_IntegratedHeatFlow = HeatFlow_Global;
-  } // if energy
 }
 
 
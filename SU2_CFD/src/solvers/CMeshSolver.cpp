@@ -486,11 +486,9 @@ void CMeshSolver::DeformMesh(CGeometry **geometry, CNumerics **numerics, CConfig
   geometry[MESH_0]->InitiateComms(geometry[MESH_0], config, COORDINATES);
   geometry[MESH_0]->CompleteComms(geometry[MESH_0], config, COORDINATES);
 
-  InitiateComms(geometry[MESH_0], config, SOLUTION);
-  CompleteComms(geometry[MESH_0], config, SOLUTION);
-
-  InitiateComms(geometry[MESH_0], config, MESH_DISPLACEMENTS);
-  CompleteComms(geometry[MESH_0], config, MESH_DISPLACEMENTS);
+  const unsigned short commTypes[2] = {SOLUTION, MESH_DISPLACEMENTS};
+  InitiateComms(geometry[MESH_0], config, commTypes, 2);
+  CompleteComms(geometry[MESH_0], config, commTypes, 2);
 
   /*--- Compute the stiffness matrix, no point recording because we clear the residual. ---*/
 
@@ -761,8 +759,7 @@ void CMeshSolver::SetBoundaryDisplacements(CGeometry *geometry, CConfig *config,
 
 void CMeshSolver::SetDualTime_Mesh(void){
 
-  nodes->Set_Solution_time_n1();
-  nodes->Set_Solution_time_n();
+  nodes->Shift_Solution_time();
 }
 
 void CMeshSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *config, int val_iter, bool val_update_geo) {
@@ -862,7 +859,7 @@ void CMeshSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *
   /*--- Delete the class memory that is used to load the restart. ---*/
 
   delete [] Restart_Vars; Restart_Vars = nullptr;
-  delete [] Restart_Data; Restart_Data = nullptr;
+  FreeRestartData();
 
 }
 
@@ -961,7 +958,7 @@ void CMeshSolver::RestartOldGeometry(CGeometry *geometry, const CConfig *config)
     /*--- Delete the class memory that is used to load the restart. ---*/
 
     delete [] Restart_Vars; Restart_Vars = nullptr;
-    delete [] Restart_Data; Restart_Data = nullptr;
+    FreeRestartData();
 
     InitiateComms(geometry, config, CommType);
     CompleteComms(geometry, config, CommType);
@@ -503,9 +503,6 @@ void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_con
 
     numerics->SetNormal(geometry->edges->GetNormal(iEdge));
 
-    auto Coord_i = geometry->nodes->GetCoord(iPoint);
-    auto Coord_j = geometry->nodes->GetCoord(jPoint);
-
     /*--- Get conserved & primitive variables from CVariable ---*/
     auto U_i = nodes->GetSolution(iPoint);   auto U_j = nodes->GetSolution(jPoint);
     auto V_i = nodes->GetPrimitive(iPoint);  auto V_j = nodes->GetPrimitive(jPoint);
@@ -524,11 +521,9 @@ void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_con
 
     } else {
 
-      /*--- High order reconstruction using MUSCL strategy ---*/
-      su2double Vector_ij[MAXNDIM] = {0.0};
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Vector_ij[iDim] = 0.5*(Coord_j[iDim] - Coord_i[iDim]);
-      }
+      /*--- High order reconstruction using MUSCL strategy, with the
+       precomputed i-to-midpoint vector of the edge. ---*/
+      const su2double* Vector_ij = geometry->edges->GetVector_ij(iEdge);
 
       /*--- Retrieve gradient information ---*/
       auto Gradient_i = nodes->GetGradient_Reconstruction(iPoint);
@@ -908,6 +903,12 @@ void CNEMOEulerSolver::ClassicalRK4_Iteration(CGeometry *geometry, CSolver **sol
   Explicit_Iteration<CLASSICAL_RK4_EXPLICIT>(geometry, solver_container, config, iRKStep);
 }
 
+void CNEMOEulerSolver::SSPRK3_Iteration(CGeometry *geometry, CSolver **solver_container,
+                                        CConfig *config, unsigned short iRKStep) {
+
+  Explicit_Iteration<SSPRK3_EXPLICIT>(geometry, solver_container, config, iRKStep);
+}
+
 void CNEMOEulerSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
   Explicit_Iteration<EULER_EXPLICIT>(geometry, solver_container, config, 0);
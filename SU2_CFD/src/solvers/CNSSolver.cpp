@@ -86,7 +86,12 @@ void CNSSolver::Preprocessing(CGeometry* geometry, CSolver** solver_container, C
   const auto nPrimVarGrad_bak = nPrimVarGrad;
   if (Output) ompMasterAssignBarrier(nPrimVarGrad, 1 + nDim);
 
-  if (config->GetReconstructionGradientRequired() && muscl && !center) {
+  /*--- The reconstruction gradient is fused with the limiter computation when possible. ---*/
+
+  const bool fusedGradLim = muscl && !center && limiter && !van_albada && !Output &&
+                            (config->GetKind_Gradient_Method_Recon() == GREEN_GAUSS);
+
+  if (config->GetReconstructionGradientRequired() && muscl && !center && !fusedGradLim) {
     switch (config->GetKind_Gradient_Method_Recon()) {
       case GREEN_GAUSS:
         SetPrimitive_Gradient_GG(geometry, config, true);
@@ -113,7 +118,8 @@ void CNSSolver::Preprocessing(CGeometry* geometry, CSolver** solver_container, C
   /*--- Compute the limiters ---*/
 
   if (muscl && !center && limiter && !van_albada && !Output) {
-    SetPrimitive_Limiter(geometry, config);
+    if (fusedGradLim) SetPrimitive_Gradient_Limiter(geometry, config);
+    else SetPrimitive_Limiter(geometry, config);
   }
 
   ComputeVorticityAndStrainMag(*config, iMesh);
@@ -132,33 +138,66 @@ unsigned long CNSSolver::SetPrimitive_Variables(CSolver** solver_container, cons
 
   const TURB_MODEL turb_model = config->GetKind_Turb_Model();
   const bool tkeNeeded = (turb_model == TURB_MODEL::SST) || (turb_model == TURB_MODEL::SST_SUST);
+  const bool turb = (turb_model != TURB_MODEL::NONE) && (solver_container[TURB_SOL] != nullptr);
+  const bool hybridRANSLES = turb && (config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES);
+  CVariable* turbNodes = turb ? solver_container[TURB_SOL]->GetNodes() : nullptr;
 
   AD::StartNoSharedReading();
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
-    /*--- Retrieve the value of the kinetic energy (if needed). ---*/
+  /*--- Process the points in batches, evaluating the thermodynamic state and the transport
+   *    properties of each batch with a single call into the fluid model. This avoids the
+   *    per-point virtual dispatch and allows models with closed-form states (e.g. CIdealGas)
+   *    to vectorize the evaluation. ---*/
 
-    su2double eddy_visc = 0.0, turb_ke = 0.0;
+  constexpr unsigned long BATCH_SIZE = 64;
 
-    if (turb_model != TURB_MODEL::NONE && solver_container[TURB_SOL] != nullptr) {
-      eddy_visc = solver_container[TURB_SOL]->GetNodes()->GetmuT(iPoint);
-      if (tkeNeeded) turb_ke = solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint, 0);
+  su2double rho[BATCH_SIZE], energy[BATCH_SIZE], pressure[BATCH_SIZE], temperature[BATCH_SIZE],
+            soundspeed2[BATCH_SIZE], dPdrho_e[BATCH_SIZE], dPde_rho[BATCH_SIZE], laminar_visc[BATCH_SIZE],
+            dmudrho_T[BATCH_SIZE], dmudT_rho[BATCH_SIZE], thermal_cond[BATCH_SIZE], dktdrho_T[BATCH_SIZE],
+            dktdT_rho[BATCH_SIZE], cp[BATCH_SIZE], dTdrho_e[BATCH_SIZE], dTde_rho[BATCH_SIZE],
+            eddy_visc[BATCH_SIZE], turb_ke[BATCH_SIZE];
 
-      if (config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES) {
-        su2double DES_LengthScale = solver_container[TURB_SOL]->GetNodes()->GetDES_LengthScale(iPoint);
-        nodes->SetDES_LengthScale(iPoint, DES_LengthScale);
-      }
+  SU2_OMP_FOR_STAT(roundUpDiv(omp_chunk_size, BATCH_SIZE))
+  for (unsigned long begin = 0; begin < nPoint; begin += BATCH_SIZE) {
+
+    const auto batchSize = min(BATCH_SIZE, nPoint - begin);
+
+    /*--- Gather the inputs of the fluid model, computing the velocities and retrieving
+     *    the eddy viscosity and the kinetic energy (if needed) on the way. ---*/
+
+    for (auto i = 0ul; i < batchSize; ++i) {
+      const auto iPoint = begin + i;
+
+      eddy_visc[i] = turb ? turbNodes->GetmuT(iPoint) : 0.0;
+      turb_ke[i] = tkeNeeded ? turbNodes->GetSolution(iPoint, 0) : 0.0;
+
+      if (hybridRANSLES) nodes->SetDES_LengthScale(iPoint, turbNodes->GetDES_LengthScale(iPoint));
+
+      nodes->SetVelocity(iPoint);   // Computes velocity and velocity^2
+      rho[i] = nodes->GetDensity(iPoint);
+      energy[i] = nodes->GetEnergy(iPoint) - 0.5 * nodes->GetVelocity2(iPoint) - turb_ke[i];
     }
 
+    GetFluidModel()->ComputeTDState_rhoe(batchSize, rho, energy, pressure, temperature,
+                                         soundspeed2, dPdrho_e, dPde_rho);
+
+    GetFluidModel()->ComputeTransport_rhoe(batchSize, rho, energy, temperature, laminar_visc,
+                                           dmudrho_T, dmudT_rho, thermal_cond, dktdrho_T,
+                                           dktdT_rho, cp, dTdrho_e, dTde_rho);
+
     /*--- Compressible flow, primitive variables nDim+5, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
 
-    bool physical = static_cast<CNSVariable*>(nodes)->SetPrimVar(iPoint, eddy_visc, turb_ke, GetFluidModel());
-    nodes->SetSecondaryVar(iPoint, GetFluidModel());
+    for (auto i = 0ul; i < batchSize; ++i) {
+      const auto iPoint = begin + i;
+      bool physical = static_cast<CNSVariable*>(nodes)->SetPrimVar(
+          iPoint, eddy_visc[i], turb_ke[i], pressure[i], temperature[i], soundspeed2[i], dPdrho_e[i],
+          dPde_rho[i], dTdrho_e[i], dTde_rho[i], laminar_visc[i], dmudrho_T[i], dmudT_rho[i],
+          thermal_cond[i], dktdrho_T[i], dktdT_rho[i], cp[i], GetFluidModel());
 
-    /*--- Check for non-realizable states for reporting. ---*/
+      /*--- Check for non-realizable states for reporting. ---*/
 
-    nonPhysicalPoints += !physical;
+      nonPhysicalPoints += !physical;
+    }
   }
   END_SU2_OMP_FOR
 
@@ -422,6 +461,12 @@ void CNSSolver::BC_HeatFlux_Wall_Generic(const CGeometry* geometry, const CConfi
     for (auto iVar = 0u; iVar < nVar; iVar++) Jacobian_i[iVar] = new su2double[nVar]();
   }
 
+  /*--- The recording of each vertex can be preaccumulated since all inputs are local.
+   This is not possible for dynamic grids or py-wrapper markers, whose additional
+   inputs (grid velocities, custom heat fluxes) are not registered here. ---*/
+
+  const bool preacc = !dynamic_grid && !config->GetMarker_All_PyCustom(val_marker);
+
   /*--- Loop over all of the vertices on this boundary marker ---*/
 
   SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
@@ -432,6 +477,15 @@ void CNSSolver::BC_HeatFlux_Wall_Generic(const CGeometry* geometry, const CConfi
 
     if (!geometry->nodes->GetDomain(iPoint)) continue;
 
+    if (preacc) {
+      AD::StartPreacc();
+      AD::SetPreaccIn(LinSysRes(iPoint, nDim + 1));
+      if (kind_boundary == HEAT_FLUX)
+        AD::SetPreaccIn(Wall_HeatFlux);
+      else
+        AD::SetPreaccIn(nodes->GetPrimitive(iPoint), nPrimVar);
+    }
+
     /*--- If it is a customizable patch, retrieve the specified wall heat flux. ---*/
 
     if (config->GetMarker_All_PyCustom(val_marker))
@@ -444,6 +498,7 @@ void CNSSolver::BC_HeatFlux_Wall_Generic(const CGeometry* geometry, const CConfi
     /*--- Compute dual-grid area and boundary normal ---*/
 
     const auto Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
+    AD::SetPreaccIn(Normal, nDim);
 
     su2double Area = GeometryToolbox::Norm(nDim, Normal);
 
@@ -488,6 +543,7 @@ void CNSSolver::BC_HeatFlux_Wall_Generic(const CGeometry* geometry, const CConfi
     /*--- Convective and viscous contributions to the residual at the wall ---*/
 
     LinSysRes(iPoint, nDim + 1) += Res_Conv - Res_Visc;
+    AD::SetPreaccOut(LinSysRes(iPoint, nDim + 1));
 
     /*--- Enforce the no-slip boundary condition in a strong way by
      modifying the velocity-rows of the Jacobian (1 on the diagonal).
@@ -523,6 +579,8 @@ void CNSSolver::BC_HeatFlux_Wall_Generic(const CGeometry* geometry, const CConfi
         Jacobian.DeleteValsRowi(total_index);
       }
     }
+
+    AD::EndPreacc();
   }
   END_SU2_OMP_FOR
 
@@ -910,6 +968,12 @@ void CNSSolver::BC_Isothermal_Wall_Generic(CGeometry* geometry, CSolver** solver
     for (auto iVar = 0u; iVar < nVar; iVar++) Jacobian_i[iVar] = new su2double[nVar]();
   }
 
+  /*--- The recording of each vertex can be preaccumulated since all inputs are local.
+   This is not possible for dynamic grids or py-wrapper markers, whose additional
+   inputs (grid velocities, custom temperatures) are not registered here. ---*/
+
+  const bool preacc = !dynamic_grid && !config->GetMarker_All_PyCustom(val_marker);
+
   /*--- Loop over boundary points ---*/
 
   SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
@@ -918,9 +982,20 @@ void CNSSolver::BC_Isothermal_Wall_Generic(CGeometry* geometry, CSolver** solver
 
     if (!geometry->nodes->GetDomain(iPoint)) continue;
 
+    if (preacc) {
+      AD::StartPreacc();
+      AD::SetPreaccIn(LinSysRes(iPoint, nDim + 1));
+      AD::SetPreaccIn(nodes->GetPrimitive(iPoint), nPrimVar);
+      if (cht_mode)
+        AD::SetPreaccIn(HeatConjugateVar[val_marker][iVertex][0], HeatConjugateVar[val_marker][iVertex][2]);
+      else
+        AD::SetPreaccIn(Twall);
+    }
+
     /*--- Compute dual-grid area and boundary normal ---*/
 
     const auto Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
+    AD::SetPreaccIn(Normal, nDim);
 
     su2double Area = GeometryToolbox::Norm(nDim, Normal);
 
@@ -935,6 +1010,9 @@ void CNSSolver::BC_Isothermal_Wall_Generic(CGeometry* geometry, CSolver** solver
 
     const auto Coord_i = geometry->nodes->GetCoord(iPoint);
     const auto Coord_j = geometry->nodes->GetCoord(Point_Normal);
+    AD::SetPreaccIn(Coord_i, nDim);
+    AD::SetPreaccIn(Coord_j, nDim);
+    AD::SetPreaccIn(nodes->GetPrimitive(Point_Normal), nPrimVar);
 
     su2double dist_ij = GeometryToolbox::Distance(nDim, Coord_i, Coord_j);
 
@@ -1009,6 +1087,7 @@ void CNSSolver::BC_Isothermal_Wall_Generic(CGeometry* geometry, CSolver** solver
     /*--- Convective and viscous contributions to the residual at the wall ---*/
 
     LinSysRes(iPoint, nDim + 1) += Res_Conv - Res_Visc;
+    AD::SetPreaccOut(LinSysRes(iPoint, nDim + 1));
 
     /*--- Enforce the no-slip boundary condition in a strong way by
      modifying the velocity-rows of the Jacobian (1 on the diagonal).
@@ -1022,6 +1101,8 @@ void CNSSolver::BC_Isothermal_Wall_Generic(CGeometry* geometry, CSolver** solver
         Jacobian.DeleteValsRowi(total_index);
       }
     }
+
+    AD::EndPreacc();
   }
   END_SU2_OMP_FOR
 
@@ -147,12 +147,10 @@ void CRadP1Solver::Preprocessing(CGeometry *geometry, CSolver **solver_container
   /*--- Initialize the Jacobian matrix ---*/
   Jacobian.SetValZero();
 
-  /*--- Compute the Solution gradients ---*/
-  if (config->GetReconstructionGradientRequired()) {
-    if (config->GetKind_Gradient_Method_Recon() == GREEN_GAUSS) SetSolution_Gradient_GG(geometry, config, true);
-    if (config->GetKind_Gradient_Method_Recon() == LEAST_SQUARES) SetSolution_Gradient_LS(geometry, config, true);
-    if (config->GetKind_Gradient_Method_Recon() == WEIGHTED_LEAST_SQUARES) SetSolution_Gradient_LS(geometry, config, true);
-  }
+  /*--- Compute the Solution gradients. The P1 equation is pure diffusion, there is no
+        upwind scheme that would require reconstruction gradients, so unlike the flow
+        solvers we do not compute them (they would cost an extra halo exchange of the
+        gradient per iteration without ever being used). ---*/
   if (config->GetKind_Gradient_Method() == GREEN_GAUSS) SetSolution_Gradient_GG(geometry, config);
   if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) SetSolution_Gradient_LS(geometry, config);
 
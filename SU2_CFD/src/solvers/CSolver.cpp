@@ -27,6 +27,15 @@
 
 
 #include "../../include/solvers/CSolver.hpp"
+
+#if !defined(HAVE_MPI) && !defined(_WIN32)
+/*--- Headers for the memory-mapped restart reader. ---*/
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "../../include/gradients/computeGradientsGreenGauss.hpp"
 #include "../../include/gradients/computeGradientsLeastSquares.hpp"
 #include "../../include/limiters/computeLimiters.hpp"
@@ -46,6 +55,7 @@
 #include "../../../Common/include/toolboxes/C1DInterpolation.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../../Common/include/toolboxes/CLinearPartitioner.hpp"
+#include "../../../Common/include/toolboxes/profiling_toolbox.hpp"
 #include "../../../Common/include/adt/CADTPointsOnlyClass.hpp"
 #include "../../include/CMarkerProfileReaderFVM.hpp"
 
@@ -88,6 +98,9 @@ CSolver::CSolver(bool mesh_deform_mode) : System(mesh_deform_mode) {
   Jacobian_jj        = nullptr;
   Restart_Vars       = nullptr;
   Restart_Data       = nullptr;
+  Restart_Map        = nullptr;
+  Restart_Map_Size   = 0;
+  Restart_LayoutHash = 0;
   base_nodes         = nullptr;
   nOutputVariables   = 0;
   ResLinSolver       = 0.0;
@@ -117,6 +130,7 @@ CSolver::CSolver(bool mesh_deform_mode) : System(mesh_deform_mode) {
   NonLinRes_Counter = 0;
 
   nPrimVarGrad = 0;
+  nPrimVarGradActive = 0;
   nPrimVar     = 0;
 
 }
@@ -184,7 +198,7 @@ CSolver::~CSolver(void) {
   }
 
   delete [] Restart_Vars;
-  delete [] Restart_Data;
+  FreeRestartData();
 
   delete VerificationSolution;
 }
@@ -233,9 +247,9 @@ void CSolver::GetPeriodicCommCountAndType(const CConfig* config,
       break;
     case PERIODIC_PRIM_GG:
     case PERIODIC_PRIM_GG_R:
-      COUNT_PER_POINT  = nPrimVarGrad*nDim;
+      COUNT_PER_POINT  = GetnPrimVarGradActive()*nDim;
       MPI_TYPE         = COMM_TYPE_DOUBLE;
-      ICOUNT           = nPrimVarGrad;
+      ICOUNT           = GetnPrimVarGradActive();
       JCOUNT           = nDim;
       break;
     case PERIODIC_SOL_LS:
@@ -251,9 +265,9 @@ void CSolver::GetPeriodicCommCountAndType(const CConfig* config,
     case PERIODIC_PRIM_ULS:
     case PERIODIC_PRIM_LS_R:
     case PERIODIC_PRIM_ULS_R:
-      COUNT_PER_POINT  = nDim*nDim + nPrimVarGrad*nDim;
+      COUNT_PER_POINT  = nDim*nDim + GetnPrimVarGradActive()*nDim;
       MPI_TYPE         = COMM_TYPE_DOUBLE;
-      ICOUNT           = nPrimVarGrad;
+      ICOUNT           = GetnPrimVarGradActive();
       JCOUNT           = nDim;
       break;
     case PERIODIC_LIM_PRIM_1:
@@ -387,6 +401,43 @@ void CSolver::InitiatePeriodicComms(CGeometry *geometry,
 
   GetPeriodicCommCountAndType(config, commType, COUNT_PER_POINT, MPI_TYPE, ICOUNT, JCOUNT);
 
+  /*--- Precompute the rotation matrix and effective translation of each periodic
+   marker once, instead of rebuilding them (string lookups into the config and
+   trigonometry) for every communicated point of the packing loops below. ---*/
+
+  const unsigned short nMarkerAll = config->GetnMarker_All();
+  su2activematrix rotationPerMarker(nMarkerAll, 9);
+  su2activematrix translationPerMarker(nMarkerAll, 3);
+
+  for (unsigned short iMarker = 0; iMarker < nMarkerAll; iMarker++) {
+    if (config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY) continue;
+
+    Marker_Tag = config->GetMarker_All_TagBound(iMarker);
+    center     = config->GetPeriodicRotCenter(Marker_Tag);
+    angles     = config->GetPeriodicRotAngles(Marker_Tag);
+    trans      = config->GetPeriodicTranslation(Marker_Tag);
+
+    /*--- Store (center+trans) as it is constant and will be added. ---*/
+
+    for (iDim = 0; iDim < 3; iDim++)
+      translationPerMarker(iMarker, iDim) = center[iDim] + trans[iDim];
+
+    /*--- Compute the rotation matrix. Note that the implicit
+     ordering is rotation about the x-axis, y-axis, then z-axis. ---*/
+
+    if (nDim == 2) {
+      GeometryToolbox::RotationMatrix(angles[0], rotMatrix2D);
+      for (iVar = 0; iVar < 2; iVar++)
+        for (jVar = 0; jVar < 2; jVar++)
+          rotationPerMarker(iMarker, iVar*2+jVar) = rotMatrix2D[iVar][jVar];
+    } else {
+      GeometryToolbox::RotationMatrix(angles[0], angles[1], angles[2], rotMatrix3D);
+      for (iVar = 0; iVar < 3; iVar++)
+        for (jVar = 0; jVar < 3; jVar++)
+          rotationPerMarker(iMarker, iVar*3+jVar) = rotMatrix3D[iVar][jVar];
+    }
+  }
+
   /*--- Allocate buffers for matrices that need rotation. ---*/
 
   su2activematrix jacBlock(ICOUNT,JCOUNT);
@@ -441,32 +492,20 @@ void CSolver::InitiatePeriodicComms(CGeometry *geometry,
         iPoint    = geometry->Local_Point_PeriodicSend[msg_offset  + iSend];
         iPeriodic = geometry->Local_Marker_PeriodicSend[msg_offset + iSend];
 
-        /*--- Retrieve the supplied periodic information. ---*/
-
-        Marker_Tag = config->GetMarker_All_TagBound(iPeriodic);
-        center     = config->GetPeriodicRotCenter(Marker_Tag);
-        angles     = config->GetPeriodicRotAngles(Marker_Tag);
-        trans      = config->GetPeriodicTranslation(Marker_Tag);
-
-        /*--- Store (center+trans) as it is constant and will be added. ---*/
-
-        translation[0] = center[0] + trans[0];
-        translation[1] = center[1] + trans[1];
-        translation[2] = center[2] + trans[2];
-
-        /*--- Store angles separately for clarity. Compute sines/cosines. ---*/
+        /*--- Retrieve the precomputed periodic information of this marker. ---*/
 
-        su2double Theta = angles[0];
-        su2double Phi = angles[1];
-        su2double Psi = angles[2];
-
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis, then z-axis. ---*/
+        translation[0] = translationPerMarker(iPeriodic, 0);
+        translation[1] = translationPerMarker(iPeriodic, 1);
+        translation[2] = translationPerMarker(iPeriodic, 2);
 
         if (nDim==2) {
-          GeometryToolbox::RotationMatrix(Theta, rotMatrix2D);
+          for (iVar = 0; iVar < 2; iVar++)
+            for (jVar = 0; jVar < 2; jVar++)
+              rotMatrix2D[iVar][jVar] = rotationPerMarker(iPeriodic, iVar*2+jVar);
         } else {
-          GeometryToolbox::RotationMatrix(Theta, Phi, Psi, rotMatrix3D);
+          for (iVar = 0; iVar < 3; iVar++)
+            for (jVar = 0; jVar < 3; jVar++)
+              rotMatrix3D[iVar][jVar] = rotationPerMarker(iPeriodic, iVar*3+jVar);
         }
 
         /*--- Compute the offset in the recv buffer for this point. ---*/
@@ -1316,32 +1355,53 @@ void CSolver::GetCommCountAndType(const CConfig* config,
                                   unsigned short commType,
                                   unsigned short &COUNT_PER_POINT,
                                   unsigned short &MPI_TYPE) const {
+  /*--- Quantities that only steer the discretization (limiters, sensors,
+   eigenvalues, CFL, reconstruction gradients) tolerate single precision
+   halos, which halves their message volume when the user requests it. ---*/
+
+  const unsigned short TOLERANT_TYPE =
+    config->GetComm_SinglePrecision() ? COMM_TYPE_FLOAT : COMM_TYPE_DOUBLE;
+
   switch (commType) {
     case SOLUTION:
     case SOLUTION_OLD:
     case UNDIVIDED_LAPLACIAN:
-    case SOLUTION_LIMITER:
       COUNT_PER_POINT  = nVar;
       MPI_TYPE         = COMM_TYPE_DOUBLE;
       break;
+    case SOLUTION_LIMITER:
+      COUNT_PER_POINT  = nVar;
+      MPI_TYPE         = TOLERANT_TYPE;
+      break;
     case MAX_EIGENVALUE:
     case SENSOR:
+    case LOCAL_CFL:
       COUNT_PER_POINT  = 1;
-      MPI_TYPE         = COMM_TYPE_DOUBLE;
+      MPI_TYPE         = TOLERANT_TYPE;
       break;
     case SOLUTION_GRADIENT:
-    case SOLUTION_GRAD_REC:
       COUNT_PER_POINT  = nVar*nDim;
       MPI_TYPE         = COMM_TYPE_DOUBLE;
       break;
+    case SOLUTION_GRAD_REC:
+      COUNT_PER_POINT  = nVar*nDim;
+      MPI_TYPE         = TOLERANT_TYPE;
+      break;
     case PRIMITIVE_GRADIENT:
-    case PRIMITIVE_GRAD_REC:
-      COUNT_PER_POINT  = nPrimVarGrad*nDim;
+      COUNT_PER_POINT  = GetnPrimVarGradActive()*nDim;
       MPI_TYPE         = COMM_TYPE_DOUBLE;
       break;
+    case PRIMITIVE_GRAD_REC:
+      COUNT_PER_POINT  = GetnPrimVarGradActive()*nDim;
+      MPI_TYPE         = TOLERANT_TYPE;
+      break;
     case PRIMITIVE_LIMITER:
       COUNT_PER_POINT  = nPrimVarGrad;
-      MPI_TYPE         = COMM_TYPE_DOUBLE;
+      MPI_TYPE         = TOLERANT_TYPE;
+      break;
+    case PRIMITIVE_GRAD_REC_LIM:
+      COUNT_PER_POINT  = nPrimVarGrad*(nDim+1);
+      MPI_TYPE         = TOLERANT_TYPE;
       break;
     case SOLUTION_EDDY:
       COUNT_PER_POINT  = nVar+1;
@@ -1383,13 +1443,15 @@ namespace CommHelpers {
       case SOLUTION_GRAD_REC: return nodes->GetGradient_Reconstruction();
       case PRIMITIVE_GRADIENT: return nodes->GetGradient_Primitive();
       case PRIMITIVE_GRAD_REC: return nodes->GetGradient_Reconstruction();
+      case PRIMITIVE_GRAD_REC_LIM: return nodes->GetGradient_Reconstruction();
       case AUXVAR_GRADIENT: return nodes->GetAuxVarGradient();
       default: return nodes->GetGradient();
     }
   }
 
   su2activematrix& selectLimiter(CVariable* nodes, unsigned short commType) {
-    if (commType == PRIMITIVE_LIMITER) return nodes->GetLimiter_Primitive();
+    if (commType == PRIMITIVE_LIMITER ||
+        commType == PRIMITIVE_GRAD_REC_LIM) return nodes->GetLimiter_Primitive();
     return nodes->GetLimiter();
   }
 }
@@ -1397,10 +1459,17 @@ namespace CommHelpers {
 void CSolver::InitiateComms(CGeometry *geometry,
                             const CConfig *config,
                             unsigned short commType) {
+  InitiateComms(geometry, config, &commType, 1);
+}
+
+void CSolver::InitiateComms(CGeometry *geometry,
+                            const CConfig *config,
+                            const unsigned short *commTypes,
+                            unsigned short nComms) {
 
   /*--- Local variables ---*/
 
-  unsigned short iVar, iDim;
+  unsigned short iVar, iDim, iComm;
   unsigned short COUNT_PER_POINT = 0;
   unsigned short MPI_TYPE        = 0;
 
@@ -1408,9 +1477,21 @@ void CSolver::InitiateComms(CGeometry *geometry,
 
   int iMessage, iSend, nSend;
 
-  /*--- Set the size of the data packet and type depending on quantity. ---*/
+  /*--- Set the size of the aggregated data packet, which stacks the counts
+   of the individual quantities, and check that the datatypes match. ---*/
+
+  vector<unsigned short> countPerComm(nComms);
 
-  GetCommCountAndType(config, commType, COUNT_PER_POINT, MPI_TYPE);
+  for (iComm = 0; iComm < nComms; iComm++) {
+    unsigned short COUNT_COMM = 0, MPI_TYPE_COMM = 0;
+    GetCommCountAndType(config, commTypes[iComm], COUNT_COMM, MPI_TYPE_COMM);
+    if ((iComm > 0) && (MPI_TYPE_COMM != MPI_TYPE))
+      SU2_MPI::Error("Quantities of different datatypes cannot share an aggregated message.",
+                     CURRENT_FUNCTION);
+    MPI_TYPE = MPI_TYPE_COMM;
+    countPerComm[iComm] = COUNT_COMM;
+    COUNT_PER_POINT += COUNT_COMM;
+  }
 
   /*--- Check to make sure we have created a large enough buffer
    for these comms during preprocessing. This is only for the su2double
@@ -1423,11 +1504,15 @@ void CSolver::InitiateComms(CGeometry *geometry,
 
   su2double *bufDSend = geometry->bufD_P2PSend;
 
-  /*--- Handle the different types of gradient and limiter. ---*/
+  /*--- Handle the different types of gradient and limiter of each quantity. ---*/
 
-  const auto nVarGrad = COUNT_PER_POINT / nDim;
-  auto& gradient = CommHelpers::selectGradient(base_nodes, commType);
-  auto& limiter = CommHelpers::selectLimiter(base_nodes, commType);
+  vector<CVectorOfMatrix*> gradients(nComms);
+  vector<su2activematrix*> limiters(nComms);
+
+  for (iComm = 0; iComm < nComms; iComm++) {
+    gradients[iComm] = &CommHelpers::selectGradient(base_nodes, commTypes[iComm]);
+    limiters[iComm] = &CommHelpers::selectLimiter(base_nodes, commTypes[iComm]);
+  }
 
   /*--- Load the specified quantity from the solver into the generic
    communication buffer in the geometry class. ---*/
@@ -1460,73 +1545,109 @@ void CSolver::InitiateComms(CGeometry *geometry,
 
         buf_offset = (msg_offset + iSend)*COUNT_PER_POINT;
 
-        switch (commType) {
-          case SOLUTION:
-            for (iVar = 0; iVar < nVar; iVar++)
-              bufDSend[buf_offset+iVar] = base_nodes->GetSolution(iPoint, iVar);
-            break;
-          case SOLUTION_OLD:
-            for (iVar = 0; iVar < nVar; iVar++)
-              bufDSend[buf_offset+iVar] = base_nodes->GetSolution_Old(iPoint, iVar);
-            break;
-          case SOLUTION_EDDY:
-            for (iVar = 0; iVar < nVar; iVar++)
-              bufDSend[buf_offset+iVar] = base_nodes->GetSolution(iPoint, iVar);
-            bufDSend[buf_offset+nVar]   = base_nodes->GetmuT(iPoint);
-            break;
-          case UNDIVIDED_LAPLACIAN:
-            for (iVar = 0; iVar < nVar; iVar++)
-              bufDSend[buf_offset+iVar] = base_nodes->GetUndivided_Laplacian(iPoint, iVar);
-            break;
-          case SOLUTION_LIMITER:
-          case PRIMITIVE_LIMITER:
-            for (iVar = 0; iVar < COUNT_PER_POINT; iVar++)
-              bufDSend[buf_offset+iVar] = limiter(iPoint, iVar);
-            break;
-          case MAX_EIGENVALUE:
-            bufDSend[buf_offset] = base_nodes->GetLambda(iPoint);
-            break;
-          case SENSOR:
-            bufDSend[buf_offset] = base_nodes->GetSensor(iPoint);
-            break;
-          case SOLUTION_GRADIENT:
-          case PRIMITIVE_GRADIENT:
-          case SOLUTION_GRAD_REC:
-          case PRIMITIVE_GRAD_REC:
-          case AUXVAR_GRADIENT:
-            for (iVar = 0; iVar < nVarGrad; iVar++)
-              for (iDim = 0; iDim < nDim; iDim++)
-                bufDSend[buf_offset+iVar*nDim+iDim] = gradient(iPoint, iVar, iDim);
-            break;
-          case SOLUTION_FEA:
-            for (iVar = 0; iVar < nVar; iVar++) {
-              bufDSend[buf_offset+iVar] = base_nodes->GetSolution(iPoint, iVar);
-              if (config->GetTime_Domain()) {
-                bufDSend[buf_offset+nVar+iVar]   = base_nodes->GetSolution_Vel(iPoint, iVar);
-                bufDSend[buf_offset+nVar*2+iVar] = base_nodes->GetSolution_Accel(iPoint, iVar);
+        /*--- Pack the quantities consecutively into the aggregated packet. ---*/
+
+        for (iComm = 0; iComm < nComms; iComm++) {
+
+          const unsigned short commType = commTypes[iComm];
+          const auto nVarGrad = countPerComm[iComm] / nDim;
+          auto& gradient = *gradients[iComm];
+          auto& limiter = *limiters[iComm];
+
+          switch (commType) {
+            case SOLUTION:
+              for (iVar = 0; iVar < nVar; iVar++)
+                bufDSend[buf_offset+iVar] = base_nodes->GetSolution(iPoint, iVar);
+              break;
+            case SOLUTION_OLD:
+              for (iVar = 0; iVar < nVar; iVar++)
+                bufDSend[buf_offset+iVar] = base_nodes->GetSolution_Old(iPoint, iVar);
+              break;
+            case SOLUTION_EDDY:
+              for (iVar = 0; iVar < nVar; iVar++)
+                bufDSend[buf_offset+iVar] = base_nodes->GetSolution(iPoint, iVar);
+              bufDSend[buf_offset+nVar]   = base_nodes->GetmuT(iPoint);
+              break;
+            case UNDIVIDED_LAPLACIAN:
+              for (iVar = 0; iVar < nVar; iVar++)
+                bufDSend[buf_offset+iVar] = base_nodes->GetUndivided_Laplacian(iPoint, iVar);
+              break;
+            case SOLUTION_LIMITER:
+            case PRIMITIVE_LIMITER:
+              for (iVar = 0; iVar < countPerComm[iComm]; iVar++)
+                bufDSend[buf_offset+iVar] = limiter(iPoint, iVar);
+              break;
+            case MAX_EIGENVALUE:
+              bufDSend[buf_offset] = base_nodes->GetLambda(iPoint);
+              break;
+            case SENSOR:
+              bufDSend[buf_offset] = base_nodes->GetSensor(iPoint);
+              break;
+            case LOCAL_CFL:
+              bufDSend[buf_offset] = base_nodes->GetLocalCFL(iPoint);
+              break;
+            case SOLUTION_GRADIENT:
+            case PRIMITIVE_GRADIENT:
+            case SOLUTION_GRAD_REC:
+            case PRIMITIVE_GRAD_REC:
+            case AUXVAR_GRADIENT:
+              for (iVar = 0; iVar < nVarGrad; iVar++)
+                for (iDim = 0; iDim < nDim; iDim++)
+                  bufDSend[buf_offset+iVar*nDim+iDim] = gradient(iPoint, iVar, iDim);
+              break;
+            case PRIMITIVE_GRAD_REC_LIM:
+              for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+                for (iDim = 0; iDim < nDim; iDim++)
+                  bufDSend[buf_offset+iVar*nDim+iDim] = gradient(iPoint, iVar, iDim);
+                bufDSend[buf_offset+nPrimVarGrad*nDim+iVar] = limiter(iPoint, iVar);
               }
-            }
-            break;
-          case MESH_DISPLACEMENTS:
-            for (iDim = 0; iDim < nDim; iDim++)
-              bufDSend[buf_offset+iDim] = base_nodes->GetBound_Disp(iPoint, iDim);
-            break;
-          case SOLUTION_TIME_N:
-            for (iVar = 0; iVar < nVar; iVar++)
-              bufDSend[buf_offset+iVar] = base_nodes->GetSolution_time_n(iPoint, iVar);
-            break;
-          case SOLUTION_TIME_N1:
-            for (iVar = 0; iVar < nVar; iVar++)
-              bufDSend[buf_offset+iVar] = base_nodes->GetSolution_time_n1(iPoint, iVar);
-            break;
-          default:
-            SU2_MPI::Error("Unrecognized quantity for point-to-point MPI comms.",
-                           CURRENT_FUNCTION);
-            break;
+              break;
+            case SOLUTION_FEA:
+              for (iVar = 0; iVar < nVar; iVar++) {
+                bufDSend[buf_offset+iVar] = base_nodes->GetSolution(iPoint, iVar);
+                if (config->GetTime_Domain()) {
+                  bufDSend[buf_offset+nVar+iVar]   = base_nodes->GetSolution_Vel(iPoint, iVar);
+                  bufDSend[buf_offset+nVar*2+iVar] = base_nodes->GetSolution_Accel(iPoint, iVar);
+                }
+              }
+              break;
+            case MESH_DISPLACEMENTS:
+              for (iDim = 0; iDim < nDim; iDim++)
+                bufDSend[buf_offset+iDim] = base_nodes->GetBound_Disp(iPoint, iDim);
+              break;
+            case SOLUTION_TIME_N:
+              for (iVar = 0; iVar < nVar; iVar++)
+                bufDSend[buf_offset+iVar] = base_nodes->GetSolution_time_n(iPoint, iVar);
+              break;
+            case SOLUTION_TIME_N1:
+              for (iVar = 0; iVar < nVar; iVar++)
+                bufDSend[buf_offset+iVar] = base_nodes->GetSolution_time_n1(iPoint, iVar);
+              break;
+            default:
+              SU2_MPI::Error("Unrecognized quantity for point-to-point MPI comms.",
+                             CURRENT_FUNCTION);
+              break;
+          }
+
+          /*--- Advance to the position of the next quantity in the packet. ---*/
+
+          buf_offset += countPerComm[iComm];
         }
       }
       END_SU2_OMP_FOR
 
+      /*--- For single precision exchanges, demote the packed values into
+       the float buffer, from which the message is sent. ---*/
+
+      if (MPI_TYPE == COMM_TYPE_FLOAT) {
+        float *bufFSend = geometry->bufF_P2PSend;
+        SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+        for (iSend = 0; iSend < nSend*COUNT_PER_POINT; iSend++)
+          bufFSend[msg_offset*COUNT_PER_POINT + iSend] =
+            SU2_TYPE::GetValue(bufDSend[msg_offset*COUNT_PER_POINT + iSend]);
+        END_SU2_OMP_FOR
+      }
+
       /*--- Launch the point-to-point MPI send for this message. ---*/
 
       geometry->PostP2PSends(geometry, config, MPI_TYPE, COUNT_PER_POINT, iMessage, false);
@@ -1539,10 +1660,19 @@ void CSolver::InitiateComms(CGeometry *geometry,
 void CSolver::CompleteComms(CGeometry *geometry,
                             const CConfig *config,
                             unsigned short commType) {
+  CompleteComms(geometry, config, &commType, 1);
+}
+
+void CSolver::CompleteComms(CGeometry *geometry,
+                            const CConfig *config,
+                            const unsigned short *commTypes,
+                            unsigned short nComms) {
+
+  SU2_PROFILE_SCOPE("CSolver::CompleteComms");
 
   /*--- Local variables ---*/
 
-  unsigned short iDim, iVar;
+  unsigned short iDim, iVar, iComm;
   unsigned long iPoint, iRecv, nRecv, msg_offset, buf_offset;
   unsigned short COUNT_PER_POINT = 0;
   unsigned short MPI_TYPE = 0;
@@ -1552,19 +1682,32 @@ void CSolver::CompleteComms(CGeometry *geometry,
   /*--- Global status so all threads can see the result of Waitany. ---*/
   static SU2_MPI::Status status;
 
-  /*--- Set the size of the data packet and type depending on quantity. ---*/
+  /*--- Set the size of the aggregated data packet, which must match the
+   stacked counts of the quantities passed to InitiateComms(). ---*/
 
-  GetCommCountAndType(config, commType, COUNT_PER_POINT, MPI_TYPE);
+  vector<unsigned short> countPerComm(nComms);
+
+  for (iComm = 0; iComm < nComms; iComm++) {
+    unsigned short COUNT_COMM = 0, MPI_TYPE_COMM = 0;
+    GetCommCountAndType(config, commTypes[iComm], COUNT_COMM, MPI_TYPE_COMM);
+    MPI_TYPE = MPI_TYPE_COMM;
+    countPerComm[iComm] = COUNT_COMM;
+    COUNT_PER_POINT += COUNT_COMM;
+  }
 
   /*--- Set some local pointers to make access simpler. ---*/
 
   const su2double *bufDRecv = geometry->bufD_P2PRecv;
 
-  /*--- Handle the different types of gradient and limiter. ---*/
+  /*--- Handle the different types of gradient and limiter of each quantity. ---*/
+
+  vector<CVectorOfMatrix*> gradients(nComms);
+  vector<su2activematrix*> limiters(nComms);
 
-  const auto nVarGrad = COUNT_PER_POINT / nDim;
-  auto& gradient = CommHelpers::selectGradient(base_nodes, commType);
-  auto& limiter = CommHelpers::selectLimiter(base_nodes, commType);
+  for (iComm = 0; iComm < nComms; iComm++) {
+    gradients[iComm] = &CommHelpers::selectGradient(base_nodes, commTypes[iComm]);
+    limiters[iComm] = &CommHelpers::selectLimiter(base_nodes, commTypes[iComm]);
+  }
 
   /*--- Store the data that was communicated into the appropriate
    location within the local class data structures. ---*/
@@ -1576,8 +1719,10 @@ void CSolver::CompleteComms(CGeometry *geometry,
       /*--- For efficiency, recv the messages dynamically based on
        the order they arrive. ---*/
 
-      SU2_OMP_MASTER
-      SU2_MPI::Waitany(geometry->nP2PRecv, geometry->req_P2PRecv, &ind, &status);
+      SU2_OMP_MASTER {
+        SU2_MPI::Waitany(geometry->nP2PRecv, geometry->req_P2PRecv, &ind, &status);
+        geometry->FlushSharedRecvWindow();
+      }
       END_SU2_OMP_MASTER
       SU2_OMP_BARRIER
 
@@ -1598,6 +1743,18 @@ void CSolver::CompleteComms(CGeometry *geometry,
       nRecv = (geometry->nPoint_P2PRecv[jRecv+1] -
                geometry->nPoint_P2PRecv[jRecv]);
 
+      /*--- For single precision exchanges, promote the received values into
+       the su2double buffer before unpacking. ---*/
+
+      if (MPI_TYPE == COMM_TYPE_FLOAT) {
+        const float *bufFRecv = geometry->bufF_P2PRecv;
+        SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+        for (iRecv = 0; iRecv < nRecv*COUNT_PER_POINT; iRecv++)
+          geometry->bufD_P2PRecv[msg_offset*COUNT_PER_POINT + iRecv] =
+            bufFRecv[msg_offset*COUNT_PER_POINT + iRecv];
+        END_SU2_OMP_FOR
+      }
+
       SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
       for (iRecv = 0; iRecv < nRecv; iRecv++) {
 
@@ -1609,71 +1766,95 @@ void CSolver::CompleteComms(CGeometry *geometry,
 
         buf_offset = (msg_offset + iRecv)*COUNT_PER_POINT;
 
-        /*--- Store the data correctly depending on the quantity. ---*/
+        /*--- Unpack the quantities consecutively from the aggregated packet. ---*/
 
-        switch (commType) {
-          case SOLUTION:
-            for (iVar = 0; iVar < nVar; iVar++)
-              base_nodes->SetSolution(iPoint, iVar, bufDRecv[buf_offset+iVar]);
-            break;
-          case SOLUTION_OLD:
-            for (iVar = 0; iVar < nVar; iVar++)
-              base_nodes->SetSolution_Old(iPoint, iVar, bufDRecv[buf_offset+iVar]);
-            break;
-          case SOLUTION_EDDY:
-            for (iVar = 0; iVar < nVar; iVar++)
-              base_nodes->SetSolution(iPoint, iVar, bufDRecv[buf_offset+iVar]);
-            base_nodes->SetmuT(iPoint,bufDRecv[buf_offset+nVar]);
-            break;
-          case UNDIVIDED_LAPLACIAN:
-            for (iVar = 0; iVar < nVar; iVar++)
-              base_nodes->SetUnd_Lapl(iPoint, iVar, bufDRecv[buf_offset+iVar]);
-            break;
-          case SOLUTION_LIMITER:
-          case PRIMITIVE_LIMITER:
-            for (iVar = 0; iVar < COUNT_PER_POINT; iVar++)
-              limiter(iPoint,iVar) = bufDRecv[buf_offset+iVar];
-            break;
-          case MAX_EIGENVALUE:
-            base_nodes->SetLambda(iPoint,bufDRecv[buf_offset]);
-            break;
-          case SENSOR:
-            base_nodes->SetSensor(iPoint,bufDRecv[buf_offset]);
-            break;
-          case SOLUTION_GRADIENT:
-          case PRIMITIVE_GRADIENT:
-          case SOLUTION_GRAD_REC:
-          case PRIMITIVE_GRAD_REC:
-          case AUXVAR_GRADIENT:
-            for (iVar = 0; iVar < nVarGrad; iVar++)
-              for (iDim = 0; iDim < nDim; iDim++)
-                gradient(iPoint,iVar,iDim) = bufDRecv[buf_offset+iVar*nDim+iDim];
-            break;
-          case SOLUTION_FEA:
-            for (iVar = 0; iVar < nVar; iVar++) {
-              base_nodes->SetSolution(iPoint, iVar, bufDRecv[buf_offset+iVar]);
-              if (config->GetTime_Domain()) {
-                base_nodes->SetSolution_Vel(iPoint, iVar, bufDRecv[buf_offset+nVar+iVar]);
-                base_nodes->SetSolution_Accel(iPoint, iVar, bufDRecv[buf_offset+nVar*2+iVar]);
+        for (iComm = 0; iComm < nComms; iComm++) {
+
+          const unsigned short commType = commTypes[iComm];
+          const auto nVarGrad = countPerComm[iComm] / nDim;
+          auto& gradient = *gradients[iComm];
+          auto& limiter = *limiters[iComm];
+
+          /*--- Store the data correctly depending on the quantity. ---*/
+
+          switch (commType) {
+            case SOLUTION:
+              for (iVar = 0; iVar < nVar; iVar++)
+                base_nodes->SetSolution(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+              break;
+            case SOLUTION_OLD:
+              for (iVar = 0; iVar < nVar; iVar++)
+                base_nodes->SetSolution_Old(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+              break;
+            case SOLUTION_EDDY:
+              for (iVar = 0; iVar < nVar; iVar++)
+                base_nodes->SetSolution(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+              base_nodes->SetmuT(iPoint,bufDRecv[buf_offset+nVar]);
+              break;
+            case UNDIVIDED_LAPLACIAN:
+              for (iVar = 0; iVar < nVar; iVar++)
+                base_nodes->SetUnd_Lapl(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+              break;
+            case SOLUTION_LIMITER:
+            case PRIMITIVE_LIMITER:
+              for (iVar = 0; iVar < countPerComm[iComm]; iVar++)
+                limiter(iPoint,iVar) = bufDRecv[buf_offset+iVar];
+              break;
+            case MAX_EIGENVALUE:
+              base_nodes->SetLambda(iPoint,bufDRecv[buf_offset]);
+              break;
+            case SENSOR:
+              base_nodes->SetSensor(iPoint,bufDRecv[buf_offset]);
+              break;
+            case LOCAL_CFL:
+              base_nodes->SetLocalCFL(iPoint,bufDRecv[buf_offset]);
+              break;
+            case SOLUTION_GRADIENT:
+            case PRIMITIVE_GRADIENT:
+            case SOLUTION_GRAD_REC:
+            case PRIMITIVE_GRAD_REC:
+            case AUXVAR_GRADIENT:
+              for (iVar = 0; iVar < nVarGrad; iVar++)
+                for (iDim = 0; iDim < nDim; iDim++)
+                  gradient(iPoint,iVar,iDim) = bufDRecv[buf_offset+iVar*nDim+iDim];
+              break;
+            case PRIMITIVE_GRAD_REC_LIM:
+              for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+                for (iDim = 0; iDim < nDim; iDim++)
+                  gradient(iPoint,iVar,iDim) = bufDRecv[buf_offset+iVar*nDim+iDim];
+                limiter(iPoint,iVar) = bufDRecv[buf_offset+nPrimVarGrad*nDim+iVar];
               }
-            }
-            break;
-          case MESH_DISPLACEMENTS:
-            for (iDim = 0; iDim < nDim; iDim++)
-              base_nodes->SetBound_Disp(iPoint, iDim, bufDRecv[buf_offset+iDim]);
-            break;
-          case SOLUTION_TIME_N:
-            for (iVar = 0; iVar < nVar; iVar++)
-              base_nodes->Set_Solution_time_n(iPoint, iVar, bufDRecv[buf_offset+iVar]);
-            break;
-          case SOLUTION_TIME_N1:
-            for (iVar = 0; iVar < nVar; iVar++)
-              base_nodes->Set_Solution_time_n1(iPoint, iVar, bufDRecv[buf_offset+iVar]);
-            break;
-          default:
-            SU2_MPI::Error("Unrecognized quantity for point-to-point MPI comms.",
-                           CURRENT_FUNCTION);
-            break;
+              break;
+            case SOLUTION_FEA:
+              for (iVar = 0; iVar < nVar; iVar++) {
+                base_nodes->SetSolution(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+                if (config->GetTime_Domain()) {
+                  base_nodes->SetSolution_Vel(iPoint, iVar, bufDRecv[buf_offset+nVar+iVar]);
+                  base_nodes->SetSolution_Accel(iPoint, iVar, bufDRecv[buf_offset+nVar*2+iVar]);
+                }
+              }
+              break;
+            case MESH_DISPLACEMENTS:
+              for (iDim = 0; iDim < nDim; iDim++)
+                base_nodes->SetBound_Disp(iPoint, iDim, bufDRecv[buf_offset+iDim]);
+              break;
+            case SOLUTION_TIME_N:
+              for (iVar = 0; iVar < nVar; iVar++)
+                base_nodes->Set_Solution_time_n(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+              break;
+            case SOLUTION_TIME_N1:
+              for (iVar = 0; iVar < nVar; iVar++)
+                base_nodes->Set_Solution_time_n1(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+              break;
+            default:
+              SU2_MPI::Error("Unrecognized quantity for point-to-point MPI comms.",
+                             CURRENT_FUNCTION);
+              break;
+          }
+
+          /*--- Advance to the position of the next quantity in the packet. ---*/
+
+          buf_offset += countPerComm[iComm];
         }
       }
       END_SU2_OMP_FOR
@@ -1715,6 +1896,13 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
   const su2double CFLMax            = config->GetCFL_AdaptParam(3);
   const su2double acceptableLinTol  = config->GetCFL_AdaptParam(4);
   const bool fullComms              = (config->GetComm_Level() == COMM_FULL);
+  const bool localCFL               = config->GetCFL_Adapt_Local();
+
+  /* In local mode the CFL of each point evolves from its own under-relaxation
+   only, bounded by the CFL of its neighbors, so that a few stiff cells do not
+   hold back the entire domain. */
+
+  const su2double maxNeighborRatio = 2.0;
 
   /* Number of iterations considered to check for stagnation. */
   const auto Res_Count = min(100ul, config->GetnInner_Iter()-1);
@@ -1820,14 +2008,6 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
 
     su2double myCFLMin = 1e30, myCFLMax = 0.0, myCFLSum = 0.0;
 
-    SU2_OMP_MASTER
-    if ((iMesh == MESH_0) && fullComms) {
-      Min_CFL_Local = 1e30;
-      Max_CFL_Local = 0.0;
-      Avg_CFL_Local = 0.0;
-    }
-    END_SU2_OMP_MASTER
-
     SU2_OMP_FOR_STAT(roundUpDiv(geometry[iMesh]->GetnPointDomain(),omp_get_max_threads()))
     for (unsigned long iPoint = 0; iPoint < geometry[iMesh]->GetnPointDomain(); iPoint++) {
 
@@ -1852,9 +2032,9 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
        then we schedule an increase the CFL number for the next iteration. */
 
       su2double CFLFactor = 1.0;
-      if (underRelaxation < 0.1 || reduceCFL) {
+      if (underRelaxation < 0.1 || (!localCFL && reduceCFL)) {
         CFLFactor = CFLFactorDecrease;
-      } else if ((underRelaxation >= 0.1 && underRelaxation < 1.0) || !canIncrease) {
+      } else if ((underRelaxation >= 0.1 && underRelaxation < 1.0) || (!localCFL && !canIncrease)) {
         CFLFactor = 1.0;
       } else {
         CFLFactor = CFLFactorIncrease;
@@ -1886,9 +2066,10 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
         solverTurb->GetNodes()->SetLocalCFL(iPoint, CFL);
       }
 
-      /* Store min and max CFL for reporting on the fine grid. */
+      /* Store min and max CFL for reporting on the fine grid, in local
+       mode this is deferred to after the neighbor bound is applied. */
 
-      if ((iMesh == MESH_0) && fullComms) {
+      if ((iMesh == MESH_0) && fullComms && !localCFL) {
         myCFLMin = min(CFL,myCFLMin);
         myCFLMax = max(CFL,myCFLMax);
         myCFLSum += CFL;
@@ -1897,23 +2078,72 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
     }
     END_SU2_OMP_FOR
 
+    if (localCFL) {
+
+      /* Update the halo values of the local CFL and take a snapshot of the
+       whole field, the neighbor bound must not depend on the order in which
+       points are visited. */
+
+      solverFlow->InitiateComms(geometry[iMesh], config, LOCAL_CFL);
+      solverFlow->CompleteComms(geometry[iMesh], config, LOCAL_CFL);
+
+      const auto nPointTotal = geometry[iMesh]->GetnPoint();
+
+      SU2_OMP_MASTER
+      localCFLSnapshot.resize(nPointTotal);
+      END_SU2_OMP_MASTER
+      SU2_OMP_BARRIER
+
+      SU2_OMP_FOR_STAT(roundUpDiv(nPointTotal,omp_get_max_threads()))
+      for (unsigned long iPoint = 0; iPoint < nPointTotal; iPoint++)
+        localCFLSnapshot[iPoint] = solverFlow->GetNodes()->GetLocalCFL(iPoint);
+      END_SU2_OMP_FOR
+
+      /* Limit the CFL of each point to a fixed ratio of its smallest
+       neighbor, this keeps the local evolution smooth without letting a
+       handful of stiff cells drag down the CFL of the entire domain. */
+
+      SU2_OMP_FOR_STAT(roundUpDiv(geometry[iMesh]->GetnPointDomain(),omp_get_max_threads()))
+      for (unsigned long iPoint = 0; iPoint < geometry[iMesh]->GetnPointDomain(); iPoint++) {
+
+        su2double CFL = localCFLSnapshot[iPoint];
+
+        for (auto jPoint : geometry[iMesh]->nodes->GetPoints(iPoint))
+          CFL = min(CFL, maxNeighborRatio*localCFLSnapshot[jPoint]);
+
+        solverFlow->GetNodes()->SetLocalCFL(iPoint, CFL);
+        if ((iMesh == MESH_0) && solverTurb) {
+          solverTurb->GetNodes()->SetLocalCFL(iPoint, CFL);
+        }
+
+        if ((iMesh == MESH_0) && fullComms) {
+          myCFLMin = min(CFL,myCFLMin);
+          myCFLMax = max(CFL,myCFLMax);
+          myCFLSum += CFL;
+        }
+
+      }
+      END_SU2_OMP_FOR
+    }
+
     /* Reduce the min/max/avg local CFL numbers. */
 
     if ((iMesh == MESH_0) && fullComms) {
-      SU2_OMP_CRITICAL
-      { /* OpenMP reduction. */
-        Min_CFL_Local = min(Min_CFL_Local,myCFLMin);
-        Max_CFL_Local = max(Max_CFL_Local,myCFLMax);
-        Avg_CFL_Local += myCFLSum;
-      }
-      END_SU2_OMP_CRITICAL
-      SU2_OMP_BARRIER
+      /* OpenMP reduction, per-thread partials merged once without a critical section. */
+      using CFLStats = array<su2double,3>;
+      const CFLStats myStats = ompThreadReduction(CFLStats{{myCFLMin, myCFLMax, myCFLSum}},
+        [](const CFLStats& a, const CFLStats& b) {
+          return CFLStats{{min(a[0],b[0]), max(a[1],b[1]), a[2]+b[2]}};
+        });
 
       SU2_OMP_MASTER
-      { /* MPI reduction. */
-        myCFLMin = Min_CFL_Local; myCFLMax = Max_CFL_Local; myCFLSum = Avg_CFL_Local;
-        SU2_MPI::Allreduce(&myCFLMin, &Min_CFL_Local, 1, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
-        SU2_MPI::Allreduce(&myCFLMax, &Max_CFL_Local, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+      { /* MPI reduction, the max travels negated to batch it with the min in one message. */
+        su2double sbuf[2] = {myStats[0], -myStats[1]}, rbuf[2];
+        SU2_MPI::Allreduce(sbuf, rbuf, 2, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
+        Min_CFL_Local = rbuf[0];
+        Max_CFL_Local = -rbuf[1];
+
+        myCFLSum = myStats[2];
         SU2_MPI::Allreduce(&myCFLSum, &Avg_CFL_Local, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
         Avg_CFL_Local /= su2double(geometry[iMesh]->GetGlobal_nPointDomain());
       }
@@ -1925,18 +2155,123 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
 
 }
 
+void CSolver::SetAdjointFidelityMask(CGeometry *geometry, const CConfig *config) {
+
+  const su2double radius = config->GetAdjFidelity_Radius();
+
+  if ((radius <= 0.0) || !config->GetDiscrete_Adjoint()) return;
+  if (geometry->GetMGLevel() != MESH_0) return;
+
+  const auto nPoint = geometry->GetnPoint();
+  ReducedFidelity.resize(nPoint);
+
+  unsigned long nReduced = 0;
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+    ReducedFidelity[iPoint] = (geometry->nodes->GetWall_Distance(iPoint) > radius);
+    nReduced += ReducedFidelity[iPoint];
+  }
+
+  unsigned long nGlobal = 0, nGlobalReduced = 0, nLocal = nPoint;
+  SU2_MPI::Allreduce(&nLocal, &nGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(&nReduced, &nGlobalReduced, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+
+  if (rank == MASTER_NODE)
+    cout << "Reduced-fidelity adjoint recording on " << (100*nGlobalReduced)/max(nGlobal,1ul)
+         << "% of the mesh points (beyond " << radius << " from solid walls)." << endl;
+}
+
+void CSolver::UpdateFrozenRegions(CGeometry *geometry, const CConfig *config) {
+
+  /*--- Freezing is only applied on the finest grid, the coarse multigrid
+   levels always see an empty mask and compute all of their edges. ---*/
+
+  if (geometry->GetMGLevel() != MESH_0) return;
+
+  /*--- Periodically thaw the entire domain, frozen points are not re-evaluated
+   and can only be checked again after one full residual evaluation. ---*/
+
+  if (config->GetInnerIter() % config->GetRegion_Freezing_Interval() == 0) {
+    SU2_OMP_MASTER
+    PointFrozen.clear();
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+    return;
+  }
+
+  const su2double tol = config->GetRegion_Freezing_Tol();
+
+  SU2_OMP_MASTER
+  PointFrozen.assign(geometry->GetnPoint(), 0);
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  /*--- Mark the points whose residual magnitude is below the threshold (bit 1).
+   Halo points are never marked, edges across partition boundaries are always
+   computed. Points frozen on the previous iteration had their residual forced
+   to zero and therefore remain marked. ---*/
+
+  SU2_OMP_FOR_STAT(roundUpDiv(nPointDomain,omp_get_max_threads()))
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    su2double resMag = 0.0;
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      resMag = max(resMag, fabs(LinSysRes(iPoint,iVar)));
+    if (resMag < tol) PointFrozen[iPoint] = 1;
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Freeze a point (bit 2) only if all of its neighbors are also converged,
+   the margin of active points left around each converged cluster keeps being
+   evaluated and thaws the cluster from the outside if residuals rise. Bit 1 is
+   not modified here so reading the neighbor marks is thread-safe. ---*/
+
+  SU2_OMP_FOR_STAT(roundUpDiv(nPointDomain,omp_get_max_threads()))
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    if ((PointFrozen[iPoint] & 1) == 0) continue;
+    bool freeze = true;
+    for (auto jPoint : geometry->nodes->GetPoints(iPoint))
+      freeze = freeze && ((PointFrozen[jPoint] & 1) != 0);
+    if (freeze) PointFrozen[iPoint] |= 2;
+  }
+  END_SU2_OMP_FOR
+
+}
+
+void CSolver::EnforceFrozenPoints() {
+
+  if (PointFrozen.empty()) return;
+
+  /*--- Identity rows with a zero right-hand side give a null update at the
+   frozen points, the same mechanism strong boundary conditions use, so the
+   partial residuals of the skipped edges cannot pollute the solution. ---*/
+
+  SU2_OMP_FOR_STAT(roundUpDiv(nPointDomain,omp_get_max_threads()))
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    if (!GetPointFrozen(iPoint)) continue;
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      Jacobian.DeleteValsRowi(iPoint*nVar+iVar);
+    LinSysRes.SetBlock_Zero(iPoint);
+  }
+  END_SU2_OMP_FOR
+
+}
+
 void CSolver::SetResidual_RMS(const CGeometry *geometry, const CConfig *config) {
 
   if (geometry->GetMGLevel() != MESH_0) return;
 
   SU2_OMP_MASTER {
 
-  /*--- Set the L2 Norm residual in all the processors. ---*/
+  /*--- Set the L2 Norm residual in all the processors. On the iterations in
+   between exact norms of the residual sampling mode, the reductions are
+   skipped and a local estimate serves the convergence history, convergence
+   decisions are made rank-consistent by the monitoring itself. ---*/
+
+  const bool exactNorms = (config->GetComm_Level() == COMM_FULL) && ExactResidualIteration(config);
 
   vector<su2double> rbuf_res(nVar);
   unsigned long Global_nPointDomain = 0;
 
-  if (config->GetComm_Level() == COMM_FULL) {
+  if (exactNorms) {
 
     SU2_MPI::Allreduce(Residual_RMS.data(), rbuf_res.data(), nVar, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
     Global_nPointDomain = geometry->GetGlobal_nPointDomain();
@@ -1963,7 +2298,7 @@ void CSolver::SetResidual_RMS(const CGeometry *geometry, const CConfig *config)
 
   /*--- Set the Maximum residual in all the processors. ---*/
 
-  if (config->GetComm_Level() == COMM_FULL) {
+  if (exactNorms) {
 
     const unsigned long nProcessor = size;
 
@@ -1993,41 +2328,133 @@ void CSolver::SetResidual_BGS(const CGeometry *geometry, const CConfig *config)
 
   SU2_OMP_MASTER {
 
-  /*--- Set the L2 Norm residual in all the processors. ---*/
+  /*--- Set the L2 Norm residual in all the processors. ---*/
+
+  vector<su2double> rbuf_res(nVar);
+
+  SU2_MPI::Allreduce(Residual_BGS.data(), rbuf_res.data(), nVar, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  const auto Global_nPointDomain = geometry->GetGlobal_nPointDomain();
+
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+    Residual_BGS[iVar] = max(EPS*EPS, sqrt(rbuf_res[iVar]/Global_nPointDomain));
+  }
+
+  if (config->GetComm_Level() == COMM_FULL) {
+
+    /*--- Set the Maximum residual in all the processors. ---*/
+
+    const unsigned long nProcessor = size;
+
+    su2activematrix rbuf_residual(nProcessor,nVar);
+    su2matrix<unsigned long> rbuf_point(nProcessor,nVar);
+    su2activematrix rbuf_coord(nProcessor*nVar, nDim);
+
+    SU2_MPI::Allgather(Residual_Max_BGS.data(), nVar, MPI_DOUBLE, rbuf_residual.data(), nVar, MPI_DOUBLE, SU2_MPI::GetComm());
+    SU2_MPI::Allgather(Point_Max_BGS.data(), nVar, MPI_UNSIGNED_LONG, rbuf_point.data(), nVar, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+    SU2_MPI::Allgather(Point_Max_Coord_BGS.data(), nVar*nDim, MPI_DOUBLE, rbuf_coord.data(), nVar*nDim, MPI_DOUBLE, SU2_MPI::GetComm());
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      for (auto iProcessor = 0ul; iProcessor < nProcessor; iProcessor++) {
+        AddRes_Max_BGS(iVar, rbuf_residual(iProcessor,iVar), rbuf_point(iProcessor,iVar), rbuf_coord[iProcessor*nVar+iVar]);
+      }
+    }
+  }
+
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
+void CSolver::Residual_Smoothing(CGeometry *geometry, const CConfig *config,
+                                 unsigned short nSmooth, su2double smoothCoeff) {
+
+  if (nSmooth == 0) return;
+
+  const auto nPoint = geometry->GetnPoint();
+
+  /*--- Lazy allocation of the shared workspace and of the boundary mask, the
+   *    mask excludes the same markers whose residual the original multigrid
+   *    smoothing restored after each sweep. ---*/
+
+  if (resSmoothWork.size() < nPoint*nVar) {
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER {
+      resSmoothWork.resize(nPoint*nVar);
+      resSmoothFixed.assign(nPoint, false);
+
+      for (auto iMarker = 0u; iMarker < geometry->GetnMarker(); iMarker++) {
+        if ((config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
+            (config->GetMarker_All_KindBC(iMarker) != NEARFIELD_BOUNDARY) &&
+            (config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY)) {
+
+          for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+            resSmoothFixed[geometry->vertex[iMarker][iVertex]->GetNode()] = true;
+          }
+        }
+      }
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+
+  /*--- Save the original residuals, they enter the update of every sweep. ---*/
+
+  SU2_OMP_FOR_STAT(roundUpDiv(nPoint, omp_get_num_threads()))
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+    base_nodes->SetResidual_Old(iPoint, LinSysRes.GetBlock(iPoint));
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Jacobi iterations, R^{k+1}_i = (R^0_i + coeff * sum_j R^k_j) / (1 + coeff * n_i).
+   *    Each sweep is a single fused pass that gathers the neighbors from one buffer and
+   *    writes the updated residual to the other, instead of separate gather, update, and
+   *    boundary-restore passes over the residual array. ---*/
 
-  vector<su2double> rbuf_res(nVar);
+  su2double* cur = LinSysRes.GetBlock(0);
+  su2double* nxt = resSmoothWork.data();
 
-  SU2_MPI::Allreduce(Residual_BGS.data(), rbuf_res.data(), nVar, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-  const auto Global_nPointDomain = geometry->GetGlobal_nPointDomain();
+  for (auto iSmooth = 0u; iSmooth < nSmooth; iSmooth++) {
 
-  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-    Residual_BGS[iVar] = max(EPS*EPS, sqrt(rbuf_res[iVar]/Global_nPointDomain));
-  }
+    SU2_OMP_FOR_STAT(roundUpDiv(nPoint, omp_get_num_threads()))
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
 
-  if (config->GetComm_Level() == COMM_FULL) {
+      const su2double* orig = base_nodes->GetResidual_Old(iPoint);
+      su2double* dst = nxt + iPoint*nVar;
 
-    /*--- Set the Maximum residual in all the processors. ---*/
+      /*--- Physical boundary points keep their original residual (they still
+       *    feed the unmodified value to the neighbor averages). ---*/
 
-    const unsigned long nProcessor = size;
+      if (resSmoothFixed[iPoint]) {
+        for (auto iVar = 0u; iVar < nVar; iVar++) dst[iVar] = orig[iVar];
+        continue;
+      }
 
-    su2activematrix rbuf_residual(nProcessor,nVar);
-    su2matrix<unsigned long> rbuf_point(nProcessor,nVar);
-    su2activematrix rbuf_coord(nProcessor*nVar, nDim);
+      const auto nNeigh = geometry->nodes->GetnPoint(iPoint);
 
-    SU2_MPI::Allgather(Residual_Max_BGS.data(), nVar, MPI_DOUBLE, rbuf_residual.data(), nVar, MPI_DOUBLE, SU2_MPI::GetComm());
-    SU2_MPI::Allgather(Point_Max_BGS.data(), nVar, MPI_UNSIGNED_LONG, rbuf_point.data(), nVar, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
-    SU2_MPI::Allgather(Point_Max_Coord_BGS.data(), nVar*nDim, MPI_DOUBLE, rbuf_coord.data(), nVar*nDim, MPI_DOUBLE, SU2_MPI::GetComm());
+      for (auto iVar = 0u; iVar < nVar; iVar++) dst[iVar] = orig[iVar];
 
-    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-      for (auto iProcessor = 0ul; iProcessor < nProcessor; iProcessor++) {
-        AddRes_Max_BGS(iVar, rbuf_residual(iProcessor,iVar), rbuf_point(iProcessor,iVar), rbuf_coord[iProcessor*nVar+iVar]);
+      for (auto iNeigh = 0u; iNeigh < nNeigh; iNeigh++) {
+        const su2double* res_j = cur + geometry->nodes->GetPoint(iPoint, iNeigh)*nVar;
+        for (auto iVar = 0u; iVar < nVar; iVar++) dst[iVar] += smoothCoeff*res_j[iVar];
       }
+
+      const su2double factor = 1.0/(1.0 + smoothCoeff*su2double(nNeigh));
+      for (auto iVar = 0u; iVar < nVar; iVar++) dst[iVar] *= factor;
     }
+    END_SU2_OMP_FOR
+
+    swap(cur, nxt);
   }
 
+  /*--- Copy back if the last sweep landed in the workspace. ---*/
+
+  if (cur != LinSysRes.GetBlock(0)) {
+    SU2_OMP_FOR_STAT(roundUpDiv(nPoint, omp_get_num_threads()))
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      LinSysRes.SetBlock(iPoint, &cur[iPoint*nVar]);
+    }
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_MASTER
-  SU2_OMP_BARRIER
 }
 
 void CSolver::SetRotatingFrame_GCL(CGeometry *geometry, const CConfig *config) {
@@ -2108,12 +2535,19 @@ void CSolver::SetAuxVar_Gradient_LS(CGeometry *geometry, const CConfig *config)
   auto& gradient = base_nodes->GetAuxVarGradient();
   auto& rmatrix  = base_nodes->GetRmatrix();
 
+  /*--- On static grids the pseudoinverse of the least squares problem can be cached,
+   *    in the discrete adjoint that would detach the gradient from the coordinates. ---*/
+  auto* smatrixCache = (config->GetDynamic_Grid() || config->GetDeform_Mesh() || config->GetDiscrete_Adjoint())?
+                       nullptr : base_nodes->GetSmatrixCache(weighted);
+
   computeGradientsLeastSquares(this, AUXVAR_GRADIENT, PERIODIC_NONE, *geometry, *config,
-                               weighted, solution, 0, base_nodes->GetnAuxVar(), gradient, rmatrix);
+                               weighted, solution, 0, base_nodes->GetnAuxVar(), gradient, rmatrix, smatrixCache);
 }
 
 void CSolver::SetSolution_Gradient_GG(CGeometry *geometry, const CConfig *config, bool reconstruction) {
 
+  SU2_PROFILE_SCOPE("CSolver::SetSolution_Gradient_GG");
+
   const auto& solution = base_nodes->GetSolution();
   auto& gradient = reconstruction? base_nodes->GetGradient_Reconstruction() : base_nodes->GetGradient();
   const auto comm = reconstruction? SOLUTION_GRAD_REC : SOLUTION_GRADIENT;
@@ -2124,6 +2558,8 @@ void CSolver::SetSolution_Gradient_GG(CGeometry *geometry, const CConfig *config
 
 void CSolver::SetSolution_Gradient_LS(CGeometry *geometry, const CConfig *config, bool reconstruction) {
 
+  SU2_PROFILE_SCOPE("CSolver::SetSolution_Gradient_LS");
+
   /*--- Set a flag for unweighted or weighted least-squares. ---*/
   bool weighted;
   PERIODIC_QUANTITIES commPer;
@@ -2142,7 +2578,13 @@ void CSolver::SetSolution_Gradient_LS(CGeometry *geometry, const CConfig *config
   auto& gradient = reconstruction? base_nodes->GetGradient_Reconstruction() : base_nodes->GetGradient();
   const auto comm = reconstruction? SOLUTION_GRAD_REC : SOLUTION_GRADIENT;
 
-  computeGradientsLeastSquares(this, comm, commPer, *geometry, *config, weighted, solution, 0, nVar, gradient, rmatrix);
+  /*--- On static grids the pseudoinverse of the least squares problem can be cached,
+   *    in the discrete adjoint that would detach the gradient from the coordinates. ---*/
+  auto* smatrixCache = (config->GetDynamic_Grid() || config->GetDeform_Mesh() || config->GetDiscrete_Adjoint())?
+                       nullptr : base_nodes->GetSmatrixCache(weighted);
+
+  computeGradientsLeastSquares(this, comm, commPer, *geometry, *config, weighted, solution, 0, nVar,
+                               gradient, rmatrix, smatrixCache);
 }
 
 void CSolver::SetUndivided_Laplacian(CGeometry *geometry, const CConfig *config) {
@@ -2242,6 +2684,8 @@ void CSolver::SetGridVel_Gradient(CGeometry *geometry, const CConfig *config) {
 
 void CSolver::SetSolution_Limiter(CGeometry *geometry, const CConfig *config) {
 
+  SU2_PROFILE_SCOPE("CSolver::SetSolution_Limiter");
+
   auto kindLimiter = static_cast<ENUM_LIMITER>(config->GetKind_SlopeLimit());
   const auto& solution = base_nodes->GetSolution();
   const auto& gradient = base_nodes->GetGradient_Reconstruction();
@@ -2848,6 +3292,10 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, const CConfig *config,
     PrintingToolbox::trim(fields[iField]);
   }
 
+  /*--- Build the O(1) field lookup and the layout hash. ---*/
+
+  BuildRestartFieldLookup();
+
   /*--- Set the number of variables, one per field in the
    restart file (without including the PointID) ---*/
 
@@ -2892,6 +3340,18 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, const CConfig *config,
 
 void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config, string val_filename) {
 
+  /*--- Delta-encoded restarts (hex magic 535533) store sparse differences
+   against a full restart (keyframe). Load the keyframe first, then patch it
+   with the differences, i.e. reconstruction is always keyframe + one delta. ---*/
+
+  const string keyframe = GetRestartDeltaKeyframe(val_filename);
+
+  if (!keyframe.empty()) {
+    Read_SU2_Restart_Binary(geometry, config, keyframe);
+    ApplyRestartDelta(geometry, config, val_filename);
+    return;
+  }
+
   char str_buf[CGNS_STRING_SIZE], fname[100];
   val_filename += ".dat";
   strcpy(fname, val_filename.c_str());
@@ -2899,7 +3359,111 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
   Restart_Vars = new int[nRestart_Vars];
   fields.clear();
 
-#ifndef HAVE_MPI
+#if !defined(HAVE_MPI) && !defined(_WIN32)
+
+  /*--- Serial binary input via a read-only memory map of the file. The data
+   section is used in place (zero copy) when its alignment allows, the OS pages
+   the file in on demand instead of reading it into an intermediate buffer. ---*/
+
+  const int fd = open(fname, O_RDONLY);
+
+  /*--- Error check for opening the file. ---*/
+
+  if (fd < 0) {
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
+  }
+
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) != 0 ||
+      static_cast<size_t>(fileStat.st_size) < nRestart_Vars*sizeof(int)) {
+    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+  }
+
+  Restart_Map_Size = fileStat.st_size;
+  Restart_Map = mmap(nullptr, Restart_Map_Size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+
+  if (Restart_Map == MAP_FAILED) {
+    Restart_Map = nullptr;
+    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+  }
+
+  const char* filePtr = static_cast<const char*>(Restart_Map);
+
+  /*--- First, read the number of variables and points. ---*/
+
+  memcpy(Restart_Vars, filePtr, nRestart_Vars*sizeof(int));
+
+  /*--- Check that this is an SU2 binary file. SU2 binary files
+   have the hex representation of "SU2" as the first int in the file. ---*/
+
+  if (Restart_Vars[0] != 535532) {
+    SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
+                   string("SU2 reads/writes binary restart files by default.\n") +
+                   string("Note that backward compatibility for ASCII restart files is\n") +
+                   string("possible with the READ_BINARY_RESTART option."), CURRENT_FUNCTION);
+  }
+
+  /*--- Store the number of fields and points to be read for clarity. ---*/
+
+  const unsigned long nFields = Restart_Vars[1];
+  const unsigned long nPointFile = Restart_Vars[2];
+
+  /*--- Read the variable names from the file. Note that we are adopting a
+   fixed length of 33 for the string length to match with CGNS. This is
+   needed for when we read the strings later. We pad the beginning of the
+   variable string vector with the Point_ID tag that wasn't written. ---*/
+
+  fields.push_back("Point_ID");
+  for (auto iVar = 0u; iVar < nFields; iVar++) {
+    memcpy(str_buf, filePtr + nRestart_Vars*sizeof(int) + iVar*CGNS_STRING_SIZE, CGNS_STRING_SIZE);
+    fields.push_back(str_buf);
+  }
+
+  /*--- Range check the data section before touching it, it holds floats
+   instead of doubles if the single precision format was written. ---*/
+
+  const bool singlePrec = (Restart_Vars[3] == 1);
+  const size_t data_disp = nRestart_Vars*sizeof(int) + nFields*CGNS_STRING_SIZE*sizeof(char);
+
+  if (Restart_Map_Size < data_disp + nFields*nPointFile*(singlePrec? sizeof(float) : sizeof(passivedouble))) {
+    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+  }
+
+  if (singlePrec) {
+
+    /*--- Promote the single precision data out of the map, no zero copy. ---*/
+
+    vector<float> buf(nFields*nPointFile);
+    memcpy(buf.data(), filePtr + data_disp, buf.size()*sizeof(float));
+
+    Restart_Data = new passivedouble[nFields*nPointFile];
+    for (auto i = 0ul; i < buf.size(); ++i) Restart_Data[i] = buf[i];
+
+    munmap(Restart_Map, Restart_Map_Size);
+    Restart_Map = nullptr;
+    Restart_Map_Size = 0;
+  }
+  else if (reinterpret_cast<uintptr_t>(filePtr + data_disp) % alignof(passivedouble) == 0) {
+
+    /*--- Use the mapping directly, FreeRestartData handles the cleanup. ---*/
+
+    Restart_Data = const_cast<passivedouble*>(reinterpret_cast<const passivedouble*>(filePtr + data_disp));
+  }
+  else {
+
+    /*--- The data section is not suitably aligned for doubles (the header size
+     depends on the number of fields), fall back to one copy out of the map. ---*/
+
+    Restart_Data = new passivedouble[nFields*nPointFile];
+    memcpy(Restart_Data, filePtr + data_disp, nFields*nPointFile*sizeof(passivedouble));
+
+    munmap(Restart_Map, Restart_Map_Size);
+    Restart_Map = nullptr;
+    Restart_Map_Size = 0;
+  }
+
+#elif !defined(HAVE_MPI)
 
   /*--- Serial binary input. ---*/
 
@@ -2953,11 +3517,22 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
 
   Restart_Data = new passivedouble[nFields*nPointFile];
 
-  /*--- Read in the data for the restart at all local points. ---*/
+  /*--- Read in the data for the restart at all local points, promoting it
+   if the single precision format was written. ---*/
 
-  ret = fread(Restart_Data, sizeof(passivedouble), nFields*nPointFile, fhw);
-  if (ret != nFields*nPointFile) {
-    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+  if (Restart_Vars[3] == 1) {
+    vector<float> buf(nFields*nPointFile);
+    ret = fread(buf.data(), sizeof(float), buf.size(), fhw);
+    if (ret != buf.size()) {
+      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    }
+    for (auto i = 0ul; i < buf.size(); ++i) Restart_Data[i] = buf[i];
+  }
+  else {
+    ret = fread(Restart_Data, sizeof(passivedouble), nFields*nPointFile, fhw);
+    if (ret != nFields*nPointFile) {
+      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    }
   }
 
   /*--- Close the file. ---*/
@@ -3040,9 +3615,13 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
 
   delete [] mpi_str_buf;
 
-  /*--- We're writing only su2doubles in the data portion of the file. ---*/
+  /*--- The data portion of the file holds doubles, or floats if the
+   single precision format was written. ---*/
 
-  etype = MPI_DOUBLE;
+  const bool singlePrec = (Restart_Vars[3] == 1);
+  const size_t sizeofElem = singlePrec? sizeof(float) : sizeof(passivedouble);
+
+  etype = singlePrec? MPI_FLOAT : MPI_DOUBLE;
 
   /*--- We need to ignore the 4 ints describing the nVar_Restart and nPoints,
    along with the string names of the variables. ---*/
@@ -3068,7 +3647,7 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
     for (auto iPoint_Global = 0ul; iPoint_Global < geometry->GetGlobal_nPointDomain(); ++iPoint_Global) {
       if (geometry->GetGlobal_to_Local_Point(iPoint_Global) > -1) {
         blocklen[counter] = nFields;
-        displace[counter] = iPoint_Global*nFields*sizeof(passivedouble);
+        displace[counter] = iPoint_Global*nFields*sizeofElem;
         counter++;
       }
     }
@@ -3083,10 +3662,10 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
     const auto partitioner = CLinearPartitioner(nPointFile,0);
 
     blocklen[0] = nFields*partitioner.GetSizeOnRank(rank);
-    displace[0] = nFields*partitioner.GetFirstIndexOnRank(rank)*sizeof(passivedouble);;
+    displace[0] = nFields*partitioner.GetFirstIndexOnRank(rank)*sizeofElem;
   }
 
-  MPI_Type_create_hindexed(nBlock, blocklen, displace, MPI_DOUBLE, &filetype);
+  MPI_Type_create_hindexed(nBlock, blocklen, displace, etype, &filetype);
   MPI_Type_commit(&filetype);
 
   /*--- Set the view for the MPI file write, i.e., describe the location in
@@ -3099,9 +3678,17 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
   const int bufSize = nBlock*blocklen[0];
   Restart_Data = new passivedouble[bufSize];
 
-  /*--- Collective call for all ranks to read from their view simultaneously. ---*/
+  /*--- Collective call for all ranks to read from their view simultaneously,
+   promoting the data if the single precision format was written. ---*/
 
-  MPI_File_read_all(fhw, Restart_Data, bufSize, MPI_DOUBLE, &status);
+  if (singlePrec) {
+    vector<float> buf(bufSize);
+    MPI_File_read_all(fhw, buf.data(), bufSize, MPI_FLOAT, &status);
+    for (auto i = 0ul; i < buf.size(); ++i) Restart_Data[i] = buf[i];
+  }
+  else {
+    MPI_File_read_all(fhw, Restart_Data, bufSize, MPI_DOUBLE, &status);
+  }
 
   /*--- All ranks close the file after writing. ---*/
 
@@ -3116,12 +3703,230 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
 
 #endif
 
+  /*--- Build the O(1) field lookup and the layout hash. ---*/
+
+  BuildRestartFieldLookup();
+
   if (nPointFile != geometry->GetGlobal_nPointDomain() &&
       config->GetKind_SU2() != SU2_COMPONENT::SU2_SOL) {
     InterpolateRestartData(geometry, config);
   }
 }
 
+string CSolver::GetRestartDeltaKeyframe(string val_filename) const {
+
+  val_filename += ".dat";
+
+  /*--- The keyframe name occupies a fixed 256 character field after the
+   variable names (see CSU2BinaryFileWriter::WriteDeltaData). The master
+   inspects the header, an empty result means the file is not a delta. ---*/
+
+  char kf_buf[256] = {};
+
+  if (rank == MASTER_NODE) {
+    FILE* fhw = fopen(val_filename.c_str(), "rb");
+
+    /*--- A missing file falls through, the regular reader raises the error. ---*/
+
+    if (fhw) {
+      int header[5] = {0};
+
+      if (fread(header, sizeof(int), 5, fhw) == 5 && header[0] == 535533) {
+        const long disp = 5*sizeof(int) + header[1]*CGNS_STRING_SIZE*sizeof(char);
+        if (fseek(fhw, disp, SEEK_SET) != 0 ||
+            fread(kf_buf, sizeof(char), 256, fhw) != 256) {
+          SU2_MPI::Error(string("Error reading delta restart file ") + val_filename, CURRENT_FUNCTION);
+        }
+        kf_buf[255] = '\0';
+      }
+      fclose(fhw);
+    }
+  }
+  SU2_MPI::Bcast(kf_buf, 256, MPI_CHAR, MASTER_NODE, SU2_MPI::GetComm());
+
+  return string(kf_buf);
+}
+
+void CSolver::ApplyRestartDelta(CGeometry *geometry, const CConfig *config, string val_filename) {
+
+  val_filename += ".dat";
+
+  /*--- The sparse sections are small, every rank reads them in full and
+   applies the entries that fall into its portion of the keyframe data. ---*/
+
+  FILE* fhw = fopen(val_filename.c_str(), "rb");
+
+  if (!fhw) {
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + val_filename, CURRENT_FUNCTION);
+  }
+
+  int header[5] = {0};
+  if (fread(header, sizeof(int), 5, fhw) != 5 || header[0] != 535533) {
+    SU2_MPI::Error(string("File ") + val_filename + string(" is not a delta-encoded SU2 restart file."),
+                   CURRENT_FUNCTION);
+  }
+
+  const unsigned long nFields = header[1];
+  const unsigned long nPointFile = header[2];
+  const bool singlePrec = (header[3] == 1);
+
+  /*--- The delta must match the keyframe that was just loaded. ---*/
+
+  if (nFields != (unsigned long)Restart_Vars[1] || nPointFile != (unsigned long)Restart_Vars[2]) {
+    SU2_MPI::Error(string("The delta restart file ") + val_filename +
+                   string(" does not match the keyframe it references."), CURRENT_FUNCTION);
+  }
+
+  /*--- Skip the variable names and the keyframe name, then read the entry
+   count, the index section, and the value section. ---*/
+
+  unsigned long nEntries = 0;
+
+  if (fseek(fhw, 5*sizeof(int) + nFields*CGNS_STRING_SIZE*sizeof(char) + 256, SEEK_SET) != 0 ||
+      fread(&nEntries, sizeof(unsigned long), 1, fhw) != 1) {
+    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+  }
+
+  vector<unsigned long> idx(nEntries);
+  vector<passivedouble> val(nEntries);
+
+  if (nEntries > 0) {
+    if (fread(idx.data(), sizeof(unsigned long), nEntries, fhw) != nEntries) {
+      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    }
+    if (singlePrec) {
+      vector<float> buf(nEntries);
+      if (fread(buf.data(), sizeof(float), nEntries, fhw) != nEntries) {
+        SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+      }
+      for (auto i = 0ul; i < nEntries; ++i) val[i] = buf[i];
+    }
+    else if (fread(val.data(), sizeof(passivedouble), nEntries, fhw) != nEntries) {
+      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    }
+  }
+  fclose(fhw);
+
+#if !defined(HAVE_MPI) && !defined(_WIN32)
+
+  /*--- The keyframe may be a read-only memory map (zero copy path), take a
+   writable copy before patching it. ---*/
+
+  if (Restart_Map != nullptr) {
+    passivedouble* buf = new passivedouble[nFields*nPointFile];
+    memcpy(buf, Restart_Data, nFields*nPointFile*sizeof(passivedouble));
+    Restart_Data = buf;
+
+    munmap(Restart_Map, Restart_Map_Size);
+    Restart_Map = nullptr;
+    Restart_Map_Size = 0;
+  }
+
+#endif
+
+  /*--- Apply the entries, which are sorted by global flat index, to this
+   rank's portion of the keyframe data. The layout of Restart_Data mirrors
+   the one used by the binary reader for the same file sizes. ---*/
+
+  if (nPointFile == geometry->GetGlobal_nPointDomain() ||
+      config->GetKind_SU2() == SU2_COMPONENT::SU2_SOL) {
+
+#ifdef HAVE_MPI
+
+    /*--- Restart_Data holds the owned points in ascending global order,
+     walk the entries in step with the owned point numbering. ---*/
+
+    unsigned long iEntry = 0, counter = 0;
+
+    for (auto iPoint_Global = 0ul; iPoint_Global < geometry->GetGlobal_nPointDomain(); ++iPoint_Global) {
+
+      while (iEntry < nEntries && idx[iEntry] < iPoint_Global*nFields) ++iEntry;
+      if (iEntry == nEntries) break;
+
+      if (geometry->GetGlobal_to_Local_Point(iPoint_Global) > -1) {
+        while (iEntry < nEntries && idx[iEntry] < (iPoint_Global+1)*nFields) {
+          Restart_Data[counter*nFields + (idx[iEntry] - iPoint_Global*nFields)] = val[iEntry];
+          ++iEntry;
+        }
+        counter++;
+      }
+    }
+
+#else
+
+    /*--- The serial reader holds the whole file, indices apply directly. ---*/
+
+    for (auto iEntry = 0ul; iEntry < nEntries; ++iEntry)
+      Restart_Data[idx[iEntry]] = val[iEntry];
+
+#endif
+
+  }
+  else {
+
+    /*--- Interpolation layout, a contiguous linear partition of the file. ---*/
+
+    const auto partitioner = CLinearPartitioner(nPointFile,0);
+
+    const unsigned long begin = nFields*partitioner.GetFirstIndexOnRank(rank);
+    const unsigned long end = begin + nFields*partitioner.GetSizeOnRank(rank);
+
+    for (auto iEntry = 0ul; iEntry < nEntries; ++iEntry) {
+      if (idx[iEntry] >= begin && idx[iEntry] < end)
+        Restart_Data[idx[iEntry] - begin] = val[iEntry];
+    }
+  }
+}
+
+void CSolver::BuildRestartFieldLookup() {
+
+  Restart_FieldIndex.clear();
+
+  /*--- FNV-1a hash of the layout, restarts with equal hashes have the same
+   fields in the same order, so previously matched offsets remain valid. ---*/
+
+  unsigned long hash = 14695981039346656037ul;
+
+  /*--- Skip the point ID at position 0, which is not part of the data and
+   whose tag differs between the ASCII and binary headers. ---*/
+
+  for (auto iField = 1u; iField < fields.size(); iField++) {
+
+    /*--- Strip the quotes added for visualization purposes. ---*/
+
+    string name = fields[iField];
+    name.erase(remove(name.begin(), name.end(), '\"'), name.end());
+
+    for (auto c : name) {
+      hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ul;
+    }
+    hash = (hash ^ static_cast<unsigned char>('\n')) * 1099511628211ul;
+
+    Restart_FieldIndex[name] = iField - 1;
+  }
+
+  Restart_LayoutHash = hash;
+}
+
+void CSolver::FreeRestartData() {
+
+#if !defined(HAVE_MPI) && !defined(_WIN32)
+  if (Restart_Map != nullptr) {
+
+    /*--- Restart_Data points into the memory map and does not own its storage. ---*/
+
+    munmap(Restart_Map, Restart_Map_Size);
+    Restart_Map = nullptr;
+    Restart_Map_Size = 0;
+    Restart_Data = nullptr;
+    return;
+  }
+#endif
+
+  delete [] Restart_Data;
+  Restart_Data = nullptr;
+}
+
 void CSolver::InterpolateRestartData(const CGeometry *geometry, const CConfig *config) {
 
   if (geometry->GetGlobal_nPointDomain() == 0) return;
@@ -3137,7 +3942,8 @@ void CSolver::InterpolateRestartData(const CGeometry *geometry, const CConfig *c
    *  - Do not repeat too many computations in all ranks.
    * Solution?:
    *  - Build a local ADT for the domain points (not the restart points).
-   *  - Find the closest target point for each donor, which does not match all targets.
+   *  - Find the closest target point for each donor, which does not match all targets,
+   *    and blend the donors of each target with inverse distance weights.
    *  - "Diffuse" the data to neighbor points.
    *  Complexity is approx. Nlt + (Nlt + Nd) log(Nlt) where Nlt is the LOCAL number
    *  of target points and Nd the TOTAL number of donors. */
@@ -3150,7 +3956,7 @@ void CSolver::InterpolateRestartData(const CGeometry *geometry, const CConfig *c
   if (rank == MASTER_NODE) {
     cout << "\nThe number of points in the restart file (" << nPointFile << ") does not match "
             "the mesh (" << geometry->GetGlobal_nPointDomain() << ").\n"
-            "A recursive nearest neighbor interpolation will be performed." << endl;
+            "A recursive inverse-distance interpolation of the nearest donors will be performed." << endl;
   }
 
   su2activematrix localVars(nPointDomain, nFields);
@@ -3184,13 +3990,15 @@ void CSolver::InterpolateRestartData(const CGeometry *geometry, const CConfig *c
       sendBuf(iPoint,iVar) = Restart_Data[iPointDonor*nFields+iVar];
   }
 
-  delete [] Restart_Data;
-  Restart_Data = nullptr;
+  FreeRestartData();
 
   /*--- Make room to receive donor data from other ranks, and to map it to target points. ---*/
 
   su2activematrix donorVars(nPointDonorMax, nFields);
-  vector<su2double> donorDist(nPointDomain, 1e12);
+  vector<su2double> sumWeight(nPointDomain, 0.0);
+
+  /*--- Epsilon used to avoid division by zero. ---*/
+  const su2double eps = numeric_limits<passivedouble>::epsilon();
 
   /*--- Circle over all ranks. ---*/
 
@@ -3211,32 +4019,44 @@ void CSolver::InterpolateRestartData(const CGeometry *geometry, const CConfig *c
       else SU2_MPI::Recv(donorVars.data(), count, MPI_DOUBLE, src, 0, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
     }
 
+    /*--- Number of donors in this batch, the send buffer is padded by repeating
+     the last local donor, those duplicates must not be counted twice. ---*/
+
+    const auto nDonorStep = partitioner.GetSizeOnRank((rank - iStep + size) % size);
+
     /*--- Find the closest target for each donor. ---*/
 
     vector<su2double> targetDist(donorVars.rows());
     vector<unsigned long> iTarget(donorVars.rows());
 
     SU2_OMP_PARALLEL_(for schedule(dynamic,4*OMP_MIN_SIZE))
-    for (auto iDonor = 0ul; iDonor < donorVars.rows(); ++iDonor) {
+    for (auto iDonor = 0ul; iDonor < nDonorStep; ++iDonor) {
       int r=0;
       adt.DetermineNearestNode(donorVars[iDonor], targetDist[iDonor], iTarget[iDonor], r);
     }
     END_SU2_OMP_PARALLEL
 
-    /*--- Keep the closest donor for each target (this is separate for OpenMP). ---*/
+    /*--- Blend the donors of each target with inverse distance weights
+     (this is separate for OpenMP). ---*/
 
-    for (auto iDonor = 0ul; iDonor < donorVars.rows(); ++iDonor) {
+    for (auto iDonor = 0ul; iDonor < nDonorStep; ++iDonor) {
       const auto iPoint = iTarget[iDonor];
-      const auto dist = targetDist[iDonor];
+      const auto weight = 1.0 / (targetDist[iDonor] + eps);
 
-      if (dist < donorDist[iPoint]) {
-        donorDist[iPoint] = dist;
-        isMapped[iPoint] = true;
-        for (auto iVar = 0ul; iVar < donorVars.cols(); ++iVar)
-          localVars(iPoint,iVar) = donorVars(iDonor,iVar);
-      }
+      isMapped[iPoint] = true;
+      sumWeight[iPoint] += weight;
+      for (auto iVar = 0ul; iVar < donorVars.cols(); ++iVar)
+        localVars(iPoint,iVar) += weight * donorVars(iDonor,iVar);
     }
   }
+
+  /*--- Normalize the blended donor data. ---*/
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    if (!isMapped[iPoint]) continue;
+    for (auto iVar = 0ul; iVar < nFields; ++iVar)
+      localVars(iPoint,iVar) /= sumWeight[iPoint];
+  }
   } // everything goes out of scope except "localVars" and "isMapped"
 
   /*--- Recursively diffuse the nearest neighbor data. ---*/
@@ -3837,6 +4657,23 @@ void CSolver::LoadInletProfile(CGeometry **geometry,
         cout<<"No Inlet Interpolation being used"<<endl;
       }
 
+      /*--- For nearest-neighbor matching build an ADT of the profile point coordinates,
+            once per marker. The previous brute-force scan over all rows for every vertex
+            does not scale to large profile datasets. ---*/
+
+      std::unique_ptr<CADTPointsOnlyClass> profileADT;
+      if (!Interpolate && (nRows > 0)) {
+        vector<su2double> profileCoords(nRows*nDim);
+        vector<unsigned long> profileRows(nRows);
+        for (auto iRow = 0ul; iRow < nRows; iRow++) {
+          profileRows[iRow] = iRow;
+          for (auto iDim = 0u; iDim < nDim; iDim++)
+            profileCoords[iRow*nDim+iDim] = Inlet_Data[iRow*nColumns+iDim];
+        }
+        profileADT.reset(new CADTPointsOnlyClass(nDim, nRows, profileCoords.data(),
+                                                 profileRows.data(), false));
+      }
+
       /*--- Loop through the nodes on this marker. ---*/
 
       for (auto iVertex = 0ul; iVertex < geometry[MESH_0]->nVertex[iMarker]; iVertex++) {
@@ -3848,24 +4685,15 @@ void CSolver::LoadInletProfile(CGeometry **geometry,
 
           su2double min_dist = 1e16;
 
-          /*--- Find the distance to the closest point in our inlet profile data. ---*/
-
-          for (auto iRow = 0ul; iRow < nRows; iRow++) {
-
-            /*--- Get the coords for this data point. ---*/
-
-            const auto index = iRow*nColumns;
+          /*--- Find the closest point in our inlet profile data and store its values. ---*/
 
-            const auto dist = GeometryToolbox::Distance(nDim, Coord, &Inlet_Data[index]);
-
-            /*--- Check is this is the closest point and store data if so. ---*/
-
-            if (dist < min_dist) {
-              min_dist = dist;
-              for (auto iVar = 0ul; iVar < nColumns; iVar++)
-                Inlet_Values[iVar] = Inlet_Data[index+iVar];
-            }
+          if (profileADT != nullptr) {
+            unsigned long iRowNearest = 0;
+            int rankNearest = 0;
+            profileADT->DetermineNearestNode(Coord, min_dist, iRowNearest, rankNearest);
 
+            for (auto iVar = 0ul; iVar < nColumns; iVar++)
+              Inlet_Values[iVar] = Inlet_Data[iRowNearest*nColumns+iVar];
           }
 
           /*--- If the diff is less than the tolerance, match the two.
@@ -4049,6 +4877,23 @@ void CSolver::LoadInletProfile(CGeometry **geometry,
         cout<<"No Inlet Interpolation being used"<<endl;
       }
 
+      /*--- For nearest-neighbor matching build an ADT of the profile point coordinates,
+            once per marker. The previous brute-force scan over all rows for every vertex
+            does not scale to large profile datasets. ---*/
+
+      std::unique_ptr<CADTPointsOnlyClass> profileADT;
+      if (!Interpolate && (nRows > 0)) {
+        vector<su2double> profileCoords(nRows*nDim);
+        vector<unsigned long> profileRows(nRows);
+        for (auto iRow = 0ul; iRow < nRows; iRow++) {
+          profileRows[iRow] = iRow;
+          for (auto iDim = 0u; iDim < nDim; iDim++)
+            profileCoords[iRow*nDim+iDim] = Inlet_Data[iRow*nColumns+iDim];
+        }
+        profileADT.reset(new CADTPointsOnlyClass(nDim, nRows, profileCoords.data(),
+                                                 profileRows.data(), false));
+      }
+
       /*--- Loop through the nodes on this marker. ---*/
 
       for (auto iVertex = 0ul; iVertex < geometry[MESH_0]->nVertex[iMarker]; iVertex++) {
@@ -4060,24 +4905,15 @@ void CSolver::LoadInletProfile(CGeometry **geometry,
 
           su2double min_dist = 1e16;
 
-          /*--- Find the distance to the closest point in our inlet profile data. ---*/
-
-          for (auto iRow = 0ul; iRow < nRows; iRow++) {
-
-            /*--- Get the coords for this data point. ---*/
+          /*--- Find the closest point in our inlet profile data and store its values. ---*/
 
-            const auto index = iRow*nColumns;
-
-            const auto dist = GeometryToolbox::Distance(nDim, Coord, &Inlet_Data[index]);
-
-            /*--- Check is this is the closest point and store data if so. ---*/
-
-            if (dist < min_dist) {
-              min_dist = dist;
-              for (auto iVar = 0ul; iVar < nColumns; iVar++)
-                Inlet_Values[iVar] = Inlet_Data[index+iVar];
-            }
+          if (profileADT != nullptr) {
+            unsigned long iRowNearest = 0;
+            int rankNearest = 0;
+            profileADT->DetermineNearestNode(Coord, min_dist, iRowNearest, rankNearest);
 
+            for (auto iVar = 0ul; iVar < nColumns; iVar++)
+              Inlet_Values[iVar] = Inlet_Data[iRowNearest*nColumns+iVar];
           }
 
           /*--- If the diff is less than the tolerance, match the two.
@@ -4511,7 +5347,7 @@ void CSolver::BasicLoadRestart(CGeometry *geometry, const CConfig *config, const
   /*--- Delete the class memory that is used to load the restart. ---*/
 
   delete [] Restart_Vars;  Restart_Vars = nullptr;
-  delete [] Restart_Data;  Restart_Data = nullptr;
+  FreeRestartData();
 
   /*--- Detect a wrong solution file ---*/
 
@@ -26,6 +26,7 @@
  */
 
 #include "../../include/solvers/CTurbSASolver.hpp"
+#include "../../include/numerics_simd/turbulent/turb_sources.hpp"
 #include "../../include/variables/CTurbSAVariable.hpp"
 #include "../../include/variables/CFlowVariable.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
@@ -314,6 +315,18 @@ void CTurbSASolver::Source_Residual(CGeometry *geometry, CSolver **solver_contai
 
   auto* flowNodes = su2staticcast_p<CFlowVariable*>(solver_container[FLOW_SOL]->GetNodes());
 
+  /*--- Use the vectorized kernel for the standard model variant if vectorization
+   *    is requested, the model extensions that it does not implement (LM
+   *    transition, DES length scales) fall back to the generic loop. ---*/
+
+  if (config->GetUseVectorization() && (config->GetKind_Turb_Model() == TURB_MODEL::SA) && !transition &&
+      (config->GetKind_HybridRANSLES() == NO_HYBRIDRANSLES) && !harmonic_balance) {
+
+    if (nDim == 2) SourceResidualVectorized<2>(geometry, flowNodes, config);
+    else SourceResidualVectorized<3>(geometry, flowNodes, config);
+    return;
+  }
+
   /*--- Pick one numerics object per thread. ---*/
   auto* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
 
@@ -422,6 +435,85 @@ void CTurbSASolver::Source_Residual(CGeometry *geometry, CSolver **solver_contai
 
 }
 
+template<size_t nDim>
+void CTurbSASolver::SourceResidualVectorized(CGeometry *geometry, CFlowVariable *flowNodes,
+                                             const CConfig *config) {
+
+  const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  const bool transition_BC = (config->GetKind_Trans_Model() == BC);
+  const bool incompressible = (config->GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE);
+  const auto idxVisc = nDim + (incompressible? 4 : 5);
+
+  const CSASourceTerms<nDim> sourceTerms(*config);
+
+  AD::StartNoSharedReading();
+
+  /*--- Loop over all points, in SIMD groups, the padding lanes of the last
+   *    group repeat a valid point and are masked out of the update. ---*/
+
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (auto k = 0ul; k < nPointDomain; k += Double::Size) {
+
+    Int iPoint;
+    Double mask;
+    for (auto j = 0ul; j < Double::Size; ++j) {
+      const bool in = (k + j < nPointDomain);
+      mask[j] = in;
+      iPoint[j] = k + j*in;
+    }
+
+    /*--- Gather the point data, these are strided accesses that do not
+     *    vectorize, the payoff is in the arithmetic of the kernel. ---*/
+
+    Double nue, density, laminarVisc, strainMag, wallDist, roughness, volume;
+    VectorDbl<3> vorticity;
+    VectorDbl<nDim> nueGrad;
+
+    for (auto j = 0ul; j < Double::Size; ++j) {
+      const auto jPoint = iPoint[j];
+
+      const auto* V = flowNodes->GetPrimitive(jPoint);
+      density[j] = V[nDim+2];
+      laminarVisc[j] = V[idxVisc];
+
+      const auto* vort = flowNodes->GetVorticity(jPoint);
+      for (auto iDim = 0ul; iDim < 3; ++iDim) vorticity(iDim)[j] = vort[iDim];
+      strainMag[j] = flowNodes->GetStrainMag(jPoint);
+
+      nue[j] = nodes->GetSolution(jPoint, 0);
+      for (auto iDim = 0ul; iDim < nDim; ++iDim) nueGrad(iDim)[j] = nodes->GetGradient(jPoint, 0, iDim);
+
+      /*--- Roughness is accounted for by modifying the wall distance,
+       *    d_new = d + 0.03 k_s, as in the generic loop. ---*/
+      roughness[j] = geometry->nodes->GetRoughnessHeight(jPoint);
+      wallDist[j] = geometry->nodes->GetWall_Distance(jPoint) + 0.03*roughness[j];
+      volume[j] = geometry->nodes->GetVolume(jPoint);
+    }
+
+    /*--- Compute the source terms. ---*/
+
+    Double residual, jacobian, gammaBC;
+    sourceTerms.Compute(nue, density, laminarVisc, vorticity, strainMag, nueGrad,
+                        wallDist, roughness, volume, residual, jacobian, gammaBC);
+
+    /*--- Mask and scatter the update (the padding lanes subtract zero). ---*/
+
+    residual *= mask;
+    jacobian *= mask;
+
+    for (auto j = 0ul; j < Double::Size; ++j) {
+      const auto jPoint = iPoint[j];
+      LinSysRes(jPoint,0) -= residual[j];
+      if (implicit) Jacobian.AddVal2Diag(jPoint, -jacobian[j]);
+      if (transition_BC) nodes->SetGammaBC(jPoint, gammaBC[j]);
+    }
+  }
+  END_SU2_OMP_FOR
+
+  AD::EndNoSharedReading();
+
+}
+
 void CTurbSASolver::Source_Template(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                     CConfig *config, unsigned short iMesh) {
 }
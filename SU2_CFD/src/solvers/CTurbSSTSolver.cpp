@@ -26,6 +26,7 @@
  */
 
 #include "../../include/solvers/CTurbSSTSolver.hpp"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 #include "../../include/variables/CTurbSSTVariable.hpp"
 #include "../../include/variables/CFlowVariable.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
@@ -189,6 +190,22 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
 
 }
 
+void CTurbSSTSolver::InstantiateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) {
+
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER {
+
+  /*--- The vectorized numerics assume the compressible primitive layout, for
+   *    other regimes "edgeNumerics" stays null and the generic loop is used. ---*/
+  if (config->GetKind_Regime() == ENUM_REGIME::COMPRESSIBLE)
+    edgeNumerics = CNumericsSIMD::CreateSSTNumerics(*config, nDim, constants,
+                                                    solver_container[FLOW_SOL]->GetNodes());
+
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
 void CTurbSSTSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config,
          unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
 
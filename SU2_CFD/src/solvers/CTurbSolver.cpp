@@ -230,26 +230,51 @@ void CTurbSolver::LoadRestart(CGeometry** geometry, CSolver*** solver, CConfig*
       Read_SU2_Restart_ASCII(geometry[MESH_0], config, restart_filename);
     }
 
-    /*--- Skip flow variables ---*/
+    /*--- Locate the turbulence variables by name, which handles restart files
+     with extra or missing fields. SA-family models store Nu_Tilde, SST stores
+     Turb_Kin_Energy as the first variable. ---*/
 
-    unsigned short skipVars = nDim + solver[MESH_0][FLOW_SOL]->GetnVar();
+    short turbCol = GetRestartFieldIndex("Nu_Tilde");
+    if (turbCol < 0) turbCol = GetRestartFieldIndex("Turb_Kin_Energy");
 
-    /*--- Adjust the number of solution variables in the incompressible
-     restart. We always carry a space in nVar for the energy equation in the
-     mean flow solver, but we only write it to the restart if it is active.
-     Therefore, we must reduce skipVars here if energy is inactive so that
-     the turbulent variables are read correctly. ---*/
+    unsigned short skipVars;
 
-    bool incompressible = (config->GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE);
-    bool energy = config->GetEnergy_Equation();
-    bool weakly_coupled_heat = config->GetWeakly_Coupled_Heat();
+    if (turbCol >= 0) {
+      skipVars = turbCol;
+    }
+    else {
+
+      /*--- Fall back to the fixed layout for files without recognizable names,
+       skipping the coordinates and the flow variables. ---*/
+
+      skipVars = nDim + solver[MESH_0][FLOW_SOL]->GetnVar();
+
+      /*--- Adjust the number of solution variables in the incompressible
+       restart. We always carry a space in nVar for the energy equation in the
+       mean flow solver, but we only write it to the restart if it is active.
+       Therefore, we must reduce skipVars here if energy is inactive so that
+       the turbulent variables are read correctly. ---*/
+
+      bool incompressible = (config->GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE);
+      bool energy = config->GetEnergy_Equation();
+      bool weakly_coupled_heat = config->GetWeakly_Coupled_Heat();
+
+      if (incompressible && ((!energy) && (!weakly_coupled_heat))) skipVars--;
+    }
+
+    /*--- A flow-only restart (partial-field) does not hold the turbulence
+     variables at all, in that case keep the freestream initialization
+     instead of reading past the record. ---*/
+
+    const bool turbFieldsPresent = (turbCol >= 0) || (skipVars + nVar <= Restart_Vars[1]);
 
-    if (incompressible && ((!energy) && (!weakly_coupled_heat))) skipVars--;
+    if (!turbFieldsPresent && (rank == MASTER_NODE))
+      cout << "Restart file does not contain the turbulence variables, re-initializing them." << endl;
 
     /*--- Load data from the restart into correct containers. ---*/
 
     unsigned long counter = 0, iPoint_Global = 0;
-    for (; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++) {
+    for (; turbFieldsPresent && iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++) {
       /*--- Retrieve local index. If this node from the restart file lives
        on the current processor, we will load and instantiate the vars. ---*/
 
@@ -269,7 +294,7 @@ void CTurbSolver::LoadRestart(CGeometry** geometry, CSolver*** solver, CConfig*
 
     /*--- Detect a wrong solution file ---*/
 
-    if (counter != nPointDomain) {
+    if (turbFieldsPresent && (counter != nPointDomain)) {
       SU2_MPI::Error(string("The solution file ") + restart_filename + string(" doesn't match with the mesh file!\n") +
                          string("It could be empty lines at the end of the file."),
                      CURRENT_FUNCTION);
@@ -321,8 +346,7 @@ void CTurbSolver::LoadRestart(CGeometry** geometry, CSolver*** solver, CConfig*
 
     delete[] Restart_Vars;
     Restart_Vars = nullptr;
-    delete[] Restart_Data;
-    Restart_Data = nullptr;
+    FreeRestartData();
   }
   END_SU2_OMP_MASTER
   SU2_OMP_BARRIER
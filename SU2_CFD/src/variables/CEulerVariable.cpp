@@ -121,6 +121,32 @@ bool CEulerVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel) {
   return RightVol;
 }
 
+bool CEulerVariable::SetPrimVar(unsigned long iPoint, su2double pressure, su2double temperature,
+                                su2double soundspeed2, su2double val_dPdrho_e, su2double val_dPde_rho,
+                                CFluidModel *FluidModel) {
+
+  bool check_dens  = SetDensity(iPoint);
+  bool check_press = SetPressure(iPoint, pressure);
+  bool check_sos   = SetSoundSpeed(iPoint, soundspeed2);
+  bool check_temp  = SetTemperature(iPoint, temperature);
+
+  /*--- For non-physical solutions take the point-wise path, which restores
+   the old solution and re-evaluates the fluid model on it. ---*/
+
+  if (check_dens || check_press || check_sos || check_temp) {
+    SetPrimVar(iPoint, FluidModel);
+    SetSecondaryVar(iPoint, FluidModel);
+    return false;
+  }
+
+  SetEnthalpy(iPoint); // Requires pressure computation.
+
+  SetdPdrho_e(iPoint, val_dPdrho_e);
+  SetdPde_rho(iPoint, val_dPde_rho);
+
+  return true;
+}
+
 void CEulerVariable::SetSecondaryVar(unsigned long iPoint, CFluidModel *FluidModel) {
 
    /*--- Compute secondary thermo-physical properties (partial derivatives...) ---*/
@@ -201,6 +201,56 @@ bool CNSVariable::SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2doubl
   return RightVol;
 }
 
+bool CNSVariable::SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2double turb_ke, su2double pressure,
+                             su2double temperature, su2double soundspeed2, su2double val_dPdrho_e,
+                             su2double val_dPde_rho, su2double val_dTdrho_e, su2double val_dTde_rho,
+                             su2double laminar_visc, su2double val_dmudrho_T, su2double val_dmudT_rho,
+                             su2double thermal_cond, su2double val_dktdrho_T, su2double val_dktdT_rho, su2double cp,
+                             CFluidModel *FluidModel) {
+
+  bool check_dens  = SetDensity(iPoint);
+  bool check_press = SetPressure(iPoint, pressure);
+  bool check_sos   = SetSoundSpeed(iPoint, soundspeed2);
+  bool check_temp  = SetTemperature(iPoint, temperature);
+
+  /*--- For non-physical states fall back to the point-wise update, which
+   restores the old solution and re-evaluates the fluid model on it. ---*/
+
+  if (check_dens || check_press || check_sos || check_temp) {
+    SetPrimVar(iPoint, eddy_visc, turb_ke, FluidModel);
+    SetSecondaryVar(iPoint, FluidModel);
+    return false;
+  }
+
+  /*--- Set the remaining primitive variables from the batch values. ---*/
+
+  SetEnthalpy(iPoint); // Requires pressure computation.
+
+  SetLaminarViscosity(iPoint, laminar_visc);
+
+  SetEddyViscosity(iPoint, eddy_visc);
+
+  SetThermalConductivity(iPoint, thermal_cond);
+
+  SetSpecificHeatCp(iPoint, cp);
+
+  /*--- Set the secondary variables (partial derivatives) from the batch values. ---*/
+
+  SetdPdrho_e(iPoint, val_dPdrho_e);
+  SetdPde_rho(iPoint, val_dPde_rho);
+
+  SetdTdrho_e(iPoint, val_dTdrho_e);
+  SetdTde_rho(iPoint, val_dTde_rho);
+
+  Setdmudrho_T(iPoint, val_dmudrho_T);
+  SetdmudT_rho(iPoint, val_dmudT_rho);
+
+  Setdktdrho_T(iPoint, val_dktdrho_T);
+  SetdktdT_rho(iPoint, val_dktdT_rho);
+
+  return true;
+}
+
 void CNSVariable::SetSecondaryVar(unsigned long iPoint, CFluidModel *FluidModel) {
 
     /*--- Compute secondary thermodynamic properties (partial derivatives...) ---*/
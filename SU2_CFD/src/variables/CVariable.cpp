@@ -98,6 +98,19 @@ void CVariable::Set_Solution_time_n1() {
   parallelCopy(Solution_time_n.size(), Solution_time_n.data(), Solution_time_n1.data());
 }
 
+void CVariable::Shift_Solution_time() {
+  assert(Solution_time_n1.size() == Solution_time_n.size());
+
+  /*--- The n-1 level takes over the storage of the n level, no copy. ---*/
+  SU2_OMP_MASTER
+  std::swap(Solution_time_n1, Solution_time_n);
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  /*--- Only the current solution needs to be copied, it remains in use. ---*/
+  Set_Solution_time_n();
+}
+
 void CVariable::Set_BGSSolution_k() {
   assert(Solution_BGS_k.size() == Solution.size());
   parallelCopy(Solution.size(), Solution.data(), Solution_BGS_k.data());
@@ -434,7 +434,7 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
 
   unsigned short iDV, nDV, iFFDBox, nDV_Value, iMarker, iDim;
   unsigned long iVertex, iPoint;
-  su2double delta_eps, my_Gradient, localGradient, *Normal, dS, *VarCoord, Sensitivity,
+  su2double delta_eps, *Normal, dS, *VarCoord, Sensitivity,
   dalpha[3], deps[3], dalpha_deps;
   bool *UpdatePoint, MoveSurface, Local_MoveSurface;
   CFreeFormDefBox **FFDBox;
@@ -465,6 +465,11 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
   if (rank == MASTER_NODE)
     cout << "Evaluate functional gradient using Finite Differences." << endl;
 
+  /*--- The local contributions of all design variables are reduced over the
+   ranks in a single collective operation after the loop. ---*/
+
+  vector<su2double> myGradient(nDV, 0.0), totalGradient(nDV, 0.0);
+
   for (iDV = 0; iDV < nDV; iDV++) {
 
     MoveSurface = true;
@@ -624,7 +629,7 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
 
       /*--- If the Angle of attack is not involved, reset the value of the gradient ---*/
 
-      my_Gradient = 0.0; Gradient[iDV][0] = 0.0;
+      Gradient[iDV][0] = 0.0;
 
       if (MoveSurface) {
 
@@ -657,16 +662,24 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
                   dalpha_deps -= dalpha[iDim]*deps[iDim];
                 }
 
-                my_Gradient += Sensitivity*dalpha_deps;
+                myGradient[iDV] += Sensitivity*dalpha_deps;
                 UpdatePoint[iPoint] = false;
               }
             }
           }
         }
       }
+    }
+  }
+
+  /*--- Sum the contributions of all ranks, one collective for all design variables. ---*/
 
-      SU2_MPI::Allreduce(&my_Gradient, &localGradient, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      Gradient[iDV][0] += localGradient;
+  SU2_MPI::Allreduce(myGradient.data(), totalGradient.data(), nDV, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+  for (iDV = 0; iDV < nDV; iDV++) {
+    if ((config->GetDesign_Variable(iDV) != ANGLE_OF_ATTACK) &&
+        (config->GetDesign_Variable(iDV) != FFD_ANGLE_OF_ATTACK)) {
+      Gradient[iDV][0] += totalGradient[iDV];
     }
   }
 
@@ -688,7 +701,7 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
 
 void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *surface_movement, su2double** Gradient){
 
-  su2double *VarCoord = nullptr, Sensitivity, my_Gradient, localGradient, *Normal, Area = 0.0;
+  su2double *VarCoord = nullptr, Sensitivity, *Normal, Area = 0.0;
   unsigned short iDV_Value = 0, iMarker, nMarker, iDim, nDim, iDV, nDV;
   unsigned long iVertex, nVertex, iPoint;
 
@@ -770,13 +783,26 @@ void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
 
   AD::ComputeAdjoint();
 
-  for (iDV = 0; iDV  < nDV; iDV++){
+  /*--- Extract the local derivatives of all design variable values and reduce
+   them over the ranks in a single collective operation, instead of one
+   Allreduce per value (which dominates for optimizations with many DVs). ---*/
 
-    for (iDV_Value = 0; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++){
+  vector<su2double> myGradient, totalGradient;
+
+  for (iDV = 0; iDV  < nDV; iDV++)
+    for (iDV_Value = 0; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++)
+      myGradient.push_back(SU2_TYPE::GetDerivative(config->GetDV_Value(iDV, iDV_Value)));
+
+  totalGradient.resize(myGradient.size());
 
-      my_Gradient = SU2_TYPE::GetDerivative(config->GetDV_Value(iDV, iDV_Value));
+  SU2_MPI::Allreduce(myGradient.data(), totalGradient.data(), myGradient.size(),
+                     MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
 
-      SU2_MPI::Allreduce(&my_Gradient, &localGradient, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  unsigned long iTotal = 0;
+
+  for (iDV = 0; iDV  < nDV; iDV++){
+
+    for (iDV_Value = 0; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++){
 
       /*--- Angle of Attack design variable (this is different,
        the value comes form the input file) ---*/
@@ -786,7 +812,7 @@ void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
         Gradient[iDV][iDV_Value] = config->GetAoA_Sens();
       }
 
-      Gradient[iDV][iDV_Value] += localGradient;
+      Gradient[iDV][iDV_Value] += totalGradient[iTotal++];
     }
   }
 
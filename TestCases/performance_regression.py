@@ -0,0 +1,273 @@
+#!/usr/bin/env python
+
+## \file performance_regression.py
+#  \brief Python script for automated performance-regression testing of SU2 examples
+#  \version 7.2.1 "Blackbird"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+from __future__ import print_function, division, absolute_import
+import argparse
+import json
+import os
+import subprocess
+import sys
+import time
+
+# Name of the per-kernel statistics file written by PROFILE builds (see
+# Common/include/toolboxes/profiling_toolbox.hpp). When the file appears the
+# harness also tracks the total time of every instrumented kernel, otherwise
+# only the wall time of the run is compared.
+KERNEL_PROFILE_FILE = 'su2_kernel_profile.json'
+
+
+def median(values):
+    """Median of a list, the repeat counts are small so no libraries needed."""
+    ordered = sorted(values)
+    n = len(ordered)
+    if n % 2 == 1:
+        return ordered[n // 2]
+    return 0.5 * (ordered[n // 2 - 1] + ordered[n // 2])
+
+
+def spread(values):
+    """Half the range of the repeats, the noise estimate stored with each metric."""
+    return 0.5 * (max(values) - min(values))
+
+
+class PerformanceCase:
+    """One curated case: run for a fixed iteration count several times and
+       collect the wall time (and kernel times of PROFILE builds)."""
+
+    def __init__(self, tag):
+        self.tag      = tag
+        self.cfg_dir  = "."
+        self.cfg_file = "default.cfg"
+        self.iterations = 100
+        self.su2_exec = "SU2_CFD"
+        self.repeats  = 3
+        self.timeout  = 1600
+
+    def write_cfg(self):
+        """Copy the config with the iteration count pinned, as TestCase.adjust_iter does."""
+        file_in = open(self.cfg_file, 'r')
+        lines = file_in.readlines()
+        file_in.close()
+
+        cfg_out = "%s.autoperf" % self.cfg_file
+        file_out = open(cfg_out, 'w')
+        file_out.write('%% This file automatically generated by the performance regression script\n')
+        file_out.write('%% Number of iterations changed to %d\n' % self.iterations)
+        for line in lines:
+            key = line.strip().split("=")[0].strip()
+            if key in ("ITER", "TIME_ITER", "EXT_ITER"):
+                file_out.write("%s= %d\n" % (key, self.iterations))
+            else:
+                file_out.write(line)
+        file_out.close()
+        return cfg_out
+
+    def run(self):
+        """Run the case repeats+1 times (the first run warms caches and is
+           discarded) and return {metric: {"value": median, "spread": noise}}."""
+
+        print('==================== Start Case: %s ====================' % self.tag)
+
+        workdir = os.getcwd()
+        os.chdir(self.cfg_dir)
+        cfg_out = self.write_cfg()
+        logfile = '%s.log' % os.path.splitext(self.cfg_file)[0]
+
+        su2_exec = self.su2_exec
+        if os.geteuid() == 0 and su2_exec.startswith('mpirun'):
+            su2_exec = su2_exec.replace('mpirun', 'mpirun --allow-run-as-root')
+        command = "%s %s > %s 2>&1" % (su2_exec, cfg_out, logfile)
+
+        wall_times = []
+        kernel_times = {}
+
+        for repeat in range(self.repeats + 1):
+            if os.path.isfile(KERNEL_PROFILE_FILE):
+                os.remove(KERNEL_PROFILE_FILE)
+
+            start = time.time()
+            process = subprocess.Popen(command, shell=True)
+            while process.poll() is None:
+                time.sleep(0.1)
+                if time.time() - start > self.timeout:
+                    process.kill()
+                    os.system('killall %s' % self.su2_exec)
+                    os.chdir(workdir)
+                    print('%s: ERROR, execution timed out. timeout=%d' % (self.tag, self.timeout))
+                    return None
+            elapsed = time.time() - start
+
+            process.communicate()
+            if process.returncode != 0:
+                os.chdir(workdir)
+                print('%s: ERROR, SU2 returned %d, see %s/%s' % (self.tag, process.returncode, self.cfg_dir, logfile))
+                return None
+
+            if repeat == 0:
+                continue
+
+            wall_times.append(elapsed)
+            if os.path.isfile(KERNEL_PROFILE_FILE):
+                profile = json.load(open(KERNEL_PROFILE_FILE))
+                for kernel in profile.get("kernels", []):
+                    name = "kernel:%s" % kernel["name"]
+                    kernel_times.setdefault(name, []).append(kernel["total_time"]["mean"])
+
+        os.chdir(workdir)
+
+        metrics = {"wall_time": {"value": median(wall_times), "spread": spread(wall_times)}}
+        for name, values in kernel_times.items():
+            if len(values) == len(wall_times):
+                metrics[name] = {"value": median(values), "spread": spread(values)}
+
+        print('%s: wall time %.3f s (+- %.3f s over %d runs), %d kernel metrics'
+              % (self.tag, metrics["wall_time"]["value"], metrics["wall_time"]["spread"],
+                 self.repeats, len(metrics) - 1))
+        return metrics
+
+
+def compare(baseline, references, threshold, noise_factor):
+    """Compare the new baseline against the stored references. A metric fails when
+       it exceeds the reference by more than the larger of the fixed relative
+       threshold and noise_factor times the recorded run-to-run noise."""
+
+    passed = True
+
+    for tag in sorted(baseline.keys()):
+        if tag not in references:
+            print('%s: no reference stored, skipping comparison' % tag)
+            continue
+
+        for metric in sorted(baseline[tag].keys()):
+            if metric not in references[tag]:
+                continue
+
+            value = baseline[tag][metric]["value"]
+            ref = references[tag][metric]["value"]
+            noise = references[tag][metric]["spread"] + baseline[tag][metric]["spread"]
+            if ref <= 0.0:
+                continue
+
+            allowed = ref * (1.0 + max(threshold, noise_factor * noise / ref))
+            ratio = value / ref
+
+            if value > allowed:
+                print('%s / %s: FAILED (%.3f s vs reference %.3f s, %+.1f%%, allowed %+.1f%%)'
+                      % (tag, metric, value, ref, 100 * (ratio - 1), 100 * (allowed / ref - 1)))
+                passed = False
+            else:
+                print('%s / %s: passed (%+.1f%%)' % (tag, metric, 100 * (ratio - 1)))
+
+    return passed
+
+
+def main():
+    '''This program runs a curated subset of the TestCases configs for fixed
+       iteration counts and compares the measured wall time (and, in PROFILE
+       builds, the per-kernel times) against stored references, so that
+       iteration-time regressions are caught before release. References are
+       machine specific: generate them once per machine with --update.'''
+
+    parser = argparse.ArgumentParser(description=main.__doc__)
+    parser.add_argument('-s', '--su2-exec', default='SU2_CFD',
+                        help='SU2 command, e.g. "mpirun -n 4 SU2_CFD"')
+    parser.add_argument('-r', '--repeats', type=int, default=3,
+                        help='timed runs per case (one extra warm-up run is discarded)')
+    parser.add_argument('-t', '--threshold', type=float, default=0.10,
+                        help='relative slow-down tolerated regardless of noise')
+    parser.add_argument('-n', '--noise-factor', type=float, default=4.0,
+                        help='multiples of the recorded run-to-run noise tolerated')
+    parser.add_argument('-b', '--baseline-file', default='performance_baseline.json',
+                        help='where to write the measurements of this run')
+    parser.add_argument('-f', '--reference-file', default='performance_references.json',
+                        help='stored references to compare against')
+    parser.add_argument('-u', '--update', action='store_true',
+                        help='store this run as the new reference instead of comparing')
+    args = parser.parse_args()
+
+    case_list = []
+
+    # Inviscid NACA0012, exercises the convective kernels and implicit solves.
+    inv_naca0012            = PerformanceCase('perf_euler_naca0012')
+    inv_naca0012.cfg_dir    = "euler/naca0012"
+    inv_naca0012.cfg_file   = "inv_NACA0012.cfg"
+    inv_naca0012.iterations = 100
+    case_list.append(inv_naca0012)
+
+    # Laminar flat plate, adds the viscous residuals and gradients.
+    lam_flatplate            = PerformanceCase('perf_ns_flatplate')
+    lam_flatplate.cfg_dir    = "navierstokes/flatplate"
+    lam_flatplate.cfg_file   = "lam_flatplate.cfg"
+    lam_flatplate.iterations = 100
+    case_list.append(lam_flatplate)
+
+    # RANS RAE2822 (SA), adds the turbulence solver and limiters.
+    turb_rae2822            = PerformanceCase('perf_rans_rae2822_sa')
+    turb_rae2822.cfg_dir    = "rans/rae2822"
+    turb_rae2822.cfg_file   = "turb_SA_RAE2822.cfg"
+    turb_rae2822.iterations = 50
+    case_list.append(turb_rae2822)
+
+    # Incompressible RANS NACA0012, covers the pressure-based path.
+    inc_turb_naca0012            = PerformanceCase('perf_inc_rans_naca0012')
+    inc_turb_naca0012.cfg_dir    = "incomp_rans/naca0012"
+    inc_turb_naca0012.cfg_file   = "naca0012.cfg"
+    inc_turb_naca0012.iterations = 50
+    case_list.append(inc_turb_naca0012)
+
+    baseline = {}
+    failed_runs = False
+    for case in case_list:
+        case.su2_exec = args.su2_exec
+        case.repeats = args.repeats
+        metrics = case.run()
+        if metrics is None:
+            failed_runs = True
+        else:
+            baseline[case.tag] = metrics
+
+    with open(args.baseline_file, 'w') as f:
+        json.dump(baseline, f, indent=2, sort_keys=True)
+    print('Baseline written to %s.' % args.baseline_file)
+
+    if args.update:
+        with open(args.reference_file, 'w') as f:
+            json.dump(baseline, f, indent=2, sort_keys=True)
+        print('References updated in %s.' % args.reference_file)
+        sys.exit(1 if failed_runs else 0)
+
+    if not os.path.isfile(args.reference_file):
+        print('No reference file %s, run with --update to create one.' % args.reference_file)
+        sys.exit(1)
+
+    references = json.load(open(args.reference_file))
+    passed = compare(baseline, references, args.threshold, args.noise_factor) and not failed_runs
+
+    sys.exit(0 if passed else 1)
+
+
+if __name__ == '__main__':
+    main()
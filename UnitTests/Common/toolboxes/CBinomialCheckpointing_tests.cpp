@@ -0,0 +1,104 @@
+/*!
+ * \file CBinomialCheckpointing_tests.cpp
+ * \brief Unit tests for the binomial checkpointing schedule generator.
+ * The schedule must reverse every step exactly once, in descending order,
+ * from a consistent primal state, without exceeding the slot budget.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <map>
+#include "../../../Common/include/toolboxes/CBinomialCheckpointing.hpp"
+
+namespace {
+
+/*--- Replay a schedule on a mock primal whose "state" is the step index,
+ * checking every invariant the adjoint driver would rely on. ---*/
+void validateSchedule(unsigned long nSteps, int nSlots) {
+  using ActionType = CBinomialCheckpointing::ActionType;
+
+  CBinomialCheckpointing schedule(nSteps, nSlots);
+  CBinomialCheckpointing::Action action;
+
+  std::map<int, unsigned long> slots;
+  unsigned long state = 0;
+  unsigned long nextReversed = nSteps;
+
+  while (schedule.Next(action)) {
+    switch (action.type) {
+      case ActionType::STORE:
+        REQUIRE(action.slot >= 0);
+        REQUIRE(action.slot < nSlots);
+        slots[action.slot] = state;
+        REQUIRE(slots.size() <= static_cast<size_t>(nSlots));
+        break;
+
+      case ActionType::RESTORE:
+        REQUIRE(slots.count(action.slot) == 1);
+        REQUIRE(slots[action.slot] == action.step);
+        state = action.step;
+        break;
+
+      case ActionType::ADVANCE:
+        REQUIRE(action.step == state);
+        REQUIRE(action.target > action.step);
+        state = action.target;
+        break;
+
+      case ActionType::REVERSE:
+        /*--- Steps must be reversed in descending order from their own state. ---*/
+        REQUIRE(action.step == nextReversed - 1);
+        REQUIRE(action.step == state);
+        state += 1;
+        nextReversed -= 1;
+        break;
+    }
+  }
+  REQUIRE(nextReversed == 0);
+}
+
+}  // namespace
+
+TEST_CASE("Binomial checkpointing schedules are valid", "[Toolboxes]") {
+  validateSchedule(1, 1);
+  validateSchedule(2, 1);
+  validateSchedule(10, 1);
+  validateSchedule(10, 2);
+  validateSchedule(10, 3);
+  validateSchedule(30, 3);
+  validateSchedule(100, 5);
+  validateSchedule(257, 4);
+}
+
+TEST_CASE("Checkpointing overhead stays far below step squared", "[Toolboxes]") {
+  /*--- With a logarithmic slot budget the number of primal step evaluations
+   * must stay within a small multiple of the horizon. ---*/
+  const unsigned long nSteps = 1000;
+  CBinomialCheckpointing schedule(nSteps, 10);
+  REQUIRE(schedule.GetnPrimalSteps() <= 5 * nSteps);
+
+  /*--- With as many slots as steps nothing is recomputed: one forward sweep
+   * (the last step needs no checkpoint) plus one recording per step. ---*/
+  CBinomialCheckpointing dense(64, 64);
+  REQUIRE(dense.GetnPrimalSteps() == 2 * 64 - 1);
+}